@@ -0,0 +1,99 @@
+/*
+ * audio_buffer_stress.cpp
+ *
+ * AudioBuffer (audio_buffer/audio_buffer.cpp) between two threads, as loop() and the audio task use it:
+ *   producer  writeSpace(), fill getWritePtr() with a random amount, bytesWritten()
+ *   consumer  bufferFilled(), getReadPtr(), read at most min(filled, maxBlockSize) bytes, bytesWasRead()
+ * the bytes are a counter stream, every byte the consumer sees must be the next one the producer wrote, across the
+ * wrap and through the mirror behind m_buffSize; both sides yield or sleep at random to shake the interleavings.
+ * audio_buffer_stress_tsan is the same under ThreadSanitizer
+ *
+ *   audio_buffer_stress [megabytes]    per configuration, default 64
+ *
+ */
+#include "audio_buffer/audio_buffer.h"
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+
+static inline uint8_t streamByte(uint64_t i) { return (uint8_t)((i * 0x9E3779B97F4A7C15ull) >> 56); }
+
+static void jitter(std::mt19937& rnd) {
+    uint32_t r = rnd() % 64;
+    if (r == 0) std::this_thread::sleep_for(std::chrono::microseconds(rnd() % 200));
+    else if (r < 8) std::this_thread::yield();
+}
+
+struct config_t {
+    const char* name;
+    size_t      ctorBlockSize; // AudioBuffer(maxBlockSize), 0: InBuff, mirror of 4096 * 6
+    uint16_t    maxBlockSize;  // changeMaxBlockSize(), the decoder's frame limit
+    size_t      buffSize;
+};
+
+static bool stress(const config_t& c, uint64_t total) {
+    AudioBuffer buf(c.ctorBlockSize);
+    if (!buf.setBufsize(c.buffSize)) return false;
+    buf.changeMaxBlockSize(c.maxBlockSize);
+
+    std::atomic<uint64_t> badAt{UINT64_MAX};
+    std::thread           producer([&]() {
+        std::mt19937 rnd(1);
+        uint64_t     n = 0;
+        while (n < total && badAt.load() == UINT64_MAX) {
+            size_t space = std::min<uint64_t>(buf.writeSpace(), total - n);
+            if (!space) {
+                std::this_thread::yield();
+                continue;
+            }
+            size_t   len = 1 + rnd() % space;
+            uint8_t* p = buf.getWritePtr();
+            for (size_t i = 0; i < len; i++) p[i] = streamByte(n + i);
+            buf.bytesWritten(len);
+            n += len;
+            jitter(rnd);
+        }
+    });
+
+    std::mt19937 rnd(2);
+    uint64_t     n = 0, reads = 0, wraps = 0;
+    auto         t = std::chrono::steady_clock::now();
+    while (n < total && badAt.load() == UINT64_MAX) {
+        size_t filled = buf.bufferFilled();
+        if (!filled) {
+            std::this_thread::yield();
+            continue;
+        }
+        size_t         len = 1 + rnd() % std::min<size_t>(filled, c.maxBlockSize);
+        uint32_t       before = buf.getReadPos();
+        const uint8_t* p = buf.getReadPtr();
+        for (size_t i = 0; i < len; i++) {
+            if (p[i] != streamByte(n + i)) {
+                badAt.store(n + i);
+                break;
+            }
+        }
+        buf.bytesWasRead(len);
+        if (buf.getReadPos() < before) wraps++;
+        n += len;
+        reads++;
+        jitter(rnd);
+    }
+    producer.join();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+    bool   ok = badAt.load() == UINT64_MAX && n == total && buf.bufferFilled() == 0;
+    printf("%-6s buffer %6zu block %5u: %10llu bytes, %8llu reads, %7llu wraps, %8.0f ms  %s\n", c.name, c.buffSize, c.maxBlockSize, (unsigned long long)n,
+           (unsigned long long)reads, (unsigned long long)wraps, ms, ok ? "ok" : "FAILED");
+    if (badAt.load() != UINT64_MAX) printf("  byte %llu differs\n", (unsigned long long)badAt.load());
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    uint64_t total = (argc > 1 ? std::max(1, atoi(argv[1])) : 64) * 1024ull * 1024;
+    // InBuff with the block sizes of Audio.cpp (m_frameSizeMP3, m_frameSizeFLAC) and m_netBuff, small rings for many wraps
+    const config_t configs[] = {{"mp3", 0, 1600 * 2, 2 * 4096 * 6 + 333}, {"flac", 0, 4096 * 6, 2 * 4096 * 6 + 1000}, {"net", 4096, 4096, 4096 * 4}};
+    bool           ok = true;
+    for (const config_t& c : configs) ok &= stress(c, total);
+    return ok ? 0 : 1;
+}
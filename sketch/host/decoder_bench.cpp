@@ -0,0 +1,86 @@
+/*
+ * decoder_bench.cpp
+ *
+ * decode speed and memory of the decoders on the build host, one line per file:
+ *   frames/s and x realtime from the time spent in decode(), peak heap from the ps_ptr accounting of the decoder
+ *
+ *   decoder_bench [--profile] [--synthetic] [file | directory] ...
+ *     --synthetic  MP3, FLAC and Opus streams from synth.cpp, fails if FLAC is not lossless
+ *     --profile    per-function self time (build with -DAUDIO_HOST_PROFILE=ON), the hooks slow small functions down,
+ *                  compare the shares, not the absolute times
+ *
+ */
+#include "decoder_host.h"
+#include <filesystem>
+
+static bool s_profile = false;
+
+static bool bench(const char* name, host_codec_t codec, std::vector<uint8_t>& data, host_decode_t& d) {
+    host_profile_reset();
+    bool ok = host_decode(codec, data, d);
+    if (!ok) {
+        printf("%-28s %-6s decode failed, %u errors\n", name, host_codec_name(codec), d.errors);
+        return false;
+    }
+    double sec = d.decodeNs / 1e9;
+    double audioSec = d.sampleRate ? (double)d.samples / d.sampleRate : 0;
+    printf("%-28s %-6s %6u frames %5u err %8.0f frames/s %7.1f x realtime, peak heap %7d bytes\n", name, host_codec_name(codec), d.frames, d.errors, sec > 0 ? d.frames / sec : 0,
+           sec > 0 ? audioSec / sec : 0, d.heap.peak);
+    if (s_profile) host_profile_report(stdout);
+    return true;
+}
+
+static int synthetic() {
+    int                  fails = 0;
+    host_decode_t        d;
+    std::vector<uint8_t> mp3 = synth_mp3(2000, 1);
+    if (!bench("synthetic.mp3", HOST_MP3, mp3, d)) fails++;
+
+    std::vector<int16_t> ref;
+    std::vector<uint8_t> flac = synth_flac(200, 2, &ref);
+    if (!bench("synthetic.flac", HOST_FLAC, flac, d)) fails++;
+    else if (d.pcm != ref) {
+        size_t i = 0;
+        while (i < std::min(d.pcm.size(), ref.size()) && d.pcm[i] == ref[i]) i++;
+        printf("synthetic.flac: not lossless, %zu of %zu samples, first difference at %zu\n", d.pcm.size(), ref.size(), i);
+        fails++;
+    }
+
+    std::vector<uint8_t> opus = synth_opus(2000, 3);
+    if (!bench("synthetic.opus", HOST_OPUS, opus, d)) fails++;
+    return fails;
+}
+
+int main(int argc, char** argv) {
+    int  fails = 0;
+    bool any = false;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "--profile") {
+            s_profile = true;
+            if (!host_profile_available()) host_profile_report(stdout);
+        } else if (a == "--synthetic") {
+            any = true;
+            fails += synthetic();
+        } else if (std::filesystem::is_directory(a)) {
+            for (auto& e : std::filesystem::directory_iterator(a)) files.push_back(e.path().string());
+        } else {
+            files.push_back(a);
+        }
+    }
+    std::sort(files.begin(), files.end());
+    for (auto& f : files) {
+        std::vector<uint8_t> data = host_read_file(f);
+        host_codec_t         codec = host_codec_of(f, data);
+        if (codec == HOST_NONE) continue;
+        any = true;
+        host_decode_t d;
+        if (!bench(std::filesystem::path(f).filename().c_str(), codec, data, d)) fails++;
+    }
+    if (!any) {
+        fprintf(stderr, "usage: %s [--profile] [--synthetic] [file | directory] ...\n", argv[0]);
+        return 2;
+    }
+    return fails ? 1 : 0;
+}
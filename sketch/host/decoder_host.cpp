@@ -0,0 +1,273 @@
+/*
+ * decoder_host.cpp
+ *
+ * host driver of the decoders, a condensed Audio::playAudioData() / sendBytes() / findNextSync() for a file in memory,
+ * the input block sizes are those of Audio.cpp (m_frameSizeMP3 ...)
+ *
+ */
+#include "decoder_host.h"
+#include "aac_decoder/aac_decoder.h"
+#include "flac_decoder/flac_decoder.h"
+#include "mp3_decoder/mp3_decoder.h"
+#include "opus_decoder/opus_decoder.h"
+#include "vorbis_decoder/vorbis_decoder.h"
+#include <chrono>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <fstream>
+#include <unordered_map>
+
+static constexpr size_t outbuffSize = 4096 * 4; // Audio::m_outbuffSize
+
+const char* host_codec_name(host_codec_t codec) {
+    static const char* names[] = {"NONE", "MP3", "AAC", "FLAC", "OPUS", "VORBIS"};
+    return names[codec <= HOST_VORBIS ? codec : 0];
+}
+
+static size_t blockSizeOf(host_codec_t codec) {
+    switch (codec) {
+        case HOST_MP3: return 1600 * 2;
+        case HOST_AAC: return 1600;
+        case HOST_FLAC: return 4096 * 6;
+        case HOST_OPUS: return 2048;
+        case HOST_VORBIS: return 4096 * 2;
+        default: return 0;
+    }
+}
+
+static bool findBytes(const std::vector<uint8_t>& data, size_t limit, const char* what, size_t len) {
+    limit = std::min(limit, data.size());
+    for (size_t i = 0; i + len <= limit; i++) {
+        if (memcmp(data.data() + i, what, len) == 0) return true;
+    }
+    return false;
+}
+
+host_codec_t host_codec_of(const std::string& path, const std::vector<uint8_t>& data) {
+    std::string ext = path.substr(path.find_last_of('.') + 1);
+    for (char& c : ext) c = tolower(c);
+    if (ext == "mp3") return HOST_MP3;
+    if (ext == "aac") return HOST_AAC;
+    if (ext == "flac") return HOST_FLAC;
+    if (ext == "opus") return HOST_OPUS;
+    if (ext == "ogg" || ext == "oga") { // the first page tells the codec
+        if (findBytes(data, 128, "OpusHead", 8)) return HOST_OPUS;
+        if (findBytes(data, 128, "\x01vorbis", 7)) return HOST_VORBIS;
+        if (findBytes(data, 128, "\x7f" "FLAC", 5)) return HOST_FLAC;
+    }
+    return HOST_NONE;
+}
+
+std::vector<uint8_t> host_read_file(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+}
+
+std::unique_ptr<Decoder> host_create_decoder(host_codec_t codec) {
+    static Audio audio;
+    switch (codec) {
+        case HOST_MP3: return std::make_unique<MP3Decoder>(audio);
+        case HOST_AAC: return std::make_unique<AACDecoder>(audio);
+        case HOST_FLAC: return std::make_unique<FlacDecoder>(audio);
+        case HOST_OPUS: return std::make_unique<OpusDecoder>(audio);
+        case HOST_VORBIS: return std::make_unique<VorbisDecoder>(audio);
+        default: return nullptr;
+    }
+}
+
+static size_t skipID3(const std::vector<uint8_t>& d) { // ID3v2 tag, Audio::read_ID3_Header() on the device
+    if (d.size() < 10 || memcmp(d.data(), "ID3", 3) != 0) return 0;
+    size_t len = ((d[6] & 0x7F) << 21) | ((d[7] & 0x7F) << 14) | ((d[8] & 0x7F) << 7) | (d[9] & 0x7F);
+    return std::min(d.size(), len + 10 + ((d[5] & 0x10) ? 10 : 0));
+}
+
+static size_t readFlacHeader(Decoder* dec, const std::vector<uint8_t>& d) { // Audio::read_FLAC_Header(), native FLAC only
+    if (d.size() < 8 || memcmp(d.data(), "fLaC", 4) != 0) return 0;          // ogg FLAC, the decoder parses it
+    size_t   pos = 4;
+    bool     last = false;
+    uint32_t sr = 0, total = 0;
+    uint8_t  ch = 0, bps = 0;
+    while (!last && pos + 4 <= d.size()) {
+        last = d[pos] & 0x80;
+        uint8_t type = d[pos] & 0x7F;
+        size_t  len = (d[pos + 1] << 16) | (d[pos + 2] << 8) | d[pos + 3];
+        const uint8_t* p = d.data() + pos + 4;
+        if (type == 0 && pos + 4 + 18 <= d.size()) { // STREAMINFO
+            sr = (p[10] << 12) | (p[11] << 4) | (p[12] >> 4);
+            ch = ((p[12] >> 1) & 0x07) + 1;
+            bps = (((p[12] & 0x01) << 4) | (p[13] >> 4)) + 1;
+            total = ((uint32_t)p[14] << 24) | (p[15] << 16) | (p[16] << 8) | p[17];
+        }
+        pos += 4 + len;
+    }
+    pos = std::min(pos, d.size());
+    dec->setRawBlockParams(ch, sr, bps, total, (uint32_t)(d.size() - pos));
+    return pos;
+}
+
+static bool isContinue(host_codec_t codec, int32_t res) { // Audio::decodeContinue(), consumed but nothing to play
+    if (codec == HOST_FLAC) return res == FlacDecoder::FLAC_PARSE_OGG_DONE || res == FlacDecoder::FLAC_DECODE_FRAMES_LOOP;
+    if (codec == HOST_OPUS) return res == OpusDecoder::OPUS_PARSE_OGG_DONE || res == OpusDecoder::OPUS_END;
+    if (codec == HOST_VORBIS) return res == VorbisDecoder::VORBIS_PARSE_OGG_DONE;
+    return false;
+}
+
+void host_stream_begin(host_stream_t& s, host_codec_t codec, std::vector<uint8_t>& data, Decoder* dec) {
+    s = {};
+    s.codec = codec;
+    s.data = &data;
+    s.dec = dec;
+    s.block = blockSizeOf(codec);
+    s.pos = codec == HOST_MP3 ? skipID3(data) : codec == HOST_FLAC ? readFlacHeader(dec, data) : 0;
+    s.outBuff.resize(outbuffSize);
+}
+
+bool host_stream_frame(host_stream_t& s, host_decode_t& out, bool keepPcm) {
+    std::vector<uint8_t>& data = *s.data;
+    Decoder*              dec = s.dec;
+    host_codec_t          codec = s.codec;
+
+    while (s.pos < data.size()) {
+        size_t   len = std::min(data.size() - s.pos, s.block);
+        uint8_t* p = data.data() + s.pos;
+        if (!s.playing) { // findNextSync()
+            int32_t nextSync = dec->findSyncWord(p, (int32_t)len);
+            if (nextSync < 0) {
+                s.pos += len;
+                continue;
+            }
+            if (codec == HOST_MP3) dec->clear();
+            if (nextSync > 0) {
+                s.pos += nextSync;
+                continue;
+            }
+            s.playing = true;
+        }
+        int32_t bytesLeft = (int32_t)len;
+        auto    t = std::chrono::steady_clock::now();
+        int32_t res = dec->decode(p, &bytesLeft, s.outBuff.data());
+        out.decodeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t).count();
+        int32_t bytesDecoded = (int32_t)len - bytesLeft;
+
+        if (res < 0) { // decodeError()
+            out.errors++;
+            if (res == -100) return false;
+            s.playing = false;
+            s.pos += bytesDecoded ? bytesDecoded : 1;
+            continue;
+        }
+        if (res > 99) { // decodeContinue()
+            if (isContinue(codec, res)) {
+                s.pos += bytesDecoded;
+                s.stalls = 0;
+            } else if (++s.stalls == 10) {
+                return false; // the decoder wants more data than the file has
+            }
+            continue;
+        }
+        if (bytesDecoded == 0 && codec != HOST_VORBIS && codec != HOST_FLAC) { // framesize 0, resync
+            s.playing = false;
+            s.pos += 1;
+            continue;
+        }
+        s.pos += bytesDecoded;
+        out.channels = dec->getChannels();
+        out.sampleRate = dec->getSampleRate();
+        uint32_t validSamples = dec->getOutputSamples();
+        if (codec == HOST_AAC && out.channels) validSamples /= out.channels; // AAC counts both channels
+        if (bytesDecoded == 0 && validSamples == 0) {                        // FLAC / Vorbis between frames
+            if (++s.stalls == 100) return false;
+            continue;
+        }
+        s.stalls = 0;
+        out.frames++;
+        out.samples += validSamples;
+        if (keepPcm) out.pcm.insert(out.pcm.end(), s.outBuff.begin(), s.outBuff.begin() + std::min<size_t>(validSamples * out.channels, outbuffSize));
+        return true;
+    }
+    return false;
+}
+
+bool host_decode(host_codec_t codec, std::vector<uint8_t>& data, host_decode_t& out, bool keepPcm) {
+    out = {};
+    out.codec = codec;
+    ps_heap_use_t use(&out.heap);
+    std::unique_ptr<Decoder> dec = host_create_decoder(codec);
+    if (!dec || !dec->init()) return false;
+
+    host_stream_t s;
+    host_stream_begin(s, codec, data, dec.get());
+    while (host_stream_frame(s, out, keepPcm)) {}
+    dec->reset();
+    dec.reset();
+    return out.frames > 0;
+}
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// per-function time, the decoders call these hooks at every function entry and exit when built with -finstrument-functions,
+// self time is the time of a function minus the time of its callees
+
+#ifdef AUDIO_HOST_PROFILE
+struct prfFunc_t {
+    uint64_t calls = 0;
+    uint64_t selfNs = 0;
+    uint64_t totalNs = 0;
+};
+struct prfFrame_t {
+    void*    fn;
+    uint64_t start;
+    uint64_t childNs;
+};
+static std::unordered_map<void*, prfFunc_t> s_prfFuncs;
+static std::vector<prfFrame_t>              s_prfStack;
+
+__attribute__((no_instrument_function)) static uint64_t nowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+extern "C" __attribute__((no_instrument_function)) void __cyg_profile_func_enter(void* fn, void*) {
+    s_prfStack.push_back({fn, nowNs(), 0});
+}
+
+extern "C" __attribute__((no_instrument_function)) void __cyg_profile_func_exit(void* fn, void*) {
+    if (s_prfStack.empty()) return;
+    prfFrame_t f = s_prfStack.back();
+    s_prfStack.pop_back();
+    uint64_t   ns = nowNs() - f.start;
+    prfFunc_t& e = s_prfFuncs[f.fn];
+    e.calls++;
+    e.totalNs += ns;
+    e.selfNs += ns - std::min(ns, f.childNs);
+    if (!s_prfStack.empty()) s_prfStack.back().childNs += ns;
+}
+
+bool host_profile_available() { return true; }
+void host_profile_reset() { s_prfFuncs.clear(); }
+
+void host_profile_report(FILE* f, uint8_t top) {
+    std::vector<std::pair<void*, prfFunc_t>> v(s_prfFuncs.begin(), s_prfFuncs.end());
+    std::sort(v.begin(), v.end(), [](auto& a, auto& b) { return a.second.selfNs > b.second.selfNs; });
+    uint64_t sum = 0;
+    for (auto& e : v) sum += e.second.selfNs;
+    fprintf(f, "  %6s %10s %10s %10s  %s\n", "self%", "self ms", "total ms", "calls", "function");
+    for (size_t i = 0; i < v.size() && i < top; i++) {
+        Dl_info     info = {};
+        const char* name = "?";
+        char*       demangled = nullptr;
+        if (dladdr(v[i].first, &info) && info.dli_sname) {
+            int status = 0;
+            demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+            name = demangled ? demangled : info.dli_sname;
+        }
+        fprintf(f, "  %5.1f%% %10.2f %10.2f %10lu  %s\n", sum ? 100.0 * v[i].second.selfNs / sum : 0.0, v[i].second.selfNs / 1e6, v[i].second.totalNs / 1e6,
+                (unsigned long)v[i].second.calls, name);
+        free(demangled);
+    }
+}
+#else
+bool host_profile_available() { return false; }
+void host_profile_reset() {}
+void host_profile_report(FILE* f, uint8_t) { fprintf(f, "  per-function time: configure with -DAUDIO_HOST_PROFILE=ON\n"); }
+#endif
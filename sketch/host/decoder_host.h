@@ -0,0 +1,58 @@
+/*
+ * decoder_host.h
+ *
+ * drives the decoders of ESP32-audioI2S-master on Linux the way Audio::sendBytes() does on the device:
+ * find the sync word, hand over at most one input block per call, skip a byte after a bad frame
+ *
+ */
+#pragma once
+
+#include "Audio.h"
+#include <string>
+#include <vector>
+
+enum host_codec_t : uint8_t { HOST_NONE, HOST_MP3, HOST_AAC, HOST_FLAC, HOST_OPUS, HOST_VORBIS };
+
+struct host_decode_t {
+    host_codec_t         codec = HOST_NONE;
+    uint32_t             frames = 0;     // decoded frames
+    uint32_t             errors = 0;     // decode() < 0
+    uint32_t             sampleRate = 0;
+    uint8_t              channels = 0;
+    uint64_t             samples = 0;    // per channel
+    uint64_t             decodeNs = 0;   // time spent in decode()
+    ps_heap_account_t    heap;           // ps_ptr blocks of the decoder, from create to destroy
+    std::vector<int16_t> pcm;            // interleaved, only if requested
+};
+
+const char*          host_codec_name(host_codec_t codec);
+host_codec_t         host_codec_of(const std::string& path, const std::vector<uint8_t>& data); // by extension, ogg by its first packet
+std::vector<uint8_t> host_read_file(const std::string& path);
+
+// decodes a whole file held in memory, false if the decoder could not be created or nothing was decoded
+bool host_decode(host_codec_t codec, std::vector<uint8_t>& data, host_decode_t& out, bool keepPcm = true);
+
+// the same frame by frame, with a decoder the caller creates and initializes (see gapless_switch.cpp)
+struct host_stream_t {
+    host_codec_t          codec = HOST_NONE;
+    std::vector<uint8_t>* data = nullptr;
+    Decoder*              dec = nullptr;
+    size_t                pos = 0;       // next input byte
+    size_t                block = 0;     // input block size of the codec
+    bool                  playing = false;
+    uint8_t               stalls = 0;
+    std::vector<int16_t>  outBuff;
+};
+std::unique_ptr<Decoder> host_create_decoder(host_codec_t codec); // all decoders share one Audio object, as on the device
+void                     host_stream_begin(host_stream_t& s, host_codec_t codec, std::vector<uint8_t>& data, Decoder* dec); // reads the header
+bool                     host_stream_frame(host_stream_t& s, host_decode_t& out, bool keepPcm = true); // decodes up to the next frame with samples, false at the end
+
+// per-function decode time, needs -DAUDIO_HOST_PROFILE=ON (the decoders are built with -finstrument-functions)
+bool host_profile_available();
+void host_profile_reset();
+void host_profile_report(FILE* f, uint8_t top = 20);
+
+// synthetic streams, see synth.cpp, the FLAC encoder also returns its input
+std::vector<uint8_t> synth_mp3(uint32_t frames, uint32_t seed, bool shortBlocks = true);
+std::vector<uint8_t> synth_flac(uint32_t blocks, uint32_t seed, std::vector<int16_t>* pcm = nullptr);
+std::vector<uint8_t> synth_opus(uint32_t packets, uint32_t seed);
@@ -0,0 +1,74 @@
+/*
+ * decoder_leaks.cpp
+ *
+ * decodes every stream many times with the allocation registry of psram_unique_ptr.hpp on, the live ps_ptr blocks
+ * after the last track must equal those after the first (static state, e.g. the Audio object, is allocated once)
+ *
+ *   decoder_leaks [tracks] [file | directory] ...    tracks per stream, default 20, plus the synthetic MP3, FLAC and Opus streams
+ *
+ */
+#include "decoder_host.h"
+#include <filesystem>
+
+struct stream_t {
+    std::string          name;
+    host_codec_t         codec;
+    std::vector<uint8_t> data;
+};
+
+static bool leaks(stream_t& s, uint32_t tracks) {
+    host_decode_t d;
+    if (!host_decode(s.codec, s.data, d, false)) {
+        printf("%-28s %-6s decode failed\n", s.name.c_str(), host_codec_name(s.codec));
+        return false;
+    }
+    ps_track_mark();
+    ps_track_totals_t first = ps_track_totals();
+    int32_t           live = 0; // ps_heap accounting of the decoder, must be 0 after every track
+    for (uint32_t i = 1; i < tracks; i++) {
+        host_decode(s.codec, s.data, d, false);
+        live = std::max(live, d.heap.live);
+    }
+    ps_track_totals_t last = ps_track_totals();
+    int32_t           growth = (int32_t)(last.psramBytes + last.internalBytes) - (int32_t)(first.psramBytes + first.internalBytes);
+    bool              ok = growth == 0 && last.blocks == first.blocks && live == 0;
+    printf("%-28s %-6s %3u tracks, %4u blocks %+d, %7u bytes %+d, decoder heap left %d, peak %u bytes%s\n", s.name.c_str(), host_codec_name(s.codec), tracks, last.blocks,
+           (int32_t)last.blocks - (int32_t)first.blocks, last.psramBytes + last.internalBytes, growth, live, last.peakBytes, ok ? "" : "  LEAK");
+    if (!ok) ps_track_dump(true);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    uint32_t tracks = 20;
+    int      first = 1;
+    if (argc > 1 && isdigit((uint8_t)argv[1][0])) tracks = std::max(2, atoi(argv[first++]));
+
+    if (!ps_track_enable(true)) return 2;
+    std::vector<stream_t> streams;
+    streams.push_back({"synthetic.mp3", HOST_MP3, synth_mp3(200, 1)});
+    streams.push_back({"synthetic.flac", HOST_FLAC, synth_flac(50, 2, nullptr)});
+    streams.push_back({"synthetic.opus", HOST_OPUS, synth_opus(200, 3)});
+
+    std::vector<std::string> files;
+    for (int i = first; i < argc; i++) {
+        if (std::filesystem::is_directory(argv[i])) {
+            for (auto& e : std::filesystem::directory_iterator(argv[i])) files.push_back(e.path().string());
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    std::sort(files.begin(), files.end());
+    for (auto& f : files) {
+        std::vector<uint8_t> data = host_read_file(f);
+        host_codec_t         codec = host_codec_of(f, data);
+        if (codec != HOST_NONE) streams.push_back({std::filesystem::path(f).filename().string(), codec, std::move(data)});
+    }
+
+    int fails = 0;
+    for (auto& s : streams) {
+        if (!leaks(s, tracks)) fails++;
+    }
+    ps_track_totals_t t = ps_track_totals();
+    if (t.dropped) printf("%u allocations not recorded, registry full\n", t.dropped);
+    return fails || t.dropped ? 1 : 0;
+}
@@ -0,0 +1,357 @@
+/*
+ * dsp_chain_bench.cpp
+ *
+ * the DSP chain of Audio::playChunk(), VU -> tone -> mono -> gain, as it was before the block processing (per frame:
+ * IIR_filterChain0..2() with their in / out histories, float gain) and as it is now (IIR_filterBlock() over blocks of
+ * m_dspBlock frames, the scalar path without esp-dsp, Q15 gain, bypassed stages skipped). Audio.cpp does not build on
+ * the host, both chains are copies of its code, kept with it in step; computeVUlevel() is the same in both
+ *   cycles    host time stamp counter ticks and ns per frame, 10 s of 44.1 kHz stereo in playChunk() calls of 1152
+ *             frames, best of 5: tone +6 / -3 / +4 dB at 60 % volume, and flat tone at full volume. Host numbers, the
+ *             device publishes its own per stage in getDspStats()
+ *   resume    tone on, off, on again as setTone() does it: a loud 80 Hz tone through +6 dB low shelf, the tone stage
+ *             bypassed while the music drops to a -40 dBFS 1 kHz tone, then the shelf back on. The first 20 ms after
+ *             the resume against the filter run without a break; fails if flushing the state on leaving bypass does
+ *             not keep the step far below the one of the stale state
+ *
+ *   dsp_chain_bench
+ *
+ */
+#include <Arduino.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+static inline uint64_t ticks() { return __rdtsc(); }
+#else
+static inline uint64_t ticks() { return std::chrono::steady_clock::now().time_since_epoch().count(); }
+#endif
+
+enum : uint8_t { LEFTCHANNEL = 0, RIGHTCHANNEL = 1 };
+enum : uint8_t { LOWSHELF = 0, PEAKEQ = 1, HIFGSHELF = 2 };
+enum : uint8_t { DSP_VU = 0x01, DSP_TONE = 0x02, DSP_MONO = 0x04, DSP_GAIN = 0x08 };
+
+struct filter_t {
+    float a0, a1, a2, b1, b2;
+};
+
+// Audio::IIR_calculateCoefficients()
+static void calculateCoefficients(filter_t f[3], uint32_t rate, int8_t G0, int8_t G1, int8_t G2) {
+    const float FcLS = 500, FcPKEQ = 3000;
+    float       FcHS = 6000;
+    if (rate < FcHS * 2 - 100) FcHS = rate / 2 - 100;
+    float K, norm, Q, V;
+
+    K = tanf((float)PI * FcLS / rate);
+    V = powf(10, fabs(G0) / 20.0);
+    if (G0 >= 0) {
+        norm = 1 / (1 + sqrtf(2) * K + K * K);
+        f[LOWSHELF] = {(1 + sqrtf(2 * V) * K + V * K * K) * norm, 2 * (V * K * K - 1) * norm, (1 - sqrtf(2 * V) * K + V * K * K) * norm, 2 * (K * K - 1) * norm,
+                       (1 - sqrtf(2) * K + K * K) * norm};
+    } else {
+        norm = 1 / (1 + sqrtf(2 * V) * K + V * K * K);
+        f[LOWSHELF] = {(1 + sqrtf(2) * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - sqrtf(2) * K + K * K) * norm, 2 * (V * K * K - 1) * norm,
+                       (1 - sqrtf(2 * V) * K + V * K * K) * norm};
+    }
+    K = tanf((float)PI * FcPKEQ / rate);
+    V = powf(10, fabs(G1) / 20.0);
+    Q = 2.5;
+    if (G1 >= 0) {
+        norm = 1 / (1 + 1 / Q * K + K * K);
+        f[PEAKEQ] = {(1 + V / Q * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - V / Q * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - 1 / Q * K + K * K) * norm};
+    } else {
+        norm = 1 / (1 + V / Q * K + K * K);
+        f[PEAKEQ] = {(1 + 1 / Q * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - 1 / Q * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - V / Q * K + K * K) * norm};
+    }
+    K = tanf((float)PI * FcHS / rate);
+    V = powf(10, fabs(G2) / 20.0);
+    if (G2 >= 0) {
+        norm = 1 / (1 + sqrtf(2) * K + K * K);
+        f[HIFGSHELF] = {(V + sqrtf(2 * V) * K + K * K) * norm, 2 * (K * K - V) * norm, (V - sqrtf(2 * V) * K + K * K) * norm, 2 * (K * K - 1) * norm,
+                        (1 - sqrtf(2) * K + K * K) * norm};
+    } else {
+        norm = 1 / (V + sqrtf(2 * V) * K + K * K);
+        f[HIFGSHELF] = {(1 + sqrtf(2) * K + K * K) * norm, 2 * (K * K - 1) * norm, (1 - sqrtf(2) * K + K * K) * norm, 2 * (K * K - V) * norm,
+                        (V - sqrtf(2 * V) * K + K * K) * norm};
+    }
+}
+
+struct settings_t {
+    int8_t g0, g1, g2;
+    float  volume; // m_limit_left, m_limit_right
+    bool   mono;
+};
+
+struct chain_t { // the members of Audio both chains use
+    filter_t m_filter[3];
+    float    m_corr = 1;
+    float    m_limit_left = 1, m_limit_right = 1;
+    bool     m_f_forceMono = false;
+    uint8_t  m_channels = 2;
+    struct {
+        uint8_t sampleArray[2][4][8] = {};
+        uint8_t cnt0 = 0, cnt1 = 0, cnt2 = 0, cnt3 = 0, cnt4 = 0;
+        bool    f_vu = false;
+    } m_cVUl;
+    uint8_t m_vuLeft = 0, m_vuRight = 0;
+
+    void set(const settings_t& s, uint32_t rate) {
+        calculateCoefficients(m_filter, rate, s.g0, s.g1, s.g2);
+        m_corr = powf(10, (float)std::max(s.g0, std::max(s.g1, s.g2)) / 20); // pow10f()
+        m_limit_left = m_limit_right = s.volume;
+        m_f_forceMono = s.mono;
+    }
+
+    void computeVUlevel(int16_t sample[2]) { // Audio::computeVUlevel()
+        auto avg = [&](uint8_t* sampArr) {
+            uint16_t av = 0;
+            for (int i = 0; i < 8; i++) { av += sampArr[i]; }
+            return av >> 3;
+        };
+        auto largest = [&](uint8_t* sampArr) {
+            uint16_t maxValue = 0;
+            for (int i = 0; i < 8; i++) {
+                if (maxValue < sampArr[i]) maxValue = sampArr[i];
+            }
+            return maxValue;
+        };
+        if (m_cVUl.cnt0 == 64) { m_cVUl.cnt0 = 0; m_cVUl.cnt1++; }
+        if (m_cVUl.cnt1 == 8) { m_cVUl.cnt1 = 0; m_cVUl.cnt2++; }
+        if (m_cVUl.cnt2 == 8) { m_cVUl.cnt2 = 0; m_cVUl.cnt3++; }
+        if (m_cVUl.cnt3 == 8) { m_cVUl.cnt3 = 0; m_cVUl.cnt4++; m_cVUl.f_vu = true; }
+        if (m_cVUl.cnt4 == 8) { m_cVUl.cnt4 = 0; }
+        if (!m_cVUl.cnt0) {
+            m_cVUl.sampleArray[LEFTCHANNEL][0][m_cVUl.cnt1] = abs(sample[LEFTCHANNEL] >> 7);
+            m_cVUl.sampleArray[RIGHTCHANNEL][0][m_cVUl.cnt1] = abs(sample[RIGHTCHANNEL] >> 7);
+        }
+        if (!m_cVUl.cnt1) {
+            m_cVUl.sampleArray[LEFTCHANNEL][1][m_cVUl.cnt2] = largest(m_cVUl.sampleArray[LEFTCHANNEL][0]);
+            m_cVUl.sampleArray[RIGHTCHANNEL][1][m_cVUl.cnt2] = largest(m_cVUl.sampleArray[RIGHTCHANNEL][0]);
+        }
+        if (!m_cVUl.cnt2) {
+            m_cVUl.sampleArray[LEFTCHANNEL][2][m_cVUl.cnt3] = largest(m_cVUl.sampleArray[LEFTCHANNEL][1]);
+            m_cVUl.sampleArray[RIGHTCHANNEL][2][m_cVUl.cnt3] = largest(m_cVUl.sampleArray[RIGHTCHANNEL][1]);
+        }
+        if (!m_cVUl.cnt3) {
+            m_cVUl.sampleArray[LEFTCHANNEL][3][m_cVUl.cnt4] = avg(m_cVUl.sampleArray[LEFTCHANNEL][2]);
+            m_cVUl.sampleArray[RIGHTCHANNEL][3][m_cVUl.cnt4] = avg(m_cVUl.sampleArray[RIGHTCHANNEL][2]);
+        }
+        if (m_cVUl.f_vu) {
+            m_cVUl.f_vu = false;
+            m_vuLeft = avg(m_cVUl.sampleArray[LEFTCHANNEL][3]);
+            m_vuRight = avg(m_cVUl.sampleArray[RIGHTCHANNEL][3]);
+        }
+        m_cVUl.cnt1++;
+    }
+};
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+struct per_frame_t : chain_t { // playChunk() before e2fa116
+    float m_filterBuff[3][2][2][2] = {}; // [filter][z1, z2][in, out][channel]
+
+    void filterChain(uint8_t f, int16_t iir_in[2]) { // IIR_filterChain0..2(), they differ in the filter index only
+        uint8_t z1 = 0, z2 = 1;
+        enum : uint8_t { in = 0, out = 1 };
+        for (uint8_t c = 0; c < 2; c++) {
+            float inSample = (float)iir_in[c];
+            float outSample = m_filter[f].a0 * inSample + m_filter[f].a1 * m_filterBuff[f][z1][in][c] + m_filter[f].a2 * m_filterBuff[f][z2][in][c] -
+                              m_filter[f].b1 * m_filterBuff[f][z1][out][c] - m_filter[f].b2 * m_filterBuff[f][z2][out][c];
+            m_filterBuff[f][z2][in][c] = m_filterBuff[f][z1][in][c];
+            m_filterBuff[f][z1][in][c] = inSample;
+            m_filterBuff[f][z2][out][c] = m_filterBuff[f][z1][out][c];
+            m_filterBuff[f][z1][out][c] = outSample;
+            iir_in[c] = (int16_t)outSample;
+        }
+    }
+
+    void play(int16_t* buf, int32_t validSamples) {
+        for (int32_t i = 0; i < validSamples; i++) {
+            int16_t* sample = buf + i * 2;
+            computeVUlevel(sample);
+            if (m_corr > 1) {
+                sample[LEFTCHANNEL] /= m_corr;
+                sample[RIGHTCHANNEL] /= m_corr;
+            }
+            filterChain(0, sample);
+            filterChain(1, sample);
+            filterChain(2, sample);
+            if (m_f_forceMono && m_channels == 2) {
+                int32_t xy = (sample[RIGHTCHANNEL] + sample[LEFTCHANNEL]) / 2;
+                sample[RIGHTCHANNEL] = (int16_t)xy;
+                sample[LEFTCHANNEL] = (int16_t)xy;
+            }
+            sample[LEFTCHANNEL] *= m_limit_left;
+            sample[RIGHTCHANNEL] *= m_limit_right;
+        }
+    }
+};
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+struct block_t : chain_t { // playChunk() now, IIR_filterBlock() without AUDIO_ESP_DSP
+    static constexpr uint16_t m_dspBlock = 128;
+    uint8_t                   m_dspGraph = DSP_VU;
+    int32_t                   m_gainQ15[2] = {32768, 32768};
+    float                     m_biquadState[3][2][2] = {};
+    float                     m_dspBuff[2][m_dspBlock];
+    int8_t                    m_gain0 = 0, m_gain1 = 0, m_gain2 = 0;
+    bool                      m_flushOnResume = true; // setTone(): flush the state when the tone stage leaves bypass
+
+    void set(const settings_t& s, uint32_t rate) { // setTone() and computeLimit()
+        chain_t::set(s, rate);
+        m_gain0 = s.g0, m_gain1 = s.g1, m_gain2 = s.g2;
+        if (m_flushOnResume && !(m_dspGraph & DSP_TONE)) memset(m_biquadState, 0, sizeof(m_biquadState));
+        updateDspGraph();
+    }
+
+    void updateDspGraph() {
+        uint8_t graph = DSP_VU;
+        if (m_gain0 || m_gain1 || m_gain2) graph |= DSP_TONE;
+        if (m_f_forceMono) graph |= DSP_MONO;
+        m_gainQ15[LEFTCHANNEL] = (int32_t)(m_limit_left * 32768);
+        m_gainQ15[RIGHTCHANNEL] = (int32_t)(m_limit_right * 32768);
+        if (m_gainQ15[LEFTCHANNEL] != 32768 || m_gainQ15[RIGHTCHANNEL] != 32768) graph |= DSP_GAIN;
+        m_dspGraph = graph;
+    }
+
+    void IIR_filterBlock(int16_t* block, int32_t frames) {
+        const float pre = (m_corr > 1) ? 1.0f / m_corr : 1.0f;
+        float*      ch[2] = {m_dspBuff[LEFTCHANNEL], m_dspBuff[RIGHTCHANNEL]};
+        for (int32_t i = 0; i < frames; i++) {
+            ch[LEFTCHANNEL][i] = (float)block[i * 2] * pre;
+            ch[RIGHTCHANNEL][i] = (float)block[i * 2 + 1] * pre;
+        }
+        for (uint8_t f = 0; f < 3; f++) {
+            const float a0 = m_filter[f].a0, a1 = m_filter[f].a1, a2 = m_filter[f].a2, b1 = m_filter[f].b1, b2 = m_filter[f].b2;
+            float       l0 = m_biquadState[f][LEFTCHANNEL][0], l1 = m_biquadState[f][LEFTCHANNEL][1];
+            float       r0 = m_biquadState[f][RIGHTCHANNEL][0], r1 = m_biquadState[f][RIGHTCHANNEL][1];
+            float*      xl = ch[LEFTCHANNEL];
+            float*      xr = ch[RIGHTCHANNEL];
+            for (int32_t i = 0; i < frames; i++) {
+                float dl = xl[i] - b1 * l0 - b2 * l1;
+                float dr = xr[i] - b1 * r0 - b2 * r1;
+                xl[i] = a0 * dl + a1 * l0 + a2 * l1;
+                xr[i] = a0 * dr + a1 * r0 + a2 * r1;
+                l1 = l0;
+                l0 = dl;
+                r1 = r0;
+                r0 = dr;
+            }
+            m_biquadState[f][LEFTCHANNEL][0] = l0;
+            m_biquadState[f][LEFTCHANNEL][1] = l1;
+            m_biquadState[f][RIGHTCHANNEL][0] = r0;
+            m_biquadState[f][RIGHTCHANNEL][1] = r1;
+        }
+        auto sat16 = [](float v) -> int16_t {
+            if (v > 32767.0f) return 32767;
+            if (v < -32768.0f) return -32768;
+            return (int16_t)v;
+        };
+        for (int32_t i = 0; i < frames; i++) {
+            block[i * 2] = sat16(ch[LEFTCHANNEL][i]);
+            block[i * 2 + 1] = sat16(ch[RIGHTCHANNEL][i]);
+        }
+    }
+
+    void Gain(int16_t* block, int32_t frames) {
+        const int32_t gl = m_gainQ15[LEFTCHANNEL];
+        const int32_t gr = m_gainQ15[RIGHTCHANNEL];
+        for (int32_t i = 0; i < frames * 2; i += 2) {
+            block[i] = (int16_t)((block[i] * gl) >> 15);
+            block[i + 1] = (int16_t)((block[i + 1] * gr) >> 15);
+        }
+    }
+
+    void play(int16_t* buf, int32_t validSamples) {
+        const uint8_t graph = (m_channels == 2) ? m_dspGraph : (m_dspGraph & ~DSP_MONO);
+        for (int32_t done = 0; done < validSamples; done += m_dspBlock) {
+            int32_t  frames = std::min((int32_t)m_dspBlock, validSamples - done);
+            int16_t* block = buf + done * 2;
+            for (int32_t i = 0; i < frames; i++) computeVUlevel(block + i * 2);
+            if (graph & DSP_TONE) IIR_filterBlock(block, frames);
+            if (graph & DSP_MONO) {
+                for (int32_t i = 0; i < frames * 2; i += 2) {
+                    int16_t xy = (int16_t)((block[i] + block[i + 1]) / 2);
+                    block[i] = xy;
+                    block[i + 1] = xy;
+                }
+            }
+            if (graph & DSP_GAIN) Gain(block, frames);
+        }
+    }
+};
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+static constexpr uint32_t rate = 44100;
+static constexpr int32_t  chunkFrames = 1152; // one MP3 frame per playChunk()
+
+static std::vector<int16_t> music(size_t frames) { // two tones per channel at about -9 dBFS, different left and right
+    std::vector<int16_t> pcm(frames * 2);
+    for (size_t i = 0; i < frames; i++) {
+        double t = (double)i / rate;
+        pcm[i * 2] = (int16_t)(7000 * sin(2 * M_PI * 110 * t) + 4000 * sin(2 * M_PI * 2500 * t));
+        pcm[i * 2 + 1] = (int16_t)(7000 * sin(2 * M_PI * 165 * t) + 4000 * sin(2 * M_PI * 7000 * t));
+    }
+    return pcm;
+}
+
+template <typename C> static void perFrame(const settings_t& s, const std::vector<int16_t>& in, double& ticksPerFrame, double& nsPerFrame) {
+    ticksPerFrame = nsPerFrame = 1e30;
+    std::vector<int16_t> buf(in.size());
+    for (int round = 0; round < 5; round++) {
+        C c;
+        c.set(s, rate);
+        buf = in;
+        auto     t = std::chrono::steady_clock::now();
+        uint64_t t0 = ticks();
+        for (size_t i = 0; i < buf.size() / 2; i += chunkFrames) c.play(&buf[i * 2], std::min<size_t>(chunkFrames, buf.size() / 2 - i));
+        uint64_t dt = ticks() - t0;
+        double   ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t).count();
+        ticksPerFrame = std::min(ticksPerFrame, (double)dt / (buf.size() / 2));
+        nsPerFrame = std::min(nsPerFrame, ns / (buf.size() / 2));
+    }
+}
+
+// left channel, the first 20 ms after the tone stage comes back, against a chain that never left it
+static double resumeStep(bool flush) {
+    const settings_t bass = {6, 0, 0, 1.0f, false}, flat = {0, 0, 0, 1.0f, false};
+    block_t          chain, ref;
+    chain.m_flushOnResume = flush;
+    chain.set(bass, rate);
+    ref.set(bass, rate);
+    const size_t         loud = rate / 2, quiet = rate / 4, check = rate / 50;
+    std::vector<int16_t> a(loud * 2), b((quiet + check) * 2);
+    for (size_t i = 0; i < loud; i++) a[i * 2] = a[i * 2 + 1] = (int16_t)(14000 * sin(2 * M_PI * 80.0 * i / rate));
+    for (size_t i = 0; i < quiet + check; i++) b[i * 2] = b[i * 2 + 1] = (int16_t)(327 * sin(2 * M_PI * 1000.0 * i / rate));
+    std::vector<int16_t> a2 = a, b2 = b;
+    chain.play(a.data(), loud);
+    ref.play(a2.data(), loud);
+    chain.set(flat, rate);                   // tone off, the stage is bypassed, its state stays
+    chain.play(b.data(), quiet);
+    ref.play(b2.data(), quiet);
+    chain.set(bass, rate);                   // tone on again
+    chain.play(b.data() + quiet * 2, check);
+    ref.play(b2.data() + quiet * 2, check);
+    double step = 0;
+    for (size_t i = quiet; i < quiet + check; i++) step = std::max(step, fabs((double)b[i * 2] - b2[i * 2]));
+    return step;
+}
+
+int main() {
+    std::vector<int16_t> in = music(rate * 10);
+    const struct {
+        const char* name;
+        settings_t  s;
+    } cases[] = {{"tone +6/-3/+4, volume 60 %", {6, -3, 4, 0.6f, false}}, {"flat tone, full volume", {0, 0, 0, 1.0f, false}}};
+
+    printf("%-28s %24s %24s\n", "", "per frame  ticks    ns", "block  ticks    ns");
+    for (auto& c : cases) {
+        double ot, on, nt, nn;
+        perFrame<per_frame_t>(c.s, in, ot, on);
+        perFrame<block_t>(c.s, in, nt, nn);
+        printf("%-28s %18.1f %5.1f %18.1f %5.1f\n", c.name, ot, on, nt, nn);
+    }
+    printf("host time stamp counter ticks and ns per stereo frame at %u Hz, not ESP32-S3 cycles\n", rate);
+
+    double stale = resumeStep(false), flushed = resumeStep(true);
+    bool   ok = flushed * 10 < stale;
+    printf("tone resume, largest step in the first 20 ms: stale state %.0f, flushed %.0f (of a 327 peak signal)  %s\n", stale, flushed, ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
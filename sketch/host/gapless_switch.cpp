@@ -0,0 +1,118 @@
+/*
+ * gapless_switch.cpp
+ *
+ * the gapless switch of Audio::openNextFS(): primeNextFS() stages the head of track B and creates and initializes its
+ * decoder while the decoder of track A still runs, at the end of A only the header and the first frame of B are left
+ *   - A then B through two live decoder instances must give the samples of A and B decoded alone, none lost, none doubled
+ *   - the work from the last frame of A to the first frame of B, primed and not, in microseconds and in 48 kHz frames,
+ *     the gap is what the I2S DMA ring (dma_desc_num * dma_frame_num = 8192 frames, 170 ms) does not cover,
+ *     as getGapSamples() counts it on the device
+ * the times are those of the build host, not of the ESP32-S3, and leave out the SD read of the head that priming moves
+ * ahead of the switch; fails on a sample difference or a gap on the host
+ *
+ *   gapless_switch [rounds]    rounds per pair for the median switch time, default 20
+ *
+ */
+#include "decoder_host.h"
+#include <algorithm>
+#include <chrono>
+
+static constexpr uint32_t ringFrames = 16 * 512;  // Audio: m_i2s_chan_cfg.dma_desc_num * dma_frame_num
+static constexpr size_t   headSize = 32 * 1024;   // Audio::m_nextHeadSize
+
+struct track_t {
+    const char*          name;
+    host_codec_t         codec;
+    std::vector<uint8_t> data;
+    host_decode_t        ref; // decoded alone
+};
+
+struct switch_t {
+    bool   exact = true;
+    double switchUs = 0;
+    size_t samplesA = 0, samplesB = 0;
+};
+
+static double usSince(std::chrono::steady_clock::time_point t) { return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t).count(); }
+
+// A to its end, B primed when half of A is read (on the device: when A is in InBuff up to its end), or created at the switch
+static switch_t play(track_t& a, track_t& b, bool primed) {
+    switch_t      r;
+    host_decode_t outA, outB;
+    auto          decA = host_create_decoder(a.codec);
+    decA->init();
+    host_stream_t sA;
+    host_stream_begin(sA, a.codec, a.data, decA.get());
+
+    std::unique_ptr<Decoder> decB;
+    std::vector<uint8_t>     head; // primeNextFS(): m_nextHead
+    auto                     stage = [&]() {
+        decB = host_create_decoder(b.codec);
+        decB->init();
+        head.assign(b.data.begin(), b.data.begin() + std::min(headSize, b.data.size()));
+    };
+    while (host_stream_frame(sA, outA)) {
+        if (primed && !decB && sA.pos >= a.data.size() / 2) stage();
+    }
+
+    auto t = std::chrono::steady_clock::now(); // the last frame of A is decoded
+    decA->reset();                            // stopSong() -> destroy_decoder()
+    decA.reset();
+    if (!decB) stage();
+    std::vector<uint8_t> dataB = head; // processLocalFile(): the staged head, then the file from behind it
+    dataB.insert(dataB.end(), b.data.begin() + head.size(), b.data.end());
+    host_stream_t sB;
+    host_stream_begin(sB, b.codec, dataB, decB.get());
+    bool first = host_stream_frame(sB, outB);
+    r.switchUs = usSince(t);
+    while (first && host_stream_frame(sB, outB)) {}
+    decB->reset();
+
+    r.samplesA = outA.pcm.size();
+    r.samplesB = outB.pcm.size();
+    r.exact = outA.pcm == a.ref.pcm && outB.pcm == b.ref.pcm;
+    return r;
+}
+
+int main(int argc, char** argv) {
+    int rounds = argc > 1 ? std::max(1, atoi(argv[1])) : 20;
+    Audio::logLevel = 1; // the FLAC decoder warns its STREAMINFO at every track
+
+    track_t tracks[] = {{"A.mp3", HOST_MP3, synth_mp3(400, 11), {}},
+                        {"B.mp3", HOST_MP3, synth_mp3(400, 12), {}},
+                        {"A.flac", HOST_FLAC, synth_flac(60, 13), {}},
+                        {"B.flac", HOST_FLAC, synth_flac(60, 14), {}}};
+    for (track_t& t : tracks) {
+        if (!host_decode(t.codec, t.data, t.ref)) {
+            printf("%s: decode failed\n", t.name);
+            return 1;
+        }
+    }
+    const int pairs[][2] = {{0, 1}, {2, 3}, {0, 3}, {2, 1}};
+
+    bool ok = true;
+    printf("%-16s %-10s %12s %12s %10s %12s %11s\n", "switch", "decoder", "A samples", "B samples", "junction", "host us", "gap frames");
+    for (auto& p : pairs) {
+        track_t& a = tracks[p[0]];
+        track_t& b = tracks[p[1]];
+        for (int primed = 1; primed >= 0; primed--) {
+            std::vector<double> us;
+            switch_t            r;
+            for (int i = 0; i < rounds; i++) {
+                r = play(a, b, primed);
+                us.push_back(r.switchUs);
+                if (!r.exact) break;
+            }
+            std::sort(us.begin(), us.end());
+            double   median = us[us.size() / 2];
+            int64_t  gap = std::max<int64_t>(0, (int64_t)(median * 48 / 1000) - ringFrames);
+            char     name[32];
+            snprintf(name, sizeof(name), "%s -> %s", a.name, b.name);
+            printf("%-16s %-10s %12zu %12zu %10s %12.1f %11lld\n", name, primed ? "primed" : "at switch", r.samplesA / a.ref.channels, r.samplesB / b.ref.channels,
+                   r.exact ? "exact" : "DIFFERS", median, (long long)gap);
+            if (!r.exact || gap > 0) ok = false;
+        }
+    }
+    printf("junction: A and B as decoded alone, sample for sample; gap frames: 48 kHz frames of silence the DMA ring would not cover\n");
+    return ok ? 0 : 1;
+}
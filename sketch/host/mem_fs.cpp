@@ -0,0 +1,223 @@
+// in-memory file system for the host build, see mem_fs.h
+#include "mem_fs.h"
+#include <FFat.h>
+#include <LittleFS.h>
+#include <SD.h>
+#include <SD_MMC.h>
+
+std::shared_ptr<MemFS> hostLittleFS = std::make_shared<MemFS>(false);
+fs::FS                 LittleFS(hostLittleFS);
+fs::FS                 SD(std::make_shared<MemFS>(true)); // the other file systems of the core, seek_index.cpp tells them apart by address
+fs::FS                 SD_MMC(std::make_shared<MemFS>(true));
+fs::FS                 FFat(std::make_shared<MemFS>(false));
+
+static std::vector<std::string> split(const std::string& path) {
+    std::vector<std::string> parts;
+    size_t                   i = 0;
+    while (i < path.size()) {
+        size_t j = path.find('/', i);
+        if (j == std::string::npos) j = path.size();
+        if (j > i) parts.push_back(path.substr(i, j - i));
+        i = j + 1;
+    }
+    return parts;
+}
+
+class MemFile : public fs::FileImpl {
+  public:
+    MemFile(MemFS* fs, std::shared_ptr<MemFS::Node> n, const std::string& path, bool writable) : m_fs(fs), m_n(n), m_path(path), m_writable(writable) {}
+
+    size_t write(const uint8_t* buf, size_t size) override {
+        if (!m_n || m_n->dir || !m_writable) return 0;
+        m_fs->stats.writeCalls++;
+        m_fs->stats.writeBytes += size;
+        if (m_pos + size > m_n->data.size()) m_n->data.resize(m_pos + size);
+        memcpy(m_n->data.data() + m_pos, buf, size);
+        m_pos += size;
+        return size;
+    }
+    size_t read(uint8_t* buf, size_t size) override {
+        if (!m_n || m_n->dir) return 0;
+        m_fs->stats.readCalls++;
+        size_t n = m_pos < m_n->data.size() ? std::min(size, m_n->data.size() - m_pos) : 0;
+        memcpy(buf, m_n->data.data() + m_pos, n);
+        m_pos += n;
+        m_fs->stats.readBytes += n;
+        return n;
+    }
+    bool seek(uint32_t pos, fs::SeekMode mode) override {
+        if (!m_n || m_n->dir) return false;
+        m_fs->stats.seeks++;
+        size_t p = mode == fs::SeekSet ? pos : mode == fs::SeekCur ? m_pos + pos : size() + pos;
+        if (p > size()) return false;
+        m_pos = p;
+        return true;
+    }
+    size_t      position() const override { return m_pos; }
+    size_t      size() const override { return m_n ? m_n->data.size() + m_n->sparse : 0; }
+    void        close() override { m_n = nullptr; }
+    const char* name() const override { return m_path.c_str(); }
+    bool        isDirectory() override { return m_n && m_n->dir; }
+    operator bool() override { return m_n != nullptr; }
+
+    std::shared_ptr<MemFS::Node> readdir() { // next entry, the sectors of its slots
+        if (!m_n || !m_n->dir || m_next >= m_n->children.size()) return nullptr;
+        m_fs->stats.readdirs++;
+        uint32_t first = m_fs->slotsBefore(m_n.get(), m_next);
+        auto     child = m_n->children[m_next++];
+        for (uint32_t s = first; s < first + MemFS::slotsOf(child.get()); s++) m_fs->touch(m_n->id, s);
+        return child;
+    }
+    std::string childPath(const std::string& name) const { return m_path == "/" ? "/" + name : m_path + "/" + name; }
+    fs::FileImplPtr openNextFile(const char* mode) override {
+        auto child = readdir();
+        if (!child) return nullptr;
+        std::string path = childPath(child->name);
+        m_fs->stats.opens++;
+        m_fs->find(path, true); // VFSFileImpl(): stat(), then fopen() / opendir()
+        m_fs->find(path, true);
+        return std::make_shared<MemFile>(m_fs, child, path, false);
+    }
+    String getNextFileName(bool* isDir) override {
+        auto child = readdir();
+        if (!child) return String();
+        if (isDir) *isDir = child->dir;
+        return String(childPath(child->name));
+    }
+    void rewindDirectory() override { m_next = 0; }
+
+  private:
+    MemFS*                       m_fs;
+    std::shared_ptr<MemFS::Node> m_n;
+    std::string                  m_path;
+    bool                         m_writable;
+    size_t                       m_pos = 0;
+    size_t                       m_next = 0; // directory cursor
+};
+
+void MemFS::clear() {
+    m_root = std::make_shared<Node>();
+    m_root->dir = true;
+    m_root->id = m_nextId++;
+    m_window = ~0ull;
+}
+
+std::shared_ptr<MemFS::Node> MemFS::make(Node* parent, const std::string& name, bool dir) {
+    auto n = std::make_shared<Node>();
+    n->name = name;
+    n->dir = dir;
+    n->parent = parent;
+    n->id = m_nextId++;
+    parent->children.push_back(n);
+    return n;
+}
+
+uint32_t MemFS::slotsBefore(const Node* dir, size_t child) const {
+    uint32_t slot = dir == m_root.get() ? 0 : 2; // "." and ".."
+    for (size_t i = 0; i < child; i++) slot += slotsOf(dir->children[i].get());
+    return slot;
+}
+
+void MemFS::touch(uint32_t dirId, uint32_t slot) {
+    if (!m_fatModel) return;
+    uint64_t key = (uint64_t)dirId << 32 | slot / 16;
+    if (key == m_window) return;
+    m_window = key;
+    stats.sectors++;
+}
+
+std::shared_ptr<MemFS::Node> MemFS::find(const std::string& path, bool count) {
+    if (count) stats.lookups++;
+    std::shared_ptr<Node> n = m_root;
+    for (const std::string& part : split(path)) {
+        if (!n->dir) return nullptr;
+        std::shared_ptr<Node> next;
+        uint32_t              slot = n == m_root ? 0 : 2;
+        for (auto& c : n->children) { // dir_find(): from the first entry on
+            uint32_t end = slot + slotsOf(c.get());
+            if (count)
+                for (; slot < end; slot++) touch(n->id, slot);
+            slot = end;
+            if (c->name == part) {
+                next = c;
+                break;
+            }
+        }
+        if (!next) return nullptr;
+        n = next;
+    }
+    return n;
+}
+
+bool MemFS::addDir(const std::string& path) {
+    std::shared_ptr<Node> n = m_root;
+    for (const std::string& part : split(path)) {
+        std::shared_ptr<Node> next;
+        for (auto& c : n->children)
+            if (c->name == part) next = c;
+        if (!next) next = make(n.get(), part, true);
+        if (!next->dir) return false;
+        n = next;
+    }
+    return true;
+}
+
+bool MemFS::addFile(const std::string& path, size_t size) {
+    size_t slash = path.rfind('/');
+    if (slash == std::string::npos || !addDir(path.substr(0, slash))) return false;
+    auto dir = find(path.substr(0, slash));
+    if (find(path)) return false;
+    make(dir.get(), path.substr(slash + 1), false)->sparse = size;
+    return true;
+}
+
+std::string MemFS::readAll(const std::string& path) {
+    auto n = find(path);
+    return n && !n->dir ? std::string(n->data.begin(), n->data.end()) : std::string();
+}
+
+fs::FileImplPtr MemFS::open(const char* path, const char* mode, bool create) {
+    stats.opens++;
+    auto n = find(path, true); // VFSImpl::open(): stat()
+    bool write = mode[0] == 'w' || mode[0] == 'a';
+    if (!n) {
+        if (!write) return nullptr;
+        std::string p = path;
+        size_t      slash = p.rfind('/');
+        auto        dir = find(p.substr(0, slash));
+        if (!dir || !dir->dir) return nullptr;
+        n = make(dir.get(), p.substr(slash + 1), false);
+    } else {
+        find(path, true); // VFSFileImpl(): stat(), then fopen() / opendir()
+        find(path, true);
+        if (n->dir && write) return nullptr;
+    }
+    auto f = std::make_shared<MemFile>(this, n, path, write);
+    if (mode[0] == 'w') n->data.clear();
+    if (mode[0] == 'a') f->seek(n->data.size(), fs::SeekSet);
+    return f;
+}
+
+bool MemFS::rename(const char* pathFrom, const char* pathTo) {
+    auto n = find(pathFrom, true);
+    if (!n) return false;
+    remove(pathTo);
+    std::string to = pathTo;
+    size_t      slash = to.rfind('/');
+    auto        dir = find(to.substr(0, slash));
+    if (!dir || !dir->dir) return false;
+    auto& siblings = n->parent->children;
+    siblings.erase(std::find(siblings.begin(), siblings.end(), n));
+    n->name = to.substr(slash + 1);
+    n->parent = dir.get();
+    dir->children.push_back(n);
+    return true;
+}
+
+bool MemFS::remove(const char* path) {
+    auto n = find(path, true);
+    if (!n || n == m_root) return false;
+    auto& siblings = n->parent->children;
+    siblings.erase(std::find(siblings.begin(), siblings.end(), n));
+    return true;
+}
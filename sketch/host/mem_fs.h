@@ -0,0 +1,76 @@
+/*
+ * mem_fs.h
+ *
+ * in-memory file system behind the fs::FS shim (shim/FS.h), one instance stands in for LittleFS, others for the SD card
+ *
+ * with fatModel set it counts the 512 byte sectors FatFs would read from the card for the directory work, as the
+ * Arduino-ESP32 VFS drives it:
+ *   - a path lookup (stat, fopen, opendir) scans every directory on the path from its first entry to the wanted one
+ *   - FS::open() is three lookups (VFSImpl::open() stat, VFSFileImpl() stat + fopen / opendir),
+ *     File::openNextFile() is a readdir() plus two, File::getNextFileName() is a readdir() only
+ *   - an entry takes one short name slot plus one long name slot per 13 characters, 16 slots per sector,
+ *     a sub directory starts with "." and ".."
+ *   - FatFs keeps one sector in its window, touching that sector again is free
+ * file data and FAT chain reads are not counted, neither are the LittleFS (flash) calls beyond their number and size
+ *
+ */
+#pragma once
+
+#include <FS.h>
+#include <map>
+#include <string>
+#include <vector>
+
+struct mem_fs_stats_t {
+    uint64_t opens;       // FS::open() and File::openNextFile()
+    uint64_t lookups;     // path lookups
+    uint64_t readdirs;
+    uint64_t sectors;     // directory sectors read from the card (fatModel)
+    uint64_t readCalls;
+    uint64_t readBytes;
+    uint64_t writeCalls;
+    uint64_t writeBytes;
+    uint64_t seeks;
+};
+
+class MemFS : public fs::FSImpl {
+  public:
+    struct Node {
+        std::string                        name; // basename
+        bool                               dir = false;
+        std::vector<uint8_t>               data;
+        size_t                             sparse = 0; // size of a file without content, the media on the card
+        std::vector<std::shared_ptr<Node>> children; // directory order = creation order, as FAT
+        Node*                              parent = nullptr;
+        uint32_t                           id = 0;
+    };
+
+    explicit MemFS(bool fatModel) : m_fatModel(fatModel) { clear(); }
+
+    void            clear(); // empty root, stats kept
+    mem_fs_stats_t  stats = {};
+    bool            addFile(const std::string& path, size_t size = 0); // creates missing parent directories
+    bool            addDir(const std::string& path);
+    std::string     readAll(const std::string& path); // no stats
+    std::shared_ptr<Node> find(const std::string& path, bool count = false); // count: a path lookup in the stats
+    void            touch(uint32_t dirId, uint32_t slot); // FatFs window
+    uint32_t        slotsBefore(const Node* dir, size_t child) const;
+    static uint32_t slotsOf(const Node* n) { return 1 + ((uint32_t)n->name.size() + 12) / 13; }
+
+    fs::FileImplPtr open(const char* path, const char* mode, bool create) override;
+    bool            exists(const char* path) override { return find(path, true) != nullptr; }
+    bool            rename(const char* pathFrom, const char* pathTo) override;
+    bool            remove(const char* path) override;
+    bool            mkdir(const char* path) override { return addDir(path); }
+
+  private:
+    std::shared_ptr<Node> m_root;
+    bool                  m_fatModel;
+    uint32_t              m_nextId = 0;
+    uint64_t              m_window = ~0ull; // dir id << 32 | sector
+    std::shared_ptr<Node> make(Node* parent, const std::string& name, bool dir);
+    fs::FileImplPtr       openNode(const std::shared_ptr<Node>& n, const std::string& path, const char* mode);
+    friend class MemFile;
+};
+
+extern std::shared_ptr<MemFS> hostLittleFS; // behind LittleFS of shim/LittleFS.h
@@ -0,0 +1,54 @@
+/*
+ * mp3_kernels.cpp
+ *
+ * writes the PCM of a fixed set of MP3 streams to a file, built once with the reference kernels and once with MP3_FAST_KERNELS,
+ * ctest compares both files byte for byte
+ *
+ *   mp3_kernels_ref|mp3_kernels_fast out.pcm [file.mp3 | directory] ...
+ *
+ */
+#include "decoder_host.h"
+#include <filesystem>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s out.pcm [file.mp3 | directory] ...\n", argv[0]);
+        return 2;
+    }
+    std::vector<std::string> files;
+    for (int i = 2; i < argc; i++) {
+        if (std::filesystem::is_directory(argv[i])) {
+            for (auto& e : std::filesystem::directory_iterator(argv[i])) files.push_back(e.path().string());
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    FILE* out = fopen(argv[1], "wb");
+    if (!out) return 2;
+    uint64_t      samples = 0;
+    host_decode_t d;
+    for (uint32_t seed = 1; seed <= 8; seed++) { // long blocks only and mixed long / short blocks
+        std::vector<uint8_t> mp3 = synth_mp3(400, seed, seed & 1);
+        if (!host_decode(HOST_MP3, mp3, d)) {
+            fprintf(stderr, "synthetic seed %u: nothing decoded\n", seed);
+            return 1;
+        }
+        fwrite(d.pcm.data(), sizeof(int16_t), d.pcm.size(), out);
+        samples += d.pcm.size();
+    }
+    for (auto& f : files) {
+        std::vector<uint8_t> data = host_read_file(f);
+        if (host_codec_of(f, data) != HOST_MP3) continue;
+        if (!host_decode(HOST_MP3, data, d)) {
+            fprintf(stderr, "%s: nothing decoded\n", f.c_str());
+            return 1;
+        }
+        fwrite(d.pcm.data(), sizeof(int16_t), d.pcm.size(), out);
+        samples += d.pcm.size();
+    }
+    fclose(out);
+    printf("%s: %llu samples\n", argv[1], (unsigned long long)samples);
+    return 0;
+}
@@ -0,0 +1,205 @@
+/*
+ * net_prefetch_stress.cpp
+ *
+ * NetPrefetch (net_prefetch/net_prefetch.cpp) on a localhost TCP socket, its task on a thread of shim/freertos.cpp.
+ * The server sends a counter stream per connection in chunks of random size, with random pauses and now and then a
+ * stall of up to 120 ms, as a radio stream over WiFi; the consumer reads at random sizes and pauses as processWebStream()
+ *   stream     one connection to its end: every byte in order, none lost or doubled, read() never waits for the network
+ *   reconnect  20 connections cut off at a random point: stop() returns true, after it the client continues exactly
+ *              behind the last byte of the ring, no byte was taken by the task after stop()
+ *   stuck      a read() of the client that blocks for 1.5 s (hostReadStallMs, a TLS read): stop() and start() give up
+ *              after STOP_TIMEOUT_MS, once the read returned stop() and start() work and the stream is still exact
+ * the times are those of the build host; net_prefetch_stress_tsan is the same under ThreadSanitizer
+ *
+ *   net_prefetch_stress [megabytes]    of the stream case, default 4
+ *
+ */
+#include "net_prefetch/net_prefetch.h"
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+
+static inline uint8_t streamByte(uint64_t i) { return (uint8_t)((i * 0x9E3779B97F4A7C15ull) >> 56); }
+
+static double msSince(std::chrono::steady_clock::time_point t) { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count(); }
+
+class LocalServer { // every accepted connection gets the counter stream from byte 0, then the server closes it
+  public:
+    LocalServer(uint64_t streamBytes) : m_bytes(streamBytes) {
+        m_fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in a = {};
+        a.sin_family = AF_INET;
+        a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(a);
+        bind(m_fd, (sockaddr*)&a, len);
+        listen(m_fd, 4);
+        getsockname(m_fd, (sockaddr*)&a, &len);
+        m_port = ntohs(a.sin_port);
+        m_accept = std::thread([this]() {
+            uint32_t seed = 1;
+            int      fd;
+            while ((fd = accept(m_fd, nullptr, nullptr)) >= 0) {
+                std::lock_guard<std::mutex> lock(m_m);
+                m_conns.emplace_back(&LocalServer::send, this, fd, seed++);
+            }
+        });
+    }
+    ~LocalServer() {
+        m_f_stop = true;
+        shutdown(m_fd, SHUT_RDWR); // ends accept()
+        m_accept.join();
+        for (std::thread& t : m_conns) t.join();
+        close(m_fd);
+    }
+    uint16_t port() { return m_port; }
+
+  private:
+    void send(int fd, uint32_t seed) {
+        std::mt19937 rnd(seed);
+        uint8_t      chunk[4096];
+        uint64_t     n = 0;
+        while (n < m_bytes && !m_f_stop) {
+            size_t len = std::min<uint64_t>(1 + rnd() % sizeof(chunk), m_bytes - n);
+            for (size_t i = 0; i < len; i++) chunk[i] = streamByte(n + i);
+            ssize_t w = ::send(fd, chunk, len, MSG_NOSIGNAL);
+            if (w <= 0) break; // the client is gone
+            n += w;
+            uint32_t r = rnd() % 256;
+            if (r == 0) std::this_thread::sleep_for(std::chrono::milliseconds(30 + rnd() % 90));
+            else if (r < 64) std::this_thread::sleep_for(std::chrono::microseconds(rnd() % 2000));
+        }
+        close(fd);
+    }
+
+    int                      m_fd;
+    uint16_t                 m_port;
+    uint64_t                 m_bytes;
+    std::atomic<bool>        m_f_stop{false};
+    std::thread              m_accept;
+    std::mutex               m_m;
+    std::vector<std::thread> m_conns;
+};
+
+struct consumer_t {
+    std::mt19937 rnd{7};
+    uint64_t     n = 0;          // stream bytes read and checked
+    bool         exact = true;
+    double       longestReadMs = 0;
+    uint8_t      maxFill = 0;
+
+    // reads until n == limit or the stream ends, false on the first wrong byte
+    bool consume(NetPrefetch& np, uint64_t limit) {
+        uint8_t buf[8192];
+        while (n < limit && exact) {
+            maxFill = std::max(maxFill, np.fillPercent());
+            bool    open = np.connected(); // before read(): once it is false the ring holds the rest of the stream
+            size_t  len = std::min<uint64_t>(1 + rnd() % sizeof(buf), limit - n);
+            auto    t = std::chrono::steady_clock::now();
+            int32_t r;
+            if (rnd() % 16) r = np.read(buf, len);
+            else { // one byte, as audioFileRead() for the chunk headers
+                int32_t c = np.read(nullptr, 0);
+                r = c < 0 ? 0 : 1;
+                buf[0] = (uint8_t)c;
+            }
+            longestReadMs = std::max(longestReadMs, msSince(t));
+            for (int32_t i = 0; i < r; i++) exact &= buf[i] == streamByte(n + i);
+            n += r;
+            if (!r && !open) break;
+            uint32_t j = rnd() % 512;
+            if (j == 0) std::this_thread::sleep_for(std::chrono::milliseconds(80)); // the ring fills up to the high watermark
+            else if (j < 32) std::this_thread::sleep_for(std::chrono::microseconds(rnd() % 500));
+            else if (!r) std::this_thread::yield();
+        }
+        return exact;
+    }
+};
+
+static bool streamCase(uint16_t port, uint64_t total) {
+    NetworkClient client;
+    NetPrefetch   np;
+    consumer_t    c;
+    auto          t = std::chrono::steady_clock::now();
+    bool          ok = client.connect("127.0.0.1", port) && np.start(&client);
+    ok = ok && c.consume(np, UINT64_MAX) && c.n == total && c.longestReadMs < 100;
+    printf("stream     %10llu bytes in %6.0f ms, ring up to %3u %%, longest read() %.3f ms  %s\n", (unsigned long long)c.n, msSince(t), c.maxFill,
+           c.longestReadMs, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// after stop() the client is the caller's again: the ring, then the client itself must continue the stream
+static bool handOver(NetworkClient& client, NetPrefetch& np, consumer_t& c) {
+    uint8_t buf[4096];
+    int32_t r;
+    while ((r = np.read(buf, sizeof(buf))) > 0) {
+        for (int32_t i = 0; i < r; i++) c.exact &= buf[i] == streamByte(c.n + i);
+        c.n += r;
+    }
+    auto t = std::chrono::steady_clock::now();
+    while ((r = client.read(buf, sizeof(buf))) <= 0 && client.connected() && msSince(t) < 1000) std::this_thread::yield();
+    for (int32_t i = 0; i < r; i++) c.exact &= buf[i] == streamByte(c.n + i);
+    c.n += std::max(r, 0);
+    return c.exact && r > 0;
+}
+
+static bool reconnectCase(uint16_t port, int cycles) {
+    NetPrefetch np; // one task for all connections, as Audio keeps it from one station to the next
+    double      longestStopMs = 0;
+    bool        ok = true;
+    for (int i = 0; i < cycles && ok; i++) {
+        NetworkClient client;
+        consumer_t    c;
+        c.rnd.seed(100 + i);
+        ok = client.connect("127.0.0.1", port) && np.start(&client);
+        ok = ok && c.consume(np, 8192 + c.rnd() % (256 * 1024));
+        auto t = std::chrono::steady_clock::now();
+        ok = ok && np.stop();
+        longestStopMs = std::max(longestStopMs, msSince(t));
+        ok = ok && handOver(client, np, c);
+    }
+    printf("reconnect  %10d connections, longest stop() %.3f ms  %s\n", cycles, longestStopMs, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+static bool stuckCase(uint16_t port) {
+    NetworkClient client;
+    NetPrefetch   np;
+    consumer_t    c;
+    constexpr uint32_t stallMs = 1500, slackMs = 200;
+    bool          ok = client.connect("127.0.0.1", port) && np.start(&client) && c.consume(np, 64 * 1024);
+    client.hostReadStallMs = stallMs;
+    while (ok && !client.hostReadsStalled) { // the task reads on while the ring is below the high watermark
+        ok = c.consume(np, c.n + np.available());
+        std::this_thread::yield();
+    }
+    auto t = std::chrono::steady_clock::now();
+    bool stopped = np.stop();
+    double stopMs = msSince(t);
+    t = std::chrono::steady_clock::now();
+    bool started = np.start(&client);
+    double startMs = msSince(t);
+    ok = ok && !stopped && !started && stopMs < NetPrefetch::STOP_TIMEOUT_MS + slackMs && startMs < NetPrefetch::STOP_TIMEOUT_MS + slackMs;
+
+    client.hostReadStallMs = 0;
+    while (client.hostReadsStalled) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ok = ok && np.stop() && handOver(client, np, c) && np.start(&client) && c.consume(np, UINT64_MAX) && c.n == 4 * 1024 * 1024;
+    printf("stuck      read blocked %u ms: stop() false after %.0f ms, start() false after %.0f ms, then %llu bytes  %s\n", stallMs, stopMs, startMs,
+           (unsigned long long)c.n, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    uint64_t total = (argc > 1 ? std::max(1, atoi(argv[1])) : 4) * 1024ull * 1024;
+    bool     ok = true;
+    {
+        LocalServer server(total);
+        ok &= streamCase(server.port(), total);
+    }
+    {
+        LocalServer server(4 * 1024 * 1024);
+        ok &= reconnectCase(server.port(), 20);
+        ok &= stuckCase(server.port());
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+/*
+ * playlist_bench.cpp
+ *
+ * SD rescan cost of src/file/playlist.cpp against the scanner before it (playlist_v2.cpp), on a generated library in
+ * MemFS and its FatFs sector model (mem_fs.h):
+ *   full       nothing on LittleFS yet
+ *   unchanged  rescan of the same card
+ *   changed    one album added, one track deleted, one album renamed
+ * "card ms" prices the counted directory sectors at 1.1 ms each, a 512 byte read over SPI at the 4 MHz of SD.begin().
+ * That is the model's number, not one measured on the device; "host ms" is the scanner's own time on the build host.
+ *
+ *   playlist_bench [artists albums tracks]
+ *
+ * fails if a rescan does not write the same playlist and index as a full scan of the same card, or if the two
+ * scanners disagree
+ *
+ */
+#include "mem_fs.h"
+#include "playlist.h"
+#include <LittleFS.h>
+#include <chrono>
+
+namespace v2 {
+void generatePlaylistFile(fs::FS& sourceFs, const char* dirname, uint8_t levels);
+}
+
+static constexpr double sectorMs = 1.1;
+
+static void make_library(MemFS& sd, int artists, int albums, int tracks) {
+    char path[160];
+    sd.addFile("/stations.csv", 900);
+    sd.addFile("/System Volume Information/IndexerVolumeGuid", 76);
+    sd.addFile("/.Trashes/501/deleted.mp3", 3000000); // hidden, not scanned
+    for (int a = 0; a < artists; a++) {
+        for (int b = 0; b < albums; b++) {
+            snprintf(path, sizeof(path), "/Music/Artist Name %03d/%d - Album Title %d/cover.jpg", a, 1990 + (a + b) % 30, b);
+            sd.addFile(path, 120000);
+            for (int t = 0; t < tracks; t++) {
+                snprintf(path, sizeof(path), "/Music/Artist Name %03d/%d - Album Title %d/%02d - Track Title Number %d.%s", a, 1990 + (a + b) % 30, b,
+                         t + 1, t + 1, (a + t) % 5 ? "mp3" : "flac");
+                sd.addFile(path, 4000000 + t * 1000);
+            }
+        }
+    }
+}
+
+static void change_library(MemFS& sd, int artists, int albums, int tracks) {
+    char path[160], to[160];
+    for (int t = 0; t < tracks; t++) {
+        snprintf(path, sizeof(path), "/Music/Artist Name %03d/2024 - New Album/%02d - New Track %d.mp3", artists / 2, t + 1, t + 1);
+        sd.addFile(path, 5000000);
+    }
+    snprintf(path, sizeof(path), "/Music/Artist Name %03d/%d - Album Title %d/%02d - Track Title Number %d.%s", artists / 10, 1990 + (artists / 10) % 30, 0, 3, 3,
+             (artists / 10 + 2) % 5 ? "mp3" : "flac");
+    if (!sd.remove(path)) fprintf(stderr, "not on the card: %s\n", path);
+    int a = artists * 7 / 10, b = albums - 1;
+    snprintf(path, sizeof(path), "/Music/Artist Name %03d/%d - Album Title %d", a, 1990 + (a + b) % 30, b);
+    snprintf(to, sizeof(to), "/Music/Artist Name %03d/%d - Album Title %d (Remastered)", a, 1990 + (a + b) % 30, b);
+    if (!sd.rename(path, to)) fprintf(stderr, "not on the card: %s\n", path);
+}
+
+struct result_t {
+    mem_fs_stats_t sd, lfs;
+    double         hostMs;
+    std::string    playlist, index;
+};
+
+static mem_fs_stats_t delta(const mem_fs_stats_t& a, const mem_fs_stats_t& b) {
+    return {a.opens - b.opens,         a.lookups - b.lookups,       a.readdirs - b.readdirs,     a.sectors - b.sectors,  a.readCalls - b.readCalls,
+            a.readBytes - b.readBytes, a.writeCalls - b.writeCalls, a.writeBytes - b.writeBytes, a.seeks - b.seeks};
+}
+
+static result_t scan(bool current, const std::shared_ptr<MemFS>& card) {
+    fs::FS         sd(card);
+    mem_fs_stats_t s0 = card->stats, l0 = hostLittleFS->stats;
+    auto           t = std::chrono::steady_clock::now();
+    if (current) generatePlaylistFile(sd, "/", 5);
+    else v2::generatePlaylistFile(sd, "/", 5);
+    result_t r;
+    r.hostMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+    r.sd = delta(card->stats, s0);
+    r.lfs = delta(hostLittleFS->stats, l0);
+    r.playlist = hostLittleFS->readAll(PLAYLIST_FILE);
+    r.index = hostLittleFS->readAll(PLAYLIST_INDEX_FILE);
+    if (r.index.size() >= sizeof(PlaylistIndexHeader)) // every scan counts the generation up, the rest must be equal
+        memset(&r.index[offsetof(PlaylistIndexHeader, generation)], 0, sizeof(PlaylistIndexHeader::generation));
+    return r;
+}
+
+// every index entry points at the start of its playlist line and has the line's length
+static bool index_matches(const result_t& r, uint32_t& count) {
+    PlaylistIndexHeader h;
+    if (r.index.size() < sizeof(h)) return false;
+    memcpy(&h, r.index.data(), sizeof(h));
+    if (h.magic != PLAYLIST_INDEX_MAGIC || h.blobSize != r.playlist.size() || r.index.size() != sizeof(h) + h.count * sizeof(PlaylistIndexEntry)) return false;
+    size_t pos = 0;
+    for (uint32_t i = 0; i < h.count; i++) {
+        PlaylistIndexEntry e;
+        memcpy(&e, r.index.data() + sizeof(h) + i * sizeof(e), sizeof(e));
+        size_t eol = r.playlist.find("\r\n", pos);
+        if (e.offset != pos || eol == std::string::npos || e.length != eol - pos) return false;
+        pos = eol + 2;
+    }
+    count = h.count;
+    return pos == r.playlist.size();
+}
+
+int main(int argc, char** argv) {
+    int artists = argc > 3 ? atoi(argv[1]) : 100, albums = argc > 3 ? atoi(argv[2]) : 4, tracks = argc > 3 ? atoi(argv[3]) : 12;
+    const char* step[3] = {"full", "unchanged", "changed"};
+    result_t    res[2][3];
+    for (int impl = 0; impl < 2; impl++) {
+        hostLittleFS->clear();
+        auto card = std::make_shared<MemFS>(true);
+        make_library(*card, artists, albums, tracks);
+        res[impl][0] = scan(impl, card);
+        res[impl][1] = scan(impl, card);
+        change_library(*card, artists, albums, tracks);
+        res[impl][2] = scan(impl, card);
+    }
+    hostLittleFS->clear(); // reference: the changed card scanned from nothing
+    auto card = std::make_shared<MemFS>(true);
+    make_library(*card, artists, albums, tracks);
+    change_library(*card, artists, albums, tracks);
+    result_t ref = scan(true, card);
+
+    printf("%d artists x %d albums x %d tracks\n", artists, albums, tracks);
+    printf("%-10s %-9s %8s %9s %8s %8s %9s %11s %11s %8s\n", "scanner", "scan", "card ms", "sectors", "opens", "readdir", "lookups", "LFS reads", "LFS writes", "host ms");
+    for (int impl = 0; impl < 2; impl++) {
+        for (int s = 0; s < 3; s++) {
+            const result_t& r = res[impl][s];
+            printf("%-10s %-9s %8.0f %9llu %8llu %8llu %9llu %11llu %11llu %8.2f\n", impl ? "playlist" : "v2", step[s], r.sd.sectors * sectorMs,
+                   (unsigned long long)r.sd.sectors, (unsigned long long)r.sd.opens, (unsigned long long)r.sd.readdirs, (unsigned long long)r.sd.lookups,
+                   (unsigned long long)r.lfs.readCalls, (unsigned long long)r.lfs.writeCalls, r.hostMs);
+        }
+    }
+
+    bool     ok = true;
+    uint32_t count = 0, refCount = 0;
+    if (!index_matches(ref, refCount)) {
+        printf("reference scan: index does not match the playlist\n");
+        ok = false;
+    }
+    for (int impl = 0; impl < 2; impl++) {
+        for (int s = 0; s < 3; s++) {
+            if (!index_matches(res[impl][s], count)) {
+                printf("%s %s: index does not match the playlist\n", impl ? "playlist" : "v2", step[s]);
+                ok = false;
+            }
+        }
+        if (res[impl][1].playlist != res[impl][0].playlist || res[impl][2].playlist != ref.playlist || res[impl][2].index != ref.index) {
+            printf("%s: a rescan differs from a full scan of the same card\n", impl ? "playlist" : "v2");
+            ok = false;
+        }
+    }
+    if (res[0][2].playlist != res[1][2].playlist) {
+        printf("the scanners write different playlists\n");
+        ok = false;
+    }
+    printf("%u tracks after the change\n", refCount);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+/*
+ * playlist_lookup_bench.cpp
+ *
+ * getTrackPath() of src/file/playlist.cpp on playlists of 100, 1000 and 10000 tracks scanned from a MemFS card
+ * (mem_fs.h), against the line by line scan of PLAYLIST_FILE it replaced (linearTrackPath() below, file.cpp before
+ * 7dda89d): 1000 lookups of random tracks, the LittleFS calls and bytes per lookup and the host time, not the device's
+ * fails if a path differs from its playlist line, or if getTrackPath() serves
+ *   - an index written by a rescan after the last getTrackCount() (generation)
+ *   - an entry that ends behind the playlist its index was built for, or a playlist of another size than its index
+ *
+ *   playlist_lookup_bench
+ *
+ */
+#include "mem_fs.h"
+#include "playlist.h"
+#include <LittleFS.h>
+#include <chrono>
+#include <random>
+
+static bool linearTrackPath(int index, char* outBuf, size_t outBufSize) { // getTrackPath() before the index
+    if (!outBuf || outBufSize == 0) return false;
+    File playlist = LittleFS.open(PLAYLIST_FILE, FILE_READ);
+    if (!playlist) {
+        outBuf[0] = '\0';
+        return false;
+    }
+    int    lineCount = 0;
+    size_t len = 0;
+    while (playlist.available()) {
+        len = playlist.readBytesUntil('\n', outBuf, outBufSize - 1);
+        outBuf[len] = '\0';
+        if (len > 0 && outBuf[len - 1] == '\r') outBuf[len - 1] = '\0';
+        if (lineCount == index) {
+            playlist.close();
+            return true;
+        }
+        lineCount++;
+    }
+    playlist.close();
+    outBuf[0] = '\0';
+    return false;
+}
+
+static std::shared_ptr<MemFS> make_card(int tracks) {
+    auto card = std::make_shared<MemFS>(false);
+    char path[160];
+    for (int t = 0; t < tracks; t++) {
+        snprintf(path, sizeof(path), "/Music/Artist Name %03d/Album Title %d/%02d - Track Title Number %d.mp3", t / 120, t / 12 % 10, t % 12 + 1, t);
+        card->addFile(path, 4000000);
+    }
+    return card;
+}
+
+static std::vector<std::string> lines(const std::string& playlist) {
+    std::vector<std::string> v;
+    for (size_t pos = 0, eol; (eol = playlist.find("\r\n", pos)) != std::string::npos; pos = eol + 2) v.push_back(playlist.substr(pos, eol - pos));
+    return v;
+}
+
+struct lookup_t {
+    double   us;
+    double   reads, bytes, opens;
+    bool     exact;
+};
+
+template <typename F> static lookup_t lookups(F get, const std::vector<std::string>& ref, int n) {
+    std::mt19937   rnd(n);
+    char           path[512];
+    mem_fs_stats_t s0 = hostLittleFS->stats;
+    lookup_t       r = {0, 0, 0, 0, true};
+    auto           t = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        int k = rnd() % ref.size();
+        r.exact &= get(k, path, sizeof(path)) && ref[k] == path;
+    }
+    r.us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t).count() / n;
+    r.reads = (double)(hostLittleFS->stats.readCalls - s0.readCalls) / n;
+    r.bytes = (double)(hostLittleFS->stats.readBytes - s0.readBytes) / n;
+    r.opens = (double)(hostLittleFS->stats.opens - s0.opens) / n;
+    return r;
+}
+
+static void rewrite(const char* name, const std::string& data) {
+    File f = LittleFS.open(name, FILE_WRITE);
+    f.write((const uint8_t*)data.data(), data.size());
+    f.close();
+}
+
+// the refusals of getTrackPath(), on the library of the last size
+static bool checks(fs::FS& sd) {
+    char path[512];
+    bool ok = getTrackPath(0, path, sizeof(path));
+    generatePlaylistFile(sd, "/", 5); // a rescan, the caller has not seen its count yet
+    bool staleRefused = !getTrackPath(0, path, sizeof(path));
+    int  count = getTrackCount();
+    bool freshServed = getTrackPath(0, path, sizeof(path));
+
+    std::string index = hostLittleFS->readAll(PLAYLIST_INDEX_FILE), playlist = hostLittleFS->readAll(PLAYLIST_FILE);
+    PlaylistIndexEntry e;
+    size_t             last = sizeof(PlaylistIndexHeader) + (count - 1) * sizeof(e);
+    memcpy(&e, &index[last], sizeof(e));
+    e.length += 3; // the last line, its end now behind the playlist
+    std::string bad = index;
+    memcpy(&bad[last], &e, sizeof(e));
+    rewrite(PLAYLIST_INDEX_FILE, bad);
+    bool outsideRefused = !getTrackPath(count - 1, path, sizeof(path));
+    rewrite(PLAYLIST_INDEX_FILE, index);
+    rewrite(PLAYLIST_FILE, playlist + "/Music/one more.mp3\r\n"); // another playlist under the same index
+    bool otherRefused = !getTrackPath(0, path, sizeof(path));
+    rewrite(PLAYLIST_FILE, playlist);
+    bool restored = getTrackPath(count - 1, path, sizeof(path));
+
+    ok = ok && staleRefused && freshServed && outsideRefused && otherRefused && restored;
+    printf("refused: index of a later scan %s, entry behind the playlist %s, playlist of another size %s  %s\n", staleRefused ? "yes" : "NO",
+           outsideRefused ? "yes" : "NO", otherRefused ? "yes" : "NO", ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main() {
+    bool ok = true;
+    printf("%-8s %-8s %10s %10s %12s %8s\n", "tracks", "lookup", "host us", "LFS reads", "LFS bytes", "");
+    std::shared_ptr<MemFS> card;
+    for (int tracks : {100, 1000, 10000}) {
+        hostLittleFS->clear();
+        card = make_card(tracks);
+        fs::FS sd(card);
+        generatePlaylistFile(sd, "/", 5);
+        std::vector<std::string> ref = lines(hostLittleFS->readAll(PLAYLIST_FILE));
+        bool                     counted = getTrackCount() == tracks && (int)ref.size() == tracks;
+        lookup_t                 idx = lookups(getTrackPath, ref, 1000);
+        lookup_t                 lin = lookups(linearTrackPath, ref, tracks >= 10000 ? 50 : 1000);
+        for (auto [name, r] : {std::pair{"index", idx}, std::pair{"linear", lin}}) {
+            printf("%-8d %-8s %10.2f %10.1f %12.0f %8s\n", tracks, name, r.us, r.reads, r.bytes, counted && r.exact ? "ok" : "FAILED");
+        }
+        ok &= counted && idx.exact && lin.exact;
+    }
+    fs::FS sd(card);
+    ok &= checks(sd);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,334 @@
+/*
+ * playlist_v2.cpp
+ *
+ * the SD scanner of src/file/file.cpp before src/file/playlist.cpp (manifest version 2), kept for the before / after
+ * numbers of playlist_bench: hashes every directory by opening each entry for its size, lists it again for the tracks
+ * and a third time for the sub directories, copies an unchanged directory one track at a time
+ *
+ */
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include "playlist.h"
+
+#undef SCAN_MANIFEST_VERSION
+#define SCAN_MANIFEST_VERSION 2
+#define PATH_BUF_LEN 512
+
+namespace v2 {
+
+static bool isAudioFile(const char *name) {
+    const char *ext = strrchr(name, '.');
+    if (!ext) return false;
+
+    return strcasecmp(ext, ".mp3") == 0 ||
+           strcasecmp(ext, ".wav") == 0 ||
+           strcasecmp(ext, ".aac") == 0 ||
+           strcasecmp(ext, ".flac") == 0;
+}
+
+
+// append one path to the playlist text and its offset entry to the index
+static void writePlaylistEntry(File &playlist, File &index, const char *path) {
+    PlaylistIndexEntry entry = {};
+    entry.offset = playlist.position();
+    entry.length = (uint16_t)strnlen(path, PATH_BUF_LEN - 1);
+    playlist.println(path);
+    index.write((const uint8_t *)&entry, sizeof(entry));
+}
+
+// write (or rewrite) the index header at the start of the index file
+static void writePlaylistIndexHeader(File &index, uint32_t count, uint32_t blobSize) {
+    PlaylistIndexHeader header = {
+        .magic = PLAYLIST_INDEX_MAGIC,
+        .version = PLAYLIST_INDEX_VERSION,
+        .entrySize = sizeof(PlaylistIndexEntry),
+        .count = count,
+        .blobSize = blobSize,
+    };
+    index.seek(0, SeekSet);
+    index.write((const uint8_t *)&header, sizeof(header));
+}
+
+// read and validate the index header against the current playlist file
+static bool readPlaylistIndexHeader(File &index, PlaylistIndexHeader &header) {
+  if (index.read((uint8_t *)&header, sizeof(header)) != sizeof(header)) return false;
+  if (header.magic != PLAYLIST_INDEX_MAGIC || header.version != PLAYLIST_INDEX_VERSION || header.entrySize != sizeof(PlaylistIndexEntry)) return false;
+  if (index.size() < sizeof(header) + (size_t)header.count * sizeof(PlaylistIndexEntry)) return false;
+  return true;
+}
+
+// ==========================================
+// Scan manifest: one record per visited directory, in scan order.
+// A directory whose entries (names, sizes, types) hash to the same value as
+// its record reuses the tracks it contributed to the previous playlist
+// instead of being rescanned.
+// ==========================================
+struct ScanContext {
+    fs::FS *fs;
+    File playlist; // new playlist text
+    File index; // new playlist index
+    File manifest; // new scan manifest
+    File oldPlaylist; // previous scan, may be invalid
+    File oldIndex;
+    uint32_t oldCount;
+    uint8_t *oldManifest; // previous manifest loaded into PSRAM, may be NULL
+    size_t oldManifestLen;
+    size_t cursor; // offset of the next expected record in oldManifest
+    uint32_t count; // tracks written
+    uint32_t dirs; // directories visited
+    uint32_t reusedDirs; // directories reused from the manifest
+    char *pathBuf;
+};
+
+// load the previous manifest, only if the previous playlist + index are usable
+static void loadScanManifest(ScanContext &ctx) {
+    ctx.oldManifest = NULL;
+    ctx.oldManifestLen = 0;
+    ctx.cursor = sizeof(ScanManifestHeader);
+    ctx.oldCount = 0;
+
+    ctx.oldIndex = LittleFS.open(PLAYLIST_INDEX_FILE, FILE_READ);
+    ctx.oldPlaylist = LittleFS.open(PLAYLIST_FILE, FILE_READ);
+    PlaylistIndexHeader indexHeader;
+    if (!ctx.oldIndex || !ctx.oldPlaylist || !readPlaylistIndexHeader(ctx.oldIndex, indexHeader) || indexHeader.blobSize != ctx.oldPlaylist.size()) return;
+    ctx.oldCount = indexHeader.count;
+
+    File f = LittleFS.open(SCAN_MANIFEST_FILE, FILE_READ);
+    if (!f) return;
+    size_t len = f.size();
+    uint8_t *buf = len > sizeof(ScanManifestHeader) ? (uint8_t *)heap_caps_malloc(len, MALLOC_CAP_SPIRAM) : NULL;
+    if (buf && f.read(buf, len) == len) {
+        const ScanManifestHeader *header = (const ScanManifestHeader *)buf;
+        if (header->magic == SCAN_MANIFEST_MAGIC && header->version == SCAN_MANIFEST_VERSION && header->trackCount == ctx.oldCount) {
+            ctx.oldManifest = buf;
+            ctx.oldManifestLen = len;
+            buf = NULL;
+        }
+    }
+    if (buf) heap_caps_free(buf);
+    f.close();
+}
+
+// step through manifest records: returns record at 'offset' and moves offset to the next one
+static const ScanManifestDir *nextManifestDir(const ScanContext &ctx, size_t &offset, const char **path) {
+    if (offset + sizeof(ScanManifestDir) > ctx.oldManifestLen) return NULL;
+    const ScanManifestDir *rec = (const ScanManifestDir *)(ctx.oldManifest + offset);
+    size_t next = offset + sizeof(ScanManifestDir) + rec->pathLen + 1;
+    if (next > ctx.oldManifestLen) return NULL;
+    *path = (const char *)(rec + 1);
+    offset = next;
+    return rec;
+}
+
+// directories are visited in the same order as last time, so try the cursor first
+static const ScanManifestDir *findManifestDir(ScanContext &ctx, const char *dirPath) {
+    if (!ctx.oldManifest) return NULL;
+    const char *path;
+    size_t offset = ctx.cursor;
+    const ScanManifestDir *rec = nextManifestDir(ctx, offset, &path);
+    if (rec && strcmp(path, dirPath) == 0) {
+        ctx.cursor = offset;
+        return rec;
+    }
+    offset = sizeof(ScanManifestHeader);
+    while ((rec = nextManifestDir(ctx, offset, &path)) != NULL) {
+        if (strcmp(path, dirPath) == 0) {
+            ctx.cursor = offset;
+            return rec;
+        }
+    }
+    return NULL;
+}
+
+static void writeManifestDir(ScanContext &ctx, ScanManifestDir &rec, const char *dirPath) {
+    rec.pathLen = (uint16_t)strnlen(dirPath, PATH_BUF_LEN - 1);
+    ctx.manifest.write((const uint8_t *)&rec, sizeof(rec));
+    ctx.manifest.write((const uint8_t *)dirPath, rec.pathLen);
+    ctx.manifest.write((uint8_t)0);
+}
+
+// copy the tracks an unchanged directory contributed to the previous playlist
+static bool copyManifestTracks(ScanContext &ctx, const ScanManifestDir *old) {
+    if ((uint64_t)old->firstTrack + old->trackCount > ctx.oldCount) return false;
+    for (uint32_t i = old->firstTrack; i < old->firstTrack + old->trackCount; i++) {
+        PlaylistIndexEntry entry;
+        ctx.oldIndex.seek(sizeof(PlaylistIndexHeader) + (size_t)i * sizeof(entry), SeekSet);
+        if (ctx.oldIndex.read((uint8_t *)&entry, sizeof(entry)) != sizeof(entry)) continue;
+        size_t len = entry.length < PATH_BUF_LEN - 1 ? entry.length : PATH_BUF_LEN - 1;
+        ctx.oldPlaylist.seek(entry.offset, SeekSet);
+        len = ctx.oldPlaylist.read((uint8_t *)ctx.pathBuf, len);
+        ctx.pathBuf[len] = '\0';
+        if (len == 0) continue;
+        writePlaylistEntry(ctx.playlist, ctx.index, ctx.pathBuf);
+        ctx.count++;
+    }
+    return true;
+}
+
+static uint32_t fnv1a(uint32_t h, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) h = (h ^ *p++) * 16777619u;
+    return h;
+}
+
+// hash and count the entries of a directory in one pass; the FAT mtime of a
+// directory is not updated when a file inside is replaced, the size is
+static void hashDirEntries(File &dir, ScanManifestDir &rec) {
+    uint32_t h = 2166136261u;
+    uint32_t n = 0;
+    dir.rewindDirectory();
+    while (true) {
+        File entry = dir.openNextFile();
+        if (!entry) break;
+        const char *name = entry.name();
+        const char *base = strrchr(name, '/');
+        base = base ? base + 1 : name;
+        uint32_t size = entry.isDirectory() ? 0xFFFFFFFF : (uint32_t)entry.size();
+        h = fnv1a(h, base, strlen(base) + 1); // with '\0', "ab"+"c" != "a"+"bc"
+        h = fnv1a(h, &size, sizeof(size));
+        entry.close();
+        if ((++n & 31) == 0) vTaskDelay(1);
+    }
+    rec.entryHash = h;
+    rec.entryCount = n;
+}
+
+// Build full child path into pathBuf, returns basename
+static const char *childPath(const char *currentDir, const String &name, char *pathBuf, size_t pathBufLen) {
+    const char *entryPath = name.c_str(); // FULL path on SD
+    const char *base = strrchr(entryPath, '/');
+    base = base ? base + 1 : entryPath; // basename ONLY
+    if (strcmp(currentDir, "/") == 0) {
+        snprintf(pathBuf, pathBufLen, "/%s", base);
+    } else {
+        snprintf(pathBuf, pathBufLen, "%s/%s", currentDir, base);
+    }
+    return base;
+}
+
+// ==========================================
+// Recursive Directory Scanner that SAVES TO FILE
+// tracks of a directory are written first, then its sub directories,
+// so every directory owns one contiguous range of the playlist.
+// Note: older firmware wrote files and sub directories interleaved in
+// directory order, a folder holding both lists its own tracks first now.
+// ==========================================
+static void scanDirRecursive(ScanContext &ctx, const char *currentDir, uint8_t level) {
+    File dir = ctx.fs->open(currentDir);
+    if (!dir || !dir.isDirectory()) {
+        dir.close();
+        return;
+    }
+
+    ScanManifestDir rec = {};
+    hashDirEntries(dir, rec);
+    rec.firstTrack = ctx.count;
+
+    const ScanManifestDir *old = findManifestDir(ctx, currentDir);
+    if (old && old->entryHash == rec.entryHash && old->entryCount == rec.entryCount && copyManifestTracks(ctx, old)) {
+        ctx.reusedDirs++;
+    } else {
+        bool isDir;
+        uint32_t n = 0;
+        dir.rewindDirectory();
+        while (true) {
+            String name = dir.getNextFileName(&isDir);
+            if (name.length() == 0) break;
+            if (!isDir) {
+                const char *base = childPath(currentDir, name, ctx.pathBuf, PATH_BUF_LEN);
+                if (isAudioFile(base)) {
+                    writePlaylistEntry(ctx.playlist, ctx.index, ctx.pathBuf);
+                    ctx.count++;
+                    log_d("-> %s", ctx.pathBuf);
+                }
+            }
+            if ((++n & 31) == 0) vTaskDelay(1);
+        }
+    }
+    rec.trackCount = ctx.count - rec.firstTrack;
+    writeManifestDir(ctx, rec, currentDir);
+
+    // progress report
+    ++ctx.dirs;
+
+    if (level > 0) {
+        bool isDir;
+        dir.rewindDirectory();
+        while (true) {
+            String name = dir.getNextFileName(&isDir);
+            if (name.length() == 0) break;
+            if (!isDir) continue;
+            const char *base = childPath(currentDir, name, ctx.pathBuf, PATH_BUF_LEN);
+            if (base[0] == '.') continue;
+            char childDir[PATH_BUF_LEN];
+            strncpy(childDir, ctx.pathBuf, sizeof(childDir));
+            childDir[sizeof(childDir) - 1] = '\0';
+            scanDirRecursive(ctx, childDir, level - 1); // ✅ stable copy
+        }
+    }
+
+    dir.close();
+}
+
+
+
+
+//create music_playlist.txt, its offset index music_playlist.idx and the scan manifest
+//unchanged directories are merged from the previous scan
+void generatePlaylistFile(fs::FS &sourceFs, const char *dirname, uint8_t levels) {
+    uint32_t t0 = millis();
+    ScanContext ctx = {};
+    ctx.fs = &sourceFs;
+    loadScanManifest(ctx);
+
+    // write next to the previous files, swap them in when done
+    ctx.playlist = LittleFS.open(PLAYLIST_FILE ".new", FILE_WRITE);
+    ctx.index = LittleFS.open(PLAYLIST_INDEX_FILE ".new", FILE_WRITE);
+    ctx.manifest = LittleFS.open(SCAN_MANIFEST_FILE ".new", FILE_WRITE);
+    ctx.pathBuf = (char *)heap_caps_malloc(PATH_BUF_LEN, MALLOC_CAP_SPIRAM);
+
+    bool ok = ctx.playlist && ctx.index && ctx.manifest && ctx.pathBuf;
+    if (!ok) {
+        log_e("Failed to open playlist files for writing!");
+    } else {
+        ScanManifestHeader header = {.magic = SCAN_MANIFEST_MAGIC, .version = SCAN_MANIFEST_VERSION, .trackCount = 0};
+        ctx.manifest.write((const uint8_t *)&header, sizeof(header));
+        writePlaylistIndexHeader(ctx.index, 0, 0); // placeholder, patched after scan
+
+        log_d("Scanning directory: %s (%s)", dirname, ctx.oldManifest ? "incremental" : "full");
+        scanDirRecursive(ctx, dirname, levels);
+
+        writePlaylistIndexHeader(ctx.index, ctx.count, ctx.playlist.position());
+        header.trackCount = ctx.count;
+        ctx.manifest.seek(0, SeekSet);
+        ctx.manifest.write((const uint8_t *)&header, sizeof(header));
+    }
+
+    if (ctx.pathBuf) heap_caps_free(ctx.pathBuf);
+    if (ctx.oldManifest) heap_caps_free(ctx.oldManifest);
+    ctx.playlist.close();
+    ctx.index.close();
+    ctx.manifest.close();
+    ctx.oldPlaylist.close();
+    ctx.oldIndex.close();
+
+    if (ok) {
+        // littlefs rename replaces the target atomically, a power loss leaves the old or the new file, never none.
+        // The manifest goes first and comes back last: between two renames the playlist and its index may be
+        // from different scans, getTrackCount() sees the blobSize mismatch and rebuilds the index.
+        LittleFS.remove(SCAN_MANIFEST_FILE);
+        ok = LittleFS.rename(PLAYLIST_FILE ".new", PLAYLIST_FILE) && LittleFS.rename(PLAYLIST_INDEX_FILE ".new", PLAYLIST_INDEX_FILE) &&
+             LittleFS.rename(SCAN_MANIFEST_FILE ".new", SCAN_MANIFEST_FILE);
+        if (!ok) log_e("Failed to swap in the new playlist files!");
+    }
+    if (ok) {
+        log_i("Playlist file %s generation complete. %u tracks, %u/%u folders unchanged, %u ms", PLAYLIST_FILE, ctx.count, ctx.reusedDirs, ctx.dirs, millis() - t0);
+    } else {
+        LittleFS.remove(PLAYLIST_FILE ".new");
+        LittleFS.remove(PLAYLIST_INDEX_FILE ".new");
+        LittleFS.remove(SCAN_MANIFEST_FILE ".new");
+    }
+}
+
+} // namespace v2
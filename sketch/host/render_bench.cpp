@@ -0,0 +1,226 @@
+/*
+ * render_bench.cpp
+ *
+ * clock tick and weather icon render time on the build host, before and after the atlases of data/atlas:
+ *   separate  one buffer and descriptor per digit / icon, as the ui_img_*_png C arrays were, drawn through an image cache
+ *             of LV_IMG_CACHE_DEF_SIZE 1, so every draw of another image reopens it
+ *   atlas     tiles that point into one decoded atlas (assetTile()), image cache of 12
+ *
+ * the pixel work is LVGL 8.3's software path for LV_IMG_CF_TRUE_COLOR_ALPHA without transformation (lv_draw_sw_img.c,
+ * lv_draw_sw_blend.c) with LV_COLOR_DEPTH 16 / LV_COLOR_16_SWAP 1: the panel background is filled, then the tile is split
+ * into a color and a mask buffer and mixed into the draw buffer. LVGL is not linked, the object tree walk and the flush are
+ * the same on both paths and are left out. Flash (XIP) vs PSRAM reads can only be seen on the device, see "Nixie: N us per
+ * redraw" in task_msg.cpp.
+ *
+ *   render_bench nixie.tbi weather.tbi
+ *
+ * fails if both layouts do not render the same pixels
+ *
+ */
+#include "decoder_host.h"
+#include <chrono>
+
+struct tbi_t { // src/asset/asset.h AssetHeader
+    uint32_t magic;
+    uint16_t version;
+    uint8_t  cf;
+    uint8_t  compression;
+    uint16_t w;
+    uint16_t h;
+    uint32_t rawSize;
+    uint32_t dataSize;
+};
+
+struct img_t { // lv_img_dsc_t
+    uint16_t       w, h;
+    const uint8_t* data;
+};
+
+static constexpr uint16_t panelW = 640, panelH = 172; // ui_Info_Panel_Clock, one draw buffer
+static constexpr uint16_t bgColor = 0x1082;
+static constexpr uint32_t drawBufPx = panelW;          // lv_draw_sw_img.c MAX_BUF_SIZE, one display row
+
+static bool lz4_decode(const uint8_t* ip, const uint8_t* iend, uint8_t* op, uint8_t* oend) { // asset.cpp lz4Decode()
+    uint8_t* dst = op;
+    while (ip < iend) {
+        uint8_t  token = *ip++;
+        uint32_t len = token >> 4;
+        if (len == 15) {
+            uint8_t b;
+            do len += (b = *ip++); while (b == 255 && ip < iend);
+        }
+        if (len > (uint32_t)(oend - op)) return false;
+        memcpy(op, ip, len);
+        op += len;
+        ip += len;
+        if (ip >= iend) break;
+        uint32_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (uint32_t)(op - dst)) return false;
+        len = (token & 15) + 4;
+        if (len == 19) {
+            uint8_t b;
+            do len += (b = *ip++); while (b == 255 && ip < iend);
+        }
+        if (len > (uint32_t)(oend - op)) return false;
+        for (uint32_t i = 0; i < len; i++, op++) *op = *(op - offset);
+    }
+    return op == oend;
+}
+
+static std::vector<uint8_t> load_tbi(const char* path, tbi_t& h) {
+    std::vector<uint8_t> f = host_read_file(path);
+    std::vector<uint8_t> raw;
+    if (f.size() < sizeof(h)) return raw;
+    memcpy(&h, f.data(), sizeof(h));
+    if (h.magic != 0x4D494254 || h.cf != 5 || h.dataSize != f.size() - sizeof(h)) return raw;
+    raw.resize(h.rawSize);
+    const uint8_t* p = f.data() + sizeof(h);
+    if (h.compression == 0) memcpy(raw.data(), p, std::min<size_t>(h.rawSize, h.dataSize));
+    else if (!lz4_decode(p, p + h.dataSize, raw.data(), raw.data() + raw.size())) raw.clear();
+    return raw;
+}
+
+// LV_COLOR_16_SWAP: byte swapped RGB565, lv_color_mix() works on the channels
+static inline uint16_t color_mix(uint16_t c1, uint16_t c2, uint8_t mix) {
+    c1 = __builtin_bswap16(c1);
+    c2 = __builtin_bswap16(c2);
+    uint32_t r = ((c1 >> 11) * mix + (c2 >> 11) * (255 - mix)) * 0x8081 >> 23; // LV_UDIV255
+    uint32_t g = (((c1 >> 5) & 63) * mix + ((c2 >> 5) & 63) * (255 - mix)) * 0x8081 >> 23;
+    uint32_t b = ((c1 & 31) * mix + (c2 & 31) * (255 - mix)) * 0x8081 >> 23;
+    return __builtin_bswap16((uint16_t)(r << 11 | g << 5 | b));
+}
+
+struct renderer_t {
+    std::vector<uint16_t> fb = std::vector<uint16_t>(panelW * panelH);
+    std::vector<uint16_t> rgb = std::vector<uint16_t>(drawBufPx); // lv_mem_buf_get() of lv_draw_sw_img_decoded()
+    std::vector<uint8_t>  mask = std::vector<uint8_t>(drawBufPx);
+    std::vector<const img_t*> cache; // lv_img_cache, most recent last
+    size_t                    cacheSize = 1;
+    uint32_t                  opens = 0;
+
+    void open(const img_t* img) { // lv_img_cache_open(), a miss runs the built-in decoder's info + open
+        auto it = std::find(cache.begin(), cache.end(), img);
+        if (it != cache.end()) {
+            cache.erase(it);
+        } else {
+            opens++;
+            if (cache.size() == cacheSize) cache.erase(cache.begin());
+            volatile uint32_t header = img->w | img->h << 11; // lv_img_decoder_get_info() reads the header
+            (void)header;
+        }
+        cache.push_back(img);
+    }
+
+    void draw(const img_t* img, uint16_t x0, uint16_t y0) { // invalidated area = the tile, background then image
+        for (uint16_t y = 0; y < img->h; y++) std::fill_n(&fb[(y0 + y) * panelW + x0], img->w, bgColor);
+        open(img);
+        uint16_t rows = std::max<uint16_t>(1, drawBufPx / img->w);
+        for (uint16_t y = 0; y < img->h; y += rows) {
+            uint16_t       n = std::min<uint16_t>(rows, img->h - y);
+            const uint8_t* src = img->data + (size_t)y * img->w * 3;
+            for (uint32_t i = 0; i < (uint32_t)n * img->w; i++, src += 3) { // convert_cb(): ARGB8565 to color + mask
+                rgb[i] = src[0] | src[1] << 8;
+                mask[i] = src[2];
+            }
+            for (uint16_t r = 0; r < n; r++) { // blend_map_normal() with a mask
+                uint16_t*       d = &fb[(y0 + y + r) * panelW + x0];
+                const uint16_t* c = &rgb[r * img->w];
+                const uint8_t*  m = &mask[r * img->w];
+                for (uint16_t x = 0; x < img->w; x++) {
+                    if (m[x] >= 253) d[x] = c[x]; // LV_OPA_MAX
+                    else if (m[x] > 2) d[x] = color_mix(c[x], d[x], m[x]); // LV_OPA_MIN
+                }
+            }
+        }
+    }
+};
+
+struct layout_t {
+    std::vector<img_t>                tiles;
+    std::vector<std::vector<uint8_t>> copies; // separate: one allocation per image
+};
+
+static layout_t make_layout(const std::vector<uint8_t>& atlas, const tbi_t& h, uint16_t tileH, bool separate) {
+    layout_t l;
+    for (uint16_t i = 0; (uint32_t)(i + 1) * tileH <= h.h; i++) {
+        const uint8_t* p = atlas.data() + (size_t)i * tileH * h.w * 3;
+        if (separate) {
+            l.copies.emplace_back(p, p + (size_t)tileH * h.w * 3);
+            p = l.copies.back().data();
+        }
+        l.tiles.push_back({h.w, tileH, p});
+    }
+    return l;
+}
+
+struct result_t {
+    double   nixieUs;  // per clock tick that changes a digit
+    double   weatherUs; // per icon update
+    uint32_t opens;
+    uint64_t checksum;
+};
+
+static result_t run(const layout_t& nixie, const layout_t& weather, size_t cacheSize) {
+    renderer_t r;
+    r.cacheSize = cacheSize;
+    result_t res = {};
+    uint8_t  digit[6] = {255, 255, 255, 255, 255, 255};
+    uint32_t ticks = 0;
+    auto     t = std::chrono::steady_clock::now();
+    for (uint32_t s = 0; s < 86400; s++) { // one day, nixie_clock() once a second
+        uint8_t now[6] = {(uint8_t)(s / 36000), (uint8_t)(s / 3600 % 10), (uint8_t)(s / 600 % 6), (uint8_t)(s / 60 % 10), (uint8_t)(s % 60 / 10), (uint8_t)(s % 10)};
+        for (uint8_t i = 0; i < 6; i++) {
+            if (now[i] == digit[i]) continue;
+            digit[i] = now[i];
+            r.draw(&nixie.tiles[digit[i]], 16 + i * 72 + (i / 2) * 24, 36);
+        }
+        ticks++;
+    }
+    res.nixieUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t).count() / ticks;
+    uint32_t updates = 4000;
+    t = std::chrono::steady_clock::now();
+    for (uint32_t u = 0; u < updates; u++) { // weather and home icon of an update
+        r.draw(&weather.tiles[u % 9], 20, 40);
+        r.draw(&weather.tiles[9 + u % 4], 400, 40);
+    }
+    res.weatherUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t).count() / updates;
+    res.opens = r.opens;
+    for (uint16_t p : r.fb) res.checksum = res.checksum * 31 + p;
+    return res;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s nixie.tbi weather.tbi\n", argv[0]);
+        return 2;
+    }
+    tbi_t                nh, wh;
+    std::vector<uint8_t> nixie = load_tbi(argv[1], nh), weather = load_tbi(argv[2], wh);
+    if (nixie.empty() || weather.empty()) {
+        fprintf(stderr, "%s / %s: not a TRUE_COLOR_ALPHA .tbi\n", argv[1], argv[2]);
+        return 2;
+    }
+    // NIXIE_DIGIT_H, WEATHER_ICON_H
+    layout_t sepN = make_layout(nixie, nh, 100, true), sepW = make_layout(weather, wh, 96, true);
+    layout_t atlN = make_layout(nixie, nh, 100, false), atlW = make_layout(weather, wh, 96, false);
+
+    result_t best[2] = {};
+    for (int rep = 0; rep < 5; rep++) { // alternate, best of 5
+        for (int a = 0; a < 2; a++) {
+            result_t r = a ? run(atlN, atlW, 12) : run(sepN, sepW, 1);
+            if (rep == 0 || r.nixieUs < best[a].nixieUs) best[a].nixieUs = r.nixieUs;
+            if (rep == 0 || r.weatherUs < best[a].weatherUs) best[a].weatherUs = r.weatherUs;
+            best[a].opens = r.opens;
+            best[a].checksum = r.checksum;
+        }
+    }
+    const char* name[2] = {"separate, cache 1", "atlas, cache 12"};
+    for (int a = 0; a < 2; a++)
+        printf("%-18s %7.2f us per clock tick %8.2f us per weather update %7u image opens\n", name[a], best[a].nixieUs, best[a].weatherUs, best[a].opens);
+    if (best[0].checksum != best[1].checksum) {
+        printf("the layouts render different pixels\n");
+        return 1;
+    }
+    return 0;
+}
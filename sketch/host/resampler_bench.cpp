@@ -0,0 +1,144 @@
+/*
+ * resampler_bench.cpp
+ *
+ * resampler/resampler.cpp against the Catmull-Rom spline before it (resampler_catmull.cpp), both fed as
+ * Audio::resampleTo48kStereo() feeds them, in blocks of 1152 stereo frames (one MP3 frame):
+ *   THD+N     a -6 dBFS sine at 1 kHz and at 0.3 * the input rate, the 48 kHz output after the first 2048 frames
+ *             fitted by least squares at the tone frequency, everything else (harmonics, images, aliases, rounding)
+ *             against the tone; fails if the polyphase resampler is above -70 dB, or at 0.3 * the input rate, where the
+ *             spline lets its images through, not better than the spline (at 1 kHz from 32 kHz and up the spline is a
+ *             few dB better, the Q14 taps of the polyphase filter set its floor near -80 dB)
+ *   speed     ns per 48 kHz output frame on the build host, 10 s of 44.1 kHz, best of 5, not ESP32-S3 cycles
+ *   tables    time of setInputRate() building a phase table and switching to a cached one, as setSampleRate() does
+ *             at a track change; fails if the output after a switch back differs from a fresh resampler's
+ *
+ *   resampler_bench
+ *
+ */
+#include "resampler/resampler.h"
+#include <chrono>
+
+namespace catmull {
+struct state_t {
+    float   cursor = 0.0f;
+    int16_t inputHistory[6] = {};
+};
+size_t resampleTo48kStereo(state_t& s, uint32_t sampleRate, const int16_t* input, size_t inputSamples, int16_t* out);
+}
+
+static constexpr size_t   blockFrames = 1152;
+static constexpr size_t   skipFrames = 2048;  // filter delay and spline start
+static constexpr size_t   fitFrames = 48000;
+static constexpr uint32_t rates[] = {44100, 32000, 24000, 22050, 16000, 11025, 8000};
+
+static double usSince(std::chrono::steady_clock::time_point t) { return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t).count(); }
+
+static std::vector<int16_t> sine(uint32_t rate, double hz, size_t frames) {
+    std::vector<int16_t> pcm(frames * 2);
+    for (size_t i = 0; i < frames; i++) pcm[i * 2] = pcm[i * 2 + 1] = (int16_t)lrint(16384.0 * sin(2 * M_PI * hz * i / rate));
+    return pcm;
+}
+
+// the whole input through one resampler in MP3 sized blocks, interleaved 48 kHz stereo out
+template <typename F> static std::vector<int16_t> run(const std::vector<int16_t>& in, F block) {
+    std::vector<int16_t> out;
+    std::vector<int16_t> buf(blockFrames * 2 * 8);
+    for (size_t i = 0; i < in.size() / 2; i += blockFrames) {
+        size_t n = std::min(blockFrames, in.size() / 2 - i);
+        size_t o = block(&in[i * 2], n, buf.data());
+        out.insert(out.end(), buf.begin(), buf.begin() + o * 2);
+    }
+    return out;
+}
+
+// left channel, tone at hz fitted as a*cos + b*sin + c, residual energy against the tone's in dB
+static double thdn(const std::vector<int16_t>& out, double hz) {
+    if (out.size() / 2 < skipFrames + fitFrames) return 0;
+    double m[3][4] = {};
+    for (size_t i = 0; i < fitFrames; i++) {
+        double w = 2 * M_PI * hz * i / Resampler::OUT_RATE, v[3] = {cos(w), sin(w), 1}, y = out[(skipFrames + i) * 2];
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 3; c++) m[r][c] += v[r] * v[c];
+            m[r][3] += v[r] * y;
+        }
+    }
+    for (int p = 0; p < 3; p++) { // Gauss-Jordan, the system is well conditioned
+        for (int r = 0; r < 3; r++) {
+            if (r == p) continue;
+            double f = m[r][p] / m[p][p];
+            for (int c = p; c < 4; c++) m[r][c] -= f * m[p][c];
+        }
+    }
+    double a = m[0][3] / m[0][0], b = m[1][3] / m[1][1], dc = m[2][3] / m[2][2], sig = 0, res = 0;
+    for (size_t i = 0; i < fitFrames; i++) {
+        double w = 2 * M_PI * hz * i / Resampler::OUT_RATE, fit = a * cos(w) + b * sin(w);
+        double e = out[(skipFrames + i) * 2] - fit - dc;
+        sig += fit * fit;
+        res += e * e;
+    }
+    return 10 * log10(res / sig);
+}
+
+static std::vector<int16_t> polyphase(uint32_t rate, const std::vector<int16_t>& in) {
+    Resampler rs;
+    rs.setInputRate(rate);
+    return run(in, [&](const int16_t* p, size_t n, int16_t* o) { return rs.process(p, n, o, blockFrames * 8); });
+}
+
+static std::vector<int16_t> spline(uint32_t rate, const std::vector<int16_t>& in) {
+    catmull::state_t s;
+    return run(in, [&](const int16_t* p, size_t n, int16_t* o) { return catmull::resampleTo48kStereo(s, rate, p, n, o); });
+}
+
+template <typename F> static double nsPerFrame(F f, const std::vector<int16_t>& in) {
+    double best = 1e30;
+    for (int i = 0; i < 5; i++) {
+        auto   t = std::chrono::steady_clock::now();
+        size_t frames = f(in).size() / 2;
+        best = std::min(best, usSince(t) * 1000 / frames);
+    }
+    return best;
+}
+
+int main() {
+    bool ok = true;
+    printf("%-8s %9s %14s %14s\n", "rate", "tone Hz", "spline dB", "polyphase dB");
+    for (uint32_t rate : rates) {
+        for (double hz : {1000.0, 0.3 * rate}) {
+            bool high = hz > 1000;
+            std::vector<int16_t> in = sine(rate, hz, (size_t)(skipFrames + fitFrames + 4096) * rate / Resampler::OUT_RATE);
+            double               old = thdn(spline(rate, in), hz), now = thdn(polyphase(rate, in), hz);
+            bool                 good = now < -70 && (!high || now < old);
+            printf("%-8u %9.0f %14.1f %14.1f  %s\n", rate, hz, old, now, good ? "ok" : "FAILED");
+            ok &= good;
+        }
+    }
+
+    std::vector<int16_t> in = sine(44100, 1000, 441000);
+    double               old = nsPerFrame([](const std::vector<int16_t>& v) { return spline(44100, v); }, in);
+    double               now = nsPerFrame([](const std::vector<int16_t>& v) { return polyphase(44100, v); }, in);
+    printf("44.1 kHz -> 48 kHz, host ns per output frame: spline %.1f, polyphase %.1f\n", old, now);
+
+    Resampler rs;
+    double    buildUs = 0, switchUs = 0;
+    int       builds = 0, switches = 0;
+    for (int round = 0; round < 2; round++) { // round 0 builds the tables, round 1 finds them cached
+        for (uint32_t rate : {44100u, 48000u, 22050u, 32000u, 44100u}) {
+            auto t = std::chrono::steady_clock::now();
+            rs.setInputRate(rate);
+            double us = usSince(t);
+            if (rate == 48000) continue;
+            if (round == 0 && rate != 44100) buildUs += us, builds++;
+            if (round == 1) switchUs += us, switches++;
+        }
+    }
+    Resampler fresh;
+    fresh.setInputRate(44100);
+    auto bOut = run(in, [&](const int16_t* p, size_t n, int16_t* o) { return rs.process(p, n, o, blockFrames * 8); });
+    auto fOut = run(in, [&](const int16_t* p, size_t n, int16_t* o) { return fresh.process(p, n, o, blockFrames * 8); });
+    bool same = bOut == fOut;
+    printf("setInputRate(): table build %.1f us, switch to a cached table %.2f us; cached 44.1 kHz output %s\n", buildUs / builds, switchUs / switches,
+           same ? "as a fresh resampler's" : "DIFFERS");
+    ok &= same;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+/*
+ * resampler_catmull.cpp
+ *
+ * Audio::resampleTo48kStereo() before resampler/resampler.cpp, kept for the before / after numbers of resampler_bench:
+ * a float Catmull-Rom spline through the last 3 + the new frames, a std::vector per call, the clip lambda around
+ * every sample (its overflow log left out, the bench stays below full scale)
+ *
+ */
+#include <Arduino.h>
+
+namespace catmull {
+
+struct state_t {
+    float   cursor = 0.0f;       // Audio::m_resampleCursor
+    int16_t inputHistory[6] = {}; // Audio::m_inputHistory
+};
+
+size_t resampleTo48kStereo(state_t& s, uint32_t sampleRate, const int16_t* input, size_t inputSamples, int16_t* out) {
+
+    float ratio = static_cast<float>(sampleRate) / 48000.0f;
+    float cursor = s.cursor;
+
+    size_t extendedSamples = inputSamples + 3;
+
+    std::vector<int16_t> extendedInput(extendedSamples * 2);
+    memcpy(&extendedInput[0], s.inputHistory, 6 * sizeof(int16_t));
+    memcpy(&extendedInput[6], input, inputSamples * 2 * sizeof(int16_t));
+
+    size_t outputIndex = 0;
+
+    auto clipToInt16 = [](float value) -> int16_t {
+        if (value > 32767.0f) return 32767;
+        if (value < -32768.0f) return -32768;
+        return static_cast<int16_t>(value);
+    };
+
+    for (size_t inIdx = 1; inIdx < extendedSamples - 2; ++inIdx) {
+        int32_t xm1_l = clipToInt16(extendedInput[(inIdx - 1) * 2]);
+        int32_t x0_l = clipToInt16(extendedInput[(inIdx + 0) * 2]);
+        int32_t x1_l = clipToInt16(extendedInput[(inIdx + 1) * 2]);
+        int32_t x2_l = clipToInt16(extendedInput[(inIdx + 2) * 2]);
+
+        int32_t xm1_r = clipToInt16(extendedInput[(inIdx - 1) * 2 + 1]);
+        int32_t x0_r = clipToInt16(extendedInput[(inIdx + 0) * 2 + 1]);
+        int32_t x1_r = clipToInt16(extendedInput[(inIdx + 1) * 2 + 1]);
+        int32_t x2_r = clipToInt16(extendedInput[(inIdx + 2) * 2 + 1]);
+
+        while (cursor < 1.0f) {
+            float t = cursor;
+
+            auto catmullRom = [](float t, float xm1, float x0, float x1, float x2) {
+                return 0.5f * ((2.0f * x0) + (-xm1 + x1) * t + (2.0f * xm1 - 5.0f * x0 + 4.0f * x1 - x2) * t * t + (-xm1 + 3.0f * x0 - 3.0f * x1 + x2) * t * t * t);
+            };
+
+            int16_t outLeft = static_cast<int16_t>(catmullRom(t, xm1_l, x0_l, x1_l, x2_l));
+            int16_t outRight = static_cast<int16_t>(catmullRom(t, xm1_r, x0_r, x1_r, x2_r));
+
+            out[outputIndex * 2] = clipToInt16(outLeft);
+            out[outputIndex * 2 + 1] = clipToInt16(outRight);
+
+            ++outputIndex;
+            cursor += ratio;
+        }
+
+        cursor -= 1.0f;
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        size_t idx = inputSamples - 3 + i;
+        s.inputHistory[i * 2] = input[idx * 2];
+        s.inputHistory[i * 2 + 1] = input[idx * 2 + 1];
+    }
+    s.cursor = cursor;
+    return outputIndex;
+}
+
+} // namespace catmull
@@ -0,0 +1,279 @@
+/*
+ * seek_index_bench.cpp
+ *
+ * SeekIndex (seek_index/seek_index.cpp) on files of a MemFS card (mem_fs.h), its scan task on a thread of shim/freertos.cpp
+ *   MP3   10 minutes of VBR frames (the bitrate changes by sections, random payload with false syncs), once behind a
+ *         Xing frame with a TOC, once behind a VBRI frame, both also indexed without the TOC (frame header scan of the
+ *         whole file): card bytes read, scan time and the largest error of a seek to every second (posAt(), then the
+ *         next frame, as mp3_correctResumeFilePos() syncs). Fails if a point is not a frame start, if a TOC index reads
+ *         more than a quarter of the scan's bytes or its total differs from the scan's, or if a TOC seek is more than one
+ *         TOC entry (1 % of the duration) off or not 4 times closer than a seek by the average bitrate; a Xing TOC has
+ *         1/256 of the file as its step, a few seconds at 64 kbit/s, the scanned index is exact to the frame
+ *   FLAC  synth_flac() with the minimum frame size written to STREAMINFO, scanned with it and without (pos += 2 as
+ *         before), fails if the points differ
+ *   cache the Xing index built a second time comes from LittleFS, fails if its points differ
+ * the TOC points come from tocPoints(), a copy of the Xing/VBRI parsing in Audio::read_ID3_Header(); the times are
+ * those of the build host, not of the SD card
+ *
+ *   seek_index_bench
+ *
+ */
+#include "mem_fs.h"
+#include "seek_index/seek_index.h"
+#include <LittleFS.h>
+#include <chrono>
+#include <random>
+#include <set>
+#include <thread>
+
+std::vector<uint8_t> synth_flac(uint32_t blocks, uint32_t seed, std::vector<int16_t>* pcm = nullptr); // synth.cpp
+
+static constexpr uint32_t spf = 1152, rate = 44100;
+
+static const uint16_t kbps[16] = {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0};
+
+static uint32_t frameBytes(uint8_t brIdx) { return 144 * kbps[brIdx] * 1000 / rate; } // MPEG-1 layer III, 44.1 kHz, no padding
+
+static void putHeader(uint8_t* p, uint8_t brIdx) {
+    p[0] = 0xFF;
+    p[1] = 0xFB; // MPEG-1, layer III, no CRC
+    p[2] = brIdx << 4;
+    p[3] = 0x04; // stereo, original: the side info takes 32 bytes, the Xing or VBRI tag starts at 36
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = v >> (24 - 8 * i);
+}
+
+struct mp3_t {
+    std::vector<uint8_t>  data;   // audio data, the first frame is the Xing or VBRI frame
+    std::vector<uint32_t> starts; // frame starts in data, the tag frame is frame 0
+};
+
+static mp3_t vbrMp3(bool vbri, uint32_t frames, uint32_t seed) {
+    std::mt19937         rnd(seed);
+    std::vector<uint8_t> audio;
+    std::vector<uint32_t> starts;
+    uint8_t               base = 9;
+    for (uint32_t f = 0, section = 0; f < frames; f++) {
+        if (f == section) { // a new passage, 64 .. 320 kbit/s
+            base = 5 + rnd() % 10;
+            section += 200 + rnd() % 2000;
+        }
+        uint8_t  brIdx = std::min(14, std::max(1, base + (int)(rnd() % 3) - 1));
+        uint32_t n = frameBytes(brIdx);
+        starts.push_back(audio.size());
+        size_t at = audio.size();
+        audio.resize(at + n);
+        putHeader(&audio[at], brIdx);
+        for (uint32_t i = 4; i < n; i++) audio[at + i] = (uint8_t)rnd();
+    }
+
+    mp3_t m;
+    uint8_t tagIdx = 10; // 160 kbit/s, 522 bytes, room for a VBRI TOC of 100 entries
+    uint32_t tagLen = frameBytes(tagIdx), bytes = tagLen + audio.size();
+    m.data.assign(tagLen, 0);
+    putHeader(m.data.data(), tagIdx);
+    uint8_t* t = m.data.data() + 36;
+    if (!vbri) { // flags, frames, bytes, TOC of 100 entries, quality
+        memcpy(t, "Xing", 4);
+        put32(t + 4, 0x0F);
+        put32(t + 8, frames);
+        put32(t + 12, bytes);
+        for (int i = 0; i < 100; i++) t[16 + i] = std::min<uint64_t>(255, (uint64_t)(tagLen + starts[(uint64_t)i * frames / 100]) * 256 / bytes);
+    } else { // version, delay, quality, bytes, frames, entries, scale, entry size, frames per entry, TOC of entry sizes
+        uint16_t perEntry = (frames + 99) / 100, entries = (frames + perEntry - 1) / perEntry;
+        memcpy(t, "VBRI", 4);
+        t[5] = 1;
+        put32(t + 10, bytes);
+        put32(t + 14, frames);
+        t[18] = entries >> 8, t[19] = entries;
+        t[21] = 1;
+        t[23] = 4;
+        t[24] = perEntry >> 8, t[25] = perEntry;
+        for (uint32_t e = 0; e < entries; e++) {
+            uint32_t a = starts[e * perEntry], b = (e + 1) * perEntry < frames ? starts[(e + 1) * perEntry] : audio.size();
+            put32(t + 26 + e * 4, b - a);
+        }
+    }
+    m.starts.push_back(0);
+    for (uint32_t s : starts) m.starts.push_back(tagLen + s);
+    m.data.insert(m.data.end(), audio.begin(), audio.end());
+    return m;
+}
+
+static uint64_t be(const uint8_t* p, int n) {
+    uint64_t v = 0;
+    while (n--) v = (v << 8) | *p++;
+    return v;
+}
+
+// Audio::read_ID3_Header(): the table points of a Xing or VBRI TOC and the samples of the file, 0 = no TOC
+static uint32_t tocPoints(const uint8_t* data, size_t len, SeekIndex& idx) {
+    uint32_t total = 0;
+    if ((!memcmp(data + 36, "Xing", 4) || !memcmp(data + 36, "Info", 4)) && (be(data + 40, 4) & 0x07) == 0x07 && 36 + 116 <= len) {
+        uint32_t frames = be(data + 44, 4), bytes = be(data + 48, 4);
+        for (int i = 0; i < 100; i++) idx.addTablePoint(i ? spf + (uint64_t)frames * spf * i / 100 : 0, (uint64_t)data[36 + 16 + i] * bytes / 256);
+        total = (frames + 1) * spf;
+    } else if (len >= 62 && !memcmp(data + 36, "VBRI", 4)) {
+        uint32_t bytes = be(data + 46, 4), frames = be(data + 50, 4);
+        uint16_t entries = be(data + 54, 2), scale = be(data + 56, 2), entrySize = be(data + 58, 2), perEntry = be(data + 60, 2);
+        uint32_t frameLen = 0, s, r;
+        if (entrySize >= 1 && entrySize <= 4 && 62 + (size_t)entries * entrySize <= len) frameLen = SeekIndex::mp3FrameLen(data, &s, &r);
+        if (frameLen) {
+            uint64_t pos = frameLen, sample = spf;
+            uint16_t step = entries / SeekIndex::MAX_TABLE_POINTS + 1;
+            idx.addTablePoint(0, 0); // the VBRI frame
+            for (uint16_t i = 0; i < entries && pos < bytes; i++) {
+                if (i % step == 0) idx.addTablePoint(sample, pos);
+                pos += be(data + 62 + i * entrySize, entrySize) * scale;
+                sample += (uint64_t)perEntry * spf;
+            }
+            total = (frames + 1) * spf;
+        }
+    }
+    return total;
+}
+
+struct scan_t {
+    bool                            complete;
+    double                          ms;
+    uint64_t                        bytes;
+    uint32_t                        total;
+    std::vector<SeekIndex::point_t> points;
+};
+
+// builds, waits for the scan, lists the points by a lookup at every step samples
+static scan_t scan(SeekIndex& idx, MemFS& card, SeekIndex::kind_t kind, uint32_t dataStart, uint32_t dataSize, uint32_t step, uint32_t p1, uint32_t p2,
+                   uint32_t p3) {
+    scan_t   s = {};
+    uint64_t b0 = card.stats.readBytes;
+    auto     t = std::chrono::steady_clock::now();
+    idx.build(kind, dataStart, dataSize, rate, p1, p2, p3);
+    for (int i = 0; i < 20000 && !idx.isComplete(); i++) std::this_thread::sleep_for(std::chrono::microseconds(100));
+    s.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+    s.complete = idx.isComplete();
+    s.bytes = card.stats.readBytes - b0;
+    s.total = idx.getTotalSamples();
+    SeekIndex::point_t p;
+    for (uint64_t smp = 0; smp < s.total; smp += step) {
+        if (idx.lookup(smp, p) && (s.points.empty() || s.points.back().pos != p.pos)) s.points.push_back(p);
+    }
+    return s;
+}
+
+static std::shared_ptr<MemFS> card = std::make_shared<MemFS>(true);
+static fs::FS                 sd(card);
+
+static void writeFile(const char* path, const std::vector<uint8_t>& data) {
+    File f = sd.open(path, FILE_WRITE);
+    f.write(data.data(), data.size());
+    f.close();
+}
+
+static bool mp3Case(bool vbri) {
+    const char* path = vbri ? "/vbri.mp3" : "/xing.mp3";
+    mp3_t       m = vbrMp3(vbri, 600 * rate / spf, vbri ? 2 : 1);
+    writeFile(path, m.data);
+    uint32_t size = m.data.size();
+
+    SeekIndex full, toc;
+    full.open(sd, path, size);
+    scan_t f = scan(full, *card, SeekIndex::SIDX_MP3, 0, size, spf, 0, 0, 0);
+    toc.open(sd, path, size);
+    uint32_t total = tocPoints(m.data.data(), m.data.size(), toc);
+    scan_t   t = scan(toc, *card, SeekIndex::SIDX_MP3, 0, size, spf, 0, total, 0);
+
+    // frame k starts at m.starts[k] and holds samples k * spf ..
+    auto frameAt = [&](uint32_t pos) { return (uint32_t)(std::lower_bound(m.starts.begin(), m.starts.end(), pos) - m.starts.begin()); };
+    bool framesOk = true;
+    for (const scan_t* s : {&f, &t}) {
+        for (const SeekIndex::point_t& p : s->points) {
+            uint32_t k = frameAt(p.pos);
+            framesOk &= k < m.starts.size() && m.starts[k] == p.pos && (s == &t || p.sample == k * spf);
+        }
+    }
+    double tocErr = 0, rateErr = 0;
+    for (uint32_t sec = 0; sec < 600; sec++) {
+        uint32_t target = sec * rate, pos = 0;
+        bool     found = toc.isSparse() && toc.posAt(target, pos);
+        framesOk &= found;
+        tocErr = std::max(tocErr, fabs((double)frameAt(pos) * spf - target) / rate);
+        pos = (uint64_t)target * size / f.total; // average bitrate, without index and TOC
+        rateErr = std::max(rateErr, fabs((double)frameAt(pos) * spf - target) / rate);
+    }
+    bool ok = f.complete && t.complete && framesOk && f.total == m.starts.size() * spf && t.total == f.total && t.bytes * 4 < f.bytes && tocErr < 6 && tocErr * 4 < rateErr;
+    printf("%-5s %-9s %8.1f %10llu %7zu %9s\n", vbri ? "VBRI" : "Xing", "scan", f.ms, (unsigned long long)f.bytes, f.points.size(), "");
+    printf("%-5s %-9s %8.1f %10llu %7zu %9.3f   average bitrate %.3f s  %s\n", "", "TOC", t.ms, (unsigned long long)t.bytes, t.points.size(), tocErr, rateErr,
+           ok ? "ok" : "FAILED");
+    return ok;
+}
+
+static bool samePoints(const std::vector<SeekIndex::point_t>& a, const std::vector<SeekIndex::point_t>& b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](auto& x, auto& y) { return x.sample == y.sample && x.pos == y.pos; });
+}
+
+static bool flacCase() {
+    constexpr uint32_t   blocks = 2000, bs = 4096, dataStart = 42; // fLaC, STREAMINFO
+    std::vector<uint8_t> file = synth_flac(blocks, 3);
+    std::vector<uint32_t> starts; // byte by byte, as the scan before the minimum frame size
+    uint32_t              sample, blk, r, expect = 0;
+    for (size_t i = dataStart; i + 6 <= file.size(); i++) {
+        if (file[i] == 0xFF && SeekIndex::flacFrameHeader(&file[i], file.size() - i, bs, &sample, &blk, &r) && sample == expect) {
+            starts.push_back(i - dataStart);
+            expect += blk;
+        }
+    }
+    uint32_t dataSize = file.size() - dataStart, minFrame = UINT32_MAX, maxFrame = 0;
+    for (size_t k = 0; k < starts.size(); k++) {
+        uint32_t n = (k + 1 < starts.size() ? starts[k + 1] : dataSize) - starts[k];
+        minFrame = std::min(minFrame, n);
+        maxFrame = std::max(maxFrame, n);
+    }
+    for (int i = 0; i < 3; i++) { // synth_flac() leaves them 0, an encoder writes them
+        file[12 + i] = minFrame >> (16 - 8 * i);
+        file[15 + i] = maxFrame >> (16 - 8 * i);
+    }
+    writeFile("/synth.flac", file);
+
+    SeekIndex before, now;
+    before.open(sd, "/synth.flac", file.size());
+    scan_t b = scan(before, *card, SeekIndex::SIDX_FLAC, dataStart, dataSize, bs, bs, blocks * bs, 0);
+    now.open(sd, "/synth.flac", file.size());
+    scan_t n = scan(now, *card, SeekIndex::SIDX_FLAC, dataStart, dataSize, bs, bs, blocks * bs, minFrame);
+    bool   framesOk = starts.size() == blocks && !n.points.empty();
+    for (const SeekIndex::point_t& p : n.points) framesOk &= std::binary_search(starts.begin(), starts.end(), p.pos);
+    bool ok = b.complete && n.complete && framesOk && samePoints(b.points, n.points) && n.total == b.total;
+    printf("%-5s %-9s %8.1f %10llu %7zu\n", "FLAC", "pos += 2", b.ms, (unsigned long long)b.bytes, b.points.size());
+    printf("%-5s %-9s %8.1f %10llu %7zu %9s   minimum frame size %u bytes  %s\n", "", "min frame", n.ms, (unsigned long long)n.bytes, n.points.size(), "",
+           minFrame, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+static bool cacheCase() {
+    std::vector<uint8_t> file(card->find("/xing.mp3")->data);
+    scan_t               s[2];
+    bool                 fromCache = false, sparse = false;
+    for (int i = 0; i < 2; i++) { // as Audio: open(), the TOC of the header, build()
+        SeekIndex idx;
+        idx.setCache(LittleFS, SEEK_INDEX_DIR);
+        idx.open(sd, "/xing.mp3", file.size());
+        uint32_t total = tocPoints(file.data(), file.size(), idx);
+        s[i] = scan(idx, *card, SeekIndex::SIDX_MP3, 0, file.size(), spf, 0, total, 0);
+        fromCache = idx.getInfo().fromCache;
+        sparse = idx.isSparse();
+    } // close() waits for the scan task, which writes the cache
+    bool ok = s[0].complete && fromCache && sparse && samePoints(s[0].points, s[1].points) && s[0].total == s[1].total;
+    printf("cache: the second Xing index %s LittleFS, %zu points  %s\n", fromCache ? "from" : "NOT from", s[1].points.size(), ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main() {
+    bool ok = true;
+    printf("%-5s %-9s %8s %10s %7s %9s\n", "file", "index", "host ms", "card bytes", "points", "seek s");
+    ok &= mp3Case(false);
+    ok &= mp3Case(true);
+    ok &= flacCase();
+    ok &= cacheCase();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+/*
+ * Arduino.h - host shim
+ *
+ * just enough of the Arduino-ESP32 core for the audio decoders and psram_unique_ptr.hpp on Linux,
+ * PSRAM is plain heap, the log macros go to stderr
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <malloc.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "esp_heap_caps.h" // heap_caps_*() come with Arduino.h on the device
+#include "freertos.h"      // as are the FreeRTOS calls
+
+#ifndef CORE_DEBUG_LEVEL
+    #define CORE_DEBUG_LEVEL 2 // warn
+#endif
+
+using std::max; // as the Arduino-ESP32 core
+using std::min;
+
+#define IRAM_ATTR
+#define PI 3.1415926535897932384626433832795
+#define PROGMEM
+#define __unused __attribute__((unused))
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+typedef bool boolean;
+
+typedef int portMUX_TYPE; // single threaded
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) (void)(mux)
+#define portEXIT_CRITICAL(mux)  (void)(mux)
+
+inline bool  psramFound() { return true; }
+inline void* ps_malloc(size_t size) { return malloc(size); }
+inline void* ps_calloc(size_t n, size_t size) { return calloc(n, size); }
+inline void* ps_realloc(void* p, size_t size) { return realloc(p, size); }
+
+uint32_t millis();
+uint32_t micros();
+void     delay(uint32_t ms);
+
+class String { // the part of WString the app code on the host uses
+  public:
+    String(const char* s = "") : m_s(s) {}
+    String(std::string s) : m_s(std::move(s)) {}
+    size_t      length() const { return m_s.size(); }
+    const char* c_str() const { return m_s.c_str(); }
+
+  private:
+    std::string m_s;
+};
+
+#define log_e(fmt, ...) do { if (CORE_DEBUG_LEVEL >= 1) fprintf(stderr, "E " fmt "\n", ##__VA_ARGS__); } while (0)
+#define log_w(fmt, ...) do { if (CORE_DEBUG_LEVEL >= 2) fprintf(stderr, "W " fmt "\n", ##__VA_ARGS__); } while (0)
+#define log_i(fmt, ...) do { if (CORE_DEBUG_LEVEL >= 3) fprintf(stderr, "I " fmt "\n", ##__VA_ARGS__); } while (0)
+#define log_d(fmt, ...) do { if (CORE_DEBUG_LEVEL >= 4) fprintf(stderr, "D " fmt "\n", ##__VA_ARGS__); } while (0)
+#define log_v(fmt, ...) do { if (CORE_DEBUG_LEVEL >= 5) fprintf(stderr, "V " fmt "\n", ##__VA_ARGS__); } while (0)
+
+inline char* ltoa(long value, char* buf, int base) {
+    char* p = buf;
+    unsigned long v = value < 0 && base == 10 ? -(unsigned long)value : (unsigned long)value;
+    if (value < 0 && base == 10) *p++ = '-';
+    char* start = p;
+    do {
+        int d = v % base;
+        *p++ = d < 10 ? '0' + d : 'a' + d - 10;
+        v /= base;
+    } while (v);
+    *p = 0;
+    std::reverse(start, p);
+    return buf;
+}
+
+#if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t len = strlen(src);
+    if (size) {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = 0;
+    }
+    return len;
+}
+#endif
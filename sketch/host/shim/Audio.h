@@ -0,0 +1,73 @@
+/*
+ * Audio.h - host shim
+ *
+ * stands in for ESP32-audioI2S-master/Audio.h when the decoders are built on Linux (see ../CMakeLists.txt),
+ * the decoders only need the Decoder interface and the log function of class Audio
+ *
+ */
+#pragma once
+#pragma GCC optimize("Ofast") // as the real Audio.h, the decoders are built with it on the device
+
+#include "psram_unique_ptr.hpp"
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_cpu.h>
+#include <esp_heap_caps.h>
+#include <memory>
+#include <vector>
+
+class Audio {
+  public:
+    static inline uint8_t logLevel = CORE_DEBUG_LEVEL; // 1 error ... 4 debug
+
+    template <typename... Args> static void AUDIO_LOG_IMPL(uint8_t level, const char* path, int line, const char* fmt, Args&&... args) {
+        if (level > logLevel) return;
+        const char* file = strrchr(path, '/');
+        static const char* tag[6] = {"", "E", "W", "I", "D", "V"};
+        fprintf(stderr, "%s %s:%i ", tag[level < 6 ? level : 5], file ? file + 1 : path, line);
+        if constexpr (sizeof...(args) == 0) {
+            fputs(fmt, stderr);
+        } else {
+            fprintf(stderr, fmt, std::forward<Args>(args)...);
+        }
+        fputc('\n', stderr);
+    }
+};
+
+#define AUDIO_LOG_ERROR(fmt, ...) Audio::AUDIO_LOG_IMPL(1, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+#define AUDIO_LOG_WARN(fmt, ...)  Audio::AUDIO_LOG_IMPL(2, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+#define AUDIO_LOG_INFO(fmt, ...)  Audio::AUDIO_LOG_IMPL(3, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+#define AUDIO_LOG_DEBUG(fmt, ...) Audio::AUDIO_LOG_IMPL(4, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+
+class Decoder { // same interface as in Audio.h
+  public:
+    virtual ~Decoder() = default;
+    virtual bool                  init() = 0;
+    virtual void                  clear() = 0;
+    virtual void                  reset() = 0;
+    virtual bool                  isValid() = 0;
+    virtual int32_t               findSyncWord(uint8_t* buf, int32_t nBytes) = 0;
+    virtual uint8_t               getChannels() = 0;
+    virtual uint32_t              getSampleRate() = 0;
+    virtual uint8_t               getBitsPerSample() = 0;
+    virtual uint32_t              getBitRate() = 0;
+    virtual uint32_t              getAudioDataStart() = 0;
+    virtual uint32_t              getAudioFileDuration() = 0;
+    virtual uint32_t              getOutputSamples() = 0;
+    virtual int32_t               decode(uint8_t* inbuf, int32_t* bytesLeft, int16_t* outbuf) = 0;
+    virtual void                  setRawBlockParams(uint8_t param1, uint32_t param2, uint8_t param3, uint32_t param4, uint32_t param5) = 0;
+    virtual const char*           getStreamTitle() { return nullptr; }
+    virtual const char*           whoIsIt() { return ""; }
+    virtual std::vector<uint32_t> getMetadataBlockPicture() = 0;
+    virtual const char*           arg1() = 0;
+    virtual const char*           arg2() = 0;
+    virtual int32_t               val1() = 0;
+    virtual int32_t               val2() = 0;
+
+  protected:
+    Decoder(Audio& audioRef) : audio(audioRef) {}
+    Audio& audio;
+
+  private:
+    Decoder() = delete;
+};
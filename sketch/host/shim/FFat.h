@@ -0,0 +1,4 @@
+#pragma once // host shim, FFat is an in-memory file system, see ../mem_fs.h
+#include "FS.h"
+
+extern fs::FS FFat;
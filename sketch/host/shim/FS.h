@@ -0,0 +1,124 @@
+/*
+ * FS.h - host shim
+ *
+ * the fs::FS / fs::File API of the Arduino-ESP32 core as src/file/playlist.cpp uses it,
+ * implemented by the in-memory file system of ../mem_fs.h
+ *
+ */
+#pragma once
+
+#include "Arduino.h"
+#include <memory>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class FileImpl;
+typedef std::shared_ptr<FileImpl> FileImplPtr;
+
+class FileImpl {
+  public:
+    virtual ~FileImpl() = default;
+    virtual size_t      write(const uint8_t* buf, size_t size) = 0;
+    virtual size_t      read(uint8_t* buf, size_t size) = 0;
+    virtual bool        seek(uint32_t pos, SeekMode mode) = 0;
+    virtual size_t      position() const = 0;
+    virtual size_t      size() const = 0;
+    virtual void        close() = 0;
+    virtual const char* name() const = 0; // full path, as path() of the core
+    virtual time_t      getLastWrite() { return 0; }
+    virtual bool        isDirectory() = 0;
+    virtual FileImplPtr openNextFile(const char* mode) = 0;
+    virtual String      getNextFileName(bool* isDir) = 0;
+    virtual void        rewindDirectory() = 0;
+    virtual             operator bool() = 0;
+};
+
+class File {
+  public:
+    File(FileImplPtr p = FileImplPtr()) : _p(p) {}
+
+    operator bool() const { return _p && *_p; }
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t size) { return _p ? _p->write(buf, size) : 0; }
+    size_t println(const char* s) { return write((const uint8_t*)s, strlen(s)) + write((const uint8_t*)"\r\n", 2); } // Print::println()
+    int    available() { return _p ? (int)(_p->size() - _p->position()) : 0; }
+    int    read() {
+        uint8_t c;
+        return read(&c, 1) == 1 ? c : -1;
+    }
+    size_t read(uint8_t* buf, size_t size) { return _p ? _p->read(buf, size) : 0; }
+    int    peek() { // as the core: read, then seek back
+        if (!_p) return -1;
+        size_t pos = _p->position();
+        int    c = read();
+        _p->seek(pos, SeekSet);
+        return c;
+    }
+    size_t readBytesUntil(char terminator, char* buffer, size_t length) { // Stream: the terminator is consumed, not stored
+        size_t n = 0;
+        while (n < length) {
+            int c = read();
+            if (c < 0 || c == terminator) break;
+            buffer[n++] = (char)c;
+        }
+        return n;
+    }
+    bool        seek(uint32_t pos, SeekMode mode = SeekSet) { return _p && _p->seek(pos, mode); }
+    size_t      position() const { return _p ? _p->position() : 0; }
+    size_t      size() const { return _p ? _p->size() : 0; }
+    void        close() {
+        if (_p) _p->close();
+        _p = nullptr;
+    }
+    const char* name() const { return _p ? _p->name() : ""; }
+    const char* path() const { return name(); }
+    time_t      getLastWrite() { return _p ? _p->getLastWrite() : 0; }
+    bool        isDirectory() { return _p && _p->isDirectory(); }
+    File        openNextFile(const char* mode = FILE_READ) { return _p ? File(_p->openNextFile(mode)) : File(); }
+    String      getNextFileName(bool* isDir = nullptr) { return _p ? _p->getNextFileName(isDir) : String(); }
+    void        rewindDirectory() {
+        if (_p) _p->rewindDirectory();
+    }
+
+  protected:
+    FileImplPtr _p;
+};
+
+class FSImpl {
+  public:
+    virtual ~FSImpl() = default;
+    virtual FileImplPtr open(const char* path, const char* mode, bool create) = 0;
+    virtual bool        exists(const char* path) = 0;
+    virtual bool        rename(const char* pathFrom, const char* pathTo) = 0;
+    virtual bool        remove(const char* path) = 0;
+    virtual bool        mkdir(const char* path) = 0;
+};
+
+class FS {
+  public:
+    FS(std::shared_ptr<FSImpl> impl) : _impl(impl) {}
+
+    File open(const char* path, const char* mode = FILE_READ, bool create = false) { return File(_impl->open(path, mode, create)); }
+    bool exists(const char* path) { return _impl->exists(path); }
+    bool rename(const char* pathFrom, const char* pathTo) { return _impl->rename(pathFrom, pathTo); }
+    bool remove(const char* path) { return _impl->remove(path); }
+    bool mkdir(const char* path) { return _impl->mkdir(path); }
+
+  protected:
+    std::shared_ptr<FSImpl> _impl;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
@@ -0,0 +1,74 @@
+/*
+ * NetworkClient.h - host shim
+ *
+ * the part of the Arduino-ESP32 NetworkClient the network prefetch uses, on a POSIX TCP socket, non blocking reads
+ * as lwIP behind NetworkClient::read(); hostReadStallMs holds every read() that long first, a TLS read that blocks
+ *
+ */
+#pragma once
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+class NetworkClient {
+  public:
+    std::atomic<uint32_t> hostReadStallMs{0};
+    std::atomic<int>      hostReadsStalled{0}; // reads inside the stall right now
+
+    NetworkClient() = default;
+    ~NetworkClient() { stop(); }
+
+    int connect(const char* ip, uint16_t port) {
+        stop();
+        m_fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in a = {};
+        a.sin_family = AF_INET;
+        a.sin_port = htons(port);
+        inet_pton(AF_INET, ip, &a.sin_addr);
+        if (m_fd < 0 || ::connect(m_fd, (sockaddr*)&a, sizeof(a)) < 0) {
+            stop();
+            return 0;
+        }
+        return 1;
+    }
+    void stop() {
+        if (m_fd >= 0) close(m_fd);
+        m_fd = -1;
+    }
+    int available() {
+        int n = 0;
+        if (m_fd < 0 || ioctl(m_fd, FIONREAD, &n) < 0) return 0;
+        return n;
+    }
+    uint8_t connected() {
+        if (m_fd < 0) return false;
+        uint8_t c;
+        ssize_t r = recv(m_fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+        return r > 0 || (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+    }
+    int read(uint8_t* buf, size_t size) {
+        if (uint32_t ms = hostReadStallMs) {
+            hostReadsStalled++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+            hostReadsStalled--;
+        }
+        if (m_fd < 0) return -1;
+        ssize_t r = recv(m_fd, buf, size, MSG_DONTWAIT);
+        return r < 0 ? -1 : (int)r;
+    }
+    int read() {
+        uint8_t c;
+        return read(&c, 1) == 1 ? c : -1;
+    }
+
+  private:
+    int m_fd = -1;
+};
@@ -0,0 +1,4 @@
+#pragma once // host shim, SD_MMC is an in-memory file system, see ../mem_fs.h
+#include "FS.h"
+
+extern fs::FS SD_MMC;
@@ -0,0 +1,3 @@
+#pragma once // host shim, no IRAM/DRAM on Linux
+#define IRAM_ATTR
+#define DRAM_ATTR
@@ -0,0 +1,10 @@
+#pragma once // host shim
+#include <cstdint>
+#include <time.h>
+
+inline uint32_t esp_cpu_get_cycle_count() { // nanoseconds stand in for cycles, see getCpuFrequencyMhz()
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+inline uint32_t getCpuFrequencyMhz() { return 1000; }
@@ -0,0 +1,12 @@
+#pragma once // host shim, one heap
+#include <cstdlib>
+#include <malloc.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void*  heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+inline void   heap_caps_free(void* p) { free(p); }
+inline size_t heap_caps_get_free_size(uint32_t) { return 512 * 1024; }
+inline size_t heap_caps_get_allocated_size(void* p) { return malloc_usable_size(p); }
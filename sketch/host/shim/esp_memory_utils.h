@@ -0,0 +1,3 @@
+#pragma once // host shim, ps_malloc() is the PSRAM of the host build
+
+inline bool esp_ptr_external_ram(const void*) { return true; }
@@ -0,0 +1,103 @@
+// host shim, FreeRTOS tasks, notifications and mutexes on std::thread, see freertos.h
+#include "freertos.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct host_task_t {
+    std::thread             thread;
+    std::mutex              m;
+    std::condition_variable cv;
+    uint32_t                notified = 0;
+    bool                    deleted = false;
+};
+
+struct host_semaphore_t { // not std::timed_mutex, ThreadSanitizer does not see its timed lock
+    std::mutex              m;
+    std::condition_variable cv;
+    bool                    taken = false;
+};
+
+struct host_task_deleted_t {}; // thrown out of ulTaskNotifyTake() by vTaskDelete()
+
+static thread_local host_task_t* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* param, UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+    host_task_t*                t = new host_task_t;
+    std::lock_guard<std::mutex> lock(t->m); // the task waits for t->thread, vTaskDelete(NULL) detaches it
+    if (handle) *handle = t;                // before the task runs, as on the device
+    t->thread = std::thread([t, fn, param]() {
+        { std::lock_guard<std::mutex> started(t->m); }
+        currentTask = t;
+        try {
+            fn(param);
+        } catch (host_task_deleted_t&) {}
+    });
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t t) {
+    if (!t) { // the task itself, nobody joins it
+        currentTask->thread.detach();
+        delete currentTask;
+        currentTask = nullptr;
+        throw host_task_deleted_t{};
+    }
+    {
+        std::lock_guard<std::mutex> lock(t->m);
+        t->deleted = true;
+    }
+    t->cv.notify_one();
+    t->thread.join();
+    delete t;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t t) {
+    {
+        std::lock_guard<std::mutex> lock(t->m);
+        t->notified++;
+    }
+    t->cv.notify_one();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    host_task_t*                 t = currentTask;
+    std::unique_lock<std::mutex> lock(t->m);
+    auto                         ready = [t]() { return t->notified || t->deleted; };
+    if (ticks == portMAX_DELAY) t->cv.wait(lock, ready);
+    else t->cv.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+    if (t->deleted) throw host_task_deleted_t{};
+    uint32_t n = t->notified;
+    if (n) t->notified = clearOnExit ? 0 : n - 1;
+    return n;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new host_semaphore_t; }
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    host_semaphore_t* s = new host_semaphore_t;
+    s->taken = true;
+    return s;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(s->m);
+    auto                         free = [s]() { return !s->taken; };
+    if (ticks == portMAX_DELAY) s->cv.wait(lock, free);
+    else if (!s->cv.wait_for(lock, std::chrono::milliseconds(ticks), free)) return pdFALSE;
+    s->taken = true;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+    {
+        std::lock_guard<std::mutex> lock(s->m);
+        s->taken = false;
+    }
+    s->cv.notify_one();
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
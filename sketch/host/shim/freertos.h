@@ -0,0 +1,42 @@
+/*
+ * freertos.h - host shim
+ *
+ * the FreeRTOS calls of the library's own tasks on std::thread: task notifications, mutexes with a timeout,
+ * one tick is one millisecond as configTICK_RATE_HZ 1000 on the device. shim/freertos.cpp is linked only into the
+ * tests that start a task, vTaskDelay() stays a no-op for the single threaded decoder harness
+ * vTaskDelete() ends the task at its next ulTaskNotifyTake() and joins it, the library deletes parked tasks only;
+ * vTaskDelete(NULL) of a task that ends itself detaches its thread
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  pdTRUE
+#define portMAX_DELAY   ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7fffffff
+
+typedef void (*TaskFunction_t)(void*);
+typedef struct host_task_t*      TaskHandle_t;
+typedef struct host_semaphore_t* SemaphoreHandle_t;
+
+inline void vTaskDelay(TickType_t) {} // single threaded, nothing to yield to
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* param, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core);
+void       vTaskDelete(TaskHandle_t task);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t   ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary(); // empty, the first take waits for a give
+BaseType_t        xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t        xSemaphoreGive(SemaphoreHandle_t sem);
+void              vSemaphoreDelete(SemaphoreHandle_t sem);
@@ -0,0 +1,10 @@
+// host shim, Arduino time functions
+#include "Arduino.h"
+#include <chrono>
+#include <thread>
+
+static const auto t0 = std::chrono::steady_clock::now();
+
+uint32_t millis() { return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - t0).count(); }
+uint32_t micros() { return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count(); }
+void     delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
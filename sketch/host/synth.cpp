@@ -0,0 +1,312 @@
+/*
+ * synth.cpp
+ *
+ * synthetic test streams, there is no encoder on the build host:
+ *   MP3  - MPEG-1 layer III frames with valid headers and side info, random main data, long and short blocks, ms/intensity stereo
+ *   FLAC - a small lossless encoder (LPC, FIXED, mid/side, partitioned rice), the decoded PCM must equal its input
+ *   Opus - Ogg Opus with CELT-only packets of random payload
+ *
+ */
+#include "decoder_host.h"
+#include <cmath>
+#include <random>
+
+class BitWriter {
+  public:
+    std::vector<uint8_t> buf;
+    void put(uint32_t value, uint8_t bits) {
+        for (int i = bits - 1; i >= 0; i--) {
+            if (m_bit == 0) buf.push_back(0);
+            if ((value >> i) & 1) buf.back() |= 0x80 >> m_bit;
+            m_bit = (m_bit + 1) & 7;
+        }
+    }
+    void putSigned(int32_t value, uint8_t bits) { put((uint32_t)value & ((bits < 32 ? 1u << bits : 0) - 1), bits); }
+    void align() { m_bit = 0; }
+
+  private:
+    uint8_t m_bit = 0;
+};
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// MP3, 44.1 kHz, 128 kbit/s, no CRC, main_data_begin 0 (no bit reservoir)
+
+std::vector<uint8_t> synth_mp3(uint32_t frames, uint32_t seed, bool shortBlocks) {
+    static const uint8_t tables[] = {1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18, 24, 25}; // linbits <= 5
+    std::mt19937         rnd(seed);
+    auto                 r = [&](uint32_t n) { return (uint32_t)(rnd() % n); };
+    std::vector<uint8_t> out;
+    uint32_t             rest = 0;
+
+    for (uint32_t f = 0; f < frames; f++) {
+        rest += 144 * 128000 % 44100;
+        uint8_t pad = rest >= 44100;
+        if (pad) rest -= 44100;
+        size_t   frameSize = 144 * 128000 / 44100 + pad;
+        uint8_t  mode = r(2);               // 0 stereo, 1 joint stereo
+        uint8_t  modeExt = mode ? r(4) : 0; // ms and/or intensity
+        uint32_t part23 = (frameSize - 4 - 32) * 8 / 4;
+
+        BitWriter bw;
+        bw.put(0xFFFB, 16);           // sync, MPEG-1, layer III, no CRC
+        bw.put(9, 4);                 // 128 kbit/s
+        bw.put(0, 2);                 // 44.1 kHz
+        bw.put(pad, 1);
+        bw.put(0, 1);                 // private
+        bw.put(mode, 2);
+        bw.put(modeExt, 2);
+        bw.put(0b0100, 4);            // copyright, original, emphasis
+        bw.put(0, 9);                 // main_data_begin
+        bw.put(0, 3);                 // private bits
+        bw.put(0, 8);                 // scfsi
+        for (int gr = 0; gr < 2; gr++) {
+            for (int ch = 0; ch < 2; ch++) {
+                bw.put(part23, 12);
+                bw.put(r(40), 9);         // big_values, few enough that the pairs end inside part2_3_length
+                bw.put(130 + r(40), 8);   // global_gain
+                bw.put(r(16), 4);         // scalefac_compress
+                bool ws = shortBlocks && r(4) == 0;
+                bw.put(ws, 1);
+                if (ws) {
+                    bw.put(1 + r(3), 2);  // block_type 1..3
+                    bw.put(0, 1);         // mixed_block_flag
+                    for (int i = 0; i < 2; i++) bw.put(tables[r(sizeof(tables))], 5);
+                    for (int i = 0; i < 3; i++) bw.put(r(4), 3); // subblock_gain
+                } else {
+                    for (int i = 0; i < 3; i++) bw.put(tables[r(sizeof(tables))], 5);
+                    bw.put(r(8), 4);      // region0_count
+                    bw.put(r(8), 3);      // region1_count
+                }
+                bw.put(r(2), 1);          // preflag
+                bw.put(r(2), 1);          // scalefac_scale
+                bw.put(r(2), 1);          // count1table_select
+            }
+        }
+        std::vector<uint8_t>& b = bw.buf;
+        while (b.size() < frameSize) b.push_back((uint8_t)rnd());
+        out.insert(out.end(), b.begin(), b.end());
+    }
+    return out;
+}
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// FLAC, 44.1 kHz, 16 bit, stereo, 4096 samples per block
+
+static uint8_t crc8(const uint8_t* p, size_t n) {
+    uint8_t crc = 0;
+    while (n--) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; i++) crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+    return crc;
+}
+
+static uint16_t crc16(const uint8_t* p, size_t n) {
+    uint16_t crc = 0;
+    while (n--) {
+        crc ^= *p++ << 8;
+        for (int i = 0; i < 8; i++) crc = crc & 0x8000 ? (crc << 1) ^ 0x8005 : crc << 1;
+    }
+    return crc;
+}
+
+static void putResiduals(BitWriter& bw, const std::vector<int32_t>& res, uint8_t order) {
+    const uint8_t partOrder = 2;
+    size_t        partSize = res.size() >> partOrder;
+    bw.put(0, 2); // 4 bit rice parameter
+    bw.put(partOrder, 4);
+    for (size_t p = 0; p < (1u << partOrder); p++) {
+        size_t   start = p * partSize + (p == 0 ? order : 0), end = (p + 1) * partSize;
+        uint64_t sum = 0;
+        for (size_t i = start; i < end; i++) sum += ((uint32_t)res[i] << 1) ^ (uint32_t)(res[i] >> 31);
+        uint8_t k = 0;
+        while (k < 14 && ((uint64_t)(end - start) << (k + 1)) < sum) k++;
+        bw.put(k, 4);
+        for (size_t i = start; i < end; i++) {
+            uint32_t u = ((uint32_t)res[i] << 1) ^ (uint32_t)(res[i] >> 31);
+            for (uint32_t q = u >> k; q; q--) bw.put(0, 1);
+            bw.put(1, 1);
+            if (k) bw.put(u & ((1u << k) - 1), k);
+        }
+    }
+}
+
+static void putFixed(BitWriter& bw, const std::vector<int32_t>& x, uint8_t bps) { // SUBFRAME_FIXED, order 2
+    bw.put(0, 1);
+    bw.put(8 + 2, 6);
+    bw.put(0, 1);
+    for (int i = 0; i < 2; i++) bw.putSigned(x[i], bps);
+    std::vector<int32_t> res(x.size());
+    for (size_t i = 2; i < x.size(); i++) res[i] = x[i] - (2 * x[i - 1] - x[i - 2]);
+    putResiduals(bw, res, 2);
+}
+
+static void putLpc(BitWriter& bw, const std::vector<int32_t>& x, uint8_t bps) { // SUBFRAME_LPC, order 8, Levinson-Durbin on the block
+    const int order = 8, precision = 12;
+    double    ac[order + 1] = {}, lpc[order] = {}, tmp[order];
+    for (int l = 0; l <= order; l++) {
+        for (size_t i = l; i < x.size(); i++) ac[l] += (double)x[i] * x[i - l];
+    }
+    ac[0] *= 1.0001;
+    double err = ac[0] ? ac[0] : 1;
+    for (int i = 0; i < order; i++) {
+        double k = ac[i + 1];
+        for (int j = 0; j < i; j++) k -= lpc[j] * ac[i - j];
+        k /= err;
+        for (int j = 0; j < i; j++) tmp[j] = lpc[j] - k * lpc[i - 1 - j];
+        for (int j = 0; j < i; j++) lpc[j] = tmp[j];
+        lpc[i] = k;
+        err *= 1 - k * k;
+    }
+    double cmax = 0;
+    for (double c : lpc) cmax = std::max(cmax, fabs(c));
+    int shift = precision - 2 - (cmax > 0 ? (int)ceil(log2(cmax)) : 0);
+    shift = std::clamp(shift, 0, 15);
+    int32_t q[order];
+    for (int i = 0; i < order; i++) q[i] = std::clamp((int32_t)lround(lpc[i] * (1 << shift)), -(1 << (precision - 1)) + 1, (1 << (precision - 1)) - 1);
+
+    bw.put(0, 1);
+    bw.put(32 + order - 1, 6);
+    bw.put(0, 1);
+    for (int i = 0; i < order; i++) bw.putSigned(x[i], bps);
+    bw.put(precision - 1, 4);
+    bw.putSigned(shift, 5);
+    for (int i = 0; i < order; i++) bw.putSigned(q[i], precision);
+    std::vector<int32_t> res(x.size());
+    for (size_t i = order; i < x.size(); i++) {
+        int32_t sum = 0;
+        for (int j = 0; j < order; j++) sum += q[j] * x[i - 1 - j];
+        res[i] = x[i] - (sum >> shift);
+    }
+    putResiduals(bw, res, order);
+}
+
+std::vector<uint8_t> synth_flac(uint32_t blocks, uint32_t seed, std::vector<int16_t>* pcm) {
+    const uint32_t       bs = 4096, sr = 44100;
+    std::mt19937         rnd(seed);
+    std::vector<uint8_t> out = {'f', 'L', 'a', 'C', 0x80, 0, 0, 34}; // last metadata block: STREAMINFO
+    BitWriter            si;
+    si.put(bs, 16);
+    si.put(bs, 16);
+    si.put(0, 24);
+    si.put(0, 24);
+    si.put(sr, 20);
+    si.put(2 - 1, 3);
+    si.put(16 - 1, 5);
+    si.put(0, 4);
+    si.put(blocks * bs, 32);
+    for (int i = 0; i < 16; i++) si.put(0, 8); // MD5 not set
+    out.insert(out.end(), si.buf.begin(), si.buf.end());
+    if (pcm) pcm->clear();
+
+    double ph[3] = {}, fr[3] = {220, 331, 1250};
+    for (uint32_t b = 0; b < blocks; b++) {
+        std::vector<int32_t> L(bs), R(bs);
+        for (uint32_t i = 0; i < bs; i++) {
+            for (int k = 0; k < 3; k++) ph[k] += 2 * M_PI * fr[k] * (1 + 0.2 * sin(b * 0.3 + k)) / sr;
+            int32_t noise = (int32_t)(rnd() % 257) - 128;
+            L[i] = (int32_t)(7000 * sin(ph[0]) + 3000 * sin(ph[2])) + noise;
+            R[i] = (int32_t)(6000 * sin(ph[1]) + 3000 * sin(ph[2] + 0.5)) - noise;
+            if (pcm) {
+                pcm->push_back(L[i]);
+                pcm->push_back(R[i]);
+            }
+        }
+        uint8_t   chanAsgn = b % 3 == 0 ? 1 : b % 3 == 1 ? 8 : 10; // independent, left/side, mid/side
+        BitWriter bw;
+        bw.put(0xFFF8, 16); // sync, fixed blocksize
+        bw.put(12, 4);      // 256 << (12 - 8) = 4096
+        bw.put(9, 4);       // 44.1 kHz
+        bw.put(chanAsgn, 4);
+        bw.put(4, 3);       // 16 bit
+        bw.put(0, 1);
+        if (b < 0x80) bw.put(b, 8); // frame number, UTF-8 coded
+        else if (b < 0x800) {
+            bw.put(0xC0 | (b >> 6), 8);
+            bw.put(0x80 | (b & 0x3F), 8);
+        } else {
+            bw.put(0xE0 | ((b >> 12) & 0x0F), 8);
+            bw.put(0x80 | ((b >> 6) & 0x3F), 8);
+            bw.put(0x80 | (b & 0x3F), 8);
+        }
+        bw.put(crc8(bw.buf.data(), bw.buf.size()), 8);
+        std::vector<int32_t> a = L, c = R;
+        uint8_t              bpsA = 16, bpsC = 16;
+        if (chanAsgn == 8) { // left, side
+            for (uint32_t i = 0; i < bs; i++) c[i] = L[i] - R[i];
+            bpsC = 17;
+        }
+        if (chanAsgn == 10) { // mid, side
+            for (uint32_t i = 0; i < bs; i++) {
+                a[i] = (L[i] + R[i]) >> 1;
+                c[i] = L[i] - R[i];
+            }
+            bpsC = 17;
+        }
+        putLpc(bw, a, bpsA);
+        putFixed(bw, c, bpsC);
+        bw.align();
+        uint16_t crc = crc16(bw.buf.data(), bw.buf.size());
+        bw.put(crc, 16);
+        out.insert(out.end(), bw.buf.begin(), bw.buf.end());
+    }
+    return out;
+}
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// Ogg Opus, stereo, CELT only fullband 20 ms (TOC config 31), 160 byte packets = 64 kbit/s
+
+static uint32_t oggCrc(const uint8_t* p, size_t n) {
+    uint32_t crc = 0;
+    while (n--) {
+        crc ^= (uint32_t)*p++ << 24;
+        for (int i = 0; i < 8; i++) crc = crc & 0x80000000 ? (crc << 1) ^ 0x04C11DB7 : crc << 1;
+    }
+    return crc;
+}
+
+static void oggPage(std::vector<uint8_t>& out, const std::vector<std::vector<uint8_t>>& packets, uint8_t type, uint64_t granule, uint32_t seq) {
+    std::vector<uint8_t> p = {'O', 'g', 'g', 'S', 0, type};
+    for (int i = 0; i < 8; i++) p.push_back(granule >> (8 * i));
+    for (uint32_t v : {0x54554E45u, seq, 0u}) { // serial, sequence, crc
+        for (int i = 0; i < 4; i++) p.push_back(v >> (8 * i));
+    }
+    std::vector<uint8_t> lacing;
+    for (auto& pk : packets) {
+        size_t n = pk.size();
+        while (n >= 255) {
+            lacing.push_back(255);
+            n -= 255;
+        }
+        lacing.push_back(n);
+    }
+    p.push_back(lacing.size());
+    p.insert(p.end(), lacing.begin(), lacing.end());
+    for (auto& pk : packets) p.insert(p.end(), pk.begin(), pk.end());
+    uint32_t crc = oggCrc(p.data(), p.size());
+    for (int i = 0; i < 4; i++) p[22 + i] = crc >> (8 * i);
+    out.insert(out.end(), p.begin(), p.end());
+}
+
+std::vector<uint8_t> synth_opus(uint32_t packets, uint32_t seed) {
+    std::mt19937         rnd(seed);
+    std::vector<uint8_t> out;
+    std::vector<uint8_t> head = {'O', 'p', 'u', 's', 'H', 'e', 'a', 'd', 1, 2, 0x38, 0x01, 0x80, 0xBB, 0, 0, 0, 0, 0}; // stereo, pre-skip 312, 48 kHz
+    std::vector<uint8_t> tags = {'O', 'p', 'u', 's', 'T', 'a', 'g', 's', 4, 0, 0, 0, 'h', 'o', 's', 't', 0, 0, 0, 0};
+    uint32_t             seq = 0;
+    uint64_t             granule = 0;
+    oggPage(out, {head}, 0x02, 0, seq++);
+    oggPage(out, {tags}, 0x00, 0, seq++);
+    for (uint32_t n = 0; n < packets;) {
+        std::vector<std::vector<uint8_t>> page;
+        for (int i = 0; i < 50 && n < packets; i++, n++) {
+            std::vector<uint8_t> pk(160);
+            pk[0] = (31 << 3) | (1 << 2); // CELT FB 20 ms, stereo, one frame
+            for (size_t j = 1; j < pk.size(); j++) pk[j] = (uint8_t)rnd();
+            page.push_back(pk);
+            granule += 960;
+        }
+        oggPage(out, page, n == packets ? 0x04 : 0x00, granule, seq++);
+    }
+    return out;
+}
@@ -46,12 +46,11 @@
  *=========================*/
 
 /*1: use custom malloc/free, 0: use the built-in `lv_mem_alloc()` and `lv_mem_free()`*/
-#define LV_MEM_CUSTOM 0
+/*1: blocks are placed by size (lvgl_port_mem_alloc), 0: one 48 kB TLSF pool in internal RAM*/
+#define LV_MEM_CUSTOM 1
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
     #define LV_MEM_SIZE (48U * 1024U)          /*[bytes]*/
-   // #define LV_MEM_SIZE (64U * 1024U)  // or even 128 KB
-
 
     /*Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too.*/
     #define LV_MEM_ADR 0     /*0: unused*/
@@ -62,10 +61,14 @@
     #endif
 
 #else       /*LV_MEM_CUSTOM*/
-    #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
-    #define LV_MEM_CUSTOM_ALLOC   malloc
-    #define LV_MEM_CUSTOM_FREE    free
-    #define LV_MEM_CUSTOM_REALLOC realloc
+    /*Objects, styles and the render scratch of lv_mem_buf_get() (a display row or less) stay in internal RAM,
+     *blocks of LV_MEM_PSRAM_MIN bytes and up (image and layer buffers, big label texts) go to PSRAM.
+     *Either region is the fallback of the other.*/
+    #define LV_MEM_PSRAM_MIN (4U * 1024U)
+    #define LV_MEM_CUSTOM_INCLUDE "lvgl_port/lvgl_port.h"   /*Header for the dynamic memory function*/
+    #define LV_MEM_CUSTOM_ALLOC   lvgl_port_mem_alloc
+    #define LV_MEM_CUSTOM_FREE    lvgl_port_mem_free
+    #define LV_MEM_CUSTOM_REALLOC lvgl_port_mem_realloc
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
@@ -146,7 +149,7 @@
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  *However the opened images might consume additional RAM.
  *0: to disable caching*/
-#define LV_IMG_CACHE_DEF_SIZE 1
+#define LV_IMG_CACHE_DEF_SIZE 12 /*one redraw of the clock uses up to 6 digit tiles + colon, 1 kept 'opening' them in turn*/
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
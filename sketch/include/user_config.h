@@ -26,11 +26,20 @@
 #define I2C_TOUCH_ADDR                    0x3b
 #define WAVESHARE_349_PIN_NUM_TOUCH_RST         (-1)
 #define WAVESHARE_349_PIN_NUM_TOUCH_INT         (-1)
+#define WAVESHARE_349_TOUCH_IDLE_POLL_MS 60 // touch poll period while no finger is down (no INT line)
+#define WAVESHARE_349_TOUCH_RELEASE_SAMPLES 2 // empty samples in a row before a release is reported
 
 
 #define WAVESHARE_349_LVGL_TICK_PERIOD_MS   5
 #define WAVESHARE_349_LVGL_TASK_MAX_DELAY_MS 50
 #define WAVESHARE_349_LVGL_TASK_MIN_DELAY_MS 5 //less is more responsive
+#define WAVESHARE_349_LVGL_IDLE_AFTER_MS 3000 // no touch and no animation for this long -> idle rate
+#define WAVESHARE_349_LVGL_IDLE_REFR_MS 250 // display refresh period when idle
+#define WAVESHARE_349_LVGL_IDLE_INDEV_MS 100 // touch read period when idle or locked
+#define WAVESHARE_349_LVGL_CORE_MA 30 // extra current of one busy core at 240MHz, only for the governor estimate
+#define WAVESHARE_349_LVGL_THREAD_CHECK 0 // debug: assert when a task without the lvgl lock changes a visible widget
+#define TUNEBAR_ALLOC_TRACKING 0 // debug: registry of the audio library allocations, serial monitor "mem", "mem mark", "mem diff"
+#define TUNEBAR_PLACEMENT_BENCH "" // debug: file on the SD card, e.g. "/bench.mp3", decoded at boot with decoder placement off and on, logs us/frame of both
 
 
 
@@ -79,6 +88,10 @@ ESP32 TX → ES8322 (DAC)
 ESP32 RX ← ES7210 (ADC)
 */
 
+//IMAGE ASSETS (src/asset)
+#define WAVESHARE_349_ASSET_CACHE_KB 1536 // PSRAM budget of decoded images, icon atlases (~540KB) + 3 wallpapers
+#define WAVESHARE_349_ASSET_CACHE_SLOTS 8 // max cached images
+
 //SD CARD
 #define SD_CS 38
 #define SPI_MOSI 39
@@ -6,7 +6,7 @@ CORE 1:
         &Audio::taskWrapper, "PeriodicTask", 3300, this, 6, xAudioStack,  &xAudioTaskBuffer, 1);
   xTaskCreatePinnedToCore(audio_loop_task, "audio_loop", 6 * 1024, NULL, 4, NULL, 1);
   xTaskCreatePinnedToCore(rtc_read_task, "getDateTimeTask", 3 * 1024, NULL, 3, NULL, 1);
-  xTaskCreatePinnedToCore(button_input_task, "buttonInputTask", 2 * 1024, NULL, 2, NULL, 1);
+  xTaskCreatePinnedToCore(button_input_task, "buttonInputTask", 3 * 1024, NULL, 2, NULL, 1);
   xTaskCreatePinnedToCore(batt_level_read_task, "readBatteryLevel", 2 * 1024, NULL, 1, NULL, 1);
   
 
@@ -20,6 +20,7 @@ CORE 0:
 */
 #include "file/file.h"
 #include "task_msg/task_msg.h"
+#include "resume/resume.h"
 #include <LittleFS.h>
 
 //==============================================
@@ -30,7 +31,6 @@ void button_input_task(void *param) {
   vTaskDelay(pdMS_TO_TICKS(3000)); // delay 1 sec avoid hold button too long and turn to off again
   bool powerBTN_pressed = false;
   long hold_timer = 0;
-  AudioCommandPayload msg = {};
   for (;;) {
     // turn off power button
     if (digitalRead(SYS_OUT) == LOW) {
@@ -40,9 +40,10 @@ void button_input_task(void *param) {
       } else if (millis() - hold_timer > 500) {
         hold_timer = millis();
         audioSetVolume(20);
-        audioPlayFS(1, "/audio/off.mp3");
+        audioPlayFS(1, "/audio/off.mp3"); // the audio task keeps stopSong()'s position of the track it interrupts
         log_d("< POWER OFF >");
         vTaskDelay(pdMS_TO_TICKS(1000));
+        resumeCheckpoint(true); // last position, resumed at the next power on
         io->digitalWrite(EXIO6_BIT, 0); // turn off
       }
     } else if (powerBTN_pressed)
@@ -59,18 +60,12 @@ void button_input_task(void *param) {
         case 1: setUpduty(LCD_PWM_MODE_150); break;
         case 2: setUpduty(LCD_PWM_MODE_255); break;
         }
-        UIStatusPayload msg = {
-            .type = STATUS_SCREEN_UNLOCK,
-        };
-        xQueueSend(ui_status_queue, &msg, 100); // send message
+        updateScreenLock(false);
         SCREEN_OFF_TIMER = millis(); // reset timer
         BL_OFF = false;
       } else { // force screen off
         log_d("< Lock Screen with button >");
-        UIStatusPayload msg = {
-            .type = STATUS_SCREEN_LOCK,
-        };
-        xQueueSend(ui_status_queue, &msg, 100); // send message
+        updateScreenLock(true);
         setUpduty(LCD_PWM_MODE_0);
         BL_OFF = true;
       }
@@ -84,10 +79,7 @@ void button_input_task(void *param) {
       if ((now - start) >= delay) {
         log_d("< Lock Screen >");
 
-        UIStatusPayload msg = {
-            .type = STATUS_SCREEN_LOCK,
-        };
-        xQueueSend(ui_status_queue, &msg, 100);
+        updateScreenLock(true);
 
         setUpduty(LCD_PWM_MODE_0);
         BL_OFF = true;
@@ -123,10 +115,7 @@ void batt_level_read_task(void *param) {
     log_d("ADC: %d | Vbat: %.2fV | State: %d,%d", rawValue, vbat, bat_state, last_state);
     if (bat_state != last_state) {
       last_state = bat_state;
-      UIStatusPayload msg = {// prepare mesasge
-                             .type = STATUS_UPDATE_BATTERY_LEVEL,
-                             .battery_state = bat_state};
-      xQueueSend(ui_status_queue, &msg, 100); // send message
+      updateBatteryLevel(bat_state);
     }
     vTaskDelay(pdMS_TO_TICKS(10000));
   } // if{;;}
@@ -138,17 +127,40 @@ void batt_level_read_task(void *param) {
 
 //==============================================
 
+#if TUNEBAR_ALLOC_TRACKING
+// serial monitor: "mem" all allocations, "mem mark" sets the baseline, "mem diff" what changed since
+static void serial_command_poll() {
+  static char line[16];
+  static uint8_t len = 0;
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (len < sizeof(line) - 1) line[len++] = c;
+      continue;
+    }
+    line[len] = 0;
+    if (strcmp(line, "mem") == 0) ps_track_dump(false);
+    else if (strcmp(line, "mem mark") == 0) ps_track_mark();
+    else if (strcmp(line, "mem diff") == 0) ps_track_dump(true);
+    if (strncmp(line, "mem", 3) == 0) log_i("heap free: internal %u, PSRAM %u", heap_caps_get_free_size(MALLOC_CAP_INTERNAL), heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    len = 0;
+  }
+}
+#endif
+
 // TASK: Real Time Clock
 extern PCF85063 rtc;
 TickType_t lastWake = xTaskGetTickCount();
 void rtc_read_task(void *param) {
   rtc.begin();
   for (;;) {
+#if TUNEBAR_ALLOC_TRACKING
+    serial_command_poll(); // once a second is quick enough for typing
+#endif
     // read RTC
     if (rtc.getDateTime()) {
 
-      UIStatusPayload msg = {
-         .type = STATUS_UPDATE_CLOCK, 
+      UIClock clock = {
          .hour = now.hour, 
          .minute = now.minute, 
          .second = now.second, 
@@ -156,7 +168,7 @@ void rtc_read_task(void *param) {
          .month = now.month, 
          .dayOfMonth = now.dayOfMonth, 
          .dayOfWeek = now.dayOfWeek};
-      xQueueSend(ui_status_queue, &msg, 100); // send message
+      updateClock(clock);
 
     } else {
       log_w("RTC Error");
@@ -198,18 +210,6 @@ void rtc_read_task(void *param) {
 // ========================================================================
 // TASK: AUDIO
 
-// Helper function convert track time second -> hh:mm:ss
-void timeStr(char *buffer, size_t size, uint32_t second) {
-  uint8_t h = second / 3600;
-  uint8_t m = (second % 3600) / 60;
-  uint8_t s = second % 60;
-  if (h > 0) {
-    snprintf(buffer, size, "%d:%02d:%02d", h, m, s);
-  } else {
-    snprintf(buffer, size, "%d:%02d", m, s);
-  }
-}
-
 
 // ---------- GLOBAL RECORDING STATE ----------
 static const size_t SAMPLE_RATE = 48000; // or 16000 – choose ONE
@@ -356,18 +356,106 @@ void stopRecording(size_t length) {
   playRecordedAudio();
 }
 */
+//--------------------------------
+// gapless playback: the next track is opened by the library while the current one plays
+static volatile bool track_ended = false; // evt_eof without a pre-opened next track
+static volatile bool track_switched = false; // evt_nexttrack, the library already plays next_index
+static int next_index = -1; // track handed to audio.setNextFS()
+static uint16_t next_armed_from = 0; // trackIndex and playMode when next_index was chosen
+static uint8_t next_armed_mode = 0;
+static uint32_t next_arm_retry = 0; // millis, setNextFS() failed
+
+// track after trackIndex according to playMode
+static uint16_t next_track_index() {
+  switch (playMode) {
+  case 0: // normal play mode
+    return (trackIndex + 1 < trackListLength) ? trackIndex + 1 : 0;
+  case 1: { // random play, avoid same track twice
+    uint16_t next = trackIndex;
+    do {
+      next = random(trackListLength);
+    } while (trackListLength > 1 && next == trackIndex);
+    return next;
+  }
+  default: // repeat
+    return trackIndex;
+  }
+}
+
+// send track number and clear the description, the id3 callback fills it again
+static void show_new_track(bool ok) {
+  char trackNumber[24];
+  snprintf(trackNumber, sizeof(trackNumber), "%d of %d", trackIndex + 1, trackListLength);
+  updateTrackNumber(trackNumber);
+  updateTrackDesc(ok ? "" : "Cannot access music.\nPlease check the SD Card.\nOr Update music library.", false);
+}
+
+// called after audio.loop(), keeps one next track armed and follows the switches of the library
+static void gapless_update() {
+  if (mediaType != 1 || trackListLength == 0) {
+    track_ended = track_switched = false;
+    return;
+  }
+  if (track_switched) { // seamless, the library plays the pre-opened file already
+    track_switched = false;
+    track_ended = false;
+    trackIndex = next_index;
+    next_index = -1;
+    show_new_track(true);
+    char trackPath[512];
+    getTrackPath(trackIndex, trackPath, sizeof(trackPath));
+    resumeTrack(1, trackIndex, trackPath);
+  }
+  if (track_ended) { // nothing was armed (or it failed), start the next track the old way
+    track_ended = false;
+    trackIndex = next_track_index();
+    char trackPath[512];
+    getTrackPath(trackIndex, trackPath, sizeof(trackPath));
+    bool ok = audio.connecttoFS(SD, trackPath);
+    if (!ok) log_e("Failed to open file: %s", trackPath);
+    if (ok) resumeTrack(1, trackIndex, trackPath);
+    else resumeUntrack();
+    show_new_track(ok);
+    next_index = -1;
+    return;
+  }
+  if (!audio.isRunning()) return;
+
+  // the user skipped or changed the play mode, the armed track is stale
+  if (audio.hasNextFS() && (next_armed_from != trackIndex || next_armed_mode != playMode)) audio.clearNextFS();
+
+  if (!audio.hasNextFS() && millis() - next_arm_retry > 5000) {
+    uint16_t next = next_track_index();
+    char trackPath[512];
+    getTrackPath(next, trackPath, sizeof(trackPath));
+    if (audio.setNextFS(SD, trackPath)) {
+      next_index = next;
+      next_armed_from = trackIndex;
+      next_armed_mode = playMode;
+      log_d("next track armed: %u %s", next + 1, trackPath);
+    } else {
+      next_arm_retry = millis();
+    }
+  }
+}
+
 //--------------------------------
 // audio information callback
 void my_audio_info(Audio::msg_t m) {
 
-  UIStatusPayload msg = {};
+  if (m.e == Audio::evt_eof) track_ended = true; // see gapless_update()
+  if (m.e == Audio::evt_nexttrack) {
+    track_ended = false;
+    track_switched = true;
+  }
+
+  char desc[UI_EVENT_TEXT_LEN];
   switch (mediaType) {
   case 0: // show station title / description
   {
     if (m.e == Audio::evt_streamtitle) {
-      msg.type = STATUS_UPDATE_TRACK_DESC_SET;
-      snprintf(msg.trackDesc, sizeof(msg.trackDesc), "%s\n%s", stations[stationIndex].name, m.msg);
-      xQueueSend(ui_status_queue, &msg, 100); // send message
+      snprintf(desc, sizeof(desc), "%s\n%s", stations[stationIndex].name, m.msg);
+      updateTrackDesc(desc, false);
       log_i("%s", m.msg);
     }
     break;
@@ -376,10 +464,9 @@ void my_audio_info(Audio::msg_t m) {
   {
     if (m.e == Audio::evt_id3data) {
       if (strstr(m.msg, "Title") || strstr(m.msg, "Artist") || strstr(m.msg, "Album")) {
-        msg.type = STATUS_UPDATE_TRACK_DESC_ADD;
-        snprintf(msg.trackDesc, sizeof(msg.trackDesc), "%s\n", m.msg);
-        xQueueSend(ui_status_queue, &msg, 100); // send message
-        log_i("%s", msg.trackDesc);
+        snprintf(desc, sizeof(desc), "%s\n", m.msg);
+        updateTrackDesc(desc, true);
+        log_i("%s", desc);
       }
     }
   } break;
@@ -387,17 +474,22 @@ void my_audio_info(Audio::msg_t m) {
 }
 
 //------------------------------------
+// how long the loop task may sleep on the command queue
+// stopped: only a command can start playback, playing: the emptier the input buffer, the sooner audio.loop() must refill it
+static TickType_t audio_loop_wait() {
+  if (!audio.isRunning()) return pdMS_TO_TICKS(1000);
+  if (audio.inBufferFilled() < audio.getInBufferSize() / 2) return pdMS_TO_TICKS(5);
+  return pdMS_TO_TICKS(20);
+}
+
 void audio_loop_task(void *param) {
-  const TickType_t period = pdMS_TO_TICKS(5);
-  TickType_t lastWakeTime = xTaskGetTickCount();
+  uint32_t wakeups = 0;
+  uint32_t stats_timer = millis();
   static uint32_t last_pos = 0;
   static uint32_t last_total = 0;
   uint32_t current_pos = 0;
   uint32_t current_total = 0;
-  char elapse_buf[16];
-  char remain_buf[16];
   char status_buffer[50];
-  UIStatusPayload msg = {};
 
   // --- ส่วนของ Mic (แก้ไขใหม่) ---
   // อ่านทีละ 512 bytes (จะได้ 128 stereo frames)
@@ -413,8 +505,22 @@ void audio_loop_task(void *param) {
     // PLAYBACK MODE
     if (!is_mic_mode) {
       audio.loop();
-      process_audio_cmd_que();
-      vTaskDelayUntil(&lastWakeTime, period);
+      gapless_update();
+      process_audio_cmd_que(audio_loop_wait());
+      resumeCheckpoint();
+
+      wakeups++;
+      if (millis() - stats_timer >= 10000) {
+        Audio::taskStats_t ts = audio.getAudioTaskStats();
+        Audio::bufferHealth_t bh = audio.getBufferHealth();
+        log_d("audio task idle %u%%, %u wakeups/s | loop task %u wakeups/s", ts.idlePercent, ts.wakeupsPerSec, wakeups / 10);
+        log_d("buffer in %u%% net %u%%, %u B/s, %u underruns", bh.inBuffPercent, bh.netBuffPercent, bh.bytesPerSec, bh.underruns);
+        log_d("last gapless switch: %u samples of silence", audio.getGapSamples());
+        AudioCmdStats cs = audio_cmd_get_stats();
+        log_d("audio cmd %u queued, %u slot writes (%u merged), %u seeks, %u dropped", cs.commands, cs.slot_writes, cs.slot_coalesced, cs.seeks, cs.drops);
+        wakeups = 0;
+        stats_timer = millis();
+      }
 
      
       if (audio.isRunning()) {
@@ -423,73 +529,18 @@ void audio_loop_task(void *param) {
         current_total = audio.getAudioFileDuration();
         if (current_pos != last_pos && current_total > 0) {
           log_d("%u/%u", current_pos, current_total);
-          timeStr(elapse_buf, sizeof(elapse_buf), current_pos);
-          timeStr(remain_buf, sizeof(remain_buf), current_total - current_pos);
-          if (!seeking_now) {
-            msg = {// prepare mesasge
-                   .type = STATUS_UPDATE_PLAY_POSITION,
-                   .current_pos = current_pos,
-                   .total = current_total};
-            snprintf(msg.elapse_buf, sizeof(msg.elapse_buf), "%s", elapse_buf);
-            snprintf(msg.remain_buf, sizeof(msg.remain_buf), "%s", remain_buf);
-            xQueueSend(ui_status_queue, &msg, 100); // send message
-          }
+          if (!seeking_now) updatePlayPosition(current_pos, current_total);
+          resumePosition(current_pos);
           // track not 0 length
           if (current_total > 0) {
             // set progress bar status when opena new track (not equal track length)
-            if (current_total != last_total) {
-              msg = {// prepare mesasge
-                     .type = STATUS_UPDATE_PROGRESS_BAR,
-                     .total = current_total};
-              xQueueSend(ui_status_queue, &msg, 100); // send message
-            }
-
-            //---------
-            // detect end of file track -> next track
-            if ((mediaType == 1) && (current_total - current_pos <= 1)) {
-              switch (playMode) {
-              case 0: { // normal play mode
-                trackIndex++;
-                if (trackIndex == trackListLength) trackIndex = 0;
-                break;
-              }
-              case 1: { // random play, avoid same track twice
-                uint16_t old = trackIndex;
-                do {
-                  trackIndex = random(trackListLength);
-                } while (trackListLength > 1 && trackIndex == old);
-                break;
-              }
-              case 2: { // repeat
-                // do nothing
-                break;
-              }
-              }
-              // switch
-              //  update track index
-              msg.type = STATUS_UPDATE_TRACK_NUMBER;
-               snprintf(msg.trackNumber, sizeof(msg.trackNumber), "%d of %d", trackIndex + 1, trackListLength);
-              xQueueSend(ui_status_queue, &msg, 100); // send message
-
-              // play track
-              char trackPath[512];
-              getTrackPath(trackIndex, trackPath, sizeof(trackPath));
-              msg.type = STATUS_UPDATE_TRACK_DESC_SET;
-              if (!audio.connecttoFS(SD, trackPath)) {
-                log_e("Failed to open file: %s", trackPath);
-                snprintf(msg.trackDesc, sizeof(msg.trackDesc),  "Cannot access music.\nPlease check the SD Card.\nOr Update music library.");
-              } else {
-                snprintf(msg.trackDesc, sizeof(msg.trackDesc), "");
-              }
-              xQueueSend(ui_status_queue, &msg, 100); // send message
-            } // detect end of track -> next track
+            if (current_total != last_total) updateProgressBar(current_total);
           } // not empty track
 
           last_pos = current_pos;
           last_total = current_total;
         }
       }
-      vTaskDelay(1);
     }
 
     // ---------RECORD MODE-------------------------
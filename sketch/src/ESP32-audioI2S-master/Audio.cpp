@@ -23,6 +23,12 @@ char audioI2SVers[] = "\
 #include "psram_unique_ptr.hpp"
 #include "vorbis_decoder/vorbis_decoder.h"
 #include "wav_decoder/wav_decoder.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#if __has_include("esp_dsp.h")
+    #include "esp_dsp.h" // optimized biquad (ae32 / aes3), scalar fallback below
+    #define AUDIO_ESP_DSP
+#endif
 
 // constants
 constexpr size_t m_frameSizeWav = 2048;
@@ -35,146 +41,12 @@ constexpr size_t m_outbuffSize = 4096 * 4;
 constexpr size_t m_samplesBuff48KSize = m_outbuffSize * 8; // 131072KB  SRmin: 6KHz -> SRmax: 48K
 
 constexpr size_t AUDIO_STACK_SIZE = 3500;
+constexpr uint8_t AUDIO_DMA_WAKE_BUFFERS = 4; // wake the audio task when 4 of 16 DMA buffers (~43ms) are free again
 
 // static allocations for Audio task
 StaticTask_t __attribute__((unused)) xAudioTaskBuffer;
 StackType_t __attribute__((unused))  xAudioStack[AUDIO_STACK_SIZE];
 
-// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-// 📌📌📌  A U D I O B U F F E R  📌📌📌
-// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-AudioBuffer::AudioBuffer(size_t maxBlockSize) {
-    if (maxBlockSize) m_resBuffSize = maxBlockSize;
-    if (maxBlockSize) m_maxBlockSize = maxBlockSize;
-}
-
-AudioBuffer::~AudioBuffer() {
-    // m_buffer.reset();
-}
-
-int32_t AudioBuffer::getBufsize() {
-    return m_buffSize;
-}
-
-bool AudioBuffer::setBufsize(size_t mbs) {
-    if (mbs < 2 * m_resBuffSize) {
-        log_e("not allowed buffer size must be greater than %i", 2 * m_resBuffSize);
-        return false;
-    }
-    m_buffSize = mbs;
-    if (!init()) return false;
-    return true;
-}
-
-size_t AudioBuffer::init() {
-    m_buffer.alloc(m_buffSize + m_resBuffSize, "AudioBuffer");
-    m_f_init = true;
-    resetBuffer();
-    return m_buffSize;
-}
-
-void AudioBuffer::changeMaxBlockSize(uint16_t mbs) {
-    m_maxBlockSize = mbs;
-    return;
-}
-
-uint16_t AudioBuffer::getMaxBlockSize() {
-    return m_maxBlockSize;
-}
-
-size_t AudioBuffer::freeSpace() {
-    if (m_readPtr == m_writePtr) {
-        if (m_f_isEmpty == true)
-            m_freeSpace = m_buffSize;
-        else
-            m_freeSpace = 0;
-    }
-    if (m_readPtr < m_writePtr) { m_freeSpace = (m_endPtr - m_writePtr) + (m_readPtr - m_buffer.get()); }
-    if (m_readPtr > m_writePtr) { m_freeSpace = m_readPtr - m_writePtr; }
-    return m_freeSpace;
-}
-
-size_t AudioBuffer::writeSpace() {
-    if (m_readPtr == m_writePtr) {
-        if (m_f_isEmpty == true)
-            m_writeSpace = m_endPtr - m_writePtr;
-        else
-            m_writeSpace = 0;
-    }
-    if (m_readPtr < m_writePtr) { m_writeSpace = m_endPtr - m_writePtr; }
-    if (m_readPtr > m_writePtr) { m_writeSpace = m_readPtr - m_writePtr; }
-    return m_writeSpace;
-}
-
-size_t AudioBuffer::bufferFilled() {
-    if (m_readPtr == m_writePtr) {
-        if (m_f_isEmpty == true)
-            m_dataLength = 0;
-        else
-            m_dataLength = m_buffSize;
-    }
-    if (m_readPtr < m_writePtr) { m_dataLength = m_writePtr - m_readPtr; }
-    if (m_readPtr > m_writePtr) { m_dataLength = (m_endPtr - m_readPtr) + (m_writePtr - m_buffer.get()); }
-    return m_dataLength;
-}
-
-size_t AudioBuffer::getMaxAvailableBytes() {
-    if (m_readPtr == m_writePtr) {
-        //   if(m_f_start)m_dataLength = 0;
-        if (m_f_isEmpty == true)
-            m_dataLength = 0;
-        else
-            m_dataLength = (m_endPtr - m_readPtr);
-    }
-    if (m_readPtr < m_writePtr) { m_dataLength = m_writePtr - m_readPtr; }
-    if (m_readPtr > m_writePtr) { m_dataLength = (m_endPtr - m_readPtr); }
-    return m_dataLength;
-}
-
-void AudioBuffer::bytesWritten(size_t bw) {
-    if (!bw) return;
-    m_writePtr += bw;
-    if (m_writePtr == m_endPtr) { m_writePtr = m_buffer.get(); }
-    if (m_writePtr > m_endPtr) log_e("AudioBuffer: m_writePtr %p > m_endPtr %p", m_writePtr, m_endPtr);
-    m_f_isEmpty = false;
-}
-
-void AudioBuffer::bytesWasRead(size_t br) {
-    if (!br) return;
-    m_readPtr += br;
-    if (m_readPtr >= m_endPtr) {
-        size_t tmp = m_readPtr - m_endPtr;
-        m_readPtr = m_buffer.get() + tmp;
-    }
-    if (m_readPtr == m_writePtr) m_f_isEmpty = true;
-}
-
-uint8_t* AudioBuffer::getWritePtr() {
-    return m_writePtr;
-}
-
-uint8_t* AudioBuffer::getReadPtr() {
-    int32_t len = m_endPtr - m_readPtr;
-    if (len < m_maxBlockSize) {                                   // be sure the last frame is completed
-        memcpy(m_endPtr, m_buffer.get(), m_maxBlockSize - (len)); // cpy from m_buffer to m_endPtr with len
-    }
-    return m_readPtr;
-}
-
-void AudioBuffer::resetBuffer() {
-    m_writePtr = m_buffer.get();
-    m_readPtr = m_buffer.get();
-    m_endPtr = m_buffer.get() + m_buffSize;
-    m_f_isEmpty = true;
-}
-
-uint32_t AudioBuffer::getWritePos() {
-    return m_writePtr - m_buffer.get();
-}
-
-uint32_t AudioBuffer::getReadPos() {
-    return m_readPtr - m_buffer.get();
-}
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // 📌📌📌  A U D I O   📌📌📌
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -216,6 +88,9 @@ Audio::Audio(uint8_t i2sPort) {
     m_i2s_std_cfg.clk_cfg.mclk_multiple = I2S_MCLK_MULTIPLE_256; // mclk = sample_rate * 256
     i2s_channel_init_std_mode(m_i2s_tx_handle, &m_i2s_std_cfg);
     i2s_channel_init_std_mode(m_i2s_rx_handle, &m_i2s_std_cfg);
+    i2s_event_callbacks_t i2s_cbs = {};
+    i2s_cbs.on_sent = onI2sSent; // drives the audio task, see waitAudioEvent()
+    i2s_channel_register_event_callback(m_i2s_tx_handle, &i2s_cbs, this);
 /*
     int32_t dummy[1024] = {0};
     size_t n;
@@ -223,6 +98,9 @@ Audio::Audio(uint8_t i2sPort) {
 */
     I2Sstart();
     m_sampleRate = m_i2s_std_cfg.clk_cfg.sample_rate_hz;
+#ifdef SR_48K
+    m_resampler.setInputRate(m_sampleRate);
+#endif
 
     for (int i = 0; i < 3; i++) {
         m_filter[i].a0 = 1;
@@ -250,14 +128,43 @@ Audio::~Audio() {
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void Audio::destroy_decoder() {
     if (m_decoder && m_decoder->isValid()) {
+        if (m_dPrf.frames) {
+            decoderStats_t d = getDecoderStats();
+            AUDIO_LOG_INFO("%sDecoder: %lu frames, %lu frames/s, decode avg %lu us max %lu us, output %lu us, peak heap %lu bytes", m_decoder->whoIsIt(), d.frames, d.framesPerSec, d.avgUs, d.maxUs,
+                           d.outputUs, d.peakHeap);
+            AUDIO_LOG_INFO("%sDecoder: placement %s, %lu bytes in internal RAM", m_decoder->whoIsIt(), m_f_placement ? "on" : "off", d.internalBytes);
+        }
         info(*this, evt_info, "%sDecoder has been destroyed", m_decoder->whoIsIt());
+        ps_heap_use_t use(&m_dPrf.heap);
         m_decoder->reset();
         m_decoder.reset();
     }
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// per codec placement, buffers by the name given to ps_ptr::alloc(), not listed: PSRAM
+// HOT is touched for every sample, WARM once per frame, the const tables stay in flash
+static const ps_placement_t placementMP3[] = {{"m_SubbandInfo", PS_HOT}, {"m_IMDCTInfo", PS_HOT}, {"m_HuffmanInfo", PS_HOT}, {"m_DequantInfo", PS_WARM}, {"m_MP3DecInfo", PS_WARM}};
+static const ps_placement_t placementFLAC[] = {{"m_samplesBuffer", PS_HOT}};
+static const ps_placement_t placementOPUS[] = {{"decode_mem", PS_HOT}, {"m_channel_state", PS_WARM}};
+static const ps_placement_t placementVORBIS[] = {{"dsp_work", PS_HOT}, {"dsp_mdctright", PS_WARM}, {"dec_table", PS_WARM}};
+static const ps_placement_t placementAAC[] = {{"m_sample_buffer", PS_HOT}, {"m_work256", PS_HOT}, {"m_work1024", PS_WARM}};
+
 std::unique_ptr<Decoder> Audio::createDecoder(const std::string& type) {
     destroy_decoder();
+    m_dPrf = {}; // profile the new decoder from its first allocation on
+    ps_heap_use_t use(&m_dPrf.heap);
+    return newDecoder(type);
+}
+
+std::unique_ptr<Decoder> Audio::newDecoder(const std::string& type) {
+    ps_placement_use(nullptr, 0);
+    if (m_f_placement) {
+        if (type == "MP3") ps_placement_use(placementMP3, std::size(placementMP3));
+        if (type == "FLAC") ps_placement_use(placementFLAC, std::size(placementFLAC));
+        if (type == "OPUS") ps_placement_use(placementOPUS, std::size(placementOPUS));
+        if (type == "AAC") ps_placement_use(placementAAC, std::size(placementAAC));
+        if (type == "VORBIS") ps_placement_use(placementVORBIS, std::size(placementVORBIS));
+    }
     if (type == "MP3") return std::make_unique<MP3Decoder>(*this);
     if (type == "FLAC") return std::make_unique<FlacDecoder>(*this);
     if (type == "OPUS") return std::make_unique<OpusDecoder>(*this);
@@ -286,7 +193,7 @@ esp_err_t Audio::I2Sstart() {
 esp_err_t Audio::I2Sstop() {
     m_outBuff.clear();                                                  // Clear OutputBuffer
     m_samplesBuff48K.clear();                                           // Clear samplesBuff48K
-    std::fill(std::begin(m_inputHistory), std::end(m_inputHistory), 0); // Clear history in samplesBuff48K
+    m_resampler.reset();                                                // Clear history in samplesBuff48K
         bool ok = true;
     ok |= i2s_channel_disable(m_i2s_tx_handle);
     ok |= i2s_channel_disable(m_i2s_rx_handle);
@@ -355,6 +262,9 @@ void Audio::setDefaults() {
     m_dataMode = AUDIO_NONE;
     m_streamTitle.assign("");
     m_resumeFilePos = -1;
+    m_seekTarget = -1;
+    m_seekSample = -1;
+    m_mp3TocSamples = 0;
     m_audioCurrentTime = 0; // Reset playtimer
     m_audioFileDuration = 0;
     m_audioDataStart = 0;
@@ -378,10 +288,9 @@ void Audio::setDefaults() {
     m_opus_mode = 0;
     m_lastGranulePosition = 0;
     m_vuLeft = m_vuRight = 0; // #835
-    std::fill(std::begin(m_inputHistory), std::end(m_inputHistory), 0);
+    m_resampler.reset();
     if (m_f_reset_m3u8Codec) { m_m3u8Codec = CODEC_AAC; } // reset to default
     m_f_reset_m3u8Codec = true;
-    m_resampleCursor = 0.0f;
 }
 
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -712,6 +621,10 @@ bool Audio::connecttohost(const char* host, const char* user, const char* pwd) {
 bool Audio::httpPrint(const char* host) {
     // user and pwd for authentification only, can be empty
     if (!m_f_running) return false;
+    if (m_netPrefetch.isActive()) { // m_client belongs to this task again, start() drops the bytes of the old response
+        m_netPrefetch.stop();
+        m_f_netResume = true; // processWebStream() restarts the prefetch after the new header
+    }
     if (host == NULL) {
         AUDIO_LOG_ERROR("Hostaddress is empty");
         stopSong();
@@ -941,14 +854,7 @@ bool Audio::connecttoFS(fs::FS& fs, const char* path, int32_t fileStartTime) {
     } // guard
     setDefaults(); // free buffers an set defaults
 
-    if (c_path.ends_with_icase(".mp3")) m_codec = CODEC_MP3;
-    if (c_path.ends_with_icase(".m4a")) m_codec = CODEC_M4A;
-    if (c_path.ends_with_icase(".aac")) m_codec = CODEC_AAC;
-    if (c_path.ends_with_icase(".wav")) m_codec = CODEC_WAV;
-    if (c_path.ends_with_icase(".flac")) m_codec = CODEC_FLAC;
-    if (c_path.ends_with_icase(".opus")) m_codec = CODEC_OGG;
-    if (c_path.ends_with_icase(".ogg")) m_codec = CODEC_OGG;
-    if (c_path.ends_with_icase(".oga")) m_codec = CODEC_OGG;
+    m_codec = codecFromPath(c_path);
 
     if (m_codec == CODEC_OGG) m_f_ogg = true;
     if (m_codec == CODEC_NONE) { // guard
@@ -967,6 +873,7 @@ bool Audio::connecttoFS(fs::FS& fs, const char* path, int32_t fileStartTime) {
     m_audiofile = fs.open(c_path.get());
     m_dataMode = AUDIO_LOCALFILE;
     m_audioFileSize = m_audiofile.size();
+    m_seekIndex->open(fs, c_path.get(), m_audioFileSize);
     m_f_running = true;
     res = true;
 exit:
@@ -974,6 +881,165 @@ exit:
     return res;
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+uint8_t Audio::codecFromPath(ps_ptr<char>& path) {
+    if (path.ends_with_icase(".mp3")) return CODEC_MP3;
+    if (path.ends_with_icase(".m4a")) return CODEC_M4A;
+    if (path.ends_with_icase(".aac")) return CODEC_AAC;
+    if (path.ends_with_icase(".wav")) return CODEC_WAV;
+    if (path.ends_with_icase(".flac")) return CODEC_FLAC;
+    if (path.ends_with_icase(".opus")) return CODEC_OGG;
+    if (path.ends_with_icase(".ogg")) return CODEC_OGG;
+    if (path.ends_with_icase(".oga")) return CODEC_OGG;
+    return CODEC_NONE;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool Audio::setNextFS(fs::FS& fs, const char* path) {
+    // opens the file now, primeNextFS() reads its head and creates its decoder once the current file is read to its end,
+    // at the end of the current file processLocalFile() only has to switch the handle
+    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
+    ps_ptr<char> c_path;
+    uint8_t      buf[4];
+    bool         res = false;
+    clearNextFS();
+
+    if (!path) {
+        AUDIO_LOG_ERROR("next file path is not set");
+        goto exit;
+    } // guard
+    c_path.copy_from(path);
+    c_path.trim();
+    m_gpls.codec = codecFromPath(c_path);
+    if (m_gpls.codec == CODEC_NONE) {
+        AUDIO_LOG_WARN("next file, format not supported: %s", c_path.get());
+        goto exit;
+    } // guard
+    if (!c_path.starts_with("/")) c_path.insert("/", 0);
+    if (!fs.exists(c_path.get())) {
+        AUDIO_LOG_WARN("next file not found: %s", c_path.get());
+        goto exit;
+    }
+    m_nextFile = fs.open(c_path.get());
+    if (!m_nextFile || m_nextFile.read(buf, sizeof(buf)) != sizeof(buf)) {
+        AUDIO_LOG_WARN("next file can't be read: %s", c_path.get());
+        clearNextFS();
+        goto exit;
+    }
+    m_nextFile.seek(0);
+    m_nextPath.assign(c_path.get());
+    m_nextFs = &fs;
+    AUDIO_LOG_DEBUG("next file: \"%s\"", c_path.get());
+    res = true;
+exit:
+    xSemaphoreGiveRecursive(mutex_playAudioData);
+    return res;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void Audio::clearNextFS() {
+    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
+    if (m_nextFile) m_nextFile.close();
+    m_nextPath.reset();
+    m_nextFs = nullptr;
+    if (m_nextDecoder) {
+        ps_heap_use_t use(&m_gpls.heap);
+        m_nextDecoder->reset();
+        m_nextDecoder.reset();
+    }
+    m_nextHead.reset();
+    m_gpls.headLen = 0;
+    m_gpls.decoderType = nullptr;
+    m_gpls.f_primed = false;
+    xSemaphoreGiveRecursive(mutex_playAudioData);
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void Audio::primeNextFS() {
+    // the current file is in InBuff up to its end: stage the head of the next file and create its decoder while
+    // the current one still decodes, openNextFS() starts with the header already in memory and a ready decoder
+    m_gpls.f_primed = true; // one attempt per file
+    uint32_t len = min((uint32_t)m_nextFile.size(), m_nextHeadSize);
+    if (!m_nextHead.alloc(len, "m_nextHead")) {
+        AUDIO_LOG_WARN("next file, no memory for %lu bytes of its head", (unsigned long)len);
+        return;
+    }
+    uint32_t t = millis();
+    if (m_nextFile.read(m_nextHead.get(), len) != len) {
+        AUDIO_LOG_WARN("next file, head can't be read: %s", m_nextPath.c_get());
+        m_nextHead.reset();
+        m_nextFile.seek(0);
+        return;
+    }
+    m_gpls.headLen = len;
+
+    const char* type = nullptr; // ogg: the stream decides in initializeDecoder()
+    switch (m_gpls.codec) {
+        case CODEC_MP3: type = "MP3"; break;
+        case CODEC_AAC:
+        case CODEC_M4A: type = "AAC"; break;
+        case CODEC_FLAC: type = "FLAC"; break;
+        case CODEC_WAV: type = "WAV"; break;
+        default: break;
+    }
+    if (type) {
+        m_dPrf.internalBytes = ps_placement_internal_bytes(); // newDecoder() starts the placement log of the next decoder
+        m_gpls.heap = {};
+        ps_heap_use_t use(&m_gpls.heap);
+        m_nextDecoder = newDecoder(type);
+        if (!m_nextDecoder || !m_nextDecoder->init()) {
+            AUDIO_LOG_WARN("next file, the %sDecoder could not be initialized, it is created at the switch", type);
+            m_nextDecoder.reset();
+        } else {
+            m_gpls.decoderType = type;
+        }
+    }
+    AUDIO_LOG_DEBUG("next file primed, %lu bytes, %s decoder, %lu ms", (unsigned long)len, m_nextDecoder ? type : "no", (unsigned long)(millis() - t));
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void Audio::openNextFS() {
+    // end of file with a pre-opened successor, does what connecttoFS() does without fs.exists() and fs.open()
+    xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
+    ps_ptr<char> afn("afn"); // audio file name
+    ps_ptr<char> nfn("nfn"); // next file name
+    if (m_audiofile) afn.assign(m_audiofile.name());
+    nfn.assign(m_nextPath.c_get());
+    File    next = m_nextFile; // setDefaults() -> stopSong() -> clearNextFS() would close it
+    fs::FS* nextFs = m_nextFs;
+    uint8_t codec = m_gpls.codec;
+    auto    nextDecoder = std::move(m_nextDecoder); // and free these
+    auto    nextHead = std::move(m_nextHead);
+    auto    nextHeap = m_gpls.heap;
+    auto    headLen = m_gpls.headLen;
+    auto    decoderType = m_gpls.decoderType;
+    m_nextFile = File();
+    m_nextPath.reset();
+    m_nextFs = nullptr;
+    m_gpls.headLen = 0;
+    m_gpls.decoderType = nullptr;
+
+    // the scan of the ending track stops on its own, stopSong() closes the spare index, which stopped a track ago
+    m_seekIndex->abort();
+    m_seekIndex = m_seekIndex == &m_seekIdx[0] ? &m_seekIdx[1] : &m_seekIdx[0];
+    setDefaults();
+    m_fileStartTime = -1;
+    m_codec = codec;
+    if (m_codec == CODEC_OGG) m_f_ogg = true;
+    m_audiofile = next;
+    m_dataMode = AUDIO_LOCALFILE;
+    m_audioFileSize = m_audiofile.size();
+    m_nextDecoder = std::move(nextDecoder); // installed by initializeDecoder()
+    m_nextHead = std::move(nextHead);       // goes to InBuff at the first call of processLocalFile()
+    m_gpls.heap = nextHeap;
+    m_gpls.headLen = headLen;
+    m_gpls.decoderType = decoderType;
+    if (nextFs) m_seekIndex->open(*nextFs, nfn.c_get(), m_audioFileSize);
+    m_f_running = true;
+    m_gpls.f_measure = true;
+    m_gpls.switches++;
+    xSemaphoreGiveRecursive(mutex_playAudioData);
+
+    if (afn.valid()) info(*this, evt_eof, afn.c_get());
+    info(*this, evt_info, "Reading file: \"%s\"", nfn.c_get());
+    info(*this, evt_nexttrack, "%s", nfn.c_get());
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 bool Audio::connecttospeech(const char* speech, const char* lang) {
     xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ);
 
@@ -1588,6 +1654,7 @@ int Audio::read_FLAC_Header(uint8_t* data, size_t len) {
         m_rflh.maxBlockSize = bigEndian(data + 5, 2);
         info(*this, evt_info, "FLAC maxBlockSize: %u", m_rflh.maxBlockSize);
         vTaskDelay(2);
+        m_rflh.minFrameSize = bigEndian(data + 7, 3); // 0 = unknown
         m_rflh.maxFrameSize = bigEndian(data + 10, 3);
         if (m_rflh.maxFrameSize) {
             info(*this, evt_info, "FLAC maxFrameSize: %u", m_rflh.maxFrameSize);
@@ -1648,6 +1715,13 @@ int Audio::read_FLAC_Header(uint8_t* data, size_t len) {
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if (m_controlCounter == FLAC_SEEK) { /* SEEKTABLE */
         size_t l = bigEndian(data, 3);
+        if (m_dataMode == AUDIO_LOCALFILE) { // seek points: sample (8), offset from the first frame (8), samples (2)
+            for (size_t i = 3; i + 18 <= l + 3 && i + 18 <= len; i += 18) {
+                uint64_t sample = bigEndian(data + i, 8);
+                if (sample == UINT64_MAX) break; // placeholders are at the end
+                m_seekIndex->addTablePoint((uint32_t)sample, (uint32_t)bigEndian(data + i + 8, 8));
+            }
+        }
         m_controlCounter = FLAC_MBH;
         m_rflh.retvalue = l + 3;
         m_rflh.headerSize += m_rflh.retvalue;
@@ -2242,11 +2316,41 @@ int Audio::read_ID3_Header(uint8_t* data, size_t len) {
             if (mp3_xing > 0) xingPos = mp3_xing;
             if (mp3_info > 0) xingPos = mp3_info;
 
+            uint32_t frames = 0, bytes = 0;
             if (xingPos > 0 && layerIndex == 1) { // layer III only
-                uint32_t frames = bigEndian(data + xingPos + 8, 4);
+                uint32_t flags = bigEndian(data + xingPos + 4, 4);
+                frames = bigEndian(data + xingPos + 8, 4);
                 AUDIO_LOG_DEBUG("frames %i", frames);
-                uint32_t bytes = bigEndian(data + xingPos + 12, 4);
+                bytes = bigEndian(data + xingPos + 12, 4);
                 AUDIO_LOG_DEBUG("bytes %i", bytes);
+                if ((flags & 0x07) == 0x07 && m_dataMode == AUDIO_LOCALFILE && xingPos + 116 <= len) { // frames, bytes and TOC: seek index points
+                    for (int i = 0; i < 100; i++) { // byte position in 1/256 of bytes for every percent, the Xing frame is sample 0
+                        m_seekIndex->addTablePoint(i ? spf + (uint64_t)frames * spf * i / 100 : 0, (uint64_t)data[xingPos + 16 + i] * bytes / 256);
+                    }
+                    m_mp3TocSamples = (frames + 1) * spf;
+                }
+            } else if (layerIndex == 1 && len >= 62 && memcmp(data + 36, "VBRI", 4) == 0) { // Fraunhofer, 32 bytes behind the frame header
+                bytes = bigEndian(data + 46, 4);
+                frames = bigEndian(data + 50, 4);
+                uint16_t entries = bigEndian(data + 54, 2);
+                uint16_t scale = bigEndian(data + 56, 2);
+                uint16_t entrySize = bigEndian(data + 58, 2);
+                uint16_t perEntry = bigEndian(data + 60, 2); // frames
+                uint32_t frameLen = 0, s, r;
+                if (m_dataMode == AUDIO_LOCALFILE && entrySize >= 1 && entrySize <= 4 && 62 + (size_t)entries * entrySize <= len) frameLen = SeekIndex::mp3FrameLen(data, &s, &r);
+                if (frameLen) { // the TOC holds the byte size of every entry, it starts behind the VBRI frame
+                    uint64_t pos = frameLen, sample = spf;
+                    uint16_t step = entries / SeekIndex::MAX_TABLE_POINTS + 1;
+                    m_seekIndex->addTablePoint(0, 0); // the VBRI frame
+                    for (uint16_t i = 0; i < entries && pos < bytes; i++) {
+                        if (i % step == 0) m_seekIndex->addTablePoint(sample, pos);
+                        pos += bigEndian(data + 62 + i * entrySize, entrySize) * scale;
+                        sample += (uint64_t)perEntry * spf;
+                    }
+                    m_mp3TocSamples = (frames + 1) * spf;
+                }
+            }
+            if (frames && frames * spf >= (uint32_t)samplerate) {
                 uint32_t duration = frames * spf / samplerate;
                 info(*this, evt_info, "Duration (s): %u", duration);
                 m_audioFileDuration = duration;
@@ -2999,6 +3103,10 @@ size_t Audio::process_m3u8_ID3_Header(uint8_t* packet) {
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 uint32_t Audio::stopSong() {
+    m_netPrefetch.stop();    // m_client belongs to this task again
+    m_f_netResume = false;
+    clearNextFS();           // a pre-opened successor belongs to the song that ends here
+    m_gpls.f_measure = false;
     m_f_lockInBuffer = true; // wait for the decoding to finish
     uint8_t maxWait = 0;
     while (m_f_audioTaskIsDecoding) {
@@ -3018,8 +3126,10 @@ uint32_t Audio::stopSong() {
             m_audiofile.close();
         }
     }
-    memset(m_filterBuff, 0, sizeof(m_filterBuff)); // Clear FilterBuffer
+    memset(m_biquadState, 0, sizeof(m_biquadState)); // Clear FilterBuffer
     destroy_decoder();
+    m_seekIndex->close(); // waits for a running scan, at a gapless switch it is the spare index, stopped a track ago
+    m_seekTarget = -1;
     m_validSamples = 0;
     m_audioCurrentTime = 0;
     m_audioFileDuration = 0;
@@ -3048,76 +3158,8 @@ bool Audio::pauseResume() {
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 size_t Audio::resampleTo48kStereo(const int16_t* input, size_t inputSamples) {
-
-    float ratio = static_cast<float>(m_sampleRate) / 48000.0f;
-    float cursor = m_resampleCursor;
-
-    // Anzahl Input-Samples + 3 History-Samples (vorherige 3 Stereo-Frames)
-    size_t extendedSamples = inputSamples + 3;
-
-    // Temporärer Buffer: History + aktueller Input
-    std::vector<int16_t> extendedInput(extendedSamples * 2);
-
-    // Historie an den Anfang kopieren (6 Werte = 3 Stereo-Samples)
-    memcpy(&extendedInput[0], m_inputHistory, 6 * sizeof(int16_t));
-
-    // Aktuelles Input danach einfügen
-    memcpy(&extendedInput[6], input, inputSamples * 2 * sizeof(int16_t));
-
-    size_t outputIndex = 0;
-
-    auto clipToInt16 = [this](float value) -> int16_t {
-        if (value > 32767.0f) {
-            AUDIO_LOG_INFO("overflow +");
-            return 32767;
-        }
-        if (value < -32768.0f) {
-            AUDIO_LOG_ERROR("overflow -");
-            return -32768;
-        }
-        return static_cast<int16_t>(value);
-    };
-
-    for (size_t inIdx = 1; inIdx < extendedSamples - 2; ++inIdx) {
-        int32_t xm1_l = clipToInt16(extendedInput[(inIdx - 1) * 2]);
-        int32_t x0_l = clipToInt16(extendedInput[(inIdx + 0) * 2]);
-        int32_t x1_l = clipToInt16(extendedInput[(inIdx + 1) * 2]);
-        int32_t x2_l = clipToInt16(extendedInput[(inIdx + 2) * 2]);
-
-        int32_t xm1_r = clipToInt16(extendedInput[(inIdx - 1) * 2 + 1]);
-        int32_t x0_r = clipToInt16(extendedInput[(inIdx + 0) * 2 + 1]);
-        int32_t x1_r = clipToInt16(extendedInput[(inIdx + 1) * 2 + 1]);
-        int32_t x2_r = clipToInt16(extendedInput[(inIdx + 2) * 2 + 1]);
-
-        while (cursor < 1.0f) {
-            float t = cursor;
-
-            // Catmull-Rom spline, construct a cubic curve
-            auto catmullRom = [](float t, float xm1, float x0, float x1, float x2) {
-                return 0.5f * ((2.0f * x0) + (-xm1 + x1) * t + (2.0f * xm1 - 5.0f * x0 + 4.0f * x1 - x2) * t * t + (-xm1 + 3.0f * x0 - 3.0f * x1 + x2) * t * t * t);
-            };
-
-            int16_t outLeft = static_cast<int16_t>(catmullRom(t, xm1_l, x0_l, x1_l, x2_l));
-            int16_t outRight = static_cast<int16_t>(catmullRom(t, xm1_r, x0_r, x1_r, x2_r));
-
-            m_samplesBuff48K[outputIndex * 2] = clipToInt16(outLeft);
-            m_samplesBuff48K[outputIndex * 2 + 1] = clipToInt16(outRight);
-
-            ++outputIndex;
-            cursor += ratio;
-        }
-
-        cursor -= 1.0f;
-    }
-
-    // Letzte 3 Stereo-Samples als neue Historie sichern
-    for (int i = 0; i < 3; ++i) {
-        size_t idx = inputSamples - 3 + i;
-        m_inputHistory[i * 2] = input[idx * 2];
-        m_inputHistory[i * 2 + 1] = input[idx * 2 + 1];
-    }
-    m_resampleCursor = cursor;
-    return outputIndex;
+    // streaming polyphase resampler, no allocation and no logging per frame, the table is built by setSampleRate()
+    return m_resampler.process(input, inputSamples, m_samplesBuff48K.get(), m_samplesBuff48KSize / 2);
 }
 
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -3126,12 +3168,8 @@ void IRAM_ATTR Audio::playChunk() {
 
     m_plCh.validSamples = 0;
     m_plCh.i2s_bytesConsumed = 0;
-    m_plCh.sample[0] = 0;
-    m_plCh.sample[1] = 0;
-    m_plCh.s2 = 0;
     m_plCh.sampleSize = 4; // 2 bytes per sample (int16_t) * 2 channels
     m_plCh.err = ESP_OK;
-    m_plCh.i = 0;
 
     if (m_plCh.count > 0) goto i2swrite;
 
@@ -3144,32 +3182,47 @@ void IRAM_ATTR Audio::playChunk() {
         //    m_validSamples *= 2;
     }
 
-    m_plCh.validSamples = m_validSamples;
-
-    while (m_plCh.validSamples) {
-        *m_plCh.sample = m_outBuff.get() + m_plCh.i;
-        computeVUlevel(*m_plCh.sample);
-
-        //---------- Filterchain, can commented out if not used-------------
-        {
-            if (m_corr > 1) {
-                m_plCh.s2 = *m_plCh.sample;
-                m_plCh.s2[LEFTCHANNEL] /= m_corr;
-                m_plCh.s2[RIGHTCHANNEL] /= m_corr;
+    // ---------- DSP chain, every stage runs over a block of frames -------------
+    {
+        const uint8_t graph = (m_channels == 2) ? m_dspGraph : (m_dspGraph & ~DSP_MONO); // mono source, both channels are equal
+        uint32_t      t = esp_cpu_get_cycle_count();
+        auto          lap = [&](uint8_t stage) { // cycle counter per stage
+            uint32_t now = esp_cpu_get_cycle_count();
+            m_dspCycles[stage] += now - t;
+            t = now;
+        };
+        for (int32_t done = 0; done < m_validSamples; done += m_dspBlock) {
+            int32_t  frames = min((int32_t)m_dspBlock, m_validSamples - done);
+            int16_t* block = m_outBuff.get() + done * 2;
+
+            for (int32_t i = 0; i < frames; i++) computeVUlevel(block + i * 2);
+            lap(0);
+            if (graph & DSP_TONE) {
+                IIR_filterBlock(block, frames);
+                lap(1);
+            }
+            if (graph & DSP_MONO) {
+                for (int32_t i = 0; i < frames * 2; i += 2) {
+                    int16_t xy = (int16_t)((block[i] + block[i + 1]) / 2);
+                    block[i] = xy;
+                    block[i + 1] = xy;
+                }
+                lap(2);
+            }
+            if (graph & DSP_GAIN) {
+                Gain(block, frames);
+                lap(3);
             }
-            IIR_filterChain0(*m_plCh.sample);
-            IIR_filterChain1(*m_plCh.sample);
-            IIR_filterChain2(*m_plCh.sample);
         }
-        //------------------------------------------------------------------
-        if (m_f_forceMono && m_channels == 2) {
-            int32_t xy = ((*m_plCh.sample)[RIGHTCHANNEL] + (*m_plCh.sample)[LEFTCHANNEL]) / 2;
-            (*m_plCh.sample)[RIGHTCHANNEL] = (int16_t)xy;
-            (*m_plCh.sample)[LEFTCHANNEL] = (int16_t)xy;
+        m_dspFrames += m_validSamples;
+        if (m_dspFrames >= m_sampleRate) { // one second of audio, publish and restart
+            for (uint8_t i = 0; i < 4; i++) {
+                m_dspStats.cyclesPerSec[i] = (uint32_t)(m_dspCycles[i] * m_sampleRate / m_dspFrames);
+                m_dspCycles[i] = 0;
+            }
+            m_dspStats.stages = graph;
+            m_dspFrames = 0;
         }
-        Gain(*m_plCh.sample);
-        m_plCh.i += 2;
-        m_plCh.validSamples -= 1;
     }
     //------------------------------------------------------------------------------------------
 #ifdef SR_48K
@@ -3206,13 +3259,22 @@ void IRAM_ATTR Audio::playChunk() {
 
 i2swrite:
 #ifdef SR_48K
-    m_plCh.err = i2s_channel_write(m_i2s_tx_handle, m_samplesBuff48K.get() + m_plCh.count, m_validSamples * m_plCh.sampleSize, &m_plCh.i2s_bytesConsumed, 50);
+    m_plCh.err = i2s_channel_write(m_i2s_tx_handle, m_samplesBuff48K.get() + m_plCh.count, m_validSamples * m_plCh.sampleSize, &m_plCh.i2s_bytesConsumed, 0);
 #else
-    m_plCh.err = i2s_channel_write(m_i2s_tx_handle, m_outBuff.get() + m_plCh.count, m_validSamples * m_plCh.sampleSize, &m_plCh.i2s_bytesConsumed, 50);
+    m_plCh.err = i2s_channel_write(m_i2s_tx_handle, m_outBuff.get() + m_plCh.count, m_validSamples * m_plCh.sampleSize, &m_plCh.i2s_bytesConsumed, 0);
 #endif
     if (!(m_plCh.err == ESP_OK || m_plCh.err == ESP_ERR_TIMEOUT)) goto exit;
     m_validSamples -= m_plCh.i2s_bytesConsumed / m_plCh.sampleSize;
     m_plCh.count += m_plCh.i2s_bytesConsumed / 2;
+    if (m_plCh.i2s_bytesConsumed) {
+        int64_t now = esp_timer_get_time();
+        if (m_gpls.f_measure) { // first write of the new track, the DMA held up to dma_desc_num * dma_frame_num frames of the old one
+            m_gpls.f_measure = false;
+            int64_t frames = (now - m_gpls.lastWriteUs) * 48 / 1000 - m_i2s_chan_cfg.dma_desc_num * m_i2s_chan_cfg.dma_frame_num;
+            m_gpls.gapSamples = frames > 0 ? frames : 0;
+        }
+        m_gpls.lastWriteUs = now;
+    }
     if (m_validSamples <= 0) {
         m_validSamples = 0;
         m_plCh.count = 0;
@@ -3246,6 +3308,7 @@ exit:
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void Audio::loop() {
     if (!m_f_running) return;
+    if (m_f_audioTaskWaiting && (InBuff.bufferFilled() >= InBuff.getMaxBlockSize() || m_f_allDataReceived)) notifyAudioTask(); // data for the decoder
 
     if (m_f_firstLoop) {
         m_f_firstLoop = false;
@@ -3846,6 +3909,15 @@ void Audio::processLocalFile() {
         m_audioDataStart = 0;
         m_f_allDataReceived = false;
         m_prlf.timeout = 8000; // ms
+        if (m_gpls.headLen) {  // gapless switch, primeNextFS() has read the head, the file is positioned behind it
+            uint32_t n = min((uint32_t)InBuff.writeSpace(), m_gpls.headLen);
+            if (n < m_gpls.headLen) m_audiofile.seek(n); // small InBuff without PSRAM
+            memcpy(InBuff.getWritePtr(), m_nextHead.get(), n);
+            InBuff.bytesWritten(n);
+            m_audioFilePosition = n;
+            m_gpls.headLen = 0;
+            m_nextHead.reset();
+        }
     }
 
     if (m_resumeFilePos >= 0) { // we have a resume file position
@@ -3881,12 +3953,18 @@ void Audio::processLocalFile() {
                 m_f_running = false;
                 goto exit;
             }
-            if (InBuff.bufferFilled() > m_prlf.maxFrameSize || (InBuff.bufferFilled() == m_audioFileSize) || m_f_allDataReceived) { // at least one complete frame or the file is smaller
-                InBuff.bytesWasRead(readAudioHeader(InBuff.getMaxAvailableBytes()));
+            // as many header steps as the buffered data allows, one step per loop() would add a loop period per ID3 frame
+            for (uint8_t i = 0; i < 64 && m_controlCounter != 100 && m_f_running; i++) {
+                if (!(InBuff.bufferFilled() > m_prlf.maxFrameSize || (InBuff.bufferFilled() == m_audioFileSize) || m_f_allDataReceived)) break; // at least one complete frame or the file is smaller
+                int    cc = m_controlCounter;
+                size_t n = readAudioHeader(InBuff.getMaxAvailableBytes());
+                InBuff.bytesWasRead(n);
+                if (!n && m_controlCounter == cc) break; // waits for data or a seek
             }
             if (m_controlCounter == 100) {
                 if (m_audioDataStart > 0) { m_prlf.audioHeaderFound = true; }
                 if (!m_audioDataSize) m_audioDataSize = m_audioFileSize;
+                buildSeekIndex();
             }
             return;
         } else {
@@ -3895,17 +3973,24 @@ void Audio::processLocalFile() {
         }
     }
 
-    if (m_fileStartTime > 0 && m_nominal_bitrate) {
-        if (getBitRate() > 0)
+    if (m_fileStartTime > 0 && (m_nominal_bitrate || m_seekIndex->isComplete())) {
+        if (getBitRate() > 0 || m_seekIndex->isComplete())
             setAudioPlayTime(m_fileStartTime);
         else
             info(*this, evt_info, "can't set audio play time directly");
         m_fileStartTime = -1;
     }
 
+    if (m_f_allDataReceived && m_nextFile && !m_gpls.f_primed && !m_f_eof) primeNextFS(); // the rest of this file is in InBuff
+
     // end of file reached? - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    if (m_f_eof) { // m_f_eof and m_f_ID3v1TagFound will be set in playAudioData()
+    if (m_f_eof) {                  // m_f_eof and m_f_ID3v1TagFound will be set in playAudioData()
+        if (m_validSamples) return; // the tail of the last frame is still on its way to I2S
         if (m_f_ID3v1TagFound) readID3V1Tag();
+        if (m_nextFile) { // gapless, the I2S DMA plays the tail of this file while the next one is started
+            openNextFS();
+            return;
+        }
     exit:
         ps_ptr<char> afn("afn");                         // audio file name
         if (m_audiofile) afn.assign(m_audiofile.name()); // store temporary the name
@@ -3928,7 +4013,7 @@ void Audio::processWebStream() {
 
     m_pwst.maxFrameSize = InBuff.getMaxBlockSize(); // every mp3/aac frame is not bigger
     m_pwst.availableBytes = 0;                      // available from stream
-    m_pwst.f_clientIsConnected = m_client->connected();
+    m_pwst.f_clientIsConnected = clientConnected();
 
     // first call, set some values to default  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     if (m_f_firstCall) { // runs only ont time per connection, prepare for start
@@ -3940,8 +4025,14 @@ void Audio::processWebStream() {
         readMetadata(0, &readedBytes, true);
         getChunkSize(0, true);
         m_audioFilePosition = 0;
+        m_f_netResume = false;
+        m_netPrefetch.start(m_client); // from now on the network is read by the prefetch task
     }
-    if (m_pwst.f_clientIsConnected) m_pwst.availableBytes = m_client->available(); // available from stream
+    if (m_f_netResume) { // reconnected by httpPrint(), the new response header is parsed
+        m_f_netResume = false;
+        m_netPrefetch.start(m_client);
+    }
+    if (m_pwst.f_clientIsConnected) m_pwst.availableBytes = clientAvailable(); // available from stream
 
     // chunked data tramsfer
     if (m_f_chunked && m_pwst.availableBytes) {
@@ -4083,7 +4174,8 @@ void Audio::processWebFile() {
     }
 
     // end of file reached? - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    if (m_f_eof) { // m_f_eof and m_f_ID3v1TagFound will be set in playAudioData()
+    if (m_f_eof) {                  // m_f_eof and m_f_ID3v1TagFound will be set in playAudioData()
+        if (m_validSamples) return; // the tail of the last frame is still on its way to I2S
         if (m_f_ID3v1TagFound) readID3V1Tag();
     exit:
         stopSong();
@@ -4347,6 +4439,10 @@ void Audio::processWebStreamHLS() {
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void Audio::playAudioData() {
 
+    if (m_f_eof && m_validSamples && m_f_running && !m_f_lockInBuffer) {
+        playChunk();
+        return;
+    } // the last frame is not completely written yet, processLocalFile() waits for it
     if (!m_f_stream || m_f_eof || m_f_lockInBuffer || !m_f_running) {
         m_validSamples = 0;
         return;
@@ -4414,8 +4510,8 @@ void Audio::playAudioData() {
             m_f_eof = true;
             goto exit;
         } // end of file reached
-        m_pad.count++;
-        vTaskDelay(50); // wait for data
+        m_pad.count++; // audioTask() waits up to 50ms for data, see waitAudioEvent()
+        if (m_pad.count == 1 && m_f_stream) m_bHea.underruns++;
         if (m_pad.count == 10) {
             if (m_f_allDataReceived) m_f_eof = true;
         } // maybe slow stream
@@ -4499,7 +4595,7 @@ bool Audio::parseHttpResponseHeader() { // this is the response to a GET / reque
             }
         } // inner while
         if (!pos) {
-            vTaskDelay(5);
+            vTaskDelay(5); // no header bytes yet, runs on the loop task, waitAudioEvent() belongs to the audio task
             continue;
         }
 
@@ -4757,7 +4853,7 @@ bool Audio::parseHttpRangeHeader() { // this is the response to a Range request
             }
         } // inner while
         if (!pos) {
-            vTaskDelay(5);
+            vTaskDelay(5); // no header bytes yet, runs on the loop task, waitAudioEvent() belongs to the audio task
             continue;
         }
         // AUDIO_LOG_WARN("rh %s", rhl.c_get());
@@ -4836,8 +4932,19 @@ bool Audio::initializeDecoder() {
             break;
     }
 
-    if (type) {
+    if (type && m_nextDecoder && !strcmp(type, m_gpls.decoderType)) { // gapless switch, primeNextFS() has created and initialized it
+        m_dPrf = {};
+        m_dPrf.heap = m_gpls.heap;
+        m_decoder = std::move(m_nextDecoder);
+        m_gpls.decoderType = nullptr;
+    } else if (type) {
+        if (m_nextDecoder) {
+            ps_heap_use_t use(&m_gpls.heap);
+            m_nextDecoder->reset();
+            m_nextDecoder.reset();
+        }
         m_decoder = createDecoder(type);
+        ps_heap_use_t use(&m_dPrf.heap);
         if (!m_decoder || !m_decoder->init()) {
             AUDIO_LOG_ERROR("The %sDecoder could not be initialized", type);
             stopSong();
@@ -5233,7 +5340,7 @@ void Audio::setDecoderItems() {
         stopSong();
     }
 
-    memset(m_filterBuff, 0, sizeof(m_filterBuff));        // Clear FilterBuffer
+    memset(m_biquadState, 0, sizeof(m_biquadState));      // Clear FilterBuffer
     IIR_calculateCoefficients(m_gain0, m_gain1, m_gain2); // must be recalculated after each samplerate change
     showCodecParams();
 }
@@ -5256,6 +5363,7 @@ uint32_t Audio::decodeError(int8_t res, uint8_t* data, int32_t bytesDecoded) {
                 info(*this, evt_info, "AAC channel config changed to %d", m_sbyt.channels);
             }
         }
+        ps_heap_use_t use(&m_dPrf.heap);
         m_decoder->reset();
         m_decoder->init();
         return 0;
@@ -5304,7 +5412,12 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
     if (!m_f_decode_ready) return 0;                                        // find sync first
 
     //-----------------------------------------------------------------
-    res = m_decoder->decode(data, &m_sbyt.bytesLeft, m_outBuff.get());
+    uint32_t t = esp_cpu_get_cycle_count();
+    {
+        ps_heap_use_t use(&m_dPrf.heap);
+        res = m_decoder->decode(data, &m_sbyt.bytesLeft, m_outBuff.get());
+    }
+    t = esp_cpu_get_cycle_count() - t;
     bytesDecoded = len - m_sbyt.bytesLeft;
     //-----------------------------------------------------------------
 
@@ -5324,6 +5437,10 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
         return 1;
     }
     // status: bytesDecoded > 0 and res >= 0
+    m_dPrf.frames++;
+    m_dPrf.decodeCycles += t;
+    if (t > m_dPrf.maxCycles) m_dPrf.maxCycles = t;
+
     const char*           st = NULL;
     std::vector<uint32_t> vec;
     switch (m_codec) {
@@ -5397,7 +5514,11 @@ int Audio::sendBytes(uint8_t* data, size_t len) {
     calculateAudioTime(bytesDecoded, bytesDecoderOut);
 
     m_curSample = 0;
-    if (m_validSamples) { playChunk(); }
+    if (m_validSamples) {
+        t = esp_cpu_get_cycle_count();
+        playChunk();
+        m_dPrf.outputCycles += esp_cpu_get_cycle_count() - t;
+    }
     return bytesDecoded;
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -5448,12 +5569,19 @@ void Audio::calculateAudioTime(uint16_t bytesDecoderIn, uint16_t bytesDecoderOut
         }
         m_cat.deltaBytesIn = 0;
         m_audioCurrentTime = round(audioCurrentTime);
+
+        uint32_t sample, rate = m_seekIndex->getRate(); // seek index: time from the frame positions, exact on VBR files
+        if (m_seekIndex->sampleAt(m_cat.sumBytesIn, sample)) m_audioCurrentTime = (sample + rate / 2) / rate;
+        if (m_seekIndex->getTotalSamples()) m_audioFileDuration = (m_seekIndex->getTotalSamples() + rate / 2) / rate;
     }
 
-    if (m_haveNewFilePos && (m_cat.avrBitRate || m_cat.nominalBitRate)) {
+    if (m_haveNewFilePos && (m_cat.avrBitRate || m_cat.nominalBitRate || m_seekSample >= 0)) {
         uint32_t posWhithinAudioBlock = m_haveNewFilePos - m_audioDataStart;
         float    newTime = 0;
-        if (m_cat.nominalBitRate) {
+        if (m_seekSample >= 0 && m_seekIndex->getRate()) { // indexed seek, the sample of the landed frame is known
+            newTime = (float)m_seekSample / m_seekIndex->getRate();
+            m_seekSample = -1;
+        } else if (m_cat.nominalBitRate) {
             newTime = (float)posWhithinAudioBlock / (m_cat.nominalBitRate / 8);
         } else {
             newTime = (float)posWhithinAudioBlock / (m_cat.avrBitRate / 8);
@@ -5484,8 +5612,10 @@ void Audio::calculateAudioTime(uint16_t bytesDecoderIn, uint16_t bytesDecoderOut
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 bool Audio::setPinout(uint8_t BCLK, uint8_t LRC, uint8_t DOUT, int8_t MCLK, int8_t DIN) {
     m_f_psramFound = psramInit();
-    m_outBuff.alloc(m_outbuffSize, "m_outBuff");
-    m_samplesBuff48K.alloc(m_samplesBuff48KSize * sizeof(int16_t));
+    m_outBuff.set_class(PS_WARM); // every decoded frame passes through it
+    m_outBuff.alloc(m_outbuffSize * sizeof(int16_t), "m_outBuff");
+    m_samplesBuff48K.set_class(PS_COLD); // 256 KB, more than the internal RAM can spare; the resampler and I2S stream through it once per sample
+    m_samplesBuff48K.alloc(m_samplesBuff48KSize * sizeof(int16_t), "m_samplesBuff48K");
 
     if (!m_i2s_tx_handle || !m_i2s_rx_handle) return false;
 
@@ -5517,7 +5647,7 @@ uint32_t Audio::getFileSize() { // returns the size of webfile or local file
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 uint32_t Audio::getAudioFileDuration() {
-    if (!getBitRate()) return 0;
+    if (!getBitRate() && !m_seekIndex->isComplete()) return 0;
     if (m_playlistFormat == FORMAT_M3U8) return 0;
     if (!m_audioDataSize) return 0;
     return m_audioFileDuration;
@@ -5555,14 +5685,16 @@ bool Audio::setAudioFilePosition(uint32_t pos) {
         m_resumeFilePos = m_audioDataStart;
     }
     m_resumeFilePos = pos;
+    m_seekTarget = -1;
     return true;
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 bool Audio::setAudioPlayTime(uint16_t sec) {
     // e.g. setAudioPlayTime(300) sets the pointer at pos 5 min
     if ((m_dataMode != AUDIO_LOCALFILE) && (m_streamType != ST_WEBFILE)) return false; // guard
-    if (!getBitRate()) return false;                                                   // guard
     if (!m_f_running) return false;                                                    // guard
+    if (seekToTime(sec)) return true;                                                  // seek index or Xing/VBRI TOC
+    if (!getBitRate()) return false;                                                   // guard
 
     if (sec > getAudioFileDuration()) sec = getAudioFileDuration();
     uint32_t filepos = m_audioDataStart + (getBitRate() * sec / 8);
@@ -5576,8 +5708,8 @@ bool Audio::setTimeOffset(int sec) { // fast forward or rewind the current posit
         AUDIO_LOG_WARN("%s", "not a file");
         return false;
     } // guard
-    if (!getBitRate()) return false; // guard
-    if (!m_f_running) return false;  // guard
+    if (!getBitRate() && !m_seekIndex->isComplete()) return false; // guard
+    if (!m_f_running) return false;                                // guard
 
     int32_t newTime = getAudioCurrentTime() + sec;
     if (newTime < 0) newTime = 0;
@@ -5585,15 +5717,95 @@ bool Audio::setTimeOffset(int sec) { // fast forward or rewind the current posit
         stopSong();
         return true;
     }
+    if (seekToTime(newTime)) return true;
 
     uint32_t oneSec = getBitRate() / 8; // bytes decoded in one sec
     int32_t  offset = oneSec * sec;     // bytes to be wind/rewind
     int32_t  pos = m_audioFilePosition - inBufferFilled();
     pos += offset;
     m_resumeFilePos = pos;
+    m_seekTarget = -1;
     return true;
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool Audio::seekToTime(uint32_t sec) {
+    // local MP3, FLAC, M4A: m_resumeFilePos becomes the index point before the target, newInBuffStart() hops from there
+    // to the frame that contains the target. MP3 with a Xing/VBRI TOC: the position between the two points around the
+    // target, mp3_correctResumeFilePos() syncs (the TOC entries until their frames are found)
+    if (m_dataMode != AUDIO_LOCALFILE) return false;
+    uint32_t rate = m_seekIndex->getRate();
+    m_seekTarget = -1;
+    if (!rate || sec >= UINT32_MAX / rate) return false;
+    SeekIndex::point_t p;
+    uint32_t           target = sec * rate, pos;
+    if (m_seekIndex->getTotalSamples() && target >= m_seekIndex->getTotalSamples()) target = m_seekIndex->getTotalSamples() - 1;
+    if (m_seekIndex->isSparse()) {
+        if (!m_seekIndex->posAt(target, pos)) return false;
+        m_resumeFilePos = m_audioDataStart + pos;
+        return true;
+    }
+    if (target <= INT32_MAX && m_seekIndex->lookup(target, p)) {
+        m_seekTarget = target;
+        m_seekSample = p.sample;
+        m_resumeFilePos = m_audioDataStart + p.pos;
+        return true;
+    }
+    return false;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void Audio::buildSeekIndex() { // the audio header is read, index the frames behind it
+    if (m_dataMode != AUDIO_LOCALFILE) return;
+    if (m_codec == CODEC_MP3 && InBuff.bufferFilled() >= 4) {
+        uint32_t spf, rate;
+        if (SeekIndex::mp3FrameLen(InBuff.getReadPtr(), &spf, &rate)) m_seekIndex->build(SeekIndex::SIDX_MP3, m_audioDataStart, m_audioDataSize, rate, 0, m_mp3TocSamples);
+    }
+    if (m_codec == CODEC_FLAC && !m_f_ogg) {
+        m_seekIndex->build(SeekIndex::SIDX_FLAC, m_audioDataStart, m_audioDataSize, m_rflh.sampleRate, m_rflh.maxBlockSize, m_rflh.totalSamplesInStream,
+                           m_rflh.minFrameSize);
+    }
+    if (m_codec == CODEC_M4A && m_stsz_position) {
+        m_seekIndex->build(SeekIndex::SIDX_M4A, m_audioDataStart, m_audioDataSize, m_M4A_sampleRate ? m_M4A_sampleRate : 44100, m_stsz_position, m_stsz_numEntries);
+    }
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+int32_t Audio::indexedResumeOffset() {
+    // InBuff starts at a frame with the first sample m_seekSample, hop over whole frames to the one that contains m_seekTarget
+    uint8_t* p = InBuff.getReadPtr();
+    uint32_t filled = InBuff.bufferFilled();
+    uint32_t pos = 0, sample = m_seekSample, target = m_seekTarget;
+    uint32_t n, rate, bs;
+    if (m_codec == CODEC_MP3) {
+        if (!SeekIndex::mp3FrameLen(p, &n, &rate)) { // stale index, sync the old way
+            m_seekSample = -1;
+            return mp3_correctResumeFilePos();
+        }
+        while (pos + 4 <= filled) {
+            int32_t len = SeekIndex::mp3FrameLen(p + pos, &n, &rate);
+            if (!len || sample + n > target || pos + len + 4 > filled) break;
+            sample += n;
+            pos += len;
+        }
+    }
+    if (m_codec == CODEC_FLAC) {
+        if (!SeekIndex::flacFrameHeader(p, filled, m_rflh.maxBlockSize, &sample, &bs, &rate)) {
+            m_seekSample = -1;
+            return flac_correctResumeFilePos();
+        }
+        while (sample + bs <= target) { // next frame: the header whose first sample continues this frame
+            uint32_t q = pos + (m_rflh.minFrameSize > 2 ? m_rflh.minFrameSize : 2), s1 = 0, bs1 = 0;
+            for (; q + SeekIndex::FLAC_MAX_HEADER <= filled; q++) {
+                if (p[q] == 0xFF && SeekIndex::flacFrameHeader(p + q, filled - q, m_rflh.maxBlockSize, &s1, &bs1, &rate) && s1 == sample + bs) break;
+            }
+            if (q + SeekIndex::FLAC_MAX_HEADER > filled) break; // end of the buffer, play from here
+            pos = q;
+            sample = s1;
+            bs = bs1;
+        }
+    }
+    m_seekSample = sample;
+    return pos;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void Audio::setVolumeSteps(uint8_t steps) {
     m_vol_steps = steps;
     if (steps < 1) m_vol_steps = 64; /* avoid div-by-zero :-) */
@@ -5615,7 +5827,7 @@ int32_t Audio::audioFileRead(uint8_t* buff, size_t len) {
             res = m_audiofile.read();
             if (res >= 0) m_audioFilePosition++;
         } else {
-            res = m_client->read();
+            res = m_netPrefetch.isActive() ? m_netPrefetch.read(nullptr, 0) : m_client->read();
             if (res >= 0) m_audioFilePosition++;
         }
     } else { // read len
@@ -5633,7 +5845,7 @@ int32_t Audio::audioFileRead(uint8_t* buff, size_t len) {
                 }
                 if (readed_bytes <= 0) break;
             } else {
-                readed_bytes = m_client->read(buff + offset, len);
+                readed_bytes = m_netPrefetch.isActive() ? m_netPrefetch.read(buff + offset, len) : m_client->read(buff + offset, len);
                 if (readed_bytes >= 0) {
                     m_audioFilePosition += readed_bytes;
                     len -= readed_bytes;
@@ -5649,6 +5861,7 @@ int32_t Audio::audioFileRead(uint8_t* buff, size_t len) {
                 break;
             }
         }
+        m_bHea.bytes += offset;
     }
     return res;
 }
@@ -5723,6 +5936,9 @@ bool Audio::setSampleRate(uint32_t sampRate) {
     m_sampleRate = sampRate;
     }
     m_i2s_std_cfg.clk_cfg.sample_rate_hz = m_sampleRate;
+#ifdef SR_48K
+    m_resampler.setInputRate(m_sampleRate); // build the phase table outside the play loop
+#endif
 
     i2s_channel_disable(m_i2s_tx_handle);
     i2s_channel_disable(m_i2s_rx_handle);
@@ -5893,22 +6109,15 @@ void Audio::setTone(int8_t gainLowPass, int8_t gainBandPass, int8_t gainHighPass
     m_corr = pow10f((float)db / 20);
 
     IIR_calculateCoefficients(m_gain0, m_gain1, m_gain2);
-
-    /*
-          This will cause a clicking sound when adjusting the EQ.
-          Because when the EQ is adjusted, the IIR filter will be cleared and played,
-          mixed in the audio data frame, and a click-like sound will be produced.
-
-          int16_t tmp[2]; tmp[0] = 0; tmp[1]= 0;
-
-          IIR_filterChain0(tmp, true ); // flush the filter
-          IIR_filterChain1(tmp, true ); // flush the filter
-          IIR_filterChain2(tmp, true ); // flush the filter
-        */
+    // the filters keep their state while the gains change, a flush would click. A bypassed tone stage is not run,
+    // its state is the one of the moment it was bypassed, flush it before updateDspGraph() lets playChunk() run it again
+    if (!(m_dspGraph & DSP_TONE)) memset(m_biquadState, 0, sizeof(m_biquadState));
+    updateDspGraph();
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void Audio::forceMono(bool m) { // #100 mono option
     m_f_forceMono = m;          // false stereo, true mono
+    updateDspGraph();
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 void Audio::setBalance(int8_t bal) { // bal -16...16
@@ -5969,14 +6178,32 @@ void Audio::computeLimit() {    // is calculated when the volume or balance chan
 
     m_limit_left = l * v;
     m_limit_right = r * v;
+    updateDspGraph();
 
     // AUDIO_LOG_INFO("m_limit_left %f,  m_limit_right %f ",m_limit_left, m_limit_right);
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-void Audio::Gain(int16_t* sample) {
-    /* important: these multiplications must all be signed ints, or the result will be invalid */
-    sample[LEFTCHANNEL] *= m_limit_left;
-    sample[RIGHTCHANNEL] *= m_limit_right;
+void Audio::Gain(int16_t* block, int32_t frames) {
+    const int32_t gl = m_gainQ15[LEFTCHANNEL];
+    const int32_t gr = m_gainQ15[RIGHTCHANNEL];
+    for (int32_t i = 0; i < frames * 2; i += 2) {
+        block[i] = (int16_t)((block[i] * gl) >> 15);
+        block[i + 1] = (int16_t)((block[i + 1] * gr) >> 15);
+    }
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void Audio::updateDspGraph() { // called from setTone(), forceMono() and computeLimit() (volume, balance)
+    // playChunk() only runs the stages set here, identity stages cost nothing
+    uint8_t graph = DSP_VU;
+    if (m_gain0 || m_gain1 || m_gain2) graph |= DSP_TONE; // 0dB shelves and peak are identity
+    if (m_f_forceMono) graph |= DSP_MONO;
+
+    m_gainQ15[LEFTCHANNEL] = (int32_t)(m_limit_left * 32768);
+    m_gainQ15[RIGHTCHANNEL] = (int32_t)(m_limit_right * 32768);
+    if (m_gainQ15[LEFTCHANNEL] != 32768 || m_gainQ15[RIGHTCHANNEL] != 32768) graph |= DSP_GAIN; // full volume, centered balance
+
+    if (graph != m_dspGraph) AUDIO_LOG_DEBUG("DSP stages:%s%s%s%s", (graph & DSP_VU) ? " VU" : "", (graph & DSP_TONE) ? " tone" : "", (graph & DSP_MONO) ? " mono" : "", (graph & DSP_GAIN) ? " gain" : "");
+    m_dspGraph = graph;
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 uint32_t Audio::inBufferFilled() {
@@ -6108,124 +6335,52 @@ void Audio::IIR_calculateCoefficients(int8_t G0, int8_t G1, int8_t G2) { // Infi
     //                                                  m_filter[2].b1, m_filter[2].b2);
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-void Audio::IIR_filterChain0(int16_t iir_in[2], bool clear) { // Infinite Impulse Response (IIR) filters
-
-    uint8_t z1 = 0, z2 = 1;
-    enum : uint8_t { in = 0, out = 1 };
-
-    if (clear) {
-        memset(m_filterBuff, 0, sizeof(m_filterBuff)); // zero IIR filterbuffer
-        m_ifCh.iir_out0[0] = 0;
-        m_ifCh.iir_out0[1] = 0;
-        iir_in[0] = 0;
-        iir_in[1] = 0;
-    }
-
-    m_ifCh.inSample0[LEFTCHANNEL] = (float)(iir_in[LEFTCHANNEL]);
-    m_ifCh.inSample0[RIGHTCHANNEL] = (float)(iir_in[RIGHTCHANNEL]);
-
-    m_ifCh.outSample0[LEFTCHANNEL] = m_filter[0].a0 * m_ifCh.inSample0[LEFTCHANNEL] + m_filter[0].a1 * m_filterBuff[0][z1][in][LEFTCHANNEL] + m_filter[0].a2 * m_filterBuff[0][z2][in][LEFTCHANNEL] -
-                                     m_filter[0].b1 * m_filterBuff[0][z1][out][LEFTCHANNEL] - m_filter[0].b2 * m_filterBuff[0][z2][out][LEFTCHANNEL];
-
-    m_filterBuff[0][z2][in][LEFTCHANNEL] = m_filterBuff[0][z1][in][LEFTCHANNEL];
-    m_filterBuff[0][z1][in][LEFTCHANNEL] = m_ifCh.inSample0[LEFTCHANNEL];
-    m_filterBuff[0][z2][out][LEFTCHANNEL] = m_filterBuff[0][z1][out][LEFTCHANNEL];
-    m_filterBuff[0][z1][out][LEFTCHANNEL] = m_ifCh.outSample0[LEFTCHANNEL];
-    m_ifCh.iir_out0[LEFTCHANNEL] = (int16_t)m_ifCh.outSample0[LEFTCHANNEL];
-
-    m_ifCh.outSample0[RIGHTCHANNEL] = m_filter[0].a0 * m_ifCh.inSample0[RIGHTCHANNEL] + m_filter[0].a1 * m_filterBuff[0][z1][in][RIGHTCHANNEL] +
-                                      m_filter[0].a2 * m_filterBuff[0][z2][in][RIGHTCHANNEL] - m_filter[0].b1 * m_filterBuff[0][z1][out][RIGHTCHANNEL] -
-                                      m_filter[0].b2 * m_filterBuff[0][z2][out][RIGHTCHANNEL];
-
-    m_filterBuff[0][z2][in][RIGHTCHANNEL] = m_filterBuff[0][z1][in][RIGHTCHANNEL];
-    m_filterBuff[0][z1][in][RIGHTCHANNEL] = m_ifCh.inSample0[RIGHTCHANNEL];
-    m_filterBuff[0][z2][out][RIGHTCHANNEL] = m_filterBuff[0][z1][out][RIGHTCHANNEL];
-    m_filterBuff[0][z1][out][RIGHTCHANNEL] = m_ifCh.outSample0[RIGHTCHANNEL];
-    m_ifCh.iir_out0[RIGHTCHANNEL] = (int16_t)m_ifCh.outSample0[RIGHTCHANNEL];
-
-    iir_in[LEFTCHANNEL] = m_ifCh.iir_out0[LEFTCHANNEL];
-    iir_in[RIGHTCHANNEL] = m_ifCh.iir_out0[RIGHTCHANNEL];
-    return;
-}
-// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-void Audio::IIR_filterChain1(int16_t iir_in[2], bool clear) { // Infinite Impulse Response (IIR) filters
-
-    uint8_t z1 = 0, z2 = 1;
-    enum : uint8_t { in = 0, out = 1 };
-
-    if (clear) {
-        memset(m_filterBuff, 0, sizeof(m_filterBuff)); // zero IIR filterbuffer
-        m_ifCh.iir_out1[0] = 0;
-        m_ifCh.iir_out1[1] = 0;
-        iir_in[0] = 0;
-        iir_in[1] = 0;
+void IRAM_ATTR Audio::IIR_filterBlock(int16_t* block, int32_t frames) { // Infinite Impulse Response (IIR) filters, LS -> EQ -> HS
+    // deinterleave once, run the three biquads over each channel, interleave and saturate once
+    // filter_t {a0, a1, a2, b1, b2} has the same layout as the esp-dsp coefficient array {b0, b1, b2, a1, a2}
+    const float pre = (m_corr > 1) ? 1.0f / m_corr : 1.0f; // attenuation to make room for the boost
+    float*      ch[2] = {m_dspBuff[LEFTCHANNEL], m_dspBuff[RIGHTCHANNEL]};
+
+    for (int32_t i = 0; i < frames; i++) {
+        ch[LEFTCHANNEL][i] = (float)block[i * 2] * pre;
+        ch[RIGHTCHANNEL][i] = (float)block[i * 2 + 1] * pre;
+    }
+    for (uint8_t f = 0; f < 3; f++) {
+#ifdef AUDIO_ESP_DSP
+        for (uint8_t c = 0; c < 2; c++) dsps_biquad_f32(ch[c], ch[c], frames, (float*)&m_filter[f], m_biquadState[f][c]);
+#else
+        // coefficients and state in locals, the stores to m_dspBuff could alias members and would reload them per sample;
+        // both channels in one loop, two independent recursions keep the FPU busy
+        const float a0 = m_filter[f].a0, a1 = m_filter[f].a1, a2 = m_filter[f].a2, b1 = m_filter[f].b1, b2 = m_filter[f].b2;
+        float       l0 = m_biquadState[f][LEFTCHANNEL][0], l1 = m_biquadState[f][LEFTCHANNEL][1]; // direct form II
+        float       r0 = m_biquadState[f][RIGHTCHANNEL][0], r1 = m_biquadState[f][RIGHTCHANNEL][1];
+        float*      xl = ch[LEFTCHANNEL];
+        float*      xr = ch[RIGHTCHANNEL];
+        for (int32_t i = 0; i < frames; i++) {
+            float dl = xl[i] - b1 * l0 - b2 * l1;
+            float dr = xr[i] - b1 * r0 - b2 * r1;
+            xl[i] = a0 * dl + a1 * l0 + a2 * l1;
+            xr[i] = a0 * dr + a1 * r0 + a2 * r1;
+            l1 = l0;
+            l0 = dl;
+            r1 = r0;
+            r0 = dr;
+        }
+        m_biquadState[f][LEFTCHANNEL][0] = l0;
+        m_biquadState[f][LEFTCHANNEL][1] = l1;
+        m_biquadState[f][RIGHTCHANNEL][0] = r0;
+        m_biquadState[f][RIGHTCHANNEL][1] = r1;
+#endif
     }
-
-    m_ifCh.inSample1[LEFTCHANNEL] = (float)(iir_in[LEFTCHANNEL]);
-    m_ifCh.inSample1[RIGHTCHANNEL] = (float)(iir_in[RIGHTCHANNEL]);
-
-    m_ifCh.outSample1[LEFTCHANNEL] = m_filter[1].a0 * m_ifCh.inSample1[LEFTCHANNEL] + m_filter[1].a1 * m_filterBuff[1][z1][in][LEFTCHANNEL] + m_filter[1].a2 * m_filterBuff[1][z2][in][LEFTCHANNEL] -
-                                     m_filter[1].b1 * m_filterBuff[1][z1][out][LEFTCHANNEL] - m_filter[1].b2 * m_filterBuff[1][z2][out][LEFTCHANNEL];
-
-    m_filterBuff[1][z2][in][LEFTCHANNEL] = m_filterBuff[1][z1][in][LEFTCHANNEL];
-    m_filterBuff[1][z1][in][LEFTCHANNEL] = m_ifCh.inSample1[LEFTCHANNEL];
-    m_filterBuff[1][z2][out][LEFTCHANNEL] = m_filterBuff[1][z1][out][LEFTCHANNEL];
-    m_filterBuff[1][z1][out][LEFTCHANNEL] = m_ifCh.outSample1[LEFTCHANNEL];
-    m_ifCh.iir_out1[LEFTCHANNEL] = (int16_t)m_ifCh.outSample1[LEFTCHANNEL];
-
-    m_ifCh.outSample1[RIGHTCHANNEL] = m_filter[1].a0 * m_ifCh.inSample1[RIGHTCHANNEL] + m_filter[1].a1 * m_filterBuff[1][z1][in][RIGHTCHANNEL] +
-                                      m_filter[1].a2 * m_filterBuff[1][z2][in][RIGHTCHANNEL] - m_filter[1].b1 * m_filterBuff[1][z1][out][RIGHTCHANNEL] -
-                                      m_filter[1].b2 * m_filterBuff[1][z2][out][RIGHTCHANNEL];
-
-    m_filterBuff[1][z2][in][RIGHTCHANNEL] = m_filterBuff[1][z1][in][RIGHTCHANNEL];
-    m_filterBuff[1][z1][in][RIGHTCHANNEL] = m_ifCh.inSample1[RIGHTCHANNEL];
-    m_filterBuff[1][z2][out][RIGHTCHANNEL] = m_filterBuff[1][z1][out][RIGHTCHANNEL];
-    m_filterBuff[1][z1][out][RIGHTCHANNEL] = m_ifCh.outSample1[RIGHTCHANNEL];
-    m_ifCh.iir_out1[RIGHTCHANNEL] = (int16_t)m_ifCh.outSample1[RIGHTCHANNEL];
-
-    iir_in[LEFTCHANNEL] = m_ifCh.iir_out1[LEFTCHANNEL];
-    iir_in[RIGHTCHANNEL] = m_ifCh.iir_out1[RIGHTCHANNEL];
-    return;
-}
-// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-void Audio::IIR_filterChain2(int16_t iir_in[2], bool clear) { // Infinite Impulse Response (IIR) filters
-
-    uint8_t z1 = 0, z2 = 1;
-    enum : uint8_t { in = 0, out = 1 };
-
-    if (clear) {
-        memset(m_filterBuff, 0, sizeof(m_filterBuff)); // zero IIR filterbuffer
-        m_ifCh.iir_out2[0] = 0;
-        m_ifCh.iir_out2[1] = 0;
-        iir_in[0] = 0;
-        iir_in[1] = 0;
+    auto sat16 = [](float v) -> int16_t {
+        if (v > 32767.0f) return 32767;
+        if (v < -32768.0f) return -32768;
+        return (int16_t)v;
+    };
+    for (int32_t i = 0; i < frames; i++) {
+        block[i * 2] = sat16(ch[LEFTCHANNEL][i]);
+        block[i * 2 + 1] = sat16(ch[RIGHTCHANNEL][i]);
     }
-
-    m_ifCh.inSample2[LEFTCHANNEL] = (float)(iir_in[LEFTCHANNEL]);
-    m_ifCh.inSample2[RIGHTCHANNEL] = (float)(iir_in[RIGHTCHANNEL]);
-
-    m_ifCh.outSample2[LEFTCHANNEL] = m_filter[2].a0 * m_ifCh.inSample2[LEFTCHANNEL] + m_filter[2].a1 * m_filterBuff[2][z1][in][LEFTCHANNEL] + m_filter[2].a2 * m_filterBuff[2][z2][in][LEFTCHANNEL] -
-                                     m_filter[2].b1 * m_filterBuff[2][z1][out][LEFTCHANNEL] - m_filter[2].b2 * m_filterBuff[2][z2][out][LEFTCHANNEL];
-
-    m_filterBuff[2][z2][in][LEFTCHANNEL] = m_filterBuff[2][z1][in][LEFTCHANNEL];
-    m_filterBuff[2][z1][in][LEFTCHANNEL] = m_ifCh.inSample2[LEFTCHANNEL];
-    m_filterBuff[2][z2][out][LEFTCHANNEL] = m_filterBuff[2][z1][out][LEFTCHANNEL];
-    m_filterBuff[2][z1][out][LEFTCHANNEL] = m_ifCh.outSample2[LEFTCHANNEL];
-    m_ifCh.iir_out2[LEFTCHANNEL] = (int16_t)m_ifCh.outSample2[LEFTCHANNEL];
-
-    m_ifCh.outSample2[RIGHTCHANNEL] = m_filter[2].a0 * m_ifCh.inSample2[RIGHTCHANNEL] + m_filter[2].a1 * m_filterBuff[2][z1][in][RIGHTCHANNEL] +
-                                      m_filter[2].a2 * m_filterBuff[2][z2][in][RIGHTCHANNEL] - m_filter[2].b1 * m_filterBuff[2][z1][out][RIGHTCHANNEL] -
-                                      m_filter[2].b2 * m_filterBuff[2][z2][out][RIGHTCHANNEL];
-
-    m_filterBuff[2][z2][in][RIGHTCHANNEL] = m_filterBuff[2][z1][in][RIGHTCHANNEL];
-    m_filterBuff[2][z1][in][RIGHTCHANNEL] = m_ifCh.inSample2[RIGHTCHANNEL];
-    m_filterBuff[2][z2][out][RIGHTCHANNEL] = m_filterBuff[2][z1][out][RIGHTCHANNEL];
-    m_filterBuff[2][z1][out][RIGHTCHANNEL] = m_ifCh.outSample2[RIGHTCHANNEL];
-    m_ifCh.iir_out2[RIGHTCHANNEL] = (int16_t)m_ifCh.outSample2[RIGHTCHANNEL];
-
-    iir_in[LEFTCHANNEL] = m_ifCh.iir_out2[LEFTCHANNEL];
-    iir_in[RIGHTCHANNEL] = m_ifCh.iir_out2[RIGHTCHANNEL];
-    return;
 }
 
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————-
@@ -6524,7 +6679,7 @@ int32_t Audio::getChunkSize(uint16_t* readedBytes, bool first) {
     if (m_gchs.f_skipCRLF) {
         uint32_t t = millis();
 
-        if (m_client->available() == 1 && !m_gchs.oneByteOfTwo) {
+        if (clientAvailable() == 1 && !m_gchs.oneByteOfTwo) {
             int a = audioFileRead();
             m_gchs.oneByteOfTwo = true;
             *readedBytes = 1;
@@ -6536,14 +6691,14 @@ int32_t Audio::getChunkSize(uint16_t* readedBytes, bool first) {
             int a = audioFileRead();
             if (a != 0x0D) AUDIO_LOG_WARN("chunk count error, expected: 0x0D, received: 0x%02X", a);
             *readedBytes += 1;
-            if (!m_client->available()) { return -1; }
+            if (!clientAvailable()) { return -1; }
         }
         m_gchs.oneByteOfTwo = false;
         int b = audioFileRead();
         if (b != 0x0A) AUDIO_LOG_WARN("chunk count error, expected: 0x0A, received: 0x%02X", b);
         *readedBytes += 1;
         m_gchs.f_skipCRLF = false;
-        if (!m_client->available()) { return -1; }
+        if (!clientAvailable()) { return -1; }
     }
 
     // -------- HTTP-chunked-Read Logic --------
@@ -6556,7 +6711,7 @@ int32_t Audio::getChunkSize(uint16_t* readedBytes, bool first) {
             stopSong();
             return 0;
         }
-        if (!m_client->available()) continue;
+        if (!clientAvailable()) continue;
         int b = audioFileRead();
         if (b < 0) continue;
 
@@ -6572,7 +6727,7 @@ int32_t Audio::getChunkSize(uint16_t* readedBytes, bool first) {
             // We have no valid HTTP chunk line → assume transport chunking
             m_gchs.isHttpChunked = false;
             // determine limit from the current data volume + already read bytes
-            m_gchs.transportLimit = m_client->available() + *readedBytes;
+            m_gchs.transportLimit = clientAvailable() + *readedBytes;
             AUDIO_LOG_DEBUG("No http chunked recognized-switch to transport chunking with limit %u", (unsigned)m_gchs.transportLimit);
             return m_gchs.transportLimit;
         }
@@ -6694,7 +6849,9 @@ int32_t Audio::newInBuffStart(int32_t m_resumeFilePos) {
         m_f_allDataReceived = false;
 
         /* process before */
-        if (m_codec == CODEC_M4A) {
+        if (m_codec == CODEC_M4A && m_seekTarget >= 0) {
+            m_resumeFilePos = m4a_indexedResumeFilePos(m_resumeFilePos);
+        } else if (m_codec == CODEC_M4A) {
             m_resumeFilePos += m4a_correctResumeFilePos();
             if (m_resumeFilePos == -1) goto exit;
         }
@@ -6718,12 +6875,15 @@ int32_t Audio::newInBuffStart(int32_t m_resumeFilePos) {
                 if (m_resumeFilePos >= m_audioFileSize) goto exit;
             }
         } // must divisible by four
-        if (m_codec == CODEC_MP3) {
+        if ((m_codec == CODEC_MP3 || m_codec == CODEC_FLAC) && m_seekTarget >= 0) { // InBuff starts at a frame
+            offset = indexedResumeOffset();
+            if (offset == -1) goto exit;
+            m_decoder->clear();
+        } else if (m_codec == CODEC_MP3) {
             offset = mp3_correctResumeFilePos();
             if (offset == -1) goto exit;
             m_decoder->clear();
-        }
-        if (m_codec == CODEC_FLAC) {
+        } else if (m_codec == CODEC_FLAC) {
             offset = flac_correctResumeFilePos();
             if (offset == -1) goto exit;
             m_decoder->clear();
@@ -6742,9 +6902,12 @@ int32_t Audio::newInBuffStart(int32_t m_resumeFilePos) {
         InBuff.bytesWasRead(offset);
     }
     m_f_lockInBuffer = false;
+    if (m_seekTarget < 0) m_seekSample = -1; // calculateAudioTime() knows the sample of an indexed seek
+    m_seekTarget = -1;
     return res + offset;
 exit:
     m_f_lockInBuffer = false;
+    m_seekTarget = -1;
     stopSong();
     return offset;
 }
@@ -6784,6 +6947,22 @@ boolean Audio::streamDetection(uint32_t bytesAvail) {
     return false;
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————-
+uint32_t Audio::m4a_indexedResumeFilePos(uint32_t pos) {
+    // pos is the frame with the first sample m_seekSample, add the stsz sizes up to the frame that contains m_seekTarget
+    uint32_t frame = m_seekSample / 1024;
+    uint32_t last = m_seekTarget / 1024;
+    uint8_t  b[4];
+    if (last >= m_stsz_numEntries) last = m_stsz_numEntries - 1;
+    audioFileSeek(m_stsz_position + frame * 4);
+    while (frame < last) {
+        if (audioFileRead(b, 4) != 4) break;
+        pos += bigEndian(b, 4);
+        frame++;
+    }
+    m_seekSample = frame * 1024;
+    return pos;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 uint32_t Audio::m4a_correctResumeFilePos() {
     // In order to jump within an m4a file, the exact beginning of an aac block must be found. Since m4a cannot be
     // streamed, i.e. there is no syncword, an imprecise jump can lead to a crash.
@@ -7241,28 +7420,284 @@ void Audio::taskWrapper(void* param) {
 }
 
 void Audio::audioTask() {
+    m_tSta.start = esp_timer_get_time();
     while (m_f_audioTaskIsRunning) {
-        vTaskDelay(1 / portTICK_PERIOD_MS); // periodically every x ms
-        performAudioTask();
+        if (!performAudioTask()) { // nothing to do, sleep until the next event
+            waitAudioEvent(m_f_running ? 50 : 100);
+            m_tSta.wakeups++; // notified or timed out, loop passes that had work do not count
+        }
+
+        int64_t elapsed = esp_timer_get_time() - m_tSta.start;
+        if (elapsed >= 1000000) {
+            m_taskStats.idlePercent = (uint8_t)(m_tSta.blockedUs * 100 / elapsed);
+            m_taskStats.wakeupsPerSec = (uint16_t)((int64_t)m_tSta.wakeups * 1000000 / elapsed);
+            m_tSta.wakeups = 0;
+            m_tSta.blockedUs = 0;
+            m_tSta.start += elapsed;
+        }
     }
     vTaskDelete(nullptr); // Delete this task
 }
 
-void Audio::performAudioTask() {
-    if (!m_f_running) return;
-    if (!m_f_stream) return;
-    if (m_codec == CODEC_NONE) return; // wait for codec is  set
-    if (m_codec == CODEC_OGG) return;  // wait for FLAC, VORBIS or OPUS
+bool Audio::performAudioTask() { // true: go on at once, false: wait for DMA space or data
+    if (!m_f_running) return false;
+    if (!m_f_stream) return false;
+    if (m_codec == CODEC_NONE) return false; // wait for codec is  set
+    if (m_codec == CODEC_OGG) return false;  // wait for FLAC, VORBIS or OPUS
     xSemaphoreTake(mutex_audioTask, 0.3 * configTICK_RATE_HZ);
-    while (m_validSamples) {
-        vTaskDelay(20 / portTICK_PERIOD_MS);
-        playChunk();
-    } // I2S buffer full
-    playAudioData();
+    bool progress = false;
+    if (m_validSamples) playChunk(); // rest of the last chunk, the I2S write does not block
+    if (!m_validSamples) {
+        m_pad.bytesDecoded = 0; // stays 0 if playAudioData() returns at a guard
+        playAudioData();
+        progress = m_pad.bytesDecoded > 0 && !m_validSamples; // decoded and completely written, DMA has room for more
+    }
     xSemaphoreGive(mutex_audioTask);
+    return progress;
+}
+
+void Audio::waitAudioEvent(uint32_t ms) {
+    int64_t t = esp_timer_get_time();
+    m_dmaSentCnt = 0;
+    m_f_audioTaskWaiting = true;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+    m_f_audioTaskWaiting = false;
+    m_tSta.blockedUs += esp_timer_get_time() - t;
+}
+
+void Audio::notifyAudioTask() {
+    if (!m_audioTaskHandle) return;
+    m_f_audioTaskWaiting = false;
+    xTaskNotifyGive(m_audioTaskHandle);
+}
+
+bool IRAM_ATTR Audio::onI2sSent(i2s_chan_handle_t handle, i2s_event_data_t* event, void* user_ctx) { // ISR, one call per DMA buffer
+    Audio* a = static_cast<Audio*>(user_ctx);
+    if (!a->m_f_audioTaskWaiting || !a->m_audioTaskHandle) return false;
+    if (++a->m_dmaSentCnt < AUDIO_DMA_WAKE_BUFFERS) return false;
+    a->m_f_audioTaskWaiting = false;
+    BaseType_t hpTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(a->m_audioTaskHandle, &hpTaskWoken);
+    return hpTaskWoken == pdTRUE;
 }
 uint32_t Audio::getHighWatermark() {
     UBaseType_t highWaterMark = uxTaskGetStackHighWaterMark(m_audioTaskHandle);
     return highWaterMark; // dwords
 }
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// 📌📌📌  N E T W O R K   P R E F E T C H  📌📌📌
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// web streams only, net_prefetch/net_prefetch.h: while m_netPrefetch is active only its task touches m_client,
+// stopSong() and httpPrint() take it back before any reconnect
+
+int32_t Audio::clientAvailable() {
+    if (m_netPrefetch.isActive()) return m_netPrefetch.available();
+    return m_client->available();
+}
+
+bool Audio::clientConnected() {
+    if (m_netPrefetch.isActive()) return m_netPrefetch.connected();
+    return m_client->connected();
+}
+
+void Audio::setPrefetchWatermarks(uint8_t lowPercent, uint8_t highPercent) {
+    m_netPrefetch.setWatermarks(lowPercent, highPercent);
+}
+
+Audio::decoderStats_t Audio::getDecoderStats() {
+    decoderStats_t d;
+    uint32_t       mhz = getCpuFrequencyMhz();
+    d.frames = m_dPrf.frames;
+    if (m_dPrf.frames && m_dPrf.decodeCycles) {
+        d.framesPerSec = (uint64_t)m_dPrf.frames * mhz * 1000000 / m_dPrf.decodeCycles;
+        d.avgUs = m_dPrf.decodeCycles / m_dPrf.frames / mhz;
+        d.outputUs = m_dPrf.outputCycles / m_dPrf.frames / mhz;
+    }
+    d.maxUs = m_dPrf.maxCycles / mhz;
+    d.peakHeap = m_dPrf.heap.peak; // from the ps_ptr accounting, other tasks don't count
+    d.internalBytes = m_dPrf.internalBytes >= 0 ? m_dPrf.internalBytes : ps_placement_internal_bytes();
+    return d;
+}
+
+void Audio::setDecoderPlacement(bool enable) { // takes effect with the next decoder
+    m_f_placement = enable;
+}
+
+void Audio::reportDecoderPlacement() {
+    if (m_f_running) return; // the decoder belongs to the song
+    if (xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ) != pdTRUE) {
+        AUDIO_LOG_WARN("decoder placement: audio task busy, no report");
+        return;
+    }
+    const char* codecs[] = {"MP3", "FLAC", "OPUS", "AAC", "VORBIS"};
+    for (const char* c : codecs) {
+        m_decoder = createDecoder(c);
+        bool ok = false;
+        if (m_decoder) {
+            ps_heap_use_t use(&m_dPrf.heap); // the placement log notes the allocations of this scope
+            ok = m_decoder->init();
+        }
+        if (!ok) {
+            AUDIO_LOG_WARN("%s decoder: init failed", c);
+        } else {
+            ps_landing_t l[PS_PLACEMENT_LOG];
+            uint32_t     dropped = 0;
+            uint8_t      n = ps_placement_report(l, PS_PLACEMENT_LOG, &dropped);
+            if (!n) AUDIO_LOG_INFO("%s decoder: nothing allocated at init", c);
+            if (dropped) AUDIO_LOG_WARN("%s decoder: %lu blocks not in the placement log, PS_PLACEMENT_LOG / PS_PLACEMENT_BLOCKS too small", c, dropped);
+            for (uint8_t i = 0; i < n; i++) {
+                const char* cls = l[i].cls == PS_HOT ? "hot" : l[i].cls == PS_WARM ? "warm" : "cold";
+                AUDIO_LOG_INFO("%s decoder: %-16s %-4s %3u blocks, internal %6lu, PSRAM %6lu bytes", c, l[i].name, cls, l[i].blocks, l[i].internalBytes, l[i].psramBytes);
+            }
+        }
+        if (m_decoder) {
+            m_decoder->reset();
+            m_decoder.reset();
+        }
+    }
+    ps_placement_use(nullptr, 0);
+    AUDIO_LOG_INFO("m_outBuff %u bytes -> %s, m_samplesBuff48K %u bytes -> %s, internal heap free %u bytes", m_outBuff.size(), m_outBuff.is_internal() ? "internal" : "PSRAM",
+                   m_samplesBuff48K.size(), m_samplesBuff48K.is_internal() ? "internal" : "PSRAM", heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    xSemaphoreGiveRecursive(mutex_playAudioData);
+}
+
+void Audio::benchDecoderPlacement(fs::FS& fs, const char* path, uint32_t maxBytes) {
+    if (m_f_running) return; // the decoder belongs to the song
+    File f = fs.open(path);
+    if (!f) {
+        AUDIO_LOG_WARN("placement A/B: can't open %s", path);
+        return;
+    }
+    ps_ptr<uint8_t> data;
+    data.alloc(std::min((uint32_t)f.size(), maxBytes), "placement_bench");
+    size_t len = data.valid() ? f.read(data.get(), data.size()) : 0;
+    f.close();
+
+    const char* type = nullptr;
+    const char* ext = strrchr(path, '.');
+    if (ext && !strcasecmp(ext, ".mp3")) type = "MP3";
+    if (ext && !strcasecmp(ext, ".aac")) type = "AAC";
+    if (ext && !strcasecmp(ext, ".flac")) type = "FLAC";
+    if (ext && !strcasecmp(ext, ".opus")) type = "OPUS";
+    if (ext && !strcasecmp(ext, ".ogg") && len > 64) type = specialIndexOf(data.get(), "OpusHead", 64) >= 0 ? "OPUS" : "VORBIS";
+    if (!type || !len) {
+        AUDIO_LOG_WARN("placement A/B: %s is no mp3, aac, flac, opus or ogg file", path);
+        return;
+    }
+    if (xSemaphoreTakeRecursive(mutex_playAudioData, 0.3 * configTICK_RATE_HZ) != pdTRUE) {
+        AUDIO_LOG_WARN("placement A/B: audio task busy");
+        return;
+    }
+    bool     placement = m_f_placement;
+    uint32_t frames[2] = {}, cycles[2] = {}, internal[2] = {};
+    for (uint8_t pass = 0; pass < 2; pass++) { // 0: all decoder buffers in PSRAM, 1: by the placement table
+        m_f_placement = pass == 1;
+        m_decoder = createDecoder(type);
+        bool ok = false;
+        if (m_decoder) {
+            ps_heap_use_t use(&m_dPrf.heap);
+            ok = m_decoder->init();
+        }
+        if (ok) cycles[pass] = benchDecode(type, data.get(), len, &frames[pass]);
+        internal[pass] = ps_placement_internal_bytes();
+        if (m_decoder) {
+            m_decoder->reset();
+            m_decoder.reset();
+        }
+    }
+    m_f_placement = placement;
+    ps_placement_use(nullptr, 0);
+    xSemaphoreGiveRecursive(mutex_playAudioData);
+
+    uint32_t mhz = getCpuFrequencyMhz();
+    if (!frames[0] || frames[0] != frames[1]) {
+        AUDIO_LOG_WARN("placement A/B: %s, %lu / %lu frames decoded", path, frames[0], frames[1]);
+        return;
+    }
+    AUDIO_LOG_INFO("placement A/B: %s, %lu %s frames, PSRAM %lu us/frame, placed %lu us/frame with %lu bytes internal (%+ld%% frames/s)", path, frames[0], type,
+                   cycles[0] / frames[0] / mhz, cycles[1] / frames[1] / mhz, internal[1], cycles[1] ? (int32_t)((int64_t)cycles[0] * 100 / cycles[1] - 100) : 0);
+}
+
+uint32_t Audio::benchDecode(const char* type, uint8_t* data, size_t len, uint32_t* frames) { // decode() cycles for the whole buffer, a condensed playAudioData()
+    bool   flac = !strcmp(type, "FLAC"), mp3 = !strcmp(type, "MP3"), opus = !strcmp(type, "OPUS"), vorbis = !strcmp(type, "VORBIS");
+    size_t block = mp3 ? m_frameSizeMP3 : flac ? m_frameSizeFLAC : opus ? m_frameSizeOPUS : vorbis ? m_frameSizeVORBIS : m_frameSizeAAC;
+    size_t pos = 0;
+    if (mp3 && len > 10 && !memcmp(data, "ID3", 3)) pos = 10 + ((data[6] & 0x7F) << 21 | (data[7] & 0x7F) << 14 | (data[8] & 0x7F) << 7 | (data[9] & 0x7F));
+    if (flac && len > 8 && !memcmp(data, "fLaC", 4)) { // native FLAC, the metadata blocks up to the first frame
+        const uint8_t* si = nullptr;
+        bool           last = false;
+        pos = 4;
+        while (!last && pos + 4 + 18 <= len) {
+            last = data[pos] & 0x80;
+            if ((data[pos] & 0x7F) == 0) si = data + pos + 4; // STREAMINFO
+            pos += 4 + ((data[pos + 1] << 16) | (data[pos + 2] << 8) | data[pos + 3]);
+        }
+        if (!si || pos >= len) return 0;
+        m_decoder->setRawBlockParams(((si[12] >> 1) & 0x07) + 1, (si[10] << 12) | (si[11] << 4) | (si[12] >> 4), (((si[12] & 0x01) << 4) | (si[13] >> 4)) + 1,
+                                     ((uint32_t)si[14] << 24) | (si[15] << 16) | (si[16] << 8) | si[17], len - pos);
+    }
+    uint32_t cycles = 0;
+    uint8_t  stalls = 0;
+    bool     sync = false;
+    *frames = 0;
+    while (pos < len && stalls < 10) {
+        int32_t n = (int32_t)std::min(len - pos, block);
+        if (!sync) {
+            int32_t nextSync = m_decoder->findSyncWord(data + pos, n);
+            if (nextSync < 0) break;
+            if (mp3) m_decoder->clear();
+            pos += nextSync;
+            sync = nextSync == 0;
+            continue;
+        }
+        int32_t  bytesLeft = n;
+        uint32_t t = esp_cpu_get_cycle_count();
+        int32_t  res;
+        {
+            ps_heap_use_t use(&m_dPrf.heap);
+            res = m_decoder->decode(data + pos, &bytesLeft, m_outBuff.get());
+        }
+        cycles += esp_cpu_get_cycle_count() - t;
+        int32_t consumed = n - bytesLeft;
+        if (res < 0) { // resync one byte further
+            sync = false;
+            pos += consumed ? consumed : 1;
+            continue;
+        }
+        pos += consumed;
+        if (res > 99) { // decodeContinue(): consumed, nothing to play, anything else waits for data the buffer does not have
+            bool more = (flac && (res == FlacDecoder::FLAC_PARSE_OGG_DONE || res == FlacDecoder::FLAC_DECODE_FRAMES_LOOP)) ||
+                        (opus && (res == OpusDecoder::OPUS_PARSE_OGG_DONE || res == OpusDecoder::OPUS_END)) || (vorbis && res == VorbisDecoder::VORBIS_PARSE_OGG_DONE);
+            stalls = more ? 0 : stalls + 1;
+            continue;
+        }
+        if (!consumed && !flac && !vorbis) { // framesize 0, resync
+            sync = false;
+            pos++;
+            continue;
+        }
+        if (m_decoder->getOutputSamples()) {
+            (*frames)++;
+            stalls = 0;
+        } else if (!consumed) {
+            stalls++; // the decoder waits for data the buffer does not have
+        }
+    }
+    return cycles;
+}
+
+Audio::bufferHealth_t Audio::getBufferHealth() {
+    bufferHealth_t h;
+    if (InBuff.isInitialized()) h.inBuffPercent = (uint64_t)InBuff.bufferFilled() * 100 / InBuff.getBufsize();
+    if (m_netPrefetch.isActive()) h.netBuffPercent = m_netPrefetch.fillPercent();
+    uint32_t now = millis();
+    if (now - m_bHea.lastTime >= 1000) {
+        m_bHea.bytesPerSec = (uint64_t)(m_bHea.bytes - m_bHea.lastBytes) * 1000 / (now - m_bHea.lastTime);
+        m_bHea.lastBytes = m_bHea.bytes;
+        m_bHea.lastTime = now;
+    }
+    h.underruns = m_bHea.underruns;
+    h.bytesPerSec = m_bHea.bytesPerSec;
+    return h;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
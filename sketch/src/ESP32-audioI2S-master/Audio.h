@@ -7,9 +7,13 @@
 
 #pragma once
 #pragma GCC optimize("Ofast")
+#include "audio_buffer/audio_buffer.h"
 #include "audiolib_structs.hpp"
+#include "net_prefetch/net_prefetch.h"
 #include "esp_arduino_version.h"
 #include "psram_unique_ptr.hpp"
+#include "resampler/resampler.h"
+#include "seek_index/seek_index.h"
 #include <Arduino.h>
 #include <FFat.h>
 #include <FS.h>
@@ -39,71 +43,8 @@ extern char                       audioI2SVers[];
 class Decoder; // prototype
 
 // Audio event type descriptions
-static constexpr std::array<const char*, 13> eventStr = {"info",    "id3data",  "eof",      "station_name", "icy_description", "streamtitle", "bitrate",
-                                                         "icy_url", "icy_logo", "lasthost", "cover_image",  "lyrics",          "log"};
-//----------------------------------------------------------------------------------------------------------------------
-
-class AudioBuffer {
-    // AudioBuffer will be allocated in PSRAM
-    //
-    //  m_buffer            m_readPtr                 m_writePtr                 m_endPtr
-    //   |                       |<------dataLength------->|<------ writeSpace ----->|
-    //   ▼                       ▼                         ▼                         ▼
-    //   ---------------------------------------------------------------------------------------------------------------
-    //   |                     <--m_buffSize-->                                      |      <--m_resBuffSize -->     |
-    //   ---------------------------------------------------------------------------------------------------------------
-    //   |<-----freeSpace------->|                         |<------freeSpace-------->|
-    //
-    //
-    //
-    //   if the space between m_readPtr and buffend < m_resBuffSize copy data from the beginning to resBuff
-    //   so that the mp3/aac/flac frame is always completed
-    //
-    //  m_buffer                      m_writePtr                 m_readPtr        m_endPtr
-    //   |                                 |<-------writeSpace------>|<--dataLength-->|
-    //   ▼                                 ▼                         ▼                ▼
-    //   ---------------------------------------------------------------------------------------------------------------
-    //   |                        <--m_buffSize-->                                    |      <--m_resBuffSize -->     |
-    //   ---------------------------------------------------------------------------------------------------------------
-    //   |<---  ------dataLength--  ------>|<-------freeSpace------->|
-    //
-    //
-
-  public:
-    AudioBuffer(size_t maxBlockSize = 0); // constructor
-    ~AudioBuffer();                       // frees the buffer
-    size_t   init();                      // set default values
-    bool     isInitialized() { return m_f_init; };
-    int32_t  getBufsize();
-    bool     setBufsize(size_t mbs);           // default is m_buffSizePSRAM for psram, and m_buffSizeRAM without psram
-    void     changeMaxBlockSize(uint16_t mbs); // is default 1600 for mp3 and aac, set 16384 for FLAC
-    uint16_t getMaxBlockSize();                // returns maxBlockSize
-    size_t   freeSpace();                      // number of free bytes to overwrite
-    size_t   writeSpace();                     // space fom writepointer to bufferend
-    size_t   bufferFilled();                   // returns the number of filled bytes
-    size_t   getMaxAvailableBytes();           // max readable bytes in one block
-    void     bytesWritten(size_t bw);          // update writepointer
-    void     bytesWasRead(size_t br);          // update readpointer
-    uint8_t* getWritePtr();                    // returns the current writepointer
-    uint8_t* getReadPtr();                     // returns the current readpointer
-    uint32_t getWritePos();                    // write position relative to the beginning
-    uint32_t getReadPos();                     // read position relative to the beginning
-    void     resetBuffer();                    // restore defaults
-
-  protected:
-    size_t          m_buffSize = UINT16_MAX * 10; // most webstreams limit the advance to 100...300Kbytes
-    size_t          m_freeSpace = 0;
-    size_t          m_writeSpace = 0;
-    size_t          m_dataLength = 0;
-    size_t          m_resBuffSize = 4096 * 6; // reserved buffspace, >= one flac frame
-    size_t          m_maxBlockSize = 1600;
-    ps_ptr<uint8_t> m_buffer;
-    uint8_t*        m_writePtr = NULL;
-    uint8_t*        m_readPtr = NULL;
-    uint8_t*        m_endPtr = NULL;
-    bool            m_f_init = false;
-    bool            m_f_isEmpty = true;
-};
+static constexpr std::array<const char*, 14> eventStr = {"info",    "id3data",  "eof",      "station_name", "icy_description", "streamtitle", "bitrate",
+                                                         "icy_url", "icy_logo", "lasthost", "cover_image",  "lyrics",          "log",         "next_track"};
 //----------------------------------------------------------------------------------------------------------------------
 
 class Audio {
@@ -117,7 +58,7 @@ class Audio {
     std::mutex mutex_info; // mutex_info as member
 
     // callbacks ---------------------------------------------------------
-    typedef enum { evt_info = 0, evt_id3data, evt_eof, evt_name, evt_icydescription, evt_streamtitle, evt_bitrate, evt_icyurl, evt_icylogo, evt_lasthost, evt_image, evt_lyrics, evt_log } event_t;
+    typedef enum { evt_info = 0, evt_id3data, evt_eof, evt_name, evt_icydescription, evt_streamtitle, evt_bitrate, evt_icyurl, evt_icylogo, evt_lasthost, evt_image, evt_lyrics, evt_log, evt_nexttrack } event_t;
     typedef struct _msg { // used in info(audio_info_callback());
         const char*           msg = nullptr;
         const char*           s = nullptr;
@@ -144,6 +85,12 @@ class Audio {
     bool             isRunning() { return m_f_running; }
     void             loop();
     uint32_t         stopSong();
+    bool             setNextFS(fs::FS& fs, const char* path); // gapless: pre-open the file that follows the current one
+    void             clearNextFS();
+    bool             hasNextFS() { return (bool)m_nextFile; }
+    uint32_t         getGapSamples() { return m_gpls.gapSamples; } // 48kHz frames of silence at the last gapless switch
+    void             setSeekIndexCache(fs::FS& fs, const char* dir) { for (SeekIndex& s : m_seekIdx) s.setCache(fs, dir); } // where finished seek indexes are kept
+    SeekIndex::info_t getSeekIndexInfo() { return m_seekIndex->getInfo(); }
     void             forceMono(bool m);
     void             setBalance(int8_t bal = 0);
     void             setVolumeSteps(uint8_t steps);
@@ -161,6 +108,12 @@ class Audio {
     uint32_t         getAudioFilePosition();
     bool             setAudioFilePosition(uint32_t pos);
     uint16_t         getVUlevel();
+    enum : uint8_t { DSP_VU = 0x01, DSP_TONE = 0x02, DSP_MONO = 0x04, DSP_GAIN = 0x08 }; // stages of the output path
+    typedef struct _dspStats {
+        uint8_t  stages = 0;             // active stages, DSP_VU | DSP_TONE | ...
+        uint32_t cyclesPerSec[4] = {0};  // CPU cycles per second of audio: VU, tone, mono, gain
+    } dspStats_t;
+    dspStats_t       getDspStats() { return m_dspStats; }
     uint32_t         inBufferFilled();            // returns the number of stored bytes in the inputbuffer
     uint32_t         inBufferFree();              // returns the number of free bytes in the inputbuffer
     uint32_t         getInBufferSize();           // returns the size of the inputbuffer in bytes
@@ -180,6 +133,7 @@ class Audio {
     // ------- PRIVATE MEMBERS ----------------------------------------
     
     std::unique_ptr<Decoder> createDecoder(const std::string& type);
+    std::unique_ptr<Decoder> newDecoder(const std::string& type); // placement table and constructor, the current decoder stays
     void                     destroy_decoder();
     bool                     fsRange(uint32_t range);
     void                     latinToUTF8(ps_ptr<char>& buff, bool UTF8check = true);
@@ -188,6 +142,9 @@ class Audio {
     int32_t                  audioFileRead(uint8_t* buff = nullptr, size_t len = 0);
     int32_t                  audioFileSeek(uint32_t position, size_t len = 0);
     void                     initInBuff();
+    uint8_t                  codecFromPath(ps_ptr<char>& path);
+    void                     openNextFS();
+    void                     primeNextFS();
     bool                     httpPrint(const char* host);
     bool                     httpRange(uint32_t range, uint32_t length = UINT32_MAX);
     void                     processLocalFile();
@@ -225,7 +182,8 @@ class Audio {
     void                     playChunk();
     void                     computeVUlevel(int16_t sample[2]);
     void                     computeLimit();
-    void                     Gain(int16_t* sample);
+    void                     Gain(int16_t* block, int32_t frames);
+    void                     updateDspGraph();
     void                     showstreamtitle(char* ml);
     bool                     parseContentType(char* ct);
     bool                     parseHttpResponseHeader();
@@ -234,9 +192,7 @@ class Audio {
     esp_err_t                I2Sstart();
     esp_err_t                I2Sstop();
     void                     zeroI2Sbuff();
-    void                     IIR_filterChain0(int16_t iir_in[2], bool clear = false);
-    void                     IIR_filterChain1(int16_t iir_in[2], bool clear = false);
-    void                     IIR_filterChain2(int16_t iir_in[2], bool clear = false);
+    void                     IIR_filterBlock(int16_t* block, int32_t frames);
     uint32_t                 streamavail() { return m_client ? m_client->available() : 0; }
     void                     IIR_calculateCoefficients(int8_t G1, int8_t G2, int8_t G3);
     bool                     ts_parsePacket(uint8_t* packet, uint8_t* packetStart, uint8_t* packetLength);
@@ -244,15 +200,49 @@ class Audio {
 
     //+++ create a T A S K  for playAudioData(), output via I2S +++
   public:
-    void     setAudioTaskCore(uint8_t coreID);
-    uint32_t getHighWatermark();
+    typedef struct _taskStats {
+        uint8_t  idlePercent = 0;   // share of the last second the audio task was blocked
+        uint16_t wakeupsPerSec = 0; // returns from the idle wait of audioTask() in the last second
+    } taskStats_t;
+    void        setAudioTaskCore(uint8_t coreID);
+    uint32_t    getHighWatermark();
+    taskStats_t getAudioTaskStats() { return m_taskStats; }
+    typedef struct _bufferHealth {
+        uint8_t  inBuffPercent = 0;  // InBuffer fill level
+        uint8_t  netBuffPercent = 0; // network prefetch ring fill level, 0 if no web stream is prefetched
+        uint32_t underruns = 0;      // the decoder found the InBuffer empty while playing
+        uint32_t bytesPerSec = 0;    // audio data delivered to the InBuffer, averaged since the last call (>= 1s)
+    } bufferHealth_t;
+    bufferHealth_t getBufferHealth();
+    typedef struct _decoderStats {
+        uint32_t frames = 0;       // frames decoded since the decoder was created
+        uint32_t framesPerSec = 0; // decode speed in frames per CPU second, mp3 44.1kHz needs 38/s for realtime
+        uint32_t avgUs = 0;        // decode() per frame
+        uint32_t maxUs = 0;
+        uint32_t outputUs = 0;     // playChunk() per frame: DSP, resampler, I2S
+        uint32_t peakHeap = 0;     // bytes, heap taken by the decoder at its peak
+        uint32_t internalBytes = 0; // bytes the decoder allocated in internal RAM since it was created, all its buffers
+    } decoderStats_t;
+    decoderStats_t getDecoderStats();
+    void           setDecoderPlacement(bool enable); // hot decoder buffers in internal RAM (default), off: all in PSRAM, compare in the decoder summary
+    void           reportDecoderPlacement();         // boot, not while playing: creates each decoder once and logs where its buffers landed
+    void           benchDecoderPlacement(fs::FS& fs, const char* path, uint32_t maxBytes = 512 * 1024); // boot: decodes the file start with placement off and on, logs both
+    void           setPrefetchWatermarks(uint8_t lowPercent, uint8_t highPercent); // web streams: stop reading at high, resume below low
 
   private:
     void        startAudioTask(); // starts a task for decode and play
     void        stopAudioTask();  // stops task for audio
     static void taskWrapper(void* param);
     void        audioTask();
-    void        performAudioTask();
+    bool        performAudioTask();
+    void        waitAudioEvent(uint32_t ms); // audio task only: sleep until I2S DMA space, new InBuffer data or timeout
+    uint32_t    benchDecode(const char* type, uint8_t* data, size_t len, uint32_t* frames);
+    void        notifyAudioTask();
+    static bool onI2sSent(i2s_chan_handle_t handle, i2s_event_data_t* event, void* user_ctx);
+
+    //+++ network prefetch, web streams only +++
+    int32_t     clientAvailable();                      // m_client or the prefetch ring
+    bool        clientConnected();
 
     //+++ H E L P   F U N C T I O N S +++
     bool         readMetadata(uint16_t b, uint16_t* readedBytes, bool first = false);
@@ -261,6 +251,10 @@ class Audio {
     int32_t      newInBuffStart(int32_t m_resumeFilePos);
     boolean      streamDetection(uint32_t bytesAvail);
     uint32_t     m4a_correctResumeFilePos();
+    uint32_t     m4a_indexedResumeFilePos(uint32_t pos);
+    int32_t      indexedResumeOffset();
+    bool         seekToTime(uint32_t sec);
+    void         buildSeekIndex();
     uint32_t     ogg_correctResumeFilePos();
     int32_t      flac_correctResumeFilePos();
     int32_t      mp3_correctResumeFilePos();
@@ -338,6 +332,10 @@ class Audio {
     } pid_array;
 
     File                m_audiofile;
+    File                m_nextFile; // gapless, opened by setNextFS()
+    ps_ptr<char>        m_nextPath;
+    fs::FS*             m_nextFs = nullptr;
+    ps_ptr<uint8_t>     m_nextHead; // gapless, the first bytes of m_nextFile, read by primeNextFS()
     NetworkClient       client;
     NetworkClientSecure clientsecure;
     NetworkClient*      m_client = nullptr;
@@ -345,6 +343,11 @@ class Audio {
     SemaphoreHandle_t mutex_playAudioData;
     SemaphoreHandle_t mutex_audioTask;
     TaskHandle_t      m_audioTaskHandle = nullptr;
+    volatile bool     m_f_audioTaskWaiting = false; // set in waitAudioEvent(), the I2S callback and loop() notify only then
+    volatile uint8_t  m_dmaSentCnt = 0;             // DMA buffers sent while the audio task is waiting
+    taskStats_t       m_taskStats;
+    NetPrefetch       m_netPrefetch;                 // raw web stream bytes, read from m_client by its own task
+    bool              m_f_netResume = false;         // httpPrint() stopped the prefetch, processWebStream() starts it again
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmissing-field-initializers"
@@ -369,6 +372,7 @@ class Audio {
     static const uint8_t m_tsHeaderSize = 4;
 
     std::unique_ptr<Decoder> m_decoder = {};
+    std::unique_ptr<Decoder> m_nextDecoder = {}; // gapless, created and initialized by primeNextFS()
     ps_ptr<int16_t>          m_outBuff;        // Interleaved L/R
     ps_ptr<int16_t>          m_samplesBuff48K; // Interleaved L/R
     ps_ptr<char>             m_ibuff;          // used in log_info()
@@ -393,7 +397,6 @@ class Audio {
     int8_t         m_balance = 0;           // -16 (mute left) ... +16 (mute right)
     uint16_t       m_vol = 21;              // volume
     uint16_t       m_vol_steps = 21;        // default
-    int16_t        m_inputHistory[6] = {0}; // used in resampleTo48kStereo()
     uint16_t       m_opus_mode = 0;         // celt_only, silk_only or hybrid
     double         m_limit_left = 0;        // limiter 0 ... 1, left channel
     double         m_limit_right = 0;       // limiter 0 ... 1, right channel
@@ -433,11 +436,15 @@ class Audio {
     uint32_t m_stsz_numEntries = 0;      // num of entries inside stsz atom (uint32_t)
     uint32_t m_stsz_position = 0;        // pos of stsz atom within file
     uint32_t m_haveNewFilePos = 0;       // user changed the file position
+    int32_t  m_seekTarget = -1;          // sample the indexed m_resumeFilePos is looking for, (-1) is none
+    int32_t  m_seekSample = -1;          // first sample of the frame at the seek position, the landed frame after newInBuffStart()
+    uint32_t m_mp3TocSamples = 0;        // MP3 Xing/VBRI header with a TOC: samples of the file, the TOC is in the seek index
     bool     m_f_metadata = false;       // assume stream without metadata
     bool     m_f_unsync = false;         // set within ID3 tag but not used
     bool     m_f_exthdr = false;         // ID3 extended header
     bool     m_f_ssl = false;
     bool     m_f_running = false;
+    bool     m_f_placement = true;      // createDecoder() activates the codec placement table
     bool     m_f_firstCall = false;         // InitSequence for processWebstream and processLokalFile
     bool     m_f_firstLoop = false;         // InitSequence in loop()
     bool     m_f_firstCurTimeCall = false;  // InitSequence for calculateAudioTime
@@ -470,14 +477,22 @@ class Audio {
     bool     m_f_connectionClose = false; // set in parseHttpResponseHeader
     uint32_t m_audioFileDuration = 0;     // seconds
     uint32_t m_audioCurrentTime = 0;      // seconds
-    float    m_resampleError = 0.0f;
-    float    m_resampleRatio = 1.0f;  // resample ratio for e.g. 44.1kHz to 48kHz
-    float    m_resampleCursor = 0.0f; // next frac in resampleTo48kStereo
+    Resampler m_resampler;            // any sample rate -> 48kHz, used in resampleTo48kStereo()
+    SeekIndex  m_seekIdx[2];                 // local MP3, FLAC and M4A: sample -> frame position
+    SeekIndex* m_seekIndex = &m_seekIdx[0];  // of the current track, the other one may still stop the scan of the previous track
 
     uint32_t m_audioDataStart = 0;     // in bytes
     size_t   m_audioDataSize = 0;      //
     size_t   m_ibuffSize = 0;          // log buffer size for audio_info()
-    float    m_filterBuff[3][2][2][2]; // IIR filters memory for Audio DSP
+    static constexpr uint16_t m_dspBlock = 128; // frames per DSP stage in playChunk()
+    static constexpr uint32_t m_nextHeadSize = 32 * 1024; // gapless, bytes of the next file staged by primeNextFS()
+    float    m_biquadState[3][2][2];   // IIR filters memory for Audio DSP [filter][channel][w0, w1]
+    float    m_dspBuff[2][m_dspBlock]; // deinterleaved block for the IIR filters
+    uint8_t    m_dspGraph = DSP_VU | DSP_GAIN; // effective DSP graph, set in updateDspGraph(), read in playChunk()
+    int32_t    m_gainQ15[2] = {0, 0};          // m_limit_left/right as Q15
+    uint64_t   m_dspCycles[4] = {0};           // cycles spent per stage since the last m_dspStats update
+    uint32_t   m_dspFrames = 0;                // frames processed since the last m_dspStats update
+    dspStats_t m_dspStats;
     float    m_corr = 1.0;             // correction factor for level adjustment
     size_t   m_i2s_bytesWritten = 0;   // set in i2s_write() but not used
     uint16_t m_filterFrequency[2];
@@ -500,12 +515,15 @@ class Audio {
     audiolib::prlf_t    m_prlf;
     audiolib::cat_t     m_cat;
     audiolib::cVUl_t    m_cVUl;
-    audiolib::ifCh_t    m_ifCh;
     audiolib::tspp_t    m_tspp;
     audiolib::pwst_t    m_pwst;
     audiolib::gchs_t    m_gchs;
     audiolib::pwf_t     m_pwf;
     audiolib::pad_t     m_pad;
+    audiolib::tSta_t    m_tSta;
+    audiolib::bHea_t    m_bHea;
+    audiolib::dPrf_t    m_dPrf;
+    audiolib::gpls_t    m_gpls;
     audiolib::sbyt_t    m_sbyt;
     audiolib::rmet_t    m_rmet;
     audiolib::pwsts_t   m_pwsst;
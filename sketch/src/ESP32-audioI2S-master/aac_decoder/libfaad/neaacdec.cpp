@@ -1088,7 +1088,7 @@ void* NeaacDecoder::aac_frame_decode(NeAACDecStruct* hDecoder, NeAACDecFrameInfo
 #endif
         /* check if we want to use internal sample_buffer */
         if (sample_buffer_size == 0) {
-            m_sample_buffer.alloc(frame_len * output_channels * stride);
+            m_sample_buffer.alloc(frame_len * output_channels * stride, "m_sample_buffer");
             hDecoder->sample_buffer = m_sample_buffer.get();
         } else if (sample_buffer_size < frame_len * output_channels * stride) {
             /* provided sample buffer is not big enough */
@@ -2249,17 +2249,17 @@ void NeaacDecoder::cffti(uint16_t mdct_len, uint16_t n) {
         case 256:
             m_ccft256.alloc();
             cfft_select = m_ccft256.get();
-            m_work256.alloc_array(n * sizeof(complex_t));
+            m_work256.alloc_array(n, "m_work256");
             break;
         case 1024:
             m_ccft1024.alloc();
             cfft_select = m_ccft1024.get();
-            m_work1024.alloc_array(n * sizeof(complex_t));
+            m_work1024.alloc_array(n, "m_work1024");
             break;
         case 2048:
             m_ccft2048.alloc();
             cfft_select = m_ccft2048.get();
-            m_work2048.alloc_array(n * sizeof(complex_t));
+            m_work2048.alloc_array(n, "m_work2048");
             break;
         default: AAC_LOG_ERROR("wrong length %i", mdct_len);
     }
@@ -0,0 +1,116 @@
+/*
+ * audio_buffer.cpp
+ *
+ * lock-free single producer / single consumer ring, see audio_buffer.h
+ *
+ */
+#include "audio_buffer.h"
+
+AudioBuffer::AudioBuffer(size_t maxBlockSize) {
+    if (maxBlockSize) m_resBuffSize = maxBlockSize;
+    if (maxBlockSize) m_maxBlockSize = maxBlockSize;
+}
+
+AudioBuffer::~AudioBuffer() {
+    // m_buffer.reset();
+}
+
+int32_t AudioBuffer::getBufsize() {
+    return m_buffSize;
+}
+
+bool AudioBuffer::setBufsize(size_t mbs) {
+    if (mbs < 2 * m_resBuffSize) {
+        log_e("not allowed buffer size must be greater than %i", 2 * m_resBuffSize);
+        return false;
+    }
+    m_buffSize = mbs;
+    if (!init()) return false;
+    return true;
+}
+
+size_t AudioBuffer::init() {
+    m_buffer.alloc(m_buffSize + m_resBuffSize, "AudioBuffer");
+    m_f_init = true;
+    resetBuffer();
+    return m_buffSize;
+}
+
+void AudioBuffer::changeMaxBlockSize(uint16_t mbs) {
+    m_maxBlockSize = mbs;
+    return;
+}
+
+uint16_t AudioBuffer::getMaxBlockSize() {
+    return m_maxBlockSize;
+}
+
+size_t AudioBuffer::freeSpace() {
+    return m_buffSize - bufferFilled();
+}
+
+size_t AudioBuffer::writeSpace() {
+    size_t w = m_writeIdx.load(std::memory_order_relaxed); // own index
+    size_t r = m_readIdx.load(std::memory_order_acquire);
+    return std::min(m_buffSize - distance(r, w), m_buffSize - pos(w));
+}
+
+size_t AudioBuffer::bufferFilled() {
+    size_t w = m_writeIdx.load(std::memory_order_acquire);
+    size_t r = m_readIdx.load(std::memory_order_acquire);
+    return distance(r, w);
+}
+
+size_t AudioBuffer::getMaxAvailableBytes() {
+    size_t r = m_readIdx.load(std::memory_order_relaxed); // own index
+    size_t w = m_writeIdx.load(std::memory_order_acquire);
+    return std::min(distance(r, w), m_buffSize - pos(r));
+}
+
+void AudioBuffer::bytesWritten(size_t bw) {
+    if (!bw) return;
+    if (bw > writeSpace()) {
+        log_e("AudioBuffer: %u bytes written, only %u free", bw, writeSpace());
+        bw = writeSpace();
+    }
+    size_t w = m_writeIdx.load(std::memory_order_relaxed);
+    m_writeIdx.store(advance(w, bw), std::memory_order_release); // publishes the data to the consumer
+}
+
+void AudioBuffer::bytesWasRead(size_t br) {
+    if (!br) return;
+    size_t r = m_readIdx.load(std::memory_order_relaxed);
+    size_t filled = distance(r, m_writeIdx.load(std::memory_order_acquire));
+    if (br > filled) {
+        log_e("AudioBuffer: %u bytes read, only %u filled", br, filled);
+        br = filled;
+    }
+    m_readIdx.store(advance(r, br), std::memory_order_release); // hands the space back to the producer
+}
+
+uint8_t* AudioBuffer::getWritePtr() {
+    return m_buffer.get() + pos(m_writeIdx.load(std::memory_order_relaxed));
+}
+
+uint8_t* AudioBuffer::getReadPtr() {
+    size_t r = m_readIdx.load(std::memory_order_relaxed);
+    size_t len = m_buffSize - pos(r);
+    if (len < m_maxBlockSize) { // be sure the last frame is completed, mirror the beginning behind m_buffSize
+        size_t filled = distance(r, m_writeIdx.load(std::memory_order_acquire));
+        if (filled > len) memcpy(m_buffer.get() + m_buffSize, m_buffer.get(), std::min(m_maxBlockSize - len, filled - len)); // only published bytes
+    }
+    return m_buffer.get() + pos(r);
+}
+
+void AudioBuffer::resetBuffer() {
+    m_writeIdx.store(0);
+    m_readIdx.store(0);
+}
+
+uint32_t AudioBuffer::getWritePos() {
+    return pos(m_writeIdx.load(std::memory_order_relaxed));
+}
+
+uint32_t AudioBuffer::getReadPos() {
+    return pos(m_readIdx.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,77 @@
+/*
+ * audio_buffer.h
+ *
+ * input ring of class Audio: the file or stream data on its way to the decoder
+ *
+ */
+#pragma once
+
+#include "../psram_unique_ptr.hpp"
+#include <Arduino.h>
+#include <atomic>
+
+class AudioBuffer {
+    // AudioBuffer will be allocated in PSRAM
+    // single producer (processLocalFile, processWebStream... in loop()) / single consumer (decoder in the audio task)
+    // lock-free: the producer only stores m_writeIdx, the consumer only stores m_readIdx
+    // the indices run from 0 to 2 * m_buffSize - 1, so that full (distance m_buffSize) and empty (distance 0) are distinct
+    //
+    //  m_buffer                 read pos                  write pos               m_buffSize
+    //   |                       |<------dataLength------->|<------ writeSpace ----->|
+    //   ▼                       ▼                         ▼                         ▼
+    //   ---------------------------------------------------------------------------------------------------------------
+    //   |                     <--m_buffSize-->                                      |      <--m_resBuffSize -->     |
+    //   ---------------------------------------------------------------------------------------------------------------
+    //   |<-----freeSpace------->|                         |<------freeSpace-------->|
+    //
+    //
+    //   mirror: if the space between read pos and buffend < m_maxBlockSize, getReadPtr() copies the data from
+    //   the beginning to resBuff, so that the mp3/aac/flac frame is always contiguous
+    //
+    //  m_buffer                      write pos                 read pos      m_buffSize
+    //   |                                 |<-------writeSpace------>|<--dataLength-->|
+    //   ▼                                 ▼                         ▼                ▼
+    //   ---------------------------------------------------------------------------------------------------------------
+    //   |                        <--m_buffSize-->                                    |      <--m_resBuffSize -->     |
+    //   ---------------------------------------------------------------------------------------------------------------
+    //   |<---  ------dataLength--  ------>|<-------freeSpace------->|
+    //
+    //
+
+  public:
+    AudioBuffer(size_t maxBlockSize = 0); // constructor
+    ~AudioBuffer();                       // frees the buffer
+    size_t   init();                      // set default values
+    bool     isInitialized() { return m_f_init; };
+    int32_t  getBufsize();
+    bool     setBufsize(size_t mbs);           // default is m_buffSizePSRAM for psram, and m_buffSizeRAM without psram
+    void     changeMaxBlockSize(uint16_t mbs); // is default 1600 for mp3 and aac, set 16384 for FLAC
+    uint16_t getMaxBlockSize();                // returns maxBlockSize
+    size_t   freeSpace();                      // number of free bytes to overwrite
+    size_t   writeSpace();                     // space fom writepointer to bufferend
+    size_t   bufferFilled();                   // returns the number of filled bytes
+    size_t   getMaxAvailableBytes();           // max readable bytes in one block
+    void     bytesWritten(size_t bw);          // update writepointer (producer)
+    void     bytesWasRead(size_t br);          // update readpointer (consumer)
+    uint8_t* getWritePtr();                    // returns the current writepointer
+    uint8_t* getReadPtr();                     // returns the current readpointer, m_maxBlockSize bytes are contiguous
+    uint32_t getWritePos();                    // write position relative to the beginning
+    uint32_t getReadPos();                     // read position relative to the beginning
+    void     resetBuffer();                    // restore defaults, neither side may be active
+
+  protected:
+    size_t pos(size_t idx) { return idx < m_buffSize ? idx : idx - m_buffSize; }
+    size_t distance(size_t from, size_t to) { return to >= from ? to - from : to + 2 * m_buffSize - from; }
+    size_t advance(size_t idx, size_t n) {
+        idx += n;
+        return idx >= 2 * m_buffSize ? idx - 2 * m_buffSize : idx;
+    }
+
+    size_t              m_buffSize = UINT16_MAX * 10; // most webstreams limit the advance to 100...300Kbytes
+    size_t              m_resBuffSize = 4096 * 6;     // reserved buffspace, >= one flac frame
+    size_t              m_maxBlockSize = 1600;
+    ps_ptr<uint8_t>     m_buffer;
+    std::atomic<size_t> m_writeIdx{0}; // 0 ... 2 * m_buffSize - 1
+    std::atomic<size_t> m_readIdx{0};  // 0 ... 2 * m_buffSize - 1
+    bool                m_f_init = false;
+};
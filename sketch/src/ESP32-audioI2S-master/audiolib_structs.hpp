@@ -118,11 +118,8 @@ struct plCh_t { // used in playChunk
     int32_t   samples48K = 0;
     uint32_t  count = 0;
     size_t    i2s_bytesConsumed;
-    int16_t*  sample[2];
-    int16_t*  s2;
     int       sampleSize;
     esp_err_t err;
-    int       i;
 };
 
 struct lVar_t { // used in loop
@@ -170,18 +167,6 @@ struct cVUl_t { // used in computeVUlevel
     bool    f_vu = false;
 };
 
-struct ifCh_t { // used in IIR_filterChain0, 1, 2
-    float   inSample0[2];
-    float   outSample0[2];
-    int16_t iir_out0[2];
-    float   inSample1[2];
-    float   outSample1[2];
-    int16_t iir_out1[2];
-    float   inSample2[2];
-    float   outSample2[2];
-    int16_t iir_out2[2];
-};
-
 typedef struct _tspp { // used in ts_parsePacket
     int     pidNumber{};
     int     pids[4]{}; // PID_ARRAY_LEN
@@ -235,6 +220,41 @@ struct pad_t { // used in playAudioData
     int16_t bytesDecoded;
 };
 
+struct tSta_t { // used in audioTask
+    uint32_t wakeups = 0;
+    int64_t  blockedUs = 0;
+    int64_t  start = 0;
+};
+
+struct bHea_t { // used in getBufferHealth
+    uint32_t underruns = 0;
+    uint32_t bytes = 0;
+    uint32_t lastBytes = 0;
+    uint32_t lastTime = 0;
+    uint32_t bytesPerSec = 0;
+};
+
+struct dPrf_t { // used in sendBytes, decoder profiling
+    uint32_t frames = 0;
+    uint64_t decodeCycles = 0;
+    uint64_t outputCycles = 0;
+    uint32_t maxCycles = 0;
+    ps_heap_account_t heap; // ps_ptr blocks of the decoder, peak gives the peak heap
+    int32_t  internalBytes = -1; // >= 0: taken from the placement log before primeNextFS() started the log of the next decoder
+};
+
+struct gpls_t { // used in setNextFS, primeNextFS, openNextFS and playChunk, gapless switch
+    uint8_t       codec = 0;         // of the pre-opened file
+    int64_t       lastWriteUs = 0;   // last successful I2S write
+    volatile bool f_measure = false; // the next I2S write is the first one of the new track
+    uint32_t      gapSamples = 0;
+    uint32_t      switches = 0;
+    bool          f_primed = false;      // primeNextFS() ran for the pre-opened file
+    uint32_t      headLen = 0;           // bytes in m_nextHead
+    const char*   decoderType = nullptr; // of m_nextDecoder
+    ps_heap_account_t heap;              // ps_ptr blocks of m_nextDecoder, they go to m_dPrf at the switch
+};
+
 struct sbyt_t { // used in sendBytes
     int32_t     bytesLeft;
     bool        f_setDecodeParamsOnce = true;
@@ -282,6 +302,7 @@ typedef struct _rflh { // used in read_FLAC_Header
     uint8_t               numChannels{};
     uint8_t               bitsPerSample{};
     uint32_t              sampleRate{};
+    uint32_t              minFrameSize{};
     uint32_t              maxFrameSize{};
     uint32_t              maxBlockSize{};
     uint32_t              totalSamplesInStream{};
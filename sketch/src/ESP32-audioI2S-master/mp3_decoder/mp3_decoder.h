@@ -59,6 +59,13 @@ class MP3Decoder : public Decoder {
     ps_ptr<MP3FrameInfo_t>  m_MP3FrameInfo;
     ps_ptr<char>            m_mpeg_version_str;
 
+#if MP3_STAGE_PROFILE
+    struct {
+        uint32_t frames;
+        uint64_t huffman, dequant, imdct, subband; // cycles, reported per frame in reset()
+    } m_prf = {};
+#endif
+
     // internally used
     void     MP3GetLastFrameInfo();
     int32_t  MP3GetNextFrameInfo(uint8_t* buf);
@@ -82,7 +89,7 @@ class MP3Decoder : public Decoder {
     int32_t  IMDCT(int32_t gr, int32_t ch);
     int32_t  UnpackScaleFactors(uint8_t* buf, int32_t* bitOffset, int32_t bitsAvail, int32_t gr, int32_t ch);
     int32_t  Subband(int16_t* pcmBuf);
-    int16_t  ClipToShort(int32_t x, int32_t fracBits);
+    inline int16_t ClipToShort(int32_t x, int32_t fracBits);
     void     RefillBitstreamCache(BitStreamInfo_t* bsi);
     void     UnpackSFMPEG1(BitStreamInfo_t* bsi, SideInfoSub_t* sis, ScaleFactorInfoSub_t* sfis, int32_t* scfsi, int32_t gr, ScaleFactorInfoSub_t* sfisGr0);
     void     UnpackSFMPEG2(BitStreamInfo_t* bsi, SideInfoSub_t* sis, ScaleFactorInfoSub_t* sfis, int32_t gr, int32_t ch, int32_t modeExt, ScaleFactorJS_t* sfjs);
@@ -99,11 +106,32 @@ class MP3Decoder : public Decoder {
     void     imdct12(int32_t* x, int32_t* out);
     int32_t  IMDCT12x3(int32_t* xCurr, int32_t* xPrev, int32_t* y, int32_t btPrev, int32_t blockIdx, int32_t gb);
     int32_t  HybridTransform(int32_t* xCurr, int32_t* xPrev, int32_t y[BLOCK_SIZE][NBANDS], SideInfoSub_t* sis, BlockCount_t* bc);
-    uint64_t SAR64(uint64_t x, int32_t n);
-    int32_t  MULSHIFT32(int32_t x, int32_t y);
-    uint64_t MADD64(uint64_t sum64, int32_t x, int32_t y); /* returns 64-bit value in [edx:eax] */
-    uint64_t xSAR64(uint64_t x, int32_t n);
-    int32_t  FASTABS(int32_t x); // xtensa has a fast abs instruction //fb
+
+    // arithmetic helpers, inline so that the kernels keep their operands in registers
+    static inline uint64_t SAR64(uint64_t x, int32_t n) { return x >> n; }
+    static inline uint64_t xSAR64(uint64_t x, int32_t n) { return x >> n; }
+    static inline int32_t  FASTABS(int32_t x) { return __builtin_abs(x); } // xtensa has a fast abs instruction //fb
+    static inline int32_t  MULSHIFT32(int32_t x, int32_t y) {
+#if MP3_FAST_KERNELS && defined(__XTENSA__)
+        int32_t z;
+        asm("mulsh %0, %1, %2" : "=a"(z) : "a"(x), "a"(y)); // high word of the signed product, one instruction
+        return z;
+#elif MP3_FAST_KERNELS
+        return (int32_t)(((int64_t)x * y) >> 32); // what MULSH computes, the host build compares this path with the reference
+#else
+        int32_t z;
+        z = (uint64_t)x * (uint64_t)y >> 32;
+        return z;
+#endif
+    }
+    static inline uint64_t MADD64(uint64_t sum64, int32_t x, int32_t y) { /* returns 64-bit value in [edx:eax] */
+#if MP3_FAST_KERNELS
+        sum64 += (uint64_t)((int64_t)x * y); // same bits, but the compiler sees a 32x32 widening multiply (MULL + MULSH)
+#else
+        sum64 += (uint64_t)x * (uint64_t)y;
+#endif
+        return sum64;
+    }
 
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // Macro for comfortable calls
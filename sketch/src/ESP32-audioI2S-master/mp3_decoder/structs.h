@@ -1,6 +1,30 @@
 #pragma once
 
 #include "stdint-gcc.h"
+#include <esp_attr.h>
+
+// MP3_FAST_KERNELS selects the optimized path of the hot kernels (Huffman, dequant, IMDCT, FDCT32, polyphase):
+//   hot tables in internal RAM (flash rodata is read through the cache that the PSRAM buffers thrash),
+//   hot kernels in IRAM, MULSH / MULL for the 32x32 products instead of a generic 64 bit multiply
+// the output is bit exact with the portable helix path (0), which stays the reference for comparisons
+#ifndef MP3_FAST_KERNELS
+    #if (defined CONFIG_IDF_TARGET_ESP32 || defined CONFIG_IDF_TARGET_ESP32S3)
+        #define MP3_FAST_KERNELS 1
+    #else
+        #define MP3_FAST_KERNELS 0
+    #endif
+#endif
+// MP3_STAGE_PROFILE counts the cycles of the decode stages (Huffman, dequant, IMDCT, subband), reset() logs them per frame
+#ifndef MP3_STAGE_PROFILE
+    #define MP3_STAGE_PROFILE 0
+#endif
+#if MP3_FAST_KERNELS
+    #define MP3_HOT_TABLE DRAM_ATTR
+    #define MP3_HOT_CODE  IRAM_ATTR
+#else
+    #define MP3_HOT_TABLE
+    #define MP3_HOT_CODE
+#endif
 
 #define SYNCWORDH            0xFF
 #define SYNCWORDL            0xE0
@@ -30,7 +54,7 @@
 #define MAX_NGRAN            2                // max granules
 #define MAX_NCHAN            2                // max channels
 #define MAX_NSAMP            576              // max samples per channel, per granule
-#define CLZ(x)               __builtin_clz(x) // fb
+#define CLZ(x)               ((x) ? __builtin_clz(x) : 32) // fb, 32 for 0 like NSAU, __builtin_clz(0) is undefined (x86 BSR), the check costs nothing on xtensa
 
 #define CLIP_2N(y, n)       \
     {                       \
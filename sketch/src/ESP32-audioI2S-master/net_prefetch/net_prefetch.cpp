@@ -0,0 +1,119 @@
+/*
+ * net_prefetch.cpp
+ *
+ * producer: task(), consumer: read() / available() / connected() in loop(), see net_prefetch.h
+ *
+ */
+#include "net_prefetch.h"
+
+NetPrefetch::NetPrefetch() {
+    m_busy = xSemaphoreCreateMutex();
+}
+
+NetPrefetch::~NetPrefetch() {
+    stop();
+    if (m_task) vTaskDelete(m_task);
+    vSemaphoreDelete(m_busy);
+}
+
+bool NetPrefetch::start(NetworkClient* client) {
+    if (!m_buff.isInitialized() && !m_buff.setBufsize(BUFF_SIZE)) return false; // OOM
+    if (!m_task) {
+        xTaskCreatePinnedToCore(&NetPrefetch::taskWrapper, "NetPrefetch", STACK_SIZE, this, 5, &m_task, tskNO_AFFINITY);
+        if (!m_task) {
+            log_w("network prefetch task could not be created");
+            return false;
+        }
+    }
+    if (xSemaphoreTake(m_busy, pdMS_TO_TICKS(STOP_TIMEOUT_MS)) != pdTRUE) { // a stop() that timed out, the read still runs
+        log_e("network prefetch: the previous read has not returned, reading the client directly");
+        return false;
+    }
+    m_client = client;
+    m_buff.changeMaxBlockSize(1); // read() handles the wrap around, no mirror copy
+    m_buff.resetBuffer();
+    m_f_connected = true;
+    m_f_waitDrain = false;
+    m_f_active = true;
+    xSemaphoreGive(m_busy);
+    xTaskNotifyGive(m_task);
+    return true;
+}
+
+bool NetPrefetch::stop() {
+    if (!m_task) return true;
+    m_f_active = false;
+    xTaskNotifyGive(m_task); // a sleeping task sees the stop at once
+    if (xSemaphoreTake(m_busy, pdMS_TO_TICKS(STOP_TIMEOUT_MS)) != pdTRUE) { // the task is inside m_client->read()
+        log_e("network prefetch: read did not return within %lu ms", (unsigned long)STOP_TIMEOUT_MS);
+        return false;
+    }
+    xSemaphoreGive(m_busy); // the task checks m_f_active before it touches m_client again
+    return true;
+}
+
+void NetPrefetch::setWatermarks(uint8_t lowPercent, uint8_t highPercent) {
+    if (highPercent > 100) highPercent = 100;
+    if (highPercent < 10) highPercent = 10;
+    if (lowPercent >= highPercent) lowPercent = highPercent / 2;
+    m_lowWater = lowPercent;
+    m_highWater = highPercent;
+}
+
+void NetPrefetch::task() {
+    while (true) {
+        xSemaphoreTake(m_busy, portMAX_DELAY); // taken before the check, stop() waits for the give
+        if (!m_f_active) {
+            xSemaphoreGive(m_busy);
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // next web stream
+            continue;
+        }
+        size_t filled = m_buff.bufferFilled();
+        size_t high = m_buff.getBufsize() * m_highWater / 100;
+        if (filled >= high) { // high watermark, sleep until the parser has drained the ring below the low watermark
+            m_f_waitDrain = true;
+            xSemaphoreGive(m_busy);
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+            continue;
+        }
+        int32_t avail = m_client->available();
+        if (avail <= 0) {
+            m_f_connected = m_client->connected();
+            xSemaphoreGive(m_busy);
+            m_f_waitData = true;
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(5)); // nothing received, woken early when the consumer runs dry
+            m_f_waitData = false;
+            continue;
+        }
+        size_t  n = std::min(std::min((size_t)avail, m_buff.writeSpace()), high - filled);
+        int32_t r = m_client->read(m_buff.getWritePtr(), n);
+        if (r > 0) m_buff.bytesWritten(r);
+        xSemaphoreGive(m_busy);
+    }
+}
+
+int32_t NetPrefetch::read(uint8_t* buff, size_t len) { // consumer side of m_buff
+    int32_t res = 0;
+    if (!buff) { // one byte
+        if (!m_buff.bufferFilled()) return -1;
+        res = *m_buff.getReadPtr();
+        m_buff.bytesWasRead(1);
+    } else {
+        while (len) {
+            size_t chunk = std::min(len, m_buff.getMaxAvailableBytes()); // twice at most, at the wrap around
+            if (!chunk) break;
+            memcpy(buff + res, m_buff.getReadPtr(), chunk);
+            m_buff.bytesWasRead(chunk);
+            res += chunk;
+            len -= chunk;
+        }
+    }
+    if (m_f_waitDrain && m_buff.bufferFilled() < m_buff.getBufsize() * m_lowWater / 100) {
+        m_f_waitDrain = false;
+        xTaskNotifyGive(m_task);
+    } else if (m_f_waitData && !m_buff.bufferFilled()) { // underrun, the producer polls again now
+        m_f_waitData = false;
+        xTaskNotifyGive(m_task);
+    }
+    return res;
+}
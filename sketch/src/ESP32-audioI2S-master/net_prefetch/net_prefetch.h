@@ -0,0 +1,51 @@
+/*
+ * net_prefetch.h
+ *
+ * web streams only: a separate task pulls the bytes from the client into a ring, processWebStream() in loop() reads
+ * metadata, chunk headers and audio data from the ring and never waits for a slow TCP read
+ *
+ * between start() and stop() only the task touches the client, stop() hands it back before any reconnect. The task
+ * holds m_busy while it uses the client, stop() waits for it at most STOP_TIMEOUT_MS (a TLS read can block)
+ * the task sleeps on its notification: the consumer gives it when the ring runs below the low watermark or empty
+ *
+ */
+#pragma once
+
+#include "../audio_buffer/audio_buffer.h"
+#include <Arduino.h>
+#include <NetworkClient.h>
+#include <atomic>
+
+class NetPrefetch {
+
+  public:
+    static constexpr size_t   BUFF_SIZE = 1024 * 128;  // ring, PSRAM
+    static constexpr uint32_t STACK_SIZE = 3072;
+    static constexpr uint32_t STOP_TIMEOUT_MS = 500;   // longest wait of stop() and start() for a read in progress
+
+    NetPrefetch();
+    ~NetPrefetch();
+    bool    start(NetworkClient* client); // false: no ring, no task or a read is stuck, read the client directly
+    bool    stop();                       // the client belongs to the caller again, false if a read did not return in time
+    bool    isActive() { return m_f_active; }
+    int32_t read(uint8_t* buff, size_t len); // buff == nullptr: one byte, results as NetworkClient::read()
+    int32_t available() { return m_buff.bufferFilled(); }
+    bool    connected() { return m_f_connected || m_buff.bufferFilled(); }
+    uint8_t fillPercent() { return (uint64_t)m_buff.bufferFilled() * 100 / m_buff.getBufsize(); }
+    void    setWatermarks(uint8_t lowPercent, uint8_t highPercent); // percent of the ring, stop reading at high, resume below low
+
+  private:
+    static void taskWrapper(void* param) { static_cast<NetPrefetch*>(param)->task(); }
+    void        task();
+
+    AudioBuffer       m_buff{4096};
+    NetworkClient*    m_client = nullptr;
+    TaskHandle_t      m_task = nullptr;
+    SemaphoreHandle_t m_busy = nullptr;         // held by the task while it uses m_client
+    std::atomic<bool> m_f_active{false};        // the task owns m_client
+    std::atomic<bool> m_f_connected{false};     // m_client->connected(), seen by the task
+    std::atomic<bool> m_f_waitDrain{false};     // high watermark reached, read() wakes the task below low watermark
+    std::atomic<bool> m_f_waitData{false};      // the task sleeps on an empty socket, read() wakes it when the ring is empty
+    uint8_t           m_lowWater = 50;          // percent
+    uint8_t           m_highWater = 90;         // percent
+};
@@ -20,7 +20,7 @@ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 bool SilkDecoder::init(){
     m_resampler_state.alloc_array(DECODER_NUM_CHANNELS);
-    m_channel_state.alloc_array(DECODER_NUM_CHANNELS);
+    m_channel_state.alloc_array(DECODER_NUM_CHANNELS, "m_channel_state");
     m_silk_decoder.alloc();
     m_silk_decoder_control.alloc();
     m_silk_DecControlStruct.alloc();
@@ -2,6 +2,8 @@
 
 #include "Arduino.h"
 #include <algorithm>
+#include <esp_heap_caps.h>
+#include <esp_memory_utils.h>
 #include <cstdio>
 #include <cstring>
 #include <memory>
@@ -13,11 +15,94 @@
 
 /** Auxiliary functions for using Unique Pointers in ESP32 PSRAM **/
 
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// Heap accounting by scope, e.g. the heap of one decoder: while a task points ps_heap_scope at an account,
+// the ps_ptr blocks it allocates and frees are counted with the size the heap reports for them
+//   ps_heap_account_t acc;
+//   { ps_heap_use_t use(&acc); dec->init(); }  // acc.live, acc.peak
+
+struct ps_heap_account_t {
+    int32_t live = 0; // bytes
+    int32_t peak = 0;
+};
+inline thread_local ps_heap_account_t* ps_heap_scope = nullptr;
+
+struct ps_heap_use_t { // sets the scope for its lifetime
+    ps_heap_account_t* prev;
+    explicit ps_heap_use_t(ps_heap_account_t* acc) : prev(ps_heap_scope) { ps_heap_scope = acc; }
+    ~ps_heap_use_t() { ps_heap_scope = prev; }
+};
+
+inline void ps_heap_count_new(void* p) {
+    if (!ps_heap_scope || !p) return;
+    ps_heap_scope->live += heap_caps_get_allocated_size(p);
+    if (ps_heap_scope->live > ps_heap_scope->peak) ps_heap_scope->peak = ps_heap_scope->live;
+}
+
+inline void ps_heap_count_free(void* p) {
+    if (ps_heap_scope && p) ps_heap_scope->live -= heap_caps_get_allocated_size(p);
+}
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// Blocks by address, for the placement log and the allocation registry: open addressing with backward shift deletion,
+// the callers hold their critical section
+
+struct ps_block_t {
+    void*    p; // nullptr: free slot
+    uint32_t size;
+    uint16_t nameIdx;
+    bool     internal;
+};
+
+struct ps_block_map_t {
+    ps_block_t* slots = nullptr; // PSRAM, a power of two of them
+    uint32_t    mask = 0;
+    uint32_t    count = 0;
+
+    bool alloc(uint32_t n) { // outside the critical section
+        std::size_t bs = n * sizeof(ps_block_t);
+        if (!slots) slots = static_cast<ps_block_t*>(psramFound() ? ps_malloc(bs) : malloc(bs));
+        if (!slots) return false;
+        mask = n - 1;
+        clear();
+        return true;
+    }
+    void clear() {
+        if (slots) memset(slots, 0, (mask + 1) * sizeof(ps_block_t));
+        count = 0;
+    }
+    bool     full() const { return count >= (mask + 1) / 4 * 3; }
+    uint32_t home(const void* p) const { return (((uint32_t)((uintptr_t)p >> 2) * 2654435761u) >> 16) & mask; } // Fibonacci hashing of the address
+    uint32_t find(const void* p) const { // slot of p, or the free slot that ends its probe sequence
+        uint32_t i = home(p);
+        while (slots[i].p && slots[i].p != p) i = (i + 1) & mask;
+        return i;
+    }
+    void erase(uint32_t i) { // the probe sequences stay unbroken
+        count--;
+        for (uint32_t j = (i + 1) & mask; slots[j].p; j = (j + 1) & mask) {
+            if (((j - home(slots[j].p)) & mask) >= ((j - i) & mask)) { // i lies on the probe path of j
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+        slots[i].p = nullptr;
+    }
+};
+
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // PSRAM Deleter (ps_malloc → free)
+inline void ps_placement_forget(void* p);
+inline void ps_track_remove(void* p);
+
 struct PsramDeleter {
     void operator()(void* ptr) const {
-        if (ptr) { free(ptr); }
+        if (ptr) {
+            ps_heap_count_free(ptr);
+            ps_placement_forget(ptr);
+            ps_track_remove(ptr);
+            free(ptr);
+        }
     }
 };
 
@@ -32,6 +117,380 @@ inline int strncasecmp_local(const char* s1, const char* s2, std::size_t n) {
     return 0;
 }
 
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// Allocation classes, where a buffer should live
+//   PS_COLD  PSRAM, as before
+//   PS_WARM  internal RAM while PS_WARM_RESERVE bytes stay free, else PSRAM (touched once per frame)
+//   PS_HOT   internal RAM while PS_HOT_RESERVE bytes stay free, else PSRAM (touched for every sample)
+//   PS_AUTO  the class of the name in the active placement table, PS_COLD if not listed (default)
+// the audio library activates one placement table per codec, see Audio::createDecoder()
+
+enum ps_class_t : uint8_t { PS_AUTO, PS_COLD, PS_WARM, PS_HOT };
+
+#ifndef PS_HOT_RESERVE
+    #define PS_HOT_RESERVE (48 * 1024) // internal RAM left for WiFi, lwIP and DMA
+#endif
+#ifndef PS_WARM_RESERVE
+    #define PS_WARM_RESERVE (96 * 1024)
+#endif
+#define PS_PLACEMENT_LOG    48  // names kept for the report
+#define PS_PLACEMENT_BLOCKS 256 // slots for the live blocks of the log, up to 3/4 of them used
+
+struct ps_placement_t {
+    const char* name; // as given to alloc()
+    ps_class_t  cls;
+};
+
+struct ps_landing_t { // the live blocks of one name, e.g. the per-channel buffers, summed
+    char       name[24];
+    uint32_t   hash;
+    uint16_t   blocks;
+    uint32_t   internalBytes;
+    uint32_t   psramBytes; // no room, no internal RAM to spare, or PS_COLD
+    ps_class_t cls;
+};
+
+struct ps_placement_state_t {
+    const ps_placement_t* table = nullptr; // nullptr: everything PS_COLD
+    uint8_t               count = 0;
+    ps_landing_t          log[PS_PLACEMENT_LOG];
+    uint8_t               logCount = 0;
+    ps_block_map_t        blocks;      // live blocks of the log, nameIdx: their entry
+    uint32_t              dropped = 0; // blocks not noted, log or map full
+    portMUX_TYPE          mux = portMUX_INITIALIZER_UNLOCKED;
+};
+inline ps_placement_state_t ps_placement;
+
+inline void ps_placement_use(const ps_placement_t* table, uint8_t count) { // nullptr, 0: off, both start a new log
+    if (!ps_placement.blocks.slots && !ps_placement.blocks.alloc(PS_PLACEMENT_BLOCKS)) printf("OOM: placement log without blocks\n");
+    portENTER_CRITICAL(&ps_placement.mux);
+    ps_placement.table = table;
+    ps_placement.count = count;
+    ps_placement.logCount = 0;
+    ps_placement.dropped = 0;
+    if (ps_placement.blocks.count) ps_placement.blocks.clear();
+    portEXIT_CRITICAL(&ps_placement.mux);
+}
+
+inline ps_class_t ps_placement_class(const char* name) {
+    if (!name || !ps_placement.table) return PS_COLD;
+    for (uint8_t i = 0; i < ps_placement.count; i++) {
+        if (strcmp(ps_placement.table[i].name, name) == 0) return ps_placement.table[i].cls;
+    }
+    return PS_COLD;
+}
+
+// every block allocated inside a ps_heap_use_t scope (the decoder's) is added to the entry of its name until PsramDeleter frees it:
+// the live bytes of a decoder, by name and region
+inline void ps_placement_note(void* p, const char* name, std::size_t size, ps_class_t cls, bool internal) {
+    if (!p || !ps_placement.blocks.slots) return;
+    if (!name) name = "unnamed";
+    uint32_t hash = 2166136261u; // FNV-1a, compared before the name
+    for (std::size_t i = 0; i < sizeof(ps_landing_t::name) - 1 && name[i]; i++) hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+    portENTER_CRITICAL(&ps_placement.mux);
+    uint8_t i = 0;
+    while (i < ps_placement.logCount && (ps_placement.log[i].hash != hash || strncmp(ps_placement.log[i].name, name, sizeof(ps_placement.log[i].name) - 1) != 0)) i++;
+    uint32_t s = ps_placement.blocks.find(p);
+    if (i == PS_PLACEMENT_LOG || (!ps_placement.blocks.slots[s].p && ps_placement.blocks.full())) {
+        ps_placement.dropped++;
+    } else {
+        ps_block_t& b = ps_placement.blocks.slots[s];
+        if (b.p) { // freed behind the log's back, the address is in use again
+            ps_landing_t& o = ps_placement.log[b.nameIdx];
+            o.blocks--;
+            (b.internal ? o.internalBytes : o.psramBytes) -= b.size;
+        } else {
+            ps_placement.blocks.count++;
+        }
+        b = {p, (uint32_t)size, i, internal};
+        ps_landing_t& l = ps_placement.log[i];
+        if (i == ps_placement.logCount) {
+            memset(&l, 0, sizeof(l));
+            strlcpy(l.name, name, sizeof(l.name));
+            l.hash = hash;
+            ps_placement.logCount++;
+        }
+        l.blocks++;
+        (internal ? l.internalBytes : l.psramBytes) += size;
+        l.cls = cls;
+    }
+    portEXIT_CRITICAL(&ps_placement.mux);
+}
+
+inline void ps_placement_forget(void* p) { // PsramDeleter, the block leaves the log
+    if (!ps_placement.blocks.count) return;
+    portENTER_CRITICAL(&ps_placement.mux);
+    if (ps_placement.blocks.count) {
+        uint32_t s = ps_placement.blocks.find(p);
+        if (ps_placement.blocks.slots[s].p) {
+            ps_block_t&   b = ps_placement.blocks.slots[s];
+            ps_landing_t& l = ps_placement.log[b.nameIdx];
+            l.blocks--;
+            (b.internal ? l.internalBytes : l.psramBytes) -= b.size;
+            ps_placement.blocks.erase(s);
+        }
+    }
+    portEXIT_CRITICAL(&ps_placement.mux);
+}
+
+inline uint8_t ps_placement_report(ps_landing_t* out, uint8_t max, uint32_t* dropped = nullptr) { // copies the names noted since ps_placement_use()
+    portENTER_CRITICAL(&ps_placement.mux);
+    uint8_t n = std::min(max, ps_placement.logCount);
+    memcpy(out, ps_placement.log, n * sizeof(ps_landing_t));
+    if (dropped) *dropped = ps_placement.dropped;
+    portEXIT_CRITICAL(&ps_placement.mux);
+    return n;
+}
+
+inline uint32_t ps_placement_internal_bytes() { // all names, without a copy of the log
+    uint32_t sum = 0;
+    portENTER_CRITICAL(&ps_placement.mux);
+    for (uint8_t i = 0; i < ps_placement.logCount; i++) sum += ps_placement.log[i].internalBytes;
+    portEXIT_CRITICAL(&ps_placement.mux);
+    return sum;
+}
+
+// malloc by class, *internal tells where the block landed
+inline void* ps_class_malloc(std::size_t size, ps_class_t cls, bool* internal) {
+    if (cls == PS_HOT || cls == PS_WARM) {
+        std::size_t reserve = (cls == PS_HOT) ? PS_HOT_RESERVE : PS_WARM_RESERVE;
+        if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) >= size + reserve) {
+            void* p = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            if (p) {
+                *internal = true;
+                return p;
+            }
+        }
+    }
+    *internal = !psramFound();
+    return psramFound() ? ps_malloc(size) : malloc(size);
+}
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// Allocation registry (opt-in), live ps_ptr blocks by name, region and high-water mark
+//   ps_track_enable(true);  // at boot, before the allocations of interest
+//   ps_track_mark();        // e.g. when the first station plays
+//   ps_track_dump(true);    // names that changed since the mark, a leak grows with every station change
+// a block leaves the registry when PsramDeleter frees it, raw pointers handed over with set() are not recorded
+// (swap_with_pointer() records them with the size the heap reports),
+// blocks are found by address and names by hash (open addressing), the critical sections do not scan the registry
+
+#ifndef PS_TRACK_BLOCKS
+    #define PS_TRACK_BLOCKS 1024 // slots, a power of two, up to 3/4 of them live, more are counted as dropped
+#endif
+#ifndef PS_TRACK_NAMES
+    #define PS_TRACK_NAMES 128
+#endif
+static_assert((PS_TRACK_BLOCKS & (PS_TRACK_BLOCKS - 1)) == 0 && PS_TRACK_BLOCKS <= 65536, "PS_TRACK_BLOCKS: power of two up to 65536");
+
+constexpr uint32_t ps_track_name_slots() { // power of two, at most half full
+    uint32_t n = 1;
+    while (n < 2 * PS_TRACK_NAMES) n <<= 1;
+    return n;
+}
+
+struct ps_track_name_t {
+    char     name[24];
+    uint32_t hash;
+    uint32_t blocks;
+    uint32_t psramBytes;
+    uint32_t internalBytes;
+    uint32_t peakBytes; // high-water mark of psramBytes + internalBytes
+    uint32_t markBytes; // live bytes at ps_track_mark()
+};
+
+struct ps_track_totals_t {
+    uint32_t blocks = 0;
+    uint32_t psramBytes = 0;
+    uint32_t internalBytes = 0;
+    uint32_t peakBytes = 0;
+    uint32_t markBytes = 0;
+    uint32_t dropped = 0; // allocations not recorded, registry full
+};
+
+struct ps_track_state_t {
+    ps_block_map_t    blocks; // PSRAM, allocated by ps_track_enable()
+    ps_track_name_t*  names = nullptr;
+    uint16_t*         nameSlots = nullptr; // index into names + 1, 0: free slot
+    uint16_t          nameCount = 0;
+    ps_track_totals_t totals;
+    volatile bool     enabled = false;
+    portMUX_TYPE      mux = portMUX_INITIALIZER_UNLOCKED;
+};
+inline ps_track_state_t ps_track;
+
+inline bool ps_track_enable(bool enable) { // off: stops recording and forgets all blocks
+    if (enable && !ps_track.names) {
+        std::size_t ns = PS_TRACK_NAMES * sizeof(ps_track_name_t);
+        std::size_t ss = ps_track_name_slots() * sizeof(uint16_t);
+        ps_track.names = static_cast<ps_track_name_t*>(psramFound() ? ps_malloc(ns) : malloc(ns));
+        ps_track.nameSlots = static_cast<uint16_t*>(psramFound() ? ps_malloc(ss) : malloc(ss));
+        if (!ps_track.names || !ps_track.nameSlots || !ps_track.blocks.alloc(PS_TRACK_BLOCKS)) {
+            free(ps_track.blocks.slots);
+            free(ps_track.names);
+            free(ps_track.nameSlots);
+            ps_track.blocks.slots = nullptr;
+            ps_track.names = nullptr;
+            ps_track.nameSlots = nullptr;
+            printf("OOM: allocation registry not enabled\n");
+            return false;
+        }
+    }
+    if (enable && !ps_track.enabled && ps_track.names) { // empty tables, nobody writes them while the registry is off
+        ps_track.blocks.clear();
+        memset(ps_track.nameSlots, 0, ps_track_name_slots() * sizeof(uint16_t));
+    }
+    portENTER_CRITICAL(&ps_track.mux);
+    ps_track.enabled = enable && ps_track.names;
+    if (!enable) {
+        ps_track.nameCount = 0;
+        ps_track.totals = {};
+    }
+    portEXIT_CRITICAL(&ps_track.mux);
+    return ps_track.enabled;
+}
+
+inline uint32_t ps_track_name_hash(const char* name) { // FNV-1a over the part of the name the registry keeps
+    uint32_t h = 2166136261u;
+    for (std::size_t i = 0; i < sizeof(ps_track_name_t::name) - 1 && name[i]; i++) h = (h ^ (uint8_t)name[i]) * 16777619u;
+    return h;
+}
+
+// the helpers below run inside the critical section
+
+inline uint16_t ps_track_name_index(const char* name, uint32_t hash) { // PS_TRACK_NAMES: no room for a new name
+    uint32_t s = hash & (ps_track_name_slots() - 1);
+    while (ps_track.nameSlots[s]) {
+        uint16_t n = ps_track.nameSlots[s] - 1;
+        if (ps_track.names[n].hash == hash && strncmp(ps_track.names[n].name, name, sizeof(ps_track.names[n].name) - 1) == 0) return n;
+        s = (s + 1) & (ps_track_name_slots() - 1);
+    }
+    if (ps_track.nameCount == PS_TRACK_NAMES) return PS_TRACK_NAMES;
+    uint16_t         n = ps_track.nameCount++;
+    ps_track_name_t& e = ps_track.names[n];
+    memset(&e, 0, sizeof(e));
+    strlcpy(e.name, name, sizeof(e.name));
+    e.hash = hash;
+    ps_track.nameSlots[s] = n + 1;
+    return n;
+}
+
+inline void ps_track_count(const ps_block_t& b, bool add) { // the block enters or leaves its name and the totals
+    ps_track_name_t&   e = ps_track.names[b.nameIdx];
+    ps_track_totals_t& t = ps_track.totals;
+    uint32_t&          eb = b.internal ? e.internalBytes : e.psramBytes;
+    uint32_t&          tb = b.internal ? t.internalBytes : t.psramBytes;
+    if (add) {
+        e.blocks++;
+        t.blocks++;
+        eb += b.size;
+        tb += b.size;
+        e.peakBytes = std::max(e.peakBytes, e.psramBytes + e.internalBytes);
+        t.peakBytes = std::max(t.peakBytes, t.psramBytes + t.internalBytes);
+    } else {
+        e.blocks--;
+        t.blocks--;
+        eb -= b.size;
+        tb -= b.size;
+    }
+}
+
+inline void ps_track_erase(uint32_t i) {
+    ps_track_count(ps_track.blocks.slots[i], false);
+    ps_track.blocks.erase(i);
+}
+
+inline void ps_track_add(void* p, std::size_t size, const char* name, bool internal) {
+    if (!ps_track.enabled || !p) return;
+    if (!name) name = "unnamed";
+    uint32_t hash = ps_track_name_hash(name);
+    portENTER_CRITICAL(&ps_track.mux);
+    if (ps_track.enabled) {
+        uint32_t i = ps_track.blocks.find(p);
+        if (ps_track.blocks.slots[i].p) { // freed behind the registry's back, the address is in use again
+            ps_track_erase(i);
+            i = ps_track.blocks.find(p);
+        }
+        uint16_t n = ps_track_name_index(name, hash);
+        if (n == PS_TRACK_NAMES || ps_track.blocks.full()) {
+            ps_track.totals.dropped++;
+        } else {
+            ps_track.blocks.slots[i] = {p, (uint32_t)size, n, internal};
+            ps_track.blocks.count++;
+            ps_track_count(ps_track.blocks.slots[i], true);
+        }
+    }
+    portEXIT_CRITICAL(&ps_track.mux);
+}
+
+inline void ps_track_remove(void* p) {
+    if (!ps_track.enabled || !p) return;
+    portENTER_CRITICAL(&ps_track.mux);
+    if (ps_track.enabled) {
+        uint32_t i = ps_track.blocks.find(p);
+        if (ps_track.blocks.slots[i].p) ps_track_erase(i);
+    }
+    portEXIT_CRITICAL(&ps_track.mux);
+}
+
+inline void ps_track_rename(void* p, const char* name, bool internal) { // a recorded block changed its owner, e.g. ps_ptr::swap()
+    if (!ps_track.enabled || !p) return;
+    if (!name) name = "unnamed";
+    uint32_t hash = ps_track_name_hash(name);
+    portENTER_CRITICAL(&ps_track.mux);
+    if (ps_track.enabled) {
+        ps_block_t& b = ps_track.blocks.slots[ps_track.blocks.find(p)];
+        uint16_t    n = b.p ? ps_track_name_index(name, hash) : PS_TRACK_NAMES;
+        if (n < PS_TRACK_NAMES) {
+            ps_track_count(b, false);
+            b.nameIdx = n;
+            b.internal = internal;
+            ps_track_count(b, true);
+        }
+    }
+    portEXIT_CRITICAL(&ps_track.mux);
+}
+
+inline void ps_track_mark() {
+    portENTER_CRITICAL(&ps_track.mux);
+    for (uint16_t i = 0; i < ps_track.nameCount; i++) ps_track.names[i].markBytes = ps_track.names[i].psramBytes + ps_track.names[i].internalBytes;
+    ps_track.totals.markBytes = ps_track.totals.psramBytes + ps_track.totals.internalBytes;
+    portEXIT_CRITICAL(&ps_track.mux);
+}
+
+inline ps_track_totals_t ps_track_totals() {
+    portENTER_CRITICAL(&ps_track.mux);
+    ps_track_totals_t t = ps_track.totals;
+    portEXIT_CRITICAL(&ps_track.mux);
+    return t;
+}
+
+inline void ps_track_dump(bool sinceMark = false) { // printf, sinceMark: only names whose live bytes differ from the mark
+    if (!ps_track.enabled) {
+        printf("allocation registry is off\n");
+        return;
+    }
+    std::size_t      ns = PS_TRACK_NAMES * sizeof(ps_track_name_t);
+    ps_track_name_t* names = static_cast<ps_track_name_t*>(psramFound() ? ps_malloc(ns) : malloc(ns)); // printf outside the lock
+    if (!names) return;
+    portENTER_CRITICAL(&ps_track.mux);
+    uint16_t          count = ps_track.nameCount;
+    ps_track_totals_t t = ps_track.totals;
+    memcpy(names, ps_track.names, count * sizeof(ps_track_name_t));
+    portEXIT_CRITICAL(&ps_track.mux);
+
+    printf("%-24s %6s %9s %9s %9s %9s\n", "name", "blocks", "PSRAM", "internal", "peak", "+mark");
+    for (uint16_t i = 0; i < count; i++) {
+        const ps_track_name_t& e = names[i];
+        int32_t                delta = (int32_t)(e.psramBytes + e.internalBytes) - (int32_t)e.markBytes;
+        if (sinceMark && delta == 0) continue;
+        printf("%-24s %6lu %9lu %9lu %9lu %+9ld\n", e.name, e.blocks, e.psramBytes, e.internalBytes, e.peakBytes, delta);
+    }
+    printf("%-24s %6lu %9lu %9lu %9lu %+9ld, %lu dropped\n", "total", t.blocks, t.psramBytes, t.internalBytes, t.peakBytes,
+           (int32_t)(t.psramBytes + t.internalBytes) - (int32_t)t.markBytes, t.dropped);
+    free(names);
+}
+
 template <typename T>
 
 class ps_ptr {
@@ -39,8 +498,24 @@ class ps_ptr {
     std::unique_ptr<T[], PsramDeleter> mem;
     size_t                             allocated_size = 0;
     char*                              name = nullptr; // member for object name
+    ps_class_t                         alloc_class = PS_AUTO;
+    bool                               internal = false; // the block is in internal RAM
     static inline T                    dummy{};        // For invalid accesses
 
+    // Auxiliary function, allocates by class (alloc, calloc), the name must be set before
+    void* class_malloc(std::size_t size) {
+        ps_class_t cls = (alloc_class == PS_AUTO) ? ps_placement_class(name) : alloc_class;
+        return ps_class_malloc(size, cls, &internal);
+    }
+
+    // Auxiliary function, a new block for the heap accounting, the placement log and the allocation registry
+    void track(void* p, std::size_t size) {
+        if (!p) return;
+        ps_heap_count_new(p);
+        if (ps_heap_scope) ps_placement_note(p, name, size, (alloc_class == PS_AUTO) ? ps_placement_class(name) : alloc_class, internal);
+        ps_track_add(p, size, name, internal);
+    }
+
     // Auxiliary function for setting the name
     void set_name(const char* new_name) {
         if (name) {
@@ -94,6 +569,8 @@ class ps_ptr {
     ps_ptr(ps_ptr&& other) noexcept { // move-constructor
         mem = std::move(other.mem);
         allocated_size = other.allocated_size;
+        alloc_class = other.alloc_class;
+        internal = other.internal;
         name = other.name;
         other.allocated_size = 0;
         other.name = nullptr;
@@ -108,6 +585,8 @@ class ps_ptr {
             }
             mem = std::move(other.mem);
             allocated_size = other.allocated_size;
+            alloc_class = other.alloc_class;
+            internal = other.internal;
             name = other.name;
             other.allocated_size = 0;
             other.name = nullptr;
@@ -134,13 +613,16 @@ class ps_ptr {
 
     bool alloc(std::size_t size, const char* alloc_name = nullptr, bool usePSRAM = true) {
         size = (size + 15) & ~15;                        // Align to 16 bytes
+        if (alloc_name) { set_name(alloc_name); }        // before the allocation, the name selects the class
+        mem.reset();
         if (psramFound() && usePSRAM) {                  // Check at the runtime whether PSRAM is available
-            mem.reset(static_cast<T*>(ps_malloc(size))); // <--- Important!
+            mem.reset(static_cast<T*>(class_malloc(size))); // <--- Important!
         } else {
             mem.reset(static_cast<T*>(malloc(size))); // <--- Important!
+            internal = true;
         }
         allocated_size = size;
-        if (alloc_name) { set_name(alloc_name); }
+        track(mem.get(), size);
         if (!mem) {
             printf("OOM: failed to allocate %zu bytes for %s\n", size, name ? name : "unnamed");
             return false;
@@ -151,15 +633,17 @@ class ps_ptr {
     bool alloc(const char* alloc_name = nullptr) { // alloc for single objects/structures
         reset();                                   // Freigabe des zuvor gehaltenen Speichers
         void* raw_mem = nullptr;
+        if (alloc_name) { set_name(alloc_name); }
         if (psramFound()) {                 // Check at the runtime whether PSRAM is available
-            raw_mem = ps_malloc(sizeof(T)); // allocated im PSRAM
+            raw_mem = class_malloc(sizeof(T)); // allocated im PSRAM, or internal RAM by class
         } else {
             raw_mem = malloc(sizeof(T)); // allocated im RAM
+            internal = true;
         }
-        if (alloc_name) { set_name(alloc_name); }
         if (raw_mem) {
             mem.reset(new (raw_mem) T()); // placed new: constructor of T is called up in PSRAM
             allocated_size = sizeof(T);
+            track(raw_mem, sizeof(T));
         } else {
             printf("OOM: failed to allocate %zu bytes for %s\n", sizeof(T), name ? name : "unnamed");
             allocated_size = 0; // make sure that allocated_size is 0 if allocation fails
@@ -183,9 +667,10 @@ class ps_ptr {
         void* raw_mem = nullptr;
 
         if (psramFound() && usePSRAM) { // Check at the runtime whether PSRAM is available
-            raw_mem = ps_malloc(total_size);
+            raw_mem = class_malloc(total_size);
         } else {
             raw_mem = malloc(total_size);
+            internal = true;
         }
 
         if (raw_mem) {
@@ -195,6 +680,7 @@ class ps_ptr {
             // Connect the allocated memory to the Unique_PTR
             mem.reset(static_cast<T*>(raw_mem));
             allocated_size = total_size;
+            track(raw_mem, total_size);
         } else {
             // Error treatment for storage allocation
             printf("OOM: failed to calloc %zu bytes for %s\n", total_size, name ? name : "unnamed");
@@ -265,6 +751,8 @@ class ps_ptr {
 
         mem.reset(static_cast<T*>(new_mem));
         allocated_size = new_size;
+        internal = !psramFound();
+        track(new_mem, new_size);
     }
     // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
     // 📌📌📌  A S S I G N  📌📌📌
@@ -509,16 +997,25 @@ class ps_ptr {
     // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
     // 📌📌📌  S W A P   📌📌📌
     // A.swap(B);
-    void swap(ps_ptr<T>& other) noexcept {
+    void swap(ps_ptr<T>& other) noexcept { // the names stay, the blocks change their owner in the registry
         std::swap(this->mem, other.mem);
         std::swap(this->allocated_size, other.allocated_size);
+        std::swap(this->alloc_class, other.alloc_class);
+        std::swap(this->internal, other.internal);
+        ps_track_rename(mem.get(), name, internal);
+        ps_track_rename(other.mem.get(), other.name, other.internal);
     }
     // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
     // 📌📌📌  S W A P   W I T H   R A W   P O I N T E R   📌📌📌
     void swap_with_pointer(T*& raw_ptr) noexcept {
         T* temp = get();
-        mem.release();                                   // Gib Besitz auf, ohne zu löschen
-        mem = std::unique_ptr<T, PsramDeleter>(raw_ptr); // Übernehme neuen Zeiger
+        ps_heap_count_free(temp); // leaves ps_ptr without being freed
+        ps_track_remove(temp);
+        ps_heap_count_new(raw_ptr);
+        mem.release();                                     // Gib Besitz auf, ohne zu löschen
+        mem = std::unique_ptr<T[], PsramDeleter>(raw_ptr); // Übernehme neuen Zeiger
+        internal = raw_ptr && !esp_ptr_external_ram(raw_ptr);
+        if (raw_ptr) ps_track_add(raw_ptr, heap_caps_get_allocated_size(raw_ptr), name, internal);
         raw_ptr = temp;
     }
     // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -550,11 +1047,13 @@ class ps_ptr {
             printf("OOM: append() failed for %zu bytes\n", new_len);
             return;
         }
+        internal = !psramFound();
+        track(mem.get(), new_len);
 
         // Copy existing content
         if (old_data) {
             std::memcpy(mem.get(), old_data, old_len);
-            free(old_data);
+            PsramDeleter()(old_data);
         }
 
         // Suffix anhängen
@@ -587,10 +1086,12 @@ class ps_ptr {
             printf("OOM: append(len) failed for %zu bytes\n", new_len);
             return;
         }
+        internal = !psramFound();
+        track(mem.get(), new_len);
 
         if (old_data) {
             std::memcpy(mem.get(), old_data, old_len);
-            free(old_data);
+            PsramDeleter()(old_data);
         }
 
         std::memcpy(static_cast<char*>(mem.get()) + old_len, suffix, len);
@@ -768,13 +1269,13 @@ class ps_ptr {
 
         if (!mem) {
             printf("OOM: appendf() failed for %zu bytes\n", new_len);
-            if (old_data) free(old_data);
+            if (old_data) PsramDeleter()(old_data);
             return;
         }
 
         if (old_data) {
             std::memcpy(mem.get(), old_data, old_len);
-            free(old_data);
+            PsramDeleter()(old_data);
         }
 
         std::snprintf(mem.get() + old_len, new_len - old_len, fmt, std::forward<Args>(args)...);
@@ -905,13 +1406,13 @@ class ps_ptr {
         alloc(new_len);
         if (!mem) {
             printf("OOM: appendf_va() failed for %zu bytes\n", new_len);
-            if (old_data) free(old_data);
+            if (old_data) PsramDeleter()(old_data);
             return;
         }
         // Vorherigen Inhalt kopieren
         if (old_data) {
             std::memcpy(mem.get(), old_data, old_len);
-            free(old_data);
+            PsramDeleter()(old_data);
         }
         // check null pointer
         safe_vsnprintf(static_cast<char*>(mem.get()) + old_len, new_len - old_len, fmt, args);
@@ -1383,6 +1884,7 @@ class ps_ptr {
     void set(T* ptr, std::size_t size = 0) {
         if (mem.get() != ptr) {
             mem.reset(ptr);
+            ps_heap_count_new(ptr); // freed by PsramDeleter from now on
             allocated_size = size;
         }
     }
@@ -1447,6 +1949,7 @@ class ps_ptr {
     ps_ptr<T>& operator=(T* raw_ptr) {
         if (mem.get() != raw_ptr) {
             mem.reset(raw_ptr);
+            ps_heap_count_new(raw_ptr); // freed by PsramDeleter from now on
             allocated_size = 0; // (raw_ptr != nullptr) ? /* Berechne Größe hier */ : 0;
         }
         return *this;
@@ -1858,6 +2361,17 @@ class ps_ptr {
 
     size_t size() const { return allocated_size; }
 
+    // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+    // 📌📌📌  A L L O C _ C L A S S   📌📌📌
+
+    // ps_ptr<int32_t> vbuf;
+    // vbuf.set_class(PS_HOT);  // before alloc(), overrides the placement table
+    // vbuf.alloc_array(1088, "vbuf");
+    // printf("%s\n", vbuf.is_internal() ? "SRAM" : "PSRAM");
+
+    void set_class(ps_class_t cls) { alloc_class = cls; }
+    bool is_internal() const { return mem && internal; }
+
     // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
     // 📌📌📌  V A L I D   📌📌📌
 
@@ -2028,6 +2542,9 @@ template <typename T> class ps_struct_ptr {
         }
         if (raw_mem) {
             mem.reset(new (raw_mem) T());
+            ps_heap_count_new(raw_mem);
+            if (ps_heap_scope) ps_placement_note(raw_mem, name, sizeof(T), PS_COLD, !psramFound());
+            ps_track_add(raw_mem, sizeof(T), name, !psramFound());
         } else {
             printf("OOM: failed to allocate %zu bytes for %s\n", sizeof(T), name ? name : (name_str ? name_str : "unnamed"));
         }
@@ -2046,6 +2563,9 @@ template <typename T> class ps_struct_ptr {
         }
         if (raw_mem) {
             mem.reset(static_cast<T*>(raw_mem));
+            ps_heap_count_new(raw_mem);
+            if (ps_heap_scope) ps_placement_note(raw_mem, name, sizeof(T), PS_COLD, !psramFound());
+            ps_track_add(raw_mem, sizeof(T), name, !psramFound());
         } else {
             printf("OOM: failed to allocate %zu bytes for %s\n", sizeof(T), name ? name : (name_str ? name_str : "unnamed"));
         }
@@ -2243,6 +2763,9 @@ template <typename T> class ps_array2d {
         } else {
             mem.reset(static_cast<T*>(malloc(total_size)));
         }
+        ps_heap_count_new(mem.get());
+        if (ps_heap_scope) ps_placement_note(mem.get(), name, total_size, PS_COLD, !(psramFound() && usePSRAM));
+        ps_track_add(mem.get(), total_size, name, !(psramFound() && usePSRAM));
         if (!mem) {
             printf("OOM: failed to allocate %zu bytes for %s\n", total_size, name ? name : (alloc_name ? alloc_name : "unnamed"));
             rows = 0;
@@ -2267,6 +2790,9 @@ template <typename T> class ps_array2d {
         }
         if (raw_mem) {
             mem.reset(static_cast<T*>(raw_mem));
+            ps_heap_count_new(raw_mem);
+            if (ps_heap_scope) ps_placement_note(raw_mem, name, total_size, PS_COLD, !(psramFound() && usePSRAM));
+            ps_track_add(raw_mem, total_size, name, !(psramFound() && usePSRAM));
         } else {
             printf("OOM: failed to allocate %zu bytes for %s\n", total_size, name ? name : (alloc_name ? alloc_name : "unnamed"));
             rows = 0;
@@ -2427,6 +2953,9 @@ template <typename T> class ps_array3d {
         } else {
             mem.reset(static_cast<T*>(malloc(total_size)));
         }
+        ps_heap_count_new(mem.get());
+        if (ps_heap_scope) ps_placement_note(mem.get(), name, total_size, PS_COLD, !(psramFound() && usePSRAM));
+        ps_track_add(mem.get(), total_size, name, !(psramFound() && usePSRAM));
         if (!mem) {
             printf("OOM: failed to allocate %zu bytes for %s\n", total_size, name ? name : (alloc_name ? alloc_name : "unnamed"));
             dim1 = 0;
@@ -2453,6 +2982,9 @@ template <typename T> class ps_array3d {
         }
         if (raw_mem) {
             mem.reset(static_cast<T*>(raw_mem));
+            ps_heap_count_new(raw_mem);
+            if (ps_heap_scope) ps_placement_note(raw_mem, name, total_size, PS_COLD, !(psramFound() && usePSRAM));
+            ps_track_add(raw_mem, total_size, name, !(psramFound() && usePSRAM));
         } else {
             printf("OOM: failed to allocate %zu bytes for %s\n", total_size, name ? name : (alloc_name ? alloc_name : "unnamed"));
             dim1 = 0;
@@ -0,0 +1,169 @@
+/*
+ * resampler.cpp
+ *
+ * polyphase FIR resampler, fixed point hot path
+ *
+ *   the input is (virtually) upsampled by L, lowpass filtered and decimated by M
+ *   only the taps that hit real input samples are computed:
+ *   output at upsampled time i * L + p  =  sum(k) x[i - k] * h[k * L + p]
+ *
+ *   h is a Kaiser windowed sinc, cut off just below min(inRate, 48kHz) / 2
+ *   h is symmetric, h[n] = h[L * TAPS - 1 - n], so phase L - 1 - p holds the taps of phase p in reverse order
+ *
+ */
+#include "resampler.h"
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+static inline int16_t sat16(int32_t v) {
+    if (v > INT16_MAX) return INT16_MAX;
+    if (v < INT16_MIN) return INT16_MIN;
+    return (int16_t)v;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+static float besselI0(float x) { // modified Bessel function of the first kind, order 0 (Kaiser window)
+    float sum = 1.0f, term = 1.0f, q = x * x / 4.0f;
+    for (int k = 1; k < 25; k++) {
+        term *= q / ((float)k * (float)k);
+        sum += term;
+        if (term < sum * 1e-7f) break;
+    }
+    return sum;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+uint32_t Resampler::gcd(uint32_t a, uint32_t b) {
+    while (b) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool Resampler::setInputRate(uint32_t inRate) {
+    if (!inRate) return false;
+    if (inRate == m_inRate && (m_coef || isBypass())) return true; // table is still valid
+
+    uint32_t g = gcd(OUT_RATE, inRate);
+    uint32_t L = OUT_RATE / g;
+    uint32_t M = inRate / g;
+    if (L > MAX_PHASES) { // odd sample rate, approximate the ratio (pitch error < 0.1%)
+        M = (inRate * MAX_PHASES + OUT_RATE / 2) / OUT_RATE;
+        L = MAX_PHASES;
+        log_w("resampler: %lu Hz approximated by %lu/%lu", (unsigned long)inRate, (unsigned long)L, (unsigned long)M);
+    }
+    m_inRate = inRate;
+    m_L = L;
+    m_M = M;
+    m_half = (L + 1) / 2;
+    m_coef = nullptr;
+    reset();
+    if (isBypass()) return true; // the cached tables stay for the next track
+
+    table_t* slot = &m_tables[0];
+    for (table_t& t : m_tables) {
+        if (t.inRate == inRate && t.coef) {
+            slot = &t;
+            break;
+        }
+        if (t.lastUse < slot->lastUse) slot = &t; // unused slots are 0, taken first
+    }
+    if (slot->inRate != inRate || !slot->coef) {
+        if (!buildTable(*slot)) return false;
+    }
+    slot->lastUse = ++m_useCount;
+    m_coef = slot->coef.get();
+    return true;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void Resampler::reset() {
+    memset(m_hist, 0, sizeof(m_hist));
+    m_histPos = 0;
+    m_phase = 0;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool Resampler::buildTable(table_t& t) {
+    size_t bytes = (size_t)m_half * TAPS * sizeof(int16_t); // 15 KB at 11.025 kHz, 3.8 KB at 44.1 kHz
+    t.inRate = 0;
+    // the table is read for every output sample, prefer internal RAM
+    if (!t.coef.alloc(bytes, "resampler_coef", false) && !t.coef.alloc(bytes, "resampler_coef", true)) {
+        log_e("resampler: OOM, %u bytes for the phase table", bytes);
+        return false;
+    }
+
+    const float N = (float)m_L * TAPS;
+    const float center = (N - 1.0f) / 2.0f;
+    const float beta = 7.0f;                                                             // ~ -70dB stopband
+    const float fc = 0.455f * (float)min(m_inRate, OUT_RATE) / ((float)m_inRate * m_L); // cycles per upsampled sample
+    const float i0beta = besselI0(beta);
+
+    float phaseCoef[TAPS];
+    for (uint16_t p = 0; p < m_half; p++) {
+        float sum = 0;
+        for (uint8_t k = 0; k < TAPS; k++) {
+            float n = (float)k * m_L + p - center;
+            float x = 2.0f * fc * n;
+            float sinc = (fabsf(x) < 1e-6f) ? 1.0f : sinf(PI * x) / (PI * x);
+            float r = n / (N / 2.0f);
+            float w = (fabsf(r) < 1.0f) ? besselI0(beta * sqrtf(1.0f - r * r)) / i0beta : 0.0f;
+            phaseCoef[k] = sinc * w;
+            sum += phaseCoef[k];
+        }
+        // every phase gets unity DC gain, avoids a ripple at the phase rate
+        int16_t* c = t.coef.get() + (size_t)p * TAPS;
+        for (uint8_t k = 0; k < TAPS; k++) { c[k] = (int16_t)lrintf(phaseCoef[k] / sum * (1 << COEF_SHIFT)); }
+    }
+    t.inRate = m_inRate;
+    log_i("resampler: %lu Hz -> 48 kHz, L=%u M=%u, %u taps, table %u bytes (%u phases)", (unsigned long)m_inRate, m_L, m_M, TAPS, bytes, m_half);
+    return true;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+inline void Resampler::push(int16_t left, int16_t right) {
+    m_histPos = m_histPos ? m_histPos - 1 : TAPS - 1;
+    m_hist[0][m_histPos] = left;
+    m_hist[0][m_histPos + TAPS] = left;
+    m_hist[1][m_histPos] = right;
+    m_hist[1][m_histPos + TAPS] = right;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+size_t IRAM_ATTR Resampler::process(const int16_t* in, size_t inFrames, int16_t* out, size_t maxOutFrames) {
+    if (isBypass()) {
+        size_t n = min(inFrames, maxOutFrames);
+        memcpy(out, in, n * 2 * sizeof(int16_t));
+        return n;
+    }
+    if (!m_coef) return 0;
+
+    const int16_t* coef = m_coef;
+    size_t         outFrames = 0;
+
+    for (size_t i = 0; i < inFrames; i++) {
+        push(in[i * 2], in[i * 2 + 1]);
+        const int16_t* hl = &m_hist[0][m_histPos]; // newest first
+        const int16_t* hr = &m_hist[1][m_histPos];
+
+        while (m_phase < m_L) {
+            if (outFrames >= maxOutFrames) return outFrames; // caller buffer too small, should not happen
+            int32_t accL = 1 << (COEF_SHIFT - 1); // rounding
+            int32_t accR = 1 << (COEF_SHIFT - 1);
+            if (m_phase < m_half) {
+                const int16_t* c = coef + (size_t)m_phase * TAPS;
+                for (uint8_t k = 0; k < TAPS; k++) {
+                    accL += (int32_t)c[k] * hl[k];
+                    accR += (int32_t)c[k] * hr[k];
+                }
+            } else { // mirrored phase
+                const int16_t* c = coef + (size_t)(m_L - 1 - m_phase) * TAPS + TAPS - 1;
+                for (uint8_t k = 0; k < TAPS; k++) {
+                    accL += (int32_t)c[-k] * hl[k];
+                    accR += (int32_t)c[-k] * hr[k];
+                }
+            }
+            out[outFrames * 2] = sat16(accL >> COEF_SHIFT);
+            out[outFrames * 2 + 1] = sat16(accR >> COEF_SHIFT);
+            outFrames++;
+            m_phase += m_M;
+        }
+        m_phase -= m_L;
+    }
+    return outFrames;
+}
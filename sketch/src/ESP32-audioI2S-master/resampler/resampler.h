@@ -0,0 +1,54 @@
+/*
+ * resampler.h
+ *
+ * streaming polyphase resampler, any input rate -> 48kHz stereo int16
+ * the ratio is reduced to L/M (48000/gcd : inRate/gcd), the phase table is built once per ratio, by setInputRate() only
+ * the filter is symmetric, phase L-1-p is phase p reversed, so only (L + 1) / 2 phases are stored
+ * the tables of the last TABLE_SLOTS input rates are kept, setSampleRate() on the decode path switches between them
+ * without a rebuild when the next track has a rate seen before
+ *
+ */
+#pragma once
+
+#include "../psram_unique_ptr.hpp"
+#include <Arduino.h>
+
+class Resampler {
+
+  public:
+    static constexpr uint32_t OUT_RATE = 48000;
+    static constexpr uint8_t  TAPS = 24;        // FIR length of one phase
+    static constexpr uint16_t MAX_PHASES = 640; // 11.025kHz -> 48kHz needs 640
+    static constexpr uint8_t  COEF_SHIFT = 14;  // coefficients are Q14, sum(|h|) < 2 keeps the MAC inside int32
+    static constexpr uint8_t  TABLE_SLOTS = 3;  // cached phase tables, 44.1 + 22.05 + 11.025 kHz take 27 KB
+
+    Resampler() {}
+    ~Resampler() {}
+    bool     setInputRate(uint32_t inRate); // switch to the phase table of the ratio, built if not cached, not for the play loop
+    void     reset();                       // clear history and phase, keep the table
+    size_t   process(const int16_t* in, size_t inFrames, int16_t* out, size_t maxOutFrames); // interleaved L/R, returns output frames
+    uint32_t getInputRate() { return m_inRate; }
+    bool     isBypass() { return m_L == m_M; }
+
+  private:
+    struct table_t {
+        ps_ptr<int16_t> coef;             // [m_half][TAPS] Q14, phase p < m_half at coef[p * TAPS]
+        uint32_t        inRate = 0;       // 0: slot unused
+        uint32_t        lastUse = 0;
+    };
+
+    void     push(int16_t left, int16_t right);
+    bool     buildTable(table_t& t);
+    uint32_t gcd(uint32_t a, uint32_t b);
+
+    table_t         m_tables[TABLE_SLOTS];
+    const int16_t*  m_coef = nullptr;     // table of m_inRate in m_tables, nullptr in bypass
+    uint32_t        m_useCount = 0;       // age of the slots, the least recently used one is rebuilt
+    int16_t         m_hist[2][TAPS * 2];  // per channel, each sample stored twice so the window is always contiguous
+    uint8_t         m_histPos = 0;        // newest sample in m_hist[ch][m_histPos]
+    uint32_t        m_inRate = 0;
+    uint16_t        m_L = 1;              // interpolation factor
+    uint16_t        m_M = 1;              // decimation factor
+    uint16_t        m_half = 1;           // phases in m_coef, (m_L + 1) / 2
+    uint16_t        m_phase = 0;          // next output phase 0 ... m_L - 1
+};
@@ -0,0 +1,516 @@
+/*
+ * seek_index.cpp
+ *
+ * the scan only ever reads, it uses its own file handle and yields after every window
+ *
+ *   MP3   hop from header to header, a header counts if the header behind its frame is valid too
+ *         with a TOC (table points) only the frame at or behind every TOC entry is searched, the file is not scanned
+ *   FLAC  every 0xFFF8/0xFFF9 with a valid CRC-8 whose first sample continues the previous frame, the search for the
+ *         next one starts the minimum frame size behind it
+ *   M4A   sum of the stsz entries, the frames are expected back to back behind m_audioDataStart
+ *
+ */
+#include "seek_index.h"
+#include <FFat.h>
+#include <LittleFS.h>
+#include <SD.h>
+#include <SD_MMC.h>
+
+namespace {
+
+typedef struct {
+    uint32_t magic;
+    uint8_t  version;
+    uint8_t  kind;
+    uint16_t reserved;
+    uint32_t fileSize;
+    uint32_t pathHash;
+    uint32_t dataStart;
+    uint32_t dataSize;
+    uint32_t rate;
+    uint32_t total;
+    uint32_t count;
+} cache_hdr_t;
+
+constexpr uint32_t CACHE_MAGIC = 0x58444953; // "SIDX"
+constexpr uint8_t  CACHE_VERSION = 2; // 2: the file system is part of pathHash
+
+const uint16_t mp3_bitrate[2][16] = {{0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0},  // MPEG1 layer III
+                                     {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0}}; // MPEG2, MPEG2.5 layer III
+const uint32_t mp3_samplerate[3] = {44100, 48000, 32000};
+const uint32_t flac_samplerate[12] = {0, 88200, 176400, 192000, 8000, 16000, 22050, 24000, 32000, 44100, 48000, 96000};
+
+uint32_t fnv1a(const void* data, size_t len, uint32_t h = 2166136261u) {
+    const uint8_t* p = (const uint8_t*)data;
+    while (len--) {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// the same path on SD and on LittleFS is another file; unknown file systems are told apart by their object,
+// whose address only changes with the firmware (a stale key costs one rescan)
+uint32_t fsHash(fs::FS& fs) {
+    const char* name = &fs == &SD ? "sd:" : &fs == &SD_MMC ? "sdmmc:" : &fs == &FFat ? "ffat:" : &fs == &LittleFS ? "littlefs:" : nullptr;
+    if (name) return fnv1a(name, strlen(name));
+    fs::FS* p = &fs;
+    return fnv1a(&p, sizeof(p));
+}
+
+uint8_t crc8(const uint8_t* p, size_t len) { // FLAC frame header, poly 0x07
+    uint8_t crc = 0;
+    while (len--) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; i++) crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+    return crc;
+}
+
+} // namespace
+
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+int32_t SeekIndex::mp3FrameLen(const uint8_t* h, uint32_t* samples, uint32_t* rate) {
+    if (h[0] != 0xFF || (h[1] & 0xE0) != 0xE0) return 0;
+    uint8_t version = (h[1] >> 3) & 0x03;                          // 3 = MPEG1, 2 = MPEG2, 0 = MPEG2.5
+    if (version == 1 || ((h[1] >> 1) & 0x03) != 1) return 0;       // reserved, not layer III
+    uint8_t brIdx = h[2] >> 4;
+    uint8_t srIdx = (h[2] >> 2) & 0x03;
+    if (brIdx == 0 || brIdx == 15 || srIdx == 3) return 0;         // free format is not indexed
+    uint32_t sr = mp3_samplerate[srIdx] >> (version == 3 ? 0 : version == 2 ? 1 : 2);
+    uint32_t br = mp3_bitrate[version == 3 ? 0 : 1][brIdx] * 1000;
+    uint32_t spf = version == 3 ? 1152 : 576;
+    *samples = spf;
+    *rate = sr;
+    return spf / 8 * br / sr + ((h[2] >> 1) & 0x01);
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+int32_t SeekIndex::flacFrameHeader(const uint8_t* p, size_t len, uint32_t fixedBlockSize, uint32_t* sample, uint32_t* blockSize, uint32_t* rate) {
+    if (len < 6 || p[0] != 0xFF || (p[1] & 0xFE) != 0xF8) return 0;
+    uint8_t bsCode = p[2] >> 4;
+    uint8_t srCode = p[2] & 0x0F;
+    if (bsCode == 0 || srCode == 15) return 0;                      // reserved, invalid
+    if ((p[3] >> 4) > 10 || ((p[3] >> 1) & 0x07) == 3 || (p[3] & 0x01)) return 0;
+
+    size_t   i = 4;
+    uint8_t  c = p[i++];
+    uint64_t num = 0;
+    int      extra = 0;
+    if (!(c & 0x80)) { num = c; }                                   // UTF-8 like coded frame or sample number
+    else if ((c & 0xE0) == 0xC0) { num = c & 0x1F; extra = 1; }
+    else if ((c & 0xF0) == 0xE0) { num = c & 0x0F; extra = 2; }
+    else if ((c & 0xF8) == 0xF0) { num = c & 0x07; extra = 3; }
+    else if ((c & 0xFC) == 0xF8) { num = c & 0x03; extra = 4; }
+    else if ((c & 0xFE) == 0xFC) { num = c & 0x01; extra = 5; }
+    else if (c == 0xFE) { extra = 6; }
+    else return 0;
+    if (i + extra + 5 > len) return 0;                              // number, block size, sample rate, CRC
+    while (extra--) {
+        if ((p[i] & 0xC0) != 0x80) return 0;
+        num = (num << 6) | (p[i++] & 0x3F);
+    }
+
+    uint32_t bs;
+    if (bsCode == 1) bs = 192;
+    else if (bsCode <= 5) bs = 576 << (bsCode - 2);
+    else if (bsCode == 6) bs = p[i++] + 1;
+    else if (bsCode == 7) { bs = ((p[i] << 8) | p[i + 1]) + 1; i += 2; }
+    else bs = 256 << (bsCode - 8);
+
+    uint32_t sr;
+    if (srCode < 12) sr = flac_samplerate[srCode];                  // 0 = see STREAMINFO
+    else if (srCode == 12) sr = p[i++] * 1000;
+    else { sr = (p[i] << 8) | p[i + 1]; i += 2; if (srCode == 14) sr *= 10; }
+
+    if (crc8(p, i) != p[i]) return 0;
+    *sample = (p[1] & 0x01) ? (uint32_t)num : (uint32_t)num * (fixedBlockSize ? fixedBlockSize : bs);
+    *blockSize = bs;
+    *rate = sr;
+    return i + 1;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::setCache(fs::FS& fs, const char* dir) {
+    m_cacheFs = &fs;
+    m_cacheDir.assign(dir);
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::open(fs::FS& fs, const char* path, uint32_t fileSize) {
+    close();
+    if (!path) return;
+    m_fs = &fs;
+    m_path.assign(path);
+    m_fileSize = fileSize;
+    m_pathHash = fnv1a(path, strlen(path), fsHash(fs));
+    m_key = fnv1a(&fileSize, sizeof(fileSize), m_pathHash);
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::addTablePoint(uint32_t sample, uint32_t pos) {
+    if (!m_table.valid() && !m_table.alloc_array(MAX_TABLE_POINTS, "seekTable")) return;
+    if (m_tableCount >= MAX_TABLE_POINTS) return;
+    if (m_tableCount && m_table.get()[m_tableCount - 1].sample >= sample) return; // ascending only
+    m_table.get()[m_tableCount++] = {sample, pos};
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::build(kind_t kind, uint32_t dataStart, uint32_t dataSize, uint32_t rate, uint32_t param1, uint32_t param2, uint32_t param3) {
+    if (!m_fs || !m_path.valid() || m_task || !rate || !dataSize) return;
+    m_kind = kind;
+    m_dataStart = dataStart;
+    m_dataSize = dataSize;
+    m_rate = rate;
+    m_param1 = param1;
+    m_param2 = param2;
+    m_param3 = param3;
+    if (loadCache(kind, dataStart, dataSize)) {
+        log_d("seek index: %lu points from cache", (unsigned long)m_count.load());
+        return;
+    }
+
+    m_capacity = dataSize / POINT_SPACING + 2; // points are at least POINT_SPACING apart
+    if (!m_points.alloc_array(m_capacity, "seekPoints") || !m_buf.alloc(SCAN_BUF_SIZE, "seekScanBuf")) {
+        m_points.reset();
+        m_buf.reset();
+        return;
+    }
+    m_count.store(0);
+    m_winStart = 0;
+    m_winLen = 0;
+    m_abort.store(false);
+    if (!m_done) m_done = xSemaphoreCreateBinary();
+    if (xTaskCreatePinnedToCore(&SeekIndex::taskWrapper, "seekIndex", 4 * 1024, this, 1, &m_task, 1) != pdPASS) {
+        m_task = nullptr;
+        log_w("seek index: no task");
+    }
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::close() {
+    if (m_task) {
+        m_abort.store(true);
+        xSemaphoreTake(m_done, portMAX_DELAY); // the scan stops at the next window
+        m_task = nullptr;
+    }
+    m_abort.store(false);
+    m_complete.store(false);
+    m_count.store(0);
+    m_capacity = 0;
+    m_points.reset();
+    m_table.reset();
+    m_tableCount = 0;
+    m_buf.reset();
+    m_kind = SIDX_NONE;
+    m_rate = 0;
+    m_total = 0;
+    m_fromCache = false;
+    m_buildMs = 0;
+    m_fs = nullptr;
+    m_path.reset();
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool SeekIndex::lookup(uint32_t sample, point_t& p) {
+    bool           complete = m_complete.load(); // before the count, a complete index has its final count
+    uint32_t       n = m_count.load(std::memory_order_acquire);
+    const point_t* pts = m_points.get();
+    if (!n || (!complete && pts[n - 1].sample <= sample)) { // not scanned that far yet
+        pts = m_table.get();
+        n = m_tableCount;
+        if (!n || pts[n - 1].sample <= sample) return false;
+    }
+    if (pts[0].sample > sample) return false;
+    uint32_t lo = 0, hi = n;
+    while (hi - lo > 1) {
+        uint32_t mid = (lo + hi) / 2;
+        if (pts[mid].sample <= sample) lo = mid;
+        else hi = mid;
+    }
+    p = pts[lo];
+    return true;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool SeekIndex::sampleAt(uint32_t pos, uint32_t& sample) {
+    bool           complete = m_complete.load();
+    uint32_t       n = m_count.load(std::memory_order_acquire);
+    const point_t* pts = m_points.get();
+    if (!n || (!complete && pts[n - 1].pos <= pos)) {
+        pts = m_table.get();
+        n = m_tableCount;
+        complete = false;
+        if (!n || pts[n - 1].pos <= pos) return false;
+    }
+    if (pts[0].pos > pos) return false;
+    uint32_t lo = 0, hi = n;
+    while (hi - lo > 1) {
+        uint32_t mid = (lo + hi) / 2;
+        if (pts[mid].pos <= pos) lo = mid;
+        else hi = mid;
+    }
+    uint32_t s0 = pts[lo].sample, p0 = pts[lo].pos;
+    uint32_t s1 = lo + 1 < n ? pts[lo + 1].sample : m_total;
+    uint32_t p1 = lo + 1 < n ? pts[lo + 1].pos : m_dataSize;
+    if (pos > p1) pos = p1;
+    sample = (p1 > p0 && s1 > s0) ? s0 + (uint32_t)((uint64_t)(s1 - s0) * (pos - p0) / (p1 - p0)) : s0;
+    return true;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool SeekIndex::posAt(uint32_t sample, uint32_t& pos) {
+    bool           complete = m_complete.load();
+    uint32_t       n = m_count.load(std::memory_order_acquire);
+    const point_t* pts = m_points.get();
+    if (!n || (!complete && pts[n - 1].sample <= sample)) {
+        pts = m_table.get();
+        n = m_tableCount;
+        if (!n || pts[n - 1].sample <= sample) return false;
+    }
+    if (pts[0].sample > sample) return false;
+    uint32_t lo = 0, hi = n;
+    while (hi - lo > 1) {
+        uint32_t mid = (lo + hi) / 2;
+        if (pts[mid].sample <= sample) lo = mid;
+        else hi = mid;
+    }
+    uint32_t s0 = pts[lo].sample, p0 = pts[lo].pos;
+    uint32_t s1 = lo + 1 < n ? pts[lo + 1].sample : m_total;
+    uint32_t p1 = lo + 1 < n ? pts[lo + 1].pos : m_dataSize;
+    if (sample > s1) sample = s1;
+    pos = (p1 > p0 && s1 > s0) ? p0 + (uint32_t)((uint64_t)(p1 - p0) * (sample - s0) / (s1 - s0)) : p0;
+    return true;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+SeekIndex::info_t SeekIndex::getInfo() {
+    info_t i;
+    i.points = m_count.load();
+    i.buildMs = m_buildMs;
+    i.complete = m_complete.load();
+    i.fromCache = m_fromCache;
+    return i;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::addPoint(uint32_t sample, uint32_t pos) {
+    uint32_t n = m_count.load(std::memory_order_relaxed);
+    if (n >= m_capacity) return;
+    m_points.get()[n] = {sample, pos};
+    m_count.store(n + 1, std::memory_order_release); // readers see the point only after it is written
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+uint32_t SeekIndex::window(File& f, uint32_t pos) {
+    // keeps [pos, pos + SCAN_LOOKAHEAD) in m_buf (less at the end of the data), returns the bytes available at pos
+    uint32_t end = m_winStart + m_winLen;
+    if (pos < m_winStart || (pos + SCAN_LOOKAHEAD > end && end < m_dataSize)) {
+        if (m_abort.load()) return 0;
+        vTaskDelay(1); // give the card back to the audio task
+        uint32_t n = m_dataSize - pos;
+        if (n > SCAN_BUF_SIZE) n = SCAN_BUF_SIZE;
+        if (!f.seek(m_dataStart + pos)) return 0;
+        m_winStart = pos;
+        m_winLen = f.read(m_buf.get(), n);
+        end = m_winStart + m_winLen;
+    }
+    return end > pos ? end - pos : 0;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool SeekIndex::scanMp3(File& f) {
+    uint32_t pos = 0, next = 0, sample = 0;
+    uint32_t spf, rate, nspf, nrate;
+    while (pos + 4 <= m_dataSize) {
+        uint32_t avail = window(f, pos);
+        if (avail < 4) return false; // read error or abort
+        const uint8_t* h = m_buf.get() + (pos - m_winStart);
+        int32_t        len = mp3FrameLen(h, &spf, &rate);
+        if (len && (uint32_t)len + 4 <= avail) {
+            if (!mp3FrameLen(h + len, &nspf, &nrate) || nrate != rate) len = 0;
+        } else if ((uint32_t)len > avail) {
+            len = 0;
+        }
+        if (!len) { // resync
+            const uint8_t* ff = (const uint8_t*)memchr(h + 1, 0xFF, avail - 1);
+            pos += ff ? ff - h : avail;
+            continue;
+        }
+        if (pos >= next) {
+            addPoint(sample, pos);
+            next = pos + POINT_SPACING;
+        }
+        sample += spf;
+        pos += len;
+    }
+    m_total = sample;
+    return m_count.load() > 0;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool SeekIndex::scanMp3Toc(File& f) {
+    // a TOC entry is an estimate, its point is the first frame at or behind it whose following header is valid too; the
+    // sample is interpolated to the next entry and rounded down to a frame, the points keep POINT_SPACING
+    const point_t* t = m_table.get();
+    uint32_t       next = 0, spf = 0, rate, nspf, nrate;
+    for (uint16_t i = 0; i < m_tableCount; i++) {
+        uint32_t pos = t[i].pos < next ? next : t[i].pos;
+        uint32_t end = pos + SCAN_BUF_SIZE; // no frame within one read, no point
+        int32_t  len = 0;
+        while (pos < end && pos + 4 <= m_dataSize) {
+            uint32_t avail = window(f, pos);
+            if (avail < 4) return false;
+            const uint8_t* h = m_buf.get() + (pos - m_winStart);
+            len = mp3FrameLen(h, &spf, &rate);
+            if (len && (uint32_t)len + 4 <= avail && mp3FrameLen(h + len, &nspf, &nrate) && nrate == rate) break;
+            len = 0;
+            const uint8_t* ff = (const uint8_t*)memchr(h + 1, 0xFF, avail - 1);
+            pos += ff ? ff - h : avail;
+        }
+        if (!len) continue;
+        uint32_t sample = t[i].sample;
+        if (i + 1 < m_tableCount && t[i + 1].pos > t[i].pos && pos > t[i].pos) {
+            uint32_t d = pos < t[i + 1].pos ? pos - t[i].pos : t[i + 1].pos - t[i].pos;
+            sample += (uint64_t)(t[i + 1].sample - t[i].sample) * d / (t[i + 1].pos - t[i].pos);
+        }
+        sample -= sample % spf;
+        uint32_t n = m_count.load(std::memory_order_relaxed);
+        if (n && m_points.get()[n - 1].sample >= sample) continue;
+        addPoint(sample, pos);
+        next = pos + POINT_SPACING;
+    }
+    m_total = m_param2;
+    return m_count.load() > 0 && m_total;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool SeekIndex::scanFlac(File& f) {
+    uint32_t pos = 0, next = 0, expect = 0; // expect: first sample of the next frame
+    uint32_t sample, bs, rate;
+    while (pos + 6 <= m_dataSize) {
+        uint32_t avail = window(f, pos);
+        if (avail < 6) return false;
+        const uint8_t* p = m_buf.get() + (pos - m_winStart);
+        if (!flacFrameHeader(p, avail, m_param1, &sample, &bs, &rate) || sample != expect) {
+            const uint8_t* ff = (const uint8_t*)memchr(p + 1, 0xFF, avail - 1);
+            pos += ff ? ff - p : avail;
+            continue;
+        }
+        if (pos >= next) {
+            addPoint(sample, pos);
+            next = pos + POINT_SPACING;
+        }
+        expect = sample + bs;
+        pos += m_param3 > 2 ? m_param3 : 2; // the next header is at least one frame behind
+    }
+    m_total = m_param2 ? m_param2 : expect;
+    return m_count.load() > 0;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool SeekIndex::scanM4a(File& f) {
+    uint32_t pos = 0, next = 0, frame = 0;
+    while (frame < m_param2) {
+        if (m_abort.load()) return false;
+        vTaskDelay(1);
+        uint32_t n = (m_param2 - frame) * 4;
+        if (n > SCAN_BUF_SIZE) n = SCAN_BUF_SIZE;
+        if (!f.seek(m_param1 + frame * 4) || f.read(m_buf.get(), n) != n) return false;
+        const uint8_t* p = m_buf.get();
+        for (uint32_t i = 0; i < n; i += 4, frame++) {
+            if (pos >= next) {
+                addPoint(frame * 1024, pos);
+                next = pos + POINT_SPACING;
+            }
+            pos += ((uint32_t)p[i] << 24) | ((uint32_t)p[i + 1] << 16) | ((uint32_t)p[i + 2] << 8) | p[i + 3];
+        }
+    }
+    m_total = frame * 1024;
+    return m_count.load() > 0;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::scanTask() {
+    uint32_t t = millis();
+    bool     ok = false;
+    File     f = m_fs->open(m_path.c_get());
+    if (f) {
+        if (m_kind == SIDX_MP3) ok = m_tableCount ? scanMp3Toc(f) : scanMp3(f);
+        if (m_kind == SIDX_FLAC) ok = scanFlac(f);
+        if (m_kind == SIDX_M4A) ok = scanM4a(f);
+        f.close();
+    }
+    m_buf.reset();
+    if (ok && !m_abort.load()) {
+        m_buildMs = millis() - t;
+        m_complete.store(true);
+        log_d("seek index: %lu points, %lu samples, %lu ms", (unsigned long)m_count.load(), (unsigned long)m_total, (unsigned long)m_buildMs);
+        saveCache();
+    }
+    xSemaphoreGive(m_done);
+    vTaskDelete(NULL);
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::cachePath(char* buf, size_t len) {
+    snprintf(buf, len, "%s/%08lx.idx", m_cacheDir.c_get(), (unsigned long)m_key);
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+bool SeekIndex::loadCache(kind_t kind, uint32_t dataStart, uint32_t dataSize) {
+    if (!m_cacheFs || !m_cacheDir.valid()) return false;
+    char path[64];
+    cachePath(path, sizeof(path));
+    if (!m_cacheFs->exists(path)) return false;
+    File        f = m_cacheFs->open(path, FILE_READ);
+    cache_hdr_t h;
+    bool        ok = f && f.read((uint8_t*)&h, sizeof(h)) == sizeof(h);
+    ok = ok && h.magic == CACHE_MAGIC && h.version == CACHE_VERSION && h.kind == kind && h.fileSize == m_fileSize && h.pathHash == m_pathHash;
+    ok = ok && h.dataStart == dataStart && h.dataSize == dataSize && h.count && h.count <= dataSize / POINT_SPACING + 2;
+    ok = ok && m_points.alloc_array(h.count, "seekPoints");
+    ok = ok && f.read((uint8_t*)m_points.get(), h.count * sizeof(point_t)) == h.count * sizeof(point_t);
+    if (f) f.close();
+    if (!ok) {
+        m_points.reset();
+        return false;
+    }
+    m_capacity = h.count;
+    m_total = h.total;
+    m_count.store(h.count);
+    m_complete.store(true);
+    m_fromCache = true;
+    return true;
+}
+// —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+void SeekIndex::saveCache() {
+    if (!m_cacheFs || !m_cacheDir.valid()) return;
+    const char* dir = m_cacheDir.c_get();
+    if (!m_cacheFs->exists(dir)) {
+        if (!m_cacheFs->mkdir(dir)) return;
+    } else { // full? remove the oldest index
+        File         d = m_cacheFs->open(dir);
+        uint16_t     files = 0;
+        time_t       oldest = 0;
+        ps_ptr<char> victim;
+        File         e = d.openNextFile();
+        while (e) {
+            files++;
+            if (!victim.valid() || e.getLastWrite() < oldest) {
+                oldest = e.getLastWrite();
+                victim.assign(e.path());
+            }
+            e.close();
+            e = d.openNextFile();
+        }
+        d.close();
+        if (files >= CACHE_MAX_FILES && victim.valid()) m_cacheFs->remove(victim.c_get());
+    }
+
+    char path[64];
+    cachePath(path, sizeof(path));
+    cache_hdr_t h = {};
+    h.magic = CACHE_MAGIC;
+    h.version = CACHE_VERSION;
+    h.kind = m_kind;
+    h.fileSize = m_fileSize;
+    h.pathHash = m_pathHash;
+    h.dataStart = m_dataStart;
+    h.dataSize = m_dataSize;
+    h.rate = m_rate;
+    h.total = m_total;
+    h.count = m_count.load();
+    File   f = m_cacheFs->open(path, FILE_WRITE);
+    size_t want = sizeof(h) + h.count * sizeof(point_t);
+    size_t n = 0;
+    if (f) {
+        n = f.write((const uint8_t*)&h, sizeof(h));
+        n += f.write((const uint8_t*)m_points.get(), h.count * sizeof(point_t));
+        f.close();
+    }
+    if (n != want) {
+        m_cacheFs->remove(path); // LittleFS full, don't leave half an index behind
+        log_w("seek index: cache not written");
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * seek_index.h
+ *
+ * per-track seek index for local MP3, FLAC and M4A files
+ * a point maps a sample number to the start of a frame (byte position relative to the first audio frame)
+ * points are about POINT_SPACING bytes apart, a seek lands on the point before the target and hops frame by frame
+ * inside the input buffer, so the result is the frame that contains the target sample
+ *
+ *   MP3   Xing/VBRI TOC, each entry synced to the frame at or behind it, a seek interpolates between two points and
+ *         syncs to the next frame; without a TOC a frame header scan of the whole file
+ *   FLAC  SEEKTABLE until the frame header scan is done, the scan jumps the STREAMINFO minimum frame size behind a header
+ *   M4A   sizes from the stsz table
+ *
+ * the scan runs in a low priority task with its own file handle, a finished index is cached (key: file system + path + file size)
+ *
+ */
+#pragma once
+
+#include "../psram_unique_ptr.hpp"
+#include <Arduino.h>
+#include <FS.h>
+#include <atomic>
+
+#define SEEK_INDEX_DIR "/seekidx" // cache directory of the finished indexes on LittleFS, one file per track, see setCache()
+
+class SeekIndex {
+
+  public:
+    enum kind_t : uint8_t { SIDX_NONE, SIDX_MP3, SIDX_FLAC, SIDX_M4A };
+    typedef struct {
+        uint32_t sample; // first sample of the frame
+        uint32_t pos;    // frame start, relative to the first audio frame
+    } point_t;
+    typedef struct {
+        uint32_t points;
+        uint32_t buildMs;  // scan time, 0 if loaded from the cache
+        bool     complete;
+        bool     fromCache;
+    } info_t;
+
+    static constexpr uint32_t POINT_SPACING = 16 * 1024;  // bytes, a point and its target frame always fit into the input buffer
+    static constexpr uint32_t SCAN_BUF_SIZE = 8 * 1024;   // read size of the scan task
+    static constexpr uint32_t SCAN_LOOKAHEAD = 2048;      // bytes kept in the window behind the scan position, > largest MP3 frame
+    static constexpr uint16_t MAX_TABLE_POINTS = 512;     // FLAC SEEKTABLE or MP3 TOC entries kept
+    static constexpr uint16_t CACHE_MAX_FILES = 64;       // cached indexes, one is removed when the directory is full
+    static constexpr uint16_t FLAC_MAX_HEADER = 16;       // FLAC frame header incl. CRC-8
+
+    SeekIndex() {}
+    ~SeekIndex() { close(); }
+    void     setCache(fs::FS& fs, const char* dir);
+    void     open(fs::FS& fs, const char* path, uint32_t fileSize); // new track
+    void     build(kind_t kind, uint32_t dataStart, uint32_t dataSize, uint32_t rate, uint32_t param1 = 0, uint32_t param2 = 0, uint32_t param3 = 0); // loads the cached index or starts the scan
+    void     addTablePoint(uint32_t sample, uint32_t pos);  // FLAC SEEKTABLE or MP3 Xing/VBRI TOC, before build()
+    void     close();                                       // stops the scan, frees the index
+    void     abort() { m_abort.store(true); }               // stops the scan without waiting for it, close() or open() collect the task
+    bool     lookup(uint32_t sample, point_t& p);           // last point at or before sample, false if that part is not indexed yet
+    bool     sampleAt(uint32_t pos, uint32_t& sample);      // sample at a byte position, interpolated between two points
+    bool     posAt(uint32_t sample, uint32_t& pos);         // byte position of a sample, interpolated between two points, not a frame start
+    bool     isSparse() { return m_kind == SIDX_MP3 && m_tableCount; } // MP3 TOC points, seek with posAt() and sync
+    bool     isComplete() { return m_complete.load(); }
+    kind_t   getKind() { return m_kind; }
+    uint32_t getRate() { return m_rate; }
+    uint32_t getTotalSamples() { return m_complete.load() ? m_total : 0; }
+    info_t   getInfo();
+
+    static int32_t mp3FrameLen(const uint8_t* h, uint32_t* samples, uint32_t* rate); // 0 = no layer III frame header
+    static int32_t flacFrameHeader(const uint8_t* p, size_t len, uint32_t fixedBlockSize, uint32_t* sample, uint32_t* blockSize, uint32_t* rate); // header length, 0 = none
+
+  private:
+    static void taskWrapper(void* param) { static_cast<SeekIndex*>(param)->scanTask(); }
+    void        scanTask();
+    bool        scanMp3(File& f);
+    bool        scanMp3Toc(File& f);
+    bool        scanFlac(File& f);
+    bool        scanM4a(File& f);
+    uint32_t    window(File& f, uint32_t pos);
+    void        addPoint(uint32_t sample, uint32_t pos);
+    bool        loadCache(kind_t kind, uint32_t dataStart, uint32_t dataSize);
+    void        saveCache();
+    void        cachePath(char* buf, size_t len);
+
+    fs::FS*           m_fs = nullptr;
+    ps_ptr<char>      m_path;
+    uint32_t          m_fileSize = 0;
+    uint32_t          m_pathHash = 0;
+    uint32_t          m_key = 0;         // cache file name, hash of file system, path and size
+    fs::FS*           m_cacheFs = nullptr;
+    ps_ptr<char>      m_cacheDir;
+
+    kind_t            m_kind = SIDX_NONE;
+    uint32_t          m_dataStart = 0;
+    uint32_t          m_dataSize = 0;
+    uint32_t          m_rate = 0;
+    uint32_t          m_param1 = 0;      // M4A: stsz table position, FLAC: fixed block size
+    uint32_t          m_param2 = 0;      // M4A: number of frames, FLAC: total samples (STREAMINFO), MP3: total samples (Xing/VBRI)
+    uint32_t          m_param3 = 0;      // FLAC: minimum frame size (STREAMINFO), 0 = unknown
+    uint32_t          m_total = 0;       // samples in the file, valid when complete
+
+    ps_ptr<point_t>   m_points;          // scanned points, appended by the scan task only
+    uint32_t          m_capacity = 0;
+    std::atomic<uint32_t> m_count{0};    // published after the point is written
+    ps_ptr<point_t>   m_table;           // FLAC SEEKTABLE, MP3 TOC
+    uint16_t          m_tableCount = 0;
+
+    ps_ptr<uint8_t>   m_buf;             // scan window
+    uint32_t          m_winStart = 0;
+    uint32_t          m_winLen = 0;
+
+    TaskHandle_t      m_task = nullptr;
+    SemaphoreHandle_t m_done = nullptr;  // given by the scan task when it ends
+    std::atomic<bool> m_abort{false};
+    std::atomic<bool> m_complete{false};
+    bool              m_fromCache = false;
+    uint32_t          m_buildMs = 0;
+};
@@ -1657,11 +1657,9 @@ ps_ptr<VorbisDecoder::vorbis_dsp_state> VorbisDecoder::vorbis_dsp_create() {
     v->mdctright.calloc_array(m_vorbisChannels);
 
     for (uint8_t i = 0; i < m_vorbisChannels; ++i) {
-        const size_t work_size = (m_blocksizes[1] >> 1) * sizeof(int32_t);
-        v->work.at(i).calloc(work_size);
+        v->work.at(i).calloc(m_blocksizes[1] >> 1, "dsp_work"); // elements
 
-        const size_t mdct_size = (m_blocksizes[1] >> 2) * sizeof(int32_t);
-        v->mdctright.at(i).calloc(mdct_size);
+        v->mdctright.at(i).calloc(m_blocksizes[1] >> 2, "dsp_mdctright");
     }
 
     // Initialize state
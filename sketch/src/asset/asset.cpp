@@ -0,0 +1,257 @@
+//=================== Image Assets ===========================
+#include "asset.h"
+#include "user_config.h"
+#include <esp_heap_caps.h>
+
+#define ASSET_CACHE_BYTES ((uint32_t)WAVESHARE_349_ASSET_CACHE_KB * 1024)
+
+typedef struct {
+  fs::FS *fs; // NULL = free slot
+  char path[ASSET_PATH_LEN];
+  lv_img_dsc_t dsc;
+  uint8_t *buf; // PSRAM, dsc.data points here
+  uint32_t bufSize;
+  uint32_t lastUse;
+  uint8_t refs; // pinned while > 0
+} AssetEntry;
+
+static AssetEntry cache[WAVESHARE_349_ASSET_CACHE_SLOTS];
+static uint32_t useCounter = 0;
+static AssetStats stats = {};
+static SemaphoreHandle_t assetLock = xSemaphoreCreateMutex(); // weather task and LVGL task both load icons
+
+//------------------------------------------------
+// LZ4 block decoder. The payload is read into the tail of the output buffer and decoded in place,
+// so one PSRAM allocation holds both (margin as LZ4_DECOMPRESS_INPLACE_MARGIN)
+static bool lz4Decode(const uint8_t *src, uint32_t srcLen, uint8_t *dst, uint32_t dstLen) {
+  const uint8_t *ip = src;
+  const uint8_t *iend = src + srcLen;
+  uint8_t *op = dst;
+  uint8_t *oend = dst + dstLen;
+
+  while (ip < iend) {
+    uint8_t token = *ip++;
+    uint32_t len = token >> 4;
+    if (len == 15) {
+      uint8_t b;
+      do {
+        if (ip >= iend) return false;
+        b = *ip++;
+        len += b;
+      } while (b == 255);
+    }
+    if (len > (uint32_t)(iend - ip) || len > (uint32_t)(oend - op)) return false;
+    memmove(op, ip, len); // literals, src and dst may overlap
+    op += len;
+    ip += len;
+    if (ip >= iend) break; // the last sequence has no match
+
+    if (iend - ip < 2) return false;
+    uint32_t offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    if (offset == 0 || offset > (uint32_t)(op - dst)) return false;
+    len = (token & 15) + 4;
+    if (len == 19) {
+      uint8_t b;
+      do {
+        if (ip >= iend) return false;
+        b = *ip++;
+        len += b;
+      } while (b == 255);
+    }
+    if (len > (uint32_t)(oend - op) || op + len > ip) return false; // corrupt file would overwrite unread input
+    const uint8_t *match = op - offset;
+    if (offset >= len) {
+      memcpy(op, match, len);
+      op += len;
+    } else {
+      while (len--) *op++ = *match++; // overlapping copy repeats the pattern
+    }
+  }
+  return op == oend;
+}
+
+//------------------------------------------------
+static void freeEntry(AssetEntry *e) {
+  lv_img_cache_invalidate_src(&e->dsc); // the descriptor address is reused by the next image
+  heap_caps_free(e->buf);
+  stats.bytes -= e->bufSize;
+  stats.entries--;
+  memset(e, 0, sizeof(AssetEntry));
+}
+
+// least recently used entry that is not on screen
+static AssetEntry *lruEntry() {
+  AssetEntry *lru = NULL;
+  for (int i = 0; i < WAVESHARE_349_ASSET_CACHE_SLOTS; i++) {
+    AssetEntry *e = &cache[i];
+    if (e->fs && e->refs == 0 && (!lru || e->lastUse < lru->lastUse)) lru = e;
+  }
+  return lru;
+}
+
+// evict until 'size' fits the budget and a slot is free, pinned images are never evicted
+static AssetEntry *makeRoom(uint32_t size) {
+  AssetEntry *lru;
+  while (stats.bytes + size > ASSET_CACHE_BYTES && (lru = lruEntry())) {
+    log_d("asset: evict %s (%u bytes)", lru->path, lru->bufSize);
+    freeEntry(lru);
+    stats.evictions++;
+  }
+  if (stats.bytes + size > ASSET_CACHE_BYTES)
+    log_w("asset: cache over budget, %u bytes pinned", stats.bytes);
+  for (int i = 0; i < WAVESHARE_349_ASSET_CACHE_SLOTS; i++)
+    if (!cache[i].fs) return &cache[i];
+  if ((lru = lruEntry())) {
+    freeEntry(lru);
+    stats.evictions++;
+    return lru;
+  }
+  return NULL;
+}
+
+//------------------------------------------------
+static AssetEntry *loadEntry(fs::FS &fs, const char *path) {
+  File f = fs.open(path, "r");
+  if (!f) {
+    log_w("asset: %s not found", path);
+    return NULL;
+  }
+  AssetHeader hdr;
+  if (f.read((uint8_t *)&hdr, sizeof(hdr)) != sizeof(hdr) || hdr.magic != ASSET_MAGIC || hdr.version != ASSET_VERSION ||
+      hdr.dataSize != f.size() - sizeof(hdr) || hdr.compression > ASSET_COMP_LZ4 ||
+      hdr.rawSize != lv_img_buf_get_img_size(hdr.w, hdr.h, (lv_img_cf_t)hdr.cf)) {
+    log_w("asset: %s is not a valid image asset", path);
+    f.close();
+    return NULL;
+  }
+  uint32_t size = hdr.rawSize;
+  if (hdr.compression == ASSET_COMP_LZ4)
+    size = max(hdr.rawSize, hdr.dataSize) + (hdr.dataSize >> 8) + 32;
+
+  AssetEntry *slot = makeRoom(size);
+  uint8_t *buf = slot ? (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM) : NULL;
+  if (!buf) {
+    log_e("asset: no room for %s (%u bytes)", path, size);
+    f.close();
+    return NULL;
+  }
+  uint8_t *payload = buf + size - hdr.dataSize;
+  bool ok = f.read(payload, hdr.dataSize) == hdr.dataSize;
+  f.close();
+  if (ok && hdr.compression == ASSET_COMP_LZ4)
+    ok = lz4Decode(payload, hdr.dataSize, buf, hdr.rawSize);
+  if (!ok) {
+    log_w("asset: %s is truncated or corrupt", path);
+    heap_caps_free(buf);
+    return NULL;
+  }
+
+  memset(slot, 0, sizeof(AssetEntry));
+  slot->fs = &fs;
+  strlcpy(slot->path, path, sizeof(slot->path));
+  slot->dsc.header.always_zero = 0;
+  slot->dsc.header.w = hdr.w;
+  slot->dsc.header.h = hdr.h;
+  slot->dsc.header.cf = hdr.cf;
+  slot->dsc.data_size = hdr.rawSize;
+  slot->dsc.data = buf;
+  slot->buf = buf;
+  slot->bufSize = size;
+  stats.bytes += size;
+  stats.entries++;
+  return slot;
+}
+
+//------------------------------------------------
+// get a decoded image, the caller owns one reference until assetRelease()
+const lv_img_dsc_t *assetAcquire(fs::FS &fs, const char *path) {
+  if (!path || strlen(path) >= ASSET_PATH_LEN) return NULL;
+  xSemaphoreTake(assetLock, portMAX_DELAY);
+  for (int i = 0; i < WAVESHARE_349_ASSET_CACHE_SLOTS; i++) {
+    AssetEntry *e = &cache[i];
+    if (e->fs == &fs && strcmp(e->path, path) == 0) {
+      e->refs++;
+      e->lastUse = ++useCounter;
+      stats.hits++;
+      xSemaphoreGive(assetLock);
+      return &e->dsc;
+    }
+  }
+
+  stats.misses++;
+  uint32_t start = millis();
+  AssetEntry *e = loadEntry(fs, path);
+  if (e) {
+    stats.lastLoadMs = millis() - start;
+    e->refs = 1;
+    e->lastUse = ++useCounter;
+    log_d("asset: %s %ux%u, %u bytes in %u ms", path, e->dsc.header.w, e->dsc.header.h, e->dsc.data_size, stats.lastLoadMs);
+  } else {
+    stats.failures++;
+  }
+  xSemaphoreGive(assetLock);
+  return e ? &e->dsc : NULL;
+}
+
+void assetRelease(const lv_img_dsc_t *img) {
+  if (!img) return;
+  xSemaphoreTake(assetLock, portMAX_DELAY);
+  for (int i = 0; i < WAVESHARE_349_ASSET_CACHE_SLOTS; i++) {
+    if (&cache[i].dsc == img && cache[i].refs) {
+      cache[i].refs--;
+      break;
+    }
+  }
+  xSemaphoreGive(assetLock);
+}
+
+AssetStats assetGetStats() {
+  xSemaphoreTake(assetLock, portMAX_DELAY);
+  AssetStats s = stats;
+  s.pinned = 0;
+  for (int i = 0; i < WAVESHARE_349_ASSET_CACHE_SLOTS; i++)
+    if (cache[i].refs) s.pinned++;
+  xSemaphoreGive(assetLock);
+  return s;
+}
+
+//------------------------------------------------
+// atlas = same size tiles stacked top to bottom, so a tile is a contiguous run of rows
+// and its descriptor only points into the atlas data. The atlas must stay acquired.
+bool assetTile(const lv_img_dsc_t *atlas, uint16_t tileH, uint16_t index, lv_img_dsc_t *tile) {
+  if (!atlas || !tileH || (uint32_t)(index + 1) * tileH > atlas->header.h) return false;
+  lv_img_cf_t cf = (lv_img_cf_t)atlas->header.cf;
+  *tile = *atlas;
+  tile->header.h = tileH;
+  tile->data_size = lv_img_buf_get_img_size(atlas->header.w, tileH, cf);
+  tile->data = atlas->data + lv_img_buf_get_img_size(atlas->header.w, (lv_coord_t)index * tileH, cf);
+  return true;
+}
+
+//------------------------------------------------
+static int compareName(const void *a, const void *b) {
+  return strcmp((const char *)a, (const char *)b);
+}
+
+// names of the .tbi files in 'dir', sorted so the order does not depend on the file system
+int assetList(fs::FS &fs, const char *dir, char (*names)[ASSET_NAME_LEN], int maxNames) {
+  File d = fs.open(dir);
+  if (!d || !d.isDirectory()) return 0;
+  int count = 0;
+  File f;
+  while (count < maxNames && (f = d.openNextFile())) {
+    const char *name = f.name();
+    size_t len = strlen(name);
+    size_t extLen = strlen(ASSET_EXT);
+    if (!f.isDirectory() && len > extLen && len - extLen < ASSET_NAME_LEN && strcasecmp(name + len - extLen, ASSET_EXT) == 0) {
+      memcpy(names[count], name, len - extLen);
+      names[count][len - extLen] = '\0';
+      count++;
+    }
+    f.close();
+  }
+  d.close();
+  qsort(names, count, ASSET_NAME_LEN, compareName);
+  return count;
+}
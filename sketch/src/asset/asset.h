@@ -0,0 +1,48 @@
+//=================== Image Assets ===========================
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <lvgl.h>
+
+// image asset file (.tbi), written by tools/img2tbi.py
+#define ASSET_MAGIC 0x4D494254 // "TBIM"
+#define ASSET_VERSION 1
+#define ASSET_COMP_RAW 0
+#define ASSET_COMP_LZ4 1 // LZ4 block format
+#define ASSET_EXT ".tbi"
+#define ASSET_PATH_LEN 48
+#define ASSET_NAME_LEN 24
+
+#define WALLPAPER_DIR "/wallpapers" // built-in on LittleFS, custom on SD card
+#define ATLAS_DIR "/atlas" // packed icon sheets on LittleFS
+
+// file layout: header, then 'dataSize' bytes of payload
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t cf; // lv_img_cf_t
+  uint8_t compression; // ASSET_COMP_*
+  uint16_t w;
+  uint16_t h;
+  uint32_t rawSize; // decoded bytes (lv_img_dsc_t.data_size)
+  uint32_t dataSize; // payload bytes in the file
+} AssetHeader;
+
+typedef struct {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+  uint32_t failures;
+  uint32_t lastLoadMs; // read + decode time of the last miss
+  uint32_t bytes; // decoded bytes held in PSRAM
+  uint8_t entries;
+  uint8_t pinned;
+} AssetStats;
+
+// decoded images live in a PSRAM LRU cache keyed by fs + path, safe to call from any task
+const lv_img_dsc_t *assetAcquire(fs::FS &fs, const char *path); // load or reuse, pinned until released
+void assetRelease(const lv_img_dsc_t *img); // unpin, the image stays cached until evicted
+AssetStats assetGetStats();
+bool assetTile(const lv_img_dsc_t *atlas, uint16_t tileH, uint16_t index, lv_img_dsc_t *tile); // view of one tile, no copy
+int assetList(fs::FS &fs, const char *dir, char (*names)[ASSET_NAME_LEN], int maxNames); // sorted .tbi names without extension
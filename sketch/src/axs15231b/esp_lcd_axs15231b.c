@@ -56,6 +56,8 @@ typedef struct {
     uint8_t fb_bits_per_pixel;
     uint8_t madctl_val; // save current value of LCD_CMD_MADCTL register
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
+    int caset_start;    // column window of the last LCD_CMD_CASET, -1 = unknown
+    int caset_end;
     const axs15231b_lcd_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
     struct {
@@ -110,6 +112,8 @@ esp_err_t esp_lcd_new_panel_axs15231b(const esp_lcd_panel_io_handle_t io, const
 
     axs15231b->io = io;
     axs15231b->fb_bits_per_pixel = fb_bits_per_pixel;
+    axs15231b->caset_start = -1;
+    axs15231b->caset_end = -1;
     axs15231b->reset_gpio_num = panel_dev_config->reset_gpio_num;
     axs15231b->flags.reset_level = panel_dev_config->flags.reset_active_high;
     if (panel_dev_config->vendor_config) {
@@ -296,12 +300,17 @@ static esp_err_t panel_axs15231b_draw_bitmap(esp_lcd_panel_t *panel, int x_start
     y_end += axs15231b->y_gap;
 
     // define an area of frame memory where MCU can access
-    tx_param(axs15231b, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4);
+    // RAMWRC continues in the same columns, skip the extra command transfer between strips
+    if (y_start == 0 || x_start != axs15231b->caset_start || x_end != axs15231b->caset_end) {
+        tx_param(axs15231b, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4);
+        axs15231b->caset_start = x_start;
+        axs15231b->caset_end = x_end;
+    }
 
     if (0 == axs15231b->flags.use_qspi_interface) {
         tx_param(axs15231b, io, LCD_CMD_RASET, (uint8_t[]) {
@@ -18,8 +18,6 @@ uint8_t playMode = 0; // 0 = normal, 1 = random , 2 = repeat
 
 static TaskHandle_t scanMusicTask = NULL;
 
-#define PATH_BUF_LEN 512
-
 //------------ LVGL 8.x LittleFS callbacks  -------------------------
 
 void *fs_open(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode) {
@@ -114,192 +112,10 @@ void initSDCard() {
   }
 }
 
-// ==========================================
-// Global Variables for Music List
-// ==========================================
-// std::vector acts like a growable array.
-// It will store the full path strings to your songs.
-static bool endsWithIgnoreCase(const char *str, const char *suffix) {
-  size_t len1 = strlen(str);
-  size_t len2 = strlen(suffix);
-  if (len2 > len1) return false;
-
-  str += len1 - len2;
-  while (*suffix) {
-    if (tolower((unsigned char)*str++) != tolower((unsigned char)*suffix++)) return false;
-  }
-  return true;
-}
-
-static bool isAudioFile(const char *name) {
-    const char *ext = strrchr(name, '.');
-    if (!ext) return false;
-
-    return strcasecmp(ext, ".mp3") == 0 ||
-           strcasecmp(ext, ".wav") == 0 ||
-           strcasecmp(ext, ".aac") == 0 ||
-           strcasecmp(ext, ".flac") == 0;
-}
-
-
-// ==========================================
-// NEW: Recursive Directory Scanner that SAVES TO FILE
-// ==========================================
-static void scanDirRecursive(
-    fs::FS &fs,
-    const char *currentDir,
-    uint8_t level,
-    File &playlist,
-    char *pathBuf,
-    size_t pathBufLen
-) {
-    File dir = fs.open(currentDir);
-    if (!dir || !dir.isDirectory()) {
-        dir.close();
-        return;
-    }
-
-    while (true) {
-        File entry = dir.openNextFile();
-        if (!entry) break;
-
-        const char *entryPath = entry.name();  // FULL path on SD
-        const char *base = strrchr(entryPath, '/');
-        base = base ? base + 1 : entryPath;    // basename ONLY
-
-        // Build full child path into pathBuf
-        if (strcmp(currentDir, "/") == 0) {
-            snprintf(pathBuf, pathBufLen, "/%s", base);
-        } else {
-            snprintf(pathBuf, pathBufLen, "%s/%s", currentDir, base);
-        }
-
-        if (entry.isDirectory()) {
-
-            if (base[0] != '.' && level > 0) {
-                char childDir[PATH_BUF_LEN];
-                strncpy(childDir, pathBuf, sizeof(childDir));
-                childDir[sizeof(childDir) - 1] = '\0';
-
-                scanDirRecursive(
-                    fs,
-                    childDir,          // ✅ stable copy
-                    level - 1,
-                    playlist,
-                    pathBuf,
-                    pathBufLen
-                );
-            }
-
-        } else {
-
-            if (isAudioFile(base)) {
-                playlist.println(pathBuf);
-                log_d("-> %s", pathBuf);
-            }
-        }
-
-        entry.close();
-        vTaskDelay(1);
-    }
-
-    dir.close();
-}
-
-
-
-
-//create music_playlist.txt
-void generatePlaylistFile(fs::FS &sourceFs, const char *dirname, uint8_t levels) {
-
-    LittleFS.remove(PLAYLIST_FILE);
-    File playlist = LittleFS.open(PLAYLIST_FILE, FILE_WRITE);
-
-  
-    if (!playlist) {
-        log_e("Failed to open playlist file for writing!");
-        return;
-    }
-
-    char *pathBuf = (char *)heap_caps_malloc(PATH_BUF_LEN, MALLOC_CAP_SPIRAM);
-    if (!pathBuf) {
-        log_e("Failed to allocate path buffer");
-        playlist.close();
-        return;
-    }
-
-    log_d("Scanning directory: %s", dirname);
-scanDirRecursive(
-    sourceFs,
-    dirname,      // "/" typically
-    levels,
-    playlist,
-    pathBuf,
-    PATH_BUF_LEN
-);
-
-
-    heap_caps_free(pathBuf);
-    playlist.close();
-    log_d("Playlist file %s generation complete.", PLAYLIST_FILE);
-}
-
-
-// ==========================================
-// NEW: Low-RAM function to count lines (tracks)
-// ==========================================
-int getTrackCount() {
-  File playlist = LittleFS.open(PLAYLIST_FILE, FILE_READ);
-  if (!playlist) {
-    log_w("Failed to open playlist file: %s",PLAYLIST_FILE);
-    return 0;
-  }
-
-  int count = 0;
-  while (playlist.available()) {
-    playlist.readStringUntil('\n'); // Read line without storing it (low RAM)
-    count++;
-  }
-  playlist.close();
-  return count;
-}
-
-// ==========================================
-// NEW: Low-RAM function to read a track path by index (line number)
-// ==========================================
-bool getTrackPath(int index, char *outBuf, size_t outBufSize) {
-  if (!outBuf || outBufSize == 0) return false;
-
-  File playlist = LittleFS.open(PLAYLIST_FILE, FILE_READ);
-  if (!playlist) {
-    log_w("Failed to open playlist file.");
-    outBuf[0] = '\0';
-    return false;
-  }
-
-  int lineCount = 0;
-  size_t len = 0;
-
-  while (playlist.available()) {
-    len = playlist.readBytesUntil('\n', outBuf, outBufSize - 1);
-    outBuf[len] = '\0';
-
-    // Strip trailing CR (\r)
-    if (len > 0 && outBuf[len - 1] == '\r') {
-      outBuf[len - 1] = '\0';
-    }
-
-    if (lineCount == index) {
-      playlist.close();
-      return true;
-    }
-
-    lineCount++;
-  }
-
-  playlist.close();
-  outBuf[0] = '\0';
-  return false; // index not found
+static void scanProgress(uint32_t dirs, uint32_t tracks) {
+  char buffer[100];
+  snprintf(buffer, sizeof(buffer), "Indexing... %u folders, %u songs", dirs, tracks);
+  updateSDCARDStatus(buffer, 0x00FF00);
 }
 
 // The dedicated SD Scan Task
@@ -315,7 +131,7 @@ void scan_music_task(void *pvParameters) {
 
     log_d("Indexing music library, please wait...");
     updateSDCARDStatus("Indexing music library, please wait...", 0x00FF00);
-    generatePlaylistFile(SD, "/", 5); // 2. Perform the blocking work: Scan and WRITE to LittleFS
+    generatePlaylistFile(SD, "/", 5, scanProgress); // 2. Perform the blocking work: Scan and WRITE to LittleFS
     trackListLength = getTrackCount(); // 3. Update the global track count by counting lines in the new file
     char buffer[100];
     snprintf(buffer, sizeof(buffer), LV_SYMBOL_AUDIO " Found %d songs.", trackListLength);
@@ -419,20 +235,24 @@ bool initStationsPSRAM() {
 
 // load station list from littleFS or default
 void loadStationList() {
+  static UIBatch batch; // the list text goes to the LVGL task in as few batches as fit
+  ui_batch_begin(batch, 100);
 
   // ---------- ENSURE PSRAM ----------
   if (!initStationsPSRAM()) {
-    lv_textarea_add_text(ui_MainMenu_Textarea_stationList,
-                         LV_SYMBOL_CLOSE " PSRAM allocation failed\n");
+    ui_batch_textarea(batch, ui_MainMenu_Textarea_stationList,
+                      LV_SYMBOL_CLOSE " PSRAM allocation failed\n", true);
+    ui_batch_commit(batch);
     return;
   }
 
   stationListLength = 0;
-  lv_textarea_set_text(ui_MainMenu_Textarea_stationList, "");
+  ui_batch_textarea(batch, ui_MainMenu_Textarea_stationList, "", false);
 
   char *lineBuf = (char *)heap_caps_malloc(LINE_BUF_LEN, MALLOC_CAP_SPIRAM);
   if (!lineBuf) {
     log_e("Failed to allocate lineBuf in PSRAM");
+    ui_batch_commit(batch);
     return;
   }
 
@@ -443,9 +263,9 @@ void loadStationList() {
   // =====================================================
   if (!LittleFS.exists(STATION_LIST_FILENAME)) {
 
-    lv_textarea_add_text(
+    ui_batch_textarea(batch,
       ui_MainMenu_Textarea_stationList,
-      LV_SYMBOL_FILE " Load DEFAULT " MACRO_TO_STRING(STATION_LIST_FILENAME) "\n"
+      LV_SYMBOL_FILE " Load DEFAULT " MACRO_TO_STRING(STATION_LIST_FILENAME) "\n", true
     );
 
     log_d("Load DEFAULT %s", STATION_LIST_FILENAME);
@@ -492,19 +312,20 @@ void loadStationList() {
   // =====================================================
   else {
 
-    lv_textarea_add_text(
+    ui_batch_textarea(batch,
       ui_MainMenu_Textarea_stationList,
-      LV_SYMBOL_FILE " Load USER " MACRO_TO_STRING(STATION_LIST_FILENAME) "\n"
+      LV_SYMBOL_FILE " Load USER " MACRO_TO_STRING(STATION_LIST_FILENAME) "\n", true
     );
 
     log_d("Load USER %s", STATION_LIST_FILENAME);
 
     File f = LittleFS.open(STATION_LIST_FILENAME, "r");
     if (!f) {
-      lv_textarea_add_text(
+      ui_batch_textarea(batch,
         ui_MainMenu_Textarea_stationList,
-        LV_SYMBOL_CLOSE " Cannot open " MACRO_TO_STRING(STATION_LIST_FILENAME) "\n"
+        LV_SYMBOL_CLOSE " Cannot open " MACRO_TO_STRING(STATION_LIST_FILENAME) "\n", true
       );
+      ui_batch_commit(batch);
       heap_caps_free(lineBuf);
       return;
     }
@@ -537,11 +358,12 @@ void loadStationList() {
   char txt[96];
   for (uint8_t i = 0; i < stationListLength; i++) {
     snprintf(txt, sizeof(txt), "%d: %s\n", i + 1, stations[i].name);
-    lv_textarea_add_text(ui_MainMenu_Textarea_stationList, txt);
+    ui_batch_textarea(batch, ui_MainMenu_Textarea_stationList, txt, true);
   }
 
   snprintf(txt, sizeof(txt), "Total %d stations", stationListLength);
-  lv_textarea_add_text(ui_MainMenu_Textarea_stationList, txt);
+  ui_batch_textarea(batch, ui_MainMenu_Textarea_stationList, txt, true);
+  ui_batch_commit(batch);
   log_d("%s", txt);
 }
 
@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include <lvgl.h> 
+#include "playlist.h" // playlist index, track lookup, SD scan
   // SD CARD
 #define SD_CS 38
 #define SPI_MOSI 39
@@ -17,8 +18,6 @@ extern uint16_t trackIndex;// current track index
 extern int trackListLength;// all track count
 extern uint8_t mediaType;// 0: livestream, 1: music player, 2: chatbot, 3: config
 
-#define PLAYLIST_FILE "/music_playlist.txt"
-
 
 //lvgl littleFS driver
 void* fs_open(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode);
@@ -29,7 +28,7 @@ lv_fs_res_t fs_seek(lv_fs_drv_t *drv, void *file_p, uint32_t pos);
 
 void initLittleFS();
 void initSDCard();
-bool getTrackPath(int index, char *outBuf, size_t outBufSize);
+
 void scanMusic();
 void initSongList();
 
@@ -0,0 +1,530 @@
+//=================== Music playlist ===========================
+#include "playlist.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <vector>
+
+#define PATH_BUF_LEN 512
+#define SCAN_COPY_BUF_LEN 4096 // block size when unchanged tracks are copied from the previous playlist
+
+static bool endsWithIgnoreCase(const char *str, const char *suffix) {
+  size_t len1 = strlen(str);
+  size_t len2 = strlen(suffix);
+  if (len2 > len1) return false;
+
+  str += len1 - len2;
+  while (*suffix) {
+    if (tolower((unsigned char)*str++) != tolower((unsigned char)*suffix++)) return false;
+  }
+  return true;
+}
+
+static bool isAudioFile(const char *name) {
+    const char *ext = strrchr(name, '.');
+    if (!ext) return false;
+
+    return strcasecmp(ext, ".mp3") == 0 ||
+           strcasecmp(ext, ".wav") == 0 ||
+           strcasecmp(ext, ".aac") == 0 ||
+           strcasecmp(ext, ".flac") == 0;
+}
+
+
+// append one path to the playlist text and its offset entry to the index
+static void writePlaylistEntry(File &playlist, File &index, const char *path) {
+    PlaylistIndexEntry entry = {};
+    entry.offset = playlist.position();
+    entry.length = (uint16_t)strnlen(path, PATH_BUF_LEN - 1);
+    playlist.println(path);
+    index.write((const uint8_t *)&entry, sizeof(entry));
+}
+
+static uint32_t s_indexGeneration = 0; // of the index getTrackCount() last returned, 0: none yet
+
+// write (or rewrite) the index header at the start of the index file
+static void writePlaylistIndexHeader(File &index, uint32_t count, uint32_t blobSize, uint32_t generation) {
+    PlaylistIndexHeader header = {
+        .magic = PLAYLIST_INDEX_MAGIC,
+        .version = PLAYLIST_INDEX_VERSION,
+        .entrySize = sizeof(PlaylistIndexEntry),
+        .count = count,
+        .blobSize = blobSize,
+        .generation = generation,
+    };
+    index.seek(0, SeekSet);
+    index.write((const uint8_t *)&header, sizeof(header));
+}
+
+// read and validate the index header against the current playlist file
+static bool readPlaylistIndexHeader(File &index, PlaylistIndexHeader &header) {
+  if (index.read((uint8_t *)&header, sizeof(header)) != sizeof(header)) return false;
+  if (header.magic != PLAYLIST_INDEX_MAGIC || header.version != PLAYLIST_INDEX_VERSION || header.entrySize != sizeof(PlaylistIndexEntry)) return false;
+  if (index.size() < sizeof(header) + (size_t)header.count * sizeof(PlaylistIndexEntry)) return false;
+  return true;
+}
+
+// generation for the next index: one past the current index file's, any index of an older version counts as 0
+static uint32_t nextIndexGeneration() {
+  PlaylistIndexHeader header;
+  File index = LittleFS.open(PLAYLIST_INDEX_FILE, FILE_READ);
+  uint32_t generation = index && readPlaylistIndexHeader(index, header) ? header.generation : 0;
+  index.close();
+  return max(generation, s_indexGeneration) + 1;
+}
+
+// ==========================================
+// Scan manifest: one record per visited directory, in scan order.
+// A directory whose audio files and sub directories have the same names as
+// in its record reuses the tracks it contributed to the previous playlist.
+// Every directory is still listed once, FAT changes nothing above a folder
+// when a file is added inside it. Listing is one readdir() pass, no entry is
+// opened; the reused tracks of consecutive unchanged directories form one
+// range of the previous playlist and are copied as a block.
+// ==========================================
+struct ScanContext {
+    fs::FS *fs;
+    File playlist; // new playlist text
+    File index; // new playlist index
+    File manifest; // new scan manifest
+    File oldPlaylist; // previous scan, may be invalid
+    File oldIndex;
+    uint32_t oldCount;
+    uint32_t oldBlobSize;
+    uint8_t *oldManifest; // previous manifest loaded into PSRAM, may be NULL
+    size_t oldManifestLen;
+    size_t cursor; // offset of the next expected record in oldManifest
+    uint32_t copyFirst; // pending range of previous tracks, written by flushCopy()
+    uint32_t copyCount;
+    uint8_t *copyBuf; // SCAN_COPY_BUF_LEN
+    uint32_t count; // tracks written or pending
+    uint32_t dirs; // directories visited
+    uint32_t reusedDirs; // directories reused from the manifest
+    bool failed; // a copy from the previous playlist came back short
+    char *pathBuf;
+    ScanProgressCb progress;
+};
+
+// load the previous manifest, only if the previous playlist + index are usable
+static void loadScanManifest(ScanContext &ctx) {
+    ctx.oldManifest = NULL;
+    ctx.oldManifestLen = 0;
+    ctx.cursor = sizeof(ScanManifestHeader);
+    ctx.oldCount = 0;
+
+    ctx.oldIndex = LittleFS.open(PLAYLIST_INDEX_FILE, FILE_READ);
+    ctx.oldPlaylist = LittleFS.open(PLAYLIST_FILE, FILE_READ);
+    PlaylistIndexHeader indexHeader;
+    if (!ctx.oldIndex || !ctx.oldPlaylist || !readPlaylistIndexHeader(ctx.oldIndex, indexHeader) || indexHeader.blobSize != ctx.oldPlaylist.size()) return;
+    ctx.oldCount = indexHeader.count;
+    ctx.oldBlobSize = indexHeader.blobSize;
+
+    File f = LittleFS.open(SCAN_MANIFEST_FILE, FILE_READ);
+    if (!f) return;
+    size_t len = f.size();
+    uint8_t *buf = len > sizeof(ScanManifestHeader) ? (uint8_t *)heap_caps_malloc(len, MALLOC_CAP_SPIRAM) : NULL;
+    if (buf && f.read(buf, len) == len) {
+        const ScanManifestHeader *header = (const ScanManifestHeader *)buf;
+        if (header->magic == SCAN_MANIFEST_MAGIC && header->version == SCAN_MANIFEST_VERSION && header->trackCount == ctx.oldCount) {
+            ctx.oldManifest = buf;
+            ctx.oldManifestLen = len;
+            buf = NULL;
+        }
+    }
+    if (buf) heap_caps_free(buf);
+    f.close();
+}
+
+// step through manifest records: returns record at 'offset' and moves offset to the next one
+static const ScanManifestDir *nextManifestDir(const ScanContext &ctx, size_t &offset, const char **path) {
+    if (offset + sizeof(ScanManifestDir) > ctx.oldManifestLen) return NULL;
+    const ScanManifestDir *rec = (const ScanManifestDir *)(ctx.oldManifest + offset);
+    size_t next = offset + sizeof(ScanManifestDir) + rec->pathLen + 1;
+    if (next > ctx.oldManifestLen) return NULL;
+    *path = (const char *)(rec + 1);
+    offset = next;
+    return rec;
+}
+
+// directories are visited in the same order as last time, so try the cursor first
+static const ScanManifestDir *findManifestDir(ScanContext &ctx, const char *dirPath) {
+    if (!ctx.oldManifest) return NULL;
+    const char *path;
+    size_t offset = ctx.cursor;
+    const ScanManifestDir *rec = nextManifestDir(ctx, offset, &path);
+    if (rec && strcmp(path, dirPath) == 0) {
+        ctx.cursor = offset;
+        return rec;
+    }
+    offset = sizeof(ScanManifestHeader);
+    while ((rec = nextManifestDir(ctx, offset, &path)) != NULL) {
+        if (strcmp(path, dirPath) == 0) {
+            ctx.cursor = offset;
+            return rec;
+        }
+    }
+    return NULL;
+}
+
+static void writeManifestDir(ScanContext &ctx, ScanManifestDir &rec, const char *dirPath) {
+    rec.pathLen = (uint16_t)strnlen(dirPath, PATH_BUF_LEN - 1);
+    ctx.manifest.write((const uint8_t *)&rec, sizeof(rec));
+    ctx.manifest.write((const uint8_t *)dirPath, rec.pathLen);
+    ctx.manifest.write((uint8_t)0);
+}
+
+// copy previous tracks first .. first + n - 1: their index entries shifted to the new playlist position,
+// then their text as one block. The previous playlist was written by this scanner, so the range has no gaps.
+static bool copyTracks(ScanContext &ctx, uint32_t first, uint32_t n) {
+    PlaylistIndexEntry entry;
+    ctx.oldIndex.seek(sizeof(PlaylistIndexHeader) + (size_t)first * sizeof(entry), SeekSet);
+    if (ctx.oldIndex.read((uint8_t *)&entry, sizeof(entry)) != sizeof(entry)) return false;
+    uint32_t start = entry.offset, end = ctx.oldBlobSize;
+    if (first + n < ctx.oldCount) {
+        ctx.oldIndex.seek(sizeof(PlaylistIndexHeader) + (size_t)(first + n) * sizeof(entry), SeekSet);
+        if (ctx.oldIndex.read((uint8_t *)&entry, sizeof(entry)) != sizeof(entry)) return false;
+        end = entry.offset;
+    }
+    if (start >= end || end > ctx.oldBlobSize) return false;
+
+    uint32_t newStart = ctx.playlist.position();
+    ctx.oldIndex.seek(sizeof(PlaylistIndexHeader) + (size_t)first * sizeof(entry), SeekSet);
+    for (uint32_t done = 0; done < n;) {
+        uint32_t k = min<uint32_t>(n - done, SCAN_COPY_BUF_LEN / sizeof(entry));
+        PlaylistIndexEntry *e = (PlaylistIndexEntry *)ctx.copyBuf;
+        if (ctx.oldIndex.read(ctx.copyBuf, k * sizeof(entry)) != k * sizeof(entry)) return false;
+        for (uint32_t i = 0; i < k; i++) {
+            if (e[i].offset < start || e[i].offset + e[i].length > end) return false;
+            e[i].offset = e[i].offset - start + newStart;
+        }
+        ctx.index.write(ctx.copyBuf, k * sizeof(entry));
+        done += k;
+    }
+    ctx.oldPlaylist.seek(start, SeekSet);
+    for (uint32_t pos = start; pos < end;) {
+        uint32_t k = min<uint32_t>(end - pos, SCAN_COPY_BUF_LEN);
+        if (ctx.oldPlaylist.read(ctx.copyBuf, k) != k) return false;
+        ctx.playlist.write(ctx.copyBuf, k);
+        pos += k;
+    }
+    return true;
+}
+
+// write the pending range of previous tracks
+static void flushCopy(ScanContext &ctx) {
+    if (ctx.copyCount == 0) return;
+    if (!copyTracks(ctx, ctx.copyFirst, ctx.copyCount)) {
+        log_w("Previous playlist tracks %u..%u unreadable", ctx.copyFirst, ctx.copyFirst + ctx.copyCount - 1);
+        ctx.failed = true; // the new playlist is short, keep the old one
+    }
+    ctx.copyCount = 0;
+}
+
+// take over the tracks an unchanged directory contributed to the previous playlist,
+// joined with the pending range when they follow it
+static bool queueCopy(ScanContext &ctx, const ScanManifestDir *old) {
+    if ((uint64_t)old->firstTrack + old->trackCount > ctx.oldCount) return false;
+    if (old->trackCount == 0) return true;
+    if (ctx.copyCount && ctx.copyFirst + ctx.copyCount != old->firstTrack) flushCopy(ctx);
+    if (ctx.copyCount == 0) ctx.copyFirst = old->firstTrack;
+    ctx.copyCount += old->trackCount;
+    ctx.count += old->trackCount;
+    return true;
+}
+
+static void addTrack(ScanContext &ctx, const char *path) {
+    flushCopy(ctx); // keeps playlist order
+    writePlaylistEntry(ctx.playlist, ctx.index, path);
+    ctx.count++;
+    log_d("-> %s", path);
+}
+
+static uint32_t fnv1a(uint32_t h, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) h = (h ^ *p++) * 16777619u;
+    return h;
+}
+
+// Build full child path into pathBuf
+static void childPath(const char *currentDir, const char *base, char *pathBuf, size_t pathBufLen) {
+    if (strcmp(currentDir, "/") == 0) {
+        snprintf(pathBuf, pathBufLen, "/%s", base);
+    } else {
+        snprintf(pathBuf, pathBufLen, "%s/%s", currentDir, base);
+    }
+}
+
+// one readdir() pass: audio files and visible sub directories go to 'names' as type ('f' / 'd') + basename + '\0',
+// in directory order, rec gets their hash and count. Other files do not change the playlist and are left out.
+static bool listDir(ScanContext &ctx, const char *dirPath, std::vector<char> &names, ScanManifestDir &rec) {
+    File dir = ctx.fs->open(dirPath);
+    if (!dir || !dir.isDirectory()) {
+        dir.close();
+        return false;
+    }
+    bool isDir;
+    uint32_t n = 0, seen = 0;
+    while (true) {
+        String name = dir.getNextFileName(&isDir); // FULL path on SD, nothing opened or stat()ed
+        if (name.length() == 0) break;
+        const char *base = strrchr(name.c_str(), '/');
+        base = base ? base + 1 : name.c_str(); // basename ONLY
+        if (isDir ? base[0] != '.' : isAudioFile(base)) {
+            names.push_back(isDir ? 'd' : 'f');
+            names.insert(names.end(), base, base + strlen(base) + 1);
+            n++;
+        }
+        if ((++seen & 31) == 0) vTaskDelay(1);
+    }
+    dir.close(); // no handle stays open while the sub directories are scanned
+    rec.entryHash = fnv1a(2166136261u, names.data(), names.size());
+    rec.entryCount = n;
+    return true;
+}
+
+// ==========================================
+// Recursive Directory Scanner that SAVES TO FILE
+// tracks of a directory are written first, then its sub directories,
+// so every directory owns one contiguous range of the playlist.
+// Note: older firmware wrote files and sub directories interleaved in
+// directory order, a folder holding both lists its own tracks first now.
+// ==========================================
+static void scanDirRecursive(ScanContext &ctx, const char *currentDir, uint8_t level) {
+    std::vector<char> names;
+    ScanManifestDir rec = {};
+    if (!listDir(ctx, currentDir, names, rec)) return;
+    rec.firstTrack = ctx.count;
+
+    const ScanManifestDir *old = findManifestDir(ctx, currentDir);
+    if (old && old->entryHash == rec.entryHash && old->entryCount == rec.entryCount && queueCopy(ctx, old)) {
+        ctx.reusedDirs++;
+    } else {
+        for (size_t i = 0; i < names.size(); i += strlen(&names[i]) + 1) {
+            if (names[i] != 'f') continue;
+            childPath(currentDir, &names[i + 1], ctx.pathBuf, PATH_BUF_LEN);
+            addTrack(ctx, ctx.pathBuf);
+        }
+    }
+    rec.trackCount = ctx.count - rec.firstTrack;
+    writeManifestDir(ctx, rec, currentDir);
+
+    // progress report
+    if ((++ctx.dirs & 15) == 0 && ctx.progress) ctx.progress(ctx.dirs, ctx.count);
+
+    if (level == 0) return;
+    for (size_t i = 0; i < names.size(); i += strlen(&names[i]) + 1) {
+        if (names[i] != 'd') continue;
+        char childDir[PATH_BUF_LEN];
+        childPath(currentDir, &names[i + 1], childDir, sizeof(childDir)); // ✅ stable copy
+        scanDirRecursive(ctx, childDir, level - 1);
+    }
+}
+
+
+//create music_playlist.txt, its offset index music_playlist.idx and the scan manifest
+//unchanged directories are merged from the previous scan
+bool generatePlaylistFile(fs::FS &sourceFs, const char *dirname, uint8_t levels, ScanProgressCb progress) {
+    uint32_t t0 = millis();
+    uint32_t generation = nextIndexGeneration();
+    ScanContext ctx = {};
+    ctx.fs = &sourceFs;
+    ctx.progress = progress;
+    loadScanManifest(ctx);
+
+    // write next to the previous files, swap them in when done
+    ctx.playlist = LittleFS.open(PLAYLIST_FILE ".new", FILE_WRITE);
+    ctx.index = LittleFS.open(PLAYLIST_INDEX_FILE ".new", FILE_WRITE);
+    ctx.manifest = LittleFS.open(SCAN_MANIFEST_FILE ".new", FILE_WRITE);
+    ctx.pathBuf = (char *)heap_caps_malloc(PATH_BUF_LEN, MALLOC_CAP_SPIRAM);
+    ctx.copyBuf = (uint8_t *)heap_caps_malloc(SCAN_COPY_BUF_LEN, MALLOC_CAP_SPIRAM);
+
+    bool ok = ctx.playlist && ctx.index && ctx.manifest && ctx.pathBuf && ctx.copyBuf;
+    if (!ok) {
+        log_e("Failed to open playlist files for writing!");
+    } else {
+        ScanManifestHeader header = {.magic = SCAN_MANIFEST_MAGIC, .version = SCAN_MANIFEST_VERSION, .trackCount = 0};
+        ctx.manifest.write((const uint8_t *)&header, sizeof(header));
+        writePlaylistIndexHeader(ctx.index, 0, 0, generation); // placeholder, patched after scan
+
+        log_d("Scanning directory: %s (%s)", dirname, ctx.oldManifest ? "incremental" : "full");
+        scanDirRecursive(ctx, dirname, levels);
+        flushCopy(ctx);
+
+        writePlaylistIndexHeader(ctx.index, ctx.count, ctx.playlist.position(), generation);
+        header.trackCount = ctx.count;
+        ctx.manifest.seek(0, SeekSet);
+        ctx.manifest.write((const uint8_t *)&header, sizeof(header));
+        ok = !ctx.failed;
+    }
+
+    if (ctx.pathBuf) heap_caps_free(ctx.pathBuf);
+    if (ctx.copyBuf) heap_caps_free(ctx.copyBuf);
+    if (ctx.oldManifest) heap_caps_free(ctx.oldManifest);
+    ctx.playlist.close();
+    ctx.index.close();
+    ctx.manifest.close();
+    ctx.oldPlaylist.close();
+    ctx.oldIndex.close();
+
+    if (ok) {
+        // littlefs rename replaces the target atomically, a power loss leaves the old or the new file, never none.
+        // The manifest goes first and comes back last: between two renames the playlist and its index may be
+        // from different scans, getTrackCount() sees the blobSize mismatch and rebuilds the index.
+        LittleFS.remove(SCAN_MANIFEST_FILE);
+        ok = LittleFS.rename(PLAYLIST_FILE ".new", PLAYLIST_FILE) && LittleFS.rename(PLAYLIST_INDEX_FILE ".new", PLAYLIST_INDEX_FILE) &&
+             LittleFS.rename(SCAN_MANIFEST_FILE ".new", SCAN_MANIFEST_FILE);
+        if (!ok) log_e("Failed to swap in the new playlist files!");
+    }
+    if (ok) {
+        log_i("Playlist file %s generation complete. %u tracks, %u/%u folders unchanged, %u ms", PLAYLIST_FILE, ctx.count, ctx.reusedDirs, ctx.dirs, millis() - t0);
+    } else {
+        LittleFS.remove(PLAYLIST_FILE ".new");
+        LittleFS.remove(PLAYLIST_INDEX_FILE ".new");
+        LittleFS.remove(SCAN_MANIFEST_FILE ".new");
+    }
+    return ok;
+}
+
+// the line buffer filled up before '\n': true if only the line end was left (consumed),
+// false if the line goes on (skipped up to and including its '\n')
+static bool skipLineEnd(File &playlist) {
+  int c = playlist.peek();
+  bool end = c == '\r' || c == '\n';
+  while ((c = playlist.read()) >= 0 && c != '\n') {
+    if (c != '\r') end = false;
+  }
+  return end;
+}
+
+// ==========================================
+// Rebuild the offset index from an existing playlist text file
+// (playlist made by older firmware, or index lost/corrupted)
+// ==========================================
+bool buildPlaylistIndex() {
+  File playlist = LittleFS.open(PLAYLIST_FILE, FILE_READ);
+  if (!playlist) {
+    log_w("Failed to open playlist file: %s", PLAYLIST_FILE);
+    return false;
+  }
+  uint32_t generation = nextIndexGeneration();
+  File index = LittleFS.open(PLAYLIST_INDEX_FILE, FILE_WRITE);
+  if (!index) {
+    log_e("Failed to open playlist index for writing!");
+    playlist.close();
+    return false;
+  }
+  writePlaylistIndexHeader(index, 0, 0, generation);
+
+  char *lineBuf = (char *)heap_caps_malloc(PATH_BUF_LEN, MALLOC_CAP_SPIRAM);
+  if (!lineBuf) {
+    log_e("Failed to allocate path buffer");
+    index.close();
+    playlist.close();
+    LittleFS.remove(PLAYLIST_INDEX_FILE);
+    return false;
+  }
+
+  uint32_t count = 0;
+  while (playlist.available()) {
+    PlaylistIndexEntry entry = {};
+    entry.offset = playlist.position();
+    size_t len = playlist.readBytesUntil('\n', lineBuf, PATH_BUF_LEN - 1);
+    if (playlist.position() == entry.offset + len && playlist.available() && !skipLineEnd(playlist)) {
+      log_w("Playlist line at %u longer than %u bytes, skipped", entry.offset, PATH_BUF_LEN - 1);
+      continue; // getTrackPath() could not return it, and its tail is not another track
+    }
+    if (len > 0 && lineBuf[len - 1] == '\r') len--; // strip trailing CR
+    if (len == 0) continue;
+    entry.length = (uint16_t)len;
+    index.write((const uint8_t *)&entry, sizeof(entry));
+    count++;
+  }
+  writePlaylistIndexHeader(index, count, playlist.size(), generation);
+  LittleFS.remove(SCAN_MANIFEST_FILE); // track ranges no longer trusted, next scan is a full one
+
+  heap_caps_free(lineBuf);
+  index.close();
+  playlist.close();
+  log_d("Playlist index %s rebuilt (%u tracks)", PLAYLIST_INDEX_FILE, count);
+  return true;
+}
+
+// ==========================================
+// Track count is read from the index header (rebuild index if stale),
+// track numbers up to it are valid for getTrackPath() until the next scan
+// ==========================================
+int getTrackCount() {
+  for (uint8_t attempt = 0; attempt < 2; attempt++) {
+    File index = LittleFS.open(PLAYLIST_INDEX_FILE, FILE_READ);
+    if (index) {
+      PlaylistIndexHeader header;
+      bool ok = readPlaylistIndexHeader(index, header);
+      index.close();
+      if (ok) {
+        File playlist = LittleFS.open(PLAYLIST_FILE, FILE_READ);
+        size_t blobSize = playlist ? playlist.size() : 0;
+        playlist.close();
+        if (blobSize == header.blobSize) {
+          s_indexGeneration = header.generation;
+          return header.count;
+        }
+      }
+    }
+    if (attempt == 0) {
+      log_w("Playlist index missing or stale, rebuilding...");
+      if (!buildPlaylistIndex()) break;
+    }
+  }
+  return 0;
+}
+
+// ==========================================
+// Read a track path by index: one seek in the index, one seek in the playlist.
+// An index written after the last getTrackCount() is refused, its numbers
+// are not the caller's; so is an entry outside the playlist it was built for
+// ==========================================
+bool getTrackPath(int index, char *outBuf, size_t outBufSize) {
+  if (!outBuf || outBufSize == 0) return false;
+  outBuf[0] = '\0';
+  if (index < 0) return false;
+
+  uint32_t t0 = micros();
+  File indexFile = LittleFS.open(PLAYLIST_INDEX_FILE, FILE_READ);
+  if (!indexFile) {
+    log_w("Failed to open playlist index.");
+    return false;
+  }
+
+  PlaylistIndexHeader header;
+  PlaylistIndexEntry entry;
+  bool ok = readPlaylistIndexHeader(indexFile, header) && (uint32_t)index < header.count;
+  if (ok && s_indexGeneration && header.generation != s_indexGeneration) {
+    log_w("Playlist index generation %u, track numbers are of %u", header.generation, s_indexGeneration);
+    ok = false;
+  }
+  if (ok) {
+    indexFile.seek(sizeof(header) + (size_t)index * sizeof(entry), SeekSet);
+    ok = indexFile.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry) && (uint64_t)entry.offset + entry.length <= header.blobSize;
+  }
+  indexFile.close();
+  if (!ok) return false; // index not found
+
+  File playlist = LittleFS.open(PLAYLIST_FILE, FILE_READ);
+  if (!playlist) {
+    log_w("Failed to open playlist file.");
+    return false;
+  }
+  if (playlist.size() != header.blobSize) { // the playlist of another scan, the offsets are not its lines
+    log_w("Playlist file does not match its index.");
+    playlist.close();
+    return false;
+  }
+  size_t len = entry.length;
+  if (len > outBufSize - 1) len = outBufSize - 1;
+  playlist.seek(entry.offset, SeekSet);
+  len = playlist.read((uint8_t *)outBuf, len);
+  outBuf[len] = '\0';
+  playlist.close();
+
+  log_v("Track %d lookup %u us", index, micros() - t0);
+  return len > 0;
+}
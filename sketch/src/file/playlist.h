@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+// music playlist on LittleFS: the text file, its offset index and the manifest of the SD scan that wrote them.
+// No LVGL or UI here, sketch/host builds this file against an in-memory FS (host/playlist_bench.cpp).
+
+#define PLAYLIST_FILE "/music_playlist.txt"
+#define PLAYLIST_INDEX_FILE "/music_playlist.idx" // binary offset index into PLAYLIST_FILE
+#define PLAYLIST_INDEX_MAGIC 0x58494254 // "TBIX"
+#define PLAYLIST_INDEX_VERSION 2
+
+// index file layout: header, then 'count' fixed-width entries
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t entrySize; // sizeof(PlaylistIndexEntry)
+  uint32_t count; // number of tracks
+  uint32_t blobSize; // size of PLAYLIST_FILE when the index was built
+  uint32_t generation; // +1 per scan or index rebuild, getTrackPath() serves the one getTrackCount() returned
+} PlaylistIndexHeader;
+
+typedef struct {
+  uint32_t offset; // start of path in PLAYLIST_FILE
+  uint16_t length; // path length without line ending
+  uint16_t reserved;
+} PlaylistIndexEntry;
+
+#define SCAN_MANIFEST_FILE "/music_manifest.bin" // per directory state of the last SD scan
+#define SCAN_MANIFEST_MAGIC 0x4D534254 // "TBSM"
+#define SCAN_MANIFEST_VERSION 3
+
+// manifest layout: header, then one record per directory followed by its path + '\0'
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t reserved;
+  uint32_t trackCount; // must match the playlist index it was written with
+} ScanManifestHeader;
+
+typedef struct {
+  uint32_t entryHash; // FNV-1a of the audio file and sub directory names, in directory order
+  uint32_t entryCount; // audio files + sub directories
+  uint32_t firstTrack; // first playlist index owned by this directory
+  uint32_t trackCount; // number of tracks in this directory (not recursive)
+  uint16_t pathLen;
+  uint16_t reserved;
+} ScanManifestDir;
+
+typedef void (*ScanProgressCb)(uint32_t dirs, uint32_t tracks); // every 16 directories
+
+bool getTrackPath(int index, char *outBuf, size_t outBufSize);
+int getTrackCount();
+bool buildPlaylistIndex();
+bool generatePlaylistFile(fs::FS &sourceFs, const char *dirname, uint8_t levels, ScanProgressCb progress = NULL);
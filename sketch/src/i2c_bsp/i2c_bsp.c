@@ -17,6 +17,7 @@ i2c_master_dev_handle_t es7210_dev_handle = NULL;
 
 static uint32_t i2c_data_pdMS_TICKS = 0;
 static uint32_t i2c_done_pdMS_TICKS = 0;
+static volatile uint32_t i2c_transactions[2] = {0, 0}; // per port, see i2c_get_transactions()
 
 
 void i2c_master_Init(void)
@@ -74,6 +75,7 @@ uint8_t i2c_write_buff(i2c_master_dev_handle_t dev_handle,int reg,uint8_t *buf,u
   ret = i2c_master_bus_wait_all_done(user_i2c_port0_handle,i2c_done_pdMS_TICKS);
   if(ret != ESP_OK)
   return ret;
+  i2c_transactions[0]++;
   if(reg == -1)
   {
     ret = i2c_master_transmit(dev_handle,buf,len,i2c_data_pdMS_TICKS);
@@ -98,6 +100,7 @@ uint8_t i2c_master_write_read_dev(i2c_master_dev_handle_t dev_handle,uint8_t *wr
   ret = i2c_master_bus_wait_all_done(user_i2c_port0_handle,i2c_done_pdMS_TICKS);
   if(ret != ESP_OK)
   return ret;
+  i2c_transactions[0]++;
   ret = i2c_master_transmit_receive(dev_handle,writeBuf,writeLen,readBuf,readLen,i2c_data_pdMS_TICKS);
   return ret;
 }
@@ -108,6 +111,7 @@ uint8_t i2c_read_buff(i2c_master_dev_handle_t dev_handle,int reg,uint8_t *buf,ui
   ret = i2c_master_bus_wait_all_done(user_i2c_port0_handle,i2c_done_pdMS_TICKS);
   if(ret != ESP_OK)
   return ret;
+  i2c_transactions[0]++;
   if( reg == -1 )
   {ret = i2c_master_receive(dev_handle, buf,len, i2c_data_pdMS_TICKS);}
   else
@@ -122,6 +126,12 @@ uint8_t i2c_master_touch_write_read(i2c_master_dev_handle_t dev_handle,uint8_t *
   ret = i2c_master_bus_wait_all_done(user_i2c_port1_handle,i2c_done_pdMS_TICKS);
   if(ret != ESP_OK)
   return ret;
+  i2c_transactions[1]++;
   ret = i2c_master_transmit_receive(dev_handle,writeBuf,writeLen,readBuf,readLen,i2c_data_pdMS_TICKS);
   return ret;
 }
+
+uint32_t i2c_get_transactions(uint8_t port)
+{
+  return (port < 2) ? i2c_transactions[port] : 0;
+}
@@ -7,10 +7,12 @@
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_log.h"
+#include "esp_memory_utils.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "i2c_bsp/i2c_bsp.h"
+#include "lcd_bl_bsp/lcd_bl_pwm_bsp.h"
 #include "lvgl.h"
 #include "user_config.h"
 
@@ -23,12 +25,32 @@
 static const char *TAG = "lvgl_port";
 static SemaphoreHandle_t lvgl_mux = NULL;
 
-static uint16_t *lvgl_dma_buf = NULL;
-static SemaphoreHandle_t lvgl_flush_semap;
-
-#if (Rotated == USER_DISP_ROT_90)
-uint16_t *rotat_ptr = NULL;
-#endif
+// ping-pong strips: the CPU fills one while the QSPI DMA sends the other
+static uint16_t *lvgl_dma_buf[2] = {NULL, NULL};
+static SemaphoreHandle_t lvgl_flush_semap; // counts the free strips, given by the DMA done callback
+static lv_disp_drv_t *volatile flush_drv = NULL; // lv_disp_flush_ready() is called by the DMA done callback
+static volatile int16_t flush_strips = 0; // strips of the current refresh not yet sent
+static volatile int64_t flush_start = 0;
+
+// direct mode: LVGL re-renders only the invalidated areas into one full frame buffer (the shadow frame buffer)
+// the panel has no row window over QSPI, every transfer starts at panel row 0 -> send rows 0 ... last dirty row
+static int16_t flush_rows = 0; // panel rows needed by the areas of the current refresh
+
+// flush statistics, see lvgl_port_get_stats()
+static uint32_t stat_frames = 0;
+static uint32_t stat_frame_ms = 0;
+static volatile uint32_t stat_flush_us = 0; // start of the flush ... last strip sent
+static uint32_t stat_block_us = 0; // the lvgl task is inside the flush callback
+static uint64_t stat_bytes = 0;
+static uint32_t stat_time = 0;
+static lvgl_port_stats_t stats = {};
+
+// frame-rate governor: full rate while touched or animating, low rate when only labels tick, no rendering behind the blind panel
+typedef enum { GOV_ACTIVE, GOV_IDLE, GOV_LOCKED, GOV_STATES } gov_state_t;
+static const char *gov_name[GOV_STATES] = {"active", "idle", "locked"};
+static gov_state_t gov_state = GOV_ACTIVE;
+static uint64_t gov_wall_us[GOV_STATES] = {}; // time spent in the state
+static uint64_t gov_busy_us[GOV_STATES] = {}; // of that, time in lv_timer_handler()
 
 static const axs15231b_lcd_init_cmd_t lcd_init_cmds[] = {
     {0x11, (uint8_t[]){0x00}, 0, 100},
@@ -36,9 +58,13 @@ static const axs15231b_lcd_init_cmd_t lcd_init_cmds[] = {
 };
 
 static bool WAVESHARE_349_notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx) {
-  BaseType_t TaskWoken;
+  BaseType_t TaskWoken = pdFALSE;
   xSemaphoreGiveFromISR(lvgl_flush_semap, &TaskWoken);
-  return false;
+  if (flush_strips > 0 && --flush_strips == 0 && flush_drv) { // last strip of the refresh is out
+    stat_flush_us += esp_timer_get_time() - flush_start;
+    lv_disp_flush_ready(flush_drv);
+  }
+  return TaskWoken == pdTRUE;
 }
 
 static void WAVESHARE_349_increase_lvgl_tick(void *arg) {
@@ -47,72 +73,189 @@ static void WAVESHARE_349_increase_lvgl_tick(void *arg) {
 
 static void WAVESHARE_349_lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
 #if (Rotated == USER_DISP_ROT_90)
-  uint32_t index = 0;
-  uint16_t *data_ptr = (uint16_t *)color_map;
-  for (uint16_t j = 0; j < WAVESHARE_349_LCD_H_RES; j++) {
-    for (uint16_t i = 0; i < WAVESHARE_349_LCD_V_RES; i++) {
-      rotat_ptr[index++] = data_ptr[WAVESHARE_349_LCD_H_RES * (WAVESHARE_349_LCD_V_RES - i - 1) + j];
-    }
-  }
+  // lvgl x is the panel row, lvgl y the panel column, a dirty area needs panel rows 0 ... area->x2
+  if (area->x2 + 1 > flush_rows) flush_rows = area->x2 + 1;
+#else
+  int16_t area_rows = ((area->y2 + 1) * WAVESHARE_349_LCD_H_RES + LCD_NOROT_HRES - 1) / LCD_NOROT_HRES; // not rotated, the frame is sent linearly
+  if (area_rows > flush_rows) flush_rows = area_rows;
 #endif
+  if (flush_rows > LCD_NOROT_VRES) flush_rows = LCD_NOROT_VRES;
+  if (!lv_disp_flush_is_last(drv)) { // more areas of this refresh follow, they are in the same frame buffer
+    lv_disp_flush_ready(drv);
+    return;
+  }
+
+  const int rows = flush_rows;
+  flush_rows = 0;
   esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t)drv->user_data;
   const int flush_coun = (LVGL_SPIRAM_BUFF_LEN / LVGL_DMA_BUFF_LEN);
   const int offgap = (LCD_NOROT_VRES / flush_coun);
-  const int dmalen = (LVGL_DMA_BUFF_LEN / 2);
   int offsetx1 = 0;
   int offsety1 = 0;
   int offsetx2 = LCD_NOROT_HRES;
-  int offsety2 = offgap;
+  uint8_t strip = 0;
+  uint16_t *data_ptr = (uint16_t *)color_map;
 
+  flush_start = esp_timer_get_time();
+  flush_drv = drv;
+  flush_strips = (rows + offgap - 1) / offgap;
+  while (offsety1 < rows) {
+    int offsety2 = (offsety1 + offgap < rows) ? offsety1 + offgap : rows;
+    size_t len = (offsety2 - offsety1) * LCD_NOROT_HRES * 2;
+    xSemaphoreTake(lvgl_flush_semap, portMAX_DELAY); // the strip sent two transfers ago is out
+    uint16_t *dst = lvgl_dma_buf[strip];
 #if (Rotated == USER_DISP_ROT_90)
-  uint16_t *map = (uint16_t *)rotat_ptr;
+    // rotate straight into the strip, panel row j is lvgl column j
+    for (uint16_t j = offsety1; j < offsety2; j++) {
+      for (uint16_t i = 0; i < WAVESHARE_349_LCD_V_RES; i++) {
+        *dst++ = data_ptr[WAVESHARE_349_LCD_H_RES * (WAVESHARE_349_LCD_V_RES - i - 1) + j];
+      }
+    }
 #else
-  uint16_t *map = (uint16_t *)color_map;
+    memcpy(dst, data_ptr + offsety1 * LCD_NOROT_HRES, len);
 #endif
+    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2, offsety2, lvgl_dma_buf[strip]); // queued behind the strip on the bus
+    stat_bytes += len;
+    offsety1 = offsety2;
+    strip ^= 1;
+  }
+  stat_block_us += esp_timer_get_time() - flush_start;
+  // the frame buffer is copied, the DMA done callback calls lv_disp_flush_ready() after the last strip
+}
 
-  xSemaphoreGive(lvgl_flush_semap);
-  for (int i = 0; i < flush_coun; i++) {
-    xSemaphoreTake(lvgl_flush_semap, portMAX_DELAY);
-    memcpy(lvgl_dma_buf, map, LVGL_DMA_BUFF_LEN);
-    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2, offsety2, lvgl_dma_buf);
-    offsety1 += offgap;
-    offsety2 += offgap;
-    map += dmalen;
+// lvgl waits for the end of the previous flush before it renders into the frame buffer again
+static void WAVESHARE_349_lvgl_wait_cb(lv_disp_drv_t *drv) {
+  vTaskDelay(1);
+}
+
+// called by lvgl after every refresh, time = render + flush in ms
+static void WAVESHARE_349_lvgl_monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+  stat_frames++;
+  stat_frame_ms += time;
+  uint32_t now = millis();
+  if (now - stat_time >= 1000) {
+    stats.frames_per_sec = stat_frames * 1000 / (now - stat_time);
+    stats.frame_ms = stat_frame_ms / stat_frames;
+    stats.flush_us = stat_flush_us / stat_frames;
+    stats.flush_block_us = stat_block_us / stat_frames;
+    stats.qspi_bytes_per_sec = stat_bytes * 1000 / (now - stat_time);
+    stat_frames = 0;
+    stat_frame_ms = 0;
+    stat_flush_us = 0;
+    stat_block_us = 0;
+    stat_bytes = 0;
+    stat_time = now;
   }
-  xSemaphoreTake(lvgl_flush_semap, portMAX_DELAY);
-  lv_disp_flush_ready(drv);
 }
 
-static void WAVESHARE_349_lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
-  static uint8_t read_touchpad_cmd[8] = {0xb5, 0xab, 0xa5, 0x5a, 0x0, 0x0, 0x0, 0x8};
-  // uint8_t read_touchpad_cmd[11] = {0xb5, 0xab, 0xa5, 0x5a, 0x0, 0x0, 0x0, 0x0e,0x0, 0x0, 0x0};
-  uint8_t buff[32] = {0};
-  memset(buff, 0, 32);
-  ESP_ERROR_CHECK_WITHOUT_ABORT(i2c_master_write_read_dev(disp_touch_dev_handle, read_touchpad_cmd, 11, buff, 32));
+// lvgl heap: small blocks in internal RAM, large ones in PSRAM (LV_MEM_CUSTOM in lv_conf.h)
+// lvgl only allocates with the lock held, the counters need no lock of their own
+static uint32_t mem_used = 0;
+static uint32_t mem_internal = 0;
+static uint32_t mem_psram_blocks = 0;
+
+static void mem_count(void *p, int32_t sign) {
+  size_t size = heap_caps_get_allocated_size(p);
+  mem_used += sign * (int32_t)size;
+  if (esp_ptr_external_ram(p)) mem_psram_blocks += sign;
+  else mem_internal += sign * (int32_t)size;
+}
+
+#define MEM_CAPS_INTERNAL (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define MEM_CAPS_PSRAM (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#define MEM_CAPS_FIRST(size) ((size) >= LV_MEM_PSRAM_MIN ? MEM_CAPS_PSRAM : MEM_CAPS_INTERNAL)
+#define MEM_CAPS_SECOND(size) ((size) >= LV_MEM_PSRAM_MIN ? MEM_CAPS_INTERNAL : MEM_CAPS_PSRAM)
+
+void *lvgl_port_mem_alloc(size_t size) {
+  void *p = heap_caps_malloc_prefer(size, 2, MEM_CAPS_FIRST(size), MEM_CAPS_SECOND(size));
+  if (p) mem_count(p, 1);
+  return p;
+}
+
+void lvgl_port_mem_free(void *p) {
+  if (!p) return;
+  mem_count(p, -1);
+  heap_caps_free(p);
+}
+
+// a lv_mem_buf_get() buffer that grows past LV_MEM_PSRAM_MIN moves to PSRAM
+void *lvgl_port_mem_realloc(void *p, size_t size) {
+  if (!p) return lvgl_port_mem_alloc(size);
+  mem_count(p, -1);
+  void *q = heap_caps_realloc_prefer(p, size, 2, MEM_CAPS_FIRST(size), MEM_CAPS_SECOND(size));
+  mem_count(q ? q : p, 1); // on failure p is still allocated
+  return q;
+}
+
+// called with the lvgl lock held
+static void mem_sample(void) {
+  stats.mem_used = mem_used;
+  stats.mem_internal = mem_internal;
+  stats.mem_psram_blocks = mem_psram_blocks;
+  stats.mem_free = heap_caps_get_free_size(MEM_CAPS_INTERNAL);
+  stats.mem_free_biggest = heap_caps_get_largest_free_block(MEM_CAPS_INTERNAL);
+  if (stats.mem_free_biggest_min == 0 || stats.mem_free_biggest < stats.mem_free_biggest_min) stats.mem_free_biggest_min = stats.mem_free_biggest;
+}
+
+lvgl_port_stats_t lvgl_port_get_stats(void) {
+  return stats;
+}
+
+// touch: the board has no touch INT line (WAVESHARE_349_PIN_NUM_TOUCH_INT = -1)
+// released: poll every WAVESHARE_349_TOUCH_IDLE_POLL_MS, pressed: sample on every lvgl read for drag and gesture tracking
+static lv_indev_state_t touch_state = LV_INDEV_STATE_REL;
+static lv_point_t touch_point = {0, 0}; // last valid point, reported again while debouncing
+static uint32_t touch_last_poll = 0;
+static uint8_t touch_lost = 0; // release samples in a row while pressed
+static uint32_t touch_reads = 0;
+
+static bool WAVESHARE_349_touch_sample(lv_point_t *point) {
+  static uint8_t read_touchpad_cmd[11] = {0xb5, 0xab, 0xa5, 0x5a, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0};
+  uint8_t buff[8] = {0};
+  touch_reads++;
+  if (i2c_master_touch_write_read(disp_touch_dev_handle, read_touchpad_cmd, sizeof(read_touchpad_cmd), buff, sizeof(buff)) != ESP_OK) return false;
+  if (!(buff[1] > 0 && buff[1] < 5)) return false; // no finger or noise
   uint16_t pointX;
   uint16_t pointY;
   pointX = (((uint16_t)buff[2] & 0x0f) << 8) | (uint16_t)buff[3];
   pointY = (((uint16_t)buff[4] & 0x0f) << 8) | (uint16_t)buff[5];
-  // ESP_LOGI("Touch","%d,%d",buff[0],buff[1]);
   // ESP_LOGD(TAG, "Raw Touch: %d - %d", pointX, pointY);
 
-  if (buff[1] > 0 && buff[1] < 5) {
-    data->state = LV_INDEV_STATE_PR;
 #if (Rotated != USER_DISP_ROT_NONO)
-    if (pointX > WAVESHARE_349_LCD_V_RES) pointX = WAVESHARE_349_LCD_V_RES;
-    if (pointY > WAVESHARE_349_LCD_H_RES) pointY = WAVESHARE_349_LCD_H_RES;
-    data->point.x = pointY;
-    data->point.y = (WAVESHARE_349_LCD_V_RES - pointX);
+  if (pointX > WAVESHARE_349_LCD_V_RES) pointX = WAVESHARE_349_LCD_V_RES;
+  if (pointY > WAVESHARE_349_LCD_H_RES) pointY = WAVESHARE_349_LCD_H_RES;
+  point->x = pointY;
+  point->y = (WAVESHARE_349_LCD_V_RES - pointX);
 #else
-    if (pointX > WAVESHARE_349_LCD_H_RES) pointX = WAVESHARE_349_LCD_H_RES;
-    if (pointY > WAVESHARE_349_LCD_V_RES) pointY = WAVESHARE_349_LCD_V_RES;
-    data->point.x = (WAVESHARE_349_LCD_H_RES - pointX);
-    data->point.y = (WAVESHARE_349_LCD_V_RES - pointY);
+  if (pointX > WAVESHARE_349_LCD_H_RES) pointX = WAVESHARE_349_LCD_H_RES;
+  if (pointY > WAVESHARE_349_LCD_V_RES) pointY = WAVESHARE_349_LCD_V_RES;
+  point->x = (WAVESHARE_349_LCD_H_RES - pointX);
+  point->y = (WAVESHARE_349_LCD_V_RES - pointY);
 #endif
+  return true;
+}
 
+static void WAVESHARE_349_lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+  uint32_t now = millis();
+  if (touch_state == LV_INDEV_STATE_REL && now - touch_last_poll < WAVESHARE_349_TOUCH_IDLE_POLL_MS) { // nothing on the bus, report the cached state
+    data->state = touch_state;
+    data->point = touch_point;
+    return;
+  }
+  touch_last_poll = now;
+
+  lv_point_t point;
+  if (WAVESHARE_349_touch_sample(&point)) {
+    touch_point = point;
+    touch_state = LV_INDEV_STATE_PR;
+    touch_lost = 0;
+  } else if (touch_state == LV_INDEV_STATE_PR && ++touch_lost < WAVESHARE_349_TOUCH_RELEASE_SAMPLES) {
+    // single dropout while the finger moves, keep pressed on the last point (no false click/release)
   } else {
-    data->state = LV_INDEV_STATE_REL;
+    touch_state = LV_INDEV_STATE_REL;
   }
+  data->state = touch_state;
+  data->point = touch_point;
 }
 
 static bool WAVESHARE_349_lvgl_lock(int timeout_ms) {
@@ -125,36 +268,122 @@ static void WAVESHARE_349_lvgl_unlock(void) {
   xSemaphoreGive(lvgl_mux);
 }
 
+bool lvgl_port_in_lvgl_context(void) {
+  return lvgl_mux && xSemaphoreGetMutexHolder(lvgl_mux) == xTaskGetCurrentTaskHandle();
+}
+
+#if WAVESHARE_349_LVGL_THREAD_CHECK
+// LVGL calls the rounder for every invalidated area, in the task that changed the widget.
+// Changes of hidden widgets do not invalidate and are not caught.
+static void WAVESHARE_349_lvgl_thread_check_cb(lv_disp_drv_t *drv, lv_area_t *area) {
+  if (!lvgl_mux) return; // lv_init() ... ui_init(), before the lvgl task exists
+  if (!lvgl_port_in_lvgl_context()) {
+    ESP_LOGE(TAG, "LVGL touched from task '%s' without the lvgl lock, area %d,%d %d,%d", pcTaskGetName(NULL), area->x1, area->y1, area->x2, area->y2);
+    assert(false && "LVGL call outside the LVGL task, use ui_batch_*()");
+  }
+}
+#endif
+
+// ##########################################################
+// frame-rate governor
+
+static gov_state_t gov_select(void) {
+  // call with the lvgl lock held
+  if (BL_OFF && ui_Player_Panel_blindPanel && !lv_obj_has_flag(ui_Player_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN)) return GOV_LOCKED; // backlight off and blind panel shown (torch mode keeps BL_OFF without it)
+  if (lv_disp_get_inactive_time(NULL) < WAVESHARE_349_LVGL_IDLE_AFTER_MS || lv_anim_count_running() > 0) return GOV_ACTIVE;
+  return GOV_IDLE;
+}
+
+static void gov_apply(gov_state_t state) {
+  // call with the lvgl lock held
+  lv_disp_t *disp = lv_disp_get_default();
+  lv_indev_t *indev = lv_indev_get_next(NULL);
+  switch (state) {
+  case GOV_LOCKED: // nothing is visible, keep reading touch for the unlock
+    lv_timer_pause(disp->refr_timer);
+    if (indev) lv_timer_set_period(indev->driver->read_timer, WAVESHARE_349_LVGL_IDLE_INDEV_MS);
+    break;
+  case GOV_IDLE: // clock and play time change once per second
+    lv_timer_resume(disp->refr_timer);
+    lv_timer_set_period(disp->refr_timer, WAVESHARE_349_LVGL_IDLE_REFR_MS);
+    if (indev) lv_timer_set_period(indev->driver->read_timer, WAVESHARE_349_LVGL_IDLE_INDEV_MS);
+    break;
+  default:
+    lv_timer_resume(disp->refr_timer);
+    lv_timer_set_period(disp->refr_timer, LV_DISP_DEF_REFR_PERIOD);
+    if (indev) lv_timer_set_period(indev->driver->read_timer, LV_INDEV_DEF_READ_PERIOD);
+    break;
+  }
+  if (gov_state == GOV_LOCKED) lv_obj_invalidate(lv_scr_act()); // panel memory is stale after the lock
+  ESP_LOGD(TAG, "governor: %s -> %s", gov_name[gov_state], gov_name[state]);
+  gov_state = state;
+}
+
+static void gov_report(void) {
+  // share of time per state, CPU load of the lvgl task in that state and a rough current estimate
+  uint64_t total = 0;
+  for (int i = 0; i < GOV_STATES; i++) total += gov_wall_us[i];
+  if (!total) return;
+  for (int i = 0; i < GOV_STATES; i++) {
+    if (!gov_wall_us[i]) continue;
+    uint32_t cpu = gov_busy_us[i] * 1000 / gov_wall_us[i]; // permille
+    ESP_LOGD(TAG, "governor %-6s %3u%% of time, cpu %u.%u%%, ~%u mA", gov_name[i], (uint32_t)(gov_wall_us[i] * 100 / total), cpu / 10, cpu % 10,
+             cpu * WAVESHARE_349_LVGL_CORE_MA / 1000);
+    gov_wall_us[i] = 0;
+    gov_busy_us[i] = 0;
+  }
+}
+
 // ##########################################################
 
 
 void WAVESHARE_349_lvgl_port_task(void *arg)
 {
    uint32_t task_delay_ms = WAVESHARE_349_LVGL_TASK_MAX_DELAY_MS;
+   uint32_t stats_timer = millis();
+   int64_t last_loop = esp_timer_get_time();
 
   for(;;) {
+    int64_t t0 = esp_timer_get_time();
+    gov_wall_us[gov_state] += t0 - last_loop;
+    last_loop = t0;
     if (WAVESHARE_349_lvgl_lock(-1)) {
       process_ui_status_queue();
       task_delay_ms = lv_timer_handler();
+      gov_state_t state = gov_select();
+      if (state != gov_state) gov_apply(state);
+      if (millis() - stats_timer >= 10000) mem_sample();
       WAVESHARE_349_lvgl_unlock();
     }
-    if (task_delay_ms > WAVESHARE_349_LVGL_TASK_MAX_DELAY_MS) {
-      task_delay_ms = WAVESHARE_349_LVGL_TASK_MAX_DELAY_MS;
+    gov_busy_us[gov_state] += esp_timer_get_time() - t0;
+    uint32_t max_delay = (gov_state == GOV_ACTIVE) ? WAVESHARE_349_LVGL_TASK_MAX_DELAY_MS : WAVESHARE_349_LVGL_IDLE_INDEV_MS;
+    if (task_delay_ms > max_delay) {
+      task_delay_ms = max_delay;
     } else if (task_delay_ms < WAVESHARE_349_LVGL_TASK_MIN_DELAY_MS)
     {
       task_delay_ms = WAVESHARE_349_LVGL_TASK_MIN_DELAY_MS;
     }
+    if (millis() - stats_timer >= 10000) {
+      gov_report();
+      stats.touch_reads_per_sec = touch_reads * 1000 / (millis() - stats_timer);
+      touch_reads = 0;
+      ESP_LOGD(TAG, "touch %u reads/s, i2c transactions: bus0 %u, bus1 (touch) %u", stats.touch_reads_per_sec, i2c_get_transactions(0), i2c_get_transactions(1));
+      ESP_LOGD(TAG, "display %u fps, frame %u ms, flush %u us (lvgl blocked %u us), QSPI %u B/s", stats.frames_per_sec, stats.frame_ms, stats.flush_us, stats.flush_block_us,
+               stats.qspi_bytes_per_sec);
+      UIChannelStats ui = ui_status_get_stats();
+      ESP_LOGD(TAG, "ui channel: %u state writes (%u coalesced), %u events, %u dropped, %u batches, %u dropped", ui.slot_writes, ui.slot_coalesced, ui.events, ui.event_drops,
+               ui.batches, ui.batch_drops);
+      ESP_LOGD(TAG, "lvgl heap used %u (internal %u, %u blocks in PSRAM), internal free %u, largest free %u (min %u)", stats.mem_used, stats.mem_internal, stats.mem_psram_blocks, stats.mem_free,
+               stats.mem_free_biggest, stats.mem_free_biggest_min);
+      stats_timer = millis();
+    }
     vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
   }
 }
 
 
 void lvgl_port_init(void) {
-#if (Rotated == USER_DISP_ROT_90)
-  rotat_ptr = (uint16_t *)heap_caps_malloc(WAVESHARE_349_LCD_H_RES * WAVESHARE_349_LCD_V_RES * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
-  assert(rotat_ptr);
-#endif
-  lvgl_flush_semap = xSemaphoreCreateBinary();
+  lvgl_flush_semap = xSemaphoreCreateCounting(2, 2); // both strips are free
 
   static lv_disp_draw_buf_t disp_buf; // contains internal graphic buffer(s) called draw buffer(s)
   static lv_disp_drv_t disp_drv; // contains callback functions
@@ -219,13 +448,14 @@ void lvgl_port_init(void) {
 
   lv_init();
 
-  lvgl_dma_buf = (uint16_t *)heap_caps_malloc(LVGL_DMA_BUFF_LEN, MALLOC_CAP_DMA);
-  assert(lvgl_dma_buf);
+  for (int i = 0; i < 2; i++) {
+    lvgl_dma_buf[i] = (uint16_t *)heap_caps_malloc(LVGL_DMA_BUFF_LEN, MALLOC_CAP_DMA);
+    assert(lvgl_dma_buf[i]);
+  }
   lv_color_t *buffer_1 = (lv_color_t *)heap_caps_malloc(LVGL_SPIRAM_BUFF_LEN, MALLOC_CAP_SPIRAM);
-  lv_color_t *buffer_2 = (lv_color_t *)heap_caps_malloc(LVGL_SPIRAM_BUFF_LEN, MALLOC_CAP_SPIRAM);
   assert(buffer_1);
-  assert(buffer_2);
-  lv_disp_draw_buf_init(&disp_buf, buffer_1, buffer_2, WAVESHARE_349_LCD_H_RES * WAVESHARE_349_LCD_V_RES);
+  // one full frame buffer, direct mode keeps it as the shadow of the panel memory (a 2nd buffer would need syncing of the dirty areas)
+  lv_disp_draw_buf_init(&disp_buf, buffer_1, NULL, WAVESHARE_349_LCD_H_RES * WAVESHARE_349_LCD_V_RES);
 
   // REGISTER LVGL DISPLAY DRIVER
   ESP_LOGI(TAG, "Register display driver to LVGL");
@@ -234,8 +464,13 @@ void lvgl_port_init(void) {
   disp_drv.ver_res = WAVESHARE_349_LCD_V_RES;
   disp_drv.flush_cb = WAVESHARE_349_lvgl_flush_cb;
   disp_drv.draw_buf = &disp_buf;
-  disp_drv.full_refresh = 1; // full_refresh must be 1
+  disp_drv.direct_mode = 1; // render only invalidated areas, the flush sends the panel rows up to the last dirty one
+  disp_drv.monitor_cb = WAVESHARE_349_lvgl_monitor_cb;
+  disp_drv.wait_cb = WAVESHARE_349_lvgl_wait_cb;
   disp_drv.user_data = panel;
+#if WAVESHARE_349_LVGL_THREAD_CHECK
+  disp_drv.rounder_cb = WAVESHARE_349_lvgl_thread_check_cb; // leaves the area as is
+#endif
   lv_disp_drv_register(&disp_drv);
 
   ESP_LOGI(TAG, "Install LVGL tick timer");
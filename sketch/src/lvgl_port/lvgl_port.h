@@ -2,13 +2,36 @@
 #define LVGL_PORT_H
 
 #include <stdio.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 
+typedef struct {
+  uint32_t frames_per_sec; // lvgl refreshes in the last second
+  uint32_t frame_ms; // render + flush of one refresh
+  uint32_t flush_us; // QSPI transfer of one refresh
+  uint32_t flush_block_us; // part of flush_us the lvgl task spends in the flush callback
+  uint32_t qspi_bytes_per_sec; // pixel data sent to the panel
+  uint32_t touch_reads_per_sec; // I2C reads of the touch controller
+  uint32_t mem_used; // lvgl blocks, internal + PSRAM
+  uint32_t mem_internal; // part of mem_used in internal RAM
+  uint32_t mem_psram_blocks; // blocks placed in PSRAM (LV_MEM_PSRAM_MIN and up, or internal RAM was full)
+  uint32_t mem_free; // internal heap free
+  uint32_t mem_free_biggest; // largest free internal block now
+  uint32_t mem_free_biggest_min; // smallest largest-free-block seen since boot, shows fragmentation over long sessions
+} lvgl_port_stats_t;
+
+// lv_mem_alloc() & co, see LV_MEM_CUSTOM in lv_conf.h
+void *lvgl_port_mem_alloc(size_t size);
+void lvgl_port_mem_free(void *p);
+void *lvgl_port_mem_realloc(void *p, size_t size);
+
 void lvgl_port_init(void);
+lvgl_port_stats_t lvgl_port_get_stats(void);
+bool lvgl_port_in_lvgl_context(void); // the calling task holds the lvgl lock
 
 
 #ifdef __cplusplus
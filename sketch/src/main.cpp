@@ -59,17 +59,14 @@ TCA9554 *io = nullptr;
 #include "xtask.h" //all tasks
 
 // rtos message que handle
-QueueHandle_t ui_status_queue = NULL;
 QueueHandle_t audio_cmd_queue = NULL;
 
 // ############################################################
 void setup() {
   
   // message que init
-  ui_status_queue = xQueueCreate(20, sizeof(UIStatusPayload));
-  assert(ui_status_queue != NULL);
-  audio_cmd_queue = xQueueCreate(20, sizeof(AudioCommandPayload));
-  assert(audio_cmd_queue != NULL);
+  ui_status_init(); // state slots + event buffer for the LVGL task
+  audio_cmd_init(); // ordered command queue + volume/seek slots for the audio task
 
   randomSeed(esp_random());
   Serial.begin(115200);
@@ -87,11 +84,16 @@ void setup() {
   i2c_master_Init(); // init i2c
 
    // audio library
+#if TUNEBAR_ALLOC_TRACKING
+  ps_track_enable(true); // before the first audio library allocation
+#endif
   Audio::audio_info_callback = my_audio_info;
   audio.setAudioTaskCore(1); // audio default run on core 1 (lvgl run on core 0 in lvgl_port.c)
   audio.setPinout(I2S_BCLK, I2S_LRC, I2S_DSOUT, I2S_MCLK, I2S_DSIN);
   audio.forceMono(true);
   audio.setConnectionTimeout(2000, 4000); // connection timeout ms, ms_ssl
+  audio.setSeekIndexCache(LittleFS, SEEK_INDEX_DIR); // VBR seek / resume land on the right frame, index kept per track
+  audio.reportDecoderPlacement(); // log: which decoder buffers got internal RAM
   // audio.setVolume(audio_volume);  // default 0...21
 
   // exapnder init
@@ -136,7 +138,7 @@ void setup() {
   // Free RTOS Task
   xTaskCreatePinnedToCore(audio_loop_task, "audio_loop", 5 * 1024, NULL, 4, NULL, 1);
   xTaskCreatePinnedToCore(rtc_read_task, "getDateTimeTask", 3 * 1024, NULL, 3, NULL, 1);
-  xTaskCreatePinnedToCore(button_input_task, "buttonInputTask", 2 * 1024, NULL, 2, NULL, 1);
+  xTaskCreatePinnedToCore(button_input_task, "buttonInputTask", 3 * 1024, NULL, 2, NULL, 1);
   xTaskCreatePinnedToCore(batt_level_read_task, "readBatteryLevel", 2 * 1024, NULL, 1, NULL, 1);
   //xTaskCreatePinnedToCore(imu_read_task, "imu_read_task", 2 * 1024, NULL , 1, NULL,1);
 
@@ -389,8 +389,8 @@ void wifi_connect_task(void *param) {
     if (WiFi.status() == WL_CONNECTED) {
       wifi_need_connect = false;
 
-      lv_async_call(
-          [](void *param) {
+      ui_async_call(
+          [](void *param, const char *) {
             lv_timer_t *timer = (lv_timer_t *)param;
             if (timer) {
               lv_timer_resume(timer);//resume wifi check timer
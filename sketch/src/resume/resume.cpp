@@ -0,0 +1,96 @@
+//=================== Playback Resume ===========================
+#include "resume.h"
+#include <Preferences.h>
+
+static portMUX_TYPE resumeMux = portMUX_INITIALIZER_UNLOCKED; // audio task reports, button task writes at power off
+static ResumeState current = {}; // last track or station played
+static ResumeState written = {}; // what NVS holds
+static bool armed = false; // nothing is written before the saved state was read at boot
+static bool tracking = false; // current is playing, position updates belong to it
+static uint32_t changedAt = 0; // millis, current got a new track or station
+static uint32_t writtenAt = 0; // millis of the last write
+static uint32_t writeCount = 0;
+
+uint32_t resumePathHash(const char *path) { // FNV-1a
+  uint32_t h = 2166136261u;
+  while (*path) {
+    h ^= (uint8_t)*path++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+bool resumeInit(ResumeState &saved) {
+  Preferences prefs;
+  bool ok = false;
+  memset(&saved, 0, sizeof(saved));
+  if (prefs.begin("resume", true)) { // read only, fails if the namespace does not exist yet
+    ok = prefs.getBytesLength("state") == sizeof(saved) && prefs.getBytes("state", &saved, sizeof(saved)) == sizeof(saved) &&
+         saved.version == RESUME_VERSION;
+    prefs.end();
+  }
+  if (!ok) memset(&saved, 0, sizeof(saved));
+  portENTER_CRITICAL(&resumeMux);
+  if (!tracking) current = saved; // keep a track that started before the menu was up
+  written = saved;
+  writtenAt = changedAt = millis();
+  armed = true;
+  portEXIT_CRITICAL(&resumeMux);
+  log_d("resume state: %s, media %u index %u at %u s", ok ? "loaded" : "none", saved.mediaType, saved.index, saved.position);
+  return ok;
+}
+
+void resumeTrack(uint8_t mediaType, uint16_t index, const char *path) {
+  uint32_t hash = path ? resumePathHash(path) : 0;
+  portENTER_CRITICAL(&resumeMux);
+  if (current.mediaType != mediaType || current.index != index || current.pathHash != hash) changedAt = millis();
+  current.version = RESUME_VERSION;
+  current.mediaType = mediaType;
+  current.index = index;
+  current.pathHash = hash;
+  current.position = 0;
+  tracking = true;
+  portEXIT_CRITICAL(&resumeMux);
+}
+
+void resumeUntrack() {
+  portENTER_CRITICAL(&resumeMux);
+  tracking = false;
+  portEXIT_CRITICAL(&resumeMux);
+}
+
+void resumePosition(uint32_t position) {
+  portENTER_CRITICAL(&resumeMux);
+  if (tracking && current.mediaType == 1) current.position = position; // a stream has no position to go back to
+  portEXIT_CRITICAL(&resumeMux);
+}
+
+void resumeCheckpoint(bool force) {
+  portENTER_CRITICAL(&resumeMux);
+  bool due = false;
+  if (armed && current.version == RESUME_VERSION) {
+    uint32_t now = millis();
+    bool sameItem = current.mediaType == written.mediaType && current.index == written.index && current.pathHash == written.pathHash;
+    uint32_t moved = current.position > written.position ? current.position - written.position : written.position - current.position;
+    if (!sameItem)
+      due = force || now - changedAt >= RESUME_SETTLE_MS;
+    else if (moved > 0)
+      due = force || (moved >= RESUME_MIN_STEP && now - writtenAt >= RESUME_WRITE_INTERVAL_MS);
+  }
+  ResumeState state = current;
+  if (due) {
+    written = current;
+    writtenAt = millis();
+    writeCount++;
+  }
+  portEXIT_CRITICAL(&resumeMux);
+  if (!due) return;
+
+  Preferences prefs;
+  if (!prefs.begin("resume", false) || prefs.putBytes("state", &state, sizeof(state)) != sizeof(state)) {
+    log_w("resume checkpoint not written");
+  } else {
+    log_d("resume checkpoint #%u: media %u index %u at %u s", writeCount, state.mediaType, state.index, state.position);
+  }
+  prefs.end();
+}
@@ -0,0 +1,30 @@
+//=================== Playback Resume ===========================
+#pragma once
+
+#include <Arduino.h>
+
+// what was playing when the power went off, kept in NVS (namespace "resume")
+// the audio task reports what it plays, the checkpoint is written when it changed enough:
+//   new track / station: after RESUME_SETTLE_MS, skipping through the list writes once
+//   position: at most every RESUME_WRITE_INTERVAL_MS and only if it moved RESUME_MIN_STEP seconds
+//   power off: at once
+// worst case one 16 byte blob per minute of playback, NVS spreads it over its pages
+#define RESUME_VERSION 1
+#define RESUME_SETTLE_MS 5000
+#define RESUME_WRITE_INTERVAL_MS 60000
+#define RESUME_MIN_STEP 10 // seconds
+
+typedef struct {
+  uint8_t version;
+  uint8_t mediaType; // 0: livestream, 1: music player
+  uint16_t index; // trackIndex or stationIndex
+  uint32_t pathHash; // music: track path, the playlist may have been rebuilt since
+  uint32_t position; // music: seconds, from the play position or Audio::stopSong()
+} ResumeState;
+
+bool resumeInit(ResumeState &saved); // loads the last checkpoint and starts checkpointing, false if there is none
+void resumeTrack(uint8_t mediaType, uint16_t index, const char *path); // audio task: a track or station started, path NULL for a station
+void resumeUntrack(); // audio task: stopped or a system sound plays, the last item is kept
+void resumePosition(uint32_t position); // audio task: play position of the tracked item
+void resumeCheckpoint(bool force = false); // writes the state if a checkpoint is due, force: power off
+uint32_t resumePathHash(const char *path);
@@ -1,11 +1,8 @@
 // Handle message que between task AUDIO and UI
 
 /*
-      UIStatusPayload msg = { //prepare mesasge
-                              .type = STATUS_UPDATE_BATTERY_LEVEL,
-                              .battery_state = bat_state
-      };
-      xQueueSend(ui_status_queue, &msg, 0);  //send message
+      updateBatteryLevel(bat_state); // state: latest value wins
+      updateWiFiStatus("Connected", 0x00FF00, 0x00FF00); // event: queued in order
 */
 #include "task_msg.h"
 #include "esp32-hal.h"
@@ -14,8 +11,13 @@
 #include "pcf85063/pcf85063.h"
 #include "ui/ui.h"
 #include "weather/weather.h"
+#include "asset/asset.h"
+#include <esp_timer.h>
 #include <LittleFS.h>
 #include "network/network.h"
+#include "file/file.h"
+#include "resume/resume.h"
+#include "lvgl_port/lvgl_port.h"
 
 #include "ESP32-audioI2S-master/Audio.h"
 Audio audio;
@@ -25,147 +27,527 @@ bool seeking_now = false;
 
 //###########  MESSAGE QUEUE SENDER functions ###############################
 
+//----------  UI status channel ------------------------
+#define SLOT_BATTERY (1 << 0)
+#define SLOT_CLOCK (1 << 1)
+#define SLOT_PROGRESS_BAR (1 << 2)
+#define SLOT_PLAY_POSITION (1 << 3)
+#define SLOT_SCREEN_LOCK (1 << 4)
+
+static portMUX_TYPE slot_mux = portMUX_INITIALIZER_UNLOCKED; // guards the slots and the stats
+static uint32_t slot_dirty = 0;
+static uint8_t slot_battery = 0;
+static UIClock slot_clock = {};
+static uint32_t slot_total = 0; // progress bar range
+static uint32_t slot_pos = 0;
+static uint32_t slot_pos_total = 0;
+static bool slot_locked = false;
+static UIChannelStats ui_stats = {};
+
+static MessageBufferHandle_t ui_event_buffer = NULL;
+static SemaphoreHandle_t ui_event_lock = NULL; // a message buffer takes one writer at a time
+static MessageBufferHandle_t ui_batch_buffer = NULL;
+static SemaphoreHandle_t ui_batch_lock = NULL;
+
+void ui_status_init() {
+  ui_event_buffer = xMessageBufferCreate(UI_EVENT_BUFFER_SIZE);
+  assert(ui_event_buffer != NULL);
+  ui_event_lock = xSemaphoreCreateMutex();
+  assert(ui_event_lock != NULL);
+  ui_batch_buffer = xMessageBufferCreate(UI_BATCH_BUFFER_SIZE);
+  assert(ui_batch_buffer != NULL);
+  ui_batch_lock = xSemaphoreCreateMutex();
+  assert(ui_batch_lock != NULL);
+}
+
+UIChannelStats ui_status_get_stats() {
+  portENTER_CRITICAL(&slot_mux);
+  UIChannelStats s = ui_stats;
+  portEXIT_CRITICAL(&slot_mux);
+  return s;
+}
+
+// mark a slot changed, called inside slot_mux
+static inline void slot_publish(uint32_t slot) {
+  ui_stats.slot_writes++;
+  if (slot_dirty & slot) ui_stats.slot_coalesced++;
+  slot_dirty |= slot;
+}
+
+// send one event, wait = how long a full buffer may block the caller
+static void ui_event_send(UIStatusType type, const char *text, uint32_t labelColor, uint32_t wifiColor, TickType_t wait) {
+  UIStatusPayload msg;
+  msg.type = type;
+  msg.labelcolor = labelColor;
+  msg.wificolor = wifiColor;
+  size_t len = strlcpy(msg.text, text ? text : "", sizeof(msg.text));
+  if (len >= sizeof(msg.text)) len = sizeof(msg.text) - 1;
+  size_t bytes = offsetof(UIStatusPayload, text) + len + 1;
+
+  bool sent = false;
+  if (xSemaphoreTake(ui_event_lock, wait) == pdTRUE) {
+    sent = xMessageBufferSend(ui_event_buffer, &msg, bytes, wait) == bytes;
+    xSemaphoreGive(ui_event_lock);
+  }
+  portENTER_CRITICAL(&slot_mux);
+  if (sent)
+    ui_stats.events++;
+  else
+    ui_stats.event_drops++;
+  portEXIT_CRITICAL(&slot_mux);
+  if (!sent) log_w("UI event %d dropped, buffer full", type);
+}
+
+void updateBatteryLevel(uint8_t state) {
+  portENTER_CRITICAL(&slot_mux);
+  slot_battery = state;
+  slot_publish(SLOT_BATTERY);
+  portEXIT_CRITICAL(&slot_mux);
+}
+
+void updateClock(const UIClock &clock) {
+  portENTER_CRITICAL(&slot_mux);
+  slot_clock = clock;
+  slot_publish(SLOT_CLOCK);
+  portEXIT_CRITICAL(&slot_mux);
+}
+
+void updatePlayPosition(uint32_t pos, uint32_t total) {
+  portENTER_CRITICAL(&slot_mux);
+  slot_pos = pos;
+  slot_pos_total = total;
+  slot_publish(SLOT_PLAY_POSITION);
+  portEXIT_CRITICAL(&slot_mux);
+}
+
+void updateProgressBar(uint32_t total) {
+  portENTER_CRITICAL(&slot_mux);
+  slot_total = total;
+  slot_publish(SLOT_PROGRESS_BAR);
+  portEXIT_CRITICAL(&slot_mux);
+}
+
+void updateScreenLock(bool locked) {
+  portENTER_CRITICAL(&slot_mux);
+  slot_locked = locked;
+  slot_publish(SLOT_SCREEN_LOCK);
+  portEXIT_CRITICAL(&slot_mux);
+}
+
+void updateTrackNumber(const char *trackNumber) {
+  ui_event_send(STATUS_UPDATE_TRACK_NUMBER, trackNumber, 0, 0, 100);
+}
+
+void updateTrackDesc(const char *desc, bool append) {
+  ui_event_send(append ? STATUS_UPDATE_TRACK_DESC_ADD : STATUS_UPDATE_TRACK_DESC_SET, desc, 0, 0, 100);
+}
+
 // SD card   "file.cpp"
 void updateSDCARDStatus(const char *status,  const uint32_t wifiColor) {
-  UIStatusPayload msg = {
-     .type = STATUS_SDCARD_STATUS,
-     .wificolor = wifiColor,
-     };
-  snprintf(msg.status, sizeof(msg.status), "%s", status);
-  xQueueSend(ui_status_queue, &msg,  0);
+  ui_event_send(STATUS_SDCARD_STATUS, status, 0, wifiColor, 0);
 }
 // WiFi network  "network.cpp"
 void updateWiFiStatus(const char *status, const uint32_t labelColor, const uint32_t wifiColor) {
-  UIStatusPayload msg = {
-      .type = STATUS_WIFI_CONNECTION,
-      .labelcolor = labelColor,
-      .wificolor = wifiColor,
-  };
-   snprintf(msg.status, sizeof(msg.status), "%s", status);
-  xQueueSend(ui_status_queue, &msg, 0);
+  ui_event_send(STATUS_WIFI_CONNECTION, status, labelColor, wifiColor, 0);
 }
 
 void updateWiFiOption(const char *status) {
-  UIStatusPayload msg = {
-      .type = STATUS_WIFI_OPTION,
-  };
-   snprintf(msg.status, sizeof(msg.status), "%s", status);
-  xQueueSend(ui_status_queue, &msg, 0);
+  ui_event_send(STATUS_WIFI_OPTION, status, 0, 0, 0);
+}
+
+//----------  Deferred UI updates ------------------------
+// batch layout: UIOp header, then 'text_len' bytes of text incl. '\0', next UIOp ...
+typedef enum : uint8_t {
+  UI_OP_LABEL_TEXT,
+  UI_OP_TEXTAREA_SET,
+  UI_OP_TEXTAREA_ADD,
+  UI_OP_IMG_SRC,
+  UI_OP_BG_COLOR,
+  UI_OP_BG_GRAD_COLOR,
+  UI_OP_CALL,
+} UIOpType;
+
+typedef struct {
+  lv_obj_t *obj;
+  ui_call_cb_t cb; // UI_OP_CALL
+  void *param; // UI_OP_CALL
+  const void *src; // UI_OP_IMG_SRC
+  uint32_t color; // UI_OP_BG_COLOR, UI_OP_BG_GRAD_COLOR
+  uint16_t text_len;
+  UIOpType op;
+} UIOp;
+
+// run the operations of one batch, LVGL task only
+static void ui_batch_apply(const uint8_t *data, size_t len) {
+  size_t pos = 0;
+  while (pos + sizeof(UIOp) <= len) {
+    UIOp op;
+    memcpy(&op, data + pos, sizeof(op)); // ops are packed, no alignment
+    const char *text = (const char *)(data + pos + sizeof(op));
+    pos += sizeof(op) + op.text_len;
+    if (pos > len) break;
+
+    switch (op.op) {
+    case UI_OP_LABEL_TEXT: lv_label_set_text(op.obj, text); break;
+    case UI_OP_TEXTAREA_SET: lv_textarea_set_text(op.obj, text); break;
+    case UI_OP_TEXTAREA_ADD: lv_textarea_add_text(op.obj, text); break;
+    case UI_OP_IMG_SRC: lv_img_set_src(op.obj, op.src ? op.src : ""); break;
+    case UI_OP_BG_COLOR: lv_obj_set_style_bg_color(op.obj, lv_color_hex(op.color), LV_PART_MAIN); break;
+    case UI_OP_BG_GRAD_COLOR: lv_obj_set_style_bg_grad_color(op.obj, lv_color_hex(op.color), LV_PART_MAIN); break;
+    case UI_OP_CALL: op.cb(op.param, op.text_len ? text : NULL); break;
+    }
+  }
+}
+
+void ui_batch_begin(UIBatch &batch, TickType_t wait) {
+  batch.wait = wait;
+  batch.len = 0;
+}
+
+static bool ui_batch_send(const uint8_t *data, size_t len, TickType_t wait) {
+  bool sent = false;
+  if (xSemaphoreTake(ui_batch_lock, wait) == pdTRUE) {
+    sent = xMessageBufferSend(ui_batch_buffer, data, len, wait) == len;
+    xSemaphoreGive(ui_batch_lock);
+  }
+  if (!sent) {
+    portENTER_CRITICAL(&slot_mux);
+    ui_stats.batch_drops++;
+    portEXIT_CRITICAL(&slot_mux);
+    log_w("UI batch of %u bytes dropped, buffer full", (unsigned)len);
+  }
+  return sent;
+}
+
+bool ui_batch_commit(UIBatch &batch) {
+  if (batch.len == 0) return true;
+  if (lvgl_port_in_lvgl_context()) { // the LVGL task itself, waiting for the buffer would deadlock
+    ui_batch_apply(batch.data, batch.len);
+    batch.len = 0;
+    portENTER_CRITICAL(&slot_mux);
+    ui_stats.batches++;
+    portEXIT_CRITICAL(&slot_mux);
+    return true;
+  }
+  bool sent = ui_batch_send(batch.data, batch.len, batch.wait);
+  batch.len = 0;
+  return sent;
+}
+
+// append one op + text to data, returns the new length. The caller makes sure it fits
+static size_t ui_op_put(uint8_t *data, size_t len, const UIOp &op, const char *text) {
+  memcpy(data + len, &op, sizeof(op));
+  len += sizeof(op);
+  if (op.text_len) {
+    memcpy(data + len, text, op.text_len - 1);
+    data[len + op.text_len - 1] = '\0'; // cut text ends here
+    len += op.text_len;
+  }
+  return len;
+}
+
+static void ui_batch_add(UIBatch &batch, UIOp op, const char *text) {
+  size_t text_len = text ? strlen(text) + 1 : 0;
+  if (sizeof(UIOp) + text_len > UI_BATCH_SIZE) text_len = UI_BATCH_SIZE - sizeof(UIOp);
+  if (batch.len + sizeof(UIOp) + text_len > UI_BATCH_SIZE) ui_batch_commit(batch); // full, send what we have
+  op.text_len = text_len;
+  batch.len = ui_op_put(batch.data, batch.len, op, text);
+}
+
+void ui_batch_label(UIBatch &batch, lv_obj_t *obj, const char *text) {
+  ui_batch_add(batch, {.obj = obj, .op = UI_OP_LABEL_TEXT}, text ? text : "");
+}
+void ui_batch_textarea(UIBatch &batch, lv_obj_t *obj, const char *text, bool append) {
+  ui_batch_add(batch, {.obj = obj, .op = append ? UI_OP_TEXTAREA_ADD : UI_OP_TEXTAREA_SET}, text ? text : "");
+}
+void ui_batch_img(UIBatch &batch, lv_obj_t *obj, const void *src) {
+  ui_batch_add(batch, {.obj = obj, .src = src, .op = UI_OP_IMG_SRC}, NULL);
+}
+void ui_batch_bg_color(UIBatch &batch, lv_obj_t *obj, uint32_t color) {
+  ui_batch_add(batch, {.obj = obj, .color = color, .op = UI_OP_BG_COLOR}, NULL);
+}
+void ui_batch_bg_grad_color(UIBatch &batch, lv_obj_t *obj, uint32_t color) {
+  ui_batch_add(batch, {.obj = obj, .color = color, .op = UI_OP_BG_GRAD_COLOR}, NULL);
+}
+void ui_batch_call(UIBatch &batch, ui_call_cb_t cb, void *param, const char *text) {
+  ui_batch_add(batch, {.cb = cb, .param = param, .op = UI_OP_CALL}, text);
+}
+
+bool ui_async_call(ui_call_cb_t cb, void *param, const char *text, TickType_t wait) {
+  if (lvgl_port_in_lvgl_context()) {
+    cb(param, text);
+    return true;
+  }
+  uint8_t data[sizeof(UIOp) + UI_CALL_TEXT_LEN];
+  UIOp op = {.cb = cb, .param = param, .op = UI_OP_CALL};
+  size_t text_len = text ? strlen(text) + 1 : 0;
+  op.text_len = text_len > UI_CALL_TEXT_LEN ? UI_CALL_TEXT_LEN : text_len;
+  return ui_batch_send(data, ui_op_put(data, 0, op, text), wait);
+}
+
+// Helper function convert track time second -> hh:mm:ss
+void timeStr(char *buffer, size_t size, uint32_t second) {
+  uint8_t h = second / 3600;
+  uint8_t m = (second % 3600) / 60;
+  uint8_t s = second % 60;
+  if (h > 0) {
+    snprintf(buffer, size, "%d:%02d:%02d", h, m, s);
+  } else {
+    snprintf(buffer, size, "%d:%02d", m, s);
+  }
+}
+
+//----------  Audio command channel ------------------------
+#define SEEK_NONE 0
+#define SEEK_OFFSET 1 // seconds relative to the play position, accumulates
+#define SEEK_PLAY_TIME 2 // absolute seconds
+#define SEEK_FILE_POS 3 // absolute byte position
+
+typedef struct {
+  char url[AUDIO_URL_LEN];
+  char name[AUDIO_NAME_LEN];
+  int32_t startTime; // CMD_AUDIO_CONNECT_FS: seconds, -1 = from the beginning
+} AudioStrSlot;
+
+static portMUX_TYPE cmd_mux = portMUX_INITIALIZER_UNLOCKED; // guards the slots, the pool and the stats
+static bool cmd_volume_dirty = false;
+static int cmd_volume = 0;
+static uint8_t cmd_seek_kind = SEEK_NONE;
+static int32_t cmd_seek_value = 0;
+static uint16_t cmd_seek_epoch = 0; // epoch the pending seek belongs to
+static uint16_t cmd_epoch = 0; // epoch of the newest play/stop command in the queue
+static uint16_t cmd_epoch_next = 0; // last epoch handed out, a dropped command never becomes cmd_epoch
+static bool cmd_wake_pending = false; // a CMD_AUDIO_WAKE is in the queue
+static AudioStrSlot str_pool[AUDIO_STR_POOL_SIZE];
+static uint8_t str_used = 0; // bit per pool slot
+static AudioCmdStats cmd_stats = {};
+
+void audio_cmd_init() {
+  audio_cmd_queue = xQueueCreate(AUDIO_CMD_QUEUE_LEN, sizeof(AudioCommandPayload));
+  assert(audio_cmd_queue != NULL);
+}
+
+AudioCmdStats audio_cmd_get_stats() {
+  portENTER_CRITICAL(&cmd_mux);
+  AudioCmdStats s = cmd_stats;
+  portEXIT_CRITICAL(&cmd_mux);
+  return s;
+}
+
+static int8_t str_alloc() {
+  int8_t idx = -1;
+  portENTER_CRITICAL(&cmd_mux);
+  for (uint8_t i = 0; i < AUDIO_STR_POOL_SIZE; i++) {
+    if (!(str_used & (1 << i))) {
+      str_used |= 1 << i;
+      idx = i;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&cmd_mux);
+  return idx;
+}
+
+static void str_free(int8_t idx) {
+  if (idx < 0) return;
+  portENTER_CRITICAL(&cmd_mux);
+  str_used &= ~(1 << idx);
+  portEXIT_CRITICAL(&cmd_mux);
+}
+
+// queue an ordered command, never blocks the caller
+static void audio_cmd_send(AudioCommandType cmd, uint8_t source, int8_t str) {
+  AudioCommandPayload msg = {.cmd = cmd, .source = source, .str = str, .epoch = 0};
+  bool new_epoch = cmd != CMD_AUDIO_PAUSE_RESUME; // a new track or stop
+  if (new_epoch) {
+    portENTER_CRITICAL(&cmd_mux);
+    msg.epoch = ++cmd_epoch_next;
+    portEXIT_CRITICAL(&cmd_mux);
+  }
+
+  bool sent = xQueueSend(audio_cmd_queue, &msg, 0) == pdTRUE;
+  portENTER_CRITICAL(&cmd_mux);
+  if (sent) {
+    cmd_stats.commands++;
+    // only a queued command moves the epoch: a pending seek would hit the wrong track, later seeks wait for this one.
+    // If it was dropped, the current track keeps playing and its seeks and volume stay valid
+    if (new_epoch && (int16_t)(msg.epoch - cmd_epoch) > 0) {
+      cmd_epoch = msg.epoch;
+      cmd_seek_kind = SEEK_NONE;
+    }
+  } else {
+    cmd_stats.drops++;
+  }
+  portEXIT_CRITICAL(&cmd_mux);
+  if (!sent) {
+    str_free(str);
+    log_w("Audio command %d dropped, queue full", cmd);
+  }
+}
+
+// a slot went from clean to dirty, make sure the loop task wakes up for it. Called outside cmd_mux
+static void audio_cmd_wake(bool needed) {
+  if (!needed) return;
+  AudioCommandPayload msg = {.cmd = CMD_AUDIO_WAKE, .source = 0, .str = -1, .epoch = 0};
+  if (xQueueSend(audio_cmd_queue, &msg, 0) != pdTRUE) { // queue full, the loop task is busy with it anyway
+    portENTER_CRITICAL(&cmd_mux);
+    cmd_wake_pending = false;
+    portEXIT_CRITICAL(&cmd_mux);
+  }
+}
+
+// merge a seek into the pending one
+static void audio_seek_post(uint8_t kind, int32_t value) {
+  portENTER_CRITICAL(&cmd_mux);
+  cmd_stats.slot_writes++;
+  if (cmd_seek_kind != SEEK_NONE) cmd_stats.slot_coalesced++;
+  if (kind == SEEK_OFFSET && cmd_seek_kind == SEEK_OFFSET) {
+    cmd_seek_value += value;
+  } else if (kind == SEEK_OFFSET && cmd_seek_kind == SEEK_PLAY_TIME) {
+    cmd_seek_value += value;
+    if (cmd_seek_value < 0) cmd_seek_value = 0;
+  } else { // absolute seek, or the first seek since the last loop
+    cmd_seek_kind = kind;
+    cmd_seek_value = value;
+  }
+  cmd_seek_epoch = cmd_epoch;
+  bool wake = !cmd_wake_pending;
+  cmd_wake_pending = true;
+  portEXIT_CRITICAL(&cmd_mux);
+  audio_cmd_wake(wake);
 }
 
-// Audio  Control
 void audioSetAudioFilePosition(uint16_t pos) {
-      AudioCommandPayload msg = {
-        .cmd = CMD_AUDIO_SET_FILE_POSITION,
-        .value = pos,
-    };
-    xQueueSend(audio_cmd_queue, &msg, 0); // send message
+  audio_seek_post(SEEK_FILE_POS, pos);
 }
 void audioSetPlayTime(uint16_t pos) {
-      AudioCommandPayload msg = {
-        .cmd = CMD_AUDIO_SET_PLAY_TIME,
-        .value = pos,
-    };
-    xQueueSend(audio_cmd_queue, &msg, 0); // send message
+  audio_seek_post(SEEK_PLAY_TIME, pos);
+}
+void audioSetTimeOffset(int offset) {
+  audio_seek_post(SEEK_OFFSET, offset);
+}
+void audioSetVolume(int volume) {
+  portENTER_CRITICAL(&cmd_mux);
+  cmd_stats.slot_writes++;
+  if (cmd_volume_dirty) cmd_stats.slot_coalesced++;
+  cmd_volume = volume;
+  cmd_volume_dirty = true;
+  bool wake = !cmd_wake_pending;
+  cmd_wake_pending = true;
+  portEXIT_CRITICAL(&cmd_mux);
+  audio_cmd_wake(wake);
 }
 void audioStopSong() {
-  AudioCommandPayload msg = {
-      .cmd = CMD_AUDIO_STOP_SONG,
-      .url_filename = {0},
-      .value = 0,
-      .source = 0,
-      .stationName = {0},
-  };
-  xQueueSend(audio_cmd_queue, &msg, 0);
+  audio_cmd_send(CMD_AUDIO_STOP_SONG, 0, -1);
 }
 void audioPauseResume() {
-  AudioCommandPayload msg = {
-      .cmd = CMD_AUDIO_PAUSE_RESUME,
-      .url_filename = {0},
-      .value = 0,
-      .source = 0,
-      .stationName = {0},
-  };
-  xQueueSend(audio_cmd_queue, &msg, 0);
-}
-void audioSetTimeOffset(int offset) {
-  AudioCommandPayload msg = {
-      .cmd = CMD_AUDIO_SET_TIME_OFFSET,
-      .url_filename = {0},
-      .value = offset,
-      .source = 0,
-      .stationName = {0},
-  };
-  xQueueSend(audio_cmd_queue, &msg, 500);//wait for 0.5 sec, avoid too fast skipping
+  audio_cmd_send(CMD_AUDIO_PAUSE_RESUME, 0, -1);
 }
-void audioSetVolume(int volume) {
-  AudioCommandPayload msg = {
-      .cmd = CMD_AUDIO_SET_VOLUME,
-      .url_filename = {0},
-      .value = volume,
-      .source = 0,
-      .stationName = {0},
-  };
-  xQueueSend(audio_cmd_queue, &msg, 0);
-}
-void audioPlayFS(uint8_t source, const char *filename) {
-  AudioCommandPayload msg = {
-      .cmd = CMD_AUDIO_CONNECT_FS,
-      .url_filename = {0},
-      .value = 0,
-      .source = source,
-      .stationName = {0},
-  };
-  snprintf(msg.url_filename, sizeof(msg.url_filename), "%s", filename);
-  xQueueSend(audio_cmd_queue, &msg, 0);
+void audioPlayFS(uint8_t source, const char *filename, int32_t startTime) {
+  int8_t str = str_alloc();
+  if (str < 0) {
+    portENTER_CRITICAL(&cmd_mux);
+    cmd_stats.drops++;
+    portEXIT_CRITICAL(&cmd_mux);
+    log_w("Audio string pool full, %s dropped", filename);
+    return;
+  }
+  strlcpy(str_pool[str].url, filename, sizeof(str_pool[str].url));
+  str_pool[str].name[0] = '\0';
+  str_pool[str].startTime = startTime;
+  audio_cmd_send(CMD_AUDIO_CONNECT_FS, source, str);
 }
 void audioPlayHOST(const char *filename, const char *stationName) {
-  AudioCommandPayload msg = {
-      .cmd = CMD_AUDIO_CONNECT_HOST,
-      .url_filename = {0},
-      .value = 0,
-      .source = 0,
-      .stationName = {0},
-  };
-  snprintf(msg.url_filename, sizeof(msg.url_filename), "%s", filename);
-  snprintf(msg.stationName, sizeof(msg.stationName), "%s", stationName);
-  xQueueSend(audio_cmd_queue, &msg, 0);
+  int8_t str = str_alloc();
+  if (str < 0) {
+    portENTER_CRITICAL(&cmd_mux);
+    cmd_stats.drops++;
+    portEXIT_CRITICAL(&cmd_mux);
+    log_w("Audio string pool full, %s dropped", stationName);
+    return;
+  }
+  strlcpy(str_pool[str].url, filename, sizeof(str_pool[str].url));
+  strlcpy(str_pool[str].name, stationName, sizeof(str_pool[str].name));
+  audio_cmd_send(CMD_AUDIO_CONNECT_HOST, 0, str);
 }
 
 
 //----------  Clock display helper functions ------------------------
-// image name of each nixie image.
-const lv_img_dsc_t nixie[10] = {  // image 0 - 9
-    ui_img_numbers_0_png, ui_img_numbers_1_png, ui_img_numbers_2_png, ui_img_numbers_3_png, ui_img_numbers_4_png, ui_img_numbers_5_png, ui_img_numbers_6_png, ui_img_numbers_7_png, ui_img_numbers_8_png, ui_img_numbers_9_png,
-};
-// update nixie clock panel
-void nixie_clock(uint8_t hour, uint8_t minute, uint8_t second) {
-  static uint8_t old_time[6] = {255, 255, 255, 255, 255, 255};
-  uint8_t new_time[6] = {(uint8_t)(hour / 10), (uint8_t)(hour % 10), (uint8_t)(minute / 10), (uint8_t)(minute % 10), (uint8_t)(second / 10), (uint8_t)(second % 10)};
+// The clock panel draws the six digits itself from tiles of one digit atlas (0 - 9 stacked).
+// The SquareLine digit images only give the positions and stay hidden.
+#define NIXIE_ATLAS ATLAS_DIR "/nixie.tbi"
+#define NIXIE_DIGIT_H 100 // tile height in the atlas
+#define NIXIE_REPORT_DRAWS 60 // log the render time every n redraws
+
+static lv_img_dsc_t nixie[10]; // tiles 0 - 9
+static lv_area_t nixie_area[6]; // hour0 ... second1, relative to ui_Info_Panel_Clock
+static uint8_t nixie_digit[6] = {0, 0, 0, 0, 0, 0};
+static int8_t nixie_ready = 0; // 0 = not tried, 1 = atlas loaded, -1 = atlas missing
+static uint32_t nixie_draw_us = 0;
+static uint16_t nixie_draws = 0;
+
+static void nixie_abs_area(uint8_t i, lv_area_t *area) {
+  lv_area_t panel;
+  lv_obj_get_coords(ui_Info_Panel_Clock, &panel);
+  *area = nixie_area[i];
+  lv_area_move(area, panel.x1, panel.y1);
+}
 
-  if (new_time[0] != old_time[0]) {
-    lv_img_set_src(ui_Info_Image_hour0, &nixie[new_time[0]]);
-    old_time[0] = new_time[0];
-  }
-  if (new_time[1] != old_time[1]) {
-    lv_img_set_src(ui_Info_Image_hour1, &nixie[new_time[1]]);
-    old_time[1] = new_time[1];
+// blit the digit tiles that intersect the area being refreshed
+static void nixie_draw_cb(lv_event_t *e) {
+  lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+  int64_t start = esp_timer_get_time();
+  lv_draw_img_dsc_t dsc;
+  lv_draw_img_dsc_init(&dsc);
+  for (uint8_t i = 0; i < 6; i++) {
+    lv_area_t area;
+    nixie_abs_area(i, &area);
+    if (_lv_area_is_on(&area, draw_ctx->clip_area)) lv_draw_img(draw_ctx, &dsc, &area, &nixie[nixie_digit[i]]);
   }
-  if (new_time[2] != old_time[2]) {
-    lv_img_set_src(ui_Info_Image_minute0, &nixie[new_time[2]]);
-    old_time[2] = new_time[2];
+  nixie_draw_us += esp_timer_get_time() - start;
+  if (++nixie_draws >= NIXIE_REPORT_DRAWS) {
+    log_d("Nixie: %lu us per redraw", (unsigned long)(nixie_draw_us / nixie_draws));
+    nixie_draw_us = 0;
+    nixie_draws = 0;
   }
-  if (new_time[3] != old_time[3]) {
-    lv_img_set_src(ui_Info_Image_minute1, &nixie[new_time[3]]);
-    old_time[3] = new_time[3];
+}
+
+static bool nixie_init() {
+  const lv_img_dsc_t *atlas = assetAcquire(LittleFS, NIXIE_ATLAS); // kept for good
+  for (uint8_t d = 0; d < 10; d++) {
+    if (!assetTile(atlas, NIXIE_DIGIT_H, d, &nixie[d])) {
+      log_w("Nixie: %s missing, upload the data folder to LittleFS", NIXIE_ATLAS);
+      assetRelease(atlas);
+      return false;
+    }
   }
-  if (new_time[4] != old_time[4]) {
-    lv_img_set_src(ui_Info_Image_second0, &nixie[new_time[4]]);
-    old_time[4] = new_time[4];
+  lv_obj_t *digit[6] = {ui_Info_Image_hour0, ui_Info_Image_hour1, ui_Info_Image_minute0, ui_Info_Image_minute1, ui_Info_Image_second0, ui_Info_Image_second1};
+  lv_area_t panel;
+  lv_obj_update_layout(ui_Info_Panel_Clock);
+  lv_obj_get_coords(ui_Info_Panel_Clock, &panel);
+  for (uint8_t i = 0; i < 6; i++) {
+    lv_obj_get_coords(digit[i], &nixie_area[i]);
+    lv_area_move(&nixie_area[i], -panel.x1, -panel.y1);
+    nixie_area[i].x2 = nixie_area[i].x1 + nixie[0].header.w - 1;
+    nixie_area[i].y2 = nixie_area[i].y1 + nixie[0].header.h - 1;
+    lv_obj_add_flag(digit[i], LV_OBJ_FLAG_HIDDEN);
   }
-  if (new_time[5] != old_time[5]) {
-    lv_img_set_src(ui_Info_Image_second1, &nixie[new_time[5]]);
-    old_time[5] = new_time[5];
+  lv_obj_add_event_cb(ui_Info_Panel_Clock, nixie_draw_cb, LV_EVENT_DRAW_MAIN_END, NULL);
+  return true;
+}
+
+// update nixie clock panel, only the changed digits are redrawn
+void nixie_clock(uint8_t hour, uint8_t minute, uint8_t second) {
+  if (nixie_ready == 0) nixie_ready = nixie_init() ? 1 : -1;
+  if (nixie_ready < 0) return;
+  uint8_t new_time[6] = {(uint8_t)(hour / 10), (uint8_t)(hour % 10), (uint8_t)(minute / 10), (uint8_t)(minute % 10), (uint8_t)(second / 10), (uint8_t)(second % 10)};
+
+  for (uint8_t i = 0; i < 6; i++) {
+    if (new_time[i] == nixie_digit[i]) continue;
+    nixie_digit[i] = new_time[i];
+    lv_area_t area;
+    nixie_abs_area(i, &area);
+    lv_obj_invalidate_area(ui_Info_Panel_Clock, &area);
   }
 }
 
@@ -176,98 +558,114 @@ void nixie_clock(uint8_t hour, uint8_t minute, uint8_t second) {
 
 //run in lvgl_port.c  task to update lvgl widget
 void process_ui_status_queue() {
-  UIStatusPayload msg;
-
-  while (xQueueReceive(ui_status_queue, &msg, 0) == pdTRUE) {
-
-    switch (msg.type) {
-
-    // Battery status
-    case STATUS_UPDATE_BATTERY_LEVEL:
-      switch (msg.battery_state) {
-      case 4: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_FULL); break;
-      case 3: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_3); break;
-      case 2: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_2); break;
-      case 1: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_1); break;
-      default: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_EMPTY); break;
-      }
-      break;
+  // 1. state slots, only the newest value of each
+  portENTER_CRITICAL(&slot_mux);
+  uint32_t dirty = slot_dirty;
+  slot_dirty = 0;
+  uint8_t battery_state = slot_battery;
+  UIClock clock = slot_clock;
+  uint32_t total = slot_total;
+  uint32_t pos = slot_pos;
+  uint32_t pos_total = slot_pos_total;
+  bool locked = slot_locked;
+  portEXIT_CRITICAL(&slot_mux);
+
+  // Battery status
+  if (dirty & SLOT_BATTERY) {
+    switch (battery_state) {
+    case 4: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_FULL); break;
+    case 3: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_3); break;
+    case 2: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_2); break;
+    case 1: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_1); break;
+    default: lv_label_set_text(ui_Player_Label_Battery, LV_SYMBOL_BATTERY_EMPTY); break;
+    }
+  }
 
-    // Real time clock
-    case STATUS_UPDATE_CLOCK:
-      char timeBuf[16];
-      char dateBuf[40];
-      char datetimeBuf[60];
-      snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d:%02d", msg.hour, msg.minute, msg.second);
-      snprintf(dateBuf, sizeof(dateBuf), "%s, %s %d, %d", weekdayNames[msg.dayOfWeek], monthNames[msg.month - 1], msg.dayOfMonth, 2000 + msg.year);
-      snprintf(datetimeBuf, sizeof(datetimeBuf), "%s - %s", dateBuf, timeBuf);
-      log_d("%s", datetimeBuf);
-
-      switch (infoPageIndex) { // update date time by info panel page
-      case 0: // weather
-        lv_label_set_text(ui_Info_Label_DateTime, datetimeBuf);
-        break;
-      case 1: // nixie clock
-        lv_label_set_text(ui_Info_Label_DateNixie, dateBuf);
-        nixie_clock(msg.hour, msg.minute, msg.second);
-        break;
-      default: break;
-
-      } // switch
-      // update weather condition widget every 15 min.
-      if (msg.minute % 15 == 0 && msg.second == 0 && wifiEnable) updateWeatherPanel();
+  // Real time clock
+  if (dirty & SLOT_CLOCK) {
+    char timeBuf[16];
+    char dateBuf[40];
+    char datetimeBuf[60];
+    snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d:%02d", clock.hour, clock.minute, clock.second);
+    snprintf(dateBuf, sizeof(dateBuf), "%s, %s %d, %d", weekdayNames[clock.dayOfWeek], monthNames[clock.month - 1], clock.dayOfMonth, 2000 + clock.year);
+    snprintf(datetimeBuf, sizeof(datetimeBuf), "%s - %s", dateBuf, timeBuf);
+    log_d("%s", datetimeBuf);
+
+    switch (infoPageIndex) { // update date time by info panel page
+    case 0: // weather
+      lv_label_set_text(ui_Info_Label_DateTime, datetimeBuf);
       break;
-
-    // audio play position
-    case STATUS_UPDATE_PLAY_POSITION:
-      lv_slider_set_value(ui_Player_Slider_Progress, msg.current_pos, LV_ANIM_OFF);
-      lv_label_set_text(ui_Player_Label_RemainTime, msg.remain_buf);
-      lv_label_set_text(ui_Player_Label_ElapseTime, msg.elapse_buf);
+    case 1: // nixie clock
+      lv_label_set_text(ui_Info_Label_DateNixie, dateBuf);
+      nixie_clock(clock.hour, clock.minute, clock.second);
       break;
+    default: break;
 
-    // audio progress bar update
-    case STATUS_UPDATE_PROGRESS_BAR: lv_slider_set_range(ui_Player_Slider_Progress, 0, msg.total); break;
-
-    // audio current track label
-    case STATUS_UPDATE_TRACK_NUMBER: lv_label_set_text(ui_Player_Label_trackNumber, msg.trackNumber); break;
+    } // switch
+    // update weather condition widget every 15 min.
+    if (clock.minute % 15 == 0 && clock.second == 0 && wifiEnable) updateWeatherPanel();
+  }
 
-    // audio track description textarea
-    case STATUS_UPDATE_TRACK_DESC_SET:
-      lv_textarea_set_text(ui_Player_Textarea_status, msg.trackDesc); // new track
-      break;
-    case STATUS_UPDATE_TRACK_DESC_ADD:
-      lv_textarea_add_text(ui_Player_Textarea_status, msg.trackDesc); // new track
-      break;
+  // audio progress bar update, before the position so the value fits the range
+  if (dirty & SLOT_PROGRESS_BAR) lv_slider_set_range(ui_Player_Slider_Progress, 0, total);
+
+  // audio play position
+  if (dirty & SLOT_PLAY_POSITION) {
+    char elapse_buf[16];
+    char remain_buf[16];
+    timeStr(elapse_buf, sizeof(elapse_buf), pos);
+    timeStr(remain_buf, sizeof(remain_buf), pos_total > pos ? pos_total - pos : 0); // the decoder can run past its duration estimate (VBR, streams)
+    lv_slider_set_value(ui_Player_Slider_Progress, pos, LV_ANIM_OFF);
+    lv_label_set_text(ui_Player_Label_RemainTime, remain_buf);
+    lv_label_set_text(ui_Player_Label_ElapseTime, elapse_buf);
+  }
 
-    case STATUS_SCREEN_LOCK:
+  if (dirty & SLOT_SCREEN_LOCK) {
+    if (locked) {
       lv_obj_clear_flag(ui_Player_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN); // unhide blind panel
       lv_obj_clear_flag(ui_MainMenu_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN); // unhide blind panel
       lv_obj_clear_flag(ui_Info_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN); // unhide blind panel
-       lv_obj_clear_flag(ui_Utility_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN); // unhide blind panel
-      break;
-
-    case STATUS_SCREEN_UNLOCK:
+      lv_obj_clear_flag(ui_Utility_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN); // unhide blind panel
+    } else {
       lv_obj_add_flag(ui_Player_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN); // hide blind panel
       lv_obj_add_flag(ui_MainMenu_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN);
       lv_obj_add_flag(ui_Info_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN); // hide blind panel
       lv_obj_add_flag(ui_Utility_Panel_blindPanel, LV_OBJ_FLAG_HIDDEN); // unhide blind panel
+    }
+  }
+
+  // 2. events, in the order they were sent
+  UIStatusPayload msg;
+  while (xMessageBufferReceive(ui_event_buffer, &msg, sizeof(msg), 0) > 0) {
+
+    switch (msg.type) {
+
+    // audio current track label
+    case STATUS_UPDATE_TRACK_NUMBER: lv_label_set_text(ui_Player_Label_trackNumber, msg.text); break;
+
+    // audio track description textarea
+    case STATUS_UPDATE_TRACK_DESC_SET:
+      lv_textarea_set_text(ui_Player_Textarea_status, msg.text); // new track
+      break;
+    case STATUS_UPDATE_TRACK_DESC_ADD:
+      lv_textarea_add_text(ui_Player_Textarea_status, msg.text); // new track
       break;
 
     case STATUS_WIFI_CONNECTION:
-      lv_label_set_text(ui_MainMenu_Label_connectStatus, msg.status);
+      lv_label_set_text(ui_MainMenu_Label_connectStatus, msg.text);
       lv_obj_set_style_text_color(ui_MainMenu_Label_connectStatus, lv_color_hex(msg.labelcolor), LV_PART_MAIN);
       lv_obj_set_style_text_color(ui_Player_Label_WiFi, lv_color_hex(msg.wificolor), LV_PART_MAIN);
       break;
 
     case STATUS_WIFI_OPTION:
-      if (msg.status[0] != '\0')//there are wifi in the list
-        lv_dropdown_set_options(ui_MainMenu_Dropdown_NetworkList, msg.status);
+      if (msg.text[0] != '\0')//there are wifi in the list
+        lv_dropdown_set_options(ui_MainMenu_Dropdown_NetworkList, msg.text);
        else
         lv_dropdown_clear_options(ui_MainMenu_Dropdown_NetworkList);
       break;
 
     case STATUS_SDCARD_STATUS:
-       lv_label_set_text(ui_MainMenu_Label_trackCount, msg.status);
+       lv_label_set_text(ui_MainMenu_Label_trackCount, msg.text);
        lv_obj_set_style_text_color(ui_Player_Label_SDcard, lv_color_hex(msg.wificolor), LV_PART_MAIN);
       break;
 
@@ -275,44 +673,57 @@ void process_ui_status_queue() {
 
     } // switch
   } // while
+
+  // 3. deferred UI batches from background tasks, each applied as a whole
+  static uint8_t batch[UI_BATCH_SIZE]; // off the LVGL task stack
+  size_t len;
+  while ((len = xMessageBufferReceive(ui_batch_buffer, batch, sizeof(batch), 0)) > 0) {
+    ui_batch_apply(batch, len);
+    portENTER_CRITICAL(&slot_mux);
+    ui_stats.batches++;
+    portEXIT_CRITICAL(&slot_mux);
+  }
 }
 
 // process audio command
-void process_audio_cmd_que() {
+void process_audio_cmd_que(TickType_t wait) {
+  static uint16_t applied_epoch = 0; // epoch of the last play/stop command executed
   AudioCommandPayload msg;
 
-  while (xQueueReceive(audio_cmd_queue, &msg, 0) == pdTRUE) {
+  // 1. ordered commands
+  while (xQueueReceive(audio_cmd_queue, &msg, wait) == pdTRUE) {
+    wait = 0; // drain the rest without blocking
+    if (msg.cmd != CMD_AUDIO_PAUSE_RESUME && msg.cmd != CMD_AUDIO_WAKE) applied_epoch = msg.epoch;
+    const AudioStrSlot *str = msg.str >= 0 ? &str_pool[msg.str] : NULL;
 
     switch (msg.cmd) {
     //PLAY AUDIO FILE
     case CMD_AUDIO_CONNECT_FS: {
       bool ok = false;
-      UIStatusPayload payload = {
-          .type = STATUS_UPDATE_TRACK_DESC_SET,
-      };
+      resumePosition(audio.stopSong()); // where the previous track ended, before connecttoFS() resets it
       switch (msg.source) {
-      case 0: ok = audio.connecttoFS(SD, msg.url_filename); break;
-      case 1: ok = audio.connecttoFS(LittleFS, msg.url_filename); break;
+      case 0: ok = audio.connecttoFS(SD, str->url, str->startTime); break;
+      case 1: ok = audio.connecttoFS(LittleFS, str->url); break;
       } // switch (msg.source)
       if (!ok) {
-        log_w("Failed to open file: %s", msg.url_filename);
+        log_w("Failed to open file: %s", str->url);
         audio.connecttoFS(LittleFS, "/audio/error.mp3");
-        snprintf(payload.trackDesc, sizeof(payload.trackDesc),"Cannot access music.\nPlease check the SD Card.\nOr Update music library.");  
+        updateTrackDesc("Cannot access music.\nPlease check the SD Card.\nOr Update music library.", false);
       } else {
-        snprintf(payload.trackDesc, sizeof(payload.trackDesc),"");
+        updateTrackDesc("", false);
       }
-      xQueueSend(ui_status_queue, &payload, 100); // send message
+      if (ok && msg.source == 0) resumeTrack(1, trackIndex, str->url);
+      else resumeUntrack(); // system sounds are not resumed
      break;
     }
     //Play URL
     case CMD_AUDIO_CONNECT_HOST: {
-      UIStatusPayload payload = {
-          .type = STATUS_UPDATE_TRACK_DESC_SET,
-      };
       bool ok = false;
+      resumePosition(audio.stopSong());
       if (wifiEnable && WiFi.status() == WL_CONNECTED) {
-        if (audio.connecttohost(msg.url_filename)) {
-            snprintf(payload.trackDesc, sizeof(payload.trackDesc),"%s",msg.stationName);
+        if (audio.connecttohost(str->url)) {
+            updateTrackDesc(str->name, false);
+            resumeTrack(0, stationIndex, NULL);
             ok = true;
          } else {
           ok = false;
@@ -320,25 +731,47 @@ void process_audio_cmd_que() {
       
       } 
       if (!ok) {
-        log_w("Failed to open url: %s", msg.stationName);
+        resumeUntrack();
+        log_w("Failed to open url: %s", str->name);
         audio.connecttoFS(LittleFS, "/audio/error.mp3");
-        snprintf(payload.trackDesc, sizeof(payload.trackDesc),"Network connection unavailable.\nPlease reconnect to continue streaming.");
+        updateTrackDesc("Network connection unavailable.\nPlease reconnect to continue streaming.", false);
       }
-      xQueueSend(ui_status_queue, &payload, 100); // send message
      break;
     }
 
     //OTHER
-    case CMD_AUDIO_STOP_SONG: audio.stopSong(); break;
-    case CMD_AUDIO_SET_VOLUME: audio.setVolume(msg.value); break;
-    case CMD_AUDIO_GET_CUR_TIME: break;
-    case CMD_AUDIO_SET_FILE_POSITION: audio.setAudioFilePosition(msg.value); break;
-    case CMD_AUDIO_SET_PLAY_TIME: audio.setAudioPlayTime(msg.value); break;
-    case CMD_AUDIO_SET_TIME_OFFSET: audio.setTimeOffset(msg.value); break;
-    case CMD_AUDIO_IS_RUNNING: break;
+    case CMD_AUDIO_STOP_SONG:
+      resumePosition(audio.stopSong());
+      resumeUntrack();
+      break;
     case CMD_AUDIO_PAUSE_RESUME: audio.pauseResume(); break;
-    case CMD_AUDIO_GET_FILE_DURATION: break;
+    case CMD_AUDIO_WAKE: break; // slots are applied below
 
     } // switch
+    str_free(msg.str);
   } // while
-}
\ No newline at end of file
+
+  // 2. slots, newest volume and at most one merged seek
+  portENTER_CRITICAL(&cmd_mux);
+  cmd_wake_pending = false;
+  bool set_volume = cmd_volume_dirty;
+  int volume = cmd_volume;
+  cmd_volume_dirty = false;
+  uint8_t seek_kind = SEEK_NONE;
+  int32_t seek_value = 0;
+  if (cmd_seek_kind != SEEK_NONE && cmd_seek_epoch == applied_epoch) { // else its play command is still queued
+    seek_kind = cmd_seek_kind;
+    seek_value = cmd_seek_value;
+    cmd_seek_kind = SEEK_NONE;
+    cmd_stats.seeks++;
+  }
+  portEXIT_CRITICAL(&cmd_mux);
+
+  if (set_volume) audio.setVolume(volume);
+  switch (seek_kind) {
+  case SEEK_OFFSET: if (seek_value != 0) audio.setTimeOffset(seek_value); break;
+  case SEEK_PLAY_TIME: audio.setAudioPlayTime(seek_value); break;
+  case SEEK_FILE_POS: audio.setAudioFilePosition(seek_value); break;
+  default: break;
+  }
+}
@@ -2,70 +2,77 @@
 // global_handles.h (ประกาศ extern ใน Header File)
 
 #include <freertos/FreeRTOS.h>
+#include <freertos/message_buffer.h>
 #include <freertos/queue.h>
 #include <freertos/task.h>
+#include "lvgl.h"
 
 // ----------------------------------------------------
-// A. Command Queue: Audio task message handle
+// A. Audio command channel: audio_loop_task reads it in process_audio_cmd_que()
 // ----------------------------------------------------
+// Commands that must run in order (play, stop, pause) go through audio_cmd_queue.
+// Idempotent commands go to latest value slots: the newest volume wins, seek offsets add up,
+// an absolute seek replaces whatever seek is pending. The audio task runs at most one seek per loop.
+// Paths and station names stay in a small string pool, the queue only carries the pool index.
+#define AUDIO_CMD_QUEUE_LEN 20
+#define AUDIO_STR_POOL_SIZE 6 // pending play commands with a path
+#define AUDIO_URL_LEN 256
+#define AUDIO_NAME_LEN 100
+
 typedef enum {
-  // Audio.loop()
   CMD_AUDIO_CONNECT_FS,
   CMD_AUDIO_CONNECT_HOST,
-  CMD_AUDIO_GET_CUR_TIME,
-  CMD_AUDIO_GET_FILE_DURATION,
   CMD_AUDIO_STOP_SONG,
-  CMD_AUDIO_SET_VOLUME,
-  CMD_AUDIO_SET_FILE_POSITION,
-  CMD_AUDIO_SET_PLAY_TIME,
-  CMD_AUDIO_SET_TIME_OFFSET,
-  CMD_AUDIO_IS_RUNNING,
   CMD_AUDIO_PAUSE_RESUME,
-
-
-
+  CMD_AUDIO_WAKE, // a slot changed, wake the loop task so it applies it
 } AudioCommandType;
 
 typedef struct {
   AudioCommandType cmd;
-  char url_filename[256];//audio source url or filename
-  int value;//for sending interger value back to audio
-  uint8_t source;//audio source 0=SD or 1=LittleFS
-  char stationName[100];
+  uint8_t source; // audio source 0=SD or 1=LittleFS
+  int8_t str; // string pool index, -1 = none
+  uint16_t epoch; // play/stop only: track epoch after this command, a pending seek only applies to its own track
+} AudioCommandPayload;
 
+typedef struct {
+  uint32_t commands; // commands queued
+  uint32_t slot_writes; // volume and seek updates
+  uint32_t slot_coalesced; // updates merged before the audio task applied them
+  uint32_t seeks; // seeks executed
+  uint32_t drops; // queue or string pool full
+} AudioCmdStats;
 
-} AudioCommandPayload;
+void audio_cmd_init();
+AudioCmdStats audio_cmd_get_stats();
 
 extern QueueHandle_t audio_cmd_queue;
 
 // ----------------------------------------------------
-// B. Status Queue: UI task message que handle
+// B. UI status channel: LVGL task reads it in process_ui_status_queue()
 // ----------------------------------------------------
-typedef enum {
+// high rate state (battery, clock, play position, screen lock) goes to latest value slots,
+// a newer value overwrites one the LVGL task has not applied yet.
+// Rare events (text, wifi list) go through a message buffer, only the used part of 'text' is copied.
+#define UI_EVENT_BUFFER_SIZE 2048 // bytes, holds ~8 full wifi lists or ~100 short status lines
+#define UI_EVENT_TEXT_LEN 256
 
-  STATUS_UPDATE_BATTERY_LEVEL, // ✅ เพิ่ม Type นี้
-  STATUS_UPDATE_CLOCK,
-  STATUS_UPDATE_PLAY_POSITION,
-  STATUS_UPDATE_PROGRESS_BAR,
+typedef enum {
   STATUS_UPDATE_TRACK_NUMBER,
   STATUS_UPDATE_TRACK_DESC_SET,
   STATUS_UPDATE_TRACK_DESC_ADD,
-  STATUS_SCREEN_UNLOCK,
-  STATUS_SCREEN_LOCK,
   STATUS_WIFI_CONNECTION,
   STATUS_WIFI_OPTION,
   STATUS_SDCARD_STATUS,
-
-
-
 } UIStatusType;
 
 typedef struct {
   UIStatusType type;
+  uint32_t labelcolor;
+  uint32_t wificolor;
+  char text[UI_EVENT_TEXT_LEN]; // must stay last
+} UIStatusPayload;
 
-  // battery
-  uint8_t battery_state; // battery state(0-4)
-  // rtc
+typedef struct {
   uint8_t hour;
   uint8_t minute;
   uint8_t second;
@@ -73,43 +80,75 @@ typedef struct {
   uint8_t month;
   uint8_t dayOfMonth;
   uint8_t dayOfWeek;
-  // audio status
-  char elapse_buf[16];
-  char remain_buf[16];
-  uint32_t current_pos;
-  uint32_t total;//track length
-  char trackNumber[12];// 1/12
-  char trackDesc[100]; 
-  //wifi
-  char status[256];
-  uint32_t labelcolor;
-  uint32_t wificolor;
-
+} UIClock;
 
+typedef struct {
+  uint32_t slot_writes; // state updates published
+  uint32_t slot_coalesced; // updates replaced before the LVGL task applied them
+  uint32_t events; // messages through the event buffer
+  uint32_t event_drops; // event buffer full
+  uint32_t batches; // deferred UI batches applied
+  uint32_t batch_drops; // batch buffer full
+} UIChannelStats;
 
+void ui_status_init();
+UIChannelStats ui_status_get_stats();
 
+// ----------------------------------------------------
+// C. Deferred UI updates: background tasks never call lv_* themselves
+// ----------------------------------------------------
+// A task collects widget changes in a UIBatch, ui_batch_commit() hands the whole list to the LVGL task,
+// which applies it in one go inside process_ui_status_queue() under the LVGL lock (no half updated panel on screen).
+// A full batch is committed automatically and a new one started. Called from the LVGL task the batch is applied at once.
+// Image sources must stay valid until applied (static or atlas tiles).
+// ui_async_call() replaces lv_async_call() off the LVGL task, lv_async_call() itself is not thread safe.
+#define UI_BATCH_SIZE 1024 // bytes of one batch, ~900 bytes of text
+#define UI_BATCH_BUFFER_SIZE 4096
+#define UI_CALL_TEXT_LEN 96 // text passed along with ui_async_call()
 
-} UIStatusPayload;
+typedef void (*ui_call_cb_t)(void *param, const char *text); // runs in the LVGL task, text is only valid during the call
 
-extern QueueHandle_t ui_status_queue;
+typedef struct {
+  TickType_t wait; // how long a full batch buffer may block the caller
+  uint16_t len;
+  uint8_t data[UI_BATCH_SIZE];
+} UIBatch;
+
+void ui_batch_begin(UIBatch &batch, TickType_t wait);
+void ui_batch_label(UIBatch &batch, lv_obj_t *obj, const char *text);
+void ui_batch_textarea(UIBatch &batch, lv_obj_t *obj, const char *text, bool append);
+void ui_batch_img(UIBatch &batch, lv_obj_t *obj, const void *src); // NULL clears the image
+void ui_batch_bg_color(UIBatch &batch, lv_obj_t *obj, uint32_t color);
+void ui_batch_bg_grad_color(UIBatch &batch, lv_obj_t *obj, uint32_t color);
+void ui_batch_call(UIBatch &batch, ui_call_cb_t cb, void *param, const char *text = NULL);
+bool ui_batch_commit(UIBatch &batch);
+bool ui_async_call(ui_call_cb_t cb, void *param, const char *text = NULL, TickType_t wait = 100); // a batch of one call
 
 //message queue sender functions
 void updateSDCARDStatus(const char *status,  const uint32_t wifiColor);
 void updateWiFiStatus(const char *status, const uint32_t labelColor, const uint32_t wifiColor);
 void updateWiFiOption(const char *status);
+void updateBatteryLevel(uint8_t state);
+void updateClock(const UIClock &clock);
+void updatePlayPosition(uint32_t pos, uint32_t total);
+void updateProgressBar(uint32_t total);
+void updateScreenLock(bool locked);
+void updateTrackNumber(const char *trackNumber);
+void updateTrackDesc(const char *desc, bool append);
+void timeStr(char *buffer, size_t size, uint32_t second);
 void audioSetAudioFilePosition(uint16_t pos);
 void audioSetPlayTime(uint16_t pos);
 void audioStopSong();
 void audioPauseResume();
 void audioSetTimeOffset(int offset);
 void audioSetVolume(int volume);
-void audioPlayFS(uint8_t source, const char *filename);
+void audioPlayFS(uint8_t source, const char *filename, int32_t startTime = -1); // startTime: seconds, SD tracks only
 void audioPlayHOST(const char *filename, const char *stationName);
 
 
 //Process queue in rtos task
-void process_ui_status_queue(); 
-void process_audio_cmd_que();
+void process_ui_status_queue(); // apply changed slots, then drain the event and batch buffers
+void process_audio_cmd_que(TickType_t wait = 0); // blocks up to wait ticks for the first command
 
 extern bool seeking_now;
 
@@ -1,124 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/numbers/3.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_numbers_3_png_data[]  = {
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x40,0xFF,0x10,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x30,0x80,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0xA0,0xFF,0x28,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x49,0x00,0xFF,0x51,0x00,0xFF,0x48,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x59,0x20,0xFF,0x59,0x00,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x69,0x60,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x69,0x60,0xFF,0x51,0x00,0xFF,0x48,0xC0,0xFF,0x48,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xC0,0xFF,0x38,0x80,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x71,0x80,0xFF,0x71,0x80,0xFF,0x61,0x20,0xFF,0x71,0x60,0xFF,0x81,0xC0,0xFF,0x79,0xA0,0xFF,0x71,0x80,0xFF,0x71,0xA0,0xFF,0x71,0x80,0xFF,0x71,0x60,0xFF,0x79,0xA0,0xFF,0x71,0x80,0xFF,0x61,0x20,0xFF,0x69,0x60,0xFF,0x69,0x60,0xFF,0x51,0x00,0xFF,0x48,0xE0,0xFF,0x50,0xE0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x30,0x80,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x79,0x80,0xFF,0x79,0xA0,0xFF,0x81,0xE0,0xFF,0x8A,0x00,0xFF,0x92,0x02,0xFF,0x89,0xC2,0xFF,0x81,0xA2,0xFF,0x92,0x22,0xFF,0xA2,0x42,0xFF,0x91,0xE2,0xFF,0x81,0x81,0xFF,0x81,0xA1,0xFF,0x79,0x80,0xFF,0x81,0xA0,0xFF,0x81,0xC0,0xFF,0x69,0x20,0xFF,0x58,0xE0,0xFF,0x59,0x00,0xFF,0x51,0x00,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x30,0x80,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x61,0x20,0xFF,0x79,0x80,0xFF,0x79,0xA0,0xFF,0x81,0xC1,0xFF,0x92,0x02,0xFF,0x91,0xE3,0xFF,0xA2,0x43,0xFF,0xAA,0x63,0xFF,0xB2,0x20,0xFF,0xBA,0x60,0xFF,0xBA,0x40,0xFF,0xBA,0x40,0xFF,0xC2,0x80,0xFF,0xB2,0x40,0xFF,0xB2,0x60,0xFF,0xC2,0xA0,0xFF,0xAA,0x43,0xFF,0x91,0xC3,0xFF,0x89,0xA2,0xFF,0x81,0xA1,0xFF,0x81,0xC0,0xFF,0x81,0xA0,0xFF,0x61,0x20,0xFF,0x50,0xE0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x30,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x61,0x20,0xFF,0x71,0x60,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x81,0xC2,0xFF,0x9A,0x03,0xFF,0xAA,0x63,0xFF,0xBA,0xA0,0xFF,0xCA,0xE0,0xFF,0xCA,0xC0,0xFF,0xCA,0xC0,0xFF,0xD3,0xE0,0xFF,0xDC,0xA6,0xFF,0xDC,0x43,0xFF,0xDC,0x43,0xFF,0xDC,0xC7,0xFF,0xDC,0x20,0xFF,0xDC,0x40,0xFF,0xE4,0x40,0xFF,0xD3,0x20,0xFF,0xBA,0xA0,0xFF,0xB2,0x80,0xFF,0xA2,0x23,0xFF,0x9A,0x23,0xFF,0x92,0x22,0xFF,0x79,0x80,0xFF,0x69,0x40,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x51,0x00,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x40,0xC0,0xFF,0x59,0x20,0xFF,0x69,0x40,0xFF,0x69,0x40,0xFF,0x81,0xC0,0xFF,0xA2,0x63,0xFF,0xA2,0x44,0xFF,0xAA,0x00,0xFF,0xCB,0x20,0xFF,0xD3,0x60,0xFF,0xDC,0x60,0xFF,0xED,0x8B,0xFF,0xE5,0x6C,0xFF,0xE5,0xAD,0xFF,0xEE,0x93,0xFF,0xE6,0xF6,0xFF,0xEE,0xD5,0xFF,0xEE,0xD5,0xFF,0xEE,0xF7,0xFF,0xEE,0xB4,0xFF,0xEE,0x93,0xFF,0xEE,0x53,0xFF,0xE5,0x6C,0xFF,0xE5,0x49,0xFF,0xE4,0xC7,0xFF,0xCB,0x40,0xFF,0xB2,0x60,0xFF,0xA2,0x22,0xFF,0x92,0x03,0xFF,0x92,0x22,0xFF,0x81,0xE0,0xFF,0x61,0x20,0xFF,0x59,0x00,0xFF,0x48,0xC0,0xFF,0x48,0xE0,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x38,0xA0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x79,0x80,0xFF,0x89,0xE0,0xFF,0x8A,0x03,0xFF,0xA2,0x23,0xFF,0xC2,0xA0,0xFF,0xC3,0x00,0xFF,0xDC,0x64,0xFF,0xED,0xAC,0xFF,0xE6,0x0F,0xFF,0xE6,0xB4,0xFF,0xEF,0x59,0xFF,0xEF,0x59,0xFF,0xEF,0x78,0xFF,0xE7,0x59,0xFF,0xEF,0x59,0xFF,0xEF,0x58,0xFF,0xEF,0x37,0xFF,0xEF,0x39,0xFF,0xF7,0x58,0xFF,0xEF,0x59,0xFF,0xEF,0x7A,0xFF,0xF7,0x77,0xFF,0xEF,0x58,0xFF,0xEE,0xF5,0xFF,0xE5,0xCD,0xFF,0xE5,0x07,0xFF,0xD4,0x00,0xFF,0xB2,0x60,0xFF,0x99,0xC2,0xFF,0x89,0xC2,0xFF,0x81,0xA0,0xFF,0x79,0x80,0xFF,0x61,0x20,0xFF,0x59,0x00,0xFF,0x51,0x00,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x51,0x00,0xFF,0x69,0x40,0xFF,0x69,0x40,0xFF,0x81,0xC1,0xFF,0xA2,0x23,0xFF,0xA9,0xC0,0xFF,0xCB,0x20,0xFF,0xE4,0xC6,0xFF,0xE5,0xAD,0xFF,0xEE,0xD6,0xFF,0xEF,0x59,0xFF,0xEF,0x78,0xFF,0xE7,0x58,0xFF,0xE7,0x17,0xFF,0xE6,0xB4,0xFF,0xEE,0x71,0xFF,0xE6,0x0E,0xFF,0xE5,0xCC,0xFF,0xE5,0x49,0xFF,0xE5,0x28,0xFF,0xE5,0x8B,0xFF,0xDD,0x6A,0xFF,0xE5,0xEE,0xFF,0xEE,0x71,0xFF,0xEE,0x92,0xFF,0xEF,0x16,0xFF,0xEF,0x58,0xFF,0xEF,0x55,0xFF,0xEF,0x15,0xFF,0xEE,0x93,0xFF,0xDD,0x09,0xFF,0xC3,0x20,0xFF,0xB2,0x80,0xFF,0x9A,0x23,0xFF,0x89,0xE1,0xFF,0x79,0x60,0xFF,0x69,0x20,0xFF,0x50,0xE0,0xFF,0x48,0xC0,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x48,0xE0,0xFF,0x71,0x60,0xFF,0x89,0xC3,0xFF,0xA2,0x02,0xFF,0xC3,0x00,0xFF,0xD4,0x42,0xFF,0xE5,0xCF,0xFF,0xEE,0xF6,0xFF,0xEF,0x58,0xFF,0xEF,0x79,0xFF,0xEE,0xF7,0xFF,0xE6,0x30,0xFF,0xE5,0xCC,0xFF,0xE5,0x47,0xFF,0xD4,0x00,0xFF,0xD3,0x80,0xFF,0xDB,0xE0,0xFF,0xD3,0xC0,0xFF,0xC2,0xC0,0xFF,0xCB,0x00,0xFF,0xD3,0x40,0xFF,0xCB,0x00,0xFF,0xD3,0x80,0xFF,0xD3,0xE0,0xFF,0xCB,0xA0,0xFF,0xDC,0xC4,0xFF,0xE5,0x8B,0xFF,0xE5,0xEE,0xFF,0xE6,0xF5,0xFF,0xE7,0x79,0xFF,0xEF,0x17,0xFF,0xEE,0x0F,0xFF,0xE5,0x06,0xFF,0xC3,0x00,0xFF,0x99,0xC2,0xFF,0x91,0xC0,0xFF,0x89,0xA0,0xFF,0x71,0x40,0xFF,0x61,0x20,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x48,0xC0,0xFF,0x61,0x20,0xFF,0x79,0x61,0xFF,0xA1,0xC0,0xFF,0xC3,0x80,0xFF,0xDD,0x8C,0xFF,0xEE,0xF6,0xFF,0xEF,0x9B,0xFF,0xEF,0x58,0xFF,0xE6,0x52,0xFF,0xE5,0xCD,0xFF,0xDC,0xC5,0xFF,0xCB,0x80,0xFF,0xD3,0x40,0xFF,0xCB,0x00,0xFF,0xC2,0xA2,0xFF,0xBA,0x64,0xFF,0xB2,0x83,0xFF,0xBA,0xC3,0xFF,0xAA,0x63,0xFF,0xA2,0x43,0xFF,0xB2,0xA3,0xFF,0xAA,0xA4,0xFF,0xB2,0x83,0xFF,0xBA,0xA3,0xFF,0xB2,0x83,0xFF,0xB2,0x80,0xFF,0xC2,0xE0,0xFF,0xCB,0x20,0xFF,0xDC,0xA6,0xFF,0xE6,0x0F,0xFF,0xEE,0xD5,0xFF,0xEF,0x58,0xFF,0xEE,0xF6,0xFF,0xE5,0xAC,0xFF,0xCB,0x80,0xFF,0xBA,0x84,0xFF,0xA2,0x42,0xFF,0x89,0x80,0xFF,0x69,0x20,0xFF,0x59,0x20,0xFF,0x49,0x00,0xFF,0x38,0xC0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x59,0x20,0xFF,0x81,0xC2,0xFF,0x9A,0x20,0xFF,0xC4,0x46,0xFF,0xE6,0x73,0xFF,0xEF,0x59,0xFF,0xEF,0x58,0xFF,0xEE,0xD4,0xFF,0xE5,0xAC,0xFF,0xC3,0xA0,0xFF,0xC2,0xE0,0xFF,0xC2,0xC0,0xFF,0xB2,0x83,0xFF,0xBA,0xE4,0xFF,0xBB,0x03,0xFF,0xB2,0xC2,0xFF,0xA2,0x61,0xFF,0x91,0xE0,0xFF,0x9A,0x20,0xFF,0x9A,0x20,0xFF,0x9A,0x20,0xFF,0x9A,0x20,0xFF,0x91,0xE0,0xFF,0x9A,0x21,0xFF,0xAA,0xA1,0xFF,0xAA,0x81,0xFF,0xA2,0x42,0xFF,0xB2,0xA3,0xFF,0xB2,0xC3,0xFF,0xBA,0x60,0xFF,0xD3,0x80,0xFF,0xDC,0xC4,0xFF,0xE6,0x72,0xFF,0xEF,0x9C,0xFF,0xF7,0x9A,0xFF,0xED,0xCC,0xFF,0xD3,0xA0,0xFF,0xB2,0x62,0xFF,0x99,0xE0,0xFF,0x81,0x80,0xFF,0x69,0x20,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x59,0x62,0xFF,0x78,0xC0,0xFF,0xAB,0x60,0xFF,0xE6,0xB5,0xFF,0xEF,0xBC,0xFF,0xEE,0xF6,0xFF,0xDD,0x6A,0xFF,0xD4,0x20,0xFF,0xCB,0x40,0xFF,0xB2,0x62,0xFF,0xAA,0x23,0xFF,0xAA,0x83,0xFF,0xAA,0x81,0xFF,0xAA,0xA1,0xFF,0xAA,0x81,0xFF,0x9A,0x20,0xFF,0x91,0xE0,0xFF,0x92,0x00,0xFF,0x89,0xE0,0xFF,0x81,0xC0,0xFF,0x89,0xE0,0xFF,0x81,0xC0,0xFF,0x81,0xA0,0xFF,0x89,0xE0,0xFF,0x92,0x00,0xFF,0x92,0x00,0xFF,0x91,0xE0,0xFF,0x9A,0x40,0xFF,0xA2,0x61,0xFF,0xA2,0x23,0xFF,0xBA,0xE4,0xFF,0xCB,0x40,0xFF,0xDC,0x60,0xFF,0xEE,0x92,0xFF,0xF7,0x79,0xFF,0xEF,0x17,0xFF,0xEE,0x0E,0xFF,0xD4,0x04,0xFF,0xB2,0x62,0xFF,0xAA,0x61,0xFF,0x81,0xA0,0xFF,0x61,0x20,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,
-    0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x30,0xA0,0xFF,0x40,0xC0,0xFF,0x49,0x22,0xFF,0x60,0x40,0xFF,0xA3,0x20,0xFF,0xDE,0x73,0xFF,0xE6,0xD5,0xFF,0xD4,0xC7,0xFF,0xBA,0xC0,0xFF,0xAA,0x41,0xFF,0xAA,0x63,0xFF,0xA2,0x62,0xFF,0x9A,0x41,0xFF,0x8A,0x00,0xFF,0x92,0x00,0xFF,0x92,0x00,0xFF,0x89,0xE0,0xFF,0x81,0xC0,0xFF,0x79,0xA0,0xFF,0x81,0xC0,0xFF,0x79,0xA0,0xFF,0x69,0x60,0xFF,0x69,0x60,0xFF,0x69,0x60,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x79,0xA0,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x89,0xC0,0xFF,0x89,0xC0,0xFF,0xA2,0x61,0xFF,0xBA,0xC3,0xFF,0xCB,0x21,0xFF,0xE4,0x80,0xFF,0xE6,0x0E,0xFF,0xEF,0x9B,0xFF,0xF7,0x9A,0xFF,0xED,0xED,0xFF,0xCB,0x20,0xFF,0xAA,0x43,0xFF,0x89,0xA0,0xFF,0x71,0x60,0xFF,0x61,0x40,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,
-    0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x49,0x00,0xFF,0x61,0x81,0xFF,0x8A,0x21,0xFF,0xBB,0xA3,0xFF,0xCB,0xE0,0xFF,0xBA,0xC0,0xFF,0xA2,0x22,0xFF,0xA2,0x63,0xFF,0x9A,0x41,0xFF,0x81,0xC0,0xFF,0x81,0xC0,0xFF,0x81,0xC0,0xFF,0x81,0xE0,0xFF,0x8A,0x21,0xFF,0x8A,0x01,0xFF,0x79,0xA0,0xFF,0x71,0x80,0xFF,0x71,0x80,0xFF,0x71,0x80,0xFF,0x69,0x40,0xFF,0x69,0x40,0xFF,0x69,0x60,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x71,0xA0,0xFF,0x71,0x80,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x81,0xC0,0xFF,0x81,0xC0,0xFF,0x92,0x00,0xFF,0xA2,0x60,0xFF,0xAA,0xA2,0xFF,0xCB,0x41,0xFF,0xDC,0x80,0xFF,0xEE,0xD4,0xFF,0xF7,0xBC,0xFF,0xF7,0x16,0xFF,0xDC,0xA1,0xFF,0xBA,0xA1,0xFF,0x99,0xE1,0xFF,0x81,0x80,0xFF,0x69,0x60,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x10,0x20,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xC0,0xFF,0x30,0x80,0xFF,0x40,0xE0,0xFF,0x61,0x60,0xFF,0x71,0xA1,0xFF,0x81,0xA0,0xFF,0x91,0xC0,0xFF,0x92,0x02,0xFF,0x92,0x21,0xFF,0x9A,0x40,0xFF,0x8A,0x01,0xFF,0x79,0xA0,0xFF,0x81,0xC0,0xFF,0x79,0xC0,0xFF,0x79,0xC0,0xFF,0x8A,0x21,0xFF,0x82,0x01,0xFF,0x71,0xA0,0xFF,0x71,0x80,0xFF,0x69,0x80,0xFF,0x69,0x80,0xFF,0x61,0x60,0xFF,0x69,0x80,0xFF,0x69,0x80,0xFF,0x69,0x60,0xFF,0x69,0x80,0xFF,0x71,0xA0,0xFF,0x71,0xA0,0xFF,0x71,0x80,0xFF,0x71,0xA0,0xFF,0x79,0xC0,0xFF,0x81,0xC0,0xFF,0x92,0x20,0xFF,0xA2,0x61,0xFF,0xAA,0x81,0xFF,0xCB,0x43,0xFF,0xD3,0x61,0xFF,0xE4,0x82,0xFF,0xEE,0xD4,0xFF,0xF7,0xBB,0xFF,0xEE,0x51,0xFF,0xD4,0x20,0xFF,0xB2,0xA3,0xFF,0x92,0x01,0xFF,0x61,0x20,0xFF,0x59,0x20,0xFF,0x51,0x20,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,
-    0x08,0x20,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x38,0xC0,0xFF,0x49,0x20,0xFF,0x51,0x20,0xFF,0x59,0x41,0xFF,0x69,0x82,0xFF,0x69,0x80,0xFF,0x69,0x80,0xFF,0x69,0x80,0xFF,0x69,0x60,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x61,0x60,0xFF,0x69,0x60,0xFF,0x69,0x80,0xFF,0x69,0x80,0xFF,0x61,0x60,0xFF,0x59,0x40,0xFF,0x59,0x20,0xFF,0x59,0x20,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x61,0x80,0xFF,0x69,0x80,0xFF,0x61,0x60,0xFF,0x61,0x60,0xFF,0x69,0x80,0xFF,0x71,0xA0,0xFF,0x79,0xC0,0xFF,0x89,0xE0,0xFF,0x9A,0x40,0xFF,0xB2,0xE1,0xFF,0xBA,0xC2,0xFF,0xCA,0xE0,0xFF,0xED,0x8B,0xFF,0xF7,0x9A,0xFF,0xF7,0x58,0xFF,0xDD,0x28,0xFF,0xAA,0x20,0xFF,0x8A,0x03,0xFF,0x71,0x80,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x20,0x40,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x49,0x20,0xFF,0x51,0x40,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x59,0x20,0xFF,0x59,0x20,0xFF,0x49,0x00,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x59,0x60,0xFF,0x59,0x60,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x59,0x60,0xFF,0x61,0x60,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x8A,0x00,0xFF,0x9A,0x40,0xFF,0xA2,0x62,0xFF,0xBA,0xC1,0xFF,0xDC,0x22,0xFF,0xEE,0xD4,0xFF,0xF7,0x99,0xFF,0xE5,0xCD,0xFF,0xB2,0x00,0xFF,0x92,0x04,0xFF,0x8A,0x00,0xFF,0x69,0x60,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xE0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x41,0x00,0xFF,0x49,0x20,0xFF,0x51,0x40,0xFF,0x59,0x40,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x59,0x40,0xFF,0x59,0x20,0xFF,0x61,0x60,0xFF,0x69,0xA0,0xFF,0x81,0xE0,0xFF,0x92,0x20,0xFF,0x92,0x21,0xFF,0xB2,0xE2,0xFF,0xCB,0x00,0xFF,0xE5,0xEE,0xFF,0xF7,0xBA,0xFF,0xEE,0xB4,0xFF,0xD3,0xE0,0xFF,0xA9,0xE2,0xFF,0x8A,0x02,0xFF,0x69,0x40,0xFF,0x59,0x20,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x80,0xFF,0x28,0xA0,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x41,0x00,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x59,0x40,0xFF,0x61,0x80,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x81,0xE0,0xFF,0xA2,0x62,0xFF,0xC2,0xC0,0xFF,0xED,0x6B,0xFF,0xF7,0x9A,0xFF,0xEF,0x38,0xFF,0xDC,0xC6,0xFF,0xB2,0x00,0xFF,0x8A,0x03,0xFF,0x61,0x20,0xFF,0x59,0x00,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x38,0xE0,0xFF,0x40,0xE0,0xFF,0x49,0x00,0xFF,0x51,0x40,0xFF,0x51,0x40,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x71,0x80,0xFF,0x81,0xE0,0xFF,0x81,0xC0,0xFF,0x9A,0x22,0xFF,0xB2,0x40,0xFF,0xDC,0x65,0xFF,0xF7,0x57,0xFF,0xF7,0x57,0xFF,0xD4,0x60,0xFF,0xB2,0x20,0xFF,0x9A,0x42,0xFF,0x79,0x80,0xFF,0x61,0x40,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xE0,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xC0,0xFF,0x30,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xE0,0xFF,0x38,0xE0,0xFF,0x40,0xE0,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x69,0x80,0xFF,0x81,0xE0,0xFF,0x81,0xC0,0xFF,0x92,0x22,0xFF,0xB2,0x40,0xFF,0xD4,0x02,0xFF,0xF7,0x36,0xFF,0xF7,0x99,0xFF,0xDD,0x2A,0xFF,0xBA,0x40,0xFF,0xA2,0x64,0xFF,0x81,0xC0,0xFF,0x69,0x60,0xFF,0x48,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0xA0,0xFF,0x38,0xE0,0xFF,0x38,0xE0,0xFF,0x30,0xA0,0xFF,0x28,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xC0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x49,0x20,0xFF,0x51,0x00,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x51,0x00,0xFF,0x51,0x20,0xFF,0x59,0x40,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x79,0x80,0xFF,0x9A,0x42,0xFF,0xBA,0x60,0xFF,0xD4,0x24,0xFF,0xEF,0x17,0xFF,0xF7,0x9B,0xFF,0xE5,0xEF,0xFF,0xBA,0x80,0xFF,0x9A,0x24,0xFF,0x71,0x80,0xFF,0x59,0x00,0xFF,0x49,0x00,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0xA0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0xA0,0xFF,0x28,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x59,0x40,0xFF,0x61,0x60,0xFF,0x71,0xA0,0xFF,0x8A,0x00,0xFF,0x81,0xC0,0xFF,0x92,0x02,0xFF,0xB2,0x40,0xFF,0xD3,0xA0,0xFF,0xF6,0xB3,0xFF,0xF7,0x56,0xFF,0xDD,0x29,0xFF,0xB2,0x40,0xFF,0x9A,0x23,0xFF,0x79,0xA0,0xFF,0x61,0x20,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x40,0xE0,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x51,0x20,0xFF,0x59,0x40,0xFF,0x61,0x60,0xFF,0x71,0x80,0xFF,0x89,0xE0,0xFF,0x89,0xE0,0xFF,0x92,0x01,0xFF,0xB2,0x60,0xFF,0xDC,0x24,0xFF,0xF6,0xF4,0xFF,0xF7,0x36,0xFF,0xDC,0xC6,0xFF,0xB2,0x00,0xFF,0x9A,0x43,0xFF,0x81,0xC0,0xFF,0x69,0x60,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xC0,0xFF,0x30,0xC0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x51,0x20,0xFF,0x61,0x40,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x81,0xC0,0xFF,0x91,0xE0,0xFF,0xAA,0x62,0xFF,0xC2,0xA0,0xFF,0xDC,0xC8,0xFF,0xF7,0x79,0xFF,0xF7,0x59,0xFF,0xDD,0x2A,0xFF,0xB1,0xE0,0xFF,0x92,0x24,0xFF,0x69,0x60,0xFF,0x59,0x20,0xFF,0x48,0xE0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x28,0x80,0xFF,0x30,0xC0,0xFF,0x30,0xC0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x40,0xC0,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x59,0x20,0xFF,0x61,0x60,0xFF,0x69,0x80,0xFF,0x81,0xC0,0xFF,0x9A,0x40,0xFF,0x9A,0x00,0xFF,0xB2,0x62,0xFF,0xC2,0xC0,0xFF,0xE5,0x09,0xFF,0xF7,0x78,0xFF,0xEF,0x16,0xFF,0xD4,0xA6,0xFF,0xA9,0xE0,0xFF,0x82,0x03,0xFF,0x69,0x40,0xFF,0x59,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x10,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x30,0xC0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xE0,0xFF,0x51,0x20,0xFF,0x51,0x40,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x59,0x20,0xFF,0x59,0x20,0xFF,0x61,0x60,0xFF,0x71,0xA0,0xFF,0x89,0xE0,0xFF,0x9A,0x41,0xFF,0xA2,0x41,0xFF,0xBA,0xE1,0xFF,0xD3,0xA0,0xFF,0xEE,0x10,0xFF,0xF7,0x99,0xFF,0xEE,0x50,0xFF,0xC3,0x20,0xFF,0xA2,0x04,0xFF,0x81,0xC0,0xFF,0x71,0x80,0xFF,0x61,0x40,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x30,0xC0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x49,0x00,0xFF,0x51,0x00,0xFF,0x59,0x40,0xFF,0x61,0x40,0xFF,0x69,0x60,0xFF,0x71,0xA0,0xFF,0x81,0xC0,0xFF,0x92,0x00,0xFF,0xAA,0x61,0xFF,0xCB,0x20,0xFF,0xE4,0x85,0xFF,0xF7,0x37,0xFF,0xF7,0xDC,0xFF,0xEE,0x30,0xFF,0xC2,0xE0,0xFF,0xA2,0x44,0xFF,0x81,0xE0,0xFF,0x61,0x40,0xFF,0x59,0x20,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x48,0xE0,0xFF,0x59,0x60,0xFF,0x61,0x60,0xFF,0x51,0x20,0xFF,0x59,0x20,0xFF,0x61,0x60,0xFF,0x69,0x60,0xFF,0x71,0xA0,0xFF,0x81,0xE0,0xFF,0x92,0x00,0xFF,0xAA,0x61,0xFF,0xBA,0xC2,0xFF,0xCB,0x00,0xFF,0xE5,0x6B,0xFF,0xF7,0x99,0xFF,0xF7,0x59,0xFF,0xE5,0x6C,0xFF,0xBA,0x80,0xFF,0xA2,0x63,0xFF,0x79,0xC0,0xFF,0x59,0x00,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x60,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x40,0xC0,0xFF,0x51,0x00,0xFF,0x61,0x60,0xFF,0x69,0x60,0xFF,0x61,0x20,0xFF,0x69,0x60,0xFF,0x79,0xA0,0xFF,0x79,0x80,0xFF,0x81,0xC0,0xFF,0x9A,0x41,0xFF,0xA2,0x20,0xFF,0xB2,0xA2,0xFF,0xC3,0x22,0xFF,0xDC,0x65,0xFF,0xEE,0xB4,0xFF,0xEF,0x78,0xFF,0xEE,0x2E,0xFF,0xCB,0x60,0xFF,0xAA,0x23,0xFF,0x89,0xE0,0xFF,0x71,0x80,0xFF,0x69,0x60,0xFF,0x51,0x00,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x28,0x60,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x69,0x80,0xFF,0x71,0x80,0xFF,0x69,0x40,0xFF,0x79,0x80,0xFF,0x89,0xE0,0xFF,0x89,0xC0,0xFF,0x89,0xC0,0xFF,0xA2,0x20,0xFF,0xA2,0x40,0xFF,0xB2,0x83,0xFF,0xD3,0xA0,0xFF,0xEE,0x0F,0xFF,0xEF,0x9A,0xFF,0xEF,0x37,0xFF,0xDD,0x06,0xFF,0xBA,0x60,0xFF,0xA2,0x63,0xFF,0x81,0xA0,0xFF,0x69,0x40,0xFF,0x61,0x40,0xFF,0x49,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x00,0xFF,0x59,0x00,0xFF,0x61,0x20,0xFF,0x79,0xA0,0xFF,0x81,0xE0,0xFF,0x81,0xA0,0xFF,0x81,0xA0,0xFF,0x89,0xE0,0xFF,0x91,0xE0,0xFF,0xAA,0x60,0xFF,0xBB,0x02,0xFF,0xBA,0xA3,0xFF,0xD3,0x80,0xFF,0xE5,0x49,0xFF,0xEF,0x16,0xFF,0xEF,0x78,0xFF,0xE6,0x0F,0xFF,0xCB,0xC3,0xFF,0xB2,0x82,0xFF,0xA2,0x61,0xFF,0x79,0x80,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x50,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x00,0xFF,0x61,0x00,0xFF,0x69,0x40,0xFF,0x79,0x80,0xFF,0x89,0xC0,0xFF,0x92,0x00,0xFF,0x91,0xE0,0xFF,0x9A,0x00,0xFF,0xAA,0x60,0xFF,0xAA,0x60,0xFF,0xC3,0x03,0xFF,0xCB,0x44,0xFF,0xDB,0x80,0xFF,0xED,0xAC,0xFF,0xEF,0x17,0xFF,0xEF,0x79,0xFF,0xE6,0x4F,0xFF,0xD3,0xE0,0xFF,0xB2,0x60,0xFF,0xA2,0x40,0xFF,0x89,0xA0,0xFF,0x69,0x40,0xFF,0x61,0x40,0xFF,0x49,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x40,0xE0,0xFF,0x40,0xC0,0xFF,0x48,0xC0,0xFF,0x59,0x20,0xFF,0x69,0x40,0xFF,0x71,0x60,0xFF,0x71,0x40,0xFF,0x81,0xA0,0xFF,0x89,0xC0,0xFF,0x91,0xE0,0xFF,0xA2,0x40,0xFF,0xAA,0x60,0xFF,0xA2,0x20,0xFF,0xB2,0x81,0xFF,0xC2,0xE2,0xFF,0xC2,0xC3,0xFF,0xD3,0x42,0xFF,0xE4,0x83,0xFF,0xED,0xAB,0xFF,0xEF,0x17,0xFF,0xEF,0xBB,0xFF,0xEF,0x14,0xFF,0xDC,0xA3,0xFF,0xC2,0xC0,0xFF,0xAA,0x41,0xFF,0x89,0xA0,0xFF,0x69,0x40,0xFF,0x61,0x20,0xFF,0x59,0x40,0xFF,0x49,0x00,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0xA0,0xFF,0x38,0xC0,0xFF,0x48,0xE0,0xFF,0x50,0xE0,0xFF,0x59,0x00,0xFF,0x69,0x40,0xFF,0x79,0x80,0xFF,0x89,0xE0,0xFF,0x89,0xA0,0xFF,0xA2,0x20,0xFF,0xAA,0x40,0xFF,0xAA,0x20,0xFF,0xBA,0xE2,0xFF,0xC3,0x22,0xFF,0xBA,0xC2,0xFF,0xC2,0xA2,0xFF,0xCB,0x01,0xFF,0xDB,0xA0,0xFF,0xE4,0xE6,0xFF,0xEE,0xB3,0xFF,0xEF,0x79,0xFF,0xEF,0x9A,0xFF,0xE6,0xB2,0xFF,0xDD,0x07,0xFF,0xC2,0xE0,0xFF,0xBA,0xA2,0xFF,0xA2,0x40,0xFF,0x81,0xA0,0xFF,0x79,0x80,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x59,0x20,0xFF,0x79,0xA0,0xFF,0x79,0x60,0xFF,0x89,0xC1,0xFF,0xA2,0x42,0xFF,0xAA,0x62,0xFF,0xB2,0x82,0xFF,0xBA,0x62,0xFF,0xC2,0x62,0xFF,0xCA,0xC1,0xFF,0xD3,0x60,0xFF,0xD3,0xA0,0xFF,0xE4,0x82,0xFF,0xE5,0x07,0xFF,0xE6,0x2F,0xFF,0xEF,0x17,0xFF,0xEF,0x9B,0xFF,0xEF,0x58,0xFF,0xEE,0x6F,0xFF,0xDC,0xC0,0xFF,0xCB,0x60,0xFF,0xB2,0x81,0xFF,0xAA,0x40,0xFF,0x92,0x00,0xFF,0x81,0xA0,0xFF,0x71,0x60,0xFF,0x59,0x20,0xFF,0x49,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0xA0,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x48,0xE0,0xFF,0x61,0x40,0xFF,0x81,0xC0,0xFF,0x92,0x01,0xFF,0xAA,0x40,0xFF,0xBA,0x80,0xFF,0xC2,0x80,0xFF,0xCA,0xE0,0xFF,0xDB,0xE0,0xFF,0xDB,0xC0,0xFF,0xE4,0x84,0xFF,0xED,0x48,0xFF,0xE5,0xED,0xFF,0xEE,0xF5,0xFF,0xEF,0x37,0xFF,0xEF,0x99,0xFF,0xEF,0x99,0xFF,0xEE,0xD3,0xFF,0xE5,0xCA,0xFF,0xD4,0x00,0xFF,0xCB,0x20,0xFF,0xCB,0x63,0xFF,0xB2,0xC0,0xFF,0x9A,0x00,0xFF,0x89,0xC0,0xFF,0x79,0x80,0xFF,0x69,0x40,0xFF,0x59,0x00,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xC0,0xFF,0x40,0xC0,0xFF,0x59,0x40,0xFF,0x61,0x40,0xFF,0x81,0x80,0xFF,0xB2,0xE0,0xFF,0xD4,0xA7,0xFF,0xE5,0x29,0xFF,0xE4,0xE8,0xFF,0xED,0x8C,0xFF,0xEE,0x2F,0xFF,0xEE,0x91,0xFF,0xF7,0x36,0xFF,0xF7,0x58,0xFF,0xEF,0x9A,0xFF,0xF7,0xDE,0xFF,0xF7,0xBC,0xFF,0xEE,0xF4,0xFF,0xEE,0x0C,0xFF,0xDC,0xA0,0xFF,0xDC,0x00,0xFF,0xCB,0x42,0xFF,0xC2,0xE1,0xFF,0xC2,0xE0,0xFF,0xAA,0x40,0xFF,0x9A,0x00,0xFF,0x91,0xE0,0xFF,0x79,0x80,0xFF,0x69,0x60,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x49,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x08,0x20,0xFF,0x08,0x20,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x60,0xFF,0x20,0x60,0xFF,0x20,0x80,0xFF,0x28,0x80,0xFF,0x30,0xC0,0xFF,0x38,0xC0,0xFF,0x49,0x00,0xFF,0x61,0x60,0xFF,0x69,0x61,0xFF,0x92,0x20,0xFF,0xCC,0xCA,0xFF,0xE6,0xF6,0xFF,0xEF,0x59,0xFF,0xEF,0x37,0xFF,0xF7,0x9A,0xFF,0xEF,0x9B,0xFF,0xEF,0xDC,0xFF,0xF7,0xFE,0xFF,0xF7,0xFE,0xFF,0xF7,0xFE,0xFF,0xF7,0xDE,0xFF,0xF7,0x79,0xFF,0xED,0xEA,0xFF,0xE4,0x80,0xFF,0xD3,0xA1,0xFF,0xD3,0x82,0xFF,0xCB,0x21,0xFF,0xC3,0x00,0xFF,0xBA,0xA0,0xFF,0xA2,0x00,0xFF,0x9A,0x00,0xFF,0x9A,0x00,0xFF,0x79,0x80,0xFF,0x69,0x60,0xFF,0x61,0x60,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x49,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x08,0x20,0xFF,0x08,0x20,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x80,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x49,0x00,0xFF,0x59,0x40,0xFF,0x61,0x21,0xFF,0x91,0xE0,0xFF,0xCD,0x0A,0xFF,0xE7,0x37,0xFF,0xEF,0x59,0xFF,0xEF,0x57,0xFF,0xF7,0x99,0xFF,0xEF,0x9A,0xFF,0xEF,0x9A,0xFF,0xF7,0xDC,0xFF,0xF7,0xDC,0xFF,0xF7,0xDC,0xFF,0xF7,0xDE,0xFF,0xF7,0xBC,0xFF,0xEF,0x37,0xFF,0xEE,0x71,0xFF,0xE4,0xE6,0xFF,0xE4,0x60,0xFF,0xDB,0xC1,0xFF,0xC2,0xE1,0xFF,0xBA,0xC1,0xFF,0xAA,0x60,0xFF,0x9A,0x00,0xFF,0x92,0x00,0xFF,0x81,0x80,0xFF,0x71,0x60,0xFF,0x69,0x60,0xFF,0x59,0x40,0xFF,0x51,0x00,0xFF,0x49,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x28,0x80,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x61,0x40,0xFF,0x81,0xC0,0xFF,0xB3,0x01,0xFF,0xD4,0xC7,0xFF,0xDD,0x49,0xFF,0xDC,0xC5,0xFF,0xE5,0x48,0xFF,0xED,0xAA,0xFF,0xE5,0xA9,0xFF,0xEE,0x70,0xFF,0xEE,0xB1,0xFF,0xEE,0xD2,0xFF,0xEF,0x79,0xFF,0xEF,0x9A,0xFF,0xEF,0xBB,0xFF,0xEF,0xBB,0xFF,0xE6,0xF4,0xFF,0xEE,0x70,0xFF,0xE5,0x49,0xFF,0xD3,0xA0,0xFF,0xCB,0x40,0xFF,0xBA,0xA1,0xFF,0xAA,0x40,0xFF,0xA2,0x40,0xFF,0x91,0xE0,0xFF,0x79,0x80,0xFF,0x69,0x60,0xFF,0x59,0x40,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x79,0xC0,0xFF,0x92,0x01,0xFF,0xA2,0x00,0xFF,0xB2,0x60,0xFF,0xBA,0x80,0xFF,0xCB,0x00,0xFF,0xD3,0x40,0xFF,0xCB,0x60,0xFF,0xDB,0xE0,0xFF,0xDC,0x00,0xFF,0xE4,0x83,0xFF,0xE5,0x8B,0xFF,0xE5,0x8A,0xFF,0xE6,0x2F,0xFF,0xE7,0x36,0xFF,0xEF,0x78,0xFF,0xEF,0x7A,0xFF,0xEE,0xD4,0xFF,0xE5,0xCC,0xFF,0xE4,0xC7,0xFF,0xC3,0x00,0xFF,0xBA,0x81,0xFF,0xB2,0xA1,0xFF,0x99,0xC0,0xFF,0x81,0xA0,0xFF,0x71,0x80,0xFF,0x59,0x00,0xFF,0x51,0x00,0xFF,0x48,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x38,0xC0,0xFF,0x51,0x20,0xFF,0x49,0x00,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x79,0xC2,0xFF,0x9A,0x42,0xFF,0xA2,0x61,0xFF,0xB2,0xC2,0xFF,0xB2,0xC2,0xFF,0xB2,0xA2,0xFF,0xCB,0x43,0xFF,0xCB,0x64,0xFF,0xCB,0x22,0xFF,0xD3,0x60,0xFF,0xCB,0x20,0xFF,0xD3,0xA0,0xFF,0xE5,0x26,0xFF,0xE6,0x0D,0xFF,0xE6,0xD4,0xFF,0xE7,0x58,0xFF,0xEF,0x79,0xFF,0xEE,0xF5,0xFF,0xDD,0x28,0xFF,0xD3,0x80,0xFF,0xBA,0xC1,0xFF,0x9A,0x00,0xFF,0x91,0xC0,0xFF,0x79,0x80,0xFF,0x69,0x20,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x30,0xA0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x20,0xFF,0x61,0x40,0xFF,0x71,0x80,0xFF,0x89,0xE0,0xFF,0x81,0xA0,0xFF,0x89,0xE0,0xFF,0x9A,0x20,0xFF,0x9A,0x40,0xFF,0xAA,0x80,0xFF,0xAA,0x60,0xFF,0xA2,0x60,0xFF,0xB2,0xC3,0xFF,0xB2,0xC3,0xFF,0xB2,0x83,0xFF,0xCB,0x01,0xFF,0xCB,0x20,0xFF,0xD4,0x20,0xFF,0xEE,0x0F,0xFF,0xEF,0x17,0xFF,0xEF,0x7A,0xFF,0xE6,0xF5,0xFF,0xE5,0xCC,0xFF,0xD4,0x02,0xFF,0xBA,0xE2,0xFF,0xA2,0x42,0xFF,0x89,0xC0,0xFF,0x79,0x80,0xFF,0x69,0x60,0xFF,0x59,0x40,0xFF,0x48,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x60,0xFF,0x20,0x80,0xFF,0x30,0x80,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x51,0x00,0xFF,0x59,0x40,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x69,0x60,0xFF,0x71,0xA0,0xFF,0x79,0xA0,0xFF,0x79,0xA0,0xFF,0x8A,0x00,0xFF,0x92,0x21,0xFF,0x89,0xE0,0xFF,0x9A,0x00,0xFF,0x9A,0x20,0xFF,0x9A,0x20,0xFF,0xB2,0xC2,0xFF,0xB2,0xE3,0xFF,0xC3,0x03,0xFF,0xDB,0xC0,0xFF,0xDC,0x80,0xFF,0xE6,0x30,0xFF,0xEF,0x59,0xFF,0xEF,0x58,0xFF,0xE6,0x2F,0xFF,0xDC,0x00,0xFF,0xB2,0x21,0xFF,0xA2,0x62,0xFF,0x92,0x00,0xFF,0x69,0x60,0xFF,0x61,0x40,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x59,0x40,0xFF,0x61,0x60,0xFF,0x59,0x20,0xFF,0x59,0x20,0xFF,0x71,0xA0,0xFF,0x71,0xA0,0xFF,0x69,0x60,0xFF,0x79,0xC0,0xFF,0x81,0xC0,0xFF,0x81,0xA0,0xFF,0x92,0x00,0xFF,0x9A,0x20,0xFF,0xA2,0x61,0xFF,0xB2,0xC3,0xFF,0xC2,0xC0,0xFF,0xDC,0x00,0xFF,0xE5,0xCE,0xFF,0xE7,0x38,0xFF,0xEF,0x78,0xFF,0xE6,0x0F,0xFF,0xCB,0x80,0xFF,0xBA,0xC2,0xFF,0xA2,0x61,0xFF,0x79,0x60,0xFF,0x69,0x60,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x61,0x60,0xFF,0x61,0x60,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x69,0x60,0xFF,0x79,0x80,0xFF,0x79,0x80,0xFF,0x89,0xA0,0xFF,0x9A,0x00,0xFF,0xB2,0xC3,0xFF,0xCB,0x44,0xFF,0xD3,0x40,0xFF,0xE5,0xAD,0xFF,0xEF,0x7A,0xFF,0xEF,0x79,0xFF,0xE5,0xED,0xFF,0xDC,0x00,0xFF,0xBA,0xC3,0xFF,0xA2,0x41,0xFF,0x89,0xC0,0xFF,0x61,0x40,0xFF,0x51,0x00,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x59,0x60,0xFF,0x59,0x60,0xFF,0x51,0x20,0xFF,0x59,0x00,0xFF,0x59,0x40,0xFF,0x61,0x40,0xFF,0x71,0x80,0xFF,0x71,0xA0,0xFF,0x81,0xE0,0xFF,0x81,0xC0,0xFF,0x9A,0x20,0xFF,0xB2,0xA2,0xFF,0xBA,0xA3,0xFF,0xDC,0x23,0xFF,0xEE,0x0F,0xFF,0xE7,0x39,0xFF,0xEF,0x59,0xFF,0xEE,0x0F,0xFF,0xCB,0x60,0xFF,0xAA,0x23,0xFF,0x92,0x00,0xFF,0x71,0x40,0xFF,0x59,0x00,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x51,0x20,0xFF,0x51,0x20,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x51,0x00,0xFF,0x59,0x40,0xFF,0x61,0x40,0xFF,0x69,0x80,0xFF,0x71,0x80,0xFF,0x81,0xA0,0xFF,0x91,0xE0,0xFF,0xB2,0xA1,0xFF,0xCB,0x42,0xFF,0xDB,0xE0,0xFF,0xE6,0x0F,0xFF,0xF7,0xBB,0xFF,0xEF,0x38,0xFF,0xDC,0xA3,0xFF,0xBA,0x60,0xFF,0xA2,0x63,0xFF,0x89,0xC0,0xFF,0x71,0x60,0xFF,0x59,0x20,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x18,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x38,0xC0,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x40,0xE0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x61,0x40,0xFF,0x81,0xC0,0xFF,0x81,0xC0,0xFF,0x9A,0x20,0xFF,0xB2,0xE3,0xFF,0xC2,0xC1,0xFF,0xDC,0x42,0xFF,0xEE,0xB4,0xFF,0xEF,0x7A,0xFF,0xEE,0x72,0xFF,0xD4,0x22,0xFF,0xB2,0xC2,0xFF,0x92,0x22,0xFF,0x71,0x40,0xFF,0x61,0x20,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x61,0x20,0xFF,0x71,0x80,0xFF,0x79,0x80,0xFF,0x81,0xA0,0xFF,0x92,0x00,0xFF,0xAA,0x83,0xFF,0xCB,0x00,0xFF,0xE5,0x28,0xFF,0xEF,0x58,0xFF,0xF7,0x9A,0xFF,0xE5,0x4B,0xFF,0xBA,0x20,0xFF,0x9A,0x23,0xFF,0x79,0x60,0xFF,0x61,0x20,0xFF,0x59,0x20,0xFF,0x49,0x00,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x30,0x80,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x81,0xC0,0xFF,0x89,0xC0,0xFF,0xAA,0x81,0xFF,0xC2,0xC2,0xFF,0xDB,0xE0,0xFF,0xEE,0x72,0xFF,0xEF,0x9A,0xFF,0xE6,0x10,0xFF,0xCA,0xE0,0xFF,0xAA,0x43,0xFF,0x92,0x21,0xFF,0x71,0x60,0xFF,0x59,0x00,0xFF,0x48,0xE0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x50,0xE0,0xFF,0x59,0x20,0xFF,0x69,0x40,0xFF,0x79,0xA0,0xFF,0x81,0xC0,0xFF,0x9A,0x20,0xFF,0xAA,0x83,0xFF,0xBA,0x80,0xFF,0xE4,0xC7,0xFF,0xEF,0x38,0xFF,0xEF,0x38,0xFF,0xDC,0xEA,0xFF,0xBA,0xA0,0xFF,0x9A,0x43,0xFF,0x81,0xA0,0xFF,0x61,0x20,0xFF,0x51,0x20,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x28,0x80,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x59,0x00,0xFF,0x59,0x20,0xFF,0x61,0x40,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x92,0x22,0xFF,0xB2,0x40,0xFF,0xD3,0xE0,0xFF,0xEE,0xD6,0xFF,0xEF,0xBC,0xFF,0xE5,0xCF,0xFF,0xBA,0x80,0xFF,0x91,0xE3,0xFF,0x79,0xA0,0xFF,0x69,0x60,0xFF,0x59,0x40,0xFF,0x40,0xE0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x28,0x60,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x50,0xE0,0xFF,0x59,0x00,0xFF,0x61,0x40,0xFF,0x71,0xA0,0xFF,0x81,0xA0,0xFF,0x92,0x01,0xFF,0xAA,0x62,0xFF,0xCB,0x40,0xFF,0xED,0xEF,0xFF,0xF7,0x58,0xFF,0xEE,0x10,0xFF,0xCB,0x40,0xFF,0xA2,0x02,0xFF,0x89,0xE1,0xFF,0x71,0x60,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x20,0x40,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x61,0x20,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x89,0xC0,0xFF,0x9A,0x23,0xFF,0xB2,0x20,0xFF,0xDC,0xC7,0xFF,0xF7,0x37,0xFF,0xEF,0x38,0xFF,0xD4,0xC9,0xFF,0xB2,0x60,0xFF,0x92,0x23,0xFF,0x71,0x80,0xFF,0x59,0x00,0xFF,0x48,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x20,0x80,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x20,0x60,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x00,0xFF,0x61,0x40,0xFF,0x71,0x60,0xFF,0x89,0xC0,0xFF,0xA2,0x83,0xFF,0xBA,0x60,0xFF,0xDC,0xA6,0xFF,0xF7,0x59,0xFF,0xF7,0xBB,0xFF,0xDD,0x2C,0xFF,0xB2,0x00,0xFF,0x89,0xC3,0xFF,0x71,0x80,0xFF,0x69,0x60,0xFF,0x51,0x00,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x20,0x40,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x81,0xC0,0xFF,0xA2,0x62,0xFF,0xBA,0x80,0xFF,0xD4,0x00,0xFF,0xEE,0xF6,0xFF,0xF7,0x99,0xFF,0xDD,0x2B,0xFF,0xB2,0x20,0xFF,0x92,0x03,0xFF,0x79,0xA0,0xFF,0x61,0x40,0xFF,0x49,0x00,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x20,0x40,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x71,0xA0,0xFF,0x81,0xA0,0xFF,0x92,0x01,0xFF,0xAA,0x42,0xFF,0xCB,0x40,0xFF,0xEE,0x52,0xFF,0xF7,0x79,0xFF,0xDD,0x8E,0xFF,0xC2,0xE0,0xFF,0xA2,0x83,0xFF,0x79,0xA0,0xFF,0x59,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x20,0x40,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x00,0xFF,0x61,0x40,0xFF,0x69,0x60,0xFF,0x81,0xA0,0xFF,0x9A,0x42,0xFF,0xAA,0x41,0xFF,0xCB,0x80,0xFF,0xEE,0x94,0xFF,0xEF,0x9B,0xFF,0xDD,0xD0,0xFF,0xBA,0xE0,0xFF,0x99,0xE2,0xFF,0x79,0xA0,0xFF,0x61,0x40,0xFF,0x48,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x20,0x40,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x00,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x81,0xC0,0xFF,0xA2,0x82,0xFF,0xB2,0x80,0xFF,0xD3,0xC0,0xFF,0xEE,0xB6,0xFF,0xF7,0xDD,0xFF,0xE6,0x31,0xFF,0xBA,0xC0,0xFF,0x89,0x82,0xFF,0x71,0xA1,0xFF,0x61,0x40,0xFF,0x51,0x00,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x20,0x40,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x69,0x80,0xFF,0x79,0xA0,0xFF,0x79,0x80,0xFF,0x9A,0x22,0xFF,0xBA,0x81,0xFF,0xD3,0xA0,0xFF,0xEE,0x94,0xFF,0xF7,0x9A,0xFF,0xDD,0x6D,0xFF,0xBA,0x80,0xFF,0xA2,0x43,0xFF,0x79,0xA0,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x71,0x60,0xFF,0x79,0xA0,0xFF,0x92,0x02,0xFF,0xB2,0x20,0xFF,0xD4,0x44,0xFF,0xEF,0x17,0xFF,0xF7,0x9A,0xFF,0xDD,0x4B,0xFF,0xB2,0x40,0xFF,0x9A,0x23,0xFF,0x79,0xA0,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x80,0xFF,0x20,0x60,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x69,0x40,0xFF,0x71,0x80,0xFF,0x8A,0x00,0xFF,0xA2,0x63,0xFF,0xC2,0xA0,0xFF,0xE5,0x0A,0xFF,0xF7,0x7A,0xFF,0xF7,0x9B,0xFF,0xDD,0x4B,0xFF,0xA1,0xE0,0xFF,0x79,0x83,0xFF,0x69,0x60,0xFF,0x59,0x20,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x80,0xFF,0x20,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x61,0x40,0xFF,0x79,0xA0,0xFF,0x79,0xA0,0xFF,0x89,0xE0,0xFF,0xAA,0x83,0xFF,0xC2,0xE0,0xFF,0xE5,0x2C,0xFF,0xF7,0x79,0xFF,0xEE,0xF6,0xFF,0xCC,0x21,0xFF,0xAA,0x00,0xFF,0x92,0x22,0xFF,0x71,0x60,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x28,0x60,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x69,0x40,0xFF,0x81,0xC0,0xFF,0x81,0xC0,0xFF,0x81,0xC1,0xFF,0xA2,0x01,0xFF,0xCB,0x80,0xFF,0xEE,0x32,0xFF,0xF7,0x9A,0xFF,0xE6,0x31,0xFF,0xBA,0xE0,0xFF,0xA1,0xE3,0xFF,0x92,0x21,0xFF,0x69,0x40,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x61,0x40,0xFF,0x69,0x40,0xFF,0x79,0xA0,0xFF,0x8A,0x00,0xFF,0x9A,0x42,0xFF,0xB2,0x40,0xFF,0xDC,0x86,0xFF,0xF7,0x17,0xFF,0xF7,0x9A,0xFF,0xE5,0xAE,0xFF,0xB2,0x80,0xFF,0x89,0x83,0xFF,0x71,0x80,0xFF,0x59,0x00,0xFF,0x48,0xC0,0xFF,0x38,0xC0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x89,0xE0,0xFF,0x92,0x01,0xFF,0xA2,0x42,0xFF,0xC3,0x00,0xFF,0xE5,0xAE,0xFF,0xF7,0x79,0xFF,0xEE,0xD4,0xFF,0xD4,0x43,0xFF,0xAA,0x00,0xFF,0x89,0xC2,0xFF,0x79,0x80,0xFF,0x59,0x00,0xFF,0x48,0xE0,0xFF,0x38,0xC0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x28,0x60,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x30,0x80,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x69,0x60,0xFF,0x79,0xA0,0xFF,0x92,0x20,0xFF,0x92,0x02,0xFF,0xB2,0x60,0xFF,0xDC,0xA7,0xFF,0xEE,0xF7,0xFF,0xEF,0x79,0xFF,0xDD,0xAB,0xFF,0xBA,0x80,0xFF,0x91,0xC3,0xFF,0x81,0xA0,0xFF,0x79,0x80,0xFF,0x59,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x18,0x60,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x59,0x20,0xFF,0x61,0x60,0xFF,0x69,0x40,0xFF,0x79,0xA0,0xFF,0x8A,0x00,0xFF,0xA2,0x81,0xFF,0xAA,0x62,0xFF,0xCB,0x20,0xFF,0xED,0xEF,0xFF,0xEF,0x9A,0xFF,0xEE,0xF5,0xFF,0xD4,0xA5,0xFF,0xBA,0xA0,0xFF,0x92,0x02,0xFF,0x69,0x20,0xFF,0x61,0x20,0xFF,0x48,0xE0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x30,0xC0,0xFF,0x30,0xC0,0xFF,0x30,0x80,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x61,0x40,0xFF,0x71,0x80,0xFF,0x71,0x80,0xFF,0x92,0x20,0xFF,0xA2,0x40,0xFF,0xB2,0x83,0xFF,0xCA,0xE0,0xFF,0xE5,0x09,0xFF,0xEF,0x17,0xFF,0xEF,0x37,0xFF,0xDD,0x6A,0xFF,0xBB,0x20,0xFF,0xAA,0x63,0xFF,0x81,0xC0,0xFF,0x69,0x40,0xFF,0x59,0x20,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x38,0xA0,0xFF,0x49,0x00,0xFF,0x51,0x20,0xFF,0x48,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xA0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x40,0xE0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x51,0x00,0xFF,0x59,0x40,0xFF,0x61,0x40,0xFF,0x69,0x40,0xFF,0x71,0x60,0xFF,0x81,0xA0,0xFF,0xA2,0x60,0xFF,0xAA,0x83,0xFF,0xC2,0xC0,0xFF,0xE4,0x82,0xFF,0xEE,0xD4,0xFF,0xF7,0x9A,0xFF,0xEE,0x70,0xFF,0xC3,0x80,0xFF,0xA2,0x02,0xFF,0x92,0x01,0xFF,0x69,0x20,0xFF,0x61,0x20,0xFF,0x59,0x20,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,
-    0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x28,0x60,0xFF,0x30,0x80,0xFF,0x40,0xA0,0xFF,0x51,0x00,0xFF,0x59,0x43,0xFF,0x61,0x63,0xFF,0x69,0x81,0xFF,0x69,0x40,0xFF,0x58,0xE0,0xFF,0x59,0x00,0xFF,0x59,0x20,0xFF,0x59,0x00,0xFF,0x59,0x00,0xFF,0x59,0x00,0xFF,0x50,0xE0,0xFF,0x50,0xE0,0xFF,0x51,0x00,0xFF,0x50,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x49,0x00,0xFF,0x51,0x00,0xFF,0x51,0x00,0xFF,0x51,0x00,0xFF,0x59,0x20,0xFF,0x61,0x20,0xFF,0x61,0x40,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x81,0xC0,0xFF,0x9A,0x20,0xFF,0xAA,0x80,0xFF,0xBA,0xC3,0xFF,0xC2,0xA0,0xFF,0xDC,0x85,0xFF,0xEE,0xB4,0xFF,0xEF,0x7A,0xFF,0xEE,0xB3,0xFF,0xDC,0xA5,0xFF,0xBA,0xC2,0xFF,0xA2,0x83,0xFF,0x92,0x00,0xFF,0x61,0x20,0xFF,0x59,0x00,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,
-    0x18,0x40,0xFF,0x18,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x41,0x00,0xFF,0x59,0x82,0xFF,0x61,0x40,0xFF,0x81,0x80,0xFF,0x91,0xC0,0xFF,0x89,0x83,0xFF,0x92,0x23,0xFF,0x9A,0x41,0xFF,0x81,0xC0,0xFF,0x81,0xC0,0xFF,0x81,0xA0,0xFF,0x79,0x80,0xFF,0x79,0x80,0xFF,0x71,0x40,0xFF,0x71,0x60,0xFF,0x69,0x60,0xFF,0x61,0x20,0xFF,0x61,0x20,0xFF,0x61,0x40,0xFF,0x61,0x20,0xFF,0x61,0x20,0xFF,0x61,0x20,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x69,0x60,0xFF,0x71,0x60,0xFF,0x71,0x60,0xFF,0x71,0x60,0xFF,0x79,0xA0,0xFF,0x81,0xC0,0xFF,0x89,0xE0,0xFF,0x9A,0x20,0xFF,0xA2,0x60,0xFF,0xBA,0xE2,0xFF,0xBA,0xE4,0xFF,0xCB,0x40,0xFF,0xE4,0x82,0xFF,0xEE,0x93,0xFF,0xF7,0xBC,0xFF,0xEF,0x58,0xFF,0xDD,0x48,0xFF,0xCB,0x80,0xFF,0xBB,0x24,0xFF,0x9A,0x20,0xFF,0x81,0xA0,0xFF,0x69,0x40,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,
-    0x18,0x60,0xFF,0x20,0x60,0xFF,0x20,0x80,0xFF,0x20,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xE0,0xFF,0x38,0xC0,0xFF,0x49,0x62,0xFF,0x61,0x40,0xFF,0x8A,0x83,0xFF,0xBD,0x0E,0xFF,0xCD,0x4D,0xFF,0xBB,0x60,0xFF,0xC2,0xE0,0xFF,0xC3,0x04,0xFF,0xAA,0x62,0xFF,0xA2,0x41,0xFF,0x9A,0x21,0xFF,0x89,0xC0,0xFF,0x91,0xE0,0xFF,0x81,0xC0,0xFF,0x79,0xA0,0xFF,0x79,0x80,0xFF,0x79,0x80,0xFF,0x71,0x80,0xFF,0x71,0x60,0xFF,0x71,0x60,0xFF,0x71,0x60,0xFF,0x71,0x80,0xFF,0x71,0x80,0xFF,0x79,0xA0,0xFF,0x79,0x80,0xFF,0x79,0xA0,0xFF,0x81,0xC0,0xFF,0x81,0xC0,0xFF,0x81,0xC0,0xFF,0x89,0xE0,0xFF,0x92,0x00,0xFF,0x9A,0x20,0xFF,0xA2,0x81,0xFF,0xB2,0xC3,0xFF,0xC2,0xE3,0xFF,0xCB,0x20,0xFF,0xE5,0x4A,0xFF,0xEE,0xF6,0xFF,0xEF,0x9A,0xFF,0xEF,0x37,0xFF,0xE5,0xAC,0xFF,0xCB,0x81,0xFF,0xB2,0xE3,0xFF,0xA2,0x81,0xFF,0x79,0x60,0xFF,0x71,0x60,0xFF,0x61,0x40,0xFF,0x51,0x00,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,
-    0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x41,0x43,0xFF,0x60,0x00,0xFF,0xA3,0x87,0xFF,0xDE,0xB6,0xFF,0xE7,0x5A,0xFF,0xE6,0x92,0xFF,0xE5,0x89,0xFF,0xD3,0xE0,0xFF,0xBA,0x40,0xFF,0xB2,0x23,0xFF,0xAA,0x22,0xFF,0x89,0xC1,0xFF,0x91,0xE1,0xFF,0x89,0xC0,0xFF,0x79,0x60,0xFF,0x71,0x60,0xFF,0x81,0xA0,0xFF,0x79,0x60,0xFF,0x71,0x40,0xFF,0x79,0x60,0xFF,0x71,0x40,0xFF,0x71,0x60,0xFF,0x79,0xA0,0xFF,0x79,0x60,0xFF,0x79,0x80,0xFF,0x81,0xA0,0xFF,0x79,0x80,0xFF,0x81,0xA0,0xFF,0x89,0xC0,0xFF,0x89,0xC0,0xFF,0x9A,0x41,0xFF,0xA2,0x63,0xFF,0xAA,0x43,0xFF,0xBA,0x60,0xFF,0xD4,0x00,0xFF,0xE5,0xCE,0xFF,0xEF,0x38,0xFF,0xEF,0xBC,0xFF,0xEF,0x14,0xFF,0xE5,0x47,0xFF,0xC3,0x20,0xFF,0xAA,0x62,0xFF,0x99,0xE0,0xFF,0x71,0x40,0xFF,0x69,0x20,0xFF,0x61,0x20,0xFF,0x51,0x00,0xFF,0x40,0xE0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,
-    0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x20,0xFF,0x28,0x80,0xFF,0x38,0xA0,0xFF,0x40,0xE1,0xFF,0x50,0x80,0xFF,0x8A,0x62,0xFF,0xCD,0x4E,0xFF,0xEF,0x16,0xFF,0xEF,0x99,0xFF,0xF7,0x78,0xFF,0xE6,0x51,0xFF,0xDD,0x06,0xFF,0xD3,0xA0,0xFF,0xBA,0x60,0xFF,0xA9,0xE1,0xFF,0xA1,0xE2,0xFF,0xA1,0xE2,0xFF,0x91,0xC1,0xFF,0x89,0xA0,0xFF,0x91,0xE0,0xFF,0x81,0x80,0xFF,0x79,0x80,0xFF,0x89,0xC0,0xFF,0x79,0x60,0xFF,0x81,0x80,0xFF,0x89,0xC0,0xFF,0x81,0x60,0xFF,0x89,0xA0,0xFF,0x92,0x00,0xFF,0x89,0xA0,0xFF,0x92,0x01,0xFF,0xA2,0x42,0xFF,0x9A,0x03,0xFF,0xB2,0x40,0xFF,0xC2,0x60,0xFF,0xCB,0x60,0xFF,0xE5,0x4B,0xFF,0xEE,0xB4,0xFF,0xF7,0x9A,0xFF,0xF7,0xBB,0xFF,0xE6,0x92,0xFF,0xDC,0xC5,0xFF,0xCB,0x40,0xFF,0xA1,0xE1,0xFF,0x91,0xC0,0xFF,0x81,0xA0,0xFF,0x69,0x60,0xFF,0x61,0x40,0xFF,0x48,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,
-    0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x28,0xA0,0xFF,0x30,0xA0,0xFF,0x40,0xA0,0xFF,0x59,0x61,0xFF,0x71,0x61,0xFF,0xA2,0x60,0xFF,0xDC,0xC8,0xFF,0xEE,0x50,0xFF,0xEF,0x16,0xFF,0xE7,0x79,0xFF,0xEF,0x58,0xFF,0xEE,0xB4,0xFF,0xDD,0x29,0xFF,0xDC,0x40,0xFF,0xCB,0x60,0xFF,0xBA,0x20,0xFF,0xB2,0x20,0xFF,0xB2,0x00,0xFF,0xAA,0x02,0xFF,0xA1,0xE2,0xFF,0xA2,0x22,0xFF,0xB2,0x62,0xFF,0xAA,0x42,0xFF,0xAA,0x42,0xFF,0xAA,0x62,0xFF,0xAA,0x42,0xFF,0xAA,0x42,0xFF,0xB2,0x82,0xFF,0xB2,0x62,0xFF,0xBA,0x81,0xFF,0xC2,0xE0,0xFF,0xC3,0x00,0xFF,0xDC,0x65,0xFF,0xE5,0x4A,0xFF,0xEE,0x72,0xFF,0xF7,0x9B,0xFF,0xF7,0xBC,0xFF,0xEE,0xF5,0xFF,0xE6,0x0E,0xFF,0xCB,0xE0,0xFF,0xB2,0x40,0xFF,0xAA,0x82,0xFF,0x89,0xA0,0xFF,0x71,0x60,0xFF,0x69,0x40,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x38,0xA0,0xFF,0x61,0x60,0xFF,0x71,0xA1,0xFF,0x89,0xC1,0xFF,0xAA,0x60,0xFF,0xC3,0x40,0xFF,0xD4,0x85,0xFF,0xE6,0x50,0xFF,0xEF,0x78,0xFF,0xEF,0xBB,0xFF,0xE7,0x56,0xFF,0xEF,0x15,0xFF,0xEE,0xB3,0xFF,0xDD,0x6A,0xFF,0xDD,0x08,0xFF,0xDC,0x64,0xFF,0xCB,0x60,0xFF,0xCB,0x20,0xFF,0xD3,0x40,0xFF,0xCB,0x20,0xFF,0xCA,0xA0,0xFF,0xCB,0x00,0xFF,0xCB,0x20,0xFF,0xCA,0xE0,0xFF,0xCB,0x40,0xFF,0xD3,0xE0,0xFF,0xD3,0xC0,0xFF,0xDC,0x63,0xFF,0xE5,0x8C,0xFF,0xEE,0x30,0xFF,0xEF,0x17,0xFF,0xF7,0x9A,0xFF,0xF7,0x79,0xFF,0xEF,0x58,0xFF,0xEE,0x92,0xFF,0xDC,0x81,0xFF,0xC3,0x40,0xFF,0xAA,0x40,0xFF,0x99,0xE1,0xFF,0x91,0xE0,0xFF,0x71,0x60,0xFF,0x61,0x40,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,
-    0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x40,0xC0,0xFF,0x59,0x20,0xFF,0x79,0xA0,0xFF,0x89,0xE0,0xFF,0xA2,0x82,0xFF,0xB2,0xA0,0xFF,0xC3,0x60,0xFF,0xE5,0x08,0xFF,0xE6,0x0E,0xFF,0xEE,0xD3,0xFF,0xEF,0x78,0xFF,0xE7,0x9A,0xFF,0xEF,0x99,0xFF,0xEF,0x59,0xFF,0xEF,0x15,0xFF,0xEE,0xB3,0xFF,0xEE,0xB3,0xFF,0xEE,0x72,0xFF,0xEE,0x52,0xFF,0xE5,0x8E,0xFF,0xE5,0xAE,0xFF,0xEE,0x31,0xFF,0xED,0xEF,0xFF,0xEE,0x32,0xFF,0xF6,0xD6,0xFF,0xF6,0xD5,0xFF,0xF7,0x17,0xFF,0xF7,0x7A,0xFF,0xF7,0x9A,0xFF,0xF7,0x7A,0xFF,0xEF,0x38,0xFF,0xE5,0xEE,0xFF,0xD4,0x60,0xFF,0xCB,0x40,0xFF,0xBA,0x80,0xFF,0xB2,0xA2,0xFF,0x91,0xE0,0xFF,0x71,0x60,0xFF,0x69,0x40,0xFF,0x59,0x20,0xFF,0x59,0x20,0xFF,0x49,0x00,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,
-    0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x40,0xC0,0xFF,0x59,0x00,0xFF,0x71,0x80,0xFF,0x8A,0x41,0xFF,0x92,0x42,0xFF,0x91,0xC1,0xFF,0xAA,0x60,0xFF,0xC3,0x20,0xFF,0xD3,0xE0,0xFF,0xDD,0x08,0xFF,0xEE,0x2F,0xFF,0xEE,0xD5,0xFF,0xEE,0xD5,0xFF,0xEF,0x37,0xFF,0xF7,0x9A,0xFF,0xF7,0x9A,0xFF,0xF7,0x9A,0xFF,0xF7,0x9B,0xFF,0xF7,0x99,0xFF,0xF7,0x9A,0xFF,0xF7,0x9B,0xFF,0xF7,0x9A,0xFF,0xF7,0x9A,0xFF,0xF7,0x7B,0xFF,0xF7,0x58,0xFF,0xF7,0x58,0xFF,0xF7,0x16,0xFF,0xE6,0x0F,0xFF,0xDD,0x4A,0xFF,0xD4,0x85,0xFF,0xC3,0x40,0xFF,0xBA,0xC0,0xFF,0xAA,0x62,0xFF,0x91,0xE1,0xFF,0x91,0xE0,0xFF,0x79,0x80,0xFF,0x69,0x60,0xFF,0x61,0x40,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x40,0xE0,0xFF,0x38,0xC0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,
-    0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x28,0x60,0xFF,0x38,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x61,0x60,0xFF,0x69,0x60,0xFF,0x71,0x80,0xFF,0x92,0x83,0xFF,0xA2,0xA3,0xFF,0x9A,0x22,0xFF,0xB2,0x60,0xFF,0xD3,0x60,0xFF,0xD3,0xC0,0xFF,0xD3,0xC0,0xFF,0xDC,0xE7,0xFF,0xED,0xED,0xFF,0xE5,0xAB,0xFF,0xEE,0x0E,0xFF,0xE6,0x30,0xFF,0xE5,0xEE,0xFF,0xEE,0x72,0xFF,0xEE,0xB3,0xFF,0xEE,0x2F,0xFF,0xE5,0xED,0xFF,0xE5,0xAD,0xFF,0xDC,0xE7,0xFF,0xDD,0x08,0xFF,0xD4,0x85,0xFF,0xC2,0xC0,0xFF,0xBA,0x40,0xFF,0xB2,0x40,0xFF,0xA2,0x02,0xFF,0x9A,0x21,0xFF,0x89,0xE0,0xFF,0x69,0x40,0xFF,0x69,0x40,0xFF,0x59,0x00,0xFF,0x59,0x20,0xFF,0x51,0x00,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x38,0xE0,0xFF,0x40,0xC0,0xFF,0x48,0xC0,0xFF,0x50,0xE0,0xFF,0x59,0x20,0xFF,0x69,0x80,0xFF,0x71,0x80,0xFF,0x81,0xC1,0xFF,0x92,0x22,0xFF,0xA2,0x22,0xFF,0xAA,0xA3,0xFF,0xBA,0xC3,0xFF,0xC2,0xC0,0xFF,0xC2,0xE0,0xFF,0xBA,0xC0,0xFF,0xBA,0xC0,0xFF,0xCB,0x40,0xFF,0xCB,0x40,0xFF,0xCB,0x80,0xFF,0xC3,0x80,0xFF,0xC3,0x00,0xFF,0xCB,0x20,0xFF,0xCB,0x60,0xFF,0xC2,0xC0,0xFF,0xB2,0x20,0xFF,0xA2,0x00,0xFF,0x9A,0x03,0xFF,0xA2,0x63,0xFF,0x92,0x21,0xFF,0x71,0x40,0xFF,0x69,0x00,0xFF,0x61,0x00,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x30,0x80,0xFF,0x38,0xC0,0xFF,0x49,0x00,0xFF,0x49,0x00,0xFF,0x51,0x00,0xFF,0x59,0x00,0xFF,0x58,0xE0,0xFF,0x69,0x40,0xFF,0x81,0xE0,0xFF,0x81,0xE0,0xFF,0x8A,0x41,0xFF,0x8A,0x20,0xFF,0x92,0x02,0xFF,0x9A,0x43,0xFF,0x9A,0x23,0xFF,0x91,0xE3,0xFF,0xAA,0x84,0xFF,0xAA,0xA4,0xFF,0xA2,0x23,0xFF,0xA2,0x03,0xFF,0x9A,0x03,0xFF,0xAA,0x83,0xFF,0xB2,0xC3,0xFF,0x9A,0x22,0xFF,0x91,0xE2,0xFF,0x89,0xE1,0xFF,0x79,0x80,0xFF,0x79,0x80,0xFF,0x71,0x60,0xFF,0x61,0x40,0xFF,0x69,0x40,0xFF,0x59,0x00,0xFF,0x50,0xE0,0xFF,0x48,0xE0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,
-    0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x51,0x20,0xFF,0x59,0x40,0xFF,0x59,0x40,0xFF,0x61,0x40,0xFF,0x61,0x40,0xFF,0x71,0x60,0xFF,0x71,0x40,0xFF,0x71,0x40,0xFF,0x81,0xE0,0xFF,0x82,0x01,0xFF,0x89,0xE0,0xFF,0x81,0xC0,0xFF,0x79,0x40,0xFF,0x81,0xA0,0xFF,0x8A,0x41,0xFF,0x89,0xE0,0xFF,0x81,0x60,0xFF,0x81,0x40,0xFF,0x79,0x60,0xFF,0x81,0xC1,0xFF,0x79,0xC0,0xFF,0x69,0x20,0xFF,0x59,0x00,0xFF,0x59,0x00,0xFF,0x59,0x20,0xFF,0x59,0x20,0xFF,0x48,0xE0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x60,0xFF,0x20,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x40,0xE0,0xFF,0x41,0x00,0xFF,0x40,0xE0,0xFF,0x48,0xC0,0xFF,0x48,0xC0,0xFF,0x59,0x20,0xFF,0x61,0x40,0xFF,0x61,0x20,0xFF,0x69,0x60,0xFF,0x61,0x40,0xFF,0x61,0x20,0xFF,0x69,0x40,0xFF,0x61,0x20,0xFF,0x61,0x20,0xFF,0x69,0x60,0xFF,0x61,0x20,0xFF,0x61,0x20,0xFF,0x61,0x40,0xFF,0x61,0x00,0xFF,0x61,0x40,0xFF,0x59,0x20,0xFF,0x50,0xE0,0xFF,0x50,0xE0,0xFF,0x50,0xE0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xE0,0xFF,0x48,0xC0,0xFF,0x48,0xC0,0xFF,0x48,0xC0,0xFF,0x51,0x00,0xFF,0x51,0x20,0xFF,0x50,0xE0,0xFF,0x48,0xC0,0xFF,0x48,0xC0,0xFF,0x51,0x00,0xFF,0x51,0x20,0xFF,0x48,0xE0,0xFF,0x48,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x40,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x40,0xC0,0xFF,0x40,0xE0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x40,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xC0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x80,0xFF,0x20,0x80,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x38,0xA0,0xFF,0x38,0xA0,0xFF,0x30,0xA0,0xFF,0x30,0x80,0xFF,0x30,0x80,0xFF,0x30,0xA0,0xFF,0x30,0xA0,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x80,0xFF,0x20,0x80,0xFF,0x28,0x60,0xFF,0x28,0x60,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x28,0x80,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x20,0x60,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x20,0x40,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x20,0x60,0xFF,0x20,0x60,0xFF,0x20,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x20,0xFF,0x10,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x08,0x20,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x40,0xFF,0x10,0x20,0xFF,0x18,0x20,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x18,0x40,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x20,0xFF,0x10,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x08,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    
-};
-const lv_img_dsc_t ui_img_numbers_3_png = {
-    .header.always_zero = 0,
-    .header.w = 64,
-    .header.h = 100,
-    .data_size = sizeof(ui_img_numbers_3_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_numbers_3_png_data
-};
-
@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/clearnight.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_clearnight_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x19,0x28,0x14,0x19,0x28,0x36,0x11,0x29,0x5B,0x11,0x28,0x7C,0x11,0x28,0x95,0x11,0x28,0xA3,0x11,0x28,0xAF,0x11,0x28,0xB3,0x11,0x28,0xAA,0x11,0x28,0xA3,0x11,0x29,0x90,0x11,0x29,0x79,0x11,0x28,0x63,0x11,0x49,0x47,0x11,0x29,0x2E,0x11,0x28,0x1A,0x18,0xE7,0x09,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x0F,0x11,0x28,0x44,0x11,0x09,0x9F,0x11,0x29,0xFA,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xB8,0x11,0x28,0x5D,0x19,0x28,0x1B,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x69,0x11,0x11,0x29,0x58,0x11,0x29,0xD8,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xF8,0x11,0x28,0x8A,0x11,0x48,0x24,0x00,0x00,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,0x11,0x29,0x38,0x11,0x29,0xC4,
-    0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xF6,0x11,0x28,0x6C,0x11,0x08,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x29,0x07,0x11,0x28,0x61,0x11,0x29,0xF8,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x28,0xFF,0x19,0x28,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xAF,0x11,0x09,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x29,0x07,0x11,0x28,0x73,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,
-    0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x09,0xC2,0x11,0x28,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x11,0x28,0x54,0x11,0x29,0xFA,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xAD,0x19,0x48,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x68,0x23,0x11,0x29,0xE2,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x19,0x28,0xFF,0x19,0x28,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x29,0x6D,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x08,0x04,0x11,0x28,0x85,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xE2,0x19,0x48,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x08,0x17,0x11,0x08,0xE0,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x6F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x49,0x47,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x29,0xBA,0x21,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0x7C,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xED,0x11,0x68,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x11,0x28,0x9F,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFD,0x11,0x08,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x03,0x11,0x29,0xB5,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x48,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x11,0x28,0xAF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x48,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x29,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0xA6,0x11,0x29,0xFF,0x19,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x48,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x48,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x7A,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x49,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x29,0x4A,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x48,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xF4,0x11,0x29,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x08,0x17,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xD6,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x08,0x04,0x11,0x28,0xDE,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x19,0x69,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x29,0x8B,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x19,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x49,0xFF,0x21,0x8A,0xFF,0x29,0xCB,0xFF,0x31,0xEB,0xFF,0x32,0x0B,0xFF,0x29,0xEB,0xFF,0x29,0xAA,0xFF,0x19,0x49,0xFF,0x11,0x08,0xFF,0x10,0xE7,0xFF,0x10,0xE7,0xFF,0x10,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x22,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x11,0x07,0xFF,0x11,0x08,0xFF,0x21,0x8A,0xFF,0x4A,0xCE,0xFF,0x94,0xD5,0xFF,0xCE,0x7B,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0xEF,0x7E,0xFF,0xCE,0x9B,0xFF,0x9D,0x36,0xFF,0x5B,0x50,0xFF,0x29,0xAA,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xF6,0x21,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x11,0x28,0xDC,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x10,0xE7,0xFF,0x10,0xE7,0xFF,0x4A,0xCE,0xFF,0xB5,0xD8,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xDF,0x1D,0xFF,0xB5,0xF9,0xFF,0x84,0x94,0xFF,0x4A,0xCE,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x56,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x10,0xE7,0xFF,0x11,0x28,0xFF,0x6B,0xB1,0xFF,0xCE,0x9A,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xC6,0x3A,0xFF,0x6B,0xB1,0xFF,0x31,0xEB,0xFF,0x19,0x49,0xFF,0x08,0xE7,0xFF,0x08,0xE7,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x49,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x11,0x28,0xF8,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x08,0xE7,0xFF,0x4A,0xAE,0xFF,0xC6,0x5A,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9E,0xFF,0x9D,0x37,0xFF,0x42,0x6D,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xDA,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x6B,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x19,0x28,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x28,0xFF,0x19,0x69,0xFF,
-    0x84,0x74,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0xB5,0xB8,0xFF,0x29,0xCB,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x08,0xFF,0x29,0xAB,0xFF,0xCE,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xE7,0x1D,0xFF,0x42,0x8E,0xFF,0x08,0xE8,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xE7,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x56,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x08,0xFF,0x4A,0xAE,0xFF,0xDF,0x1C,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xB5,0xF9,0xFF,0x19,0x8A,0xFF,0x10,0xE8,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x11,0x28,0xEF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x11,0x28,0xFF,0x42,0x8D,0xFF,0xE7,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0x9D,0x16,0xFF,0x08,0xC7,0xFF,0x08,0xE7,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x5B,0x4F,0xFF,0x29,0xCA,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x29,0xFF,0x11,0x29,0xD4,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x29,0x31,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x19,0x48,0xFF,0x3A,0x6B,0xFF,0xEF,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBE,0xFF,0x9D,0x36,0xFF,0x00,0xA7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x10,0xE7,0xFF,0x21,0xAA,0xFF,0xCE,0x7A,0xFF,0x84,0x93,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x48,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x29,0xAD,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x29,0xAA,0xFF,0xDF,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xB5,0xD8,0xFF,0x08,0xC7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x21,0x8A,0xFF,0xCE,0x7A,0xFF,0xEF,0x5D,0xFF,0xE7,0x3C,0xFF,0x6B,0xD1,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xEA,0x09,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x09,0xFF,0xA5,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x5D,0xFF,0x21,0x8A,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x21,0x89,0xFF,0xB5,0xF8,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xEF,0x5D,0xFF,0xDF,0x1C,0xFF,0x5B,0x0F,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x48,0x46,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x10,0xE8,0xFF,0x73,0xB1,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x52,0xEF,0xFF,0x08,0xE8,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x10,0xE7,0xFF,0x11,0x28,0xFF,0x94,0xF5,0xFF,0xEF,0x5D,0xFF,0xDE,0xDB,0xFF,0x5B,0x2F,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0xB7,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x21,0x68,0xFF,0xDF,0x1B,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,
-    0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB5,0xF9,0xFF,0x10,0xE8,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x10,0xE7,0xFF,0xBD,0xF8,0xFF,0x73,0xD1,0xFF,0x08,0xC7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x08,0xE7,0xFF,0x94,0xD3,0xFF,0xFF,0xFE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9E,0xFF,0x32,0x0C,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x32,0x0B,0xFF,0x19,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xF8,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x2B,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x19,0x6A,0xFF,0xE7,0x7D,0xFF,0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBF,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,
-    0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xAD,0xB8,0xFF,0x11,0x08,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x19,0x48,0x13,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x70,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x08,0xC7,0xFF,0x73,0xD2,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBF,0xFF,0xFF,0xBF,0xFF,0xFF,0xBF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x4A,0xEE,0xFF,0x11,0x28,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0xD2,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x19,0x28,0xFF,0xD6,0xDB,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,
-    0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xCE,0xBB,0xFF,0x19,0x69,0xFF,0x19,0x6A,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0x86,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x42,0x08,0x04,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x09,0x07,0xFF,0x42,0x6C,0xFF,0xF7,0xDE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0x8C,0xB4,0xFF,0x11,0x28,0xFF,0x19,0x6A,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x19,0x29,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,
-    0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x48,0x13,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x08,0xE7,0xFF,0x74,0x12,0xFF,0xF7,0xBE,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,
-    0xF7,0x9E,0xFF,0xFF,0xDF,0xFF,0x53,0x0F,0xFF,0x11,0x29,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x02,0xAA,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x29,0x2E,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x08,0xFF,0xB5,0xB7,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x7E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0x29,0xEB,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,
-    0x11,0x49,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x21,0x27,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x54,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x49,0xFF,0x11,0x28,0xFF,0x21,0x69,0xFF,0xDF,0x1C,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x7E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,
-    0xF7,0x9E,0xFF,0xD6,0xDB,0xFF,0x19,0x69,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x68,0x1D,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x28,0x73,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x3A,0x0B,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x7E,0xFF,0xEF,0x9E,0xFF,0xF7,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xBD,0xF9,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x84,0x53,0xFF,
-    0x32,0x2C,0xFF,0x19,0x49,0xFF,0x19,0x4A,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x48,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x98,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x48,0xFF,0x11,0x28,0xFF,0x4A,0xCD,0xFF,0xFF,0xDE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xF7,0x7E,0xFF,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,
-    0xF7,0xBE,0xFF,0xA5,0x57,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x29,0xAA,0xFF,0xE7,0x1C,0xFF,0x94,0xF5,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x19,0x6A,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x19,0x48,0x40,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x28,0xB8,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x5B,0x2F,0xFF,0xFF,0xDE,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0x94,0xF5,0xFF,0x08,0xE7,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x29,0xAA,0xFF,0xCE,0x5A,0xFF,0xF7,0xBE,0xFF,
-    0xEF,0x7E,0xFF,0x9C,0xF5,0xFF,0x19,0x4A,0xFF,0x19,0x49,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0xC4,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x63,0x70,0xFF,0xFF,0xDE,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,
-    0xEF,0x9E,0xFF,0x94,0xF5,0xFF,0x08,0xE7,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x19,0x69,0xFF,0xB5,0xD8,0xFF,0xEF,0x9E,0xFF,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xEF,0x5D,0xFF,0x9C,0xF5,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0x55,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x28,0xD2,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x63,0x4F,0xFF,0xF7,0xBE,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0x9D,0x16,0xFF,0x08,0xE7,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x32,0x0B,0xFF,0xBD,0xF9,0xFF,0xF7,0x9E,0xFF,
-    0xEF,0x5D,0xFF,0x94,0xF5,0xFF,0x19,0x49,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0xCE,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x5B,0x0E,0xFF,0xF7,0xBE,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,
-    0xEF,0x7D,0xFF,0xAD,0x97,0xFF,0x11,0x07,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x21,0x89,0xFF,0xDF,0x1C,0xFF,0x84,0x93,0xFF,0x08,0xC7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x50,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x28,0xBA,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x4A,0xAD,0xFF,0xF7,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xC6,0x5A,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x6B,0xB0,0xFF,
-    0x21,0x69,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0xA6,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x32,0x0B,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,
-    0xE7,0x3D,0xFF,0xD6,0xFB,0xFF,0x21,0x89,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0x36,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x28,0x83,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x21,0x69,0xFF,0xD6,0xDB,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x5D,0xFF,0x3A,0x2C,0xFF,0x08,0xE7,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x5D,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0xAD,0x97,0xFF,0xEF,0x7E,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,
-    0xE7,0x1C,0xFF,0xE7,0x5D,0xFF,0x63,0x70,0xFF,0x08,0xE7,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x29,0x15,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x48,0x3E,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x73,0xF2,0xFF,0xEF,0x9E,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0x9D,0x36,0xFF,0x08,0xE7,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x21,0x29,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x67,0x1D,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x3A,0x4C,0xFF,0xEF,0x7D,0xFF,0xE7,0x1D,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,
-    0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xCE,0xBB,0xFF,0x21,0xAA,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x21,0x08,0x08,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x19,0x48,0xFF,0xC6,0x59,0xFF,0xE7,0x3D,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xE7,0x3C,0xFF,0x6B,0xD1,0xFF,0x11,0x08,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xB8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0xF6,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x08,0xE7,0xFF,0x63,0x90,0xFF,0xE7,0x3C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,
-    0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xE7,0x1C,0xFF,0xC6,0x39,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0x68,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x95,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0xD6,0xBA,0xFF,0xDE,0xFC,0xFF,0xDE,0xDB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0x63,0xB1,0xFF,0x11,0x49,0xFF,0x19,0x69,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x43,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x08,0xC7,0xFF,0x84,0x73,0xFF,0xDF,0x1C,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,
-    0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xE7,0x3C,0xFF,0xCE,0xBA,0xFF,0x19,0x6A,0xFF,0x19,0x69,0xFF,0x19,0x4A,0xFF,0x19,0x49,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x18,0xE7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x69,0x11,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x08,0xFF,0x19,0x48,0xFF,0xC6,0x59,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xE7,0x3C,0xFF,0x8C,0xD4,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0xE5,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x63,0x70,0xFF,0xDE,0xFB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,
-    0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0x53,0x0F,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x69,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x08,0xE7,0xFF,0x9D,0x35,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFB,0xFF,0xCE,0x9A,0xFF,0x32,0x2C,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x68,0x17,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x21,0xAA,0xFF,0xCE,0x9A,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,
-    0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xBE,0x18,0xFF,0x19,0x69,0xFF,0x10,0xE8,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xED,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0xD6,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x09,0x08,0xFF,0x42,0x8D,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xB5,0xD7,0xFF,0x21,0xAA,0xFF,0x08,0xC7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x48,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x5B,0x4F,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBA,0xFF,
-    0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xC6,0x59,0xFF,0xCE,0x7A,0xFF,0xBE,0x18,0xFF,0x42,0xAD,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x21,0x88,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x11,0x28,0xFA,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x63,0x90,0xFF,0xD6,0x9A,0xFF,0xD6,0xBB,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0x73,0xF1,0xFF,0x19,0x49,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x6C,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x52,0xEE,0xFF,0xCE,0x9A,0xFF,
-    0xD6,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x59,0xFF,0xB5,0xD7,0xFF,0x4A,0xCE,0xFF,0x09,0x08,0xFF,0x11,0x08,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x29,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xE7,0x09,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFF,0x32,0x2C,0xFF,0xB5,0xB7,0xFF,0xCE,0x9A,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xAD,0xB7,0xFF,0x73,0xF1,0xFF,0x32,0x0B,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xDA,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x6F,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,
-    0x19,0x49,0xFF,0x73,0xF1,0xFF,0xBE,0x18,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x39,0xFF,0xCE,0x59,0xFF,0xCE,0x7A,0xFF,0xC6,0x39,0xFF,0xA5,0x76,0xFF,0x84,0x53,0xFF,0x53,0x0F,0xFF,0x3A,0x6D,0xFF,0x29,0xEB,0xFF,0x21,0x8A,0xFF,0x19,0x69,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x21,0x8A,0xFF,0x32,0x2B,0xFF,0x19,0x69,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x11,0x28,0xFA,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x08,0xC7,0xFF,0x32,0x2B,0xFF,0x8C,0xB4,0xFF,0xBE,0x18,0xFF,0xC6,0x39,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x58,0xFF,0xC6,0x38,0xFF,0xBD,0xD7,0xFF,0xB5,0xB7,0xFF,0xAD,0x96,0xFF,0xAD,0x76,0xFF,0xA5,0x76,0xFF,0x94,0xD3,0xFF,0x42,0x8C,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xD2,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x4C,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x08,0xC7,0xFF,0x32,0x2B,0xFF,0x8C,0xB3,0xFF,0xBD,0xF7,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xBD,0xF8,0xFF,0xB5,0xB7,0xFF,0x9D,0x14,0xFF,0x42,0xAD,0xFF,0x08,0xC7,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0xD0,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x10,0xE7,0xFF,0x08,0xE7,0xFF,0x19,0x48,0xFF,0x4A,0xAD,0xFF,0x8C,0x93,0xFF,0xB5,0xB7,0xFF,0xBE,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x58,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xBD,0xD7,0xFF,0x94,0xF4,0xFF,0x53,0x0E,0xFF,0x19,0x69,0xFF,0x08,0xE7,0xFF,0x09,0x07,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x48,0x19,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x08,0xE7,0xFF,0x08,0xE7,0xFF,0x19,0x49,0xFF,0x29,0xCB,0xFF,0x42,0x6C,0xFF,0x52,0xEE,0xFF,0x63,0x4F,0xFF,0x63,0x70,0xFF,0x63,0x70,0xFF,0x63,0x4F,0xFF,0x53,0x0E,0xFF,0x42,0x8D,0xFF,0x31,0xEB,0xFF,0x19,0x69,0xFF,0x09,0x08,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x27,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x67,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x11,0x28,0xC8,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x29,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xBE,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x48,0x0C,0x11,0x28,0xF6,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFA,0x11,0x27,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x29,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x56,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x79,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0x98,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x08,0x97,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xB1,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0x9D,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xBC,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x11,0x28,0x9C,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xAF,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0x86,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x9A,0x00,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x08,0x65,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0x38,0x11,0x08,0xFD,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xF6,0x11,0x28,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x48,0x12,0x11,0x08,0xD8,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xB7,0x19,0x89,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,0x11,0x08,0x82,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xF8,0x19,0x28,0x48,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x08,0x24,0x11,0x08,0xE0,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0x90,0x21,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x11,0x28,0x56,0x11,0x28,0xFD,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xA4,0x19,0x28,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x11,0x28,0x68,0x11,0x08,0xFD,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0x88,0x19,0x29,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x11,0x48,0x4C,0x11,0x28,0xE5,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xD4,0x11,0x29,0x4D,0x21,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x19,0x28,0x1B,0x11,0x28,0x76,0x11,0x28,0xEF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xC6,0x11,0x29,0x55,0x19,0x48,0x12,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x19,0x48,0x13,0x11,0x28,0x46,0x11,0x28,0x93,0x11,0x28,0xF2,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFD,0x11,0x28,0xAF,0x11,0x28,0x5C,0x11,0x08,0x25,0x21,0x29,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x11,0x68,0x17,0x11,0x49,0x2D,0x11,0x08,0x48,0x11,0x28,0x67,0x11,0x08,0x7C,0x11,0x28,0x93,0x11,0x28,0xA1,0x11,0x28,0xA4,0x11,0x28,0xA8,0x11,0x28,0x9C,0x11,0x28,0x8B,0x11,0x28,0x7A,0x11,0x28,0x5D,0x11,0x08,0x43,0x11,0x29,0x2E,0x11,0x08,0x17,0x21,0x29,0x07,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_clearnight_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_clearnight_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_clearnight_png_data
-};
-
@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/cloudy.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_cloudy_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x65,0x17,0x21,0x66,0x34,0x84,0x31,0x52,0xBD,0xD7,0x6D,0xDF,0x1C,0x8A,0xF7,0x9E,0x9A,0xFF,0xDF,0xA8,0xFF,0xFF,0xAF,0xFF,0xFF,0xAB,0xFF,0xFF,0xA4,0xF7,0xBE,0x93,0xE7,0x3C,0x7F,0xCE,0x59,0x67,0x9D,0x34,0x49,0x4A,0x8B,0x2B,0x00,0x84,0x10,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x05,0x2D,0x73,0xCF,0xE2,0xC6,0x59,0xFF,0xF7,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0xE7,0x1C,0xFF,0xA5,0x35,0xF4,0x42,0x29,0x51,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,
-    0x73,0xAF,0x8D,0xD6,0xBA,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7D,0xFF,0xAD,0x76,0xC0,0x42,0x2B,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x2B,0x0B,0xBE,0x18,0xD0,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9E,0xF6,0x7C,0x11,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xCF,0x17,0xEF,0x7D,0xF2,0xF7,0xDF,0xFF,
-    0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xDE,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xF8,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xF4,0x25,0xFF,0xDF,0xFA,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFB,0x83,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x15,0x2C,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDE,0xFF,
-    0xF7,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xE7,0x1C,0xAF,0x4A,0x49,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0xB3,0x29,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBF,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xFF,0xBF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xF7,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xF7,0xDF,0xFF,0xFF,0xBF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xF7,0xDF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xD6,0xBA,0xF4,0x29,0xA7,0x43,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xCF,0x1F,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xF7,0xDE,0xFF,
-    0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDF,0xFF,0xF7,0xDE,0xFF,0xFF,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xF7,0xBF,0xFF,0xFF,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xAD,0x96,0xFF,0x21,0x25,0xFA,0x3A,0x4A,0x93,0x6B,0xAE,0x4F,0x7C,0x10,0x33,0x84,0x30,0x28,0x7C,0x10,0x22,0x6B,0x4E,0x1B,0x32,0x09,0x14,0x10,0xA5,0x0B,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA9,0x0E,0xEF,0x5D,0xF6,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBF,0xFF,0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xFF,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xE7,0x5C,0xFF,0xBE,0x18,0xFF,0x6B,0xAF,0xC8,0x08,0x84,0x46,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,0xC6,0x18,0xD4,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,
-    0xF7,0xBE,0xFF,0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xDE,0xDB,0xFF,0x84,0x31,0xDC,0x21,0x05,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xAC,0x64,0xFF,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,
-    0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xC6,0x59,0xFD,0x4A,0x8A,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x59,0xF4,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,
-    0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xF7,0x9E,0xFF,0xEF,0x5D,0xFF,0x63,0x2D,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x2B,0x19,0xFF,0xDF,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,
-    0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0x6B,0xAF,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x25,0x85,0x9D,0x14,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,
-    0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0x63,0x4E,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC7,0x9D,0xD6,0xDB,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9D,0xFF,0xEF,0x9D,0xFF,0xEF,0x9D,0xFF,
-    0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xDE,0xFB,0xFF,0x3A,0x49,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xCB,0xA1,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,
-    0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xBD,0xF7,0xD6,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,0x7B,0xF0,0xF4,0xF7,0xBE,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xF7,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,
-    0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0x6B,0x6E,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x31,0xA7,0x9A,0x9C,0xD3,0xFF,0xF7,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,
-    0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xCE,0x79,0xEB,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x32,0x08,0x13,0x63,0x2D,0x45,0x84,0x51,0x9C,0x9D,0x14,0xFF,0xA5,0x55,0xFF,0xD6,0xBB,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,
-    0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x3D,0xFF,0xEF,0x3D,0xFF,0xEF,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xEF,0x7D,0xFF,0x42,0x2A,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x0D,0x6B,0x6E,0x64,0xB5,0xB6,0xF2,0xDE,0xFB,0xFF,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,
-    0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x3D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xEF,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xEF,0x5D,0xFF,0x94,0xB3,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x7C,0x10,0x7C,0xD6,0xDA,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,
-    0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xEF,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xEF,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xC6,0x38,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x08,0x28,0xCE,0x9A,0xF2,0xF7,0xBE,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,
-    0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5C,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFB,0xFF,0x31,0xA9,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xD0,0x5C,0xEF,0x5C,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5C,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,
-    0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0x3A,0x09,0xA4,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x31,0x68,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x3D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5C,0xFF,0xE7,0x3D,0xFF,0xEF,0x3D,0xFF,0xEF,0x3D,0xFF,0xE7,0x3D,0xFF,0xEF,0x3D,0xFF,0xEF,0x3D,0xFF,0xEF,0x5D,0xFF,
-    0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x5C,0xFF,0x4A,0xAB,0xFF,0x21,0x45,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xF0,0x43,0xEF,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5C,0xFF,0xE7,0x5C,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5C,0xFF,0xE7,0x5D,0xFF,0xEF,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xEF,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,
-    0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xCE,0x7A,0xFF,0xA5,0x35,0xFF,0x5B,0x0D,0x8B,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x8B,0x16,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,
-    0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0xEF,0x5D,0xFF,0xC6,0x59,0xDA,0x5B,0x2D,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xD6,0xBA,0xCC,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,
-    0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE6,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xAD,0x76,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x31,0x41,0xEF,0x5D,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,
-    0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE6,0xFC,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1B,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0xC6,0x39,0x83,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xD6,0xBA,0xE5,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE6,0xFC,0xFF,
-    0xE6,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0xCE,0x79,0x8B,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0xD0,0x2A,0xE7,0x3C,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1B,0xFF,0xDF,0x1C,0xFF,0xDF,0x1B,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,
-    0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1B,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1B,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0xB5,0x96,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xD7,0x95,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xE6,0xFC,0xFF,0xDF,0x1B,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1B,0xFF,0xE6,0xFC,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1B,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDF,0x1B,0xFF,0xDF,0x1B,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,
-    0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDF,0x1C,0xFF,0x73,0xEF,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0xD6,0xBA,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,
-    0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xC6,0x59,0xD4,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x8E,0x12,0xDF,0x1C,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,
-    0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xDE,0xFB,0xFF,0x7C,0x10,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x31,0x31,0xE7,0x1C,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,
-    0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xDE,0xDB,0xFF,0xBD,0xF7,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xF4,0x49,0xDF,0x1C,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,
-    0xDE,0xDB,0xFF,0xD6,0xDA,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDA,0xFF,0xD6,0xDB,0xFF,0xD6,0xDA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x34,0x5F,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xBB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,
-    0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDA,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDA,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xDA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xDE,0xDB,0xFF,0x63,0x6D,0x23,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x34,0x5A,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xDB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xDB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,
-    0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0x84,0x51,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xD3,0x4F,0xDE,0xFB,0xFF,0xD6,0xDA,0xFF,0xD6,0xBA,0xFF,0xD6,0xDA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,
-    0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0x94,0xB3,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x11,0x2D,0xDE,0xDB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,
-    0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0x94,0xB3,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x4D,0x13,0xDE,0xDB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,
-    0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0xBA,0xFF,0x8C,0x72,0x72,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xCE,0x79,0xFA,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,
-    0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xD6,0x9A,0xFF,0x7B,0xCF,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x75,0x95,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,
-    0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x99,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x99,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x99,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x99,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x99,0xFF,0xCE,0x99,0xFF,0xCE,0x7A,0xFF,0xCE,0x99,0xFF,0xCE,0x99,0xFF,0xCE,0x9A,0xFF,0xCE,0x79,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x9A,0xFF,0x52,0x8A,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8E,0x24,0xD6,0xDB,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x99,0xFF,0xCE,0x99,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x99,0xFF,0xCE,0x7A,0xFF,0xCE,0x99,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x79,0xFF,0xCE,0x99,0xFF,0xCE,0x99,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,
-    0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xC6,0x18,0xFF,0x21,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xC6,0x18,0xE2,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,
-    0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xC6,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x9A,0xFF,0x9C,0xF4,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8F,0x33,0xD6,0xBA,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x79,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,
-    0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0x5B,0x0C,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xAD,0xB6,0xBE,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xA5,0x55,0xCC,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE9,0x11,0xBD,0xF8,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x58,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x58,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x58,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x58,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x58,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0x52,0xAB,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x0C,0x4C,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x58,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x58,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x58,0xFF,
-    0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x58,0xFF,0xC6,0x38,0xFF,0xC6,0x58,0xFF,0xC6,0x58,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xCE,0x9A,0xFF,0x7C,0x10,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x5B,0x0D,0x8D,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x19,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,
-    0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xCE,0x79,0xFF,0x94,0xD3,0x74,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0xAB,0x8A,0xB5,0xB6,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,
-    0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x39,0xFF,0x8C,0x72,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x31,0x94,0xD3,0xDA,0xBD,0xF8,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,
-    0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xC6,0x18,0xFF,0xB5,0xD7,0xED,0x6B,0x8F,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0xEB,0x1B,0xA5,0x34,0x64,0xC6,0x38,0xBE,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0xBE,0x18,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,
-    0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBE,0x17,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBE,0x17,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBE,0x18,0xFF,0xBE,0x17,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xC6,0x18,0xFF,0xBD,0xF8,0xF4,0x94,0xB2,0x67,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x9D,0x96,0x0A,0xBD,0xF7,0x18,0xC6,0x18,0x29,0xC6,0x38,0x3D,0xC6,0x38,0x50,0xC6,0x38,0x64,0xC6,0x18,0x76,0xC6,0x38,0x86,0xC6,0x18,0x95,0xC6,0x38,0xA4,0xC6,0x38,0xAF,0xC6,0x38,0xBC,0xC6,0x38,0xC6,0xC6,0x38,0xCE,0xC6,0x18,0xD6,0xC6,0x38,0xDE,0xC6,0x38,0xE2,0xC6,0x38,0xE9,0xC6,0x38,0xED,0xC6,0x38,0xEF,0xC6,0x38,0xF4,0xC6,0x38,0xF6,0xC6,0x18,0xF8,0xC6,0x38,0xFA,0xC6,0x18,0xFD,0xC6,0x18,0xFD,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFD,0xC6,0x38,0xFD,0xC6,0x38,0xFA,0xC6,0x38,0xFA,
-    0xC6,0x38,0xF8,0xC6,0x18,0xF6,0xC6,0x18,0xF4,0xC6,0x18,0xF2,0xC6,0x18,0xED,0xC6,0x18,0xE9,0xC6,0x18,0xE5,0xC6,0x18,0xDE,0xC6,0x38,0xD8,0xC6,0x18,0xD0,0xBE,0x18,0xC8,0xC6,0x18,0xBC,0xC6,0x18,0xAF,0xC6,0x38,0xA1,0xC6,0x18,0x90,0xC6,0x18,0x7C,0xBE,0x18,0x63,0xBD,0xD7,0x48,0x9C,0xF4,0x2D,0x7B,0xCF,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_cloudy_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_cloudy_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_cloudy_png_data
-};
-
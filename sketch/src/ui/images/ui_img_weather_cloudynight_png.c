@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/cloudynight.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_cloudynight_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0x45,0x06,0x21,0xC7,0x0D,0x29,0x67,0x16,0x29,0x87,0x1E,0x29,0x88,0x23,0x29,0xA8,0x26,0x29,0x88,0x23,0x29,0x87,0x1E,0x29,0x66,0x17,0x21,0xC7,0x0D,0x29,0x45,0x06,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x21,0x67,0x21,0x19,0x48,0x49,0x11,0x48,0x86,0x11,0x29,0xD4,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xD2,0x19,0x48,0x88,0x21,0x68,0x4A,0x29,0x47,0x1E,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x02,0x21,0x68,0x22,0x19,0x48,0x69,0x11,0x28,0xD4,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x28,0xCC,0x19,0x48,0x5A,0x29,0xA8,0x18,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x88,0x23,0x19,0x48,0x86,0x11,0x28,0xFA,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xEB,
-    0x21,0x68,0x69,0x29,0xC7,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x29,0x07,0x19,0x68,0x52,0x11,0x28,0xE7,0x11,0x28,0xFF,
-    0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x19,0x48,0xC4,0x29,0x67,0x31,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0x19,0x48,0x72,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xE7,0x21,0x68,0x3C,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x19,0x48,0x72,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x48,0xD4,0x21,0x87,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x68,0x42,0x11,0x28,0xF2,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x19,0x48,0xBA,0x31,0x88,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xC7,0x0D,0x19,0x48,0xBC,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x21,0x68,0x50,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x68,0x47,0x11,0x29,0xFD,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x19,0x48,0xBC,0x21,0xC7,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x19,0x48,0x93,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xF8,0x29,0x87,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x48,0x0C,0x19,0x48,0xD2,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x21,0x88,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x87,0x15,0x11,0x28,0xED,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x21,0x68,0x8A,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xA7,0x21,0x11,0x28,0xFA,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x48,0x9C,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x88,0x20,0x11,0x28,0xFD,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x48,0x9A,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x68,0x1C,0x11,0x28,0xFA,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x68,0x98,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xA6,0x0E,0x11,0x28,0xF4,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x21,0x68,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x11,0x48,0xDC,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x21,0x87,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x19,0x28,0xB3,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x29,0x87,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x68,0x63,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xEF,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x88,0x20,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,
-    0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x48,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x11,0x28,0xE0,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x10,0xE7,0xFF,0x08,0xC7,0xFF,0x11,0x08,0xFF,0x21,0x69,0xFF,0x29,0xCB,0xFF,0x3A,0x2C,0xFF,0x3A,0x4C,0xFF,0x3A,0x4C,0xFF,0x32,0x2C,0xFF,0x31,0xEB,0xFF,0x21,0x89,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x21,0x68,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x68,0x74,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,
-    0x11,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x48,0xFF,0x11,0x08,0xFF,0x21,0x6A,0xFF,0x4A,0xCF,0xFF,0x94,0xF6,0xFF,0xD6,0xBB,0xFF,0xEF,0x7E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xBF,0xFF,0xEF,0x7E,0xFF,0xCE,0xBB,0xFF,0x95,0x15,0xFF,0x4A,0xCE,0xFF,0x11,0x49,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xF4,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x88,0x14,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x19,0x29,0xFF,0x19,0x49,0xFF,0x5B,0x30,0xFF,0xC6,0x3A,0xFF,0xF7,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xD6,0xBB,0xFF,0xA5,0x57,0xFF,0x74,0x12,0xFF,0x4A,0xAD,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x48,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x28,0xB5,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x49,0xFF,
-    0x19,0x69,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x6B,0xD2,0xFF,0xD6,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDF,0xFF,0xEF,0x7E,0xFF,0xAD,0xB8,0xFF,0x5B,0x2F,0xFF,0x21,0xAA,0xFF,0x11,0x08,0xFF,0x08,0xC7,0xFF,0x08,0xC7,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x29,0x67,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x88,0x29,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x49,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x4A,0xCE,0xFF,0xC6,0x5A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xEF,0x5E,0xFF,0x94,0xF6,0xFF,0x32,0x0C,0xFF,0x08,0xC7,0xFF,0x08,0xC7,0xFF,0x09,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0xCE,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x21,0x69,0xFF,
-    0x84,0x53,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xB5,0xD8,0xFF,0x29,0xCB,0xFF,0x00,0xA6,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0x88,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x68,0x27,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x10,0xE7,0xFF,0x21,0x4A,0xFF,0xCE,0x5A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x5B,0x70,0xFF,0x00,0xA7,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x48,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x48,0xC0,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x10,0xE8,0xFF,0x31,0xEC,0xFF,0xCE,0x9B,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x3D,0xFF,0x3A,0x2D,0xFF,0x09,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x29,0xA8,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x88,0x14,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x31,0xEA,0xFF,0xDE,0xFB,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0x7A,0xFF,0x21,0xAB,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x63,0x70,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x48,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x48,0x79,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x21,0xA9,0xFF,0xE7,0x3B,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,
-    0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0x9A,0xFF,0x21,0x8A,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x5B,0x0F,0xFF,0xEF,0x7D,0xFF,0x53,0x0F,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x07,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x11,0x28,0xFD,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x19,0x28,0xFF,0xC6,0x59,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x3D,0xFF,0x29,0xCB,0xFF,0x19,0x49,0xFF,0x19,0x6A,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xFF,0x32,0x2C,0xFF,0xE7,0x1D,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0xFF,0x32,0x0C,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x21,0x68,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x68,0x29,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x08,0xA8,0xFF,0x8C,0x75,0xFF,0xF7,0xDF,0xFF,0xF7,0xBF,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,
-    0xFF,0xBF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0x4A,0xAE,0xFF,0x11,0x29,0xFF,0x19,0x6A,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x4A,0x8D,0xFF,0xDF,0x1C,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xE7,0x5D,0xFF,0x5B,0x4F,0xFF,0x10,0xE8,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x48,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0A,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x48,0x90,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x10,0xE7,0xFF,0x4A,0x8E,0xFF,0xF7,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0x84,0x74,0xFF,0x11,0x08,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x4A,0xCE,0xFF,0xDE,0xFC,0xFF,0xF7,0xBE,0xFF,0xEF,0x7D,0xFF,0x7C,0x12,0xFF,0x19,0x49,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x39,0xC7,0x09,0x00,0x00,0x00,0x29,0x68,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x11,0x28,0xFD,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x27,0xFF,0xCE,0x79,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,
-    0xF7,0xBE,0xFF,0xFF,0xBF,0xFF,0xF7,0xDE,0xFF,0xFF,0xDE,0xFF,0xDE,0xFB,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x08,0xE7,0xFF,0x52,0xEE,0xFF,0xE7,0x5D,0xFF,0x84,0x94,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x21,0x87,0x39,0x00,0x00,0x00,0x39,0xC7,0x0D,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x88,0x19,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x63,0x6F,0xFF,0xFF,0xDE,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,0x5B,0x50,0xFF,0x08,0xC7,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x63,0x90,0xFF,0x08,0xC7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x48,0x95,0x00,0x00,0x00,0x31,0x88,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x68,0x56,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0xD6,0xFC,0xFF,0xF7,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,
-    0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xCE,0xBB,0xFF,0x08,0xE8,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFA,0x00,0x00,0x01,0x39,0xC7,0x12,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x48,0xB1,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x19,0x29,0xFF,0x19,0x29,0xFF,0x11,0x08,0xFF,0x4A,0x8E,0xFF,0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0x9F,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0x74,0x13,0xFF,0x08,0xC7,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x31,0x88,0x0F,0x29,0xA6,0x17,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x28,0xFD,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x49,0xFF,0x19,0x28,0xFF,0xB5,0xB7,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,
-    0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xE7,0x5D,0xFF,0x29,0xAB,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x21,0x88,0x34,0x29,0xA8,0x1C,
-    0x00,0x00,0x00,0x21,0xC7,0x0D,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x31,0xEA,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xB5,0xD8,0xFF,0x10,0xE8,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,
-    0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x21,0x68,0x69,0x31,0x88,0x23,0x00,0x00,0x00,0x29,0x88,0x25,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x09,0x08,0xFF,0x52,0xEE,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9F,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,
-    0xF7,0x9E,0xFF,0xFF,0xDE,0xFF,0x74,0x12,0xFF,0x08,0xE7,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x28,0xAF,0x31,0xA7,0x30,
-    0x00,0x00,0x00,0x21,0x68,0x44,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x84,0x73,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xDF,0xFF,0x4A,0xCE,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x19,0x28,0xF8,0x31,0xA7,0x54,0x00,0x00,0x00,0x19,0x48,0x6D,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0xB5,0xD8,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,
-    0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0x29,0xEB,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0xA7,0xF4,
-    0x00,0x00,0x00,0x19,0x48,0x97,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x49,0xFF,0xDE,0xDB,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xE7,0x5C,0xFF,0x19,0x69,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0x87,0xFF,0x00,0x00,0x00,0x19,0x48,0xB7,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x29,0xAA,0xFF,0xEF,0x5D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xF7,0x7E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x7E,0xFF,
-    0xF7,0x9E,0xFF,0xD6,0xDB,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0x87,0xFF,
-    0x00,0x00,0x00,0x11,0x48,0xD8,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x31,0xEB,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xF7,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xCE,0x9A,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0x19,0x29,0xFF,0x19,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x29,0x87,0xFF,0x00,0x00,0x00,0x11,0x28,0xEF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x3A,0x0B,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,
-    0xF7,0x9E,0xFF,0xCE,0x9B,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x29,0x88,0xFF,
-    0x00,0x00,0x00,0x11,0x28,0xF4,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x08,0xFF,0x31,0xEB,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xF7,0x9E,0xFF,0xD6,0xDB,0xFF,0x19,0x69,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x10,0xE7,0xFF,0x08,0xC7,0xFF,0x10,0xE7,0xFF,
-    0x11,0x07,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x29,0x87,0xFF,0x00,0x00,0x00,0x11,0x28,0xF4,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x08,0xFF,0x29,0xCA,0xFF,0xE7,0x3D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,
-    0xEF,0x9E,0xFF,0xDF,0x1C,0xFF,0x21,0xAA,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x32,0x0C,0xFF,0x63,0x91,0xFF,0x94,0xF5,0xFF,0xAD,0xD8,0xFF,0xBE,0x39,0xFF,0xB5,0xF8,0xFF,0xA5,0x97,0xFF,0x7C,0x33,0xFF,0x52,0xEE,0xFF,0x21,0x69,0xFF,0x10,0xE7,0xFF,0x11,0x08,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0x87,0xFF,
-    0x00,0x00,0x00,0x11,0x28,0xEB,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x19,0x69,0xFF,0xD6,0xDB,0xFF,0xEF,0x7D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0x32,0x0B,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x08,0xE7,0xFF,0x4A,0xAE,0xFF,0xBE,0x39,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,
-    0xE7,0x5D,0xFF,0xA5,0x57,0xFF,0x32,0x0C,0xFF,0x11,0x07,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x29,0x87,0xFF,0x00,0x00,0x00,0x11,0x48,0xCC,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0xBE,0x19,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,
-    0xEF,0x5D,0xFF,0xF7,0x9E,0xFF,0x4A,0xCE,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x10,0xC7,0xFF,0x29,0xAC,0xFF,0xAD,0x77,0xFF,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xEF,0x5D,0xFF,0x9D,0x36,0xFF,0x21,0x6A,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0xA7,0xFF,
-    0x00,0x00,0x00,0x19,0x48,0xAD,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x08,0xE7,0xFF,0x94,0xF5,0xFF,0xEF,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xEF,0x9E,0xFF,0x74,0x12,0xFF,0x09,0x08,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x10,0xE7,0xFF,0x42,0x4D,0xFF,0xD6,0x9B,0xFF,0xEF,0x7E,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,
-    0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0xCE,0x7A,0xFF,0x3A,0x2C,0xFF,0x11,0x08,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x29,0x87,0xFF,0x00,0x00,0x00,0x19,0x48,0x8B,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x63,0x70,0xFF,0xEF,0x7D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,
-    0xE7,0x5D,0xFF,0xEF,0x7D,0xFF,0xAD,0xB7,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x42,0x4C,0xFF,0xE7,0x3C,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x9E,0xFF,0xDE,0xDB,0xFF,0x3A,0x4D,0xFF,0x11,0x07,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x11,0x07,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x29,0xA7,0xFF,
-    0x00,0x00,0x00,0x21,0x68,0x5D,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x08,0xE7,0xFF,0x32,0x0B,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x5D,0xFF,0xDF,0x1C,0xFF,0x29,0xEB,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x48,0xFF,0x11,0x27,0xFF,0x29,0xEA,0xFF,0xE7,0x5C,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5C,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5C,0xFF,
-    0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x7D,0xFF,0xDE,0xFC,0xFF,0x29,0xAB,0xFF,0x42,0x6D,0xFF,0x63,0x70,0xFF,0x63,0x90,0xFF,0x4A,0xAD,0xFF,0x29,0xAA,0xFF,0x10,0xE8,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x31,0xA7,0x52,0x00,0x00,0x00,0x21,0x87,0x39,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0xCE,0x7A,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,
-    0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xEF,0x7D,0xFF,0x73,0xF2,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x08,0xFF,0xA5,0x97,0xFF,0xEF,0x7D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5C,0xFF,0xE7,0x3D,0xFF,0xEF,0x3D,0xFF,0xE7,0x5C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5C,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x5C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x1C,0xFF,0xCE,0x7A,0xFF,0x84,0x53,0xFF,0x21,0x89,0xFF,0x10,0xE7,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x19,0x48,0xFF,0x31,0xA8,0x18,
-    0x00,0x00,0x00,0x29,0xA8,0x1C,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x08,0xE7,0xFF,0x7C,0x12,0xFF,0xE7,0x5D,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x5D,0xFF,0xC6,0x39,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x08,0xFF,0x5B,0x30,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x5C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x5C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1D,0xFF,
-    0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x5D,0xFF,0xCE,0x9A,0xFF,0x63,0x50,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x21,0x68,0xE0,0x31,0xA6,0x0E,0x00,0x00,0x00,0x29,0x4A,0x06,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x09,0x08,0xFF,0x29,0xCA,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,
-    0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3D,0xFF,0x5B,0x4F,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x10,0xE7,0xFF,0xB5,0xD8,0xFF,0xE7,0x3D,0xFF,0xDF,0x1C,0xFF,0xDF,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1D,0xFF,0xE7,0x1C,0xFF,0xDF,0x3C,0xFF,0xE7,0x3D,0xFF,0xDF,0x3C,0xFF,0xDF,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xDF,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3D,0xFF,0xEF,0x5D,0xFF,0x7C,0x32,0xFF,0x19,0x49,0xFF,0x19,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0x87,0x8A,0x31,0x86,0x0A,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x48,0xEB,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0xAD,0xB7,0xFF,0xE7,0x3C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xC6,0x5A,0xFF,0x11,0x29,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x31,0xCB,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,
-    0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xEF,0x7D,0xFF,0x73,0xF2,0xFF,0x11,0x08,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0xA7,0x3A,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x68,0x8E,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x3A,0x4C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,
-    0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFC,0xFF,0x6B,0xD2,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x73,0xF2,0xFF,0xE7,0x3C,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1B,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1B,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1B,0xFF,0xDE,0xFC,0xFF,0xDF,0x1B,0xFF,0xDF,0x1B,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1B,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0x4A,0xAD,0xFF,0x11,0x49,0xFF,0x19,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x29,0x68,0x0B,0x29,0x45,0x06,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x87,0x39,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x08,0xE8,0xFF,0x9D,0x35,0xFF,0xE7,0x3C,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0x3A,0x6D,0xFF,0x08,0xE7,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0xA5,0x56,0xFF,0xDF,0x1C,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,
-    0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xE7,0x3D,0xFF,0xB5,0xB8,0xFF,0x10,0xE8,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x48,0xD4,0x00,0x00,0x00,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x08,0x0C,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x10,0xE9,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x2A,0x0B,0xFF,0xCE,0x9A,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,
-    0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xDB,0xFF,0xB5,0xF8,0xFF,0x29,0xEB,0xFF,0x08,0xE7,0xFF,0x21,0x89,0xFF,0x5B,0x4F,0xFF,0x94,0xD5,0xFF,0xB5,0xD8,0xFF,0xBE,0x39,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xD6,0xFB,0xFF,0xDE,0xDC,0xFF,0xD6,0xFB,0xFF,0xDE,0xFB,0xFF,0xD6,0xFB,0xFF,0xDE,0xDB,0xFF,0xD6,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0x42,0x8D,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x29,0x87,0x55,0x00,0x00,0x00,0x52,0xAA,0x03,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x48,0xE0,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x09,0x48,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x09,0x07,0xFF,0x63,0x70,0xFF,0xE7,0x3C,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0x9A,0xFF,0xD6,0xBB,0xFF,0xBE,0x19,0xFF,0x5B,0x50,0xFF,0xD6,0xBB,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xDE,0xFC,0xFF,0xD6,0xFB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,
-    0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDF,0x1C,0xFF,0x94,0xD4,0xFF,0x08,0xE8,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x31,0xA6,0x0E,0x00,0x00,0x00,0x04,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x68,0x5C,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x8C,0xB4,0xFF,0xDF,0x1C,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,
-    0xD6,0x9B,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xB5,0xD7,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0x19,0x48,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xE7,0x11,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x09,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x47,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x69,0xFF,0xAD,0x97,0xFF,0xD6,0xDB,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xDA,0xFF,0xD6,0xDA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,
-    0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xCE,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xCE,0xBA,0xFF,0xBE,0x39,0xFF,0x09,0x08,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x29,0x87,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x48,0xD4,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x48,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x08,0xFF,0x19,0x69,0xFF,0xAD,0xB7,0xFF,0xD6,0xBB,0xFF,0xCE,0x9A,0xFF,
-    0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0x9B,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xCE,0xBA,0xFF,0xD6,0x9B,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9B,0xFF,0xCE,0xBA,0xFF,0xCE,0xBA,0xFF,0xCE,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0x94,0xF4,0xFF,0x53,0x0E,0xFF,0x19,0x48,0xFF,0x08,0xE7,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x19,0x48,0xFF,0x29,0x68,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x88,0x3F,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x09,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x19,0x69,0xFF,0xA5,0x56,0xFF,0xCE,0xBA,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,
-    0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xC6,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xAD,0x96,0xFF,0x3A,0x4C,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x21,0x68,0xD8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x11,0x48,0xF8,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x47,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x07,0xFF,0x11,0x07,0xFF,0x94,0xD4,0xFF,
-    0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x99,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xC6,0x79,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0x4A,0xAD,0xFF,0x10,0xE8,0xFF,0x29,0xA7,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x68,0x6C,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x09,0x48,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x52,0xED,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xC6,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,
-    0xCE,0x7A,0xFF,0xC6,0x79,0xFF,0xCE,0x7A,0xFF,0xC6,0x79,0xFF,0xC6,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xC6,0x79,0xFF,0xCE,0x5A,0xFF,0xC6,0x79,0xFF,0xC6,0x59,0xFF,0xCE,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x79,0xFF,0xC6,0x79,0xFF,0xC6,0x79,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0x42,0x6B,0xFF,0x31,0xC7,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x08,0x11,0x28,0xFD,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x10,0xE8,0xFF,0x29,0xCB,0xFF,0x8C,0xB4,0xFF,0xCE,0x7A,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x79,0xFF,0xC6,0x79,0xFF,0xC6,0x79,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x79,0xFF,0xC6,0x79,0xFF,0xC6,0x5A,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x7A,0xFF,0xA5,0x55,0xFF,0x31,0xE8,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x68,0x6C,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x21,0x89,0xFF,0xC6,0x38,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xBE,0x39,0xFF,0xC6,0x39,0xFF,0xBE,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0x5A,0xEC,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x29,0x07,0x11,0x28,0xF8,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x27,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x32,0x0B,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x19,0xFF,0xC6,0x19,0xFF,0xBE,0x38,0xFF,0xBE,0x39,0xFF,0xBE,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x38,0xFF,0xC6,0x19,0xFF,0xC6,0x39,0xFF,0x84,0x31,0xFF,0x29,0x67,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x87,0x4D,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x09,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x32,0x0B,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x38,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x39,0xFF,0xBE,0x38,0xFF,0xBE,0x39,0xFF,0xC6,0x19,0xFF,0xBE,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x38,0xFF,
-    0xBE,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x19,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x19,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x38,0xFF,0xBE,0x18,0xFF,0xC6,0x38,0xFF,0xBE,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0x9C,0xF4,0xFF,0x29,0x86,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x19,0x48,0xD4,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x10,0xE8,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x28,0xFF,0x29,0xAA,0xFF,0xBD,0xF7,0xFF,0xC6,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0xA5,0x35,0xFF,0x31,0xA7,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA7,0x1D,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x48,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x29,0xFF,0xA5,0x76,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,
-    0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xB5,0xD7,0xFF,0x9D,0x14,0xFF,0x31,0xA7,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x68,0x6F,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x74,0x11,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xB5,0xF7,0xFF,0xBD,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xF7,0xFF,0xBD,0xD8,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xD8,0xFF,0xB5,0xD7,0xFF,0xB5,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xD8,0xFF,0xB5,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xF7,0xFF,0xB5,0xF7,0xFF,0xB5,0xD8,0xFF,0xB5,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xB5,0xF8,0xFF,0xBD,0xF8,0xFF,0x94,0xB3,0xFF,0x2A,0x08,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x19,0x48,0xD0,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x07,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x07,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x09,0x08,0xFF,0x3A,0x2B,0xFF,0xBE,0x17,0xFF,0xBD,0xD7,0xFF,0xBD,0xD7,0xFF,0xBD,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD8,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD8,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,
-    0xB5,0xB7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xBD,0xF8,0xFF,0x6B,0xAF,0xE7,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x10,0x11,0x28,0xFA,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x8C,0x93,0xFF,0xBD,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xB7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xAD,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xAD,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0x42,0x4A,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x88,0x30,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x29,0xCB,0xFF,0xAD,0x96,0xFF,0xB5,0xD7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB6,0xFF,0xB5,0xB6,0xFF,0xB5,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0x96,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB7,0xFF,0xAD,0xB6,0xFF,0xAD,0xB7,0xFF,0xAD,0xB6,0xFF,0xAD,0xB7,0xFF,0xAD,0xB6,0xFF,0xB5,0xB7,0xFF,0xB5,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0x96,0xFF,0xB5,0xB7,0xFF,
-    0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xB5,0x97,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB7,0xFF,0xAD,0xB7,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xB5,0xB7,0xFF,0xB5,0xD7,0xFF,0x7C,0x10,0xFA,0x29,0x4A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x87,0x68,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x10,0xE9,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x08,0xFF,0x4A,0xAD,0xFF,0xAD,0x96,0xFF,0xB5,0xB7,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0xB6,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xB5,0xB7,0xFF,0xA5,0x35,0xFF,0x3A,0x08,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x67,0x8E,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x07,0xFF,0x42,0x8C,0xFF,0xAD,0x96,0xFF,0xB5,0xB7,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x76,0xFF,0xAD,0x76,0xFF,0xAD,0x96,0xFF,0xAD,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xAD,0x76,0xFF,0xAD,0x76,0xFF,0xAD,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xAD,0x76,0xFF,0xA5,0x76,0xFF,0xAD,0x76,0xFF,
-    0xA5,0x56,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xAD,0x75,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xAD,0x76,0xFF,0xA5,0x76,0xFF,0xA5,0x76,0xFF,0xAD,0x76,0xFF,0xAD,0x76,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0xB6,0xFF,0xA5,0x35,0xFD,0x3A,0x08,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x67,0x9D,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x27,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x29,0xCA,0xFF,0x7C,0x11,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xAD,0x76,0xFF,0xA5,0x56,0xFF,0xA5,0x56,0xFF,0xA5,0x56,0xFF,0xA5,0x56,0xFF,0xA5,0x55,0xFF,0xA5,0x56,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x56,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x56,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x55,0xFF,0xA5,0x56,0xFF,0xA5,0x56,0xFF,0xA5,0x76,0xFF,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0x84,0x31,0x9C,0x42,0x28,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x21,0x67,0x93,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x29,0xEA,0xFF,0x53,0x0E,0xFF,0x7C,0x32,0xFF,0x8C,0xB3,0xFF,0x94,0xD4,0xFF,0x94,0xF4,0xFF,0x94,0xF4,0xFF,0x94,0xF4,0xFF,0x94,0xF4,0xFF,0x94,0xD4,0xFF,0x94,0xD4,0xFF,0x94,0xF4,0xFF,0x9C,0xF4,0xFF,0x94,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,
-    0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9D,0x14,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9D,0x14,0xFF,0x9C,0xF4,0xFF,0x9D,0x14,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x9C,0xF4,0xFF,0x94,0xD3,0xFF,0x8C,0x92,0xFF,0x73,0xAF,0x93,0x42,0x8A,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x47,0x6B,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,
-    0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x09,0x28,0xFF,0x09,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x19,0x48,0xFF,0x19,0x49,0xFF,0x19,0x69,0xFF,0x19,0x68,0xFF,0x19,0x68,0xFF,0x19,0x69,0xFF,0x19,0x69,0xFF,0x19,0x69,0xFF,0x21,0x69,0xFF,0x21,0x69,0xFF,0x19,0x69,0xFF,0x19,0x69,0xFF,0x21,0x69,0xFF,0x21,0x69,0xFF,0x19,0x69,0xFF,0x21,0x69,0xFF,0x19,0x68,0xFF,0x19,0x68,0xFF,0x19,0x68,0xFF,0x21,0x68,0xFF,0x21,0x68,0xFF,0x19,0x68,0xFF,0x19,0x68,0xFF,0x19,0x69,0xFF,0x19,0x68,0xFF,0x21,0x68,0xFF,0x31,0xC8,0xDA,0x39,0xE8,0x95,0x39,0xE8,0xD6,0x39,0xE8,0x90,0x31,0xC8,0x3A,0x29,0x4A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x67,0x43,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,
-    0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x21,0x88,0x74,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA8,0x18,0x11,0x48,0xDE,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x10,0xE9,0xFF,0x09,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,
-    0x11,0x29,0xFF,0x09,0x48,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x21,0x87,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x19,0x47,0x8E,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x09,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x09,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x19,0x29,0xFF,
-    0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x19,0x48,0xF4,0x29,0xA7,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x67,0x2E,0x11,0x28,0xE7,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,
-    0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x49,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x21,0x68,0xBA,0x29,0x68,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x19,0x47,0x6D,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x09,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x09,0xFF,
-    0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x49,0xFF,0x11,0x48,0xFA,0x29,0x87,0x4F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x67,0x11,0x19,0x48,0x9C,0x09,0x28,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,
-    0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x48,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x19,0x29,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x21,0x68,0x92,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x67,0x16,0x19,0x48,0xA6,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,
-    0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x21,0x67,0xAA,0x31,0x87,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA8,0x13,0x19,0x48,0x7F,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x27,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x09,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x29,0xFF,0x11,0x48,0xFF,0x21,0x68,0x95,0x29,0x67,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x21,0x68,0x4A,0x11,0x48,0xD6,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x29,0xFF,0x19,0x29,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x29,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,
-    0x19,0x48,0xED,0x21,0x68,0x5C,0x29,0x65,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x31,0x88,0x10,0x21,0x67,0x56,0x11,0x48,0xD8,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x09,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x09,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x48,0xFF,0x19,0x48,0xF8,0x29,0x88,0x80,0x31,0x87,0x20,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0x29,0x87,0x2E,0x21,0x68,0x77,0x19,0x48,0xE2,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x08,0xFF,0x11,0x08,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x11,0x28,0xFF,0x19,0x48,0xFF,0x19,0x68,0xFF,0x21,0x87,0xBC,0x29,0xA7,0x54,0x29,0xA6,0x17,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x10,0x02,0x04,0x10,0x02,0x04,0x10,0x02,0x52,0xAA,0x03,0x52,0xAA,0x03,0x52,0xAA,0x03,0x42,0x08,0x04,0x42,0x08,0x04,0x31,0x86,0x05,0x31,0x86,0x05,0x29,0x45,0x06,0x22,0x49,0x07,0x39,0xC7,0x09,0x31,0x86,0x0A,
-    0x2A,0x08,0x0C,0x31,0x88,0x0F,0x29,0xA6,0x13,0x29,0xA6,0x18,0x31,0x87,0x1E,0x31,0x87,0x29,0x31,0xA7,0x39,0x31,0xA7,0x60,0x31,0xA7,0xFD,0x31,0x87,0xFF,0x29,0x87,0xFF,0x29,0x87,0xFF,0x29,0x87,0xFF,0x21,0x87,0xFF,0x21,0x68,0xFF,0x21,0x67,0xFF,0x21,0x67,0xFF,0x21,0x87,0xFF,0x21,0x87,0xFF,0x21,0x87,0xFF,0x29,0x87,0xFF,0x29,0x87,0xFF,0x29,0xA7,0xFF,0x31,0xA7,0xFF,0x31,0xA7,0xFF,0x31,0xA7,0x9F,0x31,0xC7,0x20,0x31,0x88,0x14,0x31,0xA6,0x0E,0x29,0x65,0x0B,0x39,0xC7,0x09,0x22,0x49,0x07,0x29,0x45,0x06,0x31,0x86,0x05,0x42,0x08,0x04,0x42,0x08,0x04,0x52,0xAA,0x03,0x52,0xAA,0x03,0x52,0xAA,0x03,0x52,0xAA,0x03,0x04,0x10,0x02,0x00,0x10,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_cloudynight_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_cloudynight_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_cloudynight_png_data
-};
-
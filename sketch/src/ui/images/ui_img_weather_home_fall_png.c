@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/home_fall.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_home_fall_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x04,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x02,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x1B,0xFF,0xFF,0x4D,0xF7,0xBD,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x8E,0xFF,0xFF,0xFB,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xF7,0x08,0xF7,0xBC,0x20,0xF7,0x5B,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xAD,0x4A,0x03,0xFD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xDE,0x82,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xBE,0xA2,0xFF,0xDE,0x89,0xFF,0xFF,0xE5,0xFF,0xFF,0xF6,0xFF,0xFF,0xF1,0xFF,0xFF,0xBA,0xFF,0xDD,0x29,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0x7B,0x10,0xFF,0xFF,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0x9D,0x29,0x00,0x00,0x00,0xFF,0xF5,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xDC,0xCD,0x32,0xDD,0x71,0x5B,0xCD,0x51,0x4A,0x00,0x00,0x00,0xFD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xBD,0x17,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xB6,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xDC,0xCE,0x54,0xDB,0xC9,0xFF,0xEC,0x8C,0xFF,0xDD,0x51,0x9D,0x00,0x00,0x00,0xFD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFD,0xF7,0x04,0xFF,0xDE,0x42,0xFF,0xDE,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xFE,0xFB,0x08,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xF7,0x04,0xFF,0xFF,0x04,0xFF,0xF0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0x00,0x00,0x00,0xDD,0x30,0x2E,
-    0xDC,0x0B,0xFF,0xCB,0x47,0xFC,0xCA,0xE5,0xFC,0xDC,0x2B,0xEC,0xDE,0xF7,0x0F,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0x00,0xF7,0xBD,0x20,0xFF,0xFF,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF9,0x05,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xF0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF5,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x00,0x00,0xDD,0x51,0xBB,0xDB,0x68,0xFF,0xEB,0xA9,0xFF,0xDC,0x4C,0xE7,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDF,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xA8,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x39,0x42,0xFF,0x39,0x8E,0xFF,0x39,0x8E,0xF7,0x19,0x19,0x00,0x00,0x00,0xD6,0xB5,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x08,0x04,0x00,0x00,0x00,
-    0xD3,0xEB,0x6C,0xD3,0xEB,0xE0,0xDD,0x92,0xA9,0xDC,0x4C,0x4F,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDE,0x67,0xFF,0xDE,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFC,0xFF,0x9C,0x29,0x00,0x00,0x00,0xFD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x04,0xFC,0x10,0x02,0xF7,0x39,0xA3,0xFF,0x9B,0xFF,0xFF,0x9B,0xFF,0xFF,0xDB,0xFF,0xF7,0x39,0xE6,0xF7,0x38,0x20,0x00,0x00,0x00,0xFF,0xF9,0x05,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xDF,0x89,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xE7,0xFF,0xFF,0xF5,0xFF,0xFF,0xF7,0xFF,0xFF,0xF3,0xFF,0xDF,0xC3,0xFF,0x9C,0x35,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x39,0x54,0xFF,0xFC,0xFF,0xF7,0x39,0xFA,0xF7,0x39,0xFB,0xF7,0x39,0xF8,0xFF,0x7A,0xFF,0xF7,0x39,0xF0,0xFF,0x39,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x08,0x04,0xFD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xF7,0xBD,0x20,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0x9C,0x61,0x00,0x00,0x01,0xFF,0xFE,0x1B,0xFF,0xFE,0x1F,0xF7,0x9E,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xF7,0x38,0x20,0xF7,0x39,0x71,0xF7,0x19,0xD3,0xF7,0x39,0xFF,0xF7,0x39,0xF9,0xF7,0x39,0xFB,0xF7,0x39,0xFB,0xF7,0x39,0xF5,0xFF,0x7A,0xFF,0xF7,0x39,0xDF,0xF7,0x19,0x1A,0xF7,0x18,0x12,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xBD,0xE8,0x04,0xFD,0xE8,0x04,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xDE,0x54,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xDE,0xED,0xFF,0xBD,0xA1,0xFF,0xDE,0xC9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x39,0xD4,0xFF,0xFE,0xFF,0xFF,0xBB,0xFF,0xFF,0x9A,0xFF,0xFF,0x9B,0xFF,0xFF,0xBB,0xFF,0xFF,0xBB,0xFF,0xFF,0xBB,0xFF,0xFF,0x9B,0xFF,0xFF,0x9B,0xFF,0xFF,0xBB,0xFF,0xFF,0x19,0xF9,0xFF,0x39,0x26,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xDE,0x55,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0xF7,0x39,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDE,0x65,0xFF,0xFF,0xC2,0xFF,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xBB,0xFF,0xBE,0x5E,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFC,0x10,0x02,0xFF,0xF0,0x02,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xF7,0x39,0x74,0xF7,0x39,0xA5,0xF7,0x39,0xA8,0xF7,0x39,0xAA,0xF7,0x39,0xA4,0xF7,0x39,0x9F,0xF7,0x19,0x9B,0xF7,0x19,0x97,0xFF,0x19,0x94,0xFF,0x39,0x92,0xF7,0x39,0x84,0xF7,0x19,0x73,0xFF,0x59,0x22,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xE5,0x4E,0x1E,0xED,0xAE,0x63,0xF5,0xCB,0x64,0xED,0x8C,0x1E,0x00,0x00,0x00,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0x39,0x15,0xFF,0xDF,0xF9,0xFF,0xFF,0xFF,0xFF,0xDE,0xDB,0xFF,0x18,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0xF5,0xAB,0xBA,0xFD,0x69,0xFF,0xFD,0xA7,0xFF,0xF5,0x8B,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xBE,0x49,0xFF,0xDE,0xAD,0xFF,0xDF,0xFC,0xFF,0xDF,0xFE,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xC1,0xFF,0xBE,0x7B,0xF7,0x7D,0x2C,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFD,0xF7,0x04,0xFD,0xF7,0x04,0xFF,0xF5,0x03,0xFF,0xFF,0x03,0xBD,0xF7,0x04,0xFF,0xF7,0x04,0xFF,0xF7,0x04,0xCE,0x79,0x05,0xFE,0x79,0x05,0xFE,0x79,0x05,0xCE,0x79,0x05,0xFF,0xF7,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE8,0x04,0x00,0x00,0x00,0xFD,0xED,0x86,0xFD,0xC9,0xFF,0xE4,0xA6,0xF1,0xFD,0x87,0xFF,0xF5,0x6A,0xB0,0x00,0x00,0x00,0xFC,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x54,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7B,0x00,0x00,0x00,0xFF,0xFF,0x03,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x84,0x10,0x02,0x00,0x00,0x00,0xFD,0x4A,0x03,0xAA,0xA0,0x03,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0xFD,0x50,0x06,0x00,0x00,0x00,0xF5,0xAB,0x34,0xFD,0xAA,0xF5,0xF5,0x89,0xFF,0xFD,0x68,0xFF,0xF5,0x8C,0xA2,0x00,0x00,0x00,0xFD,0x40,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xFF,0xFF,0x02,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDD,0x23,0xFF,0xDE,0x34,0xFF,0xDE,0x36,0xFF,0xDE,0x34,0xFF,0xDD,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xE6,0x37,0xAA,0xE5,0xD6,0xFF,0xDD,0x95,0xF7,0xD5,0x75,0xFF,0xD5,0x54,0xFF,0xD5,0x33,0xFF,0xCD,0x34,0xFE,0xCD,0x95,0xFC,0xD6,0x18,0xF7,0xEE,0xDA,0xFF,0xE6,0x78,0xBB,0x00,0x00,0x00,0xFC,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x2C,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x90,0x0A,0xFE,0x0C,0x79,0xED,0xAC,0xFA,0xDD,0x4F,0x8F,0x00,0x00,0x00,0xFC,0x00,0x02,0x00,0x00,0x00,0xFF,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x4E,0xFF,0xFF,0xC3,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xBC,0xFF,0xBE,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xD5,0x55,0x06,0x00,0x00,0x00,0xD4,0x8F,0xBF,0xB8,0x00,0xFF,0xB9,0x40,0xFB,0xB9,0x20,0xFF,0xB0,0xC0,0xFF,0xB0,0x80,0xFF,0x88,0x00,0xFF,0x88,0x00,0xFF,0x88,0x00,0xFB,0xA0,0x00,0xFF,0xB3,0x8A,0xB6,0x00,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x0E,0x0B,0xE5,0x93,0x14,0x00,0x00,0x00,0xDC,0x6C,0x45,0xC3,0x69,0xBB,0xC4,0x4E,0x30,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0xFD,0xF0,0x04,0xCC,0xCC,0x05,0xFD,0x4A,0x03,0xFD,0xB2,0x07,0xDD,0x2F,0x51,0xDC,0xEE,0x57,0xDD,0x0F,0x36,0xDC,0xEE,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xF7,0x08,0xFE,0x31,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,
-    0xFF,0xFD,0x0E,0xFF,0xFF,0xB1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xB0,0xF7,0x5B,0x3D,0xE6,0x73,0x0A,0xFE,0xD2,0x07,0xA8,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x19,0x94,0xE6,0x15,0xFF,0x9A,0x46,0xFC,0xAA,0xE9,0xFF,0xAA,0xE8,0xFF,0xA2,0xA8,0xFF,0x92,0x67,0xFF,0x92,0x67,0xFC,0x92,0x67,0xFF,0xBC,0x6F,0xAB,0xED,0x96,0x0D,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x08,0x04,0x00,0x00,0x00,0xD4,0x0B,0x60,0xD3,0xEB,0xF0,0xDC,0xEF,0x7F,0xCB,0x27,0xFD,0xDB,0x27,0xFF,0xD3,0xEB,0x62,0x00,0x00,0x00,0xBC,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDD,0x2F,0x30,0xD4,0xCD,0x5F,0xD4,0xEE,0x72,0xD4,0xCD,0x45,0x00,0x00,0x00,0xBD,0xE8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0xBC,0x1C,0xFF,0xFF,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0xFF,0xDE,0xE5,0xFF,0xDE,0xD9,0xFF,0xDF,0xBE,0xFF,0xFF,0xAC,0xFF,0xBE,0x7D,0xFF,0xFE,0x55,0xDE,0x14,0xA7,0xAB,0x48,0xFF,0xA3,0x48,0xFD,0xAB,0x48,0xFF,0x9A,0xE7,0xFF,0x8A,0x45,0xFF,0x8A,0x45,0xFB,0x92,0xA7,0xFF,0x8A,0x80,0x46,0x00,0x00,0x00,0xBC,0xF3,0x08,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x00,0x03,0x00,0x00,0x00,0xD4,0x6D,0xAD,0xE3,0x68,0xFF,0xDB,0x89,0xFF,0xCA,0xE6,0xF9,0xDB,0x48,0xFF,0xD4,0xAE,0x6A,0x00,0x00,0x00,0xAA,0xAA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x00,0x02,0xD4,0xEE,0x3D,0xDD,0x50,0x7C,0xDD,0x71,0x88,0xDD,0x0F,0x6C,0xDC,0xEE,0x55,0xD5,0x0F,0x26,0xFE,0xD6,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0xF8,0x00,0x01,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0x9C,0x11,0xFF,0xFE,0xE2,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xEE,0xFB,0xFF,0xD5,0x34,0xFF,0xDE,0x38,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xFA,0xF8,0x92,0x21,0xFF,0x9A,0xC8,0xFF,0xA3,0x08,0xFF,0xA3,0x07,0xFF,0x8A,0x46,0xFF,0x8A,0x66,0xFC,0x92,0x66,0xFF,0xD5,0xD4,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x00,0x03,0x00,0x00,0x00,0xDC,0xCF,0xAB,0xDB,0x69,0xFF,0xCA,0xE7,0xF7,0xCA,0xE6,0xFD,0xD3,0x89,0xFF,0xDC,0xAE,0xDC,0xD3,0xAA,0x41,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xD4,0xAD,0x38,0xDD,0x50,0x84,0xE5,0xF3,0x75,0xEE,0x34,0x6F,0xE5,0xF3,0x73,0xDD,0x71,0x7F,0xD4,0xAD,0x84,0xD4,0xCE,0x74,0xD4,0x8D,0x65,0xDC,0xCE,0x28,0x00,0x00,0x00,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFE,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xEE,0xFA,0xFF,0xB0,0x80,0xFF,0xB9,0x00,0xFF,0xB0,0x00,0xFF,0xD5,0x34,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFD,0xF7,0xBE,0xFF,0x9B,0x49,0xFF,0x8A,0x03,0xFF,0x9B,0x08,0xFF,0x9A,0xE7,0xFF,0x8A,0x46,0xFF,0x92,0x87,0xFF,0x81,0x00,0xFD,0xF7,0x5C,0xFF,0xFF,0xFF,0xBF,0xD5,0xD1,0x0B,0x00,0x00,0x00,
-    0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0xFF,0xF9,0x05,0xCB,0xEB,0xE3,0xD2,0xE6,0xFF,0xC2,0xC6,0xF9,0xD3,0x28,0xFC,0xD2,0xC5,0xF9,0xEB,0x67,0xFF,0xD4,0x0B,0x81,0x00,0x00,0x00,0xFD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xCC,0xCC,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xDE,0x59,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
-    0xFF,0xDE,0xFF,0xBB,0x8D,0xFF,0xB1,0x02,0xFF,0xBA,0xA9,0xFF,0xC2,0xA9,0xFF,0xB1,0x60,0xFF,0xEF,0x1B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x3C,0xFF,0xA3,0x49,0xFF,0xA3,0x07,0xFF,0xA3,0x28,0xFF,0x8A,0x66,0xFF,0x92,0x87,0xFF,0x81,0x40,0xFF,0xE6,0xDA,0xFA,0xFF,0xFF,0xFF,0xFF,0xDE,0xCE,0xFD,0xF0,0x04,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0xE5,0x71,0x69,0xD4,0x4D,0xFF,0xD3,0x68,0xFF,0xDB,0x27,0xFF,0xE4,0x4C,0xFF,0xDC,0xCF,0x8B,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x10,0x04,0xFD,0xF0,0x04,0xFD,0xF7,0x04,0xFD,0xF0,0x04,0xFD,0xF0,0x04,0xBC,0x10,0x04,0xFF,0xF0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xDE,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x38,0xFF,0xA8,0x00,0xFF,0xA2,0x27,0xFF,0x92,0x06,0xFF,0xBA,0x89,0xFF,0xB0,0xC0,0xFF,0xD5,0x54,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x3C,0xFF,0xA3,0x47,0xFF,0xA3,0x08,0xFF,0x92,0x87,0xFF,0x92,0xA7,0xFF,0x81,0x80,0xFF,0xE6,0xFB,0xFF,0xFF,0xFF,0xF8,0xFF,0xFF,0xFF,0xFF,0xDE,0xB0,
-    0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xE7,0x18,0x11,0xCD,0x72,0x9B,0xDC,0xCE,0x55,0xD3,0xAA,0xD1,0xDD,0x51,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFC,0x10,0x02,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x02,0xBC,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0xBD,0xFF,0xFF,0xFF,0xEE,0xDA,0xFC,
-    0xBA,0x88,0xFF,0xAA,0x06,0xFF,0x8A,0x06,0xFF,0x8A,0x66,0xFF,0x9A,0x46,0xFF,0xB2,0x27,0xFF,0xB2,0x47,0xFF,0xF7,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xDA,0xFF,0x9A,0x60,0xFF,0x89,0xE3,0xFF,0x8A,0x04,0xFF,0x70,0x00,0xFF,0xE6,0xDA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xBE,0x81,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x4C,0x0D,0xA8,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x73,0x05,0x00,0x00,0x00,0xEE,0xD8,0xA0,0xDC,0xF2,0xFF,0xB9,0xE5,0xFA,0xBA,0x67,0xFF,0x9A,0x06,0xFF,0x8A,0x46,0xFF,0x9A,0xC7,0xFF,0x92,0x86,0xFF,0x9A,0x68,0xFF,0xB1,0x01,0xFF,0xC4,0x91,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x17,0xFF,0x92,0xE9,0xFF,0xA3,0xEE,0xFF,0xA4,0x0E,0xFF,0xEF,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFC,
-    0xFF,0xFF,0xFF,0xFF,0xBD,0x4C,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0xCC,0x05,0x00,0x00,0x01,0xFF,0xF0,0x02,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x84,0x10,0x02,0x00,0x00,0x00,0xDE,0x73,0x0F,0xF6,0x2D,0x20,0xED,0xA9,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xE4,0xF0,0x1A,0xD4,0x6D,0xAB,0xDC,0x4C,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x08,0xC3,0xED,0xE3,0xB8,0xC0,0xFF,0xC2,0xA9,0xFD,
-    0xA2,0x47,0xFF,0x8A,0x25,0xFF,0x92,0x86,0xFF,0x9A,0xC7,0xFF,0x92,0xA7,0xFF,0x8A,0x46,0xFF,0xAA,0x88,0xFF,0xB9,0x20,0xFF,0xD5,0x13,0xFF,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xF7,0x7A,0x1F,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xF5,0xAA,0x79,0xF5,0xCB,0xE9,0xFD,0xC9,0xFF,0xF5,0x89,0x84,0x00,0x00,0x00,0xFD,0xE8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0x00,0x00,0x00,0xE4,0xEF,0x34,0xDB,0x68,0xFF,0xD3,0x48,0xFF,0xDB,0xAA,0xC2,0xE5,0x30,0x2A,0x00,0x00,0x00,0xAA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0x00,0x05,0x00,0x00,0x00,0xC3,0x8B,0x89,0xC2,0x28,0xFF,0xBA,0x68,0xFB,0xAA,0x07,0xFF,0x8A,0x25,0xFF,0x9A,0xA7,0xFF,0xAB,0x28,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xA3,0x07,0xFF,0x92,0x86,0xFF,0xBA,0x89,0xFF,0xB9,0x83,0xFF,0xBB,0x4C,0xFF,0xBC,0xF3,0xFF,0xD6,0x17,0xFF,0xE6,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xDE,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x8A,0x95,0xFD,0xC9,0xFF,0xF5,0x07,0xFF,0xF5,0x47,0xFF,0xFE,0x0A,0x2D,0x00,0x00,0x00,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0x00,0x00,0x00,0xDC,0xAE,0x37,0xD3,0x48,0xFF,0xC2,0xE7,0xFA,0xE3,0x48,0xFF,0xDB,0xEB,0xFD,0xED,0xB2,0x2E,0x00,0x00,0x00,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x26,0x05,0x00,0x00,0x00,0xCC,0x6F,0x58,0xC2,0x68,0xFF,0xB2,0x07,0xFD,0xAA,0x07,0xFF,0x81,0xC5,0xFF,
-    0x92,0x66,0xFF,0xA2,0xE7,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xA3,0x07,0xFF,0xA2,0x86,0xFF,0xC2,0xA9,0xFF,0xC2,0x47,0xFF,0xA8,0x00,0xFF,0x78,0x00,0xFF,0x80,0x00,0xFF,0xAB,0xCF,0xFF,0xF7,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xDE,0x9C,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xFF,0xE0,0x01,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x0D,0xC7,0xE5,0x8F,0xFF,0xF5,0x48,0xEA,0xED,0x08,0xEA,0xF5,0x89,0x57,0x00,0x00,0x00,0xB4,0x89,0x07,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0xDC,0xAE,0x1D,0xD3,0x69,0xF9,0xCB,0x07,0xFF,0xCB,0x28,0xF7,0xE3,0x89,0xFF,0xDC,0x4D,0xB7,0x00,0x00,0x00,0xA8,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x10,0x04,0x00,0x00,0x00,0xE5,0xF3,0x26,0xC3,0x0A,0xFF,0xB9,0xE6,0xFF,0xBA,0x27,0xFD,0x89,0xA5,0xFF,0x82,0x05,0xFF,0x9A,0xC7,0xFF,0xAB,0x08,0xFF,0xA3,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xB3,0x28,0xFF,0xA2,0xE7,0xFF,0xAA,0x47,0xFF,0xBA,0x48,0xFF,0xBA,0x68,0xFF,0xA2,0x28,0xFF,0x91,0xC7,0xFF,0x88,0x00,0xFF,0xA3,0x6D,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xBE,0x65,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF6,0x52,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0xAB,0xCC,0xAC,0x8F,0xDD,0xFF,0xFE,0x1D,0xE5,0x49,0x1B,0xFF,0xF6,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x08,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x02,0x00,0x00,0x00,0xD3,0xAA,0xBB,0xE3,0x89,0xFF,0xC3,0x07,0xF5,0xD3,0x48,0xFF,0xDB,0x48,0xD0,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x2B,0xD0,0xC2,0x07,0xFF,0xC2,0x28,0xFB,0x99,0xC6,0xFF,0x79,0xE4,0xFF,0x8A,0x26,0xFF,
-    0x92,0xA7,0xFF,0x92,0x86,0xFF,0x9A,0xA7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0xA2,0xE7,0xFF,0x8A,0x66,0xFF,0xA2,0x07,0xFF,0xB2,0x27,0xFF,0xB2,0x07,0xFF,0x99,0xA6,0xFF,0x9A,0x28,0xFF,0x90,0x00,0xFF,0xD6,0x17,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9C,0x33,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x40,0x03,0x00,0x00,0x00,0xF5,0x6A,0xB6,0xF5,0x69,0xBF,0xBC,0x00,0x04,0xFF,0xFF,0x14,0xDD,0x31,0xD8,0xA3,0xAB,0xE3,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x69,0x20,0x4A,0x72,0x02,0x64,0x82,0x46,0x44,0xDD,0xB2,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0xCC,0x4C,0x25,0xD3,0x69,0xE6,0xE3,0x68,0xFF,0xDB,0x69,0xFF,0xDC,0xCF,0xD8,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0x04,0x00,0x00,0x00,0xC3,0x8C,0x9D,0xC2,0x27,0xFF,0xBA,0x27,0xF9,0xA9,0xE6,0xFF,0x81,0xE5,0xFF,0x92,0x66,0xFF,0xA2,0xC7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0xA2,0xE7,0xFF,0xA3,0x08,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xA2,0xE7,0xFF,0x8A,0x46,0xFF,0xAA,0x27,0xFF,0xBA,0x27,0xFF,0xB2,0x07,0xFF,0x91,0xC6,0xFF,0x91,0x23,0xFF,0x9A,0xEB,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xDF,0xE3,0xFF,0x58,0x0D,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xFD,0x40,0x03,0x00,0x00,0x00,0xF5,0x49,0xAA,0xFD,0xE7,0xFF,0xF5,0xCC,0xD0,0xE5,0x52,0xDE,0xF3,0xAA,0xFF,0xD4,0x0C,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x80,0x6F,0x8B,0x29,0xEF,0xB4,0xAF,0xFF,0xC5,0x11,0xFF,0xAC,0x4E,0xFF,0x7A,0x87,0xED,0x82,0xC8,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0x00,0x00,0x00,0xDD,0x30,0x0E,0xDB,0xEB,0x5D,0xCC,0x8E,0x88,0xC5,0x72,0x7C,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0x00,0x05,0x00,0x00,0x00,0xCC,0x0E,0x6D,0xC2,0x68,0xFF,0xB2,0x07,0xFB,0xA9,0xE7,0xFF,0x89,0xC5,0xFF,0x8A,0x46,0xFF,0xA2,0xC7,0xFF,0xA3,0x07,0xFF,
-    0x9A,0xA7,0xFF,0x9A,0x86,0xFF,0xAB,0x28,0xFF,0xB3,0x68,0xFF,0xAB,0x28,0xFF,0x9A,0x86,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0x9A,0xA7,0xFF,0x92,0x26,0xFF,0xBA,0x27,0xFF,0xBA,0x47,0xFF,0xBA,0x27,0xFF,0x9A,0x07,0xFF,0x80,0x00,0xFF,0xCD,0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xDE,0xB9,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xCC,0xC6,0x05,0x00,0x00,0x00,0xF5,0x8B,0x7A,0xFD,0xE8,0xFF,0xF5,0x48,0xFF,0xD3,0x28,0xFF,0xDB,0x08,0xFF,0xCB,0x69,0x6E,0x00,0x00,0x00,0x71,0xE3,0x80,0xB4,0x6E,0xFF,0xF6,0xB7,0xFF,0xFF,0x18,0xFC,0xFF,0x38,0xFB,0xFF,0x39,0xFC,0xE6,0x76,0xFF,0xA3,0xCC,0xFF,0x7A,0x46,0xA2,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x10,0x04,0x00,0x00,0x00,0xE5,0xB3,0x5A,0xC2,0xEA,0xFF,0xB1,0xE6,0xFE,0xB2,0x07,0xFE,0x89,0xA5,0xFF,0x8A,0x25,0xFF,0x9A,0xA7,0xFF,0xAB,0x08,0xFF,0x9A,0x86,0xFF,0xBB,0xA9,0xFF,0xDC,0xEC,0xFF,0xE5,0x2D,0xFF,0xE5,0x4D,0xFF,0xED,0x6E,0xFF,0xDC,0xEC,0xFF,0xAB,0x28,0xFF,0xA2,0xC7,0xFF,0xA3,0x07,0xFF,0xAB,0x08,0xFF,0x9A,0xA7,0xFF,0xAA,0x47,0xFF,0xC2,0x47,0xFF,0xC2,0x47,0xFF,0xB2,0x07,0xFF,0x99,0x64,0xFF,0x9A,0x07,0xFF,0xF7,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xBE,0x88,0x00,0x00,0x00,0xFF,0xFF,0x05,0xF8,0x00,0x01,0x00,0x00,0x00,0xCD,0x93,0x0A,0xF5,0xAA,0xB9,0xFD,0x29,0xFF,0xD2,0x67,0xFB,0xDA,0xC7,0xFF,0xD3,0xAA,0x32,0x83,0xCC,0x1D,0x8B,0x09,0xFF,0xEE,0xB7,0xFE,0xF6,0xF8,0xFC,0xF6,0xB7,0xFF,0xF6,0xB7,0xFF,0xF6,0xD7,0xFF,0xFF,0x39,0xFD,0xEE,0xB7,0xF9,0x8B,0x09,0xFF,0x7A,0xA7,0x61,0x00,0x00,0x00,0x82,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xBC,0x08,0x04,0xCB,0x2C,0x05,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x55,0x03,0x00,0x00,0x00,0xF6,0x96,0x23,0xC3,0x6C,0xFA,0xB9,0xE6,0xFF,0xBA,0x48,0xFC,0x91,0xA6,0xFF,0x79,0xC5,0xFF,0x82,0x25,0xFF,0x9A,0xA6,0xFF,0x92,0x46,0xFF,0xCC,0x2A,0xFF,
-    0xED,0x6E,0xFF,0x93,0x6A,0xFF,0xAC,0x0B,0xFF,0xCC,0xED,0xFF,0x6A,0x88,0xFF,0xCC,0xCC,0xFF,0xED,0x4D,0xFF,0xAB,0x27,0xFF,0x9A,0x86,0xFF,0x9A,0xA7,0xFF,0xA2,0xC7,0xFF,0x92,0x66,0xFF,0xB2,0x27,0xFF,0xBA,0x27,0xFF,0xBA,0x47,0xFF,0xA2,0x27,0xFF,0x88,0x00,0xFF,0xC5,0x34,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xBE,0x56,0x00,0x00,0x00,0xFF,0xFF,0x05,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x4D,0x75,0xC2,0xE8,0xFF,0xB3,0x8B,0xE3,0x00,0x00,0x00,0x58,0x00,0x71,0xBC,0xF0,0xFF,0xFF,0x18,0xFA,0xF6,0xD7,0xFF,0xF6,0xF8,0xFF,0xF6,0xD8,0xFF,0xF6,0xF8,0xFF,0xEE,0xD8,0xFF,0xFF,0x18,0xFC,0xD5,0x93,0xFF,0x71,0xE4,0xDA,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xE0,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0xCD,0xD2,0xB9,0xE6,0xFF,0xBA,0x48,0xFB,0xA1,0xE6,0xFF,0x81,0xE5,0xFF,0x8A,0x46,0xFF,0x9A,0xC7,0xFF,0x9A,0x87,0xFF,0xAB,0x48,0xFF,0xED,0x4D,0xFF,0x7A,0xE9,0xFF,0x00,0x07,0xFF,0x9B,0xCB,0xFF,0xCC,0xCD,0xFF,0x00,0x07,0xFF,0x00,0xA7,0xFF,0xC4,0x8B,0xFF,0xE5,0x0C,0xFF,0x9A,0xA7,0xFF,0xA2,0xC7,0xFF,0xAA,0xE7,0xFF,0xAA,0xE7,0xFF,0x9A,0x66,0xFF,0xB2,0x27,0xFF,0xBA,0x47,0xFF,0xBA,0x27,0xFF,0x99,0xA6,0xFF,0x88,0xA0,0xFF,0xEF,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0x7C,0x29,0x00,0x00,0x00,0xFF,0xFF,0x03,0x84,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x7A,0xE9,0xBF,0x7A,0xE9,0xF0,0x00,0x00,0x00,0x58,0x40,0x87,0xD5,0xD3,0xFF,0xFF,0x38,0xFB,0xE6,0x76,0xFF,0xE6,0x34,0xFF,0xF6,0x11,0xFF,0xF5,0xCF,0xFF,0xF6,0x33,0xFF,0xF6,0xD7,0xFF,0xEE,0x76,0xFD,0x8B,0x09,0xFF,0xBC,0xD0,0x3D,0x00,0x00,0x00,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x03,0x00,0x00,0x00,0xCC,0x2E,0x9D,0xC2,0x07,0xFF,0xBA,0x27,0xFA,0xB2,0x07,0xFF,0x81,0xC5,0xFF,0x8A,0x45,0xFF,0x9A,0xA7,0xFF,0xAB,0x08,0xFF,0x9A,0x86,0xFF,0xD4,0x8B,0xFF,0xA3,0xAA,0xFF,
-    0x00,0x07,0xFF,0x00,0xE7,0xFF,0x9B,0x8A,0xFF,0xC4,0x8C,0xFF,0x00,0x07,0xFF,0x01,0x48,0xFF,0x31,0x87,0xFF,0xE5,0x2C,0xFF,0xBB,0xC9,0xFF,0xA2,0xC7,0xFF,0xAB,0x08,0xFF,0xB3,0x08,0xFF,0xA2,0xE7,0xFF,0xA2,0x46,0xFF,0xBA,0x27,0xFF,0xBA,0x27,0xFF,0xB2,0x48,0xFF,0x78,0x00,0xFF,0xAC,0x51,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xDF,0xD7,0xFD,0x40,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0x9B,0x26,0x05,0x00,0x00,0x00,0x82,0xC8,0x7A,0x7A,0x87,0xFF,0xEE,0x96,0x1C,0x72,0x04,0x90,0xDE,0x35,0xFF,0xFF,0x7A,0xFB,0xD5,0xF4,0xFF,0xED,0x09,0xFF,0xFD,0x05,0xFF,0xF4,0xA0,0xFF,0xF5,0xCF,0xFF,0xF6,0xF7,0xFF,0xF6,0xD7,0xFB,0x9B,0xCC,0xFF,0xAC,0x4E,0x56,0x00,0x00,0x00,0xBC,0x10,0x04,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x06,0x00,0x00,0x00,0xDD,0x52,0x81,0xCA,0xEA,0xFF,0xBA,0x07,0xFA,0xBA,0x27,0xFF,0x89,0xA5,0xFF,0x8A,0x45,0xFF,0x9A,0xA6,0xFF,0xAA,0xE8,0xFF,0xA2,0xE8,0xFF,0xA2,0xE7,0xFF,0xDC,0xCC,0xFF,0x93,0x69,0xFF,0x7B,0x09,0xFF,0x72,0xE9,0xFF,0xAC,0x2B,0xFF,0xCC,0xAC,0xFF,0x6A,0xA8,0xFF,0x83,0x29,0xFF,0x72,0xC9,0xFF,0xD4,0xEC,0xFF,0xCC,0x6A,0xFF,0xA2,0xA7,0xFF,0xAB,0x08,0xFF,0xAB,0x07,0xFF,0xB3,0x08,0xFF,0xA2,0xC7,0xFF,0xA2,0x27,0xFF,0xBA,0x27,0xFF,0xBA,0x27,0xFF,0xAA,0x27,0xFF,0x78,0x00,0xFF,0xDE,0x58,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
-    0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xDE,0x97,0x00,0x00,0x00,0xB5,0xB6,0x07,0x84,0x10,0x02,0x00,0x00,0x00,0xA4,0x0C,0x2B,0x82,0x87,0xFF,0xAC,0x8F,0x7A,0xB4,0xB0,0x98,0xD5,0x93,0xFF,0xFF,0x7A,0xF7,0xF6,0x11,0xFC,0xF4,0xC0,0xFE,0xFC,0xE6,0xFF,0xF5,0x4A,0xFF,0xF6,0xB6,0xFF,0xF6,0xF7,0xFF,0xF6,0xD7,0xFC,0x9B,0xAC,0xFF,0xAC,0x4E,0x44,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xF0,0x04,0x00,0x00,0x00,0xDD,0x72,0x3B,0xC3,0x0A,0xFF,0xB9,0xE6,0xFE,0xC2,0x48,0xFE,0x91,0xA5,0xFF,0x81,0xE5,0xFF,0x92,0x66,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0xA2,0xE7,0xFF,0xE5,0x0D,0xFF,0xD4,0xAC,0xFF,
-    0xCC,0xAC,0xFF,0xCC,0xAC,0xFF,0xDD,0x0D,0xFF,0xDD,0x0D,0xFF,0xCC,0x8B,0xFF,0xCC,0xCC,0xFF,0xCC,0xCC,0xFF,0xED,0x8E,0xFF,0xCC,0x8B,0xFF,0x9A,0x66,0xFF,0xA2,0xE7,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0x8A,0x26,0xFF,0xAA,0x07,0xFF,0xBA,0x27,0xFF,0xBA,0x47,0xFF,0xA1,0xA5,0xFF,0x89,0xA5,0xFF,0xEF,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0x00,0x00,0x00,0xB5,0xB6,0x07,0x00,0x00,0x01,0x00,0x00,0x00,0x82,0xC8,0xCC,0x82,0xE9,0xFB,0xEE,0xD8,0xE5,0xB4,0x8F,0xFF,0xFF,0x18,0xFF,0xFE,0xD5,0xFF,0xFD,0x8D,0xFF,0xDC,0x86,0xFE,0xEE,0x33,0xFF,0xF6,0xF7,0xFF,0xF6,0xF8,0xFE,0xE6,0x96,0xFF,0x93,0x4A,0xFA,0xDE,0x35,0x23,0x00,0x00,0x00,0xFC,0x10,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDD,0x0F,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x02,0x00,0x00,0x00,0xFF,0x79,0x10,0xC3,0x4B,0xE1,0xC1,0xE7,0xFF,0xC2,0x48,0xFC,0xA9,0xE6,0xFF,0x79,0xC4,0xFF,0x8A,0x45,0xFF,0x9A,0xA7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xA7,0xFF,0xE5,0x0D,0xFF,0x6A,0xA8,0xFF,0x01,0x47,0xFF,0x00,0x87,0xFF,0x93,0x8A,0xFF,0xBC,0x6B,0xFF,0x00,0x27,0xFF,0x39,0xE8,0xFF,0x00,0x88,0xFF,0xD5,0x2D,0xFF,0xCC,0x4A,0xFF,0x92,0x46,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xA7,0xFF,0x92,0x26,0xFF,0xB2,0x07,0xFF,0xBA,0x27,0xFF,0xB2,0x48,0xFF,0x80,0xC0,0xFF,0x8A,0x07,0xFF,0xE6,0xDA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9E,0xFF,0xDE,0x79,0xFF,0xC5,0x95,0xFF,0xC5,0x75,0xFF,
-    0xD6,0x17,0xFF,0xEF,0x1B,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xCE,0x17,0xFD,0xAC,0xF2,0xFF,0xB4,0xD2,0xE9,0x79,0xA0,0x46,0x00,0x00,0x00,0x82,0xAA,0x06,0x00,0x00,0x00,0xD5,0xF4,0x90,0x7A,0x04,0xFF,0xCD,0x72,0xFF,0xE6,0x76,0xE2,0xA3,0xEC,0xB5,0xF6,0xD7,0xB8,0xDE,0x14,0xED,0xA4,0x4E,0xFF,0xF6,0xD7,0xFE,0xF6,0xB6,0xFF,0xFF,0x18,0xFC,0xD5,0xD4,0xFF,0x9B,0xAC,0xDB,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0xDC,0xEE,0x62,0xDD,0x2F,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x02,0xBC,0x08,0x04,0xFA,0xAA,0x03,0xBD,0xF0,0x04,0x00,0x00,0x00,0xFF,0xFF,0x17,0xD5,0x32,0xE4,0xB9,0x65,0xFF,0xBA,0x48,0xFC,0xB2,0x07,0xFF,0x81,0xA4,0xFF,0x8A,0x45,0xFF,0xA2,0xC7,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xA2,0xC7,0xFF,0xD4,0xCC,0xFF,0xBC,0x8C,0xFF,
-    0x00,0x07,0xFF,0x19,0x88,0xFF,0x9B,0xAA,0xFF,0xC4,0x8B,0xFF,0x19,0x88,0xFF,0x01,0x28,0xFF,0x83,0x2A,0xFF,0xED,0x8E,0xFF,0xAB,0x48,0xFF,0xA2,0xE7,0xFF,0xAB,0x08,0xFF,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0x9A,0xC7,0xFF,0x9A,0x26,0xFF,0xBA,0x27,0xFF,0xBA,0x27,0xFF,0xB2,0x48,0xFF,0x91,0x63,0xFF,0x88,0x00,0xFF,0xBC,0xB2,0xFF,0xDE,0x79,0xFF,0xE6,0xFB,0xFF,0xE6,0xFB,0xFF,0xD6,0x59,0xFF,0xB4,0xD3,0xFF,0x8A,0x07,0xFF,0x78,0x00,0xFF,0x78,0x00,0xFF,0x80,0x00,0xFF,0x80,0x00,0xFF,0x80,0x00,0xFF,0x9B,0x2C,0xFF,0xC5,0x75,0xFF,0xE6,0xFB,0xFF,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xFB,0xFF,0x9C,0x4F,0xFF,0xF7,0x7C,0xFC,0xEF,0x1A,0xFF,0xAC,0x6E,0xFF,0x69,0xA0,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x1C,0xAC,0x8F,0xDB,0x79,0xE3,0xFF,0xC5,0x31,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xE9,0xAB,0xE6,0x14,0xFF,0xFE,0xF7,0xFB,0xF6,0xB6,0xFF,0xFF,0x18,0xFB,0xA4,0x2D,0xFF,0x93,0x8A,0x4D,0x00,0x00,0x00,0x9B,0x2C,0x05,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xCE,0x6B,0xD4,0xEE,0x94,0xDD,0x30,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x9A,0x38,0xD4,0x4F,0xFF,0xB0,0x00,0xF8,0xB1,0xE7,0xFA,0x89,0x23,0xFC,0x8A,0x05,0xFF,0x9A,0xA6,0xFF,0xAB,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x08,0xFF,0xA3,0x07,0xFF,0xAB,0x48,0xFF,0xED,0x8E,0xFF,0xA4,0x0B,0xFF,0x00,0x06,0xFF,0x93,0x6A,0xFF,0xBC,0x6C,0xFF,0x00,0x07,0xFF,0x72,0xEA,0xFF,0xED,0x8E,0xFF,0xCC,0x4B,0xFF,0x9A,0x86,0xFF,0xAB,0x08,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xAB,0x07,0xFF,0x92,0xA6,0xFF,0xAA,0x26,0xFF,0xBA,0x47,0xFF,0xBA,0x47,0xFF,0xAA,0x27,0xFF,0x91,0xE6,0xFF,0x88,0x00,0xFF,0x80,0x00,0xFF,0x80,0x00,0xFF,0x80,0x00,0xFF,0x78,0x00,0xFF,0x78,0x00,0xFF,0x89,0x24,0xFF,0x89,0xC6,0xFF,0x89,0xE6,0xFF,0x89,0xE7,0xFF,
-    0x91,0xE7,0xFF,0x89,0xA6,0xFF,0x88,0x80,0xFF,0x80,0x00,0xFF,0x78,0x00,0xFF,0x92,0xCA,0xFF,0xAC,0x50,0xFF,0xC5,0x95,0xFF,0xAC,0x91,0xFF,0xBD,0x33,0xFF,0xE6,0xB9,0xFF,0xB4,0xF2,0xFC,0xC5,0x51,0xFC,0xD5,0xB3,0xFF,0x82,0x87,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0xEE,0x96,0x3C,0x82,0xC8,0xFF,0x69,0xA3,0xF4,0xBC,0xF0,0x20,0x00,0x00,0x00,0x82,0xE8,0xBC,0xF6,0xB6,0xFF,0xFF,0x38,0xF7,0xFF,0x38,0xF6,0xC5,0x51,0xFF,0x82,0xE8,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0xD4,0xAD,0x3C,0xDD,0x91,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xAD,0x3E,0xD4,0xCE,0xA3,0xDD,0x0F,0xA6,0xDD,0x50,0xA8,0xDD,0x50,0xA5,0xD4,0xCD,0x93,0xD4,0xCD,0x3C,0x00,0x00,0x00,0xDD,0x52,0xB3,0xD3,0xAC,0xFF,0xB3,0x2A,0xFF,0x92,0xE9,0xFF,0x9A,0xA6,0xFD,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xAB,0x07,0xFF,0xBB,0xA9,0xFF,
-    0xED,0x6E,0xFF,0xC4,0xCD,0xFF,0xBC,0x8C,0xFF,0xD5,0x0D,0xFF,0xB4,0x6C,0xFF,0xED,0xAF,0xFF,0xCC,0x6B,0xFF,0x9A,0x86,0xFF,0xAB,0x28,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0x9A,0x86,0xFF,0xBA,0x47,0xFF,0xBA,0x27,0xFF,0x99,0xA5,0xFF,0x89,0x85,0xFF,0x91,0xC6,0xFF,0x91,0xE7,0xFF,0x91,0xA6,0xFF,0x91,0xA6,0xFF,0x91,0xC6,0xFF,0x91,0xC6,0xFF,0x89,0x85,0xFF,0x89,0x65,0xFF,0x89,0x65,0xFF,0x89,0x65,0xFF,0x89,0x65,0xFF,0x89,0x85,0xFF,0x91,0xA6,0xFF,0x91,0xE7,0xFF,0x91,0xA6,0xFF,0x88,0xA1,0xFF,0x78,0x00,0xFF,0x70,0x00,0xFF,0x78,0x00,0xFF,0x78,0x00,0xFF,0x68,0x00,0xFF,0x58,0x00,0xFF,0xD5,0xB3,0xFE,0xFF,0x59,0xF9,0xBC,0xD0,0xFF,0x9B,0xAC,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x9B,0xEC,0x75,0x72,0x05,0xFF,0x8B,0x09,0xAB,0x00,0x00,0x00,0x8B,0x6B,0xA0,0xCD,0x52,0xFF,0xE6,0x76,0xFF,0xCD,0x72,0xFF,0xAC,0x6E,0xE3,0x00,0x00,0x00,0xED,0xEF,0x4E,0xED,0xAC,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x30,0x9E,0xDD,0x50,0x93,0xFE,0xB5,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x2A,0x15,0xCC,0x2A,0x32,0xCC,0x0A,0x26,0xDD,0x0F,0x21,0xFD,0xF3,0x08,0x00,0x00,0x00,0xFF,0xFF,0x03,0xE6,0x76,0x5F,0xE6,0x76,0x75,0xE6,0x76,0xBA,0xB3,0xCB,0xFF,0xA2,0xC6,0xFD,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x28,0xFF,0xA2,0xC7,0xFF,0xA3,0x07,0xFF,0xCC,0x8B,0xFF,0xDD,0x0D,0xFF,0xDD,0x0D,0xFF,0xD4,0xAC,0xFF,0xAB,0x68,0xFF,0x9A,0x66,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xAA,0xE7,0xFF,0xA2,0xE7,0xFF,0x9A,0x46,0xFF,0xA2,0x46,0xFF,0x8A,0x05,0xFF,0x8A,0x05,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,
-    0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x8A,0x06,0xFF,0x8A,0x26,0xFF,0x92,0x47,0xFF,0x89,0xE5,0xFF,0xA3,0xAC,0xFF,0xA3,0xED,0xFF,0xB4,0x8F,0xFF,0xFE,0xF8,0xFF,0xF6,0xD7,0xFC,0xEE,0x75,0xFF,0x8B,0x29,0xD8,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0x57,0x0C,0x7A,0x87,0xE5,0x7A,0x66,0xFF,0xAC,0x4E,0x38,0x00,0x00,0x00,0xA4,0x0D,0x8A,0x82,0xC8,0x90,0xC5,0x32,0x83,0xFF,0xFC,0x28,0x00,0x00,0x00,0xF5,0x8A,0xBC,0xFE,0x07,0xFF,0xF5,0x27,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x8D,0x68,0xD4,0xEE,0xB1,0xDD,0x50,0x8C,0xDD,0x91,0x5A,0xE5,0x91,0x39,0xDD,0xB1,0x3B,0xDD,0x50,0x7B,0xDD,0x4F,0x7B,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0x75,0x2E,0xAB,0x8A,0xFF,0x92,0x65,0xFE,0x9A,0xC7,0xFF,0x9A,0xA7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,
-    0x9A,0xA7,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x92,0x66,0xFF,0x92,0x25,0xFF,0x9A,0x86,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xA7,0xFF,0x9A,0xC7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA6,0xFF,0x9A,0xC6,0xFF,0x9A,0xC6,0xFF,0xA2,0xC6,0xFF,0xA2,0xC7,0xFF,0x9A,0xA6,0xFF,0x8A,0x45,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x8A,0x66,0xFF,0x92,0xA7,0xFF,0x89,0xA0,0xFF,0xB4,0x8F,0xFF,0xFF,0x5A,0xFF,0xAC,0x4E,0xFF,0xDE,0x14,0xFF,0xCD,0x72,0xFE,0xF6,0xD7,0xFF,0x9B,0xEC,0xF8,0x58,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x9B,0xCC,0xA2,0x79,0xE4,0xFF,0x93,0x8B,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF5,0x48,0xC4,0xFD,0xA5,0xFF,0xF5,0x47,0x98,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF0,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xAD,0x56,0xD4,0xEE,0x83,0xD5,0x0F,0x94,0xD4,0xCE,0x82,0xD4,0xAD,0x4D,0x00,0x00,0x00,0xDD,0xF3,0x08,0xF8,0x00,0x01,0xFF,0xE0,0x01,0xFE,0x73,0x05,0x00,0x00,0x00,0xE5,0xF3,0x1C,0xAB,0xAA,0xF7,0xA2,0xE7,0xFF,0xAB,0x07,0xFE,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x08,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x27,0xFF,0xA2,0xE7,0xFF,0x8A,0x25,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,
-    0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x66,0xFF,0x9A,0xA7,0xFF,0x92,0xC8,0xFD,0xDE,0x56,0xFB,0xF7,0x19,0xFD,0x9B,0xED,0xFF,0xBC,0xF1,0xFF,0xFF,0x19,0xFE,0xAC,0x4E,0xFE,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0x8F,0x76,0x82,0x66,0xFF,0x93,0x4A,0xF7,0xDE,0x75,0x23,0x00,0x00,0x00,0xB3,0x69,0x07,0x00,0x1F,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0xF5,0x28,0x63,0xFD,0xE6,0xFF,0xF5,0x49,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0xDD,0x50,0x36,0xDD,0x71,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF6,0x76,0x14,0xDD,0x2F,0x8C,0xDD,0x2F,0x5D,0x00,0x00,0x00,0xFC,0x10,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFD,0x0C,0xB3,0xCB,0xE4,0xAA,0xE7,0xFF,0xAB,0x28,0xFD,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,
-    0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0x9A,0xA6,0xFF,0x9A,0xA6,0xFF,0x9A,0xA6,0xFF,0x9A,0xA6,0xFF,0xA3,0x07,0xFF,0xAB,0x27,0xFF,0x9A,0xC7,0xFF,0x8A,0x25,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x66,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x66,0xFF,0x8A,0x24,0xFE,0xEE,0x97,0xFF,0xBD,0x11,0xFF,0xE6,0x56,0xFF,0xFF,0x5A,0xFC,0xFF,0x5A,0xF8,0xFE,0xF8,0xFF,0x93,0x8B,0xE9,0x81,0x83,0x0A,0x84,0x10,0x02,0x00,0x00,0x00,0xBC,0xF1,0x61,0x8A,0xA7,0xFF,0x93,0x2A,0xFF,0xD6,0x15,0x5E,0x00,0x00,0x00,0x9C,0xD3,0x05,0xFD,0x55,0x03,0xF5,0x89,0xBE,0xF5,0xAA,0x44,0x00,0x00,0x00,0xF5,0x6A,0x70,0xFD,0xAD,0x11,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xD5,0x0E,0x1E,0xD4,0xEE,0x92,0xD5,0x0F,0xA3,0xDD,0x50,0xAA,0xDD,0x51,0xAB,0xDD,0x2F,0x9F,0xDD,0x0F,0x9D,0xDC,0xEE,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x8A,0xD1,0x9A,0xA6,0xFF,0x9A,0xC7,0xFC,0x9A,0xC7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA7,0xFF,0x9A,0xA6,0xFF,0x9A,0xA6,0xFF,0x9A,0xA6,0xFF,0x9A,0xA6,0xFF,0x92,0x86,0xFF,0x8A,0x46,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x92,0x66,0xFF,0xA2,0xC7,0xFF,0xA2,0xE7,0xFF,0x92,0x86,0xFF,0x82,0x05,0xFF,0x82,0x25,0xFF,0x82,0x05,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,
-    0x82,0x25,0xFF,0x82,0x25,0xFF,0x8A,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x26,0xFF,0x82,0x05,0xFD,0x92,0x66,0xFF,0xDE,0x15,0x82,0xF7,0x19,0x75,0xA4,0x0D,0xEA,0xBD,0x11,0xFF,0xDE,0x15,0xFF,0xAC,0x4E,0xFF,0x71,0xE3,0x5E,0x00,0x00,0x00,0x83,0x08,0x08,0x00,0x00,0x00,0xB4,0xB0,0x6E,0x72,0x05,0xFF,0x8A,0xE9,0xFF,0xCD,0xB3,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0xF5,0x69,0x89,0xFE,0x49,0xFF,0xF5,0x68,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xAD,0x0C,0xD4,0xCD,0x2E,0xD4,0xCD,0x2F,0xD4,0x2B,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xB4,0x0C,0xCA,0xAB,0x07,0xFF,0xAB,0x07,0xFC,0xAB,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,
-    0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xAB,0x07,0xFF,0xAB,0x28,0xFF,0x9A,0xC7,0xFF,0x8A,0x25,0xFF,0x8A,0x46,0xFF,0x8A,0x26,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x45,0xFF,0x8A,0x26,0xFF,0x8A,0x26,0xFF,0x81,0xE5,0xFE,0x92,0xC8,0xFF,0xA3,0x8B,0x2B,0x00,0x00,0x00,0xFF,0xFF,0x0E,0x9B,0x8A,0x49,0x71,0x80,0x6B,0x68,0xA0,0x2C,0x00,0x00,0x00,0x00,0x00,0x01,0xAC,0x10,0x06,0x00,0x00,0x00,0xAC,0x2E,0x99,0x71,0xC4,0xFF,0x82,0xC8,0xFF,0xD5,0xF5,0x48,0xF6,0xF8,0x50,0xE6,0x34,0xA9,0xF5,0xAC,0xF2,0xFD,0x66,0xFF,0xF5,0x6A,0xC0,0x00,0x00,0x00,0xFC,0xC0,0x05,0xFF,0xE0,0x01,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xBC,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0xFD,0x4A,0x03,0xFF,0xF0,0x02,0xFD,0x40,0x03,0xFC,0x00,0x02,0xF8,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0xC4,0x8E,0xC7,0xB3,0x27,0xFF,0xAB,0x28,0xFC,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x08,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x28,0xFF,0xAB,0x07,0xFF,0x9A,0xA6,0xFF,0x9A,0xA6,0xFF,0x92,0x86,0xFF,0x9A,0xA6,0xFF,0x92,0x66,0xFF,0x8A,0x25,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x25,0xFF,0x82,0x05,0xFF,0x82,0x05,0xFF,0x82,0x05,0xFF,0x8A,0x05,0xFF,0x8A,0x05,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x26,0xFF,
-    0x8A,0x26,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFE,0x8A,0x25,0xFF,0x8A,0xA7,0xF0,0xDD,0xF3,0x18,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xE9,0xDD,0x71,0xC4,0xFF,0x7A,0x46,0xD3,0xFF,0xFD,0x2E,0xED,0x92,0xFF,0xEC,0x6C,0xFF,0xF5,0xAC,0xFA,0xFD,0x85,0xFF,0xF5,0x69,0x9F,0x00,0x00,0x00,0xFC,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFC,0x10,0x02,0xFC,0x10,0x02,0xF8,0x00,0x01,0x00,0x00,0x00,0xFF,0xF0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x03,0x00,0x00,0x00,0xC4,0xD0,0xBC,0xB3,0x48,0xFF,0xAB,0x28,0xFC,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,
-    0xA2,0xA7,0xFF,0xA2,0x06,0xFF,0x99,0xA5,0xFF,0xA1,0xC6,0xFF,0xA2,0x47,0xFF,0xA2,0xC7,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x08,0xFF,0xA2,0xE7,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x86,0xFF,0x8A,0x46,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x26,0xFF,0x8A,0x25,0xFF,0x9A,0xC7,0xFF,0x9A,0xE8,0xFF,0x9A,0xE7,0xFF,0x9A,0xE7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x92,0xA7,0xFF,0x92,0x86,0xFF,0x92,0x86,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x92,0x46,0xFE,0x8A,0x25,0xFF,0x92,0xE8,0xEA,0xEE,0x33,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x00,0x03,0xDC,0x08,0x08,0x84,0x00,0x02,0xFD,0x55,0x03,0x00,0x00,0x00,0xFF,0xFF,0x0B,0xAC,0x2E,0x9E,0x7A,0x25,0xFF,0x7A,0x26,0xFF,0x82,0xE9,0x63,0xFF,0x79,0x10,0xD3,0x49,0xFB,0xD2,0xA6,0xFA,0xE4,0x88,0xFF,0xED,0x4A,0xF0,0xFD,0xEC,0x22,0x00,0x00,0x00,0xFF,0xF0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0x00,0x00,0x00,0xED,0xAD,0x20,0xF5,0x6A,0xB9,0xF5,0x29,0x8E,0x00,0x00,0x00,0x99,0x80,0x05,0x00,0x00,0x00,0xBC,0xAF,0x9C,0xAB,0x07,0xFF,0x9A,0xC7,0xFB,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0x9A,0xC7,0xFF,0xA2,0xA7,0xFF,0xA1,0xA6,0xFF,0x99,0x05,0xFF,0xBA,0xE8,0xFF,0xC3,0xAA,0xFF,0xC3,0x69,0xFF,0xAA,0x06,0xFF,0xA1,0x25,0xFF,0xA2,0x26,0xFF,0x9A,0x86,0xFF,0x9A,0xC7,0xFF,0x9A,0xC6,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x8A,0x46,0xFF,0x81,0xE5,0xFF,0x82,0x05,0xFF,0x82,0x05,0xFF,0x82,0x25,0xFF,0x81,0xC5,0xFF,0xD4,0x8C,0xFF,0xE5,0x2E,0xFF,0xDC,0xED,0xFF,0xDC,0xED,0xFF,0xDC,0xED,0xFF,0xDC,0xCC,0xFF,0xDC,0xCC,0xFF,0xDC,0xCC,0xFF,0xDC,0xAC,0xFF,
-    0xDC,0xAB,0xFF,0xDC,0xAB,0xFF,0xE4,0xCC,0xFF,0xDC,0xCC,0xFF,0x92,0x86,0xFF,0x8A,0x05,0xFF,0x8A,0x46,0xFD,0x89,0xE4,0xFF,0xA3,0x6B,0xE5,0xFF,0xFF,0x03,0xEE,0x31,0x1A,0xF6,0x31,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x73,0x05,0x00,0x00,0x00,0xFF,0xFD,0x38,0xD5,0xF4,0xF3,0x8A,0xA7,0xFF,0x82,0x04,0xFF,0x8A,0xE9,0xDC,0x00,0x00,0x00,0xC3,0x48,0x1B,0xCA,0xC6,0xFA,0xD2,0x85,0xFF,0xAA,0xC8,0xFF,0xCD,0xB3,0x47,0x00,0x00,0x00,0xBC,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xE5,0xB0,0x11,0xF5,0x48,0xE4,0xFD,0x26,0xFF,0xEC,0xE7,0xFE,0xFE,0x90,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xEF,0x88,0xB3,0x48,0xFF,0xA2,0xE7,0xFA,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xAA,0xE7,0xFF,0xA1,0x86,0xFF,0xB2,0x87,0xFF,
-    0xE4,0xEC,0xFF,0xED,0x2D,0xFF,0xE5,0x0C,0xFF,0xE5,0x4D,0xFF,0xED,0x6E,0xFF,0xCC,0x0A,0xFF,0xB1,0xA6,0xFF,0xAA,0x06,0xFF,0xA2,0xE7,0xFF,0xAB,0x28,0xFF,0xAB,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0x92,0x86,0xFF,0x8A,0x05,0xFF,0x8A,0x26,0xFF,0x8A,0x26,0xFF,0x8A,0x46,0xFF,0x81,0xE5,0xFF,0xDC,0xCC,0xFF,0xBC,0x2B,0xFF,0x39,0xE8,0xFF,0x62,0x89,0xFF,0x5A,0x69,0xFF,0x5A,0x48,0xFF,0xD4,0xAB,0xFF,0x9B,0x8A,0xFF,0x62,0x68,0xFF,0x7A,0xC8,0xFF,0x6A,0x88,0xFF,0x9B,0x8A,0xFF,0xE5,0x0D,0xFF,0x92,0x86,0xFF,0x8A,0x25,0xFF,0x92,0x66,0xFD,0x92,0x04,0xFF,0xB4,0x2D,0xDA,0x00,0x00,0x00,0xED,0x29,0x5C,0xFD,0x48,0xFF,0xF5,0x08,0xD4,0xFD,0xEF,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x73,0xC1,0x92,0xE8,0xFF,0x79,0x80,0xF3,0x9B,0x4A,0xFF,0xD5,0xB3,0x75,0x00,0x00,0x00,0xE6,0xD8,0x15,0xE4,0x6D,0xE8,0xB2,0x03,0xFF,0x9C,0x2D,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0xC6,0x05,0x00,0x00,0x00,0xF5,0x6A,0x71,0xFD,0x27,0xFF,0xEC,0xA6,0xFF,0xF5,0x49,0xDD,0xBF,0xFF,0x04,0xA8,0x00,0x03,0x00,0x00,0x00,0xCD,0x51,0x79,0xBB,0x89,0xFF,0xAB,0x07,0xFB,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAA,0x06,0xFF,0xB2,0xC8,0xFF,0xED,0x6D,0xFF,0xCC,0x6B,0xFF,0xAB,0x28,0xFF,0xA2,0xE7,0xFF,0xB3,0x48,0xFF,0xCC,0x4B,0xFF,0xED,0xAE,0xFF,0xDC,0x8C,0xFF,0xB1,0xA5,0xFF,0xA2,0x06,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xA3,0x08,0xFF,0x92,0x66,0xFF,0x8A,0x05,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x46,0xFF,0x81,0xE5,0xFF,0xDC,0xCC,0xFF,0xAB,0xEB,0xFF,0x00,0x67,0xFF,0x31,0xC8,0xFF,0x21,0xA8,0xFF,0x21,0xA8,0xFF,0xD4,0xCC,0xFF,0x7A,0xE9,0xFF,0x00,0x66,0xFF,
-    0x21,0x87,0xFF,0x00,0x66,0xFF,0x72,0xC9,0xFF,0xE4,0xEC,0xFF,0x92,0x66,0xFF,0x8A,0x25,0xFF,0x92,0x66,0xFD,0x91,0xE3,0xFF,0xC4,0xF1,0xE1,0xFF,0xFF,0x02,0xDB,0x00,0x08,0xF4,0xE6,0xE9,0xFC,0xE4,0xFF,0xFD,0x28,0xFF,0xFE,0x93,0x71,0xAC,0x6F,0x9C,0x7A,0x24,0xFF,0x7A,0x04,0xF7,0x8A,0x66,0xFF,0xC5,0x31,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x19,0xC4,0xF0,0xEC,0xA1,0xE3,0xFF,0xD3,0xEB,0xE4,0xD3,0xCB,0x94,0xE5,0x72,0x13,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xA0,0x03,0x00,0x00,0x00,0xE5,0x2B,0xBD,0xFD,0x47,0xFF,0xF5,0x28,0xFE,0xF5,0xAB,0x49,0x00,0x00,0x00,0xDC,0x8D,0x07,0x00,0x00,0x00,0xCD,0x10,0x55,0xB3,0x89,0xFF,0xA3,0x07,0xFC,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xAA,0xA7,0xFF,0xA9,0x66,0xFF,0xE5,0x2D,0xFF,0xDC,0xCC,0xFF,
-    0xA2,0x87,0xFF,0xB3,0x68,0xFF,0xAB,0x48,0xFF,0xB3,0x68,0xFF,0xAB,0x07,0xFF,0xBB,0xA9,0xFF,0xF5,0xCF,0xFF,0xC3,0x49,0xFF,0xA1,0x85,0xFF,0x9A,0x66,0xFF,0xAB,0x28,0xFF,0xAB,0x07,0xFF,0xAB,0x28,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0x92,0x66,0xFF,0x8A,0x26,0xFF,0x8A,0x46,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x8A,0x25,0xFF,0xDC,0xCC,0xFF,0xAB,0xCA,0xFF,0x01,0x07,0xFF,0x41,0xE8,0xFF,0x31,0xC8,0xFF,0x42,0x08,0xFF,0xDC,0xCD,0xFF,0x7B,0x09,0xFF,0x01,0x67,0xFF,0x41,0xE8,0xFF,0x01,0x47,0xFF,0x82,0xE9,0xFF,0xE4,0xCC,0xFF,0x92,0x66,0xFF,0x8A,0x26,0xFF,0x92,0x46,0xFB,0x9A,0x66,0xFF,0xBC,0xB0,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x8B,0x35,0xFD,0x48,0xD3,0xED,0x08,0xFE,0xCC,0xCD,0xFF,0x72,0x27,0xFF,0x7A,0x45,0xFD,0x69,0x00,0xFE,0xC5,0x52,0xFF,0xFF,0xFC,0x63,0xFF,0xFE,0x18,0xCD,0x73,0x73,0x93,0x09,0xE7,0xC2,0x44,0xFF,0xD2,0xC6,0xFF,0xDA,0xA5,0xFF,0xCB,0x28,0xD7,0xFE,0xB5,0x0C,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xDD,0x92,0x1B,0xD4,0xEC,0x8F,0xF5,0x47,0x79,0xFD,0xCA,0x24,0x00,0x00,0x00,0xFC,0x00,0x02,0xFD,0x55,0x03,0x00,0x00,0x00,0xD5,0x30,0x42,0xB3,0x8A,0xFF,0xA2,0xE7,0xFC,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA1,0xC6,0xFF,0xBB,0x49,0xFF,0xED,0x8E,0xFF,0xBB,0x89,0xFF,0xB3,0x48,0xFF,0xB3,0x68,0xFF,0xAB,0x48,0xFF,0xB3,0x48,0xFF,0xB3,0x68,0xFF,0xAA,0xC7,0xFF,0xE5,0x2D,0xFF,0xDC,0xED,0xFF,0xA9,0x45,0xFF,0x99,0xE6,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x8A,0x46,0xFF,0x82,0x05,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x81,0xE5,0xFF,0xDC,0xCC,0xFF,0xAB,0xEB,0xFF,0x01,0x27,0xFF,0x42,0x08,0xFF,0x31,0xC8,0xFF,0x42,0x08,0xFF,0xDC,0xCC,0xFF,0x7A,0xE9,0xFF,0x11,0x67,0xFF,
-    0x4A,0x08,0xFF,0x11,0x67,0xFF,0x83,0x29,0xFF,0xE4,0xCC,0xFF,0x8A,0x46,0xFF,0x82,0x05,0xFF,0x8A,0x05,0xFB,0x9A,0x87,0xFF,0xB4,0x8F,0x7C,0x00,0x00,0x00,0xB4,0x89,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0xEE,0x53,0x58,0x83,0x09,0xFF,0x71,0xC4,0xFB,0x71,0xC3,0xFF,0xA4,0x2D,0xFD,0xF7,0x18,0xF6,0xD6,0x15,0xE5,0xAC,0x6F,0xFF,0x9B,0x4A,0xFF,0xB4,0x6E,0xF2,0xDC,0x6E,0xD1,0xC2,0xE8,0xDA,0xCB,0x49,0x99,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x4A,0x03,0x00,0x00,0x00,0xFD,0x55,0x03,0x00,0x00,0x00,0xDD,0xD3,0x36,0xA3,0x6A,0xFF,0x92,0x66,0xFE,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0x99,0x65,0xFF,0xCC,0x2B,0xFF,0xE5,0x2D,0xFF,0xBB,0x48,0xFF,
-    0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xB3,0x48,0xFF,0xB3,0x48,0xFF,0xB3,0x68,0xFF,0xAB,0x07,0xFF,0xD4,0x6B,0xFF,0xED,0x6E,0xFF,0xA9,0xC6,0xFF,0x99,0xC5,0xFF,0xA2,0xC7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0x9A,0xC7,0xFF,0xA2,0xE7,0xFF,0x92,0x46,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x26,0xFF,0x8A,0x46,0xFF,0x82,0x05,0xFF,0xDC,0xCC,0xFF,0xA3,0xCA,0xFF,0x00,0x06,0xFF,0x09,0x67,0xFF,0x01,0x07,0xFF,0x19,0x87,0xFF,0xD4,0xAC,0xFF,0x62,0x88,0xFF,0x00,0x46,0xFF,0x09,0x88,0xFF,0x00,0x07,0xFF,0x83,0x09,0xFF,0xE4,0xEC,0xFF,0x8A,0x25,0xFF,0x82,0x05,0xFF,0x82,0x05,0xFB,0x9A,0xC8,0xFF,0xC5,0x11,0x6E,0x00,0x00,0x00,0x84,0x10,0x04,0xB3,0x64,0x07,0x00,0x00,0x00,0xA4,0x6F,0x90,0x82,0x46,0xFF,0x7A,0x46,0xFB,0x71,0xC3,0xFF,0x93,0x6B,0xFF,0x93,0x2A,0xFF,0x82,0x25,0xFF,0x8A,0xE9,0xE6,0xC5,0x32,0x8F,0xFF,0xFF,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x4A,0x03,0xCC,0xC6,0x05,0xFF,0xF0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xE6,0x35,0x1B,0xAB,0x6A,0xF3,0xA3,0x07,0xFF,0xAB,0x08,0xFE,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0x9A,0x87,0xFF,0xD4,0xAC,0xFF,0xE5,0x2D,0xFF,0xBB,0x68,0xFF,0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xB3,0x48,0xFF,0xB3,0x48,0xFF,0xB3,0x48,0xFF,0xAB,0x07,0xFF,0xCC,0x2A,0xFF,0xF5,0x8E,0xFF,0xCB,0xC9,0xFF,0xA2,0xC7,0xFF,0xAB,0x28,0xFF,0xAB,0x27,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0x92,0x66,0xFF,0x8A,0x46,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x8A,0x25,0xFF,0xDC,0xAC,0xFF,0xDC,0xED,0xFF,0xCC,0x6C,0xFF,0xCC,0x8C,0xFF,0xCC,0x6B,0xFF,0xCC,0x6B,0xFF,0xDC,0xCC,0xFF,0xCC,0x6B,0xFF,0xC4,0x4B,0xFF,
-    0xC4,0x6C,0xFF,0xC4,0x8C,0xFF,0xD4,0xCD,0xFF,0xE4,0xED,0xFF,0x92,0x46,0xFF,0x8A,0x26,0xFF,0x8A,0x25,0xFE,0x92,0xA7,0xFF,0xC4,0xB0,0x36,0x00,0x00,0x00,0xCE,0x73,0x05,0x00,0x00,0x00,0xFF,0xFC,0x28,0xAC,0x4E,0xFF,0x71,0x60,0xFF,0x7A,0x25,0xFE,0x82,0xA8,0xFF,0x8B,0x09,0xCB,0x82,0x87,0x7A,0xAC,0x4E,0x3D,0xFF,0xFD,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0xA0,0x03,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xEE,0x54,0x0E,0xAB,0x8A,0xEB,0xAB,0x07,0xFF,0xAB,0x08,0xFE,0xA3,0x08,0xFF,0xAB,0x28,0xFF,0xA2,0xC7,0xFF,0xDC,0xCC,0xFF,0xE5,0x2D,0xFF,0xBB,0x48,0xFF,
-    0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xB3,0x48,0xFF,0xB3,0x68,0xFF,0xB3,0x48,0xFF,0xAB,0x27,0xFF,0xCC,0x2A,0xFF,0xF5,0x8E,0xFF,0xCC,0x2A,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x07,0xFF,0x92,0x66,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x25,0xFF,0xDC,0xCC,0xFF,0xBC,0x2B,0xFF,0x8B,0x4A,0xFF,0x9B,0x8A,0xFF,0x93,0x6A,0xFF,0x9B,0x89,0xFF,0xDC,0xAC,0xFF,0xA3,0xAA,0xFF,0x93,0x4A,0xFF,0xA3,0xAB,0xFF,0x9B,0xAB,0xFF,0xC4,0x6C,0xFF,0xE5,0x0D,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFE,0x8A,0x05,0xFF,0x93,0x08,0xFF,0xCD,0x51,0x29,0x00,0x00,0x00,0xDD,0xB6,0x07,0x00,0x00,0x00,0xEE,0xD8,0x7D,0xAC,0x0D,0xFF,0x79,0xA1,0xF8,0x71,0x82,0xFF,0xB4,0xAF,0xE6,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x08,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x07,0xB3,0xEB,0xE2,0xAB,0x07,0xFF,0xAB,0x28,0xFD,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xA2,0xC7,0xFF,0xD4,0xAC,0xFF,0xE5,0x2D,0xFF,0xB3,0x68,0xFF,0xB3,0x48,0xFF,0xB3,0x68,0xFF,0xB3,0x48,0xFF,0xB3,0x68,0xFF,0xB3,0x68,0xFF,0xAB,0x27,0xFF,0xCC,0x2A,0xFF,0xF5,0xAE,0xFF,0xCC,0x09,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x08,0xFF,0xAB,0x08,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x07,0xFF,0x92,0x46,0xFF,0x8A,0x46,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x25,0xFF,0xE4,0xEC,0xFF,0x93,0x6A,0xFF,0x00,0x06,0xFF,0x01,0x67,0xFF,0x00,0xE7,0xFF,0x39,0xC7,0xFF,0xD4,0xAC,0xFF,0x52,0x28,0xFF,0x00,0x27,0xFF,
-    0x01,0x67,0xFF,0x00,0x07,0xFF,0x9B,0x8A,0xFF,0xED,0x2D,0xFF,0x8A,0x26,0xFF,0x92,0x46,0xFE,0x89,0xE4,0xFF,0x9B,0x4A,0xF7,0xEE,0xB6,0x1F,0x00,0x00,0x00,0xDD,0xB2,0x07,0x00,0x00,0x00,0xDE,0x35,0x7E,0x9B,0x4A,0xFF,0x82,0x24,0xF8,0x82,0x04,0xFF,0xC5,0x11,0xD2,0x00,0x00,0x00,0x00,0x00,0x05,0xBC,0x10,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xAB,0x8A,0xC5,0xA2,0xC7,0xFF,0x9A,0xC7,0xFC,0x9A,0xC7,0xFF,0x9A,0xE7,0xFF,0x92,0x66,0xFF,0xCC,0x6B,0xFF,0xED,0x4D,0xFF,0xB3,0x48,0xFF,
-    0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xB3,0x48,0xFF,0xB3,0x68,0xFF,0xBB,0x88,0xFF,0xB3,0x48,0xFF,0xCC,0x2A,0xFF,0xF5,0x8D,0xFF,0xCC,0x09,0xFF,0x92,0x86,0xFF,0x92,0xA6,0xFF,0x92,0xA6,0xFF,0x9A,0xA6,0xFF,0x9A,0xC7,0xFF,0xA2,0xC7,0xFF,0xA2,0xC7,0xFF,0x9A,0xC7,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0xDC,0xCC,0xFF,0x93,0x6A,0xFF,0x01,0x67,0xFF,0x42,0x08,0xFF,0x29,0xC8,0xFF,0x62,0x89,0xFF,0xDC,0xCC,0xFF,0x62,0x88,0xFF,0x29,0x87,0xFF,0x4A,0x08,0xFF,0x01,0x68,0xFF,0xA3,0xCB,0xFF,0xE5,0x0D,0xFF,0x8A,0x05,0xFF,0x8A,0x45,0xFE,0x89,0xE4,0xFF,0xA3,0x8B,0xEC,0xFF,0xFA,0x13,0x00,0x00,0x00,0xAD,0x50,0x06,0x00,0x00,0x00,0xBD,0x31,0x5C,0x8A,0xA7,0xFF,0x82,0x25,0xF8,0x8A,0x24,0xFF,0xBD,0x11,0xC7,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x08,0x04,0xFF,0xF5,0x03,0xBC,0x08,0x04,0x00,0x00,0x00,0xB3,0xAA,0xB6,0xB3,0x48,0xFF,0xAB,0x28,0xFB,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xA2,0xE7,0xFF,0xCC,0x6B,0xFF,0xE5,0x2D,0xFF,0xB3,0x68,0xFF,0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xB3,0x68,0xFF,0xBB,0x88,0xFF,0xA3,0x28,0xFF,0x92,0xC7,0xFF,0xCC,0x2A,0xFF,0xF5,0x8D,0xFF,0xCB,0xE9,0xFF,0x9A,0xA7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x27,0xFF,0xAB,0x07,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x66,0xFF,0xE4,0xCC,0xFF,0x93,0x49,0xFF,0x01,0x67,0xFF,0x42,0x08,0xFF,0x29,0xA8,0xFF,0x6A,0xA9,0xFF,0xDC,0xEC,0xFF,0x62,0x68,0xFF,0x29,0xA7,0xFF,
-    0x4A,0x08,0xFF,0x01,0x48,0xFF,0xA3,0xCB,0xFF,0xE4,0xEC,0xFF,0x92,0x25,0xFF,0x92,0x86,0xFD,0x92,0x03,0xFF,0xBC,0x6E,0xE8,0xFF,0xFC,0x13,0x00,0x00,0x00,0xB4,0x92,0x07,0x00,0x00,0x00,0xAC,0x6E,0x52,0x72,0x26,0xFF,0x7A,0x25,0xF9,0x82,0x04,0xFF,0xB4,0x8F,0xC5,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0x84,0x10,0x02,0xDD,0xD3,0x0F,0xDE,0x75,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x2C,0xA9,0xBB,0x68,0xFF,0xAB,0x48,0xFB,0xAB,0x48,0xFF,0xAB,0x48,0xFF,0xA3,0x07,0xFF,0xCC,0x4B,0xFF,0xE5,0x2D,0xFF,0xBB,0x68,0xFF,
-    0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xB3,0x68,0xFF,0xBB,0x88,0xFF,0x8A,0xE8,0xFF,0x72,0x67,0xFF,0xCC,0x2A,0xFF,0xF5,0x6D,0xFF,0xCB,0xE9,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xB3,0x48,0xFF,0xAB,0x07,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x92,0x86,0xFF,0xE4,0xCC,0xFF,0x82,0xE8,0xFF,0x00,0x06,0xFF,0x01,0x67,0xFF,0x00,0x67,0xFF,0x5A,0x68,0xFF,0xE4,0xED,0xFF,0x39,0xC7,0xFF,0x00,0x67,0xFF,0x01,0x27,0xFF,0x00,0x06,0xFF,0x9B,0x8A,0xFF,0xE4,0xCC,0xFF,0x8A,0x05,0xFF,0x9A,0xA7,0xFE,0x91,0xA0,0xFF,0xCD,0x72,0xF5,0xFF,0xFF,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0xF0,0x62,0x7A,0x46,0xFF,0x71,0xE4,0xF8,0x7A,0x04,0xFF,0xA4,0x0D,0xC7,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xAD,0x4A,0x03,0xBC,0x08,0x04,0xBC,0x08,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x2D,0x8D,0xB3,0x28,0xFE,0xDD,0x72,0x8B,0xFF,0xBB,0x37,0xE5,0xF4,0x13,0xEE,0xB8,0x3E,0xD5,0x30,0xE3,0xAB,0x06,0xFF,0xAB,0x48,0xFD,0xAB,0x48,0xFF,0xAB,0x48,0xFF,0xA2,0xE7,0xFF,0xC4,0x2A,0xFF,0xE5,0x2D,0xFF,0xBB,0x68,0xFF,0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xB3,0x68,0xFF,0xBB,0x68,0xFF,0xBB,0xA9,0xFF,0xB3,0x28,0xFF,0xCC,0x2A,0xFF,0xF5,0x8D,0xFF,0xC3,0xE9,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x27,0xFF,0xAB,0x07,0xFF,0xAB,0x28,0xFF,0xA2,0xE7,0xFF,0x8A,0x45,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x92,0x66,0xFF,0x8A,0x46,0xFF,0x92,0x86,0xFF,0xE4,0xCC,0xFF,0xCC,0x6B,0xFF,0xB4,0x0B,0xFF,0xBC,0x2B,0xFF,0xBC,0x2B,0xFF,0xC4,0x6B,0xFF,0xE5,0x0D,0xFF,0xC4,0x4B,0xFF,0xBC,0x2B,0xFF,
-    0xBC,0x4B,0xFF,0xB4,0x2B,0xFF,0xD4,0xAB,0xFF,0xDC,0xAB,0xFF,0x8A,0x05,0xFF,0x92,0x86,0xFF,0x91,0xE1,0xFE,0xCD,0x51,0xFF,0xEE,0x76,0xC1,0xE6,0x35,0x71,0xDD,0xF3,0x1F,0x00,0x00,0x00,0xD5,0xD4,0x80,0x82,0xA7,0xFF,0x69,0xA4,0xF7,0x7A,0x05,0xFF,0x93,0x6A,0xCD,0x00,0x00,0x00,0x30,0x00,0x05,0xCC,0xCC,0x05,0xAD,0x55,0x03,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0xBC,0x08,0x04,0x80,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDD,0xD0,0x16,0xDD,0xB1,0x43,0xB3,0x8A,0xE0,0xB2,0x65,0xFF,0xC3,0x8A,0xFF,0xC4,0x6E,0xFF,0xBB,0xEB,0xEF,0xED,0x2C,0xFF,0xCC,0x2A,0xFF,0xA2,0xE7,0xFD,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xA2,0xE7,0xFF,0xBB,0xEA,0xFF,0xE5,0x0D,0xFF,0xBB,0x68,0xFF,
-    0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xB3,0x88,0xFF,0xBB,0x68,0xFF,0xBB,0x89,0xFF,0xB3,0x07,0xFF,0xCC,0x2A,0xFF,0xF5,0x8D,0xFF,0xCB,0xE9,0xFF,0xA2,0xE7,0xFF,0xA3,0x07,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xA2,0xE7,0xFF,0xAB,0x47,0xFF,0xAB,0x28,0xFF,0xA2,0xE7,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x92,0x66,0xFF,0x8A,0x46,0xFF,0x8A,0x66,0xFF,0xBB,0xEA,0xFF,0xCC,0x2B,0xFF,0xCC,0x2A,0xFF,0xCC,0x2A,0xFF,0xCC,0x4B,0xFF,0xCC,0x4A,0xFF,0xC4,0x0A,0xFF,0xCC,0x2A,0xFF,0xCC,0x2A,0xFF,0xCC,0x2A,0xFF,0xCC,0x2A,0xFF,0xC4,0x0A,0xFF,0xB3,0x68,0xFF,0x8A,0x25,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0xAB,0x47,0xFE,0xC4,0x2A,0xFF,0xCC,0x8C,0xFF,0xBC,0x0A,0xF3,0xC4,0x4C,0xE5,0xBC,0x8E,0xF4,0x7A,0x25,0xFF,0x69,0xC4,0xFD,0x71,0xC4,0xFF,0x8A,0xE8,0xE2,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x08,0x04,0xBC,0x08,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0x82,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x36,0x0A,0xCC,0xEF,0x2D,0xC4,0x6C,0x5E,0xBC,0x0B,0x97,0xB3,0xCA,0xCA,0xB3,0x89,0xF1,0xBB,0x69,0xFF,0xAA,0xC7,0xFF,0xAA,0xA7,0xFC,0xAA,0xA7,0xFB,0xD3,0xE6,0xFD,0xEC,0xE8,0xFF,0xFD,0xA7,0xFE,0xD4,0x67,0xFD,0x9A,0xC7,0xFF,0xA3,0x07,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0x9A,0xA6,0xFF,0xB3,0xA9,0xFF,0xE5,0x0C,0xFF,0xBB,0x88,0xFF,0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xBB,0x88,0xFF,0xB3,0x68,0xFF,0xBB,0x89,0xFF,0xAB,0x07,0xFF,0xCC,0x2A,0xFF,0xF5,0xAE,0xFF,0xC3,0xE9,0xFF,0x9A,0x86,0xFF,0x9A,0xA6,0xFF,0x9A,0xA6,0xFF,0x92,0x66,0xFF,0xAB,0x47,0xFF,0xE5,0x07,0xFF,0xA3,0x27,0xFF,0x92,0x66,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x82,0x25,0xFF,0x79,0xE4,0xFF,0x79,0xC4,0xFF,0x79,0xA4,0xFF,0x79,0xA4,0xFF,0x79,0xA4,0xFF,0x79,0xA4,0xFF,0x79,0xC4,0xFF,0x79,0xA4,0xFF,0x79,0x84,0xFF,
-    0x79,0x84,0xFF,0x79,0x84,0xFF,0x71,0x64,0xFF,0x79,0xE4,0xFF,0x82,0x25,0xFF,0x82,0x25,0xFF,0x8A,0x45,0xFF,0xB3,0x89,0xFF,0xB3,0xA9,0xFC,0xB3,0x88,0xFA,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xB3,0x68,0xFF,0x8A,0x46,0xFE,0x7A,0x25,0xFF,0x69,0xC4,0xFE,0x82,0x67,0xFF,0xBC,0x6D,0xD1,0xBC,0x4C,0x80,0xC4,0x8E,0x54,0xDD,0xD3,0x34,0xFF,0xFF,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x08,0x04,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x10,0x02,0xBC,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xDD,0x31,0x1A,0xD5,0x71,0x8A,0xCC,0xAE,0xC5,0xBC,0x0B,0xE2,0xBB,0xEA,0xFF,0xC4,0x0A,0xFF,0xC3,0xC9,0xFF,0xAA,0xA6,0xFF,0xAA,0x65,0xFF,0xA2,0x45,0xFC,0xAA,0x66,0xFD,0xAA,0x87,0xFF,0xB2,0xC7,0xFF,0xEC,0xE8,0xFF,0xF5,0x47,0xFD,0xEC,0xE7,0xFE,0xEC,0xC7,0xFF,0xAB,0x68,0xFF,0xAB,0x48,0xFF,0xAB,0x48,0xFF,0xAB,0x48,0xFF,0xA3,0x28,0xFF,0xBB,0xE9,0xFF,0xE5,0x2C,0xFF,0xBB,0xA8,0xFF,
-    0xB3,0x48,0xFF,0xBB,0xA8,0xFF,0xBB,0x88,0xFF,0xB3,0x68,0xFF,0xBB,0x89,0xFF,0xAB,0x07,0xFF,0xCC,0x2A,0xFF,0xF5,0xAE,0xFF,0xC3,0xE9,0xFF,0xA3,0x07,0xFF,0xAB,0x07,0xFF,0xBB,0xA7,0xFF,0xC3,0xE7,0xFF,0xCC,0x47,0xFF,0xFD,0x87,0xFF,0xBB,0xC7,0xFF,0x9A,0xA6,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x8A,0x46,0xFF,0x8A,0x46,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x9A,0xC6,0xFF,0x8A,0x26,0xFF,0x8A,0x45,0xFF,0x8A,0x66,0xFF,0x92,0x66,0xFF,0xBB,0xC9,0xFF,0xE4,0xE8,0xFF,0xED,0x07,0xFF,0xE4,0xC8,0xFE,0xC3,0xE9,0xFD,0xBB,0xCA,0xFE,0x92,0x86,0xFF,0x82,0x26,0xFF,0x82,0x26,0xFF,0x7A,0x05,0xFF,0xB3,0x89,0xFF,0xC4,0x0A,0xFF,0xC4,0x0A,0xFF,0xC4,0x2B,0xFF,0xC4,0x4C,0xE3,0xC4,0x4B,0x9B,0xC4,0xAD,0x51,0xD5,0x51,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xA0,0x03,0xFD,0xF7,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xF0,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xAD,0x32,0xC4,0x2B,0xA9,0xBC,0x0A,0xF8,0xC4,0x0A,0xFF,0xC3,0xE9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xB3,0x68,0xFC,0xAA,0xE7,0xFE,0xAA,0x66,0xFF,0xAA,0x86,0xFF,0xAA,0x87,0xFF,0xBB,0x26,0xFF,0xEC,0xE6,0xFF,0xE4,0xA6,0xFF,0xDC,0x66,0xFF,0xE4,0xC7,0xFF,0xAB,0x48,0xFF,0xAB,0x28,0xFF,0xAB,0x28,0xFF,0xAB,0x48,0xFF,0xA3,0x08,0xFF,0xB3,0xA9,0xFF,0xE5,0x2C,0xFF,0xC3,0xA9,0xFF,0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xBB,0x88,0xFF,0xBB,0x68,0xFF,0xBB,0x89,0xFF,0xAB,0x07,0xFF,0xCC,0x4A,0xFF,0xF5,0x8D,0xFF,0xCB,0xE9,0xFF,0xAB,0x07,0xFF,0xA2,0xE7,0xFF,0xC3,0xE7,0xFF,0xED,0x26,0xFF,0xE4,0xE6,0xFF,0xF5,0x46,0xFF,0xD4,0x67,0xFF,0xA3,0x27,0xFF,0x8A,0x26,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x66,0xFF,0x92,0x46,0xFF,0x92,0x46,0xFF,
-    0x8A,0x26,0xFF,0x92,0x86,0xFF,0xE4,0x67,0xFF,0xCC,0x07,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x92,0x66,0xFF,0xBB,0xA8,0xFF,0xD4,0x68,0xFF,0xDC,0x87,0xFF,0xDC,0x88,0xFF,0xC3,0xE9,0xFF,0xBB,0xC9,0xFF,0x8A,0x86,0xFF,0x92,0x66,0xFF,0xB2,0xC7,0xFF,0x82,0x25,0xFF,0xA3,0x28,0xFC,0xBB,0xA9,0xFB,0xB3,0xA9,0xFB,0xBB,0xA9,0xFE,0xBB,0xC9,0xFF,0xC4,0x0A,0xFF,0xC3,0xEA,0xFF,0xBB,0xEA,0xED,0xBC,0x0A,0x9F,0xC4,0x8C,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xDD,0x91,0x14,0xBC,0x0B,0xA4,0xBB,0xE9,0xFF,0xC3,0xE9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFB,0xBB,0xC9,0xFC,0xBB,0xC9,0xFD,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x89,0xFF,0xAA,0xC7,0xFF,0xAA,0xA6,0xFF,0xAA,0xA6,0xFF,0xBB,0x27,0xFF,0xEC,0xC6,0xFF,0xDC,0x66,0xFF,0xDC,0x66,0xFF,0xE4,0xA7,0xFF,0xAB,0x28,0xFF,0xAB,0x48,0xFF,0xAB,0x48,0xFF,0xAB,0x48,0xFF,0xAB,0x28,0xFF,0xB3,0xA9,0xFF,0xED,0x4D,0xFF,0xC3,0xE9,0xFF,
-    0xB3,0x48,0xFF,0xBB,0x88,0xFF,0xBB,0x88,0xFF,0xB3,0x68,0xFF,0xBB,0x89,0xFF,0xAB,0x07,0xFF,0xCC,0x4A,0xFF,0xF5,0xAE,0xFF,0xCC,0x09,0xFF,0xA2,0xE7,0xFF,0xA2,0xE7,0xFF,0xBB,0xA7,0xFF,0xF5,0x06,0xFF,0xED,0x27,0xFF,0xED,0x27,0xFF,0xED,0x27,0xFF,0xA3,0x26,0xFF,0x82,0x05,0xFF,0x8A,0x06,0xFF,0x81,0xC6,0xFF,0x8A,0x06,0xFF,0x8A,0x26,0xFF,0x8A,0x26,0xFF,0x8A,0x26,0xFF,0x8A,0x26,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x25,0xFF,0x8A,0x45,0xFF,0x8A,0x45,0xFF,0x92,0x66,0xFF,0x92,0x86,0xFF,0x8A,0x46,0xFF,0xAB,0x26,0xFF,0xE4,0x87,0xFF,0xEC,0xA7,0xFF,0xD4,0x27,0xFF,0x9A,0xC7,0xFF,0xA3,0x27,0xFF,0xB3,0xA8,0xFF,0xB3,0x69,0xFF,0xB3,0x69,0xFF,0xB3,0x69,0xFF,0xB3,0x89,0xFF,0xB3,0xA9,0xFF,0xAA,0xC7,0xFF,0xCB,0x28,0xFF,0xD3,0x69,0xFF,0x8A,0x46,0xFF,0x92,0xA6,0xFF,0xAB,0x07,0xFF,0xA2,0xA6,0xFF,0xB3,0x89,0xFF,0xBB,0xC9,0xFD,0xBB,0xC9,0xFB,0xBB,0xC9,0xFB,0xBB,0xA9,0xFF,0xC3,0xE9,0xFF,0xC3,0xEA,0xFF,0xC4,0x6C,0xB8,0xE6,0x55,0x66,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,
-    0x84,0x10,0x02,0x00,0x00,0x00,0xE6,0x55,0x5C,0xC4,0x4C,0xEC,0xC3,0xE9,0xFF,0xBB,0xA9,0xFD,0xBB,0xC9,0xFB,0xBB,0xA9,0xFE,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0x88,0xFF,0xB3,0x88,0xFF,0xB3,0x68,0xFF,0xD4,0x28,0xFF,0xE4,0x86,0xFF,0xD4,0x47,0xFF,0xCC,0x08,0xFF,0xB3,0x89,0xFF,0xB3,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x89,0xFF,0xB3,0xA9,0xFF,0xC4,0x2A,0xFF,0xBB,0xC9,0xFF,0xBB,0x88,0xFF,0xBB,0x89,0xFF,0xBB,0x89,0xFF,0xBB,0x88,0xFF,0xBB,0xA9,0xFF,0xB3,0x48,0xFF,0xC4,0x0A,0xFF,0xE5,0x0C,0xFF,0xC3,0xC9,0xFF,0xAB,0x27,0xFF,0xA3,0x08,0xFF,0xB3,0x67,0xFF,0xED,0x06,0xFF,0xF5,0x27,0xFF,0xF5,0x27,0xFF,0xDC,0xA7,0xFF,0x9A,0xC7,0xFF,0x92,0x66,0xFF,0xAB,0x26,0xFF,0xCC,0x26,0xFF,0xDC,0x67,0xFF,0xCC,0x27,0xFF,0x9A,0xC7,0xFF,0x9A,0xA7,0xFF,0xA2,0xC7,0xFF,0xA2,0xE7,0xFF,0xAB,0x07,0xFF,0xAB,0x28,0xFF,0xAB,0x48,0xFF,0xB3,0x68,0xFF,0xB3,0x88,0xFF,0xBB,0xA8,0xFF,
-    0xB3,0xA9,0xFF,0xC3,0xE9,0xFF,0xEC,0xC7,0xFF,0xDC,0x47,0xFF,0xEC,0xA7,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA8,0xFF,0xBB,0xA8,0xFF,0xBB,0xA8,0xFF,0xBB,0xA8,0xFF,0xB3,0x89,0xFF,0xCB,0x48,0xFF,0xD3,0x28,0xFF,0xCB,0x28,0xFF,0xD3,0x69,0xFF,0x9A,0x66,0xFF,0x8A,0x66,0xFF,0xBB,0xA9,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFE,0xBB,0xC9,0xFA,0xBB,0xEA,0xFE,0xC4,0x0A,0xFF,0xDD,0x2F,0xFF,0xE6,0x14,0x9E,0x00,0x00,0x00,0xAD,0x4A,0x03,0xFD,0x4A,0x03,0x00,0x00,0x00,0xC4,0xAE,0x69,0xCC,0x2B,0xFF,0xBB,0xC9,0xF5,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xBB,0x89,0xFF,0xBB,0xA9,0xFF,0xB3,0x89,0xFF,0xB3,0x89,0xFF,0xB3,0x69,0xFF,0xBB,0xA9,0xFF,0xB3,0x89,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xC3,0xE8,0xFF,0xE4,0x87,0xFF,0xEC,0xE7,0xFF,0xCB,0xE8,0xFF,0xB3,0x89,0xFF,0xB3,0x89,0xFF,0xBB,0x89,0xFF,
-    0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x88,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xC3,0xE8,0xFF,0xCC,0x28,0xFF,0xCC,0x28,0xFF,0xC3,0xE9,0xFF,0xB3,0x89,0xFF,0xD4,0x28,0xFF,0xF5,0x27,0xFF,0xF5,0x27,0xFF,0xEC,0xA7,0xFF,0xEC,0xE8,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xE4,0xA8,0xFF,0xE4,0xA7,0xFF,0xD4,0x27,0xFF,0xBB,0xA8,0xFF,0xB3,0xA8,0xFF,0xBB,0xA8,0xFF,0xBB,0xA8,0xFF,0xBB,0x88,0xFF,0xB3,0x89,0xFF,0xC3,0x68,0xFF,0xD3,0x08,0xFF,0xCB,0x07,0xFF,0xCB,0x08,0xFF,0xD3,0x68,0xFF,0x92,0x66,0xFF,0x71,0xE5,0xFF,0xAB,0x68,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xEA,0xF9,0xBB,0xC9,0xFF,0xC4,0x4C,0x72,0x00,0x00,0x00,0x80,0x00,0x02,
-    0xFF,0xFF,0x01,0x00,0x00,0x00,0x98,0x00,0x08,0xBB,0xEA,0xEA,0xC4,0x0A,0xFF,0xBB,0xC9,0xF8,0xBB,0xC9,0xFD,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xBB,0xA9,0xFF,0xCC,0x28,0xFF,0xD4,0x48,0xFF,0xCC,0x28,0xFF,0xBB,0xA9,0xFF,0xB3,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xE4,0xA7,0xFF,0xEC,0xA7,0xFF,0xEC,0xC7,0xFF,0xEC,0xA7,0xFF,0xCB,0xE8,0xFF,0xBB,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x89,0xFF,0xB3,0x89,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xC3,0xE8,0xFF,0xF5,0x27,0xFF,0xEC,0xE7,0xFF,0xDC,0x27,0xFF,0xEC,0xE6,0xFF,0xE4,0xA7,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0x88,0xFF,0xBB,0xA8,0xFF,0xB3,0x88,0xFF,0xBB,0x88,0xFF,0xB3,0xA8,0xFF,
-    0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xCC,0x09,0xFF,0xBB,0x88,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA8,0xFF,0xBB,0xA8,0xFF,0xBB,0x88,0xFF,0xB3,0xA8,0xFF,0xCB,0x48,0xFF,0xD3,0x08,0xFF,0xBA,0xC7,0xFF,0xCB,0x08,0xFF,0xCB,0x48,0xFF,0xA3,0x27,0xFF,0x9B,0x07,0xFF,0xB3,0x88,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFE,0xBB,0xC9,0xFA,0xBB,0xC9,0xFE,0xCC,0x2B,0xFF,0xBB,0xA9,0x4D,0x00,0x00,0x00,0xBC,0x08,0x04,0x00,0x00,0x00,0xAA,0xAA,0x03,0x00,0x00,0x00,0xBB,0xCA,0x38,0xBB,0xCA,0xEA,0xCC,0x0A,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFE,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xDC,0xA8,0xFF,0xEC,0xE8,0xFF,0xE4,0xC8,0xFF,0xC3,0xE8,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xC3,0xC8,0xFF,0xEC,0xA7,0xFF,0xDC,0x67,0xFF,0xDC,0x67,0xFF,0xE4,0xA8,0xFF,0xBB,0x89,0xFF,0xBB,0xA9,0xFF,
-    0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xDC,0x88,0xFF,0xE4,0xA8,0xFF,0xD4,0x48,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xB3,0x89,0xFF,0xDC,0x88,0xFF,0xEC,0xE6,0xFF,0xDC,0x46,0xFF,0xEC,0xE6,0xFF,0xF5,0x26,0xFF,0xCC,0x08,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA8,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x88,0xFF,0xBB,0xA8,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x89,0xFF,0xB3,0x88,0xFF,0xBB,0x88,0xFF,0xBB,0xA8,0xFF,0xC3,0x68,0xFF,0xCA,0xE7,0xFF,0xC2,0xC6,0xFF,0xD3,0x07,0xFF,0xBB,0x68,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFE,0xBB,0xA9,0xFC,0xBB,0xA9,0xFA,0xBB,0xC9,0xFF,0xCC,0x0A,0xFF,0xC3,0xEA,0xFF,0xBB,0xCA,0x74,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0x00,0x00,0x00,0xCC,0x0B,0x0E,0xBB,0xA9,0x8A,0xBB,0xA9,0xEC,0xC3,0xEA,0xFF,0xC3,0xE9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFC,0xBB,0xA9,0xFA,0xBB,0xA9,0xFC,0xBB,0xA9,0xFD,0xBB,0xA9,0xFE,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA8,0xFF,0xE4,0x87,0xFF,0xEC,0xE7,0xFF,0xE4,0xA7,0xFF,0xD4,0x28,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xDC,0x88,0xFF,0xE4,0xA8,0xFF,0xDC,0x88,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xD4,0x27,0xFF,0xE4,0xA6,0xFF,0xF5,0x07,0xFF,0xF5,0x07,0xFF,0xD4,0x47,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x88,0xFF,0xB3,0x88,0xFF,0xB3,0x88,0xFF,0xB3,0x28,0xFF,0xB3,0x48,0xFF,
-    0xB3,0x88,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xC3,0xE8,0xFF,0xC3,0xE8,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xBB,0x88,0xFF,0xB2,0xE7,0xFF,0xC3,0x27,0xFF,0xBB,0x68,0xFF,0xB3,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFE,0xBB,0xA9,0xFC,0xBB,0xC9,0xFA,0xBB,0xC9,0xFB,0xBB,0xA9,0xFF,0xC3,0xEA,0xFF,0xCC,0x0A,0xFF,0xBB,0xA9,0xFE,0xBB,0xC9,0xB4,0xBB,0xC9,0x34,0x00,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0x8A,0x10,0xB3,0xA9,0x60,0xBB,0xA9,0xB4,0xBB,0xA9,0xEF,0xC3,0xC9,0xFF,0xC3,0xE9,0xFF,0xC3,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFE,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFD,0xBB,0x89,0xFE,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xCC,0x08,0xFF,0xCC,0x08,0xFF,0xBB,0x68,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,
-    0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x89,0xFF,0xB3,0x89,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xBB,0x88,0xFF,0xD4,0x48,0xFF,0xD4,0x48,0xFF,0xC3,0xC8,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xBB,0xA9,0xFF,0xBB,0x89,0xFF,0xB3,0x68,0xFF,0xB3,0x68,0xFF,0xB3,0x89,0xFF,0xBB,0xA9,0xFF,0xAA,0xE7,0xFF,0xA2,0x26,0xFF,0xA2,0x26,0xFF,0xB3,0x27,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xD4,0x68,0xFF,0xF5,0x27,0xFF,0xF5,0x27,0xFF,0xDC,0x88,0xFF,0xBB,0x89,0xFF,0xB3,0x88,0xFF,0xB3,0x68,0xFE,0xBB,0xA9,0xFD,0xB3,0xA9,0xFC,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFD,0xBB,0xC9,0xFF,0xC3,0xE9,0xFF,0xCC,0x0A,0xFF,0xC3,0xEA,0xFF,0xBB,0xC9,0xF9,0xBB,0xC9,0xC6,0xBB,0xA9,0x7A,0xB3,0xA9,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xBC,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0xCA,0x13,0xBB,0xA9,0x4B,0xBB,0xA9,0x89,0xBB,0xA9,0xC2,0xBB,0xA9,0xEC,0xBB,0xA9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFD,0xBB,0xA9,0xFC,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFC,0xBB,0xA9,0xFD,0xBB,0x89,0xFE,0xBB,0x89,0xFE,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x69,0xFF,0xB3,0x89,0xFF,0xB3,0x89,0xFF,0xBB,0xA8,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xB3,0x48,0xFF,0xA2,0x46,0xFF,0xA2,0x86,0xFF,0xB3,0x88,0xFF,0xBB,0x89,0xFF,0xB3,0x88,0xFF,0xB3,0x88,0xFF,0xB3,0x88,0xFF,
-    0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFE,0xBB,0xA9,0xFE,0xBB,0xC9,0xFD,0xCC,0x28,0xFC,0xCC,0x28,0xFB,0xC3,0xE8,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFC,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xC3,0xC9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xC9,0xFF,0xBB,0xA9,0xF4,0xBB,0xA9,0xCD,0xBB,0xA9,0x97,0xBB,0xC9,0x59,0xB3,0xCA,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0xAA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xBC,0x08,0x04,0xAA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB3,0x49,0x11,0xBB,0x88,0x36,0xBB,0xA9,0x62,0xB3,0xA9,0x91,0xBB,0xA9,0xB8,0xBB,0xA9,0xDD,0xBB,0xA9,0xF3,0xBB,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFC,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,
-    0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xC9,0xFB,0xBB,0xA9,0xFC,0xBB,0xA9,0xFC,0xBB,0xC9,0xFC,0xBB,0xA9,0xFC,0xBB,0xA9,0xFD,0xBB,0xA9,0xFC,0xBB,0xA9,0xFD,0xBB,0xA9,0xFD,0xBB,0xA9,0xFD,0xBB,0xA9,0xFD,0xBB,0xA9,0xFD,0xBB,0xA9,0xFD,0xBB,0xA9,0xFD,0xBB,0xA9,0xFD,0xBB,0xA9,0xFD,0xBB,0xA8,0xFD,0xBB,0x88,0xFD,0xB3,0x88,0xFD,0xB3,0x89,0xFD,0xB3,0x88,0xFC,0xBB,0x89,0xFC,0xB3,0x88,0xFC,0xB3,0x88,0xFC,0xBB,0x88,0xFC,0xBB,0x88,0xFB,0xBB,0xA8,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFB,0xBB,0xA9,0xFC,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xA9,0xFF,0xBB,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xC9,0xFF,0xB3,0xA8,0xFD,0xBB,0xA9,0xE7,0xBB,0xA8,0xC6,0xB3,0x89,0x9F,0xBB,0x88,0x6F,0xB3,0xA8,0x42,0xBB,0xA9,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0x9B,0x26,0x05,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x00,0x02,0xBC,0x08,0x04,0x9B,0x26,0x05,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x08,0x04,0xBB,0xA8,0x1A,0xBB,0xA9,0x37,0xB3,0xA9,0x55,0xBB,0xA9,0x7B,0xBB,0xA9,0x93,0xBB,0xA9,0xBB,0xBB,0xA9,0xC9,0xBB,0xA9,0xE6,0xBB,0xA9,0xF6,0xBB,0xA9,0xFD,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xEA,0xFF,0xC4,0x0A,0xFF,0xC4,0x0A,0xFF,0xC4,0x0A,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xBB,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xC9,0xFF,0xC3,0xE9,0xFF,
-    0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xE9,0xFF,0xC3,0xC9,0xFF,0xBB,0xA9,0xFC,0xBB,0xA9,0xF5,0xBB,0xA9,0xE0,0xBB,0xC9,0xC6,0xBB,0xA9,0xB0,0xBB,0xA9,0x88,0xBB,0xA9,0x6D,0xBB,0xA8,0x44,0xB3,0x88,0x29,0xBB,0xA8,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xBC,0x08,0x04,0xBC,0x08,0x04,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xAA,0xAA,0x03,0xBC,0x08,0x04,0xBC,0x08,0x04,0xAA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB3,0xA9,0x0D,0xBB,0x88,0x19,0xBB,0xA9,0x2B,0xBB,0xA9,0x49,0xBB,0xC9,0x55,0xBB,0xA9,0x6B,
-    0xBB,0xA9,0x8E,0xBB,0xA9,0x99,0xBB,0xC9,0xA2,0xBB,0xC9,0xB1,0xBB,0xC9,0xC2,0xBB,0xA9,0xD1,0xBB,0xA9,0xD5,0xBB,0xA9,0xD5,0xBB,0xA9,0xD6,0xBB,0xA9,0xD7,0xBB,0xA9,0xD9,0xBB,0xA9,0xDA,0xBB,0xA9,0xDA,0xBB,0xA9,0xDB,0xBB,0xA9,0xDC,0xBB,0xA9,0xDB,0xBB,0xA9,0xDC,0xBB,0x88,0xDB,0xBB,0xA8,0xDA,0xBB,0xA8,0xD9,0xBB,0xA8,0xD8,0xBB,0xA8,0xD7,0xBB,0xA8,0xD6,0xB3,0x88,0xD5,0xB3,0x88,0xD4,0xB3,0x88,0xD4,0xB3,0x88,0xCA,0xB3,0x88,0xBC,0xB3,0x88,0xAF,0xB3,0x89,0xA4,0xBB,0x88,0x9A,0xBB,0xA8,0x96,0xB3,0xA9,0x8B,0xBB,0xA9,0x6A,0xBB,0xA9,0x54,0xBB,0xA8,0x48,0xBB,0xA9,0x27,0xBB,0xC9,0x17,0xAB,0x8A,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xBC,0x08,0x04,0xBC,0x08,0x04,0xAA,0xAA,0x03,0x84,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x84,0x00,0x02,0xAA,0xAA,0x03,0xBC,0x08,0x04,0xBC,0x08,0x04,0xBC,0x08,0x04,0xAA,0xAA,0x03,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xFC,0x10,0x02,0xAA,0xAA,0x03,0xAA,0xAA,0x03,0xBC,0x08,0x04,0xBC,0x08,0x04,0xBC,0x08,0x04,0xAA,0xAA,0x03,0xFC,0x10,0x02,0x84,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x00,0x02,0xAA,0xAA,0x03,0xBC,0x08,0x04,0xBC,0x08,0x04,0xAD,0x4A,0x03,0xFC,0x10,0x02,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0x84,0x00,0x02,0xFC,0x10,0x02,0xBC,0x08,0x04,0xBC,0x08,0x04,0xBC,0x08,0x04,
-    0xBC,0x08,0x04,0xBC,0x08,0x04,0xAD,0x4A,0x03,0xAA,0xAA,0x03,0x84,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0x84,0x10,0x02,0xAA,0xAA,0x03,0xAA,0xAA,0x03,0xBC,0x08,0x04,0xBC,0x08,0x04,0xBC,0x08,0x04,0xBC,0x08,0x04,0xBC,0x08,0x04,0xBC,0x08,0x04,0xFC,0x10,0x02,0x84,0x00,0x02,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_home_fall_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_home_fall_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_home_fall_png_data
-};
-
@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/home_rain.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_home_rain_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x1A,0x21,0xBD,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,
-    0xA5,0xFA,0x26,0x9D,0xD9,0x88,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x9D,0xF9,0x7A,0xA5,0xFA,0x43,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xA6,0x5B,0x0E,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xBB,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x1A,0x11,
-    0x9D,0xF9,0x8D,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xAE,0x3A,0x28,0xAE,0x3A,0x23,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xF9,0x54,0xBD,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xA6,0x1A,0x49,0xAE,0x5A,0x33,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xA6,0x19,0x55,0xA6,0x3A,0x28,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x9D,0xD9,0x5A,0x9D,0xD9,0x45,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xAE,0x3A,0x85,0xAE,0x19,0x19,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0xBA,0x06,0xBE,0xFB,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x3A,0x3C,0xA6,0x19,0x65,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x3A,0x1B,0xA6,0x19,0x45,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA5,0xDA,0x0B,0xA6,0x1A,0x83,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0xA6,0x5A,0x17,0xA6,0x19,0x88,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xA5,0xBB,0x0E,0xA5,0xDA,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xAE,0x3A,0x2B,
-    0x55,0x55,0x03,0xFF,0xFF,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xAE,0x39,0x34,0xAE,0x39,0x75,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x9D,0xF9,0x22,0xA6,0x1A,0x21,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x5A,0x73,0xAE,0x3A,0x23,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x3A,0x88,0xAE,0x3A,0x1E,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,
-    0xAE,0x79,0x10,0xB5,0xBB,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x75,0xAE,0x1A,0x44,0x00,0x00,0x00,0x95,0xBB,0x07,0x00,0x00,0x00,0xA6,0x1A,0x61,0xA6,0x19,0x54,0x00,0x00,0x00,0x9D,0xF7,0x08,0x00,0x00,0x00,0xAE,0x3A,0x6E,0xAE,0x1A,0x4C,0x00,0x00,0x00,0xD6,0xBA,0x06,0xFF,0xFF,0x05,0xFF,0xFF,0x04,0xFF,0xFF,0x05,0x00,0x00,0x00,0xA6,0x3A,0x68,0xAD,0xFA,0x0C,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xAE,0x39,0x75,0xAE,0x3A,0x2C,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x19,0x76,0xA6,0x19,0x19,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xAE,0x3A,0x1F,0xAE,0x3A,0x8F,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xAE,0x3A,0x32,0xA6,0x19,0x80,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x58,0x09,0xA6,0x19,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x5A,0x13,0xA6,0x3A,0x93,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xB6,0xDB,0x07,0xAE,0x19,0x95,0xBF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x79,0x0A,0xAE,0x3A,0x96,0xFF,0xFF,0x02,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xD8,0x2F,0xA6,0x19,0x5F,0x00,0x00,0x00,0x55,0x55,0x03,0xFF,0xFF,0x02,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x9E,0x1A,0x21,0xB6,0xDB,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xA6,0x7B,0x14,0xA6,0x19,0x73,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xA6,0x19,0x2E,0xA6,0x19,0x76,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x19,0x6F,0xAE,0x3A,0x47,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xA6,0x19,0x7C,0x9D,0xF9,0x28,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x5B,
-    0xA6,0x19,0x4B,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x66,0xA6,0x19,0x59,0x00,0x00,0x00,0x9D,0xF7,0x08,0x00,0x00,0x00,0xAE,0x1A,0x5D,0xAE,0x3A,0x63,0x00,0x00,0x00,0x9D,0xF7,0x08,0x00,0x00,0x00,0xA6,0x39,0x53,0xAE,0x3A,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDF,0x2B,0xFF,0xFF,0x76,0xFF,0xFF,0x99,0xFF,0xFF,0x80,0xBE,0xBB,0xB6,0xBE,0x9B,0x29,0x00,0x00,0x00,0xFF,0xFF,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x2B,0xFF,0xFF,0x5A,0xFF,0xFF,0x4C,0xB6,0x7A,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA5,0xF9,0x1F,0xA6,0x19,0x25,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x79,0xAE,0x1A,0x33,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x5B,0x0E,0xA6,0x19,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xB6,0x07,0xA6,0x1A,0x32,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0x9D,0x99,0x0A,0xA6,0x19,0x91,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xA6,0x1A,0x92,0xAE,0x3C,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xA6,0x19,0x99,0xAD,0xFA,0x0C,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x19,0x83,0xBE,0x9B,0x16,0x00,0x00,0x00,0xFF,0xFF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x7E,0xFF,0xFF,0xFF,0xE4,0xFF,0xDF,0x3D,0x00,0x00,0x00,0xF7,0x9E,0x15,0xFF,0xFF,0xB1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xF7,0xDF,0xFF,0xE7,0x9E,0xFF,0xFF,0xFF,0xA4,0xDE,0xDB,0x07,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x3A,0x16,0xAE,0x3A,0x87,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x1A,0x31,0x9D,0xF9,0x36,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x63,0xA6,0x19,0x5E,
-    0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x19,0x39,0xA6,0x1A,0x57,0x00,0x00,0x00,0xB5,0xBB,0x07,0x00,0x00,0x00,0xA5,0xF9,0x54,0xA6,0x19,0x6D,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0x9D,0xD8,0x12,0xAE,0x39,0x4B,0x00,0x00,0x00,0xFF,0xFF,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xD7,0x3C,0xFB,0xEF,0xBE,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xFF,0xDF,0x5F,0xFF,0xFF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xD7,0x1C,0xFC,0xF7,0xDF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA5,0xFA,0x3C,0x95,0xB6,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x3A,0x5C,0xA6,0x19,0x4C,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x38,0x09,0xB6,0x3B,0x0D,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x64,0xD3,0x05,0xA6,0x1A,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x79,0x05,0xA6,0x19,0x9D,0xBD,0xFB,0x08,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x19,0x19,0x95,0xBB,0x07,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xA6,0x19,0x95,0xAE,0x3A,0x12,0x00,0x00,0x00,0x87,0xFF,0x02,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xCE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,
-    0xD7,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0xAE,0x3B,0x27,0xA6,0x1A,0x7C,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xA6,0x3A,0x7D,0xAD,0x55,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x85,0xAE,0x3A,0x38,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x53,0xA6,0x1A,0x62,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x5E,0xA6,0x3A,0x6C,0x00,0x00,0x00,
-    0xBD,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x39,0x49,0xA6,0x19,0x70,0x00,0x00,0x00,0xB6,0xDB,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xDF,0x2C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x5D,0xFF,0xE7,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x3C,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF7,0xBE,0x1F,0x00,0x00,0x00,0xB6,0xDB,0x07,0x00,0x00,0x00,0xA6,0x3A,0x7D,0xAE,0x3A,0x3E,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x3A,0x3C,0xA6,0x19,0x52,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x5A,0x1C,0xAE,0x3A,0x9C,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3A,0x9C,0xC6,0xDB,0x0D,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0xA1,0xA6,0x1A,0x11,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x19,0x8B,0xA6,0x3A,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0xFF,0xFF,0x5D,0xFF,0xFF,0x9E,0xFF,0xFF,0xB5,0xFF,0xFF,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xCE,0xFC,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xDB,0x28,0x9D,0xD9,0x98,0x00,0x00,0x00,0xBF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x9D,0xF9,0x48,0x9D,0xD9,0x0F,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xFF,0x04,0x00,0x00,0x00,0xAE,0x3A,0x73,0xAE,0x1A,0x51,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x3A,0x57,0xAE,0x3A,0x78,0x00,0x00,0x00,0x9C,0xD9,0x05,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x55,0xA6,0x39,0x79,0x00,0x00,0x00,0x9C,0xD9,0x05,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x3A,0x3C,0xA5,0xF9,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x1B,0xFF,0xFF,0xD3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9E,0xFF,0xDF,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x5D,0xFF,0xE7,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0xFF,0xFF,0xA2,0xFF,0xFF,0xC8,0xD7,0x1C,0xF8,0xD7,0x3D,0xD3,0xFF,0xFF,0x19,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x9E,0x79,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xB6,0x3B,0x0D,0xA6,0x3A,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x19,0x9F,0xAE,0x7A,0x19,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x1A,0x9F,0xA6,0x39,0x1A,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA5,0xF9,0x7D,0xA5,0xD9,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x1C,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xFC,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xF7,0xBE,0x21,0x00,0x00,0x00,0xFF,0xFF,0x01,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x1A,0x51,0x9D,0xB9,0x15,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x61,0xA6,0x1A,0x59,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0xFF,0xFF,0x01,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x3A,0x46,0xA6,0x19,0x7C,0x00,0x00,0x00,0xBD,0xFF,0x04,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xA6,0x1A,0x47,0xA6,0x3A,0x7D,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,
-    0x84,0x1F,0x02,0x00,0x00,0x00,0xA5,0xF9,0x24,0xA5,0xF9,0x32,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x9D,0xF9,0x30,0x9D,0xF9,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDF,0x2C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xDF,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0xFF,0xDF,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xDF,0x5D,0xFC,0xDF,0x5D,0xFE,0xFF,0xFF,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0xAE,0x3A,0x30,0xA6,0x1A,0x31,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x39,0x1A,0xA6,0x19,0x75,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xFF,0x04,0xAE,0x1A,0x8F,0xAE,0xBA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x19,0x89,0xA6,0x3A,0x1B,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x19,0x7D,0xA6,0x19,0x19,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA5,0xF9,0x72,0xA6,0x5A,0x17,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x9E,0x19,0x5D,0x9D,0xF9,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x3D,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xFC,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xDF,0xD8,0x00,0x00,0x00,0xAE,0x1A,0x6C,0xAE,0x1B,0x15,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x1A,0x64,0xA6,0x19,0x44,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA6,0x19,0x4E,0xA6,0x19,0x59,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x9A,0x0B,0xA5,0xFA,0x42,0x00,0x00,0x00,0xA6,0x19,0x25,0xA6,0x19,0x55,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xBB,0x07,0xA5,0xF9,0x20,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x87,0xFF,0x02,
-    0x00,0x00,0x00,0xA5,0xF9,0x33,0xA5,0xF9,0x72,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x85,0xF7,0x04,0x9D,0xFA,0x18,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x2F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xD6,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x7E,0xFF,0xD7,0x3D,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xB3,0x5D,0x16,0x1B,0xAE,0x3A,0x74,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0xBA,0x06,0xA6,0x19,0x8E,0xBD,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x72,0xAE,0x38,0x09,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x56,0xA6,0x1A,0x5C,0x00,0x00,0x00,0x9D,0xFB,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA6,0x19,0x83,0xAE,0x19,0x29,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0xAE,0x3A,0x2D,0x00,0x00,0x00,0xFF,0xFF,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x7E,0xFD,0xE7,0x5D,0xFC,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x1C,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xCE,0xFC,0xFC,0xF7,0xBF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x95,0xD9,0x60,0xAE,0x3A,0x3E,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA6,0x1A,0x4C,0xA6,0x19,0x68,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x9D,0xD9,0x0F,0x9E,0x19,0x25,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xA6,0x1A,0x92,0xAD,0xF9,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,
-    0xAE,0x3A,0x28,0xA6,0x19,0x8B,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xAE,0x3A,0x4D,0xAE,0x3A,0x49,0x00,0x00,0x00,0xF7,0xFF,0x12,0xFF,0xFF,0xA9,0xFF,0xFF,0xF2,0xFF,0xFF,0xFF,0xDF,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xCE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0xDF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xFF,0xFF,0xD6,0xFF,0xFF,0x57,0x00,0x00,0x02,0xAE,0x1A,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x1A,0x88,0xB6,0x3B,0x1A,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x3A,0x3F,0xAE,0x1A,0x7E,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x80,0xA6,0x19,0x3F,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x9A,0x0B,0xA6,0x19,0x89,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x07,0xD6,0xFC,0x68,0xB6,0x5A,0xA6,0xFF,0xFF,0x31,0xF7,0xBF,0x3C,0xF7,0xDF,0x3A,0xF7,0xDF,0x3A,0xF7,0xDF,0x3D,0xFF,0xFF,0x2B,0xD7,0x1D,0x99,0xE7,0xBF,0xFF,0xDF,0x5D,0xFC,0xE7,0x7E,0xFF,0xC6,0xDC,0xFF,0xC6,0xDC,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFD,
-    0xDF,0x5D,0xFF,0xDF,0x3D,0x6C,0xFF,0xFF,0x2F,0xF7,0xBE,0x3E,0xFF,0xFF,0x32,0xBE,0x9B,0xA8,0xDF,0x3D,0x55,0xFF,0xFF,0x34,0xF7,0xBF,0x1E,0x00,0x00,0x01,0x00,0x00,0x00,0xAE,0x3A,0x59,0xA6,0x19,0x65,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xA6,0x3A,0x2B,0xA6,0x19,0x76,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x1A,0x8C,0xAE,0x3A,0x30,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x7A,0x19,
-    0xA6,0x19,0x98,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xFF,0x04,0x00,0x00,0x00,0xA6,0x19,0x69,0xA5,0xF9,0x50,0x00,0x00,0x00,0xAD,0x5F,0x03,0xFF,0xFF,0x01,0xB6,0xDB,0x07,0x00,0x00,0x00,0x95,0xD9,0x81,0x95,0xD8,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x7B,0xCF,0xD7,0x5D,0xFF,0xCF,0x1C,0xFC,0xCF,0x1C,0xFF,0xB6,0x7A,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFD,0xD7,0x3D,0xFF,0xB6,0x7A,0xE7,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x95,0x15,0xA5,0xF9,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xA6,0x19,0x94,0xA6,0x1A,0x19,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x66,0xA5,0xF9,0x2C,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xAE,0x5A,0x22,0xA6,0x39,0x96,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xA5,0xF9,0x4C,0xA6,0x19,0x19,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x73,0xA6,0x19,0x54,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x3A,0x12,0xA6,0x19,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x1A,0x22,0xA6,0x19,0x97,0x00,0x00,0x00,0xD6,0xBA,0x06,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xDE,0xDB,0x07,0x00,0x00,0x00,0xA6,0x3A,0x51,0xD7,0x7E,0xFF,0xDF,0x5D,0xFB,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1C,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFB,0xDF,0x7E,0xFF,
-    0xAE,0x3A,0xA4,0x00,0x00,0x00,0xD6,0x9D,0x0B,0x00,0x00,0x00,0xAE,0x3A,0x6D,0xAE,0x3A,0x3C,0x00,0x00,0x00,0xD6,0xBA,0x06,0xBF,0xFF,0x04,0x00,0x00,0x00,0xAE,0x39,0x35,0xA6,0x19,0x86,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA5,0xF9,0x20,0xA6,0x9A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xA5,0xF9,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xFF,0x04,0x00,0x00,0x00,0xA6,0x1A,0x75,0xAE,0x3A,0x52,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x9E,0x19,0x15,0xA6,0x19,0x7F,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xBE,0x9A,0x0B,0xA6,0x1A,0x9D,
-    0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xD9,0x05,0x00,0x00,0x00,0xA6,0x19,0x73,0xA6,0x39,0x4B,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x6F,0xA6,0x39,0x46,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x7A,0xB8,0xD7,0x5D,0xFF,0xCE,0xFC,0xFB,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFA,0xCF,0x1D,0xFF,0xB6,0x7B,0x6A,0x00,0x00,0x00,0xFF,0xFF,0x01,0xA6,0x59,0x0E,0xAE,0x39,0x86,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x82,0xAE,0x19,0x3B,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0xA6,0x19,0x81,0x9D,0xF7,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0xBD,0xFB,0x08,0xA6,0x19,0x9D,0xCE,0x79,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x66,0xAE,0x1A,0x4C,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x60,0xA6,0x19,0x67,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x7A,0x19,0xA6,0x19,0x94,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xDA,0x0B,0xA6,0x19,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xBE,0xFC,0x2C,0x95,0xB9,0xFF,0x6C,0xF7,0xFF,0x75,0x38,0xFE,0x75,0x37,0xFF,0x75,0x38,0xFF,0x75,0x58,0xFF,0x64,0x75,0xFF,0x4B,0x72,0xFF,0x4B,0x92,0xFC,0x7D,0x17,0xFF,
-    0x8D,0x16,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3A,0x58,0xAE,0x1A,0x51,0x00,0x00,0x00,0x85,0xF7,0x04,0x07,0xFF,0x01,0x00,0x00,0x00,0xA6,0x79,0x14,0xA6,0x39,0x96,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x39,0x41,0xA6,0x39,0x74,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x54,0xA6,0x19,0x6F,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0xBA,0x06,0xAE,0x1A,0x95,0xCE,0x7F,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x9B,0xAE,0x79,0x10,
-    0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xAE,0x39,0x85,0xA6,0x19,0x47,0x00,0x00,0x00,0x95,0xB6,0x07,0xAD,0x55,0x03,0x84,0x10,0x04,0x00,0x00,0x00,0x95,0xB8,0x11,0x9D,0xB9,0x18,0x00,0x00,0x00,0x84,0x10,0x04,0x84,0x10,0x02,0x84,0x10,0x02,0xB5,0xBB,0x07,0x00,0x00,0x00,0xBE,0x9B,0x92,0xBE,0xDC,0xFF,0x64,0xF7,0xFA,0x75,0x37,0xFF,0x75,0x37,0xFF,0x75,0x37,0xFF,0x75,0x38,0xFF,0x5C,0x14,0xFF,0x42,0xF0,0xFF,0x5B,0xD2,0xFD,0x85,0x37,0xFF,0x43,0x72,0x57,0x00,0x00,0x00,0x84,0xF7,0x08,0xA6,0x19,0x81,0xAE,0xBA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x5E,0xA6,0x3A,0x5C,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x86,0xAE,0x1A,0x2F,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA5,0xD8,0x16,0xAD,0x5A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xA6,0x19,0x90,0xA5,0xFA,0x1C,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x53,0xA6,0x19,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xF9,0x3B,0xAE,0x1A,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x4B,0xA5,0xF9,0x77,0x00,0x00,0x00,0x85,0x55,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xBE,0x7B,0x2A,0xB6,0x5A,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x36,0x0A,0xCE,0xFC,0xED,0xF7,0xDE,0xFF,0xD6,0xDA,0xFD,0xCD,0xD5,0xFF,0xCD,0xD5,0xFF,0xCD,0xB5,0xFF,0xC5,0x94,0xFF,0xC5,0x32,0xFF,0xC4,0xF0,0xFD,0xBD,0xD6,0xFF,0xA6,0x39,0x7E,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xF9,0x2C,0xA6,0x19,0x41,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3A,0x87,0xAE,0x79,0x0F,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xB6,0x39,0x1A,0xAE,0x3A,0x93,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xAD,0xD9,0x0F,0xA6,0x1A,0x67,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x19,0x2F,0xA6,0x19,0x7E,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x19,0x93,0xAE,0x3A,0x1B,0x00,0x00,0x00,0xAD,0x55,0x03,0xA6,0x19,0x7E,0xB6,0xDB,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xF9,0x92,0xA6,0x39,0x1F,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x5A,0xB8,0x9D,0x98,0x97,0x95,0x36,0x55,0x9D,0xB8,0x62,0x9D,0x98,0x54,0x9D,0x97,0x45,0x95,0x37,0x3A,0x84,0xF6,0x31,0x74,0xB4,0x2B,0x6C,0x73,0x28,0x74,0x74,0x24,0x6C,0x54,0x23,0x6C,0x33,0x22,0x6C,0x94,0x25,0x4B,0x30,0x17,0xA5,0xF9,0x83,0xD7,0x5D,0xFF,0xE7,0x5D,0xFB,0xE7,0x1B,0xFF,0xE6,0xB7,0xFF,0xE6,0x97,0xFF,0xE6,0x97,0xFF,0xDE,0x15,0xFF,0xCD,0x31,0xFF,0xCD,0x51,0xFC,0xBE,0x17,0xFF,0xD6,0xB9,0x3A,0x00,0x00,0x00,0x9C,0xD3,0x05,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x87,0xFF,0x02,0x00,0x00,0x00,0xAE,0x3A,0x23,0xA6,0x39,0x53,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x64,0xA6,0x3A,0x5C,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x5F,0xAE,0x19,0x4A,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x6D,0xA6,0x1A,0x32,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x39,0x34,0xA6,0x19,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x39,0x49,0xA6,0x19,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x35,0xA6,0x19,0x82,0x00,0x00,0x00,0x84,0x17,0x04,0xA5,0xD9,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x37,0xB4,0x9E,0x1A,0xFF,0x6C,0xF6,0xFF,0x5C,0x14,0xFF,0x5B,0xF3,0xFF,0x5B,0xF3,0xFF,0x53,0xD3,0xFF,0x53,0xB2,0xFF,0x4B,0x92,0xFF,0x4B,0x92,0xFF,0x4B,0x71,0xFF,0x4B,0x91,0xFE,0x4B,0xB2,0xFD,0x4B,0x91,0xFD,0x4B,0x71,0xFD,0x53,0xD3,0xFE,0x8D,0x57,0xFF,0x4B,0x91,0xFE,0x2B,0x31,0xFF,0xB5,0x96,0xFF,0xE6,0x97,0xFF,0xD6,0x15,0xFF,0xDE,0x56,0xFF,0xDE,0x56,0xFF,0xCD,0x30,0xFF,0xC5,0x94,0xFC,0xBD,0xD5,0xFF,0x9C,0xD3,0xD1,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5A,0x06,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xA6,0x39,0x96,0xA5,0xF9,0x13,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x3A,0x2C,0x9E,0x79,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xBB,0x07,0xAE,0x19,0x8F,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xFA,0x0C,0x9D,0xF9,0x69,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x7A,0xA6,0x19,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x89,0x9D,0xF9,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x83,0xA6,0x19,0x32,0x00,0x00,0x00,0x9D,0xF9,0x3B,
-    0x9D,0xF9,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xD6,0xAA,0x85,0xB9,0xFF,0x85,0x57,0xFA,0x75,0x17,0xFC,0x64,0x75,0xFA,0x3B,0x10,0xFB,0x43,0x51,0xFC,0x43,0x72,0xFD,0x43,0x72,0xFE,0x43,0x71,0xFF,0x4B,0x92,0xFF,0x43,0x71,0xFF,0x3A,0xCF,0xFF,0x3B,0x30,0xFF,0x4B,0x91,0xFF,0x33,0x31,0xFF,0x74,0xB5,0xFF,0x6C,0x95,0xFD,0x43,0x51,0xFF,0x02,0xD0,0xFF,0xA5,0x14,0xFF,0xEE,0xB7,0xFF,0xDE,0x15,0xFF,0xE6,0x76,0xFF,0xDE,0x56,0xFF,0xCD,0x31,0xFF,0xBD,0xB5,0xFF,0xCD,0xB3,0xFB,0x84,0x32,0xFF,0x43,0x71,0x9C,0x00,0x00,0x00,0x02,0x10,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x7B,0x0F,0xA6,0x1A,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x5A,0x38,0xA6,0x19,0x80,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xAE,0x5A,0x25,0xAE,0x3A,0x68,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x19,0x50,0xAE,0x3A,0x5F,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3C,0x09,0xA6,0x1A,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x9D,0xF9,0x18,0xA6,0x19,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x39,0x34,0xA6,0x19,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x25,0xA6,0x19,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x7F,0x8D,0x77,0x10,0x00,0x00,0x00,0x7D,0x17,0x87,0x75,0x38,0xFF,0x74,0xF7,0xF9,0x64,0xD6,0xFF,0x6C,0xF7,0xFF,0x75,0x17,0xFF,0x5C,0x13,0xFF,0x3A,0xF0,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFE,0x43,0x51,0xFE,0x43,0x51,0xFE,0x3A,0xEF,0xFE,0x3B,0x10,0xFE,0x3A,0xCF,0xFE,0x3B,0x10,0xFE,0x3B,0x10,0xFE,0x7D,0x16,0xFE,0x43,0x30,0xFF,0x3B,0x0F,0xFF,0x2A,0xAE,0xFF,0x5B,0x91,0xFF,0xE6,0xB8,0xFF,0xEE,0xF9,0xFF,0xEE,0xF9,0xFF,0xE6,0x56,0xFF,0xC5,0x52,0xFF,0xBD,0xB5,0xFF,0xCD,0x72,0xFF,0x7C,0x11,0xFB,
-    0x33,0x31,0xFF,0x64,0x12,0x72,0x00,0x00,0x00,0x74,0x71,0x09,0x00,0x00,0x00,0xA6,0x39,0x57,0xA6,0x39,0x30,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x7B,0xAE,0x1A,0x37,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xAE,0x3A,0x79,0xAE,0x5A,0x22,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x19,0x71,0xAE,0x7B,0x0F,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0xFB,0x08,0xAE,0x3A,0x4C,0x00,0x00,0x00,0x00,0x00,0x01,0x87,0xFF,0x02,0x00,0x00,0x00,0xA5,0xF9,0x38,0xA6,0x19,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x82,0xAE,0x1A,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x5A,0x1C,0xA6,0x5A,0x17,0x00,0x00,0x00,0xA6,0x39,0x4A,0xA6,0x19,0x67,
-    0x00,0x00,0x00,0x85,0x57,0x61,0x75,0x17,0xFF,0x74,0xF7,0xFC,0x4B,0xF4,0xFF,0xB5,0x75,0xFF,0x95,0x57,0xFF,0x64,0xF6,0xFF,0x75,0x17,0xFF,0x53,0xF3,0xFF,0x3B,0x30,0xFF,0x3B,0x10,0xFF,0x43,0x30,0xFF,0x3B,0x10,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x50,0xFF,0x32,0xAF,0xFF,0x5C,0x13,0xFF,0x74,0xB5,0xFF,0x2A,0xAF,0xFF,0x43,0x30,0xFF,0x4B,0x50,0xFF,0x23,0x10,0xFF,0x7C,0x53,0xFF,0xEE,0xF9,0xFF,0xF7,0x1A,0xFF,0xE6,0x56,0xFF,0xBD,0x73,0xFF,0xBD,0x94,0xFF,0xCD,0x71,0xFF,0x73,0xF1,0xFE,0x2B,0x10,0xFE,0x4B,0x71,0xFF,0x6C,0x53,0x4C,0x00,0x00,0x00,0x9D,0x57,0x0F,0xA6,0x3A,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x3B,0x0D,0xA6,0x19,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xAE,0x3A,0x30,0xAE,0x3A,0x7C,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0xBA,0x06,0xAD,0xFA,0x18,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA5,0xF9,0x58,0xA6,0x1A,0x4E,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x39,0x1E,0xA6,0x19,0x91,0x00,0x00,0x00,0x84,0x1F,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x90,0xFF,0xFF,0x02,0x8D,0x98,0x2D,0x6C,0xD6,0xFF,0x6C,0xD6,0xFF,0x54,0x35,0xFD,0x8C,0x52,0xFF,0xE6,0x15,0xFF,0xCD,0xF5,0xFF,0x6C,0xF6,0xFF,0x6C,0xF7,0xFF,0x6C,0xF6,0xFF,0x43,0x92,0xFF,0x64,0x54,0xFF,0x6C,0x94,0xFF,0x3B,0x31,0xFF,0x4B,0x71,0xFF,0x43,0x71,0xFF,0x4B,0x71,0xFF,0x32,0xCF,0xFF,0x74,0xD5,0xFF,0x5B,0xF3,0xFF,0x43,0x31,0xFF,0x4B,0x71,0xFF,0x43,0x51,0xFF,0x4B,0x71,0xFF,0x23,0x11,0xFF,0x84,0xB4,0xFF,0xF7,0x3A,0xFF,0xE6,0x97,0xFF,0xB5,0x74,0xFF,0xC5,0x52,0xFF,0xCD,0x51,0xFF,0x6B,0xD1,0xFF,
-    0x33,0x10,0xFD,0x43,0x51,0xFF,0x4B,0x71,0xFE,0x74,0x12,0x18,0xAE,0x7B,0x49,0xA6,0x19,0x5A,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xA6,0x39,0x49,0xA6,0x19,0x52,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xA6,0x1A,0x21,0xAE,0x1A,0x26,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xA6,0x1A,0x87,0xAE,0x19,0x2A,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0xB6,0x3B,0x0D,0xA6,0x19,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xAE,0x3A,0x72,0xAE,0x19,0x4F,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xBD,0xFF,0x04,0x00,0x00,0x00,0xA6,0x19,0x4D,0xA6,0x19,0x64,0x00,0x00,0x00,
-    0x74,0xF6,0xE7,0x6C,0xD7,0xFF,0x5C,0x96,0xFB,0x6C,0x13,0xFF,0xD5,0xD4,0xFF,0xEE,0xB8,0xFF,0xEE,0xD8,0xFF,0xB5,0x95,0xFF,0x5C,0xD6,0xFF,0x6C,0xF6,0xFF,0x64,0xB5,0xFF,0x85,0x57,0xFF,0x53,0xB2,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x43,0x31,0xFF,0x53,0xB2,0xFF,0x74,0xD5,0xFF,0x3A,0xEF,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x53,0x92,0xFF,0x12,0xF1,0xFF,0x94,0xF5,0xFF,0xDE,0x78,0xFF,0xBD,0x93,0xFF,0xCD,0x51,0xFF,0xCD,0x51,0xFF,0x6B,0xB0,0xFF,0x33,0x30,0xFF,0x43,0x71,0xFB,0x43,0x71,0xFF,0x53,0x91,0xE0,0xB6,0x7A,0x8E,0xB6,0x7C,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x3A,0x30,0x8D,0x58,0x09,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xA6,0x1A,0x41,0xAD,0xF9,0x10,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x1A,0x61,0xAE,0x19,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3A,0x30,0xA6,0x19,0x86,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xFF,0x04,0x00,0x00,0x00,0xA5,0xF9,0x6B,0xAE,0x19,0x4F,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0xB6,0x79,0x0A,0xA6,0x19,0x9B,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xA6,0x19,0x90,0xFF,0xFF,0x07,0x74,0xF6,0xB4,0x6C,0xF7,0xFF,0x6C,0xD6,0xFA,0x4B,0xD3,0xFF,0xC5,0x94,0xFF,0xE6,0x77,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xE6,0x97,0xFF,0x9D,0x55,0xFF,0x54,0xB6,0xFF,0x85,0x98,0xFF,0x85,0x37,0xFF,0x32,0xF0,0xFF,0x4B,0x91,0xFF,0x43,0x71,0xFF,0x4B,0x71,0xFF,0x32,0xF0,0xFF,0x6C,0x94,0xFF,0x64,0x33,0xFF,0x32,0xAE,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x53,0x92,0xFF,0x22,0xF0,0xFF,0x8D,0x15,0xFF,0xA5,0x13,0xFF,0xA4,0x90,0xFF,0xA4,0xB1,0xFF,0x53,0x91,0xFF,
-    0x3B,0x51,0xFF,0x4B,0x71,0xFF,0x3B,0x10,0xF9,0x5B,0xF3,0xFF,0x95,0x77,0xC0,0x00,0x00,0x00,0x02,0xAA,0x03,0x87,0xFF,0x02,0x00,0x00,0x00,0xAE,0x1A,0x21,0xAE,0x3A,0x74,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xAE,0x1A,0x22,0xAE,0x1A,0x69,0x00,0x00,0x00,0x95,0xB6,0x07,0x00,0x00,0x00,0xAE,0x3A,0x87,0xAE,0x5A,0x2E,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xB6,0x1A,0x11,0xA6,0x19,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x39,0x5B,0xA6,0x19,0x6C,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xAE,0x19,0x4D,0xB6,0x5A,0x5D,0x6C,0xD6,0x73,0x75,0x58,0xFF,
-    0x74,0xF7,0xF9,0x44,0x14,0xFF,0xA4,0xF3,0xFF,0xE6,0x56,0xFF,0xF7,0x1A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xDE,0x57,0xFF,0x84,0xF5,0xFF,0x8D,0xB9,0xFF,0x75,0x17,0xFF,0x53,0xF3,0xFF,0x3B,0x10,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x74,0xF6,0xFF,0x43,0x50,0xFF,0x3A,0xCF,0xFF,0x3A,0xCF,0xFF,0x43,0x30,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x4B,0x72,0xFF,0x4B,0x72,0xFF,0x53,0xB2,0xFF,0x7D,0x15,0xFF,0x12,0x8E,0xFF,0x02,0x6E,0xFF,0x0A,0xAF,0xFF,0x32,0xEF,0xFF,0x3B,0x0F,0xFF,0x3B,0x10,0xFF,0x2A,0xAF,0xFF,0x7C,0xF6,0xF9,0x64,0x54,0xFF,0x6C,0x54,0x83,0x00,0x00,0x00,0x74,0x75,0x09,0x00,0x00,0x00,0xA6,0x1A,0x7A,0xAE,0x3A,0x38,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x01,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x66,0xAE,0x1A,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x19,0x2A,0xA6,0x19,0x84,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x1A,0x6D,0xA6,0x19,0x50,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x19,0x9B,0xB6,0x5A,0x17,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x5A,0x80,0x95,0x98,0x75,0x6C,0xF7,0xFF,0x7D,0x17,0xFD,0x5C,0x95,0xFE,0x84,0x73,0xFF,0xDE,0x16,0xFF,0xEE,0xD9,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xCE,0x58,0xFF,0x7D,0x78,0xFF,0x6C,0xD6,0xFF,0x6C,0xD6,0xFF,0x43,0x51,0xFF,0x3A,0xCF,0xFF,0x3A,0xEF,0xFF,0x43,0x30,0xFF,0x4B,0x71,0xFF,0x32,0xAE,0xFF,0x43,0x10,0xFF,0x43,0x51,0xFF,0x3A,0xEF,0xFF,0x3A,0xEF,0xFF,0x3A,0xEF,0xFF,0x43,0x30,0xFF,0x32,0xCF,0xFF,0x5B,0xF2,0xFF,0x6C,0x53,0xFF,0x2A,0x8E,0xFF,0x43,0x30,0xFF,0x43,0x50,0xFF,0x3B,0x10,0xFF,
-    0x3B,0x30,0xFF,0x3B,0x30,0xFF,0x5B,0xF3,0xFF,0x85,0x16,0xFE,0x3B,0x31,0xFD,0x53,0xD3,0xFF,0x74,0xB5,0x5D,0x00,0x00,0x00,0x9D,0xD9,0x21,0xA6,0x1A,0x8E,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xB6,0x7C,0x0A,0xA6,0x39,0x85,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x76,0xA5,0xFA,0x2B,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x79,0x0F,0xA6,0x19,0x8F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x41,0xA6,0x19,0x84,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xB6,0x5A,0x3D,0xB6,0x5A,0xD5,0x74,0xF6,0xEE,0x75,0x17,0xFF,0x74,0xF6,0xFD,
-    0x5B,0xF3,0xFF,0xCD,0xF5,0xFF,0xE6,0xB8,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xD6,0xDA,0xFF,0xB5,0xD7,0xFF,0x64,0xB6,0xFF,0x6C,0xD6,0xFF,0x64,0xB5,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x72,0xFF,0x4B,0x72,0xFF,0x43,0x51,0xFF,0x43,0x30,0xFF,0x43,0x51,0xFF,0x43,0x30,0xFF,0x3B,0x30,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x3B,0x10,0xFF,0x74,0x94,0xFF,0x4B,0x50,0xFF,0x3B,0x31,0xFF,0x4B,0x71,0xFF,0x33,0x10,0xFF,0x74,0xD5,0xFF,0x64,0x34,0xFF,0x3B,0x30,0xFD,0x43,0x51,0xFF,0x4B,0x92,0xFF,0x5B,0x92,0x28,0xAE,0x7B,0x6A,0xA6,0x3A,0x4E,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA6,0x3A,0x4E,0xA6,0x19,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x5A,0x13,0xAE,0x3A,0x52,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA5,0xF9,0x60,0xA6,0x19,0x44,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x79,0x05,0xBD,0xF7,0x04,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x19,0x8F,0xAE,0x19,0x2F,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xB6,0x7A,0xB1,0x95,0xD9,0xFF,0x64,0x96,0xFE,0x7C,0xF7,0xFD,0x3B,0xB3,0xFF,0xB5,0x34,0xFF,0xE6,0x98,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xE7,0x3B,0xFF,0xD6,0xFB,0xFF,0xF7,0x19,0xFF,0x9D,0x55,0xFF,0x5C,0xB6,0xFF,0x6C,0xD6,0xFF,0x5C,0x75,0xFF,0x4B,0x92,0xFF,0x43,0x71,0xFF,0x4B,0x72,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x43,0x72,0xFF,0x43,0x30,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x3B,0x30,0xFF,0x5B,0xF2,0xFF,0x74,0xB5,0xFF,0x33,0x10,0xFF,0x43,0x30,0xFF,
-    0x3B,0x31,0xFF,0x4B,0x92,0xFF,0x7C,0xF6,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFC,0x43,0x31,0xFF,0x4B,0x71,0xF4,0xAE,0x5A,0xAD,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xA6,0x19,0x88,0xA6,0x19,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0xA6,0x19,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0xF9,0x50,0x9E,0x79,0x05,0x00,0x00,0x00,0xA6,0x1A,0x26,0xA6,0x19,0x92,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xCF,0x1C,0x3E,0x95,0xD9,0xFF,0x5C,0x55,0xFC,0x74,0xF7,0xFE,0x43,0xF4,0xFF,0x94,0x51,0xFF,
-    0xD6,0x57,0xFF,0xE6,0xFA,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xD6,0xDA,0xFF,0xEF,0x3B,0xFF,0xF7,0x5B,0xFF,0xE6,0xB8,0xFF,0x85,0x16,0xFF,0x5C,0x96,0xFF,0x7D,0x58,0xFF,0x74,0xD6,0xFF,0x3B,0x31,0xFF,0x4B,0x72,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x6C,0xB5,0xFF,0x4B,0x91,0xFF,0x3B,0x10,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x4B,0x71,0xFF,0x33,0x10,0xFF,0x74,0xD5,0xFF,0x5B,0xF3,0xFF,0x3B,0x30,0xFF,0x43,0x71,0xFF,0x32,0xCF,0xFF,0x6C,0x75,0xFF,0x6C,0x75,0xFF,0x3B,0x31,0xFF,0x4B,0x71,0xFF,0x4B,0x71,0xFF,0x32,0xCF,0xFB,0x64,0x54,0xFF,0x6C,0x74,0xED,0x94,0xF5,0x15,0x00,0x00,0x00,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xAE,0x3A,0x2C,0xA6,0x19,0x80,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x19,0x3B,0xA6,0x19,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x77,0xA6,0x3A,0x47,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xAE,0x3A,0xC4,0x6C,0xD7,0xFF,0x64,0xB6,0xFC,0x54,0x55,0xFF,0x63,0x70,0xFF,0xD5,0xF6,0xFF,0xD6,0xBA,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x7B,0xFF,0xEF,0x3B,0xFF,0xD6,0xDB,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xD6,0x57,0xFF,0x6C,0xB5,0xFF,0x8D,0x98,0xFF,0x75,0x37,0xFF,0x54,0x13,0xFF,0x43,0x51,0xFF,0x4B,0x92,0xFF,0x43,0x51,0xFF,0x64,0x34,0xFF,0x7D,0x16,0xFF,0x3B,0x10,0xFF,0x43,0x71,0xFF,0x3A,0xEF,0xFF,0x43,0x50,0xFF,0x43,0x51,0xFF,0x53,0xD2,0xFF,0x85,0x16,0xFF,0x3B,0x10,0xFF,0x43,0x71,0xFF,0x4B,0x92,0xFF,
-    0x3B,0x10,0xFF,0x4B,0x71,0xFF,0x43,0x30,0xFF,0x43,0x10,0xFF,0x43,0x30,0xFF,0x3A,0xEF,0xFF,0x43,0x30,0xFF,0x7C,0xD5,0xFA,0x3B,0x31,0xFF,0x5B,0xF3,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x39,0x75,0xA6,0x19,0x3E,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x89,0xA6,0x19,0x22,0x00,0x00,0x00,0xA5,0xB9,0x0E,0xA6,0x19,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x5A,0x06,0x00,0x00,0x00,0xB6,0x9B,0x60,0x8D,0xB9,0xFF,0x5C,0x76,0xFB,0x64,0x96,0xFF,0x33,0x10,0xFF,0xC5,0x73,0xFF,0xCE,0x58,0xFF,
-    0xEF,0x1A,0xFF,0xF7,0x5B,0xFF,0xF7,0x1A,0xFF,0xF6,0xD7,0xFF,0xF6,0x75,0xFF,0xEE,0x33,0xFF,0xFE,0x75,0xFF,0xD6,0x78,0xFF,0xDE,0x77,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x1A,0xFF,0xBE,0x17,0xFF,0x75,0x58,0xFF,0x74,0xF7,0xFF,0x6C,0xF7,0xFF,0x4B,0x92,0xFF,0x43,0x51,0xFF,0x3B,0x10,0xFF,0x7D,0x36,0xFF,0x5B,0xF2,0xFF,0x3B,0x10,0xFF,0x43,0x30,0xFF,0x3A,0xCE,0xFF,0x3A,0xEF,0xFF,0x22,0x8E,0xFF,0x7C,0xF5,0xFF,0x6C,0x54,0xFF,0x33,0x10,0xFF,0x43,0x71,0xFF,0x3B,0x30,0xFF,0x3A,0xEF,0xFF,0x3A,0xEF,0xFF,0x3A,0xCF,0xFF,0x3A,0xEF,0xFF,0x3A,0xEF,0xFF,0x2A,0x6E,0xFF,0x74,0x74,0xFF,0x64,0x13,0xFF,0x3B,0x31,0xFA,0x53,0xD3,0xFF,0x64,0x13,0x94,0x00,0x00,0x00,0x02,0x10,0x04,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0x9E,0x3B,0x0D,0xA6,0x19,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xAE,0x5A,0x2E,0xAE,0x1A,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xF9,0x57,0xA6,0x39,0x5A,0x00,0x00,0x00,0xAF,0xFF,0x03,0x84,0x17,0x04,0x00,0x00,0x00,0x9D,0x77,0x1C,0x8D,0x98,0xF3,0x74,0xF7,0xFF,0x6C,0xD6,0xFD,0x23,0x51,0xFF,0xA4,0xD1,0xFF,0xD6,0x37,0xFF,0xCE,0x9A,0xFF,0xF7,0x5A,0xFF,0xF7,0x19,0xFF,0xF6,0x53,0xFF,0xCC,0xEE,0xFF,0xAC,0x2C,0xFF,0xDD,0x4E,0xFF,0x93,0xCC,0xFF,0xB5,0x74,0xFF,0xE5,0x4D,0xFF,0xE6,0x13,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xD6,0xDA,0xFF,0xA5,0xB7,0xFF,0x6C,0xD6,0xFF,0x75,0x17,0xFF,0x6C,0xD6,0xFF,0x32,0xCF,0xFF,0x53,0xB1,0xFF,0x7D,0x16,0xFF,0x2A,0x8E,0xFF,0x43,0x10,0xFF,0x3A,0xEF,0xFF,0x43,0x50,0xFF,0x3B,0x30,0xFF,0x4B,0x50,0xFF,0x85,0x16,0xFF,0x3A,0xEF,0xFF,0x3A,0xEF,0xFF,0x3A,0xEF,0xFF,0x3B,0x10,0xFF,
-    0x43,0x51,0xFF,0x4B,0x71,0xFF,0x3B,0x10,0xFF,0x43,0x30,0xFF,0x43,0x31,0xFF,0x4B,0x91,0xFF,0x7C,0xF6,0xFF,0x43,0x31,0xFF,0x4B,0x71,0xFF,0x43,0x71,0xFB,0x53,0xB3,0xFF,0x6C,0x34,0x65,0x00,0x00,0x00,0x63,0x33,0x05,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA6,0x19,0x54,0xA6,0x19,0x62,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x3B,0x1A,0xA6,0x3A,0x39,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x83,0xA6,0x19,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xF9,0x56,0x9D,0xF9,0x10,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xFF,0xFF,0x04,0x7C,0xF6,0xD2,0x85,0x78,0xFF,0x6C,0xD7,0xFB,0x43,0xD3,0xFF,0x84,0x31,0xFF,0xDE,0x35,0xFF,0xC6,0x59,0xFF,0xE7,0x1A,0xFF,
-    0xF7,0x3A,0xFF,0xF6,0x53,0xFF,0xB4,0x6C,0xFF,0x00,0xE9,0xFF,0x73,0x2C,0xFF,0xD5,0x4F,0xFF,0x64,0x33,0xFF,0x43,0x0E,0xFF,0x9B,0xAB,0xFF,0xED,0x6E,0xFF,0xEE,0x34,0xFF,0xF7,0x5B,0xFF,0xEF,0x3B,0xFF,0xCE,0xBB,0xFF,0xEE,0xF9,0xFF,0x95,0x56,0xFF,0x64,0xD7,0xFF,0x75,0x17,0xFF,0x54,0x34,0xFF,0x7D,0x16,0xFF,0x64,0x34,0xFF,0x3B,0x10,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x4B,0x71,0xFF,0x33,0x10,0xFF,0x74,0xD5,0xFF,0x6C,0x74,0xFF,0x3B,0x31,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x30,0xFF,0x3A,0xEF,0xFF,0x32,0xCF,0xFF,0x74,0x95,0xFF,0x64,0x34,0xFF,0x3B,0x31,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFD,0x43,0x71,0xFF,0x4B,0xB2,0xFF,0x6C,0x73,0x3A,0x00,0x00,0x00,0x6C,0x92,0x07,0x00,0x00,0x00,0xA5,0xF9,0x8B,0xAD,0xF9,0x18,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x6B,0xA6,0x3A,0x3F,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xB6,0x7B,0x14,0xA6,0x19,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xB5,0xB3,0x85,0x58,0xFF,0x7D,0x17,0xFA,0x54,0x54,0xFF,0x63,0xB1,0xFF,0xDE,0x15,0xFF,0xD6,0x78,0xFF,0xCE,0xBA,0xFF,0xF7,0x5A,0xFF,0xF6,0xD7,0xFF,0xC4,0xED,0xFF,0x00,0xE8,0xFF,0x21,0xE9,0xFF,0x7B,0x2B,0xFF,0xDD,0x92,0xFF,0x64,0x12,0xFF,0x31,0x87,0xFF,0x01,0x08,0xFF,0xC4,0xEE,0xFF,0xED,0x8F,0xFF,0xF6,0xF9,0xFF,0xDE,0xFB,0xFF,0xDE,0xDA,0xFF,0xFF,0x7B,0xFF,0xDE,0x78,0xFF,0x74,0xF6,0xFF,0x64,0xD6,0xFF,0x7D,0x58,0xFF,0x85,0x57,0xFF,0x32,0xF0,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x4B,0x92,0xFF,0x85,0x36,0xFF,0x3B,0x10,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,
-    0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x3B,0x10,0xFF,0x4B,0x70,0xFF,0x7C,0xF6,0xFF,0x43,0x51,0xFF,0x43,0x72,0xFF,0x43,0x72,0xFF,0x43,0x71,0xFF,0x43,0x72,0xFC,0x3B,0x30,0xFF,0x43,0x2F,0xEE,0x9D,0xD9,0x1A,0x00,0x00,0x00,0xA6,0x19,0x31,0xA5,0xF9,0x7B,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0xB6,0xDB,0x07,0xA6,0x3A,0x90,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x3A,0x63,0xA6,0x19,0x5E,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x87,0xFF,0x02,0x00,0x00,0x00,0xCE,0xFC,0x27,0x85,0x37,0x94,0x74,0xF7,0xFF,0x7D,0x37,0xFA,0x64,0x95,0xFF,0x43,0x50,0xFF,0xCD,0x94,0xFF,0xEE,0xB8,0xFF,0xCE,0xBB,0xFF,0xEF,0x1B,0xFF,0xF7,0x5B,0xFF,
-    0xF6,0x74,0xFF,0x93,0xAB,0xFF,0x29,0xC9,0xFF,0x39,0xE9,0xFF,0x83,0x4B,0xFF,0xDD,0x50,0xFF,0x42,0x08,0xFF,0x52,0x69,0xFF,0x31,0xC9,0xFF,0x93,0xCC,0xFF,0xED,0xAF,0xFF,0xE6,0x97,0xFF,0xCE,0xDB,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xC5,0xF6,0xFF,0x54,0x96,0xFF,0x85,0x98,0xFF,0x75,0x37,0xFF,0x43,0x71,0xFF,0x43,0x30,0xFF,0x43,0x71,0xFF,0x4B,0x71,0xFF,0x33,0x10,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x32,0xF0,0xFF,0x43,0x10,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x31,0xFF,0x53,0xB2,0xFF,0x53,0x91,0xFF,0x3A,0xF0,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x3B,0x30,0xFF,0x3B,0x0F,0xFF,0x3A,0xCE,0xFA,0x43,0x51,0xFF,0x5B,0xF3,0xD1,0x00,0x00,0x00,0xA6,0x19,0x6E,0xA6,0x39,0x35,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xA6,0x3A,0x48,0xA6,0x3A,0x71,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x8D,0xB6,0x3B,0x0D,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xCF,0x7D,0x0F,0xAE,0x3A,0xD5,0x6C,0xD6,0xFF,0x7D,0x16,0xFE,0x7D,0x17,0xFE,0x13,0x10,0xFF,0xAD,0x12,0xFF,0xE6,0x56,0xFF,0xDE,0xFA,0xFF,0xD6,0xFB,0xFF,0xFF,0x7B,0xFF,0xF7,0x5B,0xFF,0xEE,0x33,0xFF,0xDD,0x4E,0xFF,0xD5,0x2E,0xFF,0xD5,0x2E,0xFF,0xDD,0x4F,0xFF,0xE5,0x8F,0xFF,0xD5,0x2E,0xFF,0xDD,0x2E,0xFF,0xDD,0x4E,0xFF,0xDD,0x6F,0xFF,0xED,0xD0,0xFF,0xCE,0x16,0xFF,0xD6,0xDB,0xFF,0xFF,0x5A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x19,0xFF,0xAD,0xB7,0xFF,0x75,0x78,0xFF,0x6C,0xD6,0xFF,0x64,0xB6,0xFF,0x43,0x0F,0xFF,0x3B,0x10,0xFF,0x43,0x30,0xFF,0x43,0x71,0xFF,0x85,0x57,0xFF,0x4B,0x91,0xFF,0x3B,0x10,0xFF,0x3A,0xEF,0xFF,0x3A,0xCF,0xFF,0x3A,0xEF,0xFF,0x43,0x30,0xFF,
-    0x43,0x30,0xFF,0x43,0x30,0xFF,0x43,0x30,0xFF,0x32,0xAE,0xFF,0x32,0xAE,0xFF,0x3B,0x30,0xFF,0x3B,0x30,0xFF,0x43,0x30,0xFF,0x3B,0x10,0xFF,0x3B,0x0F,0xFF,0x3B,0x30,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFA,0x43,0x72,0xFF,0x74,0x74,0xB8,0xB6,0x9B,0x6D,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA6,0x19,0x88,0xAE,0x39,0x2D,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA5,0xF9,0x2C,0xA6,0x19,0x54,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xD9,0x05,0x00,0x00,0x00,0xA5,0xF9,0x6A,0x8D,0x99,0xFF,0x6C,0xB6,0xFA,0x7D,0x37,0xFF,0x3B,0xD3,0xFF,0x8C,0x51,0xFF,0xDD,0xF4,0xFF,0xEE,0xD8,0xFF,0xCE,0xBB,0xFF,0xEF,0x3B,0xFF,0xF7,0x5B,0xFF,0xF7,0x7C,0xFF,
-    0xF6,0x95,0xFF,0xA4,0x2C,0xFF,0x49,0xA6,0xFF,0x94,0x91,0xFF,0x9C,0x90,0xFF,0xDD,0x2D,0xFF,0x6A,0xEB,0xFF,0x62,0xCA,0xFF,0x52,0x8A,0xFF,0xA4,0x0D,0xFF,0xED,0xF1,0xFF,0xC6,0x18,0xFF,0xEF,0x1B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xCE,0x9A,0xFF,0x85,0x57,0xFF,0x64,0xD6,0xFF,0x75,0x17,0xFF,0x64,0x75,0xFF,0x43,0x10,0xFF,0x2A,0x8E,0xFF,0x64,0x33,0xFF,0x74,0x94,0xFF,0x2A,0x8E,0xFF,0x43,0x30,0xFF,0x43,0x51,0xFF,0x43,0x30,0xFF,0x3A,0xCF,0xFF,0x3A,0xEF,0xFF,0x3A,0xEF,0xFF,0x3A,0xEF,0xFF,0x2A,0x6E,0xFF,0x5B,0xD1,0xFF,0x4B,0x71,0xFF,0x43,0x51,0xFF,0x43,0x30,0xFF,0x3B,0x30,0xFF,0x43,0x71,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x3B,0x10,0xF8,0x7C,0xD6,0xFF,0xAE,0x5A,0x63,0x00,0x00,0x00,0x9C,0xD9,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x5A,0x18,0xA6,0x3A,0x92,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0xFB,0x08,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x78,0xD2,0x6C,0xD6,0xFF,0x7D,0x17,0xF9,0x54,0x54,0xFC,0x63,0xB1,0xFD,0xD5,0xF4,0xFF,0xE6,0x97,0xFF,0xDE,0xFA,0xFF,0xCE,0xBA,0xFF,0xFF,0x5A,0xFF,0xF7,0x3A,0xFF,0xF7,0x7B,0xFF,0xFF,0x18,0xFF,0xCD,0x2E,0xFF,0x0A,0x4B,0xFF,0x7C,0xD5,0xFF,0x62,0x89,0xFF,0xDD,0x4E,0xFF,0x4A,0x49,0xFF,0x29,0xE9,0xFF,0x00,0xA8,0xFF,0xCD,0x2F,0xFF,0xE5,0xF3,0xFF,0xC6,0x79,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xE6,0xFA,0xFF,0xCE,0x9A,0xFF,0xE6,0xD9,0xFF,0x74,0xF6,0xFF,0x6C,0xD6,0xFF,0x75,0x17,0xFF,0x5C,0x33,0xFF,0x43,0x30,0xFF,0x5C,0x13,0xFF,0x53,0xB2,0xFF,0x4B,0x71,0xFF,0x4B,0x71,0xFF,0x4B,0x51,0xFF,0x4B,0x51,0xFF,0x43,0x30,0xFF,0x43,0x51,0xFF,
-    0x4B,0x92,0xFF,0x3B,0x31,0xFF,0x64,0x33,0xFF,0x8D,0x56,0xFF,0x3B,0x30,0xFF,0x43,0x71,0xFF,0x43,0x71,0xFF,0x43,0x30,0xFF,0x3B,0x10,0xFF,0x43,0x51,0xFF,0x43,0x51,0xFF,0x43,0x71,0xFF,0x43,0x72,0xFE,0x43,0x71,0xF9,0x85,0x16,0xFF,0x5C,0x13,0xAF,0x00,0x00,0x00,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x5D,0xA6,0x19,0x5F,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xB6,0x7A,0x4C,0x9D,0xFA,0xFF,0x75,0x17,0xFF,0x6C,0xB6,0xFF,0x33,0x52,0xFF,0xC5,0xB5,0xFF,0xE6,0x77,0xFE,0xF7,0x5B,0xFF,0xCE,0x9A,0xFF,0xEF,0x3A,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,
-    0xF7,0x5B,0xFF,0xF6,0x74,0xFF,0xAD,0x75,0xFF,0x22,0xEE,0xFF,0x51,0xE6,0xFF,0xDD,0x6F,0xFF,0x42,0x29,0xFF,0x00,0xE8,0xFF,0xB4,0x8F,0xFF,0xF5,0xF1,0xFF,0xC5,0xD6,0xFF,0xDE,0xFA,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5A,0xFF,0xCE,0x99,0xFF,0xE7,0x1A,0xFF,0xF7,0x7B,0xFF,0xD6,0x78,0xFF,0x64,0xD6,0xFF,0x6C,0xF7,0xFF,0x6C,0xD6,0xFF,0x3A,0xEF,0xFF,0x2A,0xAE,0xFF,0x32,0xCF,0xFF,0x3A,0xEF,0xFF,0x32,0xCF,0xFF,0x32,0xCF,0xFF,0x32,0xCE,0xFF,0x32,0xCF,0xFF,0x32,0xAE,0xFF,0x32,0xCF,0xFF,0x22,0x8E,0xFF,0x8D,0x57,0xFF,0x53,0xB1,0xFF,0x22,0xAF,0xFF,0x32,0xEF,0xFF,0x32,0xEF,0xFF,0x32,0xCF,0xFF,0x2A,0x8E,0xFF,0x32,0xAE,0xFF,0x32,0xEF,0xFF,0x32,0xEF,0xFF,0x32,0xCF,0xFF,0x5B,0xF2,0xFF,0x74,0xF6,0xFF,0x32,0xAE,0x9A,0x00,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x19,0x8C,0xAE,0x19,0x19,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x1A,0x95,0xA6,0x19,0x55,0x74,0xF6,0xA8,0x6C,0x54,0xD2,0x6C,0x12,0xC0,0xD6,0x37,0xD4,0xF7,0x5B,0xFF,0xF7,0x5B,0xFE,0xEF,0x3A,0xFF,0xF7,0x5A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xE7,0x1A,0xFF,0xE6,0x34,0xFF,0xBC,0x8D,0xFF,0x93,0xCC,0xFF,0xDD,0x6F,0xFF,0x93,0xCD,0xFF,0xCD,0x30,0xFF,0xF6,0x11,0xFF,0xE5,0xF3,0xFF,0xE6,0xFA,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xE6,0xFA,0xFF,0xCE,0x99,0xFF,0xF7,0x5B,0xFF,0xEF,0x3B,0xFF,0xF7,0x5B,0xFF,0xC6,0x17,0xFF,0x74,0xF6,0xFF,0x63,0xF2,0xFF,0x4A,0xEE,0xFF,0x53,0x2F,0xFF,0x53,0x0E,0xFF,0x4B,0x0E,0xFF,0x4A,0xEE,0xFF,0x52,0xEE,0xFF,0x53,0x0E,0xFF,0x53,0x0E,0xFF,0x53,0x2E,0xFF,
-    0x4A,0xAD,0xFF,0x74,0x52,0xFF,0x85,0x15,0xFF,0x4A,0xAD,0xFF,0x53,0x2E,0xFF,0x53,0x0E,0xFF,0x53,0x0E,0xFF,0x4A,0xED,0xFF,0x4A,0xED,0xFF,0x4A,0xED,0xFF,0x4A,0xED,0xFF,0x53,0x2E,0xFF,0x42,0xEE,0xEC,0x64,0x53,0xE5,0x5B,0xF2,0xB4,0x00,0x07,0x11,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x1A,0x26,0xA6,0x19,0x7F,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x3E,0xA6,0x19,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xF7,0x7C,0x52,0xFF,0xBC,0xFF,0xF7,0x5B,0xFB,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xEF,0x1A,0xFF,0xF7,0x3A,0xFF,
-    0xF7,0x3A,0xFF,0xCE,0xBA,0xFF,0xEE,0xFA,0xFF,0xF6,0xB6,0xFF,0xEE,0x13,0xFF,0xED,0xD1,0xFF,0xEE,0x12,0xFF,0xEE,0x33,0xFF,0xE6,0x56,0xFF,0xEF,0x1A,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5A,0xFF,0xCE,0xB9,0xFF,0xE7,0x1A,0xFF,0xF7,0x3A,0xFF,0xEF,0x3A,0xFF,0xF7,0x5B,0xFF,0xE6,0x76,0xFF,0xC5,0x32,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x72,0xFF,0xC5,0x72,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x72,0xFF,0xC5,0x72,0xFF,0xCD,0x72,0xFF,0xC5,0x72,0xFF,0xB5,0xD7,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xC5,0x72,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFC,0xD5,0xD4,0xFF,0xC5,0xF5,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x5F,0xA6,0x19,0x3F,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,0xAE,0x3A,0x63,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA5,0xF9,0x88,0xA6,0x19,0x2E,0x00,0x00,0x00,0x64,0xD9,0x05,0xBD,0xF0,0x04,0x00,0x00,0x00,0xF7,0x3B,0x54,0xFF,0xBC,0xFF,0xF7,0x5B,0xFB,0xEE,0xD9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0x97,0xFF,0xF7,0x3A,0xFF,0xDE,0xFA,0xFF,0xD6,0xBA,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xEE,0xF9,0xFF,0xEE,0xF9,0xFF,0xEF,0x1A,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xE7,0x1A,0xFF,0xCE,0x9A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xDE,0x36,0xFF,0xC5,0x31,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x73,0xFF,0xCD,0x72,0xFF,
-    0xBD,0xB5,0xFF,0xBD,0xB4,0xFF,0xCD,0x71,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFE,0xCD,0x72,0xFF,0xCD,0x93,0xFF,0xD5,0xF5,0x2C,0x00,0x00,0x00,0x84,0x10,0x06,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0xA6,0x19,0x6D,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x1A,0x55,0xAE,0x3A,0x6B,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x39,0x20,0xA6,0x19,0x8F,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0x5B,0x4A,0xFF,0x9C,0xFF,0xF7,0x3B,0xFC,0xEF,0x19,0xFF,0xEE,0xF9,0xFF,0xEF,0x1A,0xFF,0xEE,0xF9,0xFF,0xF7,0x5B,0xFF,
-    0xC6,0x79,0xFF,0xEF,0x1A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5A,0xFF,0xCE,0xBA,0xFF,0xE6,0xFA,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xD6,0x15,0xFF,0xC5,0x31,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xC5,0x73,0xFF,0xC5,0x93,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xC5,0x73,0xFF,0xB5,0xD6,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xC5,0x93,0xFF,0xBD,0xB5,0xFD,0xCD,0x92,0xFF,0xCD,0x73,0xF0,0xBD,0x74,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x3B,0x0D,0xAE,0x3A,0x4A,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xB6,0x3B,0x0D,0xA6,0x1A,0x22,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3A,0x9D,0xBE,0x7B,0x10,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x6F,0xA6,0x19,0x4D,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xFD,0x55,0x03,0x00,0x00,0x00,0xEF,0x1B,0x35,0xEE,0xD8,0xFF,0xEE,0xB8,0xFE,0xEE,0xB8,0xFE,0xEE,0xD9,0xFF,0xF7,0x7B,0xFF,0xFF,0x9C,0xFF,0xDE,0xFA,0xFF,0xD6,0xBA,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xEF,0x1A,0xFF,0xCE,0xBA,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xD5,0xF5,0xFF,0xC5,0x31,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xB5,0xD6,0xFF,0xC5,0x73,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xBD,0xB5,0xFF,
-    0xC5,0x94,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFF,0xB5,0xD6,0xFF,0xC5,0x94,0xFD,0xD5,0x93,0xFF,0xCD,0x93,0xDE,0xD6,0xB5,0x06,0x87,0xFF,0x02,0x00,0x00,0x00,0xAE,0x3A,0x62,0xB6,0x5A,0x3D,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x1A,0x4D,0xA6,0x5A,0x17,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x1A,0x51,0xAE,0x3A,0x75,0x00,0x00,0x00,0xBD,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0xBA,0x06,0xA6,0x19,0x94,0xCE,0x79,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xAD,0x55,0x03,0x00,0x00,0x00,0xF7,0x5B,0x24,0xEE,0xF9,0xFB,0xEE,0xF9,0xFF,0xEE,0xF9,0xFE,0xEF,0x1A,0xFF,0xF7,0x5B,0xFF,0xF7,0x7B,0xFF,0xCE,0x9A,0xFF,
-    0xEF,0x3B,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x5A,0xFF,0xDE,0xDA,0xFF,0xE6,0xFA,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xD5,0xB4,0xFF,0xC5,0x31,0xFF,0xCD,0x51,0xFF,0xBD,0x94,0xFF,0xBD,0xB5,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xC5,0x73,0xFF,0xB5,0xD6,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xC5,0x94,0xFF,0xBD,0xD6,0xFF,0xCD,0x72,0xFC,0xD5,0xD4,0xFF,0xCD,0x93,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x7B,0x14,0xAE,0x3A,0x88,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xAE,0x3A,0x12,0xA6,0x19,0x7B,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x19,0x98,0xA6,0x5A,0x17,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xA6,0x19,0x4D,0xA6,0x19,0x6C,0x00,0x00,0x00,0xBD,0xF7,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x5B,0x1A,0xF7,0x5B,0xF7,0xF7,0x7B,0xFF,0xF7,0x5B,0xFE,0xF7,0x5B,0xFF,0xFF,0x7C,0xFF,0xE7,0x1B,0xFF,0xD6,0xBA,0xFF,0xFF,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xEF,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x1A,0xFF,0xCD,0x93,0xFF,0xC5,0x31,0xFF,0xCD,0x52,0xFF,0xB5,0xB6,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xB5,0xD6,0xFF,0xC5,0x94,0xFF,
-    0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xB5,0xD6,0xFF,0xC5,0x93,0xFF,0xCD,0x72,0xFB,0xDD,0xD4,0xFF,0xCD,0x94,0xAB,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x1A,0x66,0xAE,0x3A,0x3F,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x1A,0x57,0xA6,0x19,0x54,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xAE,0x3A,0x46,0xA6,0x39,0x74,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x89,0xAE,0x39,0x1F,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA5,0xF9,0x14,0xAD,0xFA,0x0C,0x00,0x00,0x00,0xF7,0x3B,0x15,0xF7,0x5B,0xF2,0xF7,0x5B,0xFF,0xF7,0x3B,0xFE,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xCE,0x9A,0xFF,0xEF,0x3B,0xFF,
-    0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xFF,0x7B,0xFF,0xFF,0x7B,0xFF,0xFF,0x7B,0xFF,0xF7,0x5B,0xFF,0xD6,0xDA,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xF7,0x1A,0xFF,0xEF,0x1A,0xFF,0xF7,0x1A,0xFF,0xF7,0x1A,0xFF,0xCD,0x93,0xFF,0xCD,0x31,0xFF,0xBD,0xB5,0xFF,0xBD,0x94,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xC5,0x73,0xFF,0xB5,0xB6,0xFF,0xCD,0x31,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xCD,0x51,0xFF,0xC5,0x94,0xFF,0xBD,0xB5,0xFF,0xCD,0x52,0xFF,0xCD,0x72,0xFA,0xDD,0xD4,0xFF,0xCD,0xB4,0x81,0x00,0x00,0x00,0xAD,0xF7,0x10,0xA5,0xF9,0x5C,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x39,0x8B,0xAE,0x19,0x15,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x19,0x89,0xA6,0x5A,0x17,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x19,0x2D,0xA6,0x3A,0x7D,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x1A,0x5E,0xB6,0x79,0x0A,0x00,0x00,0x00,0xD6,0xBA,0x06,0xF7,0x3B,0xDB,0xFF,0x9C,0xFF,0xF7,0x3B,0xFD,0xF7,0x5B,0xFF,0xDE,0xFA,0xFF,0xCE,0xBA,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xFF,0x7C,0xFF,0xE6,0xFA,0xFF,0xC6,0x38,0xFF,0xAD,0xB7,0xFF,0xAD,0x97,0xFF,0xB6,0x18,0xFF,0xBE,0x59,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xEE,0xD9,0xFF,0xE6,0x56,0xFF,0xE6,0x77,0xFF,0xDE,0x77,0xFF,0xE6,0x56,0xFF,0xEE,0xD9,0xFF,0xF7,0x1A,0xFF,0xCD,0x52,0xFF,0xC5,0x52,0xFF,0xB5,0xB6,0xFF,0xCD,0x51,0xFF,0xCD,0x52,0xFF,0xCD,0x72,0xFF,0xE5,0x90,0xFF,0xED,0xB0,0xFF,0xED,0xAF,0xFF,0xCD,0xD5,0xFF,0xE5,0xD2,0xFF,0xED,0xB0,0xFF,
-    0xE5,0x90,0xFF,0xE5,0x90,0xFF,0xED,0xB0,0xFF,0xED,0xB0,0xFF,0xED,0xB1,0xFF,0xED,0xB1,0xFF,0xBD,0xD6,0xFF,0xCD,0x73,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFA,0xDD,0xD4,0xFF,0xCD,0x94,0x6C,0x00,0x00,0x00,0xB5,0x98,0x0D,0x9E,0x79,0x05,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0xA6,0x1A,0x2E,0xA6,0x19,0x80,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x39,0x38,0xA6,0x19,0x65,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x9E,0x19,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x1A,0x32,0xA6,0x3A,0x20,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x2D,0xA6,0x1A,0x63,0x00,0x00,0x00,0xCE,0x79,0x05,0x00,0x00,0x00,0xF7,0x5B,0xC9,0xF7,0x7C,0xFF,0xEF,0x1B,0xFC,0xFF,0x5B,0xFF,0xDE,0xDA,0xFF,0xEF,0x1A,0xFF,0xFF,0x7B,0xFF,
-    0xEF,0x3B,0xFF,0xA5,0xB8,0xFF,0x5C,0x96,0xFF,0x74,0xB5,0xFF,0x84,0xD4,0xFF,0x6C,0x53,0xFF,0x54,0xD6,0xFF,0x33,0xD2,0xFF,0x7C,0x94,0xFF,0xDE,0xBA,0xFF,0xFF,0x7B,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xF7,0x1A,0xFF,0xEE,0xB8,0xFF,0xE6,0xB8,0xFF,0xCE,0x79,0xFF,0xEE,0xD8,0xFF,0xEE,0xF9,0xFF,0xEF,0x1A,0xFF,0xCD,0x31,0xFF,0xB5,0x95,0xFF,0xC5,0x94,0xFF,0xCD,0x51,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xF5,0xAF,0xFF,0xB4,0x2A,0xFF,0x93,0xEE,0xFF,0x9C,0xD2,0xFF,0x9B,0xA9,0xFF,0xA3,0xEC,0xFF,0xED,0x6E,0xFF,0xBC,0x6C,0xFF,0xA3,0xEB,0xFF,0xAC,0x0C,0xFF,0xAB,0xEB,0xFF,0xB4,0xF2,0xFF,0xD5,0xD5,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFD,0xD5,0xB3,0xFF,0xCD,0xD5,0x47,0x00,0x00,0x00,0xFC,0x10,0x02,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x39,0x70,0xA6,0x19,0x3F,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA5,0xF9,0x68,0x9D,0xD8,0x12,0x00,0x00,0x00,0x07,0xFF,0x01,0xAD,0x55,0x03,0x00,0x00,0x00,0xA5,0xF9,0x37,0xA5,0xF9,0x50,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xAF,0xFF,0x03,0x00,0x00,0x00,0xAE,0x1A,0x73,0xA6,0x1A,0x2E,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0x5B,0xBF,0xD6,0xFB,0xFF,0xEF,0x1A,0xFC,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xE6,0xFA,0xFF,0x7C,0xF6,0xFF,0x7C,0xD6,0xFF,0xDE,0x36,0xFF,0xEE,0x34,0xFF,0xED,0xD1,0xFF,0xDD,0xD3,0xFF,0xD5,0xD4,0xFF,0xAD,0x34,0xFF,0x4C,0x54,0xFF,0x43,0xD2,0xFF,0xCE,0x79,0xFF,0xFF,0x7B,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xD6,0xDA,0xFF,0xE7,0x1B,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xEE,0xF9,0xFF,0xC5,0x73,0xFF,0xB5,0xB6,0xFF,0xCD,0x51,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xF5,0xAF,0xFF,0x8B,0x4A,0xFF,0x00,0xE8,0xFF,0x32,0x09,0xFF,0x00,0xA7,0xFF,0x21,0xA8,0xFF,
-    0xE5,0x4E,0xFF,0x72,0xE9,0xFF,0x00,0x07,0xFF,0x01,0x68,0xFF,0x00,0xA7,0xFF,0x8C,0xD4,0xFF,0xED,0xB0,0xFF,0xCD,0x71,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFE,0xCD,0x72,0xFF,0xCD,0x94,0x2F,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x79,0x05,0xAE,0x3B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x79,0x05,0xA6,0x39,0x86,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0xAE,0x3A,0x12,0xA5,0xF9,0x30,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA5,0xF9,0x78,0xA5,0xF9,0x14,0x00,0x00,0x00,0x00,0x1F,0x01,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0xB6,0x7B,0x14,0xAE,0x39,0x8B,0x00,0x00,0x00,0xFF,0xFF,0x01,0xBD,0xF7,0x04,0x00,0x00,0x00,0xCE,0x9A,0x93,0xE7,0x3C,0xFF,0xFF,0x5B,0xFB,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0x85,0x37,0xFF,
-    0x84,0xD5,0xFF,0xF6,0x96,0xFF,0xDD,0x70,0xFF,0xA3,0x48,0xFF,0xA2,0xE6,0xFF,0x9C,0x71,0xFF,0xCC,0x8D,0xFF,0xF5,0xF1,0xFF,0xCD,0xD5,0xFF,0x64,0xB5,0xFF,0x43,0x91,0xFF,0xDE,0xB9,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xEF,0x1A,0xFF,0xCE,0x9A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xEF,0x1A,0xFF,0xB5,0xD7,0xFF,0xC5,0x73,0xFF,0xCD,0x51,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xCD,0x51,0xFF,0xF5,0xAF,0xFF,0x93,0x8A,0xFF,0x01,0x48,0xFF,0x42,0x08,0xFF,0x31,0xC8,0xFF,0x5A,0x69,0xFF,0xED,0x4E,0xFF,0x7B,0x09,0xFF,0x21,0xC9,0xFF,0x41,0x86,0xFF,0x63,0xD0,0xFF,0x9C,0xB2,0xFF,0xED,0x6F,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFE,0xCD,0x72,0xFF,0xCD,0x72,0xF1,0xCE,0x17,0x19,0x00,0x00,0x00,0xAD,0x55,0x03,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x3F,0xAE,0x3A,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xF9,0x3C,0xA6,0x19,0x5B,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0xA6,0x39,0x30,0xA6,0x19,0x75,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x1A,0x61,0xAE,0x39,0x5A,0x00,0x00,0x00,0x85,0xF7,0x04,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x39,0xA6,0xFF,0x9C,0xFF,0xF7,0x5B,0xFB,0xF7,0x3B,0xFF,0xFF,0x7B,0xFF,0xC6,0x59,0xFF,0x44,0x76,0xFF,0xDE,0x35,0xFF,0xDD,0x2F,0xFF,0x81,0xE3,0xFF,0x9A,0xA4,0xFF,0xA3,0xED,0xFF,0xA4,0x71,0xFF,0xA2,0x83,0xFF,0xAB,0xCB,0xFF,0xF6,0x12,0xFF,0xBD,0x95,0xFF,0x23,0xD3,0xFF,0x84,0x93,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xD6,0xBA,0xFF,0xDE,0xFA,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xE7,0x1B,0xFF,0xBD,0xB6,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFF,0xCD,0x51,0xFF,0xF5,0xAF,0xFF,0x93,0x6A,0xFF,0x01,0x88,0xFF,0x4A,0x29,0xFF,0x29,0xC8,0xFF,0x62,0x89,0xFF,
-    0xED,0x6E,0xFF,0x7B,0x0A,0xFF,0x29,0xA8,0xFF,0x4A,0x49,0xFF,0x7C,0xB4,0xFF,0x8B,0x8B,0xFF,0xED,0xB0,0xFF,0xCD,0x51,0xFF,0xCD,0x52,0xFD,0xD5,0x92,0xFF,0xCD,0x72,0xDE,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xAE,0x3A,0x7A,0xAE,0x3A,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x19,0x3E,0xA6,0x3A,0x16,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xA6,0x19,0x7D,0xAE,0x39,0x30,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3A,0x96,0xB6,0x1A,0x11,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x85,0xB9,0x2E,0xD6,0xFB,0xFF,0xFF,0x5B,0xFE,0xF7,0x3B,0xFE,0xF7,0x3B,0xFF,0xF7,0x5C,0xFF,0x85,0x78,0xFF,0x9D,0x56,0xFF,
-    0xEE,0x13,0xFF,0x9A,0xE7,0xFF,0x92,0xC7,0xFF,0x9A,0xC5,0xFF,0xA4,0xB2,0xFF,0xAB,0xCC,0xFF,0xB3,0x68,0xFF,0x9A,0x86,0xFF,0xD4,0xEE,0xFF,0xED,0xF2,0xFF,0x74,0xB5,0xFF,0x33,0x0F,0xFF,0xDE,0xB9,0xFF,0xF7,0x5B,0xFF,0xCE,0x9A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xCE,0x79,0xFF,0xC5,0x52,0xFF,0xCD,0x71,0xFF,0xCD,0x52,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xF5,0x8F,0xFF,0x7B,0x09,0xFF,0x00,0x07,0xFF,0x01,0x27,0xFF,0x00,0x07,0xFF,0x4A,0x08,0xFF,0xED,0x6E,0xFF,0x5A,0x89,0xFF,0x00,0x03,0xFF,0x5B,0xF1,0xFF,0x3B,0x91,0xFF,0x7A,0xC7,0xFF,0xED,0xD1,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFC,0xD5,0xB3,0xFF,0xCD,0x73,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x9A,0x11,0xAE,0x5A,0x13,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x2E,0xAE,0x3A,0x77,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0x5A,0x1C,0xA6,0x19,0x8E,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x40,0xAE,0x39,0x7F,0x00,0x00,0x00,0x85,0xF7,0x04,0xAF,0xFF,0x03,0x00,0x00,0x00,0x9E,0x1A,0x9B,0xE7,0x1B,0xF0,0xF7,0x5B,0xFF,0xF7,0x3B,0xFE,0xF7,0x5B,0xFF,0xEF,0x3B,0xFF,0x5C,0xF7,0xFF,0xBD,0x96,0xFF,0xDD,0x70,0xFF,0x92,0x66,0xFF,0x92,0xA5,0xFF,0x93,0x6C,0xFF,0xA4,0xB2,0xFF,0xA2,0xE5,0xFF,0xAB,0x69,0xFF,0x9A,0xE7,0xFF,0xBB,0xEA,0xFF,0xED,0xD0,0xFF,0x8D,0x15,0xFF,0x01,0xEE,0xFF,0xC5,0xF7,0xFF,0xDF,0x1B,0xFF,0xDE,0xDA,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x5A,0xFF,0xE7,0x3B,0xFF,0xCE,0x78,0xFF,0xCD,0x51,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xED,0x8E,0xFF,0xCC,0xAC,0xFF,0xBC,0x2B,0xFF,0xBC,0x2B,0xFF,0xB4,0x2B,0xFF,0xBC,0x4B,0xFF,
-    0xED,0x6E,0xFF,0xC4,0x8D,0xFF,0xB4,0x2C,0xFF,0xBD,0x75,0xFF,0xBC,0xAE,0xFF,0xD5,0x0E,0xFF,0xED,0xB0,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFB,0xD5,0xD3,0xFF,0xCD,0x93,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3A,0x69,0xAE,0x5A,0x13,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xA6,0x19,0x76,0xAE,0x3A,0x39,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x19,0x6F,0xA6,0x39,0x4E,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x8A,0xAE,0x3A,0x32,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xAE,0x5A,0x3C,0x95,0xFA,0x88,0xFF,0x7B,0x70,0xFF,0xDD,0xFF,0xF7,0x5B,0xFA,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xDE,0xFB,0xFF,0xEE,0x76,0xFF,
-    0xD5,0x0E,0xFF,0x92,0x87,0xFF,0x92,0x63,0xFF,0x94,0x51,0xFF,0xA3,0xED,0xFF,0x9A,0xC5,0xFF,0xAB,0x48,0xFF,0x9A,0xC7,0xFF,0xB3,0xAA,0xFF,0xED,0x90,0xFF,0xBD,0x12,0xFF,0xAD,0x75,0xFF,0xDE,0x98,0xFF,0xCE,0xBA,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xD6,0xDB,0xFF,0xE6,0xD9,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xED,0xAF,0xFF,0xCC,0xCD,0xFF,0xBC,0x4C,0xFF,0xBC,0x6C,0xFF,0xBC,0x4C,0xFF,0xC4,0x8C,0xFF,0xED,0x6E,0xFF,0xBC,0x4B,0xFF,0xBD,0x12,0xFF,0xAC,0xD1,0xFF,0xB4,0x2B,0xFF,0xCC,0xEE,0xFF,0xED,0xB0,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFB,0xD5,0xD3,0xFF,0xCD,0xB4,0x98,0x00,0x00,0x00,0xA5,0xF9,0x40,0xAE,0x3A,0x61,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xAE,0x79,0x0F,0xA6,0x19,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0xBE,0xFB,0x08,0xA6,0x19,0x97,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xB6,0x5A,0x1D,0xAE,0x39,0x96,0x00,0x00,0x00,0x84,0x10,0x02,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x19,0x98,0x4D,0x38,0x20,0xFF,0x5B,0x63,0xFF,0xDD,0xFF,0xF7,0x3B,0xFA,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xFF,0x7C,0xFF,0xF6,0xD6,0xFF,0xD4,0xCD,0xFF,0x92,0x85,0xFF,0x9B,0x4A,0xFF,0x9C,0x91,0xFF,0xA3,0x07,0xFF,0x9B,0x08,0xFF,0xA3,0x28,0xFF,0x92,0xC7,0xFF,0xB3,0x89,0xFF,0xE5,0x8F,0xFF,0xDD,0x2E,0xFF,0xFF,0x5A,0xFF,0xDE,0xFB,0xFF,0xD6,0xBA,0xFF,0xF7,0x5A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xEE,0xD9,0xFF,0xC5,0x31,0xFF,0xCD,0x52,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xF5,0xCF,0xFF,0x7B,0x2A,0xFF,0x00,0x06,0xFF,0x01,0x27,0xFF,0x00,0x06,0xFF,0x62,0x88,0xFF,
-    0xE5,0x2D,0xFF,0x29,0xC8,0xFF,0x3B,0xD2,0xFF,0x01,0x27,0xFF,0x00,0x06,0xFF,0x83,0x6A,0xFF,0xED,0xB0,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFB,0xDD,0xD3,0xFF,0xCD,0xB4,0x6E,0x00,0x00,0x00,0xAE,0x39,0x85,0xAE,0x3A,0x12,0x00,0x00,0x00,0x9C,0xD9,0x05,0x00,0x00,0x00,0xA6,0x1A,0x56,0xA6,0x19,0x60,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0xAE,0x39,0x53,0xA6,0x39,0x67,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xAE,0x3A,0x6D,0xAE,0x3A,0x56,0x00,0x00,0x00,0x9E,0x79,0x05,0x00,0x00,0x00,0xAE,0x5B,0x1C,0xA6,0x19,0x74,0x00,0x00,0x00,0xF7,0x3B,0x55,0xFF,0x9C,0xFF,0xF7,0x3A,0xFC,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xEF,0x3A,0xFF,0xF6,0x96,0xFF,
-    0xD4,0xCD,0xFF,0x92,0x22,0xFF,0xA4,0x70,0xFF,0xA3,0xEE,0xFF,0xA2,0xE6,0xFF,0x9B,0x08,0xFF,0xA3,0x28,0xFF,0x92,0xA7,0xFF,0xAB,0x89,0xFF,0xE5,0x6F,0xFF,0xDD,0x2F,0xFF,0xEF,0x19,0xFF,0xD6,0xDA,0xFF,0xE6,0xF9,0xFF,0xEE,0xF9,0xFF,0xF7,0x1A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xE6,0xB8,0xFF,0xC5,0x31,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xBD,0xB5,0xFF,0xCD,0x92,0xFF,0xF5,0xCF,0xFF,0x8B,0x6A,0xFF,0x11,0x67,0xFF,0x4A,0x28,0xFF,0x11,0x67,0xFF,0x83,0x2A,0xFF,0xE4,0xEC,0xFF,0x6B,0xD0,0xFF,0x53,0x6F,0xFF,0x39,0x65,0xFF,0x01,0x88,0xFF,0x9B,0xCB,0xFF,0xED,0xB0,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFB,0xDD,0xF4,0xFF,0xD5,0x93,0x49,0x9E,0x7C,0x2D,0xAE,0x39,0x69,0x00,0x00,0x00,0x85,0xF7,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x19,0x88,0xA6,0x3A,0x16,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x19,0x89,0xAE,0x5A,0x13,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0xAE,0x3A,0x9A,0xB6,0x7C,0x0A,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xB6,0xDB,0x07,0xFF,0xFF,0x05,0x00,0x00,0x00,0xF7,0x5B,0x43,0xFF,0x9C,0xFF,0xF7,0x3A,0xFD,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF6,0xB6,0xFF,0xD4,0xCC,0xFF,0x93,0x2A,0xFF,0xA4,0xD2,0xFF,0xAB,0x28,0xFF,0xA3,0x28,0xFF,0x9A,0xE7,0xFF,0xA3,0x28,0xFF,0x92,0xA6,0xFF,0xAB,0x69,0xFF,0xDD,0x6F,0xFF,0xDD,0x50,0xFF,0xF7,0x1A,0xFF,0xF7,0x3A,0xFF,0xEE,0xB8,0xFF,0xEE,0xD9,0xFF,0xEE,0xF9,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xE6,0x97,0xFF,0xC5,0x31,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xC5,0x94,0xFF,0xBD,0xB6,0xFF,0xD5,0x71,0xFF,0xF5,0xD0,0xFF,0x8B,0x6A,0xFF,0x11,0x67,0xFF,0x4A,0x28,0xFF,0x11,0x67,0xFF,0x8B,0x49,0xFF,
-    0xE5,0x2E,0xFF,0x6C,0x32,0xFF,0x39,0xC7,0xFF,0x42,0x29,0xFF,0x01,0x48,0xFF,0x9B,0xEB,0xFF,0xED,0xB0,0xFF,0xC5,0x72,0xFF,0xCD,0x72,0xFD,0xD5,0xB3,0xFF,0xCD,0xF5,0x39,0xA6,0x5A,0x74,0xB6,0x79,0x14,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x39,0x2B,0xA5,0xF9,0x74,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xAE,0x7B,0x0F,0xA6,0x39,0x30,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x5F,0x03,0x00,0x00,0x00,0xA6,0x19,0x4B,0xAE,0x39,0x76,0x00,0x00,0x00,0xBD,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x3A,0x3D,0xFF,0x9C,0xFF,0xF7,0x3A,0xFD,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xEF,0x3A,0xFF,0xF6,0xB7,0xFF,
-    0xD4,0xEC,0xFF,0x9C,0x0F,0xFF,0xA4,0x2F,0xFF,0xA2,0xE6,0xFF,0xA3,0x49,0xFF,0x9A,0xE7,0xFF,0x92,0xE8,0xFF,0x6A,0x47,0xFF,0xAB,0x69,0xFF,0xE5,0x6F,0xFF,0xDD,0x70,0xFF,0xF7,0x3B,0xFF,0xF7,0x5B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xE6,0x97,0xFF,0xC5,0x31,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xB5,0xB6,0xFF,0xC5,0x73,0xFF,0xD5,0x51,0xFF,0xF5,0xD0,0xFF,0x7B,0x29,0xFF,0x00,0x06,0xFF,0x11,0x88,0xFF,0x00,0x07,0xFF,0x83,0x08,0xFF,0xDD,0x93,0xFF,0x02,0xAD,0xFF,0x00,0x04,0xFF,0x01,0x68,0xFF,0x00,0x06,0xFF,0x9B,0xCB,0xFF,0xED,0xB1,0xFF,0xC5,0x72,0xFE,0xCD,0x92,0xFF,0xCD,0x92,0xE9,0xBE,0x39,0x69,0xAE,0x5B,0x5B,0x00,0x00,0x00,0xBD,0xF7,0x04,0xAD,0x55,0x03,0x00,0x00,0x00,0x9E,0x19,0x5D,0x9D,0xF9,0x2C,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xAE,0x3A,0x91,0xAE,0x1A,0x26,0x00,0x00,0x00,0x85,0xF7,0x04,0x85,0xF7,0x04,0x85,0xF7,0x04,0x85,0xF7,0x04,0xB5,0xB6,0x07,0x00,0x00,0x00,0xEF,0x5B,0x2E,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFE,0xDE,0xDA,0xFF,0xEF,0x3B,0xFF,0xF6,0xD8,0xFF,0xDD,0x2E,0xFF,0xAB,0x49,0xFF,0xA3,0x48,0xFF,0xA3,0x28,0xFF,0xA3,0x48,0xFF,0x9A,0xE7,0xFF,0x7A,0xA8,0xFF,0x4A,0x07,0xFF,0xAB,0x69,0xFF,0xE5,0x70,0xFF,0xDD,0x70,0xFF,0xEF,0x1A,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xDE,0x56,0xFF,0xC5,0x31,0xFF,0xCD,0x51,0xFF,0xBD,0x94,0xFF,0xB5,0xB5,0xFF,0xCD,0x51,0xFF,0xCD,0x71,0xFF,0xF5,0xAF,0xFF,0xB4,0x2C,0xFF,0x93,0x8A,0xFF,0x9B,0xCB,0xFF,0x93,0x8A,0xFF,0xBC,0x8D,0xFF,
-    0xCD,0x92,0xFF,0x93,0x69,0xFF,0x9B,0xAA,0xFF,0x9B,0xAA,0xFF,0x93,0xAA,0xFF,0xCC,0xAD,0xFF,0xE5,0xB0,0xFF,0xC5,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0xB4,0xFD,0xB6,0x7A,0xB3,0x64,0xF7,0x08,0x52,0xAA,0x03,0x9C,0xD3,0x05,0x84,0x17,0x04,0xFF,0xFF,0x01,0x9E,0x39,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x9C,0xD9,0x05,0x00,0x00,0x00,0xAE,0x3A,0x2D,0xAE,0x19,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x0B,0xF7,0x3A,0xEB,0xFF,0x5A,0xFF,0xE6,0xFA,0xFD,0xD6,0xBA,0xFF,0xF7,0x5B,0xFF,0xF6,0xF9,0xFF,
-    0xDD,0x4F,0xFF,0xAB,0x28,0xFF,0xA3,0x28,0xFF,0xA3,0x28,0xFF,0xA3,0x28,0xFF,0x9A,0xE7,0xFF,0xA3,0x28,0xFF,0x92,0xA7,0xFF,0xAB,0xAA,0xFF,0xE5,0x90,0xFF,0xDD,0x70,0xFF,0xF7,0x1A,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xDE,0x36,0xFF,0xC5,0x31,0xFF,0xCD,0x72,0xFF,0xB5,0xD6,0xFF,0xC5,0x73,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xE5,0x90,0xFF,0xED,0xB0,0xFF,0xED,0xD1,0xFF,0xED,0xB1,0xFF,0xED,0xB0,0xFF,0xDD,0xD3,0xFF,0xDD,0xB2,0xFF,0xED,0x6E,0xFF,0xED,0x6F,0xFF,0xED,0x90,0xFF,0xED,0xB0,0xFF,0xE5,0x90,0xFF,0xD5,0x70,0xFF,0xCD,0x72,0xFF,0xCD,0x71,0xFB,0xD6,0x37,0xFF,0xB6,0xBC,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x64,0xD3,0x05,0x84,0x17,0x04,0xAD,0x55,0x03,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x85,0xF7,0x04,0x84,0x17,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x7B,0x8C,0xBE,0xBC,0x41,0x00,0x00,0x00,0xB6,0x5A,0x1D,0x9D,0xB8,0x2D,0xA5,0xD8,0x52,0x8D,0x77,0x6E,0x8D,0x57,0x94,0x85,0x36,0xB0,0x7C,0xF6,0xBC,0x8D,0x56,0xC5,0xEF,0x1A,0xF9,0xF7,0x3A,0xFF,0xCE,0xBA,0xFF,0xEF,0x3B,0xFF,0xF7,0x5B,0xFF,0xF7,0x19,0xFF,0xDD,0x6F,0xFF,0xA3,0x08,0xFF,0x9B,0x08,0xFF,0x9B,0x08,0xFF,0xA3,0x28,0xFF,0x9A,0xE7,0xFF,0xAB,0x28,0xFF,0x92,0xC7,0xFF,0xB3,0xA9,0xFF,0xDD,0xD2,0xFF,0xDD,0x71,0xFF,0xF7,0x1A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xD6,0x15,0xFF,0xC5,0x10,0xFF,0xBD,0xB4,0xFF,0xB5,0xB5,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xCD,0x52,0xFF,0xC5,0x52,0xFF,0xBD,0x73,0xFF,
-    0xCD,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xC5,0x52,0xFF,0xCD,0x51,0xFF,0xCD,0x51,0xFF,0xCD,0x71,0xFF,0xB5,0xB6,0xFF,0x85,0x37,0xCE,0x85,0x16,0xAF,0x8D,0x56,0x8A,0x85,0x36,0x69,0x8D,0x77,0x48,0x95,0x98,0x25,0xB6,0x7C,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x64,0xD3,0x05,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x85,0xF7,0x04,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x8D,0x57,0x21,0xA5,0xF9,0x68,0xA6,0x19,0xF6,0x8D,0x57,0xD5,0x85,0x16,0xD9,0x7C,0xF6,0xF3,0x7D,0x16,0xFF,0x95,0xD9,0xFF,0x7D,0x37,0xFF,0x7D,0x37,0xFF,0x85,0x37,0xFF,0x7D,0x37,0xFF,0x7D,0x37,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xCE,0xBA,0xFF,0xF7,0x7B,0xFF,0xF7,0x5B,0xFF,0xF7,0x19,0xFF,
-    0xDD,0x70,0xFF,0x9A,0xE8,0xFF,0x9A,0xE8,0xFF,0x9B,0x08,0xFF,0xA3,0x28,0xFF,0x9A,0xC7,0xFF,0xAB,0x28,0xFF,0x9A,0xC6,0xFF,0xAB,0xCC,0xFF,0xD6,0x15,0xFF,0xDD,0x70,0xFF,0xEF,0x1A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xD5,0xF4,0xFF,0xC5,0x31,0xFF,0xB5,0xD6,0xFF,0xC5,0x73,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xCD,0x93,0xFF,0x9D,0xB7,0xFF,0x85,0x37,0xFF,0x85,0x57,0xFF,0x7D,0x37,0xFF,0x8D,0x78,0xFF,0x85,0x37,0xFF,0x7C,0xF6,0xFE,0x7C,0xF6,0xE2,0x85,0x16,0xBD,0x85,0x16,0x8B,0x8D,0x37,0x57,0xA5,0xF9,0x38,0xC6,0xDC,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x97,0x14,0x8D,0x36,0x54,0x85,0x16,0x9D,0x7C,0xF6,0xDA,0x7C,0xD5,0xFD,0x85,0x57,0xFF,0x85,0x17,0xFF,0x74,0xD6,0xFF,0x7D,0x16,0xFF,0x74,0xB5,0xFF,0x85,0x37,0xFE,0x8D,0x77,0xFC,0x7D,0x36,0xFB,0x85,0x57,0xFB,0x85,0x36,0xFB,0x7D,0x16,0xFC,0x6C,0xF6,0xFC,0xE6,0xFA,0xFF,0xD6,0xDA,0xFF,0xE7,0x1A,0xFF,0xF7,0x5B,0xFF,0xEF,0x3B,0xFF,0xF7,0x1A,0xFF,0xDD,0x6F,0xFF,0x9A,0xE7,0xFF,0x92,0xC7,0xFF,0x9B,0x08,0xFF,0xA3,0x28,0xFF,0x9A,0xE7,0xFF,0xAB,0x48,0xFF,0x9A,0xA4,0xFF,0xAC,0xF2,0xFF,0xE6,0x13,0xFF,0xDD,0x4F,0xFF,0xEF,0x19,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x5B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xD5,0xD4,0xFF,0xBD,0x74,0xFF,0xBD,0xB6,0xFF,0xCD,0x51,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x52,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,
-    0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x51,0xFF,0xCD,0x52,0xFF,0xCD,0x51,0xFF,0xC5,0xB5,0xFF,0x95,0x77,0xFF,0x8D,0x77,0xFD,0x95,0x98,0xFB,0x8D,0x77,0xFB,0x8D,0x98,0xFB,0x85,0x36,0xFD,0x74,0xB5,0xFF,0x7C,0xF6,0xFF,0x7D,0x17,0xFF,0x85,0x37,0xFF,0x7D,0x17,0xFF,0x85,0x36,0xFF,0x9D,0xF9,0xFF,0x85,0x36,0xB7,0x8D,0x56,0x56,0xB6,0x5B,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x38,0x0D,0x85,0x16,0x5B,0x7C,0xF6,0xB0,0x7C,0xD6,0xF0,0x85,0x37,0xFF,0x85,0x37,0xFF,0x7C,0xF6,0xFF,0x74,0xD6,0xFF,0x74,0xD5,0xFB,0x74,0xD5,0xFE,0x7C,0xD6,0xFD,0x74,0xD5,0xFD,0x7C,0xF6,0xFE,0x9D,0xF9,0xFF,0x8D,0x77,0xFF,0x85,0x37,0xFF,0x85,0x37,0xFF,0x8D,0x77,0xFF,0x85,0x77,0xFF,0x7D,0x37,0xFF,0xCE,0x9A,0xFF,0xD6,0xDA,0xFF,0xF7,0x5B,0xFF,0xF7,0x3A,0xFF,0xEF,0x3B,0xFF,0xEE,0xF9,0xFF,
-    0xE5,0x90,0xFF,0x9A,0xE6,0xFF,0x93,0xEF,0xFF,0x9B,0x6A,0xFF,0xA3,0x28,0xFF,0x9B,0x08,0xFF,0xAB,0x06,0xFF,0x9B,0xCD,0xFF,0xAD,0x33,0xFF,0xE5,0xB0,0xFF,0xD5,0x50,0xFF,0xEE,0xF9,0xFF,0xF7,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x3A,0xFF,0xF7,0x3A,0xFF,0xF7,0x3B,0xFF,0xF7,0x3A,0xFF,0xF7,0x3A,0xFF,0xCD,0xD4,0xFF,0xB5,0xB6,0xFF,0xC5,0x93,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x71,0xFF,0xCD,0x51,0xFF,0xCD,0x51,0xFF,0xCD,0x51,0xFF,0xB5,0x53,0xFF,0x74,0xB4,0xFF,0x6C,0x95,0xFF,0x74,0x95,0xFF,0x85,0x37,0xFF,0x8D,0x98,0xFF,0x95,0xB8,0xFF,0x95,0x98,0xFE,0x74,0xD5,0xFD,0x74,0xD5,0xFC,0x7C,0xF6,0xFA,0x74,0xB5,0xFB,0x8D,0x77,0xFE,0x7C,0xF6,0xFD,0x74,0xF6,0xFF,0x7D,0x37,0xFF,0x7C,0xF6,0xEA,0x85,0x36,0x80,0xAE,0xBA,0x06,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x36,0x76,0x7C,0xF6,0xEA,0x7D,0x37,0xFF,0x7D,0x17,0xFF,0x7C,0xF6,0xFF,0x7C,0xD6,0xFB,0x7C,0xD5,0xFB,0x7C,0xD5,0xFD,0x7C,0xD5,0xFE,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xB5,0xFF,0x9D,0xF9,0xFF,0x8D,0x98,0xFF,0x6C,0x94,0xFF,0x7C,0xF6,0xFF,0x8D,0x97,0xFF,0x7C,0xF6,0xFF,0x74,0xD5,0xFF,0x6C,0x95,0xFF,0x9D,0xD8,0xFF,0xD6,0xDA,0xFF,0xE6,0xFA,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xF7,0x19,0xFF,0xED,0xB0,0xFF,0xA3,0xAC,0xFF,0x94,0x71,0xFF,0xA2,0xC3,0xFF,0xAB,0x27,0xFF,0x92,0xC6,0xFF,0xA2,0xC5,0xFF,0x9C,0xD3,0xFF,0xAC,0x0C,0xFF,0xED,0xAF,0xFF,0xDD,0x70,0xFF,0xF7,0x3A,0xFF,0xFF,0x5A,0xFF,0xF7,0x5A,0xFF,0xFF,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5B,0xFF,0xFF,0x5B,0xFF,0xFF,0x5A,0xFF,0xC6,0x16,0xFF,0xC5,0xB5,0xFF,0xD5,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xCD,0x72,0xFF,0xC5,0x72,0xFF,0xC5,0x53,0xFF,0xBD,0x53,0xFF,
-    0xBD,0x74,0xFF,0xB5,0xB6,0xFF,0xB5,0x34,0xFF,0xAD,0x34,0xFF,0xA5,0x13,0xFF,0x9C,0xD3,0xFF,0x94,0xB3,0xFF,0x84,0xB4,0xFF,0x74,0x94,0xFF,0x6C,0x94,0xFF,0x6C,0x94,0xFF,0x64,0x54,0xFF,0x7D,0x36,0xFF,0x74,0xD5,0xFF,0x85,0x36,0xFF,0x9D,0xF9,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x85,0x36,0xFF,0x8D,0x98,0xFE,0x74,0xB5,0xFF,0x7C,0xD6,0xFB,0x7C,0xD5,0xFB,0x7C,0xF6,0xFF,0x85,0x37,0xFF,0x85,0x16,0xDC,0x9D,0x97,0x27,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xBE,0x7A,0x39,0x8D,0x57,0xBB,0x85,0x57,0xFF,0x7D,0x16,0xFF,0x7C,0xD6,0xFB,0x7C,0xD6,0xFB,0x74,0xD5,0xFE,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xB5,0xFF,0x95,0xD9,0xFF,0x7C,0xF5,0xFF,0x6C,0xB5,0xFF,0x74,0xD6,0xFF,0x8D,0x97,0xFF,0x85,0x37,0xFF,0x7D,0x16,0xFF,0x7D,0x16,0xFF,0x8D,0x77,0xFF,0x6C,0xB5,0xFF,0x74,0xB5,0xFF,0x84,0xF5,0xFF,0x8D,0x16,0xFF,0x9D,0x56,0xFF,
-    0xA5,0x13,0xFF,0x9D,0x35,0xFF,0x94,0xB3,0xFF,0x94,0x30,0xFF,0x94,0x30,0xFF,0x83,0xCE,0xFF,0x9C,0x92,0xFF,0x8D,0x15,0xFF,0x93,0xCD,0xFF,0xC5,0x31,0xFF,0xBD,0x32,0xFF,0xD6,0x99,0xFF,0xD6,0xB9,0xFF,0xD6,0xB9,0xFF,0xD6,0xB9,0xFF,0xD6,0x99,0xFF,0xD6,0x99,0xFF,0xD6,0x99,0xFF,0xD6,0x99,0xFF,0xB5,0xF8,0xFF,0xAD,0x54,0xFF,0xB5,0x33,0xFF,0xAD,0x13,0xFF,0xA5,0x13,0xFF,0xA4,0xF3,0xFF,0x9C,0xF3,0xFF,0x94,0xD3,0xFF,0x8C,0xD4,0xFF,0x84,0xB4,0xFF,0x7C,0x94,0xFF,0x74,0xB4,0xFF,0x6C,0x74,0xFF,0x85,0x37,0xFF,0x74,0xF6,0xFF,0x64,0x94,0xFF,0x6C,0xB5,0xFF,0x6C,0xB5,0xFF,0x6C,0xD5,0xFF,0x6C,0xD6,0xFF,0x74,0xF6,0xFF,0x74,0xF6,0xFF,0x7D,0x16,0xFF,0x85,0x36,0xFF,0x85,0x57,0xFF,0x8D,0x98,0xFF,0x85,0x57,0xFF,0x8D,0x77,0xFF,0x7C,0xF6,0xFF,0x74,0xB5,0xFF,0x85,0x36,0xFF,0x85,0x16,0xFF,0x8D,0x98,0xFF,0x85,0x16,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFD,0x7C,0xF6,0xF8,0x85,0x17,0xFF,0x85,0x16,0xE4,0xBE,0x9B,0x16,0x00,0x00,0x00,0xA5,0xDA,0x0B,0xBE,0x9A,0x0B,
-    0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x95,0x97,0x58,0x8D,0x78,0xFF,0x7C,0xF6,0xF5,0x7C,0xF5,0xFD,0x7C,0xD6,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x7D,0x16,0xFF,0x95,0xB8,0xFF,0x85,0x16,0xFF,0x7C,0xF6,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x7D,0x16,0xFF,0x85,0x37,0xFF,0x95,0xB8,0xFF,0x95,0x98,0xFF,0x7D,0x16,0xFF,0x85,0x36,0xFF,0x7D,0x16,0xFF,0x7D,0x16,0xFF,0x74,0xF6,0xFF,0x75,0x16,0xFF,0x95,0xD9,0xFF,0x8D,0x77,0xFF,0x8D,0x78,0xFF,0x7D,0x37,0xFF,0x75,0x16,0xFF,0x95,0xB8,0xFF,0x7C,0xF6,0xFF,0x74,0xD5,0xFF,0x64,0xB5,0xFF,0x6C,0xB5,0xFF,0x6C,0xB5,0xFF,0x6C,0xB5,0xFF,0x64,0x95,0xFF,0x64,0xB5,0xFF,0x64,0x95,0xFF,0x64,0x95,0xFF,0x64,0x74,0xFF,0x7D,0x16,0xFF,0x85,0x57,0xFF,0x6C,0x95,0xFF,0x6C,0xB5,0xFF,0x6C,0x95,0xFF,0x6C,0xB5,0xFF,0x6C,0xB5,0xFF,0x6C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xF5,0xFF,0x7C,0xF5,0xFF,0x7D,0x16,0xFF,0x85,0x16,0xFF,
-    0x95,0xD8,0xFF,0x8D,0x57,0xFF,0x95,0x97,0xFF,0x95,0x98,0xFF,0x95,0x98,0xFF,0x95,0x98,0xFF,0x95,0x98,0xFF,0x8D,0x77,0xFF,0x85,0x57,0xFF,0x85,0x16,0xFF,0x74,0xD5,0xFF,0x85,0x37,0xFF,0x7D,0x16,0xFF,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x85,0x36,0xFF,0x95,0x98,0xFF,0x95,0xB8,0xFF,0x8D,0x57,0xFF,0x8D,0x98,0xFF,0x74,0xB5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD6,0xF9,0x7C,0xF6,0xFF,0x7C,0xF6,0xF1,0xA5,0xF8,0x1B,0xF8,0x00,0x01,0xAD,0xF9,0x1C,0xBE,0x5A,0x22,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0xF6,0xC8,0x8D,0x78,0xFF,0x7C,0xF6,0xFB,0x7C,0xD6,0xFA,0x7C,0xD6,0xFE,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xF6,0xFF,0x85,0x16,0xFF,0x8D,0x77,0xFF,0x95,0x97,0xFF,0x95,0x77,0xFF,0x8D,0x57,0xFF,0x7D,0x16,0xFF,0x74,0xB5,0xFF,0x8D,0x57,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xF6,0xFF,0x85,0x36,0xFF,0x85,0x37,0xFF,
-    0x9D,0xD9,0xFF,0x9D,0xD9,0xFF,0x95,0x98,0xFF,0x9D,0xB8,0xFF,0x95,0xB8,0xFF,0x9D,0xD8,0xFF,0x95,0xB8,0xFF,0x85,0x77,0xFF,0x8D,0x78,0xFF,0x8D,0x78,0xFF,0x85,0x37,0xFF,0x7C,0xD5,0xFF,0x7C,0xF6,0xFF,0x8D,0x98,0xFF,0x8D,0x98,0xFF,0x8D,0x98,0xFF,0x8D,0x78,0xFF,0x8D,0x77,0xFF,0x9D,0xD9,0xFF,0x8D,0x36,0xFF,0x8D,0x77,0xFF,0x95,0x77,0xFF,0x95,0x97,0xFF,0x95,0x98,0xFF,0x95,0x97,0xFF,0x95,0x77,0xFF,0x8D,0x77,0xFF,0x8D,0x77,0xFF,0x8D,0x57,0xFF,0x85,0x36,0xFF,0x85,0x16,0xFF,0x8D,0x98,0xFF,0x85,0x57,0xFF,0x7C,0xD5,0xFF,0x7C,0xF5,0xFF,0x7C,0xF5,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFF,0x7D,0x16,0xFF,0x85,0x57,0xFF,0x85,0x57,0xFF,0x8D,0x57,0xFF,0x8D,0x57,0xFF,0x85,0x37,0xFF,0x85,0x16,0xFF,0x74,0x95,0xFF,0x8D,0x77,0xFF,0x85,0x36,0xFF,0x74,0xB5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFD,0x7C,0xD6,0xFA,0x7C,0xD5,0xFD,0x7D,0x17,0xFF,0x7C,0xF6,0xFF,0x7C,0xD6,0x4B,0x00,0x00,0x00,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x85,0x36,0x11,0x7C,0xF6,0xAB,0x85,0x16,0xFF,0x85,0x37,0xFF,0x7C,0xF6,0xFF,0x7C,0xD6,0xFB,0x7C,0xD5,0xFB,0x7C,0xD5,0xFD,0x7C,0xD6,0xFE,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x7D,0x16,0xFF,0x85,0x36,0xFF,0x85,0x16,0xFF,0x85,0x36,0xFF,0x85,0x16,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x6C,0x94,0xFF,0x74,0x95,0xFF,0x95,0x98,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFF,0x8D,0x77,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x85,0x57,0xFF,0x85,0x37,0xFF,0x6C,0x95,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x6C,0x95,0xFF,0x6C,0x94,0xFF,0x74,0xB5,0xFF,0x8D,0x98,0xFF,
-    0x7C,0xF5,0xFF,0x7D,0x16,0xFF,0x85,0x37,0xFF,0x8D,0x77,0xFF,0x95,0x98,0xFF,0x7D,0x16,0xFF,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xF6,0xFF,0x85,0x57,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x7C,0xF6,0xFF,0x8D,0x98,0xFE,0x74,0xB5,0xFC,0x7C,0xD5,0xFB,0x7C,0xD5,0xFC,0x7C,0xF6,0xFF,0x85,0x37,0xFF,0x7C,0xF6,0xFF,0x7C,0xD5,0xBC,0x7C,0xD6,0x2E,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0xF6,0x39,0x7C,0xD6,0xA2,0x7C,0xD6,0xEE,0x85,0x17,0xFF,0x85,0x37,0xFF,0x7C,0xF6,0xFF,0x7C,0xD6,0xFF,0x7C,0xD5,0xFB,0x7C,0xD5,0xFB,0x74,0xD5,0xFC,0x7C,0xD6,0xFD,0x7C,0xF6,0xFE,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x7C,0xF6,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x85,0x57,0xFF,0x8D,0x77,0xFF,0x74,0x94,0xFF,0x85,0x37,0xFF,
-    0x9D,0xD9,0xFF,0x8D,0x77,0xFF,0x8D,0x77,0xFF,0x85,0x37,0xFF,0x85,0x37,0xFF,0x85,0x16,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xD6,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD6,0xFF,0x74,0xD5,0xFF,0x8D,0x98,0xFF,0x7D,0x16,0xFF,0x85,0x16,0xFF,0x85,0x16,0xFF,0x85,0x16,0xFF,0x85,0x36,0xFF,0x8D,0x57,0xFF,0x85,0x16,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x85,0x57,0xFF,0x85,0x57,0xFF,0x8D,0x98,0xFF,0x8D,0x77,0xFF,0x85,0x36,0xFF,0x85,0x36,0xFF,0x85,0x16,0xFF,0x7C,0xD6,0xFF,0x8D,0x77,0xFF,0x85,0x16,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFE,0x74,0xD5,0xFD,0x7C,0xD5,0xFB,0x74,0xB5,0xFB,0x8D,0x57,0xFC,0x85,0x37,0xFF,0x7C,0xF6,0xFF,0x85,0x37,0xFF,0x85,0x16,0xFF,0x7C,0xD5,0xE6,0x7C,0xD5,0x9B,0x7C,0xF5,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x17,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xF5,0x12,0x7C,0xF6,0x53,0x7C,0xF5,0x9D,0x7C,0xF6,0xD8,0x7C,0xF6,0xFE,0x85,0x37,0xFF,0x85,0x57,0xFF,0x85,0x37,0xFF,0x7D,0x16,0xFF,0x7C,0xF6,0xFF,0x7C,0xD5,0xFD,0x7C,0xD5,0xFA,0x7C,0xD5,0xFB,0x7C,0xD6,0xFB,0x7C,0xD5,0xFC,0x7C,0xD5,0xFD,0x74,0xB5,0xFE,0x74,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x7C,0xD5,0xFF,0x74,0xB5,0xFF,0x95,0x98,0xFF,0x85,0x36,0xFF,0x85,0x36,0xFF,0x85,0x57,0xFF,0x85,0x57,0xFF,0x85,0x57,0xFF,0x85,0x57,0xFF,0x8D,0x57,0xFF,0x8D,0x77,0xFF,0x8D,0x78,0xFF,0x8D,0x78,0xFF,0x95,0x78,0xFF,0x8D,0x77,0xFF,0x85,0x37,0xFF,0x7C,0xF6,0xFF,0x8D,0x57,0xFF,0x8D,0x98,0xFF,0x8D,0x98,0xFF,0x95,0xD9,0xFF,0x8D,0x98,0xFF,0x8D,0x77,0xFF,0x8D,0x78,0xFF,0x8D,0x77,0xFF,0x8D,0x77,0xFF,0x8D,0x77,0xFF,0x7D,0x16,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x6C,0xB5,0xFF,0x85,0x57,0xFF,0x74,0xB5,0xFF,
-    0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0x95,0xFF,0x74,0xB5,0xFF,0x8D,0x77,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFE,0x74,0xD5,0xFD,0x74,0xD5,0xFC,0x74,0xD5,0xFB,0x74,0xD5,0xFB,0x74,0xB5,0xFB,0x74,0xD5,0xFE,0x74,0xD5,0xFF,0x7C,0xF6,0xFF,0x7D,0x16,0xFF,0x7D,0x17,0xFF,0x7D,0x16,0xFF,0x74,0xD5,0xF5,0x74,0xD5,0xCA,0x7C,0xD5,0x8C,0x84,0xF5,0x46,0x8D,0x14,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x03,0x84,0x17,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x85,0x16,0x27,0x7C,0xF6,0x59,0x7C,0xF6,0x8E,0x7C,0xF6,0xBE,0x7C,0xF6,0xE1,0x7C,0xF5,0xFD,0x7D,0x16,0xFF,0x85,0x37,0xFF,0x85,0x37,0xFF,0x85,0x37,0xFF,0x7D,0x16,0xFF,0x7C,0xD6,0xFF,0x85,0x37,0xFF,0x7D,0x16,0xFE,0x74,0xD5,0xFC,0x7C,0xD5,0xFB,0x7C,0xD5,0xFA,0x7C,0xD5,0xFC,0x85,0x36,0xFC,0x95,0x98,0xFA,
-    0x74,0xB5,0xFC,0x74,0xD5,0xFC,0x74,0xB5,0xFD,0x74,0xB5,0xFE,0x74,0xB5,0xFE,0x74,0xB5,0xFF,0x74,0xB5,0xFE,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xF5,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x7C,0xF6,0xFF,0x8D,0x98,0xFF,0x74,0xB5,0xFF,0x74,0xB5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x7C,0xF6,0xFF,0x85,0x16,0xFF,0x85,0x16,0xFE,0x74,0xD5,0xFE,0x6C,0xB5,0xFE,0x85,0x37,0xFC,0x7D,0x36,0xFC,0x74,0xB5,0xFC,0x74,0xD5,0xFC,0x74,0xD5,0xFC,0x74,0x95,0xFD,0x85,0x57,0xFA,0x85,0x36,0xFC,0x74,0xB5,0xFD,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7D,0x16,0xFF,0x7D,0x16,0xFF,0x7D,0x16,0xFF,0x7C,0xF6,0xFF,0x74,0xD5,0xF5,0x74,0xD5,0xD7,0x7C,0xD5,0xAE,0x7C,0xD5,0x7D,0x74,0xB5,0x48,0x84,0xF6,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x17,0x04,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x84,0x17,0x04,0x84,0x17,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xF7,0x08,0x85,0x16,0x24,0x7C,0xF6,0x47,0x7C,0xF5,0x6B,0x7C,0xF5,0x90,0x7C,0xF6,0xB1,0x7C,0xD6,0xCB,0x7C,0xD5,0xE6,0x8D,0x77,0xF0,0x7C,0xF6,0xFF,0x7D,0x16,0xFF,0x85,0x37,0xFF,0x85,0x57,0xFF,0x7C,0xF6,0xFF,0x9D,0xD9,0xFF,0x8D,0x78,0xFF,0x7C,0xF6,0xFF,0x7D,0x16,0xFF,0x7C,0xF6,0xFF,0x7C,0xD5,0xFF,0x74,0xD5,0xFF,0x74,0xD5,0xFD,0x7D,0x16,0xFF,0x74,0xD5,0xFD,0x7C,0xD5,0xFB,0x7C,0xD5,0xFB,0x7C,0xF6,0xFB,0x8D,0x77,0xFB,0x8D,0x77,0xFA,0x8D,0x57,0xFA,0x8D,0x77,0xFA,0x85,0x57,0xFC,0x8D,0x98,0xFC,0x95,0xB8,0xFB,0x8D,0x78,0xFB,0x8D,0x98,0xFA,0x8D,0x98,0xFA,0x8D,0x98,0xFA,0x8D,0x77,0xFA,0x8D,0x77,0xFA,0x8D,0x77,0xFC,0x8D,0x77,0xFB,0x8D,0x57,0xFE,0x74,0xD5,0xFF,0x74,0xD5,0xFF,0x95,0xD9,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,
-    0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x95,0xD9,0xFF,0x7C,0xF6,0xFF,0x7C,0xF6,0xFF,0x74,0xD5,0xF2,0x74,0xD5,0xE5,0x74,0xD5,0xC3,0x74,0xD5,0xAB,0x7C,0xD5,0x82,0x7C,0xD5,0x61,0x7C,0xF5,0x39,0x7C,0xB5,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x85,0xF7,0x04,0xAD,0x55,0x03,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x1F,0x02,0x85,0xF7,0x04,0x85,0xF7,0x04,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0xF9,0x14,0x95,0x98,0x1E,0x7C,0xD5,0x34,0x84,0xF5,0x42,0x84,0xF5,0x5D,0x7C,0xD5,0x79,0x8D,0x36,0xC9,0x9D,0xD8,0x92,0x74,0xB5,0x8B,
-    0x7C,0xD5,0xC6,0x7C,0xD5,0xD1,0x7C,0xD5,0xEC,0x74,0xD5,0xF8,0x74,0xB5,0xFF,0x85,0x57,0xFF,0x85,0x57,0xFF,0x7C,0xF6,0xFF,0x7D,0x37,0xFF,0x7D,0x17,0xFF,0x85,0x37,0xFF,0x7D,0x17,0xFF,0x7D,0x17,0xFF,0x7D,0x37,0xFF,0x7D,0x37,0xFF,0x7C,0xF6,0xFF,0x95,0xD9,0xFF,0x7D,0x37,0xFF,0x7D,0x16,0xFF,0x7D,0x17,0xFF,0x7D,0x37,0xFF,0x7D,0x17,0xFF,0x7D,0x16,0xFF,0x7C,0xF6,0xFF,0x74,0xF6,0xFF,0x7D,0x16,0xFF,0x7C,0xD5,0xFF,0x74,0xB5,0xF6,0x8D,0x77,0xF7,0x85,0x77,0xCF,0x6C,0x94,0xC6,0x74,0xB5,0xC5,0x74,0xB5,0xC4,0x74,0xB5,0xC3,0x8D,0x77,0xD8,0x8D,0x77,0x80,0x74,0xB5,0x4C,0x84,0xF5,0x38,0x7D,0x15,0x19,0x84,0xF3,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x03,0x85,0xF7,0x04,0x84,0x10,0x04,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x84,0x10,0x02,0x84,0x10,0x04,0x64,0xD3,0x05,0x84,0x17,0x04,0x52,0xB5,0x03,0x55,0x55,0x03,0x9E,0x3A,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x5D,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x36,0x11,0x74,0xF5,0x18,0x84,0xF6,0x40,0x95,0xF9,0x9B,0x84,0xF6,0x2A,0x7C,0xD5,0x47,0x74,0xD5,0x54,0x7C,0xD6,0x57,0x7C,0xF5,0x62,0x7C,0xF6,0x72,0x7C,0xF6,0x8A,0x7C,0xF6,0x9A,0x74,0xB5,0x94,0x8D,0x77,0xC4,0x95,0xB8,0x92,0x6C,0x74,0x61,0x7C,0xF5,0x79,0x7C,0xF5,0x87,0x7C,0xF5,0x97,0x7C,0xF5,0x99,0x7C,0xF6,0x9C,0x7C,0xF5,0x9D,0x95,0xB8,0xC4,0x8D,0x97,0x68,0x7C,0xD5,0x30,0x8D,0x77,0x28,0xA6,0x3A,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFF,0xFF,0x04,0xA6,0x5A,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x84,0x10,0x04,0x85,0xF7,0x04,0x64,0xD3,0x05,0x55,0x55,0x03,0x84,0x10,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x99,0x0A,0x9E,0x19,0x15,0x00,0x00,0x00,0x85,0xF7,0x04,0xAD,0x55,0x03,0x84,0x17,0x04,0x85,0x55,0x06,0x00,0x00,0x00,0x00,0x00,0x01,0x9C,0xD3,0x05,
-    0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x7B,0x29,0xA6,0x5A,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x7A,0x5F,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x7A,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x7A,0x29,0xA6,0x5A,0x2A,0x00,0x00,0x00,0xAD,0x5F,0x03,0x9C,0xD3,0x05,0x00,0x00,0x00,0x9E,0x39,0x45,0x9D,0xF9,0x28,0x00,0x00,0x00,0x85,0x55,0x06,0x55,0x55,0x03,0x84,0x10,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x9E,0x3A,0x5A,0xAD,0xFA,0x0C,0x00,0x00,0x00,0x85,0xF7,0x04,0x84,0x17,0x04,0x84,0x17,0x04,0x84,0x17,0x04,0x85,0xF7,0x04,0x95,0xB6,0x07,0x00,0x00,0x00,0xA6,0x39,0x34,0xA6,0x19,0x58,0x00,0x00,0x00,0x84,0xF7,0x08,0x84,0x17,0x04,0x64,0xD3,0x05,0x64,0xD3,0x05,0x95,0xB6,0x07,0x00,0x00,0x00,0x9E,0x3A,0x42,0x9E,0x39,0x28,0x00,0x00,0x00,0x84,0x17,0x04,0x95,0xF7,0x0C,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,
-    0xA6,0x9A,0x0B,0xA6,0x3A,0x57,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xA6,0x3A,0x24,0xA6,0x3A,0x44,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x3A,0x63,0xA6,0x9A,0x11,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x79,0x05,0xA6,0x3A,0x4F,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xA6,0x5A,0x45,0xA6,0x3A,0x2C,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x5A,0x41,0xA6,0x59,0x0E,0x00,0x00,0x00,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x9E,0x19,0x25,0xA6,0x5A,0x4A,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xA6,0x3A,0x31,0x9E,0x39,0x30,0x00,0x00,0x00,0x87,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x79,0x0A,
-    0xA6,0x5B,0x54,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x79,0x05,0xA6,0x9B,0x16,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xA6,0x7A,0x2E,0x9E,0x38,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xA6,0x3A,0x4C,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xAE,0x7B,0x2A,0xA6,0x3A,0x20,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0xAE,0x7B,0x0F,0xA6,0x39,0x24,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3C,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_home_rain_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_home_rain_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_home_rain_png_data
-};
-
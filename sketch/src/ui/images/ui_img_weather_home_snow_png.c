@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/home_snow.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_home_snow_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xFF,0xFF,0x01,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,
-    0xF7,0x9E,0x11,0xF7,0xDE,0x44,0xF7,0xBE,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xFA,0x06,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x9E,0x55,0xEF,0xBE,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x60,0xFF,0xFF,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC5,0xFF,0xFF,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xBE,0x2D,0xF7,0xFF,0x65,0xFF,0xDF,0x77,0xFF,0xDF,0x4A,0xFF,0xFF,0x05,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xEF,0x9E,0x6D,0xE7,0x7D,0x3E,0xEF,0x9D,0xA1,0xEF,0x9E,0x57,0xF7,0xFF,0x17,0xEF,0x5D,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0xAC,0xFF,0xFF,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xDF,0x43,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xE7,0x9D,0x42,0xFF,0xDF,0xB6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0x3A,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x9E,0x3E,0xE7,0x9E,0xB7,0xEF,0xBE,0xAA,0xEF,0xBE,0x7E,0xEF,0xBE,0xD9,0xEF,0x9E,0x27,0x00,0x00,0x00,
-    0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x83,0xFF,0xFF,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xDF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF7,0xDF,0x22,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0xBE,0x37,0xEF,0x9D,0xB4,0xF7,0xDF,0xF4,0xEF,0x9E,0xF2,0xD7,0x3C,0x5A,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x79,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xDD,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0x93,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xEF,0x9E,0x90,0xEF,0xBE,0x7F,0xEF,0xBE,0x8B,0xEF,0x9E,0x61,0xEF,0x9E,0xBA,0xEF,0x9E,0x3A,0x00,0x00,0x00,
-    0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xBD,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x3C,0x27,0xFF,0xDF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xC4,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xBE,0xC8,0xEF,0x9E,0x74,0x00,0x00,0x00,0xDE,0xDB,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x9E,0x7A,0xEF,0x9D,0x5F,0xEF,0x9D,0xB6,0xEF,0xBE,0x77,0xF7,0x9E,0x12,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x61,0xFF,0xFF,0xDC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xCF,0xFF,0x05,0xAF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xE7,0x7D,0x71,0xEF,0x7D,0xD2,0xEF,0x7D,0xCA,0xFF,0xFF,0xFF,0xEF,0x9E,0x71,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x6D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xEF,0x9D,0x6F,0xE7,0x7D,0xCB,0xF7,0xBE,0xEF,0xFF,0xFF,0xFF,0xDF,0x5C,0xDF,0xEF,0x9D,0x9B,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x9E,0x65,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFA,0xFF,0xFF,0xFC,0xFF,0xFF,0xFB,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0x37,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x9D,0x33,0xEF,0xBE,0x52,0xF7,0xBE,0xA9,0xF7,0xBE,0xFF,0xF7,0xBE,0x70,0xFF,0xFF,0x0F,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x2A,0xFF,0xFF,0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0xFF,0xFF,0x51,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xEF,0x9E,0x40,0xEF,0x9D,0x47,0xE7,0x7D,0xFB,0xEF,0x7D,0xF1,0xF7,0xDE,0x2A,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAF,0xFF,0x03,0xFF,0xFF,0xD9,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0xCE,0xFB,0x10,0xFF,0xFF,0x57,0xFF,0xFF,0x9E,0xFF,0xDF,0xB6,0xFF,0xFF,0xA4,0xFF,0xFF,0x70,0xF7,0x9E,0x14,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x16,0xF7,0xBE,0x71,0x9E,0x79,0x05,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xF7,0xBE,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xDF,0x46,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xF7,0xDF,0xBE,0xE7,0x9E,0x36,0xE7,0x5D,0x39,0xF7,0xDF,0x8B,0xFF,0xFF,0xF2,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0x69,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0xFF,0xFF,0x04,0xFF,0xFF,0x05,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x0B,0xFF,0xFF,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBE,0x1A,0xFF,0xDF,0x5C,0xFF,0xDF,0x82,0xFF,0xFF,0x67,0xF7,0xBE,0x20,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x02,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xDF,0xFF,0x07,0xEF,0x9D,0x25,0xF7,0xDF,0xC9,0xFF,0xFF,0xFF,0xFF,0xDF,0xEC,0xE7,0x7D,0x56,0xF7,0xBE,0x1C,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x0E,0xFF,0xFF,0x1D,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xDF,0x4C,0xFF,0xFF,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF5,0xFF,0xDF,0xD1,0xFF,0xFF,0x9A,0xFF,0xFF,0x2A,0x00,0x00,0x00,0xFF,0xFF,0x06,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xE7,0x7D,0x1B,0xEF,0x9E,0x9F,0xEF,0xBE,0x18,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xDF,0xD1,0xFF,0xFF,0xFF,0xEF,0xFF,0x0E,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x5D,0x0D,0xF7,0x9E,0x24,0xF7,0xBE,0x21,0xE7,0x1C,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xB6,0xDB,0x07,0xFF,0xFF,0xE1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0xE7,0x1C,0x09,
-    0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xE7,0x9E,0x15,0xEF,0x9E,0xC5,0xE7,0x7D,0x31,0xEF,0xBE,0xB3,0xEF,0x7D,0x30,0xF7,0xDF,0x2C,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xDF,0x81,0xFF,0xFF,0xA5,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,
-    0x00,0x00,0x00,0xE7,0x3C,0x0A,0xFF,0xFF,0x6E,0xFF,0xFF,0xC3,0xFF,0xFF,0xE7,0xFF,0xFF,0xFA,0xFF,0xFF,0xF8,0xFF,0xFF,0xE4,0xFF,0xFF,0xBE,0xFF,0xFF,0x72,0xF7,0xBE,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x03,0xAD,0x55,0x03,0xFF,0xFF,0x03,0x00,0x00,0x00,0xEF,0x5D,0x17,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xEF,0x7D,0x10,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xE7,0x9E,0x53,0xEF,0x9E,0xC0,0xF7,0xBE,0xBE,0xEF,0x9E,0xAF,0xEF,0xBE,0x92,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0xBE,0x3D,0xFF,0xFF,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0x95,0xEF,0xBE,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x47,0xE7,0x5D,0xED,0xCE,0xDB,0xFF,0xCE,0x9B,0xFE,0xCE,0x9B,0xFF,0xCE,0xBB,0xFF,0xE7,0x5D,0xFF,0xF7,0xDF,0xFE,0xFF,0xDF,0xFF,0xFF,0xDF,0xFD,0xFF,0xFF,0x63,0x00,0x00,0x00,
-    0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0xBE,0x2E,0xEF,0x9E,0x95,0xF7,0xBE,0xCA,0xFF,0xFF,0xFF,0xE7,0x7E,0x8D,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xF7,0xDE,0x36,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFC,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF6,0xF7,0xBE,0x9E,0xEF,0xBE,0x5F,0xF7,0xBE,0x37,0xFF,0xFF,0x29,0xF7,0x9E,0x16,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xD5,0x7A,0x6D,0x17,0xFF,0x54,0x75,0xF9,0x5C,0x95,0xFF,0x4C,0x13,0xFF,0x43,0x92,0xFF,0x6C,0x54,0xFE,0x7C,0xB5,0xFF,0xAD,0xF8,0x41,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xEF,0xBE,0x1D,0xFF,0xDF,0x8A,0xFF,0xFF,0x16,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x9E,0x2B,0xEF,0xBE,0x86,0xE7,0x7E,0x67,0xE7,0x7D,0x8B,0xEF,0x9E,0x8F,0xEF,0xBE,0x7E,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xCE,0x79,0x05,0xFF,0xFF,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xFF,0xFF,0xDC,0xFF,0xDF,0xC7,0xFF,0xFF,0x88,0xBE,0x9B,0xB9,0x8D,0xB9,0xFF,0x7D,0x37,0xFC,0x8D,0xB9,0xFF,0x7D,0x16,0xFF,0x4B,0xB2,0xFF,0x43,0xB2,0xFE,0x4B,0xD3,0xFF,0x02,0x90,0x26,0x00,0x00,0x00,0xD6,0xBA,0x06,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0xDE,0x5D,0xFF,0xFF,0xFF,0xF7,0xDF,0x65,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x9E,0x99,0xEF,0x9E,0xA6,0x00,0x00,0x00,0xEF,0x5D,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0xFF,0xFF,0x75,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xEF,0x9E,0xFF,0xBE,0x7A,0xFF,0xB6,0x5A,0xFF,0xCE,0xDB,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x7E,0xFF,0x54,0x75,0xFD,0x64,0x75,0xFF,0x7D,0x57,0xFF,0x7D,0x16,0xFF,0x4B,0x92,0xFF,0x53,0xD2,0xFE,0x53,0xD2,0xFF,0xDF,0x1C,0xD1,0xFF,0xFF,0x27,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x0D,0xF7,0xDF,0x5F,0xE7,0x9E,0x15,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xAF,0xFF,0x03,0xFF,0xFF,0x03,0xEF,0xFF,0x0F,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xE7,0x9E,0x11,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xAE,0xBA,0x06,0xFF,0xFF,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xE7,0x7D,0xFF,0x6C,0xD6,0xFF,0x54,0x96,0xFF,0x54,0x95,0xFF,0x54,0x75,0xFF,0x95,0x98,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFA,0xFF,0xFF,0xFD,0xB6,0x5A,0xFF,0x64,0xF6,0xFF,0x8D,0xB9,0xFF,0x75,0x16,0xFF,0x43,0x92,0xFF,0x53,0xD2,0xFF,0x3B,0x71,0xFD,0xF7,0xDF,0xFF,0xFF,0xFF,0xF8,0xF7,0xBE,0x37,
-    0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x1B,0xF7,0xBE,0x78,0xE7,0x5D,0x99,0xEF,0xBE,0x5A,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0xFF,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,
-    0xF7,0xBE,0xFF,0x75,0x16,0xFF,0x64,0xD6,0xFF,0x6C,0xB5,0xFF,0x8D,0x36,0xFF,0x75,0x17,0xFF,0x5C,0x96,0xFF,0xA5,0xD9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x5A,0xFF,0x85,0x98,0xFF,0x7C,0xF6,0xFF,0x43,0x91,0xFF,0x4B,0xB2,0xFF,0x4B,0xB2,0xFF,0xEF,0x7E,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0x26,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xEF,0x9E,0x8F,0xE7,0x9E,0xFF,0xEF,0x9D,0x73,0xEF,0xBE,0x70,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xDF,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x9D,0xD8,0xFF,0x5C,0xB6,0xFF,0x54,0x75,0xFF,0x9C,0xF4,0xFF,0xE6,0xDA,0xFF,0x85,0x37,0xFF,0x6C,0xF7,0xFF,0x54,0x95,0xFF,0xD6,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0x3A,0xFF,0x64,0xB5,0xFF,0x53,0xB2,0xFF,0x53,0xD2,0xFF,0x4B,0xB2,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xE0,0xD7,0x5D,0x0C,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xEF,0xBE,0x70,0xEF,0x9E,0xEA,0xF7,0xBE,0xFF,0xEF,0x9E,0xCF,0xE7,0x7D,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x06,0x00,0x00,0x00,0xEF,0xBE,0x6E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDF,0x3D,0xFF,
-    0x54,0x96,0xFF,0x64,0xD6,0xFF,0x63,0xF2,0xFF,0xDE,0x98,0xFF,0xEF,0x3B,0xFF,0xCE,0x58,0xFF,0x6C,0xF6,0xFF,0x5C,0xB6,0xFF,0x95,0x98,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x7D,0x16,0xFF,0x13,0x10,0xFF,0x3B,0x71,0xFF,0x3B,0x91,0xFF,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xB8,0x00,0x00,0x00,0xFF,0xFF,0x02,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x11,0xE7,0x7D,0xCD,0xE7,0x7D,0xD0,0xEF,0x9E,0x99,0xF7,0x9E,0x53,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0xF7,0xDF,0x46,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xAE,0x19,0xFF,0x5C,0xB6,0xFF,0x43,0x91,0xFF,0xC5,0xF6,0xFF,0xE6,0xFA,0xFF,0xF7,0x9D,0xFF,0xEF,0x3B,0xFF,0xB5,0xD7,0xFF,0x64,0xB6,0xFF,0x54,0x75,0xFF,0xDF,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9E,0xFF,0xDF,0x1C,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xDF,0x83,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0xF7,0xBE,0x33,0xF7,0xBE,0x36,0x00,0x00,0x00,0xEF,0xBE,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0xDE,0x38,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF7,0xBF,0xFF,0x85,0x57,0xFF,
-    0x33,0xB2,0xFF,0xA5,0x34,0xFF,0xDE,0xB9,0xFF,0xEF,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xE6,0xFA,0xFF,0x9D,0x56,0xFF,0x4C,0x75,0xFF,0x95,0x98,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xDF,0x4C,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xE7,0xFF,0x0A,0xF7,0xBE,0x59,0xE7,0x9E,0x14,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xF7,0xBE,0x1B,0xFF,0xFF,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xDF,0x3D,0xFF,0x3B,0xF3,0xFF,0x7C,0x52,0xFF,0xD6,0x78,0xFF,0xE7,0x1A,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xDE,0xB9,0xFF,0x85,0x16,0xFF,0x54,0x95,0xFF,0xB6,0x5A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xEF,0x7D,0x1E,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x54,0xFF,0xFF,0xFF,0xF7,0xDF,0x85,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xAD,0x55,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA5,0xD8,0xFF,0x23,0x10,0xFF,
-    0xCE,0x38,0xFF,0xE6,0xDA,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xCE,0x79,0xFF,0x6C,0xF6,0xFF,0x5C,0xB6,0xFF,0xA5,0xF9,0xFF,0xEF,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xDF,0xCD,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xF7,0xBE,0x19,0xFF,0xFF,0x9B,0xFF,0xDF,0x31,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x2B,0xFF,0xFF,0x61,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xEF,0x7D,0x38,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x3D,0xFF,0x02,0xF0,0xFF,0xB5,0x96,0xFF,0xDE,0xB9,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xB5,0xF8,0xFF,0x64,0xD6,0xFF,0x64,0xB6,0xFF,0x54,0x34,0xFF,0x9D,0x56,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xDF,0x9A,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0xEF,0x9E,0x40,0xF7,0xBE,0x1F,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xDF,0xC8,0xFF,0xFF,0xFF,0xFF,0xDF,0x2A,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0xF7,0xBE,0xA6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xEF,0x9E,0xFF,0x5C,0x13,0xFF,0x84,0x73,0xFF,0xDE,0x99,0xFF,
-    0xEF,0x3B,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9D,0xFF,0xEF,0x3B,0xFF,0x9D,0x77,0xFF,0x64,0xD6,0xFF,0x74,0xF6,0xFF,0x23,0x51,0xFF,0x63,0xF2,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xF7,0xBE,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x5D,0x23,0xFF,0xFF,0xFF,0xFF,0xDF,0xCB,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xDF,0x50,0xFF,0xDF,0x7E,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0xE7,0x5D,0x41,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xEF,0x7E,0xFF,0x9D,0xB9,0xFF,0x5C,0x75,0xFF,0x53,0x91,0xFF,0xCE,0x58,0xFF,0xE6,0xFA,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9D,0xFF,0xDE,0xBA,0xFF,0x74,0xF6,0xFF,0x6C,0xD6,0xFF,0x7D,0x17,0xFF,0x02,0xAF,0xFF,0xBE,0x19,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBE,0x30,0x00,0x00,0x00,0xE7,0x1C,0x09,0xFF,0xDF,0x8E,0xFF,0xDF,0x6A,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xBE,0x7B,0x10,0xF7,0xDF,0xE6,0xFF,0xFF,0xFF,0xFF,0xDF,0xFD,0x85,0x37,0xFF,0x44,0x34,0xFF,0x33,0x50,0xFF,0xBD,0xD6,0xFF,0xE6,0xD9,0xFF,0xF7,0x9C,0xFF,
-    0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xFF,0xBD,0xFF,0xF7,0x9C,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xEF,0x5C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xC6,0x38,0xFF,0x64,0xB6,0xFF,0x74,0xF7,0xFF,0x54,0x75,0xFF,0x8C,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xC7,0x1C,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDF,0xC4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xBE,0x7B,0xFF,0x54,0x75,0xFF,0x43,0xB2,0xFF,0x9C,0xF4,0xFF,0xDE,0x99,0xFF,0xEF,0x5B,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0xBD,0xFF,0xCE,0x58,0xFF,0xDE,0xDA,0xFF,0xD6,0x99,0xFF,0xD6,0x99,0xFF,0xF7,0x9C,0xFF,0xE7,0x1A,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x5B,0xFF,0xA5,0x97,0xFF,0x5C,0xB6,0xFF,0x6C,0xD6,0xFF,0x74,0xD5,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xDF,0xAD,0x00,0x00,0x00,0xFF,0xFF,0x06,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xDF,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF7,0x9E,0xFF,0x74,0xF7,0xFF,0x4C,0x13,0xFF,0x6B,0xF1,0xFF,0xD6,0x58,0xFF,0xE6,0xFA,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,
-    0xF7,0x9C,0xFF,0xA5,0x34,0xFF,0x00,0x00,0xFF,0xC5,0xF6,0xFF,0xA5,0x13,0xFF,0x00,0x00,0xFF,0xAD,0x75,0xFF,0xEF,0x5C,0xFF,0xDE,0xB9,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xEF,0x1B,0xFF,0x8D,0x36,0xFF,0x5C,0xB6,0xFF,0x6C,0xD6,0xFF,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xDF,0x73,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xB6,0x5A,0xFF,0x54,0x75,0xFF,0x4B,0x70,0xFF,0xC5,0xF7,0xFF,0xE6,0xB9,0xFF,0xF7,0x9C,0xFF,0xEF,0x7C,0xFF,0xF7,0xBD,0xFF,0xB5,0x95,0xFF,0x00,0x87,0xFF,0x01,0x89,0xFF,0xC6,0x37,0xFF,0xAD,0x74,0xFF,0x01,0x48,0xFF,0x00,0x06,0xFF,0xB5,0xB6,0xFF,0xEF,0x3A,0xFF,0xE6,0xDA,0xFF,0xF7,0x9D,0xFF,0xF7,0x7C,0xFF,0xFF,0x9C,0xFF,0xDE,0xDA,0xFF,0x74,0xD6,0xFF,0x54,0x95,0xFF,0xD6,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xF7,0xDF,0x39,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x1C,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xEF,0x7E,0xFF,0x6C,0xF6,0xFF,0x3B,0x71,0xFF,0xB5,0x96,0xFF,0xDE,0xB9,0xFF,0xEF,0x5C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xE7,0x3B,0xFF,
-    0x3A,0x4A,0xFF,0x01,0x07,0xFF,0x00,0x00,0xFF,0xC5,0xF7,0xFF,0xAD,0x54,0xFF,0x00,0x00,0xFF,0x01,0x68,0xFF,0x11,0xA9,0xFF,0xE6,0xFA,0xFF,0xE6,0xD9,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xFF,0xBD,0xFF,0xCE,0x79,0xFF,0x54,0x95,0xFF,0xA5,0xD9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xEF,0x5D,0x0B,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x97,0xFF,0xFF,0xFF,0xFF,0xDF,0xF9,0xFF,0xFF,0xFF,0xA5,0xF9,0xFF,0x13,0x71,0xFF,0x94,0xD3,0xFF,0xDE,0xB9,0xFF,0xEF,0x3B,0xFF,0xF7,0xBD,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xE7,0x1A,0xFF,0xCE,0x57,0xFF,0xCE,0x57,0xFF,0xC6,0x37,0xFF,0xE6,0xFA,0xFF,0xDE,0xDA,0xFF,0xCE,0x38,0xFF,0xCE,0x58,0xFF,0xCE,0x38,0xFF,0xE7,0x1B,0xFF,0xDE,0xB9,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xAD,0xD8,0xFF,0x44,0x55,0xFF,0xDF,0x1D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x07,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xE7,0x1C,0x09,0xFF,0xDF,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xC6,0x9B,0xFF,0x33,0xD3,0xFF,0x63,0xD1,0xFF,0xCE,0x58,0xFF,0xE6,0xFA,0xFF,0xF7,0xBD,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xE7,0x1A,0xFF,
-    0x8C,0x71,0xFF,0x8C,0x71,0xFF,0x7C,0x0F,0xFF,0xCE,0x58,0xFF,0xBD,0xF6,0xFF,0x84,0x30,0xFF,0x94,0x92,0xFF,0x84,0x51,0xFF,0xE6,0xFA,0xFF,0xE6,0xDA,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xEF,0x5B,0xFF,0x85,0x16,0xFF,0x74,0xF6,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0x56,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x9E,0x47,0xE7,0x5D,0x26,0xE7,0x7D,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xDE,0xDB,0x07,0xFF,0xDF,0xC7,0xFF,0xFF,0xFF,0xBE,0x7A,0xFD,0x54,0x74,0xFF,0x3B,0x0F,0xFF,0xBD,0xF6,0xFF,0xE6,0xB9,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0x73,0xAF,0xFF,0x00,0x03,0xFF,0x00,0x00,0xFF,0xB5,0xB5,0xFF,0xA5,0x33,0xFF,0x00,0x04,0xFF,0x00,0x06,0xFF,0x6B,0x8F,0xFF,0xEF,0x5C,0xFF,0xDE,0xB9,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xDE,0xDA,0xFF,0x64,0x95,0xFF,0x8D,0x77,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xDF,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x7D,0x44,0xEF,0x9E,0xBF,0xEF,0x9E,0x9A,0xEF,0x9E,0x8B,0xEF,0x7D,0x2E,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x4C,0xF7,0xDF,0x6C,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xD3,0x05,0x00,0x00,0x00,0x85,0x57,0x95,0x7D,0x58,0xFF,0x54,0x95,0xF5,0x2B,0x50,0xFA,0xA5,0x34,0xFE,0xDE,0x78,0xFF,0xEF,0x5B,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,
-    0xD6,0xB9,0xFF,0x3A,0x2A,0xFF,0x00,0x00,0xFF,0xBD,0xB5,0xFF,0xAD,0x54,0xFF,0x00,0x02,0xFF,0x42,0x8B,0xFF,0xE7,0x1B,0xFF,0xE7,0x1A,0xFF,0xEF,0x1A,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xCE,0x79,0xFF,0x4C,0x75,0xFF,0x74,0xF6,0xFF,0xCE,0xBB,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xEF,0x7D,0xFF,0xE7,0x3C,0xFF,0xDF,0x1C,0xFF,0xE7,0x5D,0xFF,0xEF,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xC6,0x38,0x09,0x00,0x00,0x00,0xAF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xF7,0x9E,0x14,0xEF,0xBE,0x8A,0xEF,0x9E,0xE3,0xFF,0xFF,0xFF,0xE7,0x5D,0x5B,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xDF,0x7D,0x10,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x05,0x55,0x03,0x00,0x00,0x00,0x74,0xF6,0x6C,0x6D,0x17,0xFF,0x64,0x95,0xFF,0x02,0xAF,0xFF,0xAD,0x75,0xFF,0xEF,0x1A,0xFE,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xD6,0x99,0xFF,0x52,0xEC,0xFF,0xB5,0xB5,0xFF,0xAD,0x75,0xFF,0x6B,0xCF,0xFF,0xE7,0x1B,0xFF,0xEF,0x1B,0xFF,0xDE,0xB9,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xB5,0xF8,0xFF,0x44,0x96,0xFF,0x3C,0x34,0xFF,0x3B,0x50,0xFF,0x74,0x53,0xFF,0x8C,0xF5,0xFF,0x95,0x15,0xFF,0x84,0xD5,0xFF,0x6C,0x53,0xFF,0x4B,0x91,0xFF,0x23,0x0F,0xFF,0x02,0xAF,0xFF,0x02,0x8E,0xFF,0x0A,0xCF,0xFF,
-    0x3B,0x50,0xFF,0x64,0x12,0xFF,0x8C,0xF5,0xFF,0xAD,0xD8,0xFF,0xCE,0xBB,0xFF,0xE7,0x5D,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xF7,0xFF,0xFF,0xC6,0x9A,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xEF,0xBE,0x18,0xE7,0x7D,0xBE,0xE7,0x7D,0x83,0xEF,0x9E,0x78,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x4D,0xFF,0xFF,0x5C,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x04,0x00,0x00,0x01,0x00,0x00,0x00,0x8D,0x77,0x34,0x7C,0xD4,0x7B,0x6C,0x94,0x7C,0xDE,0xBA,0xDE,0xFF,0xDD,0xFF,0xF7,0x7C,0xFD,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,
-    0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xEF,0x5B,0xFF,0xE7,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5B,0xFF,0xE6,0xFA,0xFF,0xE6,0xD9,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0xBC,0xFF,0xEF,0x3B,0xFF,0xAD,0x96,0xFF,0x8C,0xF4,0xFF,0x84,0x52,0xFF,0x7C,0x32,0xFF,0x73,0xF1,0xFF,0x6B,0xF1,0xFF,0x6B,0xF1,0xFF,0x73,0xF1,0xFF,0x74,0x11,0xFF,0x74,0x11,0xFF,0x74,0x12,0xFF,0x74,0x11,0xFF,0x74,0x11,0xFF,0x6B,0xF1,0xFF,0x63,0xD0,0xFF,0x5B,0x90,0xFF,0x53,0x90,0xFF,0x5B,0x90,0xFF,0x6C,0x11,0xFF,0x7C,0x93,0xFF,0x8C,0xF4,0xFF,0x95,0x15,0xFF,0x8C,0xF5,0xF3,0x74,0x73,0xED,0x43,0x50,0xB6,0x00,0x0A,0x18,0x00,0x00,0x00,0xF7,0xBE,0x1C,0xFF,0xFF,0x15,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x5D,0x0C,0xEF,0x9E,0x3E,0x00,0x00,0x00,0xE7,0x1C,0x09,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x9D,0xAE,0xFF,0xFE,0xFF,0xF7,0x7C,0xFB,0xE6,0xFA,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xE7,0x1A,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xEF,0x3B,0xFF,0xEF,0x1A,0xFF,0xEF,0x5B,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0xBD,0xFF,0xE7,0x1A,0xFF,0xD6,0x36,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,
-    0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x57,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFF,0xCD,0xF6,0xFD,0xCE,0x16,0xFF,0xAD,0x54,0x49,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x9E,0x11,0xFF,0xFF,0xE9,0xFF,0xFF,0xDE,0xFF,0xFF,0x0A,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0xFF,0xFF,0x1F,0xFF,0xFF,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x03,0xAE,0x38,0x09,0x00,0x00,0x00,0xEF,0x7C,0x9C,0xFF,0xFE,0xFF,0xF7,0x9C,0xFB,0xE7,0x1A,0xFF,0xE6,0xFA,0xFF,0xE6,0xD9,0xFF,0xE7,0x1A,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,
-    0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9D,0xFF,0xE6,0xD9,0xFF,0xCD,0xF6,0xFF,0xCE,0x17,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x17,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFE,0xD6,0x37,0xFF,0xD6,0x37,0xF9,0xDE,0x99,0x21,0x00,0x00,0x00,0xE7,0x1C,0x09,0x00,0x00,0x00,0xFF,0xDF,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6E,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x07,0xFF,0x01,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0xA5,0xFF,0xFF,0xFF,0xF7,0xBE,0x38,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xF7,0x04,0x00,0x00,0x00,0xF7,0x9D,0x79,0xFF,0xBD,0xFF,0xE7,0x1A,0xFB,0xE7,0x1A,0xFF,0xEF,0x1B,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0xBD,0xFF,0xDE,0xD9,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,
-    0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFE,0xD6,0x57,0xFF,0xCE,0x37,0xED,0xC6,0x18,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x3C,0x15,0xFF,0xDF,0xF1,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xC1,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xF7,0x9E,0x16,0xFF,0xFF,0xED,0xFF,0xFF,0xFF,0xF7,0xBE,0x9A,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0x9D,0x6D,0xFF,0xBD,0xFF,0xE6,0xDA,0xFB,0xE6,0xFA,0xFF,0xE7,0x1A,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,
-    0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xEF,0x3B,0xFF,0xE6,0xFA,0xFF,0xE6,0xFA,0xFF,0xE7,0x1A,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xDE,0xB9,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFD,0xD6,0x57,0xFF,0xCE,0x37,0xDF,0xD6,0xBA,0x06,0xFF,0xFF,0x03,0x00,0x00,0x00,0xF7,0x9E,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xE7,0x7D,0x1B,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xF7,0xBE,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xEB,0xCE,0xFB,0x0F,0x00,0x00,0x00,0xFF,0xFF,0x05,0x00,0x00,0x00,0xEF,0x7C,0x63,0xFF,0xFE,0xFF,0xF7,0x9C,0xFB,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xE6,0xFA,0xFF,0xDE,0xB9,0xFF,0xE6,0xD9,0xFF,0xE6,0xFA,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xDE,0x98,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,
-    0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFB,0xDE,0x78,0xFF,0xCE,0x37,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x55,0x06,0xFF,0xDF,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xF7,0xBE,0x5A,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xF7,0xBF,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xF7,0x9E,0x66,0x00,0x00,0x00,0xFF,0xFB,0x08,0x00,0x00,0x00,0xEF,0x5C,0x47,0xFF,0xDD,0xFF,0xF7,0x9C,0xFD,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,
-    0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xFF,0xBC,0xFF,0xFF,0xBD,0xFF,0xFF,0xBD,0xFF,0xFF,0xBD,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xEF,0x7C,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x9C,0xFF,0xD6,0x78,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFB,0xDE,0x98,0xFF,0xCE,0x37,0xAB,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDF,0x53,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xF7,0xDF,0xB5,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xE7,0x3C,0x29,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xDF,0xD3,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x5C,0x33,0xF7,0x9C,0xFF,0xF7,0x9C,0xFE,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xFF,0xBC,0xFF,0xE7,0x3B,0xFF,0xCE,0x9A,0xFF,0xBE,0x39,0xFF,0xC6,0x59,0xFF,0xD6,0xDA,0xFF,0xEF,0x5C,0xFF,0xFF,0xBD,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xE7,0x1A,0xFF,0xDE,0xD9,0xFF,0xE6,0xDA,0xFF,0xE6,0xDA,0xFF,0xEF,0x7C,0xFF,0xD6,0x78,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xD6,0x37,0xFF,
-    0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x16,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFB,0xDE,0x98,0xFF,0xD6,0x37,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xA4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xE7,0x5D,0x3B,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xDF,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xDF,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7C,0x2B,0xF7,0x9C,0xFF,0xF7,0x7C,0xFE,0xF7,0x9C,0xFE,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xFF,0x9D,0xFF,0xEF,0x7C,0xFF,
-    0xA5,0xB8,0xFF,0x44,0x35,0xFF,0x54,0x76,0xFF,0x6C,0xD6,0xFF,0x5C,0x75,0xFF,0x2B,0xF4,0xFF,0x5C,0x75,0xFF,0xAD,0xD7,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xF7,0x7C,0xFF,0xD6,0x57,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x17,0xFF,0xCD,0xF6,0xFF,0xD6,0x78,0xFF,0xE6,0xFA,0xFF,0xDE,0xB9,0xFF,0xDE,0xB9,0xFF,0xDE,0xB9,0xFF,0xDE,0xB9,0xFF,0xDE,0xD9,0xFF,0xE6,0xD9,0xFF,0xDE,0xD9,0xFF,0xE6,0xDA,0xFF,0xE6,0xDA,0xFF,0xE6,0xD9,0xFF,0xE6,0xB9,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFF,0xD6,0x17,0xFB,0xDE,0x98,0xFF,0xCE,0x17,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xAE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xDF,0xD7,0x9E,0x79,0x05,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x12,0xFF,0xFF,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x5C,0x23,0xF7,0x7C,0xFC,0xF7,0x9C,0xFF,0xF7,0x7C,0xFE,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xFF,0x9D,0xFF,0xEF,0x5C,0xFF,0x7D,0x37,0xFF,0x6C,0xF6,0xFF,0xCE,0xBA,0xFF,0xDE,0xFA,0xFF,0xDE,0xB9,0xFF,0xDE,0xFA,0xFF,0xCE,0xBA,0xFF,0x74,0xF6,0xFF,0x23,0xB3,0xFF,0x7C,0xB4,0xFF,0xEF,0x5C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xD6,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCD,0xF6,0xFF,0xDE,0x98,0xFF,0xD6,0x78,0xFF,0x42,0x6A,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x42,0x6A,0xFF,0xCE,0x37,0xFF,0xB5,0x74,0xFF,0x52,0xCC,0xFF,
-    0x73,0xAF,0xFF,0x6B,0x8E,0xFF,0x7C,0x10,0xFF,0xDE,0xB9,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFF,0xD6,0x17,0xFD,0xD6,0x58,0xFF,0xCE,0x37,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xBB,0x6B,0xE7,0x5D,0xFF,0xFF,0xDF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xDF,0x91,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xCE,0x79,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xCE,0xDB,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x3D,0xFC,0xDF,0x3D,0xFF,0xD6,0xDC,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x1C,0x11,0xF7,0x7C,0xE9,0xF7,0x9D,0xFF,0xF7,0x7C,0xFD,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0x85,0x37,0xFF,0x85,0x58,0xFF,
-    0xEF,0x7C,0xFF,0xD5,0xF5,0xFF,0xA3,0x8B,0xFF,0x9A,0xE8,0xFF,0xA3,0xAC,0xFF,0xD5,0xF5,0xFF,0xE7,0x1B,0xFF,0x9D,0x98,0xFF,0x3B,0xD3,0xFF,0x84,0xD4,0xFF,0xF7,0x9D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xEF,0x5B,0xFF,0xD6,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCD,0xF6,0xFF,0xDE,0xB9,0xFF,0xCE,0x37,0xFF,0x00,0x46,0xFF,0x29,0xC8,0xFF,0x29,0xC8,0xFF,0x00,0x45,0xFF,0xCE,0x37,0xFF,0xA4,0xD2,0xFF,0x00,0x00,0xFF,0x29,0xA8,0xFF,0x00,0x66,0xFF,0x52,0xCC,0xFF,0xDE,0xB9,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFE,0xD6,0x17,0xFE,0xD6,0x37,0xFF,0xD6,0x58,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x73,0xA2,0x02,0xAE,0xFF,0xC6,0x7A,0xFB,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF7,0xBE,0x1C,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xF7,0x9F,0x22,0xFF,0xDF,0xFE,0xFF,0xDF,0x70,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x64,0xD3,0x05,0x00,0x00,0x00,0x6C,0x94,0x73,0x9D,0x97,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x84,0xF5,0xFB,0x03,0x10,0xFF,0x74,0x94,0xA0,0x00,0x00,0x00,0x00,0x00,0x03,0xCE,0x79,0x05,0xF7,0x7C,0xDD,0xFF,0xBD,0xFF,0xF7,0x7C,0xFD,0xF7,0x5C,0xFF,0xFF,0x9C,0xFF,0xBE,0x39,0xFF,0x4C,0x75,0xFF,0xE7,0x3C,0xFF,0xD5,0xB4,0xFF,0x88,0xE0,0xFF,0xA2,0xE7,0xFF,0x9A,0xC7,0xFF,0x9A,0xA6,0xFF,0x91,0x20,0xFF,0xC5,0x53,0xFF,0xE7,0x3B,0xFF,0x85,0x17,0xFF,0x03,0x10,0xFF,0xC6,0x38,0xFF,0xFF,0xBD,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xEF,0x3B,0xFF,0xCE,0x16,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCD,0xF6,0xFF,0xDE,0xB9,0xFF,0xCE,0x37,0xFF,0x01,0x27,0xFF,0x42,0x4A,0xFF,0x3A,0x2A,0xFF,0x19,0x88,0xFF,0xD6,0x58,0xFF,0x9C,0xD2,0xFF,0x00,0x86,0xFF,
-    0x42,0x6A,0xFF,0x29,0xC8,0xFF,0x63,0x2D,0xFF,0xDE,0xB9,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFE,0xD6,0x37,0xFF,0xCE,0x37,0xEC,0xC6,0x38,0x16,0x00,0x00,0x00,0x95,0x76,0x25,0x5C,0x12,0xFC,0x3B,0x70,0xFF,0x33,0x4F,0xFE,0xE7,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xDF,0x25,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xDB,0x07,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xF7,0x9E,0x11,0xFF,0xDF,0xDB,0xFF,0xDF,0x64,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x53,0xD2,0x13,0x50,0xFF,0xA5,0x97,0xFC,0xEF,0x9E,0xFF,0xDF,0x3C,0xFF,0x5B,0xF2,0xFE,0x3B,0x70,0xFF,0x4B,0xD1,0xFF,0x85,0x15,0x2E,0x00,0x00,0x00,0x02,0xAA,0x03,0xF7,0x9C,0xD9,0xFF,0xDD,0xFF,0xF7,0x7C,0xFD,0xF7,0x7C,0xFF,0xEF,0x5C,0xFF,0x74,0xF6,0xFF,0x9D,0xB8,0xFF,0xE6,0xB9,0xFF,
-    0xA2,0xA5,0xFF,0x9A,0xE8,0xFF,0xA3,0x28,0xFF,0x9A,0xE7,0xFF,0xA2,0xE8,0xFF,0xA2,0xE8,0xFF,0x92,0x22,0xFF,0xEE,0xF9,0xFF,0xBE,0x7A,0xFF,0x43,0xD3,0xFF,0x74,0x52,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xEF,0x3B,0xFF,0xCE,0x16,0xFF,0xD6,0x37,0xFF,0xCE,0x37,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFF,0xE6,0xB9,0xFF,0xC6,0x17,0xFF,0x00,0xC6,0xFF,0x3A,0x2A,0xFF,0x32,0x09,0xFF,0x11,0x88,0xFF,0xD6,0x78,0xFF,0x9C,0xB2,0xFF,0x00,0x05,0xFF,0x3A,0x4A,0xFF,0x19,0x88,0xFF,0x63,0x2D,0xFF,0xDE,0xB9,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFD,0xDE,0x57,0xFF,0xCE,0x17,0xD9,0x04,0x10,0x04,0x00,0x00,0x00,0x6C,0x73,0x99,0x43,0xB1,0xFF,0x6C,0x73,0xFA,0xCE,0xBB,0xFF,0x84,0xD4,0xFF,0xBE,0x39,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFB,0xEF,0x7E,0xFF,0xDF,0x3D,0xA1,0x00,0x00,0x00,0xBD,0xF7,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x9C,0xFF,0xDF,0xF2,0xF7,0x9E,0x28,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x04,0x00,0x00,0x00,0x74,0xB4,0x4C,0x54,0x12,0xFF,0x43,0xB1,0xFC,0x03,0x0F,0xFF,0x4B,0xD1,0xFF,0x2B,0x50,0xFF,0x7C,0xB4,0xFF,0xEF,0x9E,0xFB,0xCE,0xBB,0xFF,0x54,0x12,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x7C,0xD0,0xFF,0xDE,0xFF,0xF7,0x7C,0xFC,0xF7,0x9C,0xFF,0xDE,0xFA,0xFF,0x03,0xD4,0xFF,0xB6,0x19,0xFF,0xCD,0xB4,0xFF,0x9A,0x62,0xFF,0x9B,0x08,0xFF,0xA3,0x07,0xFF,0x9A,0xE7,0xFF,0xA2,0xE7,0xFF,0xA3,0x08,0xFF,0x92,0x00,0xFF,0xD6,0x15,0xFF,0xDF,0x3C,0xFF,0x54,0x75,0xFF,0x02,0x4E,0xFF,0xDE,0xFB,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xE7,0x1A,0xFF,0xCD,0xF6,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xDE,0xB9,0xFF,0xC5,0xF6,0xFF,0x00,0xE6,0xFF,0x3A,0x29,0xFF,0x32,0x09,0xFF,0x01,0x27,0xFF,0xD6,0x58,0xFF,0x94,0x91,0xFF,0x00,0x04,0xFF,
-    0x3A,0x29,0xFF,0x01,0x07,0xFF,0x5B,0x0C,0xFF,0xDE,0xB9,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFC,0xDE,0x78,0xFF,0xCE,0x17,0xBC,0x00,0x00,0x00,0x8D,0x35,0x20,0x5B,0xF1,0xF8,0x3B,0x70,0xFF,0x64,0x32,0xFE,0xDF,0x3C,0xFF,0x7C,0xB4,0xFF,0x02,0x6D,0xFF,0x2B,0x2F,0xFF,0x95,0x56,0xFD,0xBE,0x59,0xFF,0x7C,0xB4,0xD8,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xFF,0xDF,0xBC,0xFF,0xFF,0xFF,0xFF,0xDF,0x2B,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x5C,0x12,0xC1,0x33,0xB1,0xFF,0x6C,0x73,0xFC,0x7C,0xD4,0xFF,0x3B,0x90,0xFF,0x1B,0x2F,0xFF,0x9D,0x76,0xFF,0xFF,0xFF,0xFF,0xDF,0x1C,0xFB,0x4B,0xF2,0xFF,0x95,0x56,0x5E,0x00,0x00,0x00,0xF7,0x7C,0xB8,0xFF,0xFE,0xFF,0xF7,0x7C,0xFB,0xF7,0x7C,0xFF,0xEF,0x3B,0xFF,0xB6,0x18,0xFF,0xD6,0xB9,0xFF,0xC5,0x11,0xFF,
-    0xA2,0x84,0xFF,0x9A,0xE8,0xFF,0xA3,0x08,0xFF,0x9A,0xE7,0xFF,0xA2,0xE7,0xFF,0xA3,0x28,0xFF,0x9A,0x20,0xFF,0xCD,0x93,0xFF,0xE7,0x3B,0xFF,0xAD,0xB7,0xFF,0xBE,0x17,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xE7,0x1A,0xFF,0xCD,0xF6,0xFF,0xCE,0x37,0xFF,0xCE,0x36,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xDE,0x98,0xFF,0xDE,0xB9,0xFF,0xD6,0x58,0xFF,0xD6,0x98,0xFF,0xD6,0x98,0xFF,0xCE,0x37,0xFF,0xDE,0x99,0xFF,0xD6,0x57,0xFF,0xC6,0x17,0xFF,0xCE,0x37,0xFF,0xC6,0x17,0xFF,0xCE,0x17,0xFF,0xDE,0x98,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFA,0xDE,0x98,0xFF,0xCE,0x16,0xA0,0x00,0x00,0x00,0x4B,0x90,0x7C,0x1B,0x30,0xFF,0x3B,0x50,0xFA,0x6C,0x53,0xFF,0x43,0x90,0xFF,0x2B,0x2F,0xFF,0x53,0xB1,0xFF,0x5C,0x12,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFC,0xE7,0x3D,0xFF,0x02,0xCE,0x5C,0x00,0x00,0x00,0x64,0xD3,0x05,0x00,0x00,0x00,0xFF,0xFF,0x05,0xF7,0xBE,0x1A,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xCE,0xDB,0x14,0x3B,0xB1,0xEC,0x95,0x56,0xFF,0xFF,0xDF,0xFE,0xFF,0xFF,0xFF,0xCE,0x9A,0xFF,0x3B,0x90,0xFF,0x43,0x90,0xFF,0x7C,0xB4,0xFF,0x53,0xD1,0xFA,0x3B,0x91,0xFF,0x74,0x93,0x84,0x00,0x00,0x00,0xF7,0x5C,0xA6,0xFF,0xFE,0xFF,0xF7,0x7C,0xFB,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xFF,0x9C,0xFF,0xEF,0x5B,0xFF,0xBC,0xF0,0xFF,0xA2,0xA4,0xFF,0x9A,0xE8,0xFF,0xA3,0x08,0xFF,0x9A,0xE7,0xFF,0xA2,0xE7,0xFF,0xA3,0x28,0xFF,0x9A,0x20,0xFF,0xCD,0x52,0xFF,0xE6,0xFA,0xFF,0xDE,0x78,0xFF,0xFF,0xDD,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xE6,0xFA,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x36,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xDE,0xB9,0xFF,0xC5,0xF6,0xFF,0x6B,0x6D,0xFF,0x7B,0xEF,0xFF,0x7B,0xEF,0xFF,0x7B,0xCF,0xFF,0xDE,0x98,0xFF,0xA5,0x13,0xFF,0x63,0x4D,0xFF,
-    0x7B,0xCF,0xFF,0x6B,0x6E,0xFF,0x94,0x71,0xFF,0xDE,0x98,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFB,0xDE,0x98,0xFF,0xCE,0x17,0x7E,0x00,0x00,0x00,0x7C,0xB4,0xC1,0xA5,0xB7,0xFF,0xE7,0x3C,0xFC,0xFF,0xDF,0xFF,0xF7,0xDF,0xFF,0x9D,0x76,0xFF,0x33,0x2F,0xFF,0x4B,0x90,0xFF,0xBE,0x39,0xFF,0xEF,0x9E,0xFB,0xAD,0xF8,0xFF,0x43,0x70,0xA7,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xDF,0x1C,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xE7,0x5D,0xFF,0x53,0xD1,0xFF,0x4B,0xD1,0xFF,0x02,0xCE,0xFD,0x53,0xF1,0xFF,0x8D,0x15,0xD7,0xA6,0x9A,0x0B,0x00,0x00,0x00,0xF7,0x7C,0x9A,0xFF,0xFE,0xFF,0xF7,0x7C,0xFA,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xEF,0x5B,0xFF,0xBD,0x11,0xFF,
-    0xA2,0x84,0xFF,0x9A,0xE8,0xFF,0xA3,0x07,0xFF,0x9A,0xE7,0xFF,0xA2,0xE7,0xFF,0xA3,0x08,0xFF,0x9A,0x20,0xFF,0xC5,0x52,0xFF,0xE6,0xFA,0xFF,0xD6,0x78,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xE6,0xFA,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xE6,0xD9,0xFF,0xB5,0x74,0xFF,0x00,0x00,0xFF,0x19,0x88,0xFF,0x00,0xE6,0xFF,0x01,0x47,0xFF,0xDE,0x98,0xFF,0x8C,0x30,0xFF,0x00,0x00,0xFF,0x21,0x88,0xFF,0x00,0x03,0xFF,0x6B,0x6D,0xFF,0xDE,0xB9,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFB,0xDE,0x98,0xFF,0xD6,0x37,0x58,0x00,0x00,0x00,0xEF,0x9E,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x5D,0xFF,0x33,0x4F,0xFF,0x4B,0xB1,0xFF,0x02,0x8E,0xFF,0x02,0x6D,0xFC,0x2B,0x50,0xFF,0x8D,0x35,0x50,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xE7,0x7D,0xAB,0xFF,0xFF,0xFF,0xF7,0xDF,0xFB,0xC6,0x9A,0xFF,0x4B,0xD1,0xFF,0x03,0x0F,0xFF,0x03,0x0F,0xFF,0xA5,0x97,0xFE,0xF7,0xBE,0xFF,0xFF,0xFF,0xFD,0xFF,0xDE,0x49,0x00,0x00,0x00,0xEF,0x7C,0x91,0xF7,0x9C,0xFF,0xE6,0xDA,0xFA,0xE6,0xDA,0xFF,0xEF,0x1A,0xFF,0xF7,0x9C,0xFF,0xEF,0x5B,0xFF,0xC5,0x11,0xFF,0xA2,0x84,0xFF,0x9A,0xE8,0xFF,0xA3,0x07,0xFF,0x9A,0xC7,0xFF,0xA2,0xE7,0xFF,0xAB,0x28,0xFF,0x9A,0x21,0xFF,0xC5,0x32,0xFF,0xE6,0xFA,0xFF,0xD6,0x78,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xE6,0xD9,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x36,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xE6,0xD9,0xFF,0xB5,0x74,0xFF,0x00,0xA6,0xFF,0x42,0x6A,0xFF,0x32,0x09,0xFF,0x42,0x4A,0xFF,0xDE,0x99,0xFF,0x8C,0x50,0xFF,0x01,0x07,0xFF,
-    0x42,0x6A,0xFF,0x11,0x47,0xFF,0x83,0xEF,0xFF,0xDE,0xD9,0xFF,0xCE,0x16,0xFF,0xD6,0x36,0xFD,0xD6,0x77,0xFF,0xC5,0xF6,0x3B,0xFF,0xFF,0x10,0xFF,0xFF,0xF6,0xFF,0xFF,0xFF,0xFF,0xDE,0xFE,0xF7,0xDE,0xFF,0xFF,0xFF,0xFF,0xC6,0x7A,0xFF,0x02,0x0D,0xFF,0x33,0x0F,0xFF,0x84,0xD4,0xFF,0xA5,0x76,0xFB,0x95,0x56,0xFF,0x9D,0x97,0x5F,0x00,0x00,0x00,0xBD,0xF7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x03,0x00,0x00,0x00,0x8D,0x76,0x35,0x5C,0x12,0xFF,0x7C,0xB4,0xFE,0x74,0xB4,0xFE,0x03,0x0F,0xFF,0x7C,0xB4,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xF7,0xBE,0xE4,0x00,0x00,0x00,0xEF,0x5C,0x6D,0xFF,0xBD,0xFF,0xE7,0x1A,0xFB,0xE7,0x3B,0xFF,0xEF,0x5B,0xFF,0xF7,0x9C,0xFF,0xEF,0x7B,0xFF,0xC5,0x52,0xFF,
-    0xA2,0x84,0xFF,0x9A,0xE8,0xFF,0xA3,0x07,0xFF,0x9A,0xC7,0xFF,0xA2,0xE7,0xFF,0x92,0xE8,0xFF,0x89,0xE0,0xFF,0xCD,0x32,0xFF,0xE6,0xFA,0xFF,0xD6,0x78,0xFF,0xF7,0x9C,0xFF,0xEF,0x5C,0xFF,0xE7,0x1A,0xFF,0xE7,0x1A,0xFF,0xE7,0x1A,0xFF,0xEF,0x5B,0xFF,0xF7,0xBD,0xFF,0xDE,0xD9,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xE6,0xD9,0xFF,0xB5,0x74,0xFF,0x00,0x05,0xFF,0x42,0x4A,0xFF,0x31,0xE9,0xFF,0x42,0x4A,0xFF,0xDE,0x98,0xFF,0x8C,0x30,0xFF,0x01,0x27,0xFF,0x42,0x6A,0xFF,0x01,0x47,0xFF,0x84,0x30,0xFF,0xE6,0xD9,0xFF,0xCE,0x36,0xFE,0xD6,0x37,0xFF,0xCE,0x37,0xFE,0xD5,0xB4,0x11,0xC6,0xBB,0x4C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x5D,0xFF,0x43,0x70,0xFF,0x7C,0x93,0xFF,0xD6,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xF7,0xBE,0xDC,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x10,0x04,0x00,0x00,0x00,0x6C,0x73,0xA3,0x43,0xD1,0xFF,0x33,0x70,0xFA,0x43,0xB1,0xFF,0x1B,0x50,0xFF,0xCE,0xBB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0x31,0xEF,0x5B,0x4E,0xFF,0xFE,0xFF,0xF7,0x9C,0xFB,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xEF,0x7B,0xFF,0xC5,0x73,0xFF,0xA2,0x63,0xFF,0x9A,0xE8,0xFF,0xA3,0x07,0xFF,0x9A,0xC7,0xFF,0xA2,0xE7,0xFF,0x5A,0x47,0xFF,0x61,0x40,0xFF,0xCD,0x52,0xFF,0xE6,0xFA,0xFF,0xD6,0x78,0xFF,0xF7,0xBC,0xFF,0xEF,0x5B,0xFF,0xE6,0xD9,0xFF,0xE6,0xDA,0xFF,0xE6,0xD9,0xFF,0xEF,0x5B,0xFF,0xF7,0xBD,0xFF,0xDE,0xB9,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xE6,0xD9,0xFF,0xAD,0x54,0xFF,0x00,0x02,0xFF,0x29,0xC8,0xFF,0x01,0x06,0xFF,0x31,0xE9,0xFF,0xD6,0x77,0xFF,0x7B,0xCF,0xFF,0x00,0x05,0xFF,
-    0x31,0xE9,0xFF,0x00,0x04,0xFF,0x84,0x10,0xFF,0xE6,0xD9,0xFF,0xCE,0x36,0xFE,0xD6,0x57,0xFF,0xCE,0x17,0xF4,0x00,0x00,0x00,0x5C,0x32,0x89,0x64,0x53,0xFF,0xB5,0xF8,0xFB,0xC6,0x7A,0xFF,0xA5,0x97,0xFF,0x23,0x0F,0xFF,0x9D,0x56,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xDE,0x5E,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x8D,0x57,0x0F,0x4B,0xB1,0xE7,0x4B,0xB1,0xFF,0x53,0xD1,0xFE,0x53,0xF1,0xFF,0x43,0xB1,0xFF,0x7C,0xD4,0xFF,0xD6,0xFC,0xFF,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xBE,0x7A,0x62,0xF7,0x7B,0x37,0xFF,0xFE,0xFF,0xF7,0x9C,0xFB,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xCD,0x94,0xFF,
-    0xA2,0x63,0xFF,0x9A,0xE8,0xFF,0xA3,0x07,0xFF,0x9A,0xC7,0xFF,0xA2,0xE7,0xFF,0x9B,0x08,0xFF,0x8A,0x01,0xFF,0xCD,0x52,0xFF,0xE6,0xFA,0xFF,0xD6,0x78,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xEF,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xDE,0x98,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xDE,0xB9,0xFF,0xDE,0x98,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xC5,0xF6,0xFF,0xC5,0xF6,0xFF,0xDE,0x98,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xD6,0x58,0xFF,0xDE,0xB9,0xFF,0xCE,0x36,0xFD,0xDE,0x78,0xFF,0xCE,0x36,0xCE,0xCF,0x1C,0x3C,0x64,0x32,0xFA,0x3B,0x70,0xFF,0x0B,0x0F,0xFE,0x33,0x70,0xFF,0xAD,0xF8,0xFF,0x4B,0xB1,0xFF,0xD6,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFB,0xFF,0xFF,0xFF,0xFF,0xDE,0xBA,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x02,0x00,0x00,0x00,0x7D,0x15,0x23,0x54,0x12,0xFF,0x4B,0xF2,0xFF,0x4B,0xB1,0xFE,0x4B,0xD1,0xFF,0x4B,0xD1,0xFF,0x3B,0x91,0xFF,0x23,0x70,0xFF,0x4B,0xF2,0xFF,0x5C,0x53,0xFF,0x64,0x53,0xFF,0x6C,0x93,0xFC,0x64,0x74,0xFF,0x64,0x73,0xA2,0xF7,0xFE,0x63,0xFF,0xFE,0xFF,0xF7,0x9C,0xFC,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xCD,0xB4,0xFF,0x9A,0x63,0xFF,0x9A,0xE8,0xFF,0xA2,0xE7,0xFF,0x9A,0xC7,0xFF,0xA2,0xE7,0xFF,0xA3,0x28,0xFF,0x92,0x00,0xFF,0xCD,0x52,0xFF,0xE6,0xDA,0xFF,0xD6,0x78,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xDE,0x98,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xD6,0x57,0xFF,0xD6,0x78,0xFF,0xDE,0x78,0xFF,0xD6,0x78,0xFF,0xDE,0x78,0xFF,0xD6,0x78,0xFF,0xD6,0x57,0xFF,0xDE,0x78,0xFF,0xDE,0x98,0xFF,
-    0xDE,0x98,0xFF,0xDE,0x98,0xFF,0xDE,0x98,0xFF,0xD6,0x58,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xDE,0xB9,0xF7,0xDF,0x1C,0xFA,0x43,0xB1,0xFF,0x5B,0xF2,0xFE,0x4B,0xD1,0xFF,0x74,0xB4,0xFF,0xF7,0xDF,0xFF,0x84,0xF5,0xFF,0x7C,0xB4,0xFF,0xEF,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0xB6,0x5B,0x0E,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x05,0xFF,0xFF,0x01,0x5C,0x32,0x58,0x4B,0xD1,0xC4,0x4B,0xF2,0xFF,0x3B,0xB1,0xFE,0x43,0xB1,0xFF,0x53,0xF2,0xFF,0x54,0x12,0xFF,0x4B,0xF2,0xFF,0x54,0x12,0xFF,0x6C,0x73,0xFF,0x8D,0x36,0xFF,0xC6,0x7A,0xFE,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xFE,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xCD,0xD4,0xFF,
-    0x9A,0x63,0xFF,0x9A,0xC7,0xFF,0xA2,0xE7,0xFF,0x9A,0xC7,0xFF,0x9A,0xE7,0xFF,0xA3,0x08,0xFF,0x92,0x00,0xFF,0xC5,0x32,0xFF,0xE6,0xFA,0xFF,0xD6,0x78,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xD6,0x78,0xFF,0xCE,0x16,0xFF,0xCE,0x36,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xD6,0x37,0xFF,0xCD,0xF6,0xFF,0xE6,0xFB,0xFF,0xE7,0x5D,0xFF,0x0B,0x2F,0xFE,0x1B,0x30,0xFF,0x33,0x71,0xFF,0x43,0xB1,0xFF,0x5C,0x12,0xFF,0x4B,0xD1,0xFF,0x3B,0x71,0xFF,0x43,0xB1,0xFF,0x7C,0xB4,0xFF,0x95,0x56,0xFF,0xAD,0xD8,0xFF,0xBE,0x39,0xFD,0xC6,0x9A,0xFF,0xA5,0x97,0xFF,0xB6,0x39,0x24,0x00,0x00,0x00,0x84,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x42,0xDF,0x3D,0xE4,0xE7,0x5D,0xFF,0xEF,0x9E,0xFD,0xAC,0xD2,0xFF,0x68,0xE0,0xFF,0xCE,0x38,0xFF,0xF7,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xD5,0xF5,0xFF,0x9A,0x64,0xFF,0x9A,0xC7,0xFF,0xA2,0xE7,0xFF,0x9A,0xC7,0xFF,0x9A,0xC7,0xFF,0xA3,0x08,0xFF,0x92,0x00,0xFF,0xC5,0x32,0xFF,0xE6,0xFA,0xFF,0xDE,0x98,0xFF,0xF7,0xBC,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xD6,0x77,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x17,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x36,0xFF,
-    0xCE,0x36,0xFF,0xCE,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFF,0xE7,0x1B,0xFF,0xFF,0xFF,0xFE,0xDF,0x3C,0xFF,0xAD,0xD8,0xFF,0x84,0xD5,0xFF,0x5C,0x32,0xFF,0x43,0xB1,0xFF,0x4B,0xB1,0xFF,0x53,0xF2,0xFF,0x4B,0xD1,0xFF,0x33,0x71,0xFF,0x33,0x91,0xFF,0x54,0x12,0xFD,0x84,0xF5,0xFF,0x54,0x12,0xAB,0x00,0x00,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x05,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDF,0x24,0xF7,0xDF,0x72,0xFF,0xFF,0xB8,0xFF,0xDF,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB4,0xD1,0xFF,0x70,0x00,0xFF,0xCE,0x17,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9D,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xD6,0x16,0xFF,
-    0xA2,0xC6,0xFF,0x9A,0xE8,0xFF,0xA3,0x28,0xFF,0x9A,0xE8,0xFF,0xA3,0x08,0xFF,0xA3,0x29,0xFF,0x92,0x23,0xFF,0xC5,0x32,0xFF,0xE6,0xFA,0xFF,0xDE,0x98,0xFF,0xF7,0xBC,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xD6,0x57,0xFF,0xCE,0x16,0xFF,0xD6,0x37,0xFF,0xCE,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xD6,0x37,0xFF,0xCE,0x37,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xCE,0x16,0xFF,0xC5,0xD5,0xFF,0xEF,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xEF,0x9E,0xFF,0xCE,0x38,0xFF,0x61,0x00,0xFF,0x8C,0x0F,0xFF,0xE7,0x5D,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xFF,0xFF,0x8F,0xF7,0xBE,0x43,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x0B,0xFF,0xFF,0x5D,0xFF,0xFF,0xBC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x9B,0xCD,0xFF,0x58,0x00,0xFF,0xB5,0x34,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xF7,0xBD,0xFF,0xF7,0x9D,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xCD,0xF5,0xFF,0x91,0x60,0xFF,0x89,0x80,0xFF,0x9A,0x00,0xFF,0x91,0xE0,0xFF,0x91,0xE0,0xFF,0x9A,0x42,0xFF,0x80,0x00,0xFF,0xC4,0xF1,0xFF,0xE6,0xF9,0xFF,0xDE,0xB8,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xEF,0x7C,0xFF,0xD6,0x37,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xCE,0x16,0xFF,0xCE,0x16,0xFF,0xCE,0x37,0xFF,0xD6,0x37,0xFF,
-    0xD6,0x57,0xFF,0xD6,0x78,0xFF,0xDE,0xB9,0xFF,0xE6,0xDA,0xFF,0xEF,0x3C,0xFF,0xEF,0x5C,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0x99,0xFF,0x68,0x00,0xFF,0x93,0x6B,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD9,0xFF,0xDF,0x7A,0xF7,0x9E,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xEF,0x5D,0x0B,0xFF,0xDF,0x82,0xFF,0xFF,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xBD,0x53,0xFF,0x9B,0xCD,0xFF,0xCE,0x17,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0x7D,0xFF,
-    0xDE,0x79,0xFF,0xD6,0x37,0xFF,0xD5,0xF7,0xFF,0xCD,0x95,0xFF,0xC5,0x54,0xFF,0xBD,0x33,0xFF,0xAC,0x70,0xFF,0xCD,0xD5,0xFF,0xE7,0x1A,0xFF,0xE6,0xDA,0xFF,0xF7,0x9D,0xFF,0xF7,0x7C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xEF,0x5C,0xFF,0xD6,0x37,0xFF,0xCE,0x37,0xFF,0xD6,0x57,0xFF,0xD6,0x58,0xFF,0xDE,0x79,0xFF,0xDE,0xB9,0xFF,0xE6,0xDA,0xFF,0xE6,0xFB,0xFF,0xEF,0x3C,0xFF,0xEF,0x5C,0xFF,0xEF,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xC5,0xD6,0xFF,0x68,0x20,0xFF,0x82,0xC9,0xFF,0xEF,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFA,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0xFF,0xDF,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xFF,0xFF,0x02,0x00,0x00,0x00,0xF7,0xDF,0x2A,0xFF,0xFF,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xD7,0x1D,0xFF,0xD7,0x3D,0xFF,0xEF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xEF,0x9E,0xFF,0xCF,0x1C,0xFF,0xD7,0x3D,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB5,0x34,0xFF,0x50,0x00,0xFF,0x60,0x20,0xFF,0xE7,0x1B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xE7,0x7D,0xFF,0xEF,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xE7,0x7D,0xFF,0xFF,0xFF,0xFF,0xEF,0x3C,0xFF,0xDE,0xBA,0xFF,0xDE,0xDA,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xF8,0xFF,0xFF,0xFF,0xFF,0xDF,0x44,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,
-    0xFF,0xFF,0x04,0x00,0x00,0x00,0xFF,0xFF,0xA8,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x5D,0xFF,0xD7,0x3C,0xFF,0xDF,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x5D,0xFF,0xD7,0x1C,0xFF,0xDF,0x5D,0xFF,0xFF,0xDF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xEF,0x9E,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x2D,0x00,0x00,0x00,0xAD,0x55,0x03,0x00,0x00,0x00,0xFF,0xFF,0x02,0x00,0x00,0x00,0xF7,0xBE,0x1E,0xFF,0xFF,0xE4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFA,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xEF,0x9E,0xFF,0xF7,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x70,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0xF7,0xFF,0x15,0xFF,0xFF,0xAB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0xFF,0xD7,0x1C,0xFF,0xDF,0x3D,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9E,0xFF,0xD7,0x1C,0xFF,0xDF,0x3D,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD3,0xFF,0xDF,0x48,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDF,0x32,0xFF,0xFF,0x9B,0xFF,0xFF,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xE7,0x7D,0xFF,0xEF,0x7E,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xB4,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFD,0x0F,0xFF,0xFF,0x53,0xFF,0xFF,0xA0,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFC,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xFF,0xFF,0xAD,0xFF,0xFF,0x63,0xF7,0xBE,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0x05,0xF7,0xBF,0x32,0xFF,0xFF,0x6A,0xFF,0xFF,0xA3,0xFF,0xFF,0xD3,0xFF,0xFF,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,
-    0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xDF,0xD7,0xFF,0xFF,0xA9,0xFF,0xDF,0x71,0xF7,0xBE,0x39,0xEF,0x5D,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xBE,0x1A,0xFF,0xDF,0x40,0xFF,0xFF,0x69,0xFF,0xFF,0x93,0xFF,0xFF,0xB9,0xFF,0xFF,0xD7,0xFF,0xFF,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFA,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xFF,0xFF,0xDB,0xFF,0xFF,0xBF,0xFF,0xFF,0x97,0xFF,0xDF,0x6E,0xFF,0xDF,0x44,0xF7,0xBE,0x1D,0x07,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x03,0xFF,0xFF,0x05,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xBE,0x17,0xF7,0xDF,0x29,0xF7,0xDF,0x46,0xFF,0xDF,0x64,0xFF,0xDF,0x74,0xFF,0xDF,0x9A,0xFF,0xFF,0xAC,0xFF,0xFF,0xB7,0xFF,0xDF,0xD2,0xFF,0xFF,0xE4,0xFF,0xFF,0xE7,
-    0xFF,0xFF,0xEE,0xFF,0xFF,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xEC,0xFF,0xFF,0xE6,0xFF,0xFF,0xE2,0xFF,0xFF,0xC9,0xFF,0xDF,0xB2,0xFF,0xFF,0xA9,0xFF,0xDF,0x89,0xFF,0xFF,0x6A,0xFF,0xDF,0x55,0xFF,0xDF,0x2F,0xF7,0xFF,0x1C,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x04,0xFF,0xFF,0x05,0xFF,0xFF,0x03,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x02,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0xFF,0xFF,0x05,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xDB,0x07,0xEF,0xFF,0x0B,0xF7,0x9E,0x14,0xF7,0xDF,0x22,0xF7,0xBF,0x34,0xFF,0xDF,0x39,0xFF,0xDF,0x3C,0xF7,0xDF,0x43,0xFF,0xFF,0x4A,0xFF,0xFF,0x53,0xFF,0xFF,0x5F,0xFF,0xFF,0x68,0xFF,0xFF,0x72,0xFF,0xFF,0x7A,0xFF,0xFF,0x7A,0xFF,0xFF,0x7B,0xFF,0xFF,0x7B,0xFF,0xFF,0x7B,0xFF,0xFF,0x7B,0xFF,0xFF,0x7B,0xFF,0xFF,0x7B,0xFF,0xFF,0x7A,0xFF,0xFF,0x73,0xFF,0xFF,0x68,0xFF,0xFF,0x5E,0xFF,0xFF,0x54,0xFF,0xDF,0x4A,0xF7,0xDF,0x42,0xF7,0xDF,0x3C,0xF7,0xDF,0x39,0xF7,0xDF,0x32,0xF7,0xBF,0x20,0xE7,0x9E,0x13,0xE7,0x3C,0x0A,
-    0xD7,0xFA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x02,0xFF,0xFF,0x05,0xFF,0xFF,0x04,0xFF,0xFF,0x03,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0x02,0xFF,0xFF,0x02,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x03,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xFF,0xFF,0x02,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x04,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x02,0xFF,0xFF,0x01,0xFF,0xFF,0x01,
-    0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_home_snow_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_home_snow_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_home_snow_png_data
-};
-
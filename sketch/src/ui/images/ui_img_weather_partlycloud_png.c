@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/partlycloud.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_partlycloud_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x28,0x2D,0x62,0xE8,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0xE9,0xD0,0xBD,0x09,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x06,0x18,0xEE,0x29,0xFF,0xE6,0x09,0xFF,0x29,0x87,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x88,0x74,0xFE,0xA9,0xFF,0xF6,0x89,0xFF,0x73,0x27,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x07,0x61,0x5A,0x88,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xC5,0x48,0xF4,0xF6,0xA9,0xFF,0xFE,0xA9,0xFF,0xCD,0x28,0xFD,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0x87,0x5D,0x3A,0x67,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0x72,0xE6,0x08,0xFF,0x73,0x48,0x7F,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC7,0x1A,0xEE,0x48,0xFF,0xF6,0x89,0xFF,0xFE,0x89,0xFF,0xEE,0x48,0xFF,0x39,0xE7,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0x6A,0xE8,0xB8,0xE6,0x09,0xFF,0x42,0x28,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA7,0x2B,0xD5,0xA8,0xFF,0xF6,0x88,0xFF,0x8B,0xC7,0xB5,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x87,0x5D,0xF6,0x89,0xFF,0xF6,0x89,0xFF,0xFE,0xA9,0xFF,0xF6,0x89,0xFF,0x7B,0x47,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA8,0x18,0x94,0x08,0xEB,0xF6,0x69,0xFF,0xDD,0xE9,0xFF,0x29,0x45,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0xB4,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0x9C,0x48,0xD2,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDD,0xA7,0xBE,0xF6,0x89,0xFF,0xF6,0x68,0xFF,0xF6,0x68,0xFF,0xF6,0x89,0xFF,0xD5,0x88,0xFF,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x36,0xB4,0xC8,0xFF,0xFE,0xA8,0xFF,0xF6,0x89,0xFF,0xC5,0x08,0xFF,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8B,0xC7,0xE9,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xB4,0xE8,0xE7,0x39,0xE7,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x87,0x67,0xCD,0x68,0xBE,0xCD,0x68,0xED,0xCD,0x68,0xFF,0xD5,0x88,0xFF,0xDD,0xC8,0xFF,0x52,0x87,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x48,0x5F,0xCD,0x48,0xFF,0xFE,0xC9,0xFF,0xFE,0xA9,0xFF,0xFE,0xA9,0xFF,0x9C,0x27,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xE7,0x88,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFE,0xC9,0xFF,0xF6,0x89,0xFF,0xDD,0x88,0xF4,0x32,0x08,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x4A,0x49,0x8B,0xDD,0xC9,0xFF,0xFE,0xCA,0xFF,0xFE,0xC9,0xFF,0xFE,0xC9,0xFF,0xFE,0x88,0xFF,0x7B,0x67,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x47,0x43,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0x88,0xFF,0xF6,0x89,0xFF,0xF6,0x8A,0xFF,0xED,0xE7,0xFD,0x4A,0x47,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x52,0x68,0xB3,0xF6,0x48,0xFF,0xF6,0xCB,0xFF,0xFE,0xC9,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0x68,0xFF,0x5A,0x87,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x18,0xEE,0x07,0xFF,0xFE,0xA9,0xFF,0xFE,0xA9,0xFF,0xFE,0x88,0xFF,0xCD,0x68,0xFF,0x5A,0xC8,0x7C,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0x5A,0xA9,0x7C,0xB4,0xC8,0xFF,0xFE,0xC9,0xFF,0xFE,0xC9,0xFF,0xFE,0xA9,0xFF,0xEE,0x08,0xFF,0x42,0x07,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xCD,0x68,0xFF,0xFE,0xC9,0xFF,0xD5,0xC8,0xFF,0x73,0x48,0x88,0x2A,0x08,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x06,0x14,0x62,0xC7,0x40,0x7B,0x87,0x6D,0x94,0x27,0xA8,0xA4,0x87,0xCC,0xAC,0xC7,0xDE,0xAC,0xE7,0xE9,0xAC,0xC7,0xC8,0xA4,0x67,0xA6,0x83,0xC8,0x73,0x6B,0x08,0x3B,0x42,0x28,0x16,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x08,0x0C,0x62,0xC8,0x7D,0xC5,0x07,0xFF,0xFE,0xA9,0xFF,0xCD,0x68,0xFF,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x67,0x4C,0x8C,0x08,0x68,0x39,0xC7,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x4A,0x48,0x22,0x83,0xA7,0x8D,0xCD,0xA7,0xFA,0xF6,0xC7,0xFF,0xFF,0x28,0xFF,0xFF,0x28,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x28,0xFF,0xFF,0x49,0xFF,0xFF,0x49,0xFF,0xFE,0xE9,0xFF,0xD5,0xC8,0xF6,
-    0x8C,0x08,0x85,0x52,0x88,0x22,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x7B,0x68,0x38,0xA4,0x67,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x5A,0xA8,0x44,0xD5,0xA8,0xE9,0xFF,0x28,0xFF,0xFF,0x28,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x09,0xFF,0xFF,0x29,0xFF,0xFF,0x29,0xFF,0xD5,0xC9,0xDA,0x4A,0x48,0x41,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x88,0x33,0xD5,0xC8,0xEB,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,
-    0xFF,0x08,0xFF,0xFF,0x09,0xFF,0xFF,0x29,0xFF,0xFF,0x09,0xFF,0xCD,0xA9,0xDE,0x4A,0x68,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0x9C,0x48,0xA8,0xF6,0xC8,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x09,0xFF,0xEE,0xA8,0xFF,0x94,0x08,0x97,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x07,0x79,0x4A,0x67,0x5B,0x39,0xE7,0x19,0x31,0x86,0x05,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x27,0x1D,0xCD,0x87,0xEB,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,
-    0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xC5,0x68,0xE7,0x39,0xE7,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x29,0xC7,0x16,0x31,0xC7,0x42,0x42,0x27,0x82,0x42,0x28,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x47,0x40,0xD5,0x47,0xFF,0xEE,0x29,0xFF,0xD5,0x68,0xFF,0xB4,0xA8,0xFF,0x8B,0xC8,0xF2,0x6A,0xE9,0xD2,
-    0x4A,0x68,0x8A,0x42,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x68,0x36,0xF6,0xA7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFF,0x07,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xEE,0x48,0xFD,0x42,0x08,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x31,0xE7,0x1D,0x42,0x07,0x58,0x62,0xC7,0xB7,0x8B,0xC7,0xFF,0xC4,0xE7,0xFF,0xE5,0xC7,0xFF,0xE5,0xA6,0xFF,0x4A,0x68,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0x88,0x98,0xEE,0x28,0xFF,0xFE,0x8A,0xFF,0xFE,0x69,0xFF,0xFE,0xA9,0xFF,0xFE,0xA9,0xFF,0xF6,0x69,0xFF,0xEE,0x29,0xFF,0xBC,0xE8,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x67,0x3B,0xF6,0x66,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,
-    0xFE,0xE8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xEE,0x67,0xFF,0x4A,0x48,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0x46,0x27,0xE5,0xC8,0xF6,0xED,0xE7,0xFF,0xF6,0x08,0xFF,0xF6,0x08,0xFF,0xF6,0x08,0xFF,0xF6,0x28,0xFF,0xF6,0x08,0xFF,0x63,0x08,0x9D,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x62,0xC7,0xBA,0xF6,0x48,0xFF,0xFE,0xA9,0xFF,0xFE,0x88,0xFF,0xFE,0x89,0xFF,
-    0xFE,0x8A,0xFF,0xFE,0x69,0xFF,0x5A,0xC8,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x27,0x25,0xE6,0x07,0xFF,0xFE,0xE8,0xFF,0xFE,0xC6,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xDE,0x07,0xFF,0x39,0xC7,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xA7,0x45,0xF5,0xE8,0xFF,0xF6,0x08,0xFF,0xF6,0x08,0xFF,0xF6,0x08,0xFF,0xF6,0x28,0xFF,0xFE,0x28,0xFF,0x73,0x48,0xB8,0x04,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x7B,0x47,0xBE,0xF6,0x48,0xFF,0xFE,0x89,0xFF,0xFE,0x68,0xFF,0xFE,0x89,0xFF,0x93,0xE8,0xD4,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x0D,0xCD,0x88,0xF6,0xFE,0xE8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,
-    0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xCD,0x67,0xED,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0xAC,0x47,0xE0,0xF6,0x29,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0x8B,0x88,0xBE,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x9B,0xE7,0xB7,0xF6,0x48,0xFF,0xFE,0xA9,0xFF,
-    0xF6,0x28,0xFF,0x39,0xE8,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xA4,0x87,0xCA,0xFE,0xE8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xF6,0xA7,0xFF,0x94,0x07,0xAB,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC8,0x23,0xED,0xA8,0xFF,0xF6,0x29,0xFF,0xF6,0x28,0xFF,0xA4,0x27,0xB7,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,0xAC,0x67,0xAF,0xFE,0xA8,0xFF,0x83,0x88,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x68,0x55,0xFE,0xE8,0xFF,0xFE,0xE9,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0x88,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,
-    0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0x52,0x88,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9B,0xE7,0x85,0xF6,0x29,0xFF,0xBC,0xA7,0xAF,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0xA4,0x67,0x95,
-    0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0xD5,0xA7,0xFF,0xFE,0xE9,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xD5,0x87,0xED,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xB4,0x87,0x95,0x04,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x07,0x73,0xFE,0xE7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,
-    0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0x7B,0x68,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x49,0x07,0xCD,0x47,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC8,0xFF,0xD5,0x88,0xED,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xE8,0x48,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,
-    0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC9,0xFF,0x6B,0x08,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x67,0xD0,0xFE,0xC8,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xBC,0xE8,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xC7,0x12,0xD5,0x86,0xFF,0xFE,0xA8,0xFF,0xFE,0x87,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x88,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,
-    0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x68,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x68,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xE6,0x08,0xFF,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x42,0x08,0x70,0xF6,0x27,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x87,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x68,0xFF,0x4A,0x68,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0A,0x73,0x07,0xFF,0xFE,0xA6,0xFF,0xFE,0x87,0xFF,0xFE,0x89,0xFF,0xFE,0xCD,0xFF,0xFF,0x11,0xFF,0xFF,0x34,0xFF,0xFF,0x34,0xFF,0xFF,0x34,0xFF,0xFF,0x33,0xFF,0xFE,0xEF,0xFF,0xFE,0xCC,0xFF,0xFE,0x88,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x48,0xFF,
-    0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0x83,0xA8,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x4A,0x49,0x07,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x31,0xA7,0xA8,0xAC,0x8B,0xFF,0xFF,0x98,0xFF,0xFF,0xBC,0xFF,0xFF,0xDE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xDC,0xFF,0xFF,0x54,0xFF,0xFE,0xAB,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x48,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x48,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x48,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0xBC,0xC8,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xE8,0x93,0x52,0x67,0x4C,0x31,0x89,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x32,0x08,0x18,0x7B,0x28,0x60,0xC4,0xC7,0xD4,0xE5,0xE7,0xFF,0x9C,0x07,0xFF,0x21,0xC9,0x0D,0x7B,0xEF,0x83,0xDE,0xFA,0xFF,0xF7,0xDD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0x9A,0xFF,0xFE,0xCE,0xFF,0xFE,0x68,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,
-    0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x48,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x48,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xDD,0x88,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x68,0xE5,0xF5,0xC9,0xFF,0xD5,0x08,0xFF,0x8B,0x88,0xB1,0x39,0xE7,0x31,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x6A,0xC8,0x4D,0xB4,0x47,0xE0,0xED,0xA7,0xFF,0xFE,0x27,0xFF,0xFE,0x06,0xFF,0xFE,0x06,0xFF,0xD5,0xD1,0xFF,0xDE,0x9A,0xFF,0xFF,0xBE,0xFF,
-    0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x78,0xFF,0xFE,0x8C,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x28,0xFF,0xFE,0x47,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xED,0xE8,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x28,0xF8,0xF5,0xE9,0xFF,0xF5,0xE8,0xFF,0xFD,0xE8,0xFF,0xED,0xA8,0xFF,0xB4,0x68,0xFA,0x6A,0xE7,0x7A,0x42,0x06,0x18,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x46,0x26,0xDD,0x47,0xF2,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFF,0x37,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xFE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0x11,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,
-    0xFE,0x27,0xFF,0xFE,0x28,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x28,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xF6,0x08,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x08,0xFD,0xFD,0xE8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xA7,0xFF,0xF5,0xA7,0xFF,0xFD,0xC7,0xFF,0xED,0x68,0xFF,0xA3,0xE7,0xDA,0x42,0x08,0x4C,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x48,0x77,0xBC,0x88,0xFF,0xFD,0xE7,0xFF,0xF5,0xC6,0xFF,0xFD,0xE7,0xFF,0xFE,0x29,0xFF,0xF7,0x7C,0xFF,0xFF,0xDE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,
-    0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0x77,0xFF,0xFE,0x47,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x08,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x27,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x48,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xFE,0x48,0xFF,0xF6,0x28,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xE8,0xE9,0xF5,0xE8,0xFF,0xF5,0xA7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xF5,0xA7,0xFF,0xF5,0x87,0xFF,0xC4,0x67,0xE7,0x62,0xA7,0x51,0x21,0x29,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC8,0x1B,0x4A,0x69,0xD2,0x73,0x09,0xFF,0xE5,0xAD,0xFF,0xFF,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0x58,0xFF,0xFE,0x28,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,
-    0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x27,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x27,0xFF,0xFE,0x28,0xFF,0xF5,0xC7,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xC7,0xA4,0xF5,0xE8,0xFF,0xF5,0xA7,0xFF,0xF5,0x87,0xFF,0xC4,0x87,0xFF,0x6A,0xC7,0xAB,0x39,0xE7,0x29,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x08,0x4F,0x42,0x49,0xFF,0xD6,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,
-    0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xBE,0xFF,0xFF,0xBF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0x16,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x08,0xFF,0xFE,0x07,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x27,0xFF,0xFE,0x28,0xFF,0xE5,0x67,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x07,0x15,0xDD,0x27,0xB5,0x93,0x86,0x9A,0x52,0x47,0x46,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x49,0xAA,0xD6,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xF7,0xDD,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFE,0xF3,0xFF,0xFE,0x07,0xFF,0xFE,0x08,0xFF,0xFE,0x2A,0xFF,0xFE,0x4B,0xFF,0xFE,0x4B,0xFF,0xFE,0x4B,0xFF,
-    0xFE,0x29,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x28,0xFF,0xFE,0x07,0xFF,0xFE,0x28,0xFF,0xC4,0xC8,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA6,0x0E,0xA5,0x34,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,
-    0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBD,0xFF,0xFF,0x38,0xFF,0xFF,0x9D,0xFF,0xFF,0xDF,0xFF,0xF7,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0x7B,0xFF,0xFE,0xF5,0xFF,0xFE,0x4C,0xFF,0xFE,0x28,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x07,0xFF,0xFE,0x28,0xFF,0x93,0x87,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x2D,0x86,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDD,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,
-    0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xDE,0xFF,0xF7,0xBE,0xFF,0xFF,0x9B,0xFF,0xFE,0xB1,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x08,0xFF,0x4A,0x28,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x28,0x0B,0xCE,0x59,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xDE,0xFF,
-    0xFF,0xBE,0xFF,0xF7,0xDE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBD,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0x5A,0xFF,0xFE,0x6D,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE7,0xFF,0xFD,0xE8,0xFF,0xE5,0x87,0xFF,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0xCF,0x6D,0xFF,0xDE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBD,0xFF,0xFF,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBD,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,0xFF,0x9E,0xFF,0xF7,0xBD,0xFF,0xF7,0xBD,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0xBD,0xFF,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,
-    0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFE,0x90,0xFF,0xFD,0xE8,0xFF,0xFD,0xC8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE7,0xFF,0xFE,0x08,0xFF,0xC4,0x87,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0xCE,0x58,0xF8,0xFF,0xDE,0xFF,0xFF,0xBD,0xFF,0xFF,0xBE,0xFF,0xF7,0xBD,0xFF,0xF7,0xBD,0xFF,0xFF,0x9E,0xFF,0xF7,0xBD,0xFF,0xF7,0xBD,0xFF,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,
-    0xF7,0xBD,0xFF,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,0xF7,0xBD,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,0xF7,0xBD,0xFF,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,0xF7,0x9E,0xFF,0xF7,0xBD,0xFF,0xF7,0xBD,0xFF,0xF7,0x9E,0xFF,0xF7,0xBD,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0xBD,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0xBD,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0xBD,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0xBE,0xFF,0xFE,0xD3,0xFF,0xFD,0xC8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE8,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0x6A,0xC7,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAB,0x2A,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0xBD,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFF,0x9D,0xFF,0xFF,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFF,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,
-    0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFE,0xB3,0xFF,0xFD,0xE8,0xFF,0xFD,0xC7,0xFF,0xFD,0xE8,0xFF,0xDD,0x27,0xFF,0x29,0x68,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x71,0x80,0xFF,0xBD,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFF,0x9D,0xFF,0xF7,0x9D,0xFF,0xFF,0x9D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,
-    0xF7,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFF,0x9E,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFF,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFE,0x8F,0xFF,0xFD,0xC8,0xFF,0xFD,0xE7,0xFF,0x83,0x47,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x17,0xE5,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,
-    0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x5B,0xFF,0xFE,0x0A,0xFF,0xCC,0x87,0xFF,0x39,0xC7,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9C,0x08,0x85,0x2A,0xA5,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xE6,0xFB,0xFF,0xF7,0x9D,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xFF,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,
-    0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xFF,0x16,0xFF,0x4A,0x27,0xFF,0x31,0x86,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x86,0x58,0xF5,0xC8,0xFF,0xC4,0xA8,0xCE,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,0x39,0xC8,0x52,0xEF,0x3C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9C,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9C,0xFF,0xF7,0x9D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x9D,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7D,0xFF,0xF7,0x9C,0xFF,0xF7,0x9C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,
-    0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5D,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xEF,0x7C,0xFF,0x52,0xAA,0xFF,0x31,0xA6,0x13,0x00,0x00,0x00,0x21,0xA7,0x21,0xE5,0x07,0xFF,0xFD,0xC8,0xFF,0xFD,0xA8,0xFF,0xC4,0x88,0xC6,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x5A,0xCB,0x2B,0x94,0xB2,0x7F,0xBD,0xF7,0xCC,0xD6,0x99,0xFA,0xDE,0xDA,0xFF,0xE6,0xFA,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,
-    0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x3C,0xFF,0xEF,0x5C,0xFF,0xA5,0x13,0xFF,0x31,0xA7,0x34,0x31,0x87,0x23,0x7B,0x27,0xF6,0xF5,0xA8,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xF5,0xA8,0xFF,0x8B,0x88,0xBE,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x84,0x10,0x56,0xCE,0x38,0xF2,0xEF,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,
-    0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5C,0xFF,0xE6,0xFA,0xFF,0x42,0x29,0xFF,0x52,0x47,0xFF,0xF5,0x88,0xFF,0xFD,0xC9,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xFD,0xC9,0xFF,0xFD,0xC8,0xFF,0x7B,0x48,0xAA,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x8E,0x30,0xD6,0x99,0xEB,0xF7,0x9D,0xFF,0xF7,0x9D,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5D,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7D,0xFF,
-    0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xF7,0x5C,0xFF,0x73,0x6D,0xFF,0x6A,0xC7,0xFF,0xCC,0xA8,0xFF,0xE5,0x28,0xFF,0xF5,0x88,0xFF,0xFD,0xC8,0xFF,0xFD,0xA8,0xFF,0xFD,0xCA,0xFF,0xFD,0xA9,0xFF,0x73,0x28,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xAD,0x34,0x8E,0xFF,0xDE,0xFF,0xF7,0x9D,0xFF,0xF7,0x7D,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,
-    0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5B,0xFF,0xF7,0x3C,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xF7,0x5C,0xFF,0x8C,0x2F,0xFF,0x31,0xA7,0x43,0x29,0xE8,0x26,0x29,0xC8,0x37,0x42,0x28,0x64,0x7B,0x07,0xC2,0xBC,0x27,0xFF,0xED,0x28,0xFF,0xF5,0x89,0xFF,0xED,0x89,0xFF,0x5A,0x88,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0xC6,0x16,0xC8,0xF7,0x9D,0xFF,0xF7,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x7C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5B,0xFF,0xF7,0x3C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,
-    0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5B,0xFF,0xF7,0x5C,0xFF,0xF7,0x5B,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xEF,0x5C,0xFF,0xEF,0x5B,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x3C,0xFF,0xEF,0x5C,0xFF,0xF7,0x3C,0xFF,0xEF,0x3C,0xFF,0xEF,0x3C,0xFF,0xEF,0x3B,0xFF,0xEF,0x5C,0xFF,0xEF,0x3B,0xFF,0xF7,0x3C,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xF7,0x5C,0xFF,0xA4,0xF2,0xFF,0x31,0xA6,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x39,0xE8,0x19,0x39,0xE7,0x3D,0x52,0x88,0x64,0x6A,0xC8,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0xCE,0x16,0xDC,0xF7,0x7C,0xFF,0xEF,0x5B,0xFF,0xF7,0x5B,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xF7,0x3C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xEF,0x5C,0xFF,0xEF,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xF7,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x5C,0xFF,0xF7,0x3C,0xFF,0xF7,0x3B,0xFF,0xEF,0x3C,0xFF,0xEF,0x3B,0xFF,0xF7,0x3C,0xFF,0xEF,0x3C,0xFF,
-    0xEF,0x3B,0xFF,0xEF,0x3C,0xFF,0xEF,0x3C,0xFF,0xEF,0x3B,0xFF,0xF7,0x3C,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xF7,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xC5,0xD5,0xFF,0x4A,0x49,0xFD,0x39,0xE7,0x56,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xBD,0xB5,0xD6,0xF7,0x5B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5C,0xFF,0xEF,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x5C,0xFF,0xEF,0x5B,0xFF,0xF7,0x3C,0xFF,0xF7,0x3C,0xFF,0xEF,0x3B,0xFF,0xEF,0x5B,0xFF,0xF7,0x3C,0xFF,0xEF,0x3C,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5B,0xFF,0xEF,0x3C,0xFF,0xEF,0x5B,0xFF,
-    0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5C,0xFF,0xEF,0x5B,0xFF,0xEF,0x5C,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5C,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5C,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5C,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3C,0xFF,0xEF,0x5C,0xFF,0xEF,0x3B,0xFF,0xBD,0xD6,0xFF,0x73,0x8E,0xBC,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8C,0x50,0x9D,0xF7,0x7C,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xF7,0x3C,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3C,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3C,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,
-    0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5C,0xFF,0xEF,0x5C,0xFF,0xF7,0x7C,0xFF,0xF7,0x9D,0xFF,0xCE,0x38,0xEF,0x5A,0xCC,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x38,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3A,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,
-    0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x5B,0xFF,0xEF,0x5C,0xFF,0xEF,0x3B,0xFF,0x7B,0xCF,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xAD,0x33,0xED,0xF7,0x5B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3A,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,
-    0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0x84,0x10,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x6A,0x3D,0xE6,0xFA,0xFF,0xEF,0x3B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,
-    0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0x6B,0x4D,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x70,0xBA,0xF7,0x3B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,
-    0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xE6,0xFA,0xFF,0xEF,0x1A,0xFF,0xD6,0x78,0xFA,0x3A,0x69,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xC5,0xF6,0xFF,0xF7,0x3B,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,
-    0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xE6,0xFA,0xFF,0xE6,0xFA,0xFF,0xE6,0xD9,0xFF,0xEE,0xFA,0xFF,0xA4,0xD2,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x08,0x10,0xDE,0x98,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xE6,0xFA,0xFF,0xEE,0xFA,0xFF,
-    0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xE6,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xF9,0xFF,0xDE,0x98,0xFF,0x42,0x69,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x69,0x1E,0xE6,0xF9,0xFF,0xEF,0x1A,0xFF,0xEF,0x1A,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,
-    0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xF9,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xF9,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xDA,0xFF,0xE6,0xF9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xDA,0xFF,0x94,0x70,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xEA,0x29,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xF9,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xFA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xF9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,
-    0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xE6,0xB9,0xFF,0xEE,0xD9,0xFF,0xC5,0xF6,0xFD,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x2C,0x2D,0xEE,0xF9,0xFF,0xEE,0xF9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xDA,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,
-    0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xB9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xD9,0xFF,0xEE,0xB9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xB9,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xB9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xDE,0x78,0xFF,0x31,0x87,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x2B,0x29,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xD9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xD8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xD9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,
-    0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0x4A,0x28,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xCB,0x1F,0xEE,0xD8,0xFF,0xEE,0xD9,0xFF,0xEE,0xD9,0xFF,0xE6,0xD9,0xFF,0xEE,0xD9,0xFF,0xEE,0xB9,0xFF,0xEE,0xD9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xD9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,
-    0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xD9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xD9,0xFF,0x5A,0xEB,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x69,0x14,0xE6,0xB8,0xFF,0xEE,0xB8,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB8,0xFF,0xEE,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xEE,0xB9,0xFF,0xE6,0xB8,0xFF,0xEE,0xB8,0xFF,0xEE,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,
-    0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xE6,0xB9,0xFF,0xE6,0xB8,0xFF,0xE6,0xD9,0xFF,0x63,0x0B,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0xD6,0x36,0xFF,0xEE,0xB8,0xFF,0xEE,0x98,0xFF,0xEE,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xEE,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB9,0xFF,0xEE,0xB9,0xFF,0xE6,0xB8,0xFF,0xEE,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xEE,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xEE,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,
-    0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0xB9,0xFF,0x5A,0xAA,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0x74,0xE9,0xEE,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0xE6,0x98,0xFF,0xEE,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xEE,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x97,0xFF,0xE6,0x97,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x97,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x97,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,
-    0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0x42,0x28,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x0E,0x70,0xEE,0xB8,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,
-    0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x97,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x97,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xD6,0x37,0xFF,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x69,0x1D,0xDE,0x57,0xFF,0xE6,0x78,0xFF,0xE6,0x97,0xFF,0xE6,0x77,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,
-    0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB9,0xFF,0xB5,0x53,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xA4,0xB1,0xD0,0xEE,0x98,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,
-    0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xE6,0x98,0xFF,0xE6,0xB8,0xFF,0x7B,0x8D,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x6A,0x2F,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,
-    0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x78,0xFF,0xE6,0x78,0xFF,0xE6,0x98,0xFF,0xCD,0xF6,0xFF,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xCE,0xA6,0xEE,0x98,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x57,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,
-    0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x98,0xFF,0x7B,0xCE,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0xBD,0x53,0xEB,0xE6,0x77,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x56,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,
-    0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x57,0xFF,0xE6,0x57,0xFF,0xE6,0x77,0xFF,0xB5,0x12,0xE5,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x28,0x12,0xC5,0x94,0xF6,0xE6,0x57,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,
-    0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xDE,0x36,0xFF,0xE6,0x36,0xFF,0xDE,0x16,0xFF,0xE6,0x16,0xFF,0xDE,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xDE,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x57,0xFF,0xD5,0xD5,0xFF,0x42,0x2A,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x69,0x14,0xC5,0x53,0xE7,0xEE,0x57,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x16,0xFF,0xDE,0x16,0xFF,0xE6,0x15,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x16,0xFF,0xE6,0x15,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x15,0xFF,0xE6,0x16,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xDE,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xDE,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x16,0xFF,
-    0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x16,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x16,0xFF,0xDE,0x16,0xFF,0xDE,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xE6,0x15,0xFF,0xDE,0x15,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDE,0x15,0xFF,0xE6,0x36,0xFF,0xD5,0xD4,0xFF,0x4A,0x4A,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0xA4,0x90,0xB8,0xEE,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x16,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE5,0xF5,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,
-    0xE5,0xF5,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE6,0x15,0xFF,0xE5,0xF5,0xFF,0xE6,0x15,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xDE,0x15,0xFF,0xDE,0x15,0xFF,0xDD,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xE6,0x36,0xFF,0xC5,0x53,0xF8,0x3A,0x09,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x6B,0x2C,0x42,0xCD,0x93,0xF8,0xE6,0x56,0xFF,0xE6,0x36,0xFF,0xE6,0x16,0xFF,0xE6,0x15,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,
-    0xE5,0xF5,0xFF,0xDD,0xF4,0xFF,0xE5,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF5,0xFF,0xDD,0xF4,0xFF,0xDD,0xF4,0xFF,0xDD,0xF4,0xFF,0xDD,0xF5,0xFF,0xDD,0xD5,0xFF,0xDD,0xF5,0xFF,0xE6,0x15,0xFF,0xD5,0xD4,0xFF,0x83,0xCE,0xCC,0x31,0xA9,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x7B,0x6D,0x60,0xB4,0xF2,0xEF,0xDD,0xD4,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE6,0x15,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE6,0x15,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,
-    0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xE5,0xF5,0xFF,0xDD,0xD4,0xFF,0xC5,0x52,0xFF,0x94,0x0F,0xFF,0x42,0x49,0x82,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x08,0x10,0x6B,0x0B,0x2C,0x8B,0xEE,0x49,0xA4,0x4F,0x65,0xAC,0x90,0x7C,0xAC,0xB0,0x90,0xAC,0xB0,0x9F,0xAC,0xD1,0xAD,0xAC,0xD0,0xB7,0xAC,0xD1,0xBE,0xAC,0xD0,0xC4,0xAC,0xB1,0xCA,0xAC,0xB1,0xCC,0xAC,0xD1,0xCE,0xAC,0xD1,0xCE,0xAC,0xD1,0xCE,0xAC,0xD1,0xCE,0xAC,0xB1,0xCC,0xAC,0xB1,0xCA,0xAC,0xD1,0xC8,0xAC,0xB1,0xC6,0xAC,0xB0,0xC2,0xAC,0xB0,0xC0,0xAC,0xB1,0xBC,0xAC,0xD1,0xB8,0xAC,0xB0,0xB5,0xAC,0xB1,0xB1,0xAC,0xB1,0xAD,0xAC,0xB0,0xAA,0xAC,0xB1,0xA6,0xAC,0xB1,0xA3,0xAC,0xB1,0x9D,0xAC,0xB1,0x9A,0xAC,0xB0,0x97,0xAC,0xB0,0x93,0xAC,0xB0,0x8E,0xAC,0xB1,0x8B,0xAC,0xB0,0x88,0xAC,0xB0,0x85,0xAC,0xB0,0x80,0xAC,0xB0,0x7D,0xAC,0xB1,0x7A,0xAC,0xB0,0x77,0xAC,0xB0,0x73,0xAC,0xB0,0x70,0xAC,0xB0,0x6D,0xAC,0xB0,0x6B,0xAC,0xB0,0x67,0xAC,0xB0,0x64,0xAC,0xB0,0x61,
-    0xAC,0xB0,0x5F,0xAC,0xB0,0x5B,0xAC,0xB0,0x58,0xAC,0xB0,0x56,0xAC,0xB0,0x54,0xAC,0xB0,0x50,0xAC,0x90,0x4E,0xAC,0xB0,0x4C,0xAC,0xB1,0x49,0xAC,0xB0,0x46,0xAC,0x90,0x44,0xA4,0x70,0x42,0x9C,0x2F,0x40,0x83,0x8D,0x3D,0x52,0x8A,0x3B,0x31,0xA7,0x39,0x29,0x66,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_partlycloud_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_partlycloud_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_partlycloud_png_data
-};
-
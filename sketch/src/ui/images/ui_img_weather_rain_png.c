@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/rain.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_rain_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,0x29,0x87,0x1E,0x4A,0x6B,0x47,0x7C,0x11,0x70,0x9D,0x56,0x92,0xBE,0x59,0xAD,0xCE,0xDB,0xC2,0xD6,0xFC,0xCE,0xD6,0xFC,0xD6,0xD6,0xFC,0xD2,0xD6,0xDB,0xC2,0xCE,0x7A,0xA4,0xB5,0xD8,0x7D,0x8C,0xD3,0x4D,0x63,0x4E,0x1D,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x29,0x65,0x0B,0x42,0x6A,0x7C,0x84,0x72,0xFD,0xBE,0x39,0xFF,0xD6,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xDF,0x1D,0xFF,0xDF,0x1D,0xFF,0xDF,0x1D,0xFF,0xDF,0x3D,0xFF,0xDF,0x1C,0xFF,0xCE,0x9B,0xFF,0xAD,0x76,0xAD,0x63,0x4E,0x30,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x6B,0x5A,0x94,0xF4,0xFF,0xCE,0xDB,0xFF,0xDF,0x3C,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1D,0xFF,0xDF,0x3D,0xFF,0xE7,0x3D,0xFF,0xBE,0x18,0xED,0x6B,0x6F,0x46,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x0C,0x7C,0x11,0xC4,0xCE,0xDB,0xFF,
-    0xDF,0x3D,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xD6,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x3D,0xFF,0xE7,0x5D,0xFF,0xAD,0x96,0xD8,0x4A,0x4A,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0x20,0xB5,0xF8,0xF4,0xE7,0x5D,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xD7,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x3D,0xFF,0xD6,0xFC,0xFF,0x63,0x4E,0x7F,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xCC,0x28,0xCE,0xBA,0xFF,0xDF,0x3D,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,
-    0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xDE,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0x84,0x31,0xC2,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xEC,0x1E,0xCE,0xBA,0xFF,0xDF,0x3C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0x7C,0x31,0xD2,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAD,0x0C,0xC6,0x7A,0xF4,0xDF,0x1C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,
-    0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDB,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0x63,0x6E,0xFD,0x31,0xA7,0x65,0x31,0xA6,0x17,0x52,0xAA,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xBE,0x38,0xCA,0xDF,0x3C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDB,0xFF,0xCE,0xDC,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0x52,0xCB,0xFF,0x42,0x29,0xFF,0x5B,0x0D,0xFF,0x73,0xD0,0xFF,
-    0x7C,0x31,0xF4,0x7C,0x10,0xD8,0x6B,0xAF,0xA6,0x5B,0x0D,0x70,0x42,0x4A,0x39,0x39,0xC7,0x12,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x35,0x6F,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,
-    0xD6,0xDB,0xFF,0xD6,0xDC,0xFF,0xD6,0xDC,0xFF,0xCE,0xDB,0xFF,0xD6,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xD6,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xD6,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xD6,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDB,0xFF,0xD6,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xD6,0xFC,0xFF,0xD6,0xDB,0xFF,0xCE,0xDB,0xFF,0xD6,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xCE,0xBB,0xFF,0xBE,0x39,0xFF,0x8C,0xB3,0xE7,0x4A,0x8B,0x4A,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x4E,0x16,0xD6,0xFC,0xFF,0xD6,0xDC,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDC,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDC,0xFF,0xCE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xD6,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,
-    0xD6,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFC,0xFF,0xCE,0x9A,0xFF,0x9D,0x35,0xDC,0x4A,0xCC,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xB6,0x18,0xC4,0xD6,0xFC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,
-    0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,0xCE,0xDB,0xFF,0xC6,0x7A,0xFF,0x7C,0x11,0x5F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x8E,0x2D,0xD7,0x1C,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,
-    0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xCE,0xBB,0xFF,0x9D,0x55,0x95,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xAD,0xB7,0xD4,0xCE,0xDB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,
-    0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xC6,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0x9B,0xFF,0xCE,0xBB,0xFF,0xCE,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0xBB,0xFF,0xB5,0xF8,0xA4,0x00,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xCC,0x22,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0x9B,0xFF,0xCE,0xBB,0xFF,0xCE,0x9B,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0x9B,0xFF,0xC6,0x9B,0xFF,0xCE,0xBB,0xFF,0xC6,0xBA,0xFF,0xCE,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xCE,0x9B,0xFF,0xC6,0xBA,0xFF,0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,
-    0xCE,0x9A,0xFF,0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0xBB,0xFF,0xA5,0x76,0x9F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x31,0x9F,0xD6,0xDB,0xFF,0xCE,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0xBB,0xFF,0xCE,0x9B,0xFF,0xCE,0xBB,0xFF,0xCE,0xBB,0xFF,0xCE,0x9B,0xFF,0xC6,0x9A,0xFF,
-    0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,0xC6,0x9A,0xFF,0xCE,0x9B,0xFF,0xCE,0x9B,0xFF,0xC6,0x9B,0xFF,0xCE,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7B,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xCE,0xBB,0xFF,0x8C,0x92,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0xA5,0x76,0xFF,0xCE,0xBB,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,
-    0xC6,0x7B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0x5A,0xED,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC8,0x45,0xBE,0x39,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,
-    0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x9A,0xFF,0xC6,0x9B,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x5A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xCE,0x9B,0xFF,0xAD,0xB7,0xF6,0x21,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x29,0x86,0x35,0x42,0x29,0xFA,0xBE,0x5A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7B,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7B,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,
-    0xBE,0x7A,0xFF,0xC6,0x5A,0xFF,0xC6,0x5A,0xFF,0xBE,0x79,0xFF,0xC6,0x5A,0xFF,0xC6,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xC6,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0x5B,0x2E,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x4A,0x6A,0x3C,0x63,0x8E,0x9A,0x84,0x92,0xE0,0x95,0x15,0xFF,0xA5,0x76,0xFF,0xAD,0xD7,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,
-    0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xC6,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xC6,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xC6,0x5A,0xFF,0xC6,0x7A,0xFF,0xC6,0x9A,0xFF,0xA5,0x97,0xFF,0x29,0x68,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xCA,0x09,0x63,0x8E,0x7C,0x9D,0x56,0xFF,0xBE,0x59,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x7B,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x5A,0xFF,0xC6,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,
-    0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xC6,0x5A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0x42,0x4A,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x63,0x6F,0x5A,0xB5,0xF8,0xFD,0xCE,0xDB,0xFF,0xC6,0x9B,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,
-    0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x3A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x7A,0xFF,0xC6,0x9A,0xFF,0x6B,0x8F,0xAF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x69,0x0D,0xA5,0x76,0xC4,0xC6,0x9A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x39,0xFF,0xBE,0x3A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xB6,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x3A,0xFF,0xB6,0x59,0xFF,0xBE,0x3A,0xFF,
-    0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0x8C,0xB3,0xFF,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xEC,0x23,0xAD,0xD8,0xF6,0xC6,0x9A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xC6,0x7A,0xFF,0xBE,0x5A,0xFF,0xC6,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x3A,0xFF,
-    0xBE,0x3A,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0xBE,0x39,0xFF,0xBE,0x3A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x3A,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0x9D,0x76,0xFF,0x31,0xC7,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xED,0x33,0xB6,0x18,0xFF,0xBE,0x7A,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x5A,0xFF,0xBE,0x5A,0xFF,0xBE,0x39,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x3A,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x3A,0xFF,0xBE,0x39,0xFF,0xBE,0x3A,0xFF,0xBE,0x3A,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x3A,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,
-    0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xAD,0xD8,0xFF,0x3A,0x4A,0xFF,0x29,0xA7,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x4A,0x29,0xB5,0xF8,0xFF,0xBE,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xBE,0x3A,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,
-    0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xAD,0xD8,0xFF,0x84,0x73,0xFF,0x4A,0x8B,0x93,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x0D,0xAD,0xD7,0xF8,0xBE,0x5A,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x19,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,
-    0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xB6,0x18,0xFF,0xB5,0xF9,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xB6,0x18,0xFF,0xB6,0x19,0xFF,0xB5,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xB6,0x19,0xFF,0xB6,0x18,0xFF,0x9D,0x55,0xEF,0x42,0x2A,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x7C,0x31,0xC2,0xBE,0x7A,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,
-    0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xB5,0xF9,0xFF,0xB5,0xF9,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xB5,0xF9,0xFF,0xB5,0xF8,0xFF,0xB5,0xF9,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAE,0x18,0xFF,0xAD,0xF8,0xFF,0x73,0xD0,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xAB,0x3D,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x18,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xAE,0x18,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xAE,0x18,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xAE,0x19,0xFF,0xB6,0x19,0xFF,0xAE,0x19,0xFF,0xAD,0xF9,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAE,0x18,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,
-    0xAD,0xF8,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xB6,0x18,0xFF,0xB6,0x19,0xFF,0x7C,0x51,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x84,0x92,0xE9,0xBE,0x59,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB6,0x18,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xB5,0xF8,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xB5,0xF9,0xFF,0xB6,0x19,0xFF,0xB6,0x19,0xFF,0xB5,0xF9,0xFF,0xB5,0xF9,0xFF,0xB6,0x19,0xFF,0xB6,0x18,0xFF,0xB5,0xF9,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,
-    0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xAE,0x19,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xB5,0xF9,0xFF,0xAE,0x18,0xFF,0xAD,0xF9,0xFF,0xAE,0x19,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xB5,0xF9,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xB5,0xF9,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xB6,0x19,0xFF,0x74,0x11,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x09,0x2A,0xAD,0xF8,0xFF,0xB6,0x19,0xFF,0xB6,0x18,0xFF,0xB5,0xF8,0xFF,0xB5,0xF9,0xFF,0xB6,0x19,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xB5,0xF9,0xFF,0xAD,0xF8,0xFF,0xB5,0xF8,0xFF,0xB5,0xF9,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xB5,0xF9,0xFF,0xB5,0xF8,0xFF,0xB5,0xF9,0xFF,0xB5,0xF8,0xFF,0xAD,0xF8,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,
-    0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xB5,0xF8,0xFF,0xAD,0xF8,0xFF,0xB6,0x39,0xFF,0x52,0xCC,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8F,0x85,0xB6,0x19,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,
-    0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xB8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xF8,0xFF,0xA5,0x96,0xF6,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0xB3,0xE9,0xB6,0x19,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xB8,0xFF,
-    0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xA5,0xB8,0xFF,0xAD,0xB8,0xFF,0xA5,0xD8,0xFF,0xAD,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xD7,0xFF,0xA5,0xB8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xAD,0xB8,0xFF,0xAD,0xD7,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xB5,0xF8,0xFF,0x6B,0xAF,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x9D,0x56,0xFF,0xAD,0xF8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,
-    0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xA5,0xD8,0xFF,0xAD,0xB8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xB8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xB8,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xAD,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xAD,0xB8,0xFF,0xA5,0xB7,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB7,0xFF,0xAD,0xB7,0xFF,0xAD,0xB8,0xFF,0xAD,0xB7,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0x9D,0x35,0xFF,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0xAA,0x06,0xA5,0x96,0xFF,0xAD,0xD8,0xFF,0xAD,0xD8,0xFF,0xAD,0xB8,0xFF,0xAD,0xD8,0xFF,0xA5,0xB8,0xFF,0xAD,0xB7,0xFF,0xAD,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xD8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xD8,0xFF,0xA5,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xAD,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xAD,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,
-    0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xAD,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xAD,0xB8,0xFF,0x52,0xCC,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xCA,0x09,0xA5,0x97,0xFF,0xA5,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB8,0xFF,0xAD,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xAD,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,
-    0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xAD,0xD8,0xFF,0x73,0xF0,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xCA,0x09,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB8,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x98,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,
-    0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0xB7,0xFF,0x84,0x93,0xFD,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x9D,0x76,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,
-    0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x96,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0x94,0xF5,0xFF,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x9D,0x56,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x77,0xFF,0x9D,0x77,0xFF,0xA5,0x77,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0xA5,0x77,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0xA5,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0xA5,0x77,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x96,0xFF,
-    0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x95,0x15,0xFF,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0x15,0xF4,0x9D,0x77,0xFF,0xA5,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,
-    0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x97,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x76,0xFF,0x9D,0x56,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x95,0x15,0xFF,0x29,0x4A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x93,0xB1,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x57,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x57,0xFF,0x9D,0x76,0xFF,0x9D,0x56,0xFF,0x9D,0x57,0xFF,0x9D,0x76,0xFF,0x9D,0x56,0xFF,0x9D,0x57,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x57,0xFF,0x9D,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x76,0xFF,0x9D,0x56,0xFF,0x9D,0x76,0xFF,0x9D,0x56,0xFF,
-    0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x76,0xFF,0x9D,0x57,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x8C,0xF5,0xFF,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xAF,0x5C,0x9D,0x76,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,
-    0x95,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x9D,0x77,0xFF,0x84,0x93,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x6B,0x1D,0x95,0x36,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x36,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x9D,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,
-    0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x9D,0x77,0xFF,0x73,0xF1,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x7C,0x73,0xE9,0x9D,0x56,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x9D,0x36,0xFF,0x9D,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x56,0xFF,
-    0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x35,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x35,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x35,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x56,0xFF,0x5B,0x0D,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xEC,0x52,0x95,0x56,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x35,0xFF,0x95,0x36,0xFF,0x95,0x36,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x35,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,
-    0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x35,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x35,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x8D,0x16,0xFF,0x8D,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x16,0xFF,0x84,0xB4,0xE9,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x7C,0x52,0xE9,0x95,0x56,0xFF,0x95,0x16,0xFF,0x95,0x35,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x8D,0x16,0xFF,0x95,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,
-    0x8D,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x16,0xFF,0x95,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x16,0xFF,0x8D,0x16,0xFF,0x8D,0x15,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x16,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x95,0x15,0xFF,0x8C,0xF5,0xFF,0x8D,0x15,0xFF,0x95,0x15,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8D,0x16,0xFF,0x5B,0x4E,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x4A,0x2A,0x8C,0xF5,0xFF,0x95,0x16,0xFF,0x95,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,
-    0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x84,0x93,0xE5,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x0D,0x6D,0x8D,0x15,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,
-    0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xF5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x84,0xD5,0xFF,0x8C,0xF5,0xFF,0x4A,0x8C,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x63,0x6E,0x85,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x8C,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xF5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x84,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x84,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,
-    0x8C,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x8C,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x84,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8C,0xD4,0xFF,0x8C,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xF5,0xFF,0x63,0x6F,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x5B,0x4D,0x76,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,
-    0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xD4,0xFF,0x8C,0xD5,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD5,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x8C,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x63,0xAF,0x8D,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xAB,0x44,0x7C,0x73,0xFF,0x84,0xD5,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,
-    0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x5B,0x4E,0x7C,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x08,0x17,0x63,0xAF,0xE2,0x7C,0x93,0xFF,0x84,0xB4,0xFF,0x7C,0xB4,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0xB4,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,
-    0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0x94,0xFF,0x84,0xB4,0xFF,0x84,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x84,0x94,0xFF,0x84,0x93,0xFF,0x84,0x93,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0x94,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xD4,0xFF,0x74,0x52,0xF8,0x4A,0xAB,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x3A,0x09,0xA4,0x63,0x8F,0xFF,0x7C,0x93,0xFF,0x84,0xB4,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x93,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x74,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x84,0xB4,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x74,0xFF,0x7C,0x74,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x74,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,0x7C,0x93,0xFF,
-    0x7C,0x93,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x73,0xFF,0x7C,0x93,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x7C,0x94,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x84,0x94,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x84,0xB4,0xFF,0x7C,0x52,0xF8,0x52,0xED,0x6F,0x21,0x29,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0x87,0x2D,0x31,0xC8,0x3A,0x42,0x6A,0x3C,0x52,0xED,0x3E,0x63,0xAF,0x40,0x6B,0xF0,0x42,0x6C,0x10,0x44,0x6C,0x11,0x46,0x6C,0x11,0x48,0x6C,0x11,0x4A,0x6C,0x11,0x4D,0x6C,0x11,0x4F,0x74,0x11,0x50,0x74,0x11,0x52,0x74,0x12,0x55,0x74,0x32,0x57,0x74,0x11,0x5A,0x74,0x32,0x5C,0x74,0x31,0x5F,
-    0x74,0x12,0x61,0x74,0x31,0x64,0x74,0x11,0x67,0x74,0x11,0x69,0x74,0x32,0x6C,0x74,0x12,0x6F,0x74,0x31,0x72,0x74,0x32,0x74,0x74,0x32,0x77,0x74,0x31,0x79,0x74,0x31,0x7C,0x74,0x32,0x7F,0x74,0x31,0x82,0x74,0x32,0x85,0x74,0x32,0x88,0x74,0x31,0x8B,0x74,0x32,0x8E,0x74,0x11,0x92,0x6C,0x11,0x95,0x74,0x11,0x98,0x6C,0x11,0x9C,0x74,0x11,0x9F,0x74,0x11,0xA1,0x74,0x11,0xA4,0x6C,0x11,0xA8,0x6C,0x11,0xAA,0x6C,0x11,0xAD,0x6C,0x11,0xAF,0x6C,0x11,0xB3,0x6C,0x11,0xB5,0x6C,0x11,0xB7,0x6C,0x31,0xB8,0x74,0x11,0xBA,0x74,0x11,0xBA,0x74,0x11,0xBC,0x74,0x11,0xBC,0x74,0x31,0xBA,0x74,0x11,0xBA,0x6C,0x11,0xB7,0x74,0x11,0xB5,0x74,0x11,0xAF,0x74,0x11,0xAA,0x74,0x11,0xA3,0x74,0x11,0x98,0x74,0x11,0x8D,0x74,0x11,0x7F,0x73,0xF1,0x6D,0x6B,0xD0,0x5A,0x63,0x8F,0x42,0x52,0xED,0x29,0x3A,0x49,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3B,0x72,0x1E,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0x4C,0x76,0x88,0x3A,0x8C,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC8,0x30,0x4B,0xB3,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x29,0x1E,0x4C,0x97,0xD0,0x55,0xBD,0xFF,0x3A,0x4A,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x6B,0x38,0x4D,0x1A,0xF6,0x5D,0xFE,0xFF,0x42,0xED,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3A,0x6B,0x6B,0x4D,0x3B,0xFF,0x55,0x3B,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3A,0x8B,0x73,0x55,0x7C,0xFF,0x55,0xDE,0xFF,0x5D,0xBD,0xFF,0x3A,0x6B,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x42,0xEE,0x93,0x5D,0xBD,0xFF,0x5D,0xFE,0xFF,0x5E,0x1E,0xFF,0x43,0x0E,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x43,0x0F,0xAB,0x55,0xDE,0xFF,0x55,0xBE,0xFF,0x55,0x5B,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0A,0x43,0x92,0xC2,0x55,0xBE,0xFF,0x55,0xBE,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x3A,0x8C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x12,0x4C,0x55,0xD8,0x55,0xDD,0xFF,0x55,0xDE,0xFF,0x55,0xDE,0xFF,0x5D,0xFE,0xFF,0x43,0x2E,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x14,0x54,0x55,0xE0,0x55,0xBD,0xFF,0x55,0xBE,0xFF,0x4D,0x9E,0xFF,0x55,0x3A,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x08,0x1B,0x4C,0x76,0xEF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x3A,0x8C,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x0A,0x36,0x4C,0xD8,0xFD,0x55,0xDE,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x5D,0xFE,0xFF,0x43,0x2F,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x4A,0x2E,0x4C,0xF9,0xFD,0x55,0xBD,0xFF,0x4D,0xBD,0xFF,0x4D,0x9D,0xFF,0x55,0xBD,0xFF,0x55,0x5A,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x8C,0x30,0x4C,0xF9,0xFF,0x55,0xBE,0xFF,0x55,0xBD,0xFF,0x4D,0x9D,0xFF,0x55,0x9D,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x32,0xAD,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3A,0x8C,0x64,0x45,0x3B,0xFF,0x4D,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xFE,0xFF,0x3B,0x2F,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0xEE,0x4E,0x4D,0x7C,0xFF,0x4D,0xBD,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x3A,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0xAD,0x3A,0x45,0x5C,0xFF,0x4D,0xBD,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x55,0x9D,0xFF,0x4D,0xBD,0xFF,0x32,0xAD,0xED,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3A,0xCE,0x7F,0x45,0x5C,0xFF,0x4D,0x9D,0xFF,0x45,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0xBD,0xFF,0x55,0xDE,0xFF,0x3B,0x30,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x3B,0x71,0x49,0x4D,0x9D,0xFF,0x4D,0xBD,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x1A,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xAD,0x2D,0x45,0x9D,0xFF,0x4D,0x9D,0xFF,0x45,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x7D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x32,0xCE,0xD8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xAD,0x6C,0x45,0x7D,0xFF,0x45,0x9D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0xDE,0xFF,0x3B,0x30,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0x92,0x26,0x45,0x9D,0xFF,0x4D,0x9D,0xFF,0x45,0x7D,0xFF,0x4D,0x7C,0xFF,0x4D,0x7D,0xFF,0x4D,0x7D,0xFF,0x4D,0x9D,0xFF,0x45,0x7D,0xFF,0x45,0x1A,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x69,0x0A,0x3D,0x1B,0xFA,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7C,0xFF,0x4D,0x7D,0xFF,0x45,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x32,0xCE,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x29,0x1D,0x3D,0x3C,0xFF,0x45,0x7D,0xFF,0x45,0x5D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x4D,0x9D,0xFF,0x4D,0xBE,0xFF,0x33,0x2F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x2C,0x05,
-    0x3D,0x5C,0xEF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x4D,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x1A,0xAB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0x71,0x57,0x3D,0x7D,0xFF,0x3D,0x5D,0xFF,0x45,0x5D,0xFF,0x45,0x5D,0xFF,0x45,0x5D,0xFF,0x45,0x7C,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x32,0xCE,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xF4,0x9A,0x3D,0x5D,0xFF,0x3D,0x5D,0xFF,0x3D,0x5C,0xFF,0x45,0x5D,0xFF,0x45,0x5D,0xFF,0x3D,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x9D,0xFF,0x33,0x0F,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xD9,0x63,0x45,0x5D,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5D,0xFF,0x45,0x5C,0xFF,0x45,0x7D,0xFF,0x45,0x7C,0xFF,0x45,0x7C,0xFF,0x45,0x7D,0xFF,0x44,0xF9,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x35,0x95,0x45,0x5C,0xFF,0x3D,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5D,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x45,0x7D,0xFF,0x32,0x8C,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xD9,0xF2,0x3D,0x5D,0xFF,0x3D,0x3C,0xFF,0x3D,0x5C,0xFF,0x45,0x5D,0xFF,0x3D,0x5D,0xFF,0x3D,0x5D,0xFF,0x45,0x5D,0xFF,0x3D,0x7C,0xFF,0x45,0x7D,0xFF,0x45,0x9D,0xFF,0x32,0xCD,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3D,0x5C,0xEF,
-    0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5D,0xFF,0x45,0x5C,0xFF,0x45,0x7C,0xFF,0x45,0x7D,0xFF,0x3C,0xD9,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x15,0x92,0x3D,0x5C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x3D,0x5D,0xFF,0x45,0x5C,0xFF,0x32,0x0A,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xB9,0xE9,0x3D,0x5D,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x5C,0xFF,0x3D,0x5C,0xFF,0x3D,0x5C,0xFF,0x3D,0x5C,0xFF,0x3D,0x5D,0xFF,0x3D,0x7E,0xFF,0x2A,0x6B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x8C,0x05,0x3D,0x3C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x7D,0xFF,0x44,0x97,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0x51,0x4D,0x3D,0x5D,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x5C,0xFF,0x3D,0x5D,0xFF,0x3D,0x1B,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xB4,0xA6,0x35,0x3C,0xFF,0x35,0x1C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3D,0xFF,0x3D,0x5D,0xFF,0x35,0x1B,0xE9,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3C,0xFB,0xFD,
-    0x3D,0x5C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x3C,0xFF,0x3D,0x5D,0xFF,0x3D,0x7D,0xFF,0x3B,0x72,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x07,0x3C,0xFA,0xF8,0x45,0x5D,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x5D,0xFF,0x3D,0x5D,0xFF,0x3B,0x91,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x2A,0x3C,0x2D,0x1C,0xFF,0x35,0x3C,0xFF,0x35,0x1C,0xFF,0x35,0x1C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x35,0x1C,0xFF,0x35,0x3D,0xFF,0x35,0x5D,0xFF,0x3A,0xCE,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x72,0x77,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x45,0x5D,0xFF,0x3D,0x5C,0xFF,0x32,0x2A,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x8D,0x22,0x3C,0xFB,0xF6,0x3D,0x5D,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3D,0xFF,0x3D,0x3D,0xFF,0x3D,0x5C,0xFF,0x3B,0xF5,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x32,0xEF,0xA6,0x34,0xFB,0xFF,0x35,0x3C,0xFF,0x35,0x3C,0xFF,0x35,0x1C,0xFF,0x35,0x1C,0xFF,0x35,0x3C,0xFF,0x35,0x1C,0xFF,0x3B,0x92,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,
-    0x3C,0x15,0xCC,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x5D,0xFF,0x3D,0x3C,0xFF,0x3A,0xEE,0xB5,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x49,0x07,0x3C,0x16,0x48,0x3C,0xDA,0x93,0x35,0x1B,0xC6,0x34,0xFB,0xC0,0x34,0x99,0x74,0x43,0x30,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3A,0x4B,0x31,0x34,0x16,0x93,0x2C,0xBA,0xDC,0x2C,0xFB,0xF6,0x2C,0xBA,0xD6,0x34,0x37,0x8A,0x32,0x6C,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3B,0x51,0x39,0x3C,0xB9,0x92,0x3D,0x1B,0xD0,0x3D,0x3C,0xE2,0x35,0x1B,0xC2,0x3C,0x77,0x7F,0x3A,0x6B,0x2B,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x09,0x30,0x43,0xD3,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3A,0x2A,0x6B,0x55,0x5B,0xFF,0x4D,0x7C,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x4B,0x51,0xAB,0x55,0x9D,0xFF,0x5D,0xDE,0xFF,0x55,0xBD,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x09,0x14,0x54,0x55,0xE0,0x5D,0xDE,0xFF,0x5D,0xDE,0xFF,0x55,0xBE,0xFF,0x55,0x9C,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x8B,0x33,0x54,0xF9,0xFD,0x5D,0xFE,0xFF,0x5D,0xDE,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0x9C,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0xCE,0x52,0x4D,0x5C,0xFF,0x55,0xBE,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0xBD,0xFF,0x55,0x9D,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0x51,0x54,0x4D,0x7D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x55,0x9D,0xFF,0x55,0x9D,0xFF,0x55,0x9D,0xFF,0x55,0xBD,0xFF,0x4D,0x9D,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0x72,0x2E,0x45,0x7D,0xFF,0x4D,0x7D,0xFF,0x4D,0x7D,0xFF,0x4D,0x7D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9D,0xFF,0x4D,0x9C,0xAB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x4D,0x07,0x45,0x5C,0xF6,0x45,0x5D,0xFF,0x45,0x5D,0xFF,0x45,0x7C,0xFF,0x4D,0x7D,0xFF,0x4D,0x7D,0xFF,0x4D,0x7D,0xFF,0x4D,0x7D,0xFF,0x4D,0x9D,0xFF,0x4D,0x7D,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x77,0x70,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x5D,0xFF,0x4D,0x7D,0xFF,0x4D,0x9D,0xFF,0x4D,0x5C,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x45,0x3B,0xF6,0x3D,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x45,0x3C,0xFF,0x45,0x5C,0xFF,0x45,0x5D,0xFF,0x45,0x7D,0xFF,0x45,0x7C,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x3D,0x1B,0xFF,0x3D,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x3C,0xFF,0x45,0x5D,0xFF,0x3D,0x3C,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3C,0xB9,0xF6,0x45,0x5C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x45,0x3C,0xFF,0x3D,0x3C,0xFF,0x45,0x3C,0xFF,0x3D,0x3C,0xFF,0x45,0x5D,0xFF,0x3C,0x57,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0x50,0x5A,0x3D,0x5C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3C,0xFF,0x45,0x3C,0xFF,0x3D,0x3C,0xFF,0x3D,0x1C,0xFF,0x3D,0x3C,0xFF,0x45,0x5C,0xFF,0x3D,0x3C,0xFF,0x3A,0x6A,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x44,0x36,0x9C,0x45,0x5C,0xFF,0x45,0x5C,0xFF,0x3D,0x3C,0xFF,0x3D,0x1C,0xFF,0x3D,0x3C,0xFF,0x3D,0x3D,0xFF,0x3D,0x3C,0xFF,0x43,0x92,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3B,0x50,0x65,0x3C,0xDA,0xFF,0x3D,0x3C,0xFF,0x35,0x1C,0xFF,0x35,0x1B,0xFF,0x3C,0xB9,0xFF,0x42,0xAD,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,
-    0x00,0x00,0x02,0x52,0xAA,0x03,0x31,0x86,0x05,0x39,0xC7,0x09,0x39,0xC7,0x12,0x31,0xA7,0x40,0x31,0xE8,0xFF,0x32,0x4B,0xFF,0x32,0x6B,0xFF,0x32,0x2A,0xFF,0x31,0xC7,0xFF,0x29,0x87,0x77,0x31,0xC8,0x20,0x29,0xE7,0x11,0x39,0xC7,0x09,0x29,0x45,0x06,0x42,0x08,0x04,0x04,0x10,0x02,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_rain_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_rain_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_rain_png_data
-};
-
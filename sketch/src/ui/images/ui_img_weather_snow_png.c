@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/snow.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_snow_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x4A,0xCB,0x14,0x84,0x51,0x38,0xAD,0x96,0x67,0xCE,0x9A,0x9D,0xD6,0xFB,0xC0,0xDF,0x1C,0xE5,0xDF,0x1C,0xF4,0xDF,0x1C,0xE9,0xD6,0xDB,0xDC,0xC6,0x59,0xAF,0xAD,0x75,0x7F,0x7C,0x31,0x4F,0x4A,0x6B,0x1D,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x6A,0x21,0x8C,0x72,0x90,0xCE,0x7A,0xF8,0xEF,0x9E,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xEF,0x9E,0xFF,0xC6,0x59,0xFF,0x84,0x31,0x97,0x42,0x4A,0x23,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x42,0x4A,0x30,0x9C,0xF4,0xE0,0xE7,0x7D,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBF,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBF,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xF7,0xBF,0xFF,0xF7,0xDF,0xFF,0xE7,0x3C,0xFF,0x8C,0x92,0xC0,0x39,0xE9,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x68,0x0B,0x7C,0x31,0xB8,0xEF,0xBE,0xFF,0xF7,0xBF,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0x9F,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBF,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDF,0xFF,0xEF,0x7D,0xFF,0x6B,0xAF,0x65,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x2A,0x33,0xBE,0x38,0xF8,0xEF,0xBE,0xFF,
-    0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0x9F,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xF7,0xBF,0xFF,0xF7,0xDF,0xFF,0xB5,0xD7,0xBE,0x39,0xCA,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xCC,0x5A,0xD6,0xFB,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0xBE,0xFF,0xEF,0xBF,0xFF,0xF7,0xBF,0xFF,0xF7,0xDF,0xFF,0xD6,0xBB,0xED,0x4A,0x6B,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x0D,0x68,0xE7,0x7E,0xFF,0xEF,0xBE,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,
-    0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0xDF,0xFF,0xDF,0x1C,0xFA,0x4A,0x4A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xEC,0x56,0xEF,0x9D,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0xBF,0xFF,0xDE,0xFC,0xFF,0x3A,0x09,0x4A,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8A,0x26,0xD6,0xFC,0xFF,0xEF,0xBF,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,
-    0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0xBE,0xFF,0xB5,0xF8,0xFF,0x29,0x87,0xE0,0x39,0xE8,0x6D,0x52,0xCC,0x5A,0x6B,0x8E,0x7D,0x73,0xCF,0x9D,0x73,0xD0,0x8D,0x63,0x4D,0x67,0x4A,0x6A,0x34,0x39,0xC7,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0xBE,0x18,0xF4,0xF7,0xDF,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xCE,0xBB,0xFF,0xD7,0x1C,0xFF,0xE7,0x9E,0xFF,
-    0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x5D,0xFF,0xD6,0xDB,0xFF,0xAD,0xD7,0xE2,0x74,0x10,0x58,0x42,0x08,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x51,0x9C,0xF7,0xBF,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,
-    0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xDF,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xD6,0xFB,0xFF,0x84,0x72,0x90,0x3A,0x69,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x29,0x22,0xE7,0x5C,0xFF,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,
-    0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xDF,0x7E,0xFF,0xDF,0x7D,0xFF,0xDF,0x7D,0xFF,0xE7,0x7D,0xFF,0xEF,0x9E,0xFF,0xD6,0xDB,0xFF,0x5B,0x0D,0x5F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x92,0xBE,0xEF,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,
-    0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xDF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xE7,0x9E,0xFF,0xEF,0x9E,0xFF,0x8C,0x92,0xAD,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0x17,0xD7,0x1C,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x9E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xDF,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,
-    0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xE7,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xE7,0x7D,0xFF,0xDF,0x7D,0xFF,0xE7,0x7E,0xFF,0xEF,0x9E,0xFF,0x9D,0x14,0xAB,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8E,0x74,0xEF,0x9E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,
-    0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x5E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x5E,0xFF,0xE7,0x7D,0xFF,0xE7,0x5E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xDF,0x7D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5E,0xFF,0xDF,0x7D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xE7,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xE7,0x7D,0xFF,0xEF,0x9E,0xFF,0x8C,0x93,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xA5,0x55,0xF4,0xE7,0x7E,0xFF,0xDF,0x5D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x5E,0xFF,0xDF,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x5E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x5E,0xFF,0xE7,0x7E,0xFF,0xE7,0x7E,0xFF,0xDF,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x5E,0xFF,0xE7,0x5E,0xFF,0xDF,0x5E,0xFF,0xDF,0x7E,0xFF,0xE7,0x5E,0xFF,0xDF,0x5D,0xFF,0xE7,0x5E,0xFF,0xDF,0x5D,0xFF,0xE7,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5E,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,
-    0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xE7,0x5D,0xFF,0x63,0x6E,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC8,0x23,0xCE,0xBA,0xFF,0xE7,0x5D,0xFF,0xDF,0x7D,0xFF,0xE7,0x7D,0xFF,0xDF,0x7D,0xFF,0xE7,0x7D,0xFF,0xDF,0x7D,0xFF,0xE7,0x7D,0xFF,0xE7,0x7E,0xFF,0xE7,0x7D,0xFF,
-    0xE7,0x7D,0xFF,0xE7,0x5D,0xFF,0xE7,0x7D,0xFF,0xDF,0x7D,0xFF,0xDF,0x7E,0xFF,0xDF,0x7D,0xFF,0xDF,0x7E,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5E,0xFF,0xDF,0x5E,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5E,0xFF,0xDF,0x5D,0xFF,0xDF,0x5E,0xFF,0xDF,0x5D,0xFF,0xDF,0x5E,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xCE,0xDB,0xE2,0x02,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x4A,0xCB,0xBA,0xE7,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5E,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x7D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,
-    0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x5D,0xFF,0x94,0xD4,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x08,0x29,0xA7,0x8E,0x63,0x6E,0xFF,0xE7,0x9E,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,
-    0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xD7,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xD7,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1C,0xFF,0x39,0xCA,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x07,0x4A,0xAB,0x2D,0x73,0xF0,0x6F,0x8C,0xF4,0xC8,0xA5,0xB7,0xFF,0xAD,0xF8,0xFF,0xC6,0x9A,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,
-    0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3C,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x5D,0xFF,0x7C,0x51,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x4A,0x18,0x84,0x72,0x98,0xC6,0xBB,0xFF,0xDF,0x7D,0xFF,0xE7,0x7E,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,
-    0xD7,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x3C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD7,0x3C,0xFF,0xBE,0x7A,0xFF,0x22,0x49,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0x94,0xD4,0x97,0xDF,0x3D,0xFF,0xE7,0x9E,0xFF,0xDF,0x5D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x5D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x5D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,
-    0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3C,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x3D,0xFF,0x4A,0xAB,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x0D,0x2C,0xC6,0x9A,0xF2,0xE7,0x7E,0xFF,0xE7,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,
-    0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1D,0xFF,0xD7,0x3C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3C,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1C,0xFF,0xD7,0x3D,0xFF,0xD7,0x3C,0xFF,0xD7,0x3C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xDF,0x5D,0xFF,0x6B,0x8F,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x10,0x57,0xDF,0x3D,0xFF,0xDF,0x5D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3C,0xFF,0xD7,0x1D,0xFF,0xD7,0x3C,0xFF,0xD7,0x3C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x3C,0xFF,0xD7,0x3C,0xFF,0xD7,0x1D,0xFF,0xD7,0x3C,0xFF,0xD7,0x1D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3C,0xFF,0xD7,0x3D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x3C,0xFF,0xD7,0x3D,0xFF,0xD7,0x1D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x3D,0xFF,0xD7,0x1C,0xFF,
-    0xD7,0x1D,0xFF,0xCF,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xD7,0x3D,0xFF,0x84,0x72,0xFD,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x31,0x6B,0xDF,0x5D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xDF,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3D,0xFF,0xD7,0x3C,0xFF,0xD7,0x3C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x3C,0xFF,0xD7,0x1D,0xFF,
-    0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD7,0x1D,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD6,0xFC,0xFF,0xCE,0xFC,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xCF,0x1C,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD7,0x1C,0xFF,0x95,0x15,0xFF,0x39,0xE8,0x80,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xD0,0x55,0xD7,0x3D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x3D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0xCE,0xFC,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xCF,0x1C,0xFF,0xD7,0x1D,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xD6,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0xCE,0xFC,0xFF,
-    0xCF,0x1C,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCF,0x1C,0xFF,0xD6,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD7,0x3D,0xFF,0xC6,0xBB,0xFF,0x8C,0x93,0xB8,0x3A,0x28,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x6A,0x21,0xCE,0xDB,0xFF,0xCF,0x1C,0xFF,0xCE,0xFC,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1D,0xFF,0xD7,0x1C,0xFF,0xD6,0xFD,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD6,0xFC,0xFF,0xCF,0x1C,0xFF,0xD6,0xFC,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,
-    0xD7,0x1C,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD7,0x1C,0xFF,0xDF,0x3D,0xFF,0xCE,0xDC,0xFF,0x94,0xF4,0x8A,0x42,0x0A,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xB6,0x39,0xED,0xCF,0x1C,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xD7,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,
-    0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD7,0x1C,0xFF,0xDF,0x3D,0xFF,0xBE,0x59,0xFF,0x5B,0x2D,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xCF,0x74,0xD7,0x1D,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCF,0x1C,0xFF,0xCF,0x1C,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,
-    0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD7,0x3C,0xFF,0xCE,0xDB,0xFF,0x5B,0x0D,0x9A,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x28,0x0B,0xBE,0x59,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,
-    0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xD6,0xFC,0xFF,0xD7,0x1C,0xFF,0x52,0xAB,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8E,0x6B,0xD7,0x1C,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xC6,0xFB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,
-    0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xFB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xBC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xCE,0xFC,0xFF,0xBE,0x59,0xFF,0x3A,0x09,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x9D,0x55,0xF4,0xD7,0x1C,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xDB,0xFF,0xC6,0xDC,0xFF,0xCE,0xDC,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xCE,0xDB,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,
-    0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBC,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBC,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xCE,0xDB,0xFF,0xC6,0xDB,0xFF,0xCF,0x1C,0xFF,0x8C,0xB3,0xED,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0x1B,0xBE,0x79,0xFF,0xCE,0xFC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,
-    0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xBB,0xFF,0x4A,0xAB,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xCC,0x52,0xCE,0xDB,0xFF,0xCE,0xDC,0xFF,0xC6,0xDB,0xFF,0xCE,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBC,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBC,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBC,0xFF,0xC6,0xBB,0xFF,0xC6,0xBC,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBC,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,
-    0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xC6,0xDB,0xFF,0xCF,0x1C,0xFF,0x94,0xF4,0x9D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x6E,0x95,0xCE,0xDC,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,
-    0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xDB,0xFF,0xBE,0x59,0xFD,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xF0,0xCE,0xCE,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,
-    0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xC6,0x9B,0xFF,0xBE,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0x42,0xEB,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x10,0xEB,0xC6,0xDB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0xBB,0xFF,0xC6,0xBB,0xFF,0xBE,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xC6,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,
-    0xBE,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xC6,0x9B,0xFF,0xBE,0x9B,0xFF,0xC6,0x9B,0xFF,0xBE,0x9B,0xFF,0xC6,0xBB,0xFF,0xC6,0xBB,0xFF,0xC6,0x9B,0xFF,0xC6,0xBB,0xFF,0x73,0xD0,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xF0,0xE5,0xC6,0xDB,0xFF,0xBE,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xBE,0x9B,0xFF,0xC6,0x9B,0xFF,0xBE,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xC6,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,
-    0xBE,0x9B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xC6,0xBB,0xFF,0x8C,0xB3,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x8F,0xBE,0xC6,0xBB,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0xBB,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,
-    0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x9A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0xBB,0xFF,0x95,0x15,0x32,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x0C,0x82,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9B,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x9A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x9A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x9A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,
-    0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x9B,0xFF,0x95,0x15,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x49,0x40,0xB6,0x59,0xFF,0xBE,0x9B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,
-    0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x9A,0xFF,0x8C,0xD4,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA6,0x0E,0x9D,0x76,0xFF,0xBE,0x9B,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x7A,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xBE,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,
-    0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xBE,0x9A,0xFF,0x7C,0x31,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x11,0xBA,0xC6,0xBB,0xFF,0xBE,0x5A,0xFF,0xBE,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,
-    0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xBE,0x7A,0xFF,0x53,0x4D,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x8A,0x30,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x7A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x59,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x59,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x59,0xFF,
-    0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x3A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x3A,0xFF,0xB6,0x3A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x59,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x59,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xB6,0x5A,0xFF,0xAE,0x19,0xFD,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8C,0xD4,0xCC,0xBE,0x9B,0xFF,0xB6,0x5A,0xFF,0xB6,0x59,0xFF,0xB6,0x39,0xFF,0xB6,0x3A,0xFF,0xB6,0x3A,0xFF,0xAE,0x59,0xFF,0xAE,0x59,0xFF,0xB6,0x5A,0xFF,0xB6,0x3A,0xFF,0xB6,0x5A,0xFF,0xAE,0x5A,0xFF,0xB6,0x3A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xB6,0x59,0xFF,0xB6,0x5A,0xFF,0xB6,0x3A,0xFF,0xB6,0x5A,0xFF,0xB6,0x59,0xFF,0xB6,0x3A,0xFF,0xB6,0x59,0xFF,0xB6,0x59,0xFF,0xB6,0x59,0xFF,0xB6,0x5A,0xFF,
-    0xAE,0x59,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xB6,0x39,0xFF,0xB6,0x5A,0xFF,0xAE,0x59,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xAE,0x59,0xFF,0xAE,0x5A,0xFF,0xB6,0x5A,0xFF,0xAE,0x59,0xFF,0xB6,0x59,0xFF,0xB6,0x3A,0xFF,0xAE,0x59,0xFF,0xAE,0x5A,0xFF,0xAE,0x59,0xFF,0xB6,0x3A,0xFF,0xAE,0x59,0xFF,0xAE,0x59,0xFF,0xAE,0x5A,0xFF,0xAE,0x59,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xAE,0x59,0xFF,0xB6,0x3A,0xFF,0xB6,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x59,0xFF,0xAE,0x59,0xFF,0xB6,0x5A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x5A,0xFF,0x8C,0xF4,0x9D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x6A,0x1B,0xB6,0x5A,0xFF,0xB6,0x5A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xB6,0x3A,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xB6,0x3A,0xFF,0xB6,0x39,0xFF,0xB6,0x3A,0xFF,0xB6,0x39,0xFF,0xB6,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xAE,0x3A,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xB6,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,
-    0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xB6,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0x52,0xEC,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x11,0x6F,0xB6,0x5A,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x3A,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,
-    0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x3A,0xFF,0x84,0xD4,0xED,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8D,0x14,0xA6,0xAE,0x3A,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,
-    0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x39,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA5,0xF8,0xFF,0x42,0x2A,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x8D,0x15,0xC8,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,
-    0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xAD,0xF9,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xA5,0xF9,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x39,0xFF,0x5B,0x2D,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x8C,0x05,0x8C,0xF4,0xCC,0xAE,0x19,0xFF,0xA5,0xF9,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAD,0xF9,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xAD,0xF9,0xFF,0xA5,0xF9,0xFF,0xA6,0x19,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA6,0x19,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x18,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA6,0x19,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,
-    0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA6,0x18,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xAD,0xF8,0xFF,0xAE,0x19,0xFF,0xA6,0x18,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAD,0xF9,0xFF,0xAD,0xF9,0xFF,0xAE,0x19,0xFF,0xA6,0x19,0xFF,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0x6B,0xB0,0xA6,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x7C,0x72,0xB5,0xAD,0xF9,0xFF,0xA6,0x19,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xAE,0x19,0xFF,0xAD,0xF9,0xFF,0xAD,0xF8,0xFF,0xAD,0xF9,0xFF,0xAD,0xF9,0xFF,0xAD,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,
-    0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA6,0x19,0xFF,0xA6,0x18,0xFF,0xA6,0x19,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xAD,0xF8,0xFF,0xAE,0x18,0xFF,0xA6,0x19,0xFF,0xAE,0x18,0xFF,0xA5,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xAE,0x19,0xFF,0xA5,0xF8,0xFF,0x63,0x8F,0x7C,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0xEC,0x52,0x9D,0xB7,0xF8,0xAE,0x39,0xFF,0xA6,0x19,0xFF,0xA5,0xF9,0xFF,0xA5,0xF9,0xFF,0xAD,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0x9D,0xF8,0xFF,0xA5,0xD8,0xFF,0x9D,0xD8,0xFF,0xA5,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xF8,0xFF,0x9D,0xD8,0xFF,0xA5,0xF8,0xFF,0x9D,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0x9D,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,
-    0x9D,0xF8,0xFF,0x9D,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF9,0xFF,0xAE,0x39,0xFF,0x95,0x56,0xED,0x42,0x6A,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x63,0x6E,0x38,0x9D,0x56,0x97,0xAE,0x19,0xF8,0xAE,0x19,0xFF,0xAE,0x19,0xFF,0xAD,0xF9,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xB8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,
-    0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0xA5,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0x9D,0xD8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xD8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA5,0xF8,0xFF,0xA6,0x18,0xFF,0xA5,0xF8,0xFF,0x95,0x15,0xF2,0x5B,0x2D,0x60,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x6B,0x72,0x07,0x84,0xD3,0x17,0x9D,0x56,0x2A,0x9D,0x76,0x3F,0x9D,0x97,0x54,0x9D,0x97,0x68,0x9D,0x97,0x7A,0x95,0x76,0x8B,0x95,0x76,0x9C,0x95,0x56,0xAA,0x95,0x56,0xB7,0x95,0x76,0xC2,0x95,0x76,0xCC,0x95,0x76,0xD4,0x95,0x76,0xDC,0x95,0x77,0xE2,0x9D,0x97,0xE9,0x9D,0x97,0xED,0x9D,0xB7,0xF2,0x9D,0xB7,0xF6,0x9D,0xB7,0xFA,0x9D,0x97,0xFD,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x76,0xFF,0x9D,0x97,0xFF,0x9D,0x77,0xFF,0x95,0x97,0xFF,0x95,0x77,0xFF,0x95,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x77,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x9D,0x97,0xFF,0x95,0x77,0xFF,0x95,0x76,0xFF,
-    0x95,0x77,0xFF,0x95,0x76,0xFF,0x95,0x76,0xFF,0x9D,0x76,0xFF,0x9D,0x96,0xFF,0x9D,0x97,0xFD,0x9D,0x97,0xF8,0x9D,0x97,0xF2,0x9D,0x97,0xE9,0x9D,0xB7,0xDE,0x9D,0xB7,0xD4,0x9D,0xB7,0xC8,0xA5,0xB7,0xB8,0xA5,0xB7,0xA6,0xA5,0xB7,0x93,0x9D,0x76,0x7C,0x95,0x35,0x63,0x84,0x93,0x47,0x63,0x90,0x2A,0x52,0x8C,0x10,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x08,0x14,0xB6,0x19,0xA6,0x9D,0x35,0xA1,0x31,0x88,0x10,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x14,0xAD,0xB7,0x6F,0x8C,0xB3,0x8E,0x29,0x65,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x72,0x36,0x6B,0x8E,0xFD,0xBE,0x19,0xFF,0xA5,0x55,0xFF,0xA5,0x75,0xF8,0x6B,0x8F,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x29,0x65,0x16,0x8C,0x92,0xA8,0x84,0x72,0xFF,0xA5,0x96,0xFF,0x9D,0x35,0xFF,0x84,0x31,0xF8,0x6B,0x8F,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x42,0x2A,0x16,0x63,0x6D,0x2F,0x31,0xA6,0xAA,0x63,0x2C,0xFF,0xC6,0x9A,0xFF,0xCE,0xDA,0xFF,0xBE,0x18,0xFF,0xC6,0x7A,0xFF,0x42,0x49,0xFF,
-    0x31,0xA7,0x52,0x84,0x10,0x06,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0x63,0x2D,0x95,0x31,0xA7,0xFF,0x63,0x2D,0xFF,0xBE,0x59,0xFF,0xBE,0x59,0xFF,0xB6,0x18,0xFF,0xB6,0x19,0xFF,0x42,0x49,0xFF,0x29,0x86,0x86,0x42,0x49,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x29,0x42,0x9D,0x14,0xFF,0x5B,0x0C,0xFF,0xC6,0x59,0xFF,0x4A,0xAA,0xFF,0x39,0xE7,0xFF,0x5B,0x0C,0xFF,0xC6,0x7A,0xFF,0xB5,0xF8,0xFF,0x4A,0x8A,0xFF,0x3A,0x08,0xFF,0x63,0x6E,0xFF,0xAD,0xD7,0xFF,0x6B,0xAF,0xFF,0x94,0xF4,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x11,0x2D,0x4A,0x8A,0xFA,0xC6,0x9A,0xFF,
-    0x42,0x49,0xFF,0x31,0xC7,0xFF,0x52,0xEB,0xFF,0xBE,0x19,0xFF,0xB5,0xF8,0xFF,0x42,0x69,0xFF,0x29,0x66,0xFF,0x5B,0x0C,0xFF,0xA5,0x56,0xFF,0x42,0x09,0x1C,0xAD,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xD0,0x7A,0xCE,0x9A,0xFF,0xAD,0xB7,0xFF,0xCE,0x9A,0xFF,0x63,0x6D,0xFF,0x31,0xE7,0xFF,0x31,0xC7,0xFF,0xBE,0x19,0xFF,0x84,0x31,0xFF,0x31,0xC7,0xFF,0x39,0xE7,0xFF,
-    0x84,0x52,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xB5,0xD8,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x2C,0x0A,0xCE,0xBA,0xFF,0xA5,0x55,0xFF,0xCE,0x7A,0xFF,0x63,0x4D,0xFF,0x31,0xA7,0xFF,0x29,0xA6,0xFF,0xB5,0xD8,0xFF,0x9D,0x15,0xFF,0x29,0x86,0xFF,0x29,0x66,0xFF,0x73,0xCF,0xFF,0xBE,0x19,0xFF,0xB5,0xD7,0xFF,0xB6,0x18,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC8,0x46,0x7C,0x10,0xFF,0xC6,0x59,0xFF,0xCE,0xDA,0xFF,0xBE,0x18,0xFF,0x52,0xCB,0xFF,0x3A,0x08,0xFF,0xC6,0x7A,0xFF,0x94,0xD3,0xFF,0x39,0xE7,0xFF,0x5B,0x0C,0xFF,0xCE,0x9A,0xFF,0xD6,0xFB,0xFF,0x9D,0x36,0xFF,0x63,0x4E,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x08,0x1B,0x6B,0xAF,0xFF,0xBE,0x38,0xFF,0xD6,0xDB,0xFF,
-    0xB5,0xD7,0xFF,0x42,0x69,0xFF,0x31,0xE7,0xFF,0xBE,0x38,0xFF,0xAD,0x97,0xFF,0x31,0xA6,0xFF,0x4A,0x69,0xFF,0xAD,0x96,0xFF,0xC6,0x79,0xFF,0xA5,0x56,0xFF,0x73,0xD0,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x06,0xC6,0x79,0xEF,0xD6,0xDB,0xFF,0xA5,0x96,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0x8C,0x92,0xFF,0xCE,0x7A,0xFF,0xAD,0xB7,0xFF,0x9C,0xF4,0xFF,0xC6,0x7A,0xFF,
-    0xB5,0xD7,0xFF,0xC6,0x59,0xFF,0xC6,0x7A,0xD6,0xBE,0x18,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x9D,0x14,0xF8,0xD6,0xBB,0xFF,0xC6,0x59,0xFF,0xBE,0x18,0xFF,0xBE,0x59,0xFF,0x94,0xF3,0xFF,0xB6,0x18,0xFF,0xAD,0xB6,0xFF,0x7C,0x31,0xFF,0xC6,0x59,0xFF,0xB5,0xF8,0xFF,0xBE,0x59,0xFF,0xB6,0x18,0xFF,0xAD,0xB7,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x0C,0x08,0x3A,0x28,0x3D,0x31,0xA7,0x7C,0x42,0x28,0xF8,0x84,0x10,0xFF,0xC6,0x9A,0xFF,0xCE,0x9A,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x5A,0xEC,0xFF,0x21,0x45,0x24,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x69,0x14,0x52,0xAA,0x46,0x3A,0x08,0x1F,
-    0x3A,0x07,0x2B,0x84,0x51,0xFF,0xC6,0x5A,0xFF,0xBE,0x59,0xFF,0xBE,0x18,0xFF,0xBE,0x5A,0xFF,0x7C,0x10,0xFF,0x29,0xA6,0x2B,0x39,0xE8,0x21,0x42,0x09,0x54,0x42,0x49,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xC7,0x44,0x6B,0x6E,0xFF,0xC6,0x59,0xFF,0xC6,0x7A,0xFF,0xBE,0x59,0xFF,0xB6,0x18,0xFF,0x42,0x69,0xFF,
-    0x29,0x66,0x21,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x39,0xC7,0x32,0x4A,0x8A,0xFF,0xBE,0x39,0xFF,0xB6,0x18,0xFF,0xB6,0x18,0xFF,0xAD,0xF8,0xFF,0x42,0x29,0xFF,0x29,0x66,0x26,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xB5,0xD7,0x73,0xAD,0x96,0xE2,0x63,0x4D,0xFF,0x9D,0x14,0xFF,0xBE,0x19,0xFF,0xA5,0x55,0xFF,0xC6,0x59,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xBE,0x39,0xFF,0x6B,0x8E,0xFF,0x8C,0xB3,0xFF,0xAD,0xD7,0xD0,0x9D,0x35,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xB5,0xD7,0x80,0xB5,0xD7,0xEB,0x6B,0x8E,0xFF,
-    0x73,0xAF,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xB6,0x18,0xFF,0xAD,0xD8,0xFF,0xBE,0x19,0xFF,0x7C,0x31,0xFF,0x52,0xEB,0xFF,0x94,0xF4,0xC2,0xA5,0x76,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC7,0x68,0x7C,0x30,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xB5,0xF8,0xFF,0x4A,0x8A,0xFF,0x29,0x86,0xFF,0xBE,0x19,0xFF,0x73,0xCF,0xFF,0x29,0x86,0x40,0x84,0x31,0xD6,
-    0xC6,0x39,0xFF,0xC6,0x7A,0xFF,0xC6,0x59,0xFF,0x42,0x28,0xFF,0x31,0x86,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC7,0x69,0x5B,0x0C,0xFF,0xD6,0xFB,0xFF,0xCE,0xBA,0xFF,0xBE,0x39,0xFF,0x73,0xCF,0xFF,0x29,0x85,0xFF,0xAD,0xB7,0xFF,0x9D,0x35,0xFF,0x29,0xA6,0xFF,0x9D,0x14,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x59,0xFF,0x52,0xEB,0xFF,0x39,0xC7,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xF0,0x73,0xC6,0x7A,0xFF,0xC6,0x59,0xFF,0xC6,0x79,0xFF,0x6B,0xAF,0xFF,0x31,0x87,0xFF,0x31,0xA7,0xFF,0xB5,0xD8,0xFF,0x63,0x4D,0xFF,0x29,0x86,0x19,0x31,0xA6,0x13,0x9D,0x35,0xFF,0xBE,0x38,0xFF,0xD6,0xBB,0xFF,0xC6,0x7A,0xFF,0x52,0x8A,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x2D,0x69,0xBE,0x38,0xFF,0xC6,0x7A,0xFF,0xCE,0x9A,0xFF,
-    0x84,0x72,0xFF,0x29,0x86,0xFF,0x29,0x87,0xFF,0x9D,0x15,0xFF,0x94,0xF4,0xFF,0x29,0x86,0xFF,0x31,0xA6,0xFF,0x6B,0xCF,0xFF,0xB5,0xF8,0xFF,0xB5,0xF8,0xFF,0xBE,0x39,0xFF,0x52,0xEC,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x0C,0x08,0x9D,0x15,0xD2,0x5B,0x0C,0xFF,0xC6,0x39,0xFF,0x5A,0xEC,0xFF,0x31,0xA7,0xFF,0x52,0xAB,0xFF,0xB5,0xF8,0xFF,0x9D,0x14,0xFF,0x42,0x28,0x83,0x00,0x00,0x00,
-    0x73,0xEF,0x6D,0xBE,0x39,0xFF,0x5B,0x0C,0xFF,0x84,0x51,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x06,0x84,0x72,0xCC,0x52,0xEC,0xFF,0xB5,0xF8,0xFF,0x73,0xCF,0xFF,0x31,0xA7,0xFF,0x42,0x28,0xFF,0xB5,0xD8,0xFF,0xAD,0xB7,0xFF,0x4A,0x69,0xFF,0x31,0x86,0xFF,0x52,0xCB,0xFF,0xBE,0x18,0xFF,0x63,0x4D,0xFF,0x9D,0x55,0xFF,0x4A,0x6B,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xC8,0x23,0x94,0xF4,0x8D,0x39,0xE7,0xFF,0x4A,0xAA,0xFF,0xBE,0x19,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xA5,0x76,0xFF,0x42,0x08,0x04,0x00,0x00,0x01,0x84,0x52,0x25,0x31,0x89,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xC7,0x23,0x94,0xD4,0x8D,
-    0x42,0x49,0xFF,0x39,0xE8,0xFF,0xAD,0x96,0xFF,0xBE,0x39,0xFF,0xC6,0x79,0xFF,0xB5,0xF8,0xFF,0x4A,0x8A,0xFF,0x31,0xC7,0xBC,0x95,0x15,0x65,0x42,0x29,0x5A,0x29,0x67,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x0C,0x94,0xD3,0xA3,0x94,0xF4,0xFF,0xBE,0x18,0xFF,0xA5,0x76,0xFF,0xAD,0x97,0xFF,0x84,0x10,0x04,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x08,0x0C,0x63,0x4E,0xA4,0xA5,0x55,0xFF,0xAD,0x76,0xFF,0xB5,0xD7,0xFF,0x9D,0x55,0xFF,0x9D,0x55,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xC7,0x5F,0xB5,0xD8,0xFF,0x84,0x51,0xFF,0x29,0x86,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xE7,0x61,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0x39,0xE8,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x52,0x25,0x52,0xCC,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x0C,0x2D,0x73,0xD0,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x4A,0x8B,0xA8,0xB6,0x3A,0xFD,0x63,0x6E,0x97,0x29,0xC7,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x34,0x2E,0x6B,0x8E,0xFF,0xC6,0x7A,0xFF,0x63,0x6E,0xFF,0x84,0x72,0xFF,0x52,0xAA,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xAA,0x0C,0x00,0x00,0x01,0x00,0x00,0x00,0xAD,0xB7,0x49,0xBE,0x39,0xFF,0xBE,0x5A,0xFF,0xA5,0x76,0xFF,0xBE,0x5A,0xFF,0x42,0x08,0x08,0x00,0x00,0x00,0x3A,0x29,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0x51,0x94,0xF4,0xFF,0x9D,0x35,0x90,0x00,0x00,0x01,0x39,0xE8,0x33,0x9D,0x35,0xFF,0xC6,0x7A,0xFF,0xB6,0x19,0xFF,0x4A,0x8A,0x6F,0x00,0x00,0x00,0x63,0x2D,0x45,0x9D,0x56,0xFF,0x31,0xA7,0x33,0x52,0x8B,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xDA,0x0B,0xAD,0xB7,0xFF,0x9D,0x14,0xFF,0xB6,0x18,0xFF,0x29,0x86,0x52,0x31,0x88,0x14,0x5A,0xEC,0xFF,0xBE,0x39,0xFF,0x63,0x4D,0xFF,0x39,0xC7,0x09,0x31,0x87,0x29,0x9D,0x15,0xFF,0xAD,0xD7,0xFF,0xAD,0xD7,0xFF,0xBE,0x39,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8E,0x49,0xA5,0x56,0xFF,0xCE,0xBA,0xFF,0xC6,0x7A,0xFF,0x52,0xAB,0xFF,0x31,0xA6,0x2E,0x52,0xCB,0xFF,0xC6,0x9A,0xFF,0x5A,0xEC,0xFF,0x29,0x66,0x5C,0x4A,0x6A,0xFF,0xB6,0x19,0xFF,0xC6,0x9A,0xFF,0xB5,0xF8,0xFF,0x6B,0xAF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x51,0x8D,0x9D,0x14,0xFF,0xC6,0x9A,0xFF,0xBE,0x5A,0xFF,0xC6,0x5A,0xFF,0x7C,0x10,0xE2,0x63,0x4D,0xF8,0xBE,0x5A,0xFF,0x73,0xEF,0xFF,0x63,0x2C,0xFF,0xB5,0xF8,0xFF,0xB6,0x18,0xFF,0xC6,0x9A,0xFF,0xAD,0xD7,0xFF,0x84,0x31,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xAF,0xD0,0x84,0x52,0xFF,0x73,0xCF,0xFF,0x31,0xA6,0xFF,0x52,0xCC,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0xC6,0x5A,0xFF,0xB5,0xF8,0xFF,0xC6,0x7A,0xFF,0x73,0xD0,0xFF,0x29,0x66,0xEF,0x52,0xEC,0x9A,0x73,0xD0,0xA4,0x6B,0xAF,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x25,0xEF,0x21,0x45,0xFF,0x29,0x66,0xFF,0x29,0x86,0xFF,0x29,0x66,0xFF,0x73,0xCF,0xFF,0xBE,0x59,0xFF,0xB5,0xF8,0xFF,0xBE,0x19,0xFF,0x7C,0x31,0xFF,0x29,0x66,0xFF,0x21,0x66,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xD3,0xFA,0x8C,0x92,0xFF,0x5A,0xEB,0xFF,0x3A,0x08,0xFF,0x7C,0x10,0xFF,0xBE,0x59,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB5,0xF8,0xFF,0xC6,0x7A,0xFF,0x73,0xCF,0xFF,0x3A,0x08,0xEF,0x63,0x6D,0x9A,0x7B,0xF0,0xA4,0x8C,0x72,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xAA,0xDE,0x9D,0x35,0xFF,0xC6,0x7A,0xFF,0xBE,0x59,0xFF,0xBE,0x39,0xFF,0x84,0x72,0xFF,0x5B,0x2D,0xFF,0xC6,0x7A,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0xB5,0xD8,0xFF,0xBE,0x5A,0xFF,0xC6,0x9B,0xFF,0x9D,0x35,0xFF,0x63,0x4E,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xF8,0xA8,0xCE,0x7A,0xFF,0xC6,0x9A,0xFF,0xB5,0xF8,0xFF,0x42,0x29,0xFF,0x31,0xA7,0xFF,0x4A,0xAB,0xFF,0xC6,0x5A,0xFF,0x63,0x4D,0xFF,0x31,0x87,0xFF,0x39,0xE8,0xFF,0xAD,0xD8,0xFF,0xBE,0x5A,0xFF,0xBE,0x19,0xFF,0xB5,0xF8,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0x19,0x5C,0xB5,0xF8,0xFF,0x8C,0xB3,0xFF,0xB5,0xD8,0xFF,0x21,0x25,0xFF,0x31,0x87,0xFF,0x42,0x29,0xFF,0xB6,0x19,0xFF,0x52,0xEC,0xFF,0x29,0x86,0xFF,0x29,0x66,0xFF,0x8C,0xD4,0xFF,0xA5,0x56,0xFF,0x9D,0x35,0xFF,0xC6,0x9B,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x8A,0x10,0x3A,0x29,0xFF,0x7C,0x11,0xFF,0x9D,0x56,0xA4,0x29,0x65,0x77,0x42,0x29,0xFF,0xAD,0x97,0xFF,0xBE,0x19,0xFF,0xAD,0xD8,0xFF,0x73,0xAF,0xFF,0x29,0x86,0xFF,0x6B,0x8F,0xFF,0xAD,0xD8,0xFF,0x31,0xA8,0x1C,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA8,0x13,0x3A,0x29,0x25,0x00,0x00,0x02,0x00,0x00,0x01,0xA5,0x55,0xE5,0xB6,0x18,0xFF,0xBE,0x39,0xFF,0xB6,0x19,0xFF,0xBE,0x39,0xFF,0x52,0xCC,0xFF,0x31,0xA7,0x86,0x42,0x49,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xF0,0x3D,0x4A,0x8A,0xFF,0xC6,0x5A,0xFF,0x94,0xD4,0xFF,0x63,0x6E,0xF4,0x5B,0x0D,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x29,0x4F,0xBE,0x39,0xC8,0x84,0x52,0x80,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_snow_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_snow_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_snow_png_data
-};
-
@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/sunny.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_sunny_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x68,0x17,0x6B,0x28,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x48,0xAB,0xBD,0x49,0xDA,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xE7,0x11,0xD5,0xE9,0xFF,0xEE,0x8A,0xFF,0x31,0xC7,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xE7,0x74,0xF6,0xC9,0xFF,0xF6,0xEA,0xFF,0x83,0xC8,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xB5,0x07,0xFA,0xF6,0xE9,0xFF,0xF6,0xE9,0xFF,0xD5,0xE8,0xFF,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x5A,0xC8,0x77,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA8,0x33,0xE6,0x48,0xFF,0xF6,0xE9,0xFF,0xFE,0xE9,0xFF,0xF6,0xC9,0xFF,0x42,0x08,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xC8,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xBD,0x48,0xFF,0x8C,0x28,0xAF,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xE8,0xB5,0xF6,0xC9,0xFF,0xF6,0xE9,0xFF,0xFE,0xE9,0xFF,0xF6,0xE9,0xFF,0x8B,0xE8,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x7B,0x88,0x88,0xCD,0x89,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x88,0xD4,0xF6,0xE9,0xFF,0xB5,0x28,0xDC,0x31,0x88,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0xC5,0x67,0xFF,0xF6,0xCA,0xFF,0xFE,0xE9,0xFF,0xF6,0xE9,0xFF,0xF6,0xCA,0xFF,0xE6,0x48,0xFF,0x42,0x08,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x0D,0xA4,0x68,0xD2,0xF6,0xE9,0xFF,0xAC,0xC9,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x87,0x9A,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xBD,0x47,0xF8,0x39,0xE7,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x27,0x41,0xF6,0x88,0xFF,0xF6,0xC9,0xFF,0xFE,0xE9,0xFF,0xF6,0xE9,0xFF,0xF6,0xC9,0xFF,0xFE,0xE9,0xFF,0x52,0xA7,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x3A,0x08,0x24,0xBD,0x28,0xF6,0xFE,0xE9,0xFF,0xFE,0xE9,0xFF,0x83,0xC8,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xC7,0x69,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xCD,0xA7,0xFF,0x42,0x28,0x4F,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xA7,0xA8,0xF6,0xCA,0xFF,0xF6,0xC9,0xFF,0xFE,0xE9,0xFF,0xFE,0xC9,0xFF,0xFE,0xC9,0xFF,0xFE,0xEA,0xFF,0x94,0x48,0xAF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x48,0x45,0xCD,0x88,0xFF,0xFE,0xE9,0xFF,0xFE,0xE9,0xFF,0xFE,0xE9,0xFF,0x62,0xE7,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x27,0x43,0xF6,0xC8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xEE,0x48,0xFF,0x52,0x67,0x76,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0xE7,0x60,0xD6,0x09,0xB5,0xD5,0xC8,0xE2,0xD5,0xC8,0xF6,0xD5,0xC8,0xF6,0xD5,0xC8,0xDC,0xD5,0xE8,0xA6,0xCD,0x87,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x68,0x63,
-    0xE6,0x28,0xFF,0xFE,0xE9,0xFF,0xFE,0xC9,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0x4A,0x47,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x25,0xE6,0x28,0xFF,0xFE,0xE9,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE9,0xFF,
-    0xFE,0xA8,0xFF,0x73,0x27,0x8D,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x08,0x6F,0xF6,0xA8,0xFF,0xF6,0xE9,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xEE,0x48,0xFF,0x3A,0x06,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x10,0xC5,0x67,0xFF,0xFE,0xE9,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC9,0xFF,0xF6,0xA8,0xFF,0x9C,0x68,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x67,0x56,0xF6,0xA9,0xFF,0xFE,0xC9,0xFF,
-    0xF6,0xA8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xF6,0xA8,0xFF,0xCD,0xA8,0xFF,0x29,0xC7,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xA4,0x87,0xFF,0xFE,0xE9,0xFF,0xFE,0xE9,0xFF,0xFE,0xE8,0xFF,0xFE,0xC8,0xFF,
-    0xF6,0xC8,0xFF,0xDE,0x08,0xFA,0x7B,0x87,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x87,0x4C,0xDD,0xE8,0xFF,0xF6,0xA8,0xFF,0xF6,0xC9,0xFF,0xFE,0xC8,0xFF,0xF6,0xA8,0xFF,0xF6,0xA8,0xFF,0xAC,0xC7,0xFF,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x87,0xEB,0xFE,0xE9,0xFF,0xFE,0xE9,0xFF,0xFE,0xE9,0xFF,0xEE,0x68,0xFF,0x94,0x08,0xA6,0x29,0x68,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA6,0x0E,0x8B,0xE7,0xAD,
-    0xE6,0x28,0xFF,0xF6,0xC9,0xFF,0xF6,0xA8,0xFF,0xF6,0xA8,0xFF,0x8B,0xC7,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xA7,0x95,0xFE,0xE9,0xFF,0xFE,0xE8,0xFF,0xAC,0xC7,0xC8,0x29,0x88,0x23,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x31,0x88,0x14,0x4A,0x47,0x2E,0x83,0x87,0x48,0xA4,0xA7,0x5A,0xC5,0x87,0x6B,0xD5,0xE7,0x79,0xE6,0x47,0x74,0xE6,0x67,0x6D,0xDE,0x27,0x64,0xCD,0xA7,0x4C,0xB4,0xE7,0x35,0x8B,0xE8,0x23,0x5A,0xC9,0x0E,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA8,0x2C,0xB4,0xA7,0xDC,0xF6,0x87,0xFF,0xF6,0xA9,0xFF,0x62,0xC7,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x27,0x3E,0xD5,0xC8,0x97,0x52,0xA7,0x21,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x4A,0x48,0x3E,0x9C,0x48,0xBA,0xD5,0xC7,0xFF,0xEE,0x88,0xFF,0xF6,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xF6,0xC8,0xFF,0xDE,0x27,0xDE,0xA4,0x88,0x80,0x5A,0x88,0x34,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x52,0x88,0x38,0xE5,0xE8,0xC6,0x4A,0x46,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x89,0x0A,0x7B,0x88,0x73,0xCD,0xA8,0xFA,0xF6,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xD5,0xE8,0xFF,0x8C,0x08,0xB5,0x39,0xE7,0x29,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x7B,0x88,0x77,0xDE,0x28,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFF,0x07,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x08,0xFF,0xFF,0x08,0xFF,0xEE,0x68,0xFF,0x8C,0x07,0xC8,0x3A,0x08,0x1B,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x52,0x88,0x43,0xE6,0x27,0xF6,0xFF,0x08,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFF,0x08,0xFF,0xFF,0x07,0xFF,0xEE,0x67,0xFF,0x5A,0xC7,0x72,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0xA4,0x67,0xB1,0xFE,0xC7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,
-    0xBD,0x27,0xCC,0x31,0xA6,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xA5,0x06,0x42,0x08,0x08,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x27,0x21,0xC5,0x67,0xF2,0xFE,0xE8,0xFF,
-    0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xDE,0x07,0xF4,0x5A,0xA8,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x31,0x86,0x0A,0x29,0xA8,0x18,0x42,0x07,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x87,0x8A,0xD5,0xC8,0xFF,0xBD,0x07,0xFF,0x9C,0x47,0xFD,0x73,0x47,0xC4,0x52,0x87,0x80,0x42,0x07,0x48,0x31,0x87,0x1E,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x67,0x42,0xDE,0x06,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,
-    0xFE,0xE7,0xFF,0xFE,0xE8,0xFF,0xEE,0x87,0xFF,0x6A,0xE8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x31,0xA6,0x0E,0x31,0xA7,0x2A,0x39,0xE7,0x56,0x52,0x67,0x92,0x73,0x27,0xDC,0x94,0x07,0xFF,0xBC,0xE7,0xFF,0xD5,0xA8,0xFF,0xBD,0x07,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xD5,0xA8,0xE2,0xF6,0xE9,0xFF,0xF6,0xC8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xF6,0xA8,0xFF,0xDE,0x07,0xFF,0xBD,0x27,0xFF,0x94,0x07,0xCE,0x6B,0x08,0x52,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x87,0x50,0xF6,0x86,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,
-    0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE7,0xFF,0xFE,0xE6,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE8,0xFF,0xFE,0xC7,0xFF,0x6B,0x28,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0x3B,0x73,0x27,0xB7,0x9C,0x27,0xFF,0xC5,0x27,0xFF,0xDD,0xC7,0xFF,0xEE,0x47,0xFF,0xF6,0x87,0xFF,0xFE,0x88,0xFF,0xF6,0x88,0xFF,0xF6,0x88,0xFF,0xE5,0xC8,0xF8,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE7,0x15,0xDE,0x07,0xFD,0xF6,0xE8,0xFF,0xF6,0xC8,0xFF,0xFE,0xE8,0xFF,0xFE,0xE8,0xFF,0xFE,0xC8,0xFF,0xF6,0xC8,0xFF,0xFE,0xC9,0xFF,0xEE,0x48,0xFF,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x48,0x48,0xF6,0x87,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,
-    0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0x63,0x08,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0x37,0xDD,0x87,0xFF,0xF6,0x89,0xFF,0xF6,0x68,0xFF,0xF6,0x68,0xFF,0xF6,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xF6,0x88,0xFF,0xEE,0x28,0xFF,0x42,0x48,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x87,0x38,0xE6,0x47,0xFF,0xF6,0xE9,0xFF,0xFE,0xC8,0xFF,0xFE,0xE8,0xFF,0xF6,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0x73,0x67,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x07,0x27,0xDD,0xE6,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,
-    0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xE6,0xFF,0xFE,0xC8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC8,0xFF,0xEE,0x67,0xFD,0x52,0xA7,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x5A,0xA7,0xC4,0xF6,0x68,0xFF,0xF6,0x68,0xFF,0xF6,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xF6,0x88,0xFF,0xF6,0x47,0xFF,0x6B,0x07,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x07,0x60,0xEE,0x88,0xFF,0xF6,0xE9,0xFF,0xFE,0xC8,0xFF,0xF6,0xC8,0xFF,0xFE,0xC8,0xFF,0xCD,0x88,0xFF,0x31,0xA6,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x48,0x0C,0xBD,0x27,0xF8,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,
-    0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC8,0xFF,0xDD,0xE7,0xE5,0x29,0x4A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xE7,0x11,0xAC,0xA7,0xFF,0xF6,0x88,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0xF6,0x88,0xFF,0xF6,0x68,0xFF,0x83,0x87,0xB8,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x7B,0x87,0x86,0xF6,0xA8,0xFF,0xFE,0xE8,0xFF,0xF6,0xC8,0xFF,0xEE,0x88,0xFF,0x3A,0x27,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8B,0xC7,0xBE,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,
-    0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC6,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC6,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC6,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC6,0xFF,0xFE,0xA8,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xC5,0x27,0xB1,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x55,0xE6,0x08,0xFF,0xF6,0x68,0xFF,0xF6,0x67,0xFF,0xF6,0x68,0xFF,0x9C,0x07,0xDE,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9C,0x26,0xA6,0xF6,0xA8,0xFF,0xFE,0xE9,0xFF,0xAC,0xA7,0xFF,0x31,0x86,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x50,0xF6,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC6,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC6,0xFF,
-    0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0x6B,0x28,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x94,0x07,0xB8,0xF6,0x68,0xFF,0xFE,0x68,0xFF,0xBC,0xC7,0xF2,0x21,0xC7,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xB4,0xE8,0xC6,0xEE,0x48,0xFF,0x3A,0x27,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x08,0xCD,0x47,0xFA,0xFE,0xC8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,
-    0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA6,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xF6,0x67,0xFA,0x4A,0x69,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x68,0x0B,0xDD,0xC8,0xFA,0xCD,0x47,0xF8,0x29,0xC7,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x07,0x6B,0x27,0xCC,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xE7,0x7C,0xFE,0xC7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xC6,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA6,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,
-    0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA6,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0x94,0x28,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0x37,0x42,0x66,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0xCD,0x67,0xFF,0xFE,0xA8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA6,0xFF,0xFE,0xA7,0xFF,
-    0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x88,0xFF,0xFE,0xA6,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xF6,0x48,0xFF,0x42,0x28,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x07,0x60,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA6,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA6,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA6,0xFF,
-    0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA8,0xFF,0x9C,0x28,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xBC,0xE6,0xEB,0xFE,0xA8,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,
-    0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA6,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xFE,0xA6,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xDD,0xC8,0xFF,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x1F,0xEE,0x27,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,
-    0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0x62,0xC8,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x87,0x69,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,
-    0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x86,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA8,0xFF,0xB4,0x88,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x07,0xDE,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x86,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x86,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x66,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,
-    0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x86,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xE5,0xC8,0xF6,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0xED,0xE7,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,
-    0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x66,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x48,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xF6,0x48,0xFF,0x42,0x08,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x1C,0xF6,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,
-    0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0x62,0xC8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x87,0x3E,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x66,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,
-    0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x48,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0x93,0xC8,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0x86,0x14,0x4A,0x47,0x52,0x7B,0x67,0xA6,0xBD,0x08,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x66,0x5F,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,
-    0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xC4,0xC8,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0xCC,0xC7,0x9C,0xA4,0x27,0x9D,0x5A,0xA7,0x49,0x31,0x86,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x08,0x0C,0x31,0xA7,0x57,0x52,0x67,0xE0,0xBC,0xC7,0xFF,0xF6,0x47,0xFF,0xF6,0x88,0xFF,0xE6,0x29,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x26,0x85,0xFE,0x47,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x46,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,
-    0xFE,0x47,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xD5,0x67,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x67,0x1B,0xDD,0x47,0xFF,0xF6,0x08,0xFF,0xF6,0x07,0xFF,0xED,0xA7,0xFF,0x8B,0x87,0xD0,0x39,0xE7,0x4A,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0xA7,0x26,0x52,0x68,0xAB,0xA4,0x68,0xFF,0xDD,0xA8,0xFF,0xF6,0x69,0xFF,0xF6,0x89,0xFF,0xF6,0x68,0xFF,0xF6,0x68,0xFF,0xEE,0x08,0xD2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0x86,0x97,0xFE,0x47,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,
-    0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x28,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x48,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xE5,0xA8,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x66,0x1D,0xD5,0x28,0xFF,0xF6,0x08,0xFF,0xF5,0xE7,0xFF,0xF6,0x08,0xFF,0xF6,0x08,0xFF,0xF5,0xC8,0xFF,0xD5,0x07,0xFF,0x83,0x48,0xA8,0x39,0xC8,0x28,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x48,0x27,0x94,0x08,0xD6,0xD5,0x48,0xFF,0xF6,0x28,0xFF,0xF6,0x68,0xFF,0xF6,0x69,0xFF,0xF6,0x89,0xFF,0xF6,0x89,0xFF,0xFE,0x88,0xFF,0xF6,0x88,0xFF,0xE6,0x08,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xC6,0xA6,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,
-    0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x28,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xE5,0xA8,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA6,0x13,0xD5,0x28,0xFF,0xFE,0x08,0xFF,0xF6,0x07,0xFF,0xF6,0x08,0xFF,0xF6,0x08,0xFF,0xF6,0x07,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xED,0xA7,0xFF,0xBC,0x87,0xDC,0x73,0x07,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x27,0x19,0x9B,0xE7,0xBE,0xDD,0x89,0xFF,0xF6,0x49,0xFF,0xF6,0x69,0xFF,0xF6,0x69,0xFF,0xF6,0x69,0xFF,0xF6,0x69,0xFF,0xF6,0x89,0xFF,0xF6,0x69,0xFF,0xE5,0xE8,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xC6,0xA6,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,
-    0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x28,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xED,0xC8,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0A,0xD5,0x07,0xFF,0xFE,0x08,0xFF,0xF6,0x08,0xFF,0xFE,0x08,0xFF,0xF6,0x08,0xFF,0xFE,0x08,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xE5,0x68,0xFF,0xB4,0x88,0xC2,0x6B,0x07,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x66,0x1C,0x6A,0xC7,0x9A,0xC5,0x07,0xFF,0xEE,0x08,0xFF,0xF6,0x49,0xFF,0xF6,0x69,0xFF,0xF6,0x68,0xFF,0xF6,0x48,0xFF,0xE5,0xE8,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0xA7,0x93,0xFE,0x27,0xFF,0xFE,0x26,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,
-    0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x46,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xE5,0xC8,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xD5,0x27,0xFF,0xFE,0x08,0xFF,0xF6,0x07,0xFF,0xFE,0x08,0xFF,0xF6,0x08,0xFF,0xED,0xA8,0xFF,0xD4,0xE7,0xFF,0x7B,0x27,0xA8,0x31,0xC7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0x39,0xE7,0x55,0x7B,0x47,0xE5,0xE5,0xA7,0xFF,0xF6,0x48,0xFF,0xF6,0x48,0xFF,0xED,0xE8,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x46,0x80,0xFE,0x27,0xFF,0xFE,0x26,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,
-    0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x28,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xDD,0x67,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xDD,0x27,0xFF,0xF6,0x08,0xFF,0xF5,0xE7,0xFF,0xED,0x67,0xFF,0x8B,0x66,0xF2,0x39,0xE7,0x63,0x2A,0x08,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x39,0xC7,0x20,0x5A,0x87,0x90,0x9C,0x07,0xFF,0xDD,0x67,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0xA6,0x5C,0xFE,0x27,0xFF,0xFE,0x06,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,
-    0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x08,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xC4,0xC7,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x07,0xDA,0xB4,0x47,0xFF,0x62,0xA7,0xAA,0x31,0xA7,0x2A,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x3A,0x07,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xE7,0x3A,0xFE,0x07,0xFF,0xFE,0x06,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,
-    0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x08,0xFF,0xFE,0x27,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0x9C,0x07,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x07,0x37,0x29,0x68,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE7,0x19,0xF5,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,
-    0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE8,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE8,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x08,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0x6A,0xE8,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0xED,0x87,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,
-    0xFE,0x07,0xFF,0xFE,0x08,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xF6,0x07,0xFF,0x3A,0x67,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xA7,0xCC,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,
-    0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE8,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE8,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xE5,0x87,0xFF,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x67,0x5C,0xFE,0x07,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE8,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,
-    0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFE,0x07,0xFF,0xFE,0x07,0xFF,0xB4,0x67,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x27,0x16,0xF5,0xA7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,
-    0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0x62,0xC8,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xC4,0xA7,0xDC,0xFE,0x08,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xE7,0xFF,
-    0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xFD,0xE7,0xFF,0xD5,0x27,0xFF,0x31,0xA6,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x27,0x49,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xC7,0xFF,
-    0xFD,0xA7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC6,0xFF,0xFD,0xE7,0xFF,0x8B,0xA8,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xDD,0x07,0xFA,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xA8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xA8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,
-    0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xED,0x67,0xFF,0x42,0x07,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0x11,0x52,0x67,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x47,0x60,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,
-    0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0x8B,0x87,0xBE,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x68,0x38,0x4A,0x48,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x29,0x07,0xAC,0x67,0xE2,0xDD,0x67,0xFD,0x29,0x48,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xE5,0x27,0xF4,0xFD,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,
-    0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xC7,0xFF,0xFD,0xC7,0xFF,0xED,0x67,0xFF,0x31,0xA6,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xC7,0x0D,0xC4,0xA7,0xFD,0xDD,0x48,0xFF,0x31,0xE7,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,0x93,0xE7,0xC2,0xF6,0x48,0xFF,0xFE,0x68,0xFF,0x83,0x87,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x67,0x3E,0xFD,0x87,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0x87,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,
-    0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA6,0xFF,0xFD,0xC6,0xFF,0x62,0xC7,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0xC7,0xAB,0xF5,0xA7,0xFF,0xF5,0xC8,0xFF,0xE5,0x68,0xFF,0x31,0xC7,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x73,0x07,0x9A,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xE5,0x87,0xFF,0x29,0x87,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xB4,0x07,0xB7,0xFD,0xA7,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0x87,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0xA8,0xFF,0xFD,0x87,0xFF,0xFD,0xA7,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0xA7,0xFF,0xFD,0x88,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA8,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0x87,0xFF,
-    0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xC4,0x87,0xBE,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x87,0x24,0xDD,0x07,0xFF,0xF5,0xC7,0xFF,0xF5,0xC7,0xFF,0xF5,0xC8,0xFF,0xBC,0x87,0xFF,0x31,0xE7,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xA7,0x6C,0xED,0xE8,0xFF,0xF6,0x48,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0x93,0xC7,0xDE,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0A,0xDC,0xC7,0xF6,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,
-    0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0xA7,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xDD,0x07,0xE9,0x22,0x49,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x93,0x87,0xC6,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xFD,0xC7,0xFF,0xF5,0xC7,0xFF,0xFD,0xE7,0xFF,0xA4,0x07,0xF8,0x29,0xA8,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x47,0x3A,0xE5,0xA7,0xFF,0xF6,0x29,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF5,0xE7,0xFF,0x42,0x07,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x67,0x2A,0xED,0x47,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,
-    0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0xA7,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xED,0x47,0xFA,0x52,0x87,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x67,0x1E,0xF5,0x87,0xFF,0xF5,0xA7,0xFF,0xF5,0xA7,0xFF,0xFD,0xC8,0xFF,0xFD,0xC7,0xFF,0xF5,0xC7,0xFF,0xFD,0xC7,0xFF,0x8B,0x87,0xE7,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x14,0xDD,0x47,0xFD,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x27,0xFF,0xF6,0x07,0xFF,0xF6,0x07,0xFF,0xB4,0x87,0xF8,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xC7,0x54,0xFD,0x87,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,
-    0xFD,0x67,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x88,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x87,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x88,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0x62,0xC8,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x86,0x92,0xF5,0xA8,0xFF,0xF5,0xA7,0xFF,0xFD,0xA8,0xFF,0xF5,0xA7,0xFF,0xF5,0xC7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0xFD,0xA7,0xFF,0x6A,0xE7,0xC6,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xD5,0x47,0xDE,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xF6,0x08,0xFF,0xED,0xC7,0xFF,0xDD,0x47,0xFF,0xC4,0xA7,0xFF,0xA4,0x07,0xFD,0x42,0x07,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0xE7,0x69,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,
-    0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x87,0xFF,0xFD,0x67,0xFF,0x62,0xC7,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x86,0x4A,0x83,0x47,0xCA,0xAC,0x07,0xFF,0xD4,0xC7,0xFF,0xED,0x47,0xFF,0xF5,0x67,0xFF,0xF5,0x87,0xFF,0xF5,0x87,0xFF,0xF5,0x87,0xFF,0xF5,0x87,0xFF,0x4A,0x27,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x48,0x80,0xDD,0x88,0xFF,0xC4,0xE7,0xFF,0xA4,0x27,0xFD,0x8B,0x87,0xD4,0x6A,0xE7,0xA1,0x52,0x87,0x70,0x42,0x27,0x47,0x31,0xE7,0x25,0x21,0xC7,0x0D,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0xE7,0x67,0xF5,0x27,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,
-    0xFD,0x47,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xED,0x27,0xFA,0x62,0xA7,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x31,0x87,0x19,0x39,0xE7,0x41,0x52,0x47,0x7C,0x72,0xC7,0xC8,0x93,0x66,0xFF,0xB4,0x26,0xFF,0xD4,0xC7,0xFF,0xD4,0xC6,0xFF,0x42,0x08,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x31,0x86,0x05,0x00,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xA7,0x46,0xE4,0xE7,0xFF,0xFD,0x67,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x67,0xFF,0xFD,0x47,0xFF,0xFD,0x48,0xFF,0xFD,0x68,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x47,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x47,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x68,0xFF,0xFD,0x68,0xFF,0xFD,0x48,0xFF,0xFD,0x67,0xFF,0xFD,0x67,0xFF,0xFD,0x47,0xFF,
-    0xFD,0x67,0xFF,0xDC,0xC7,0xE9,0x52,0x88,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x19,0xC7,0x09,0x31,0xA8,0x18,0x42,0x07,0x2A,0x39,0xE7,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xC7,0x1A,0xCC,0x47,0xE5,
-    0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x48,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x48,0xFF,0xFD,0x48,0xFF,0xFD,0x48,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x48,0xFF,0xFD,0x48,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xBC,0x47,0xBE,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x72,0xC6,0x83,0xF5,0x27,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x48,0xFF,0xFD,0x27,0xFF,0xFD,0x47,0xFF,0xFD,0x48,0xFF,0xFD,0x48,0xFF,0xFD,0x28,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x27,0xFF,0xFD,0x48,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xF5,0x07,0xFF,0x62,0xA7,0x61,
-    0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x42,0x27,0x1A,0x9B,0x67,0xB8,0xF5,0x07,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x27,0xFF,0xFD,0x47,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x47,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x47,0xFF,0xFD,0x48,0xFF,0xFD,0x28,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x27,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xFD,0x47,0xFF,0xF5,0x07,0xFF,0x93,0x67,0xB8,0x39,0xC7,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x27,0x1D,0x9B,0x87,0x9D,0xE4,0xA7,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x47,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x47,0xFF,0xFD,0x27,0xFF,0xDC,0x87,0xFF,0x93,0x67,0xA6,0x41,0xE7,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xA7,0x09,0xCC,0xC7,0xCC,0x4A,0x47,0x3F,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x07,0x6A,0xA7,0x3D,0xB3,0xE7,0x9A,0xE4,0xA7,0xF8,0xF5,0x07,0xFF,0xFD,0x07,0xFF,0xFD,0x07,0xFF,0xFD,0x27,0xFF,0xFD,0x07,0xFF,0xF5,0x07,0xFF,0xFD,0x07,0xFF,0xFD,0x27,0xFF,0xF5,0x07,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xFD,0x27,0xFF,0xF5,0x27,0xFF,0xF5,0x07,0xFF,0xE4,0xA7,0xFA,0xB3,0xE7,0x95,0x62,0xA7,0x3A,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x08,0x52,0x67,0x67,0xDD,0x06,0xA3,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x87,0x49,0xF5,0xE8,0xFF,0xFD,0xC7,0xFF,0xBC,0x67,0xE5,0x31,0xE7,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x39,0xC7,0x0D,0x5A,0x87,0x23,0x93,0x27,0x41,0xBC,0x07,0x64,0xD4,0x47,0x79,0xE4,0x87,0x8E,0xEC,0xA7,0x9C,0xEC,0xA7,0x93,0xE4,0x86,0x8A,0xD4,0x47,0x77,0xBB,0xE7,0x56,0x93,0x47,0x3C,0x62,0x87,0x1F,0x39,0xC7,0x09,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
-    0x31,0xE8,0x54,0xC4,0x67,0xFA,0xFD,0xA7,0xFF,0xF5,0xA8,0xFF,0x52,0x47,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x07,0xAB,0xF5,0xE8,0xFF,0xF5,0xC7,0xFF,0xF5,0xC7,0xFF,0xED,0x67,0xFF,
-    0xAC,0x08,0xA8,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0x11,0xAC,0x28,0xCC,0xED,0x68,0xFF,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0x7B,0x07,0xAF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9B,0xE7,0xFD,0xF5,0xC8,0xFF,0xF5,0xC7,0xFF,0xF5,0xC7,0xFF,0xF5,0xC8,0xFF,0xFD,0xC7,0xFF,0xED,0x48,0xFA,0x93,0x88,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x28,0x30,0xE5,0x27,0xFD,0xF5,0xA8,0xFF,
-    0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0xA7,0xFF,0xF5,0xA8,0xFF,0xAB,0xC7,0xFD,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xC7,0x0D,0xC4,0xA7,0xFF,0xF5,0xC8,0xFF,0xF5,0xC7,0xFF,0xFD,0xC7,0xFF,0xF5,0xC7,0xFF,
-    0xF5,0xC7,0xFF,0xF5,0xA8,0xFF,0xA4,0x07,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0xE7,0x80,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0x87,0xFF,0xCC,0x66,0xFF,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x29,0xED,0x67,0xFF,0xFD,0xC8,0xFF,0xF5,0xC8,0xFF,0xF5,0xC7,0xFF,0xF5,0xC8,0xFF,0xFD,0xA8,0xFF,0x8B,0x88,0x80,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x67,0x2B,0x21,0x87,0x8E,0x29,0xA7,0x8E,0x21,0x86,0x6F,0x29,0x86,0x47,0x29,0x87,0x20,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x7B,0x27,0x8E,0xFD,0x87,0xFF,
-    0xF5,0xA8,0xFF,0xF5,0x88,0xFF,0xF5,0x88,0xFF,0xF5,0x88,0xFF,0xE5,0x07,0xFF,0x39,0xE6,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x07,0x4E,0xF5,0xA7,0xFF,0xFD,0xC8,0xFF,0xF5,0xA7,0xFF,0xF5,0xC8,0xFF,0xED,0x68,0xFF,
-    0x62,0xA7,0x79,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x66,0xF2,0xC4,0x67,0xFF,0xBC,0x68,0xFF,0xB4,0x48,0xFF,0xBC,0x47,0xFF,0xC4,0x67,0xFF,0xC4,0x67,0xFF,0xB4,0x07,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0x47,0x77,0xE5,0x07,0xFF,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0x88,0xFF,0xF5,0x67,0xFF,0x4A,0x26,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x87,0x7F,0xFD,0xC7,0xFF,0xF5,0xA7,0xFF,0xFD,0xC8,0xFF,0xD4,0xE7,0xFF,0x52,0x47,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0x27,0xD2,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0xA8,0xFF,0xF5,0x88,0xFF,0xF5,0x88,0xFF,0x9B,0xC7,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x4A,0x07,0x50,0xC4,0x86,0xFF,0xF5,0x87,0xFF,0xF5,0x67,0xFF,0xF5,0x67,0xFF,0x6A,0x87,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7A,0xE6,0xB1,0xFD,0xC7,0xFF,0xF5,0xA7,0xFF,0xC4,0x67,0xFF,0x42,0x07,0x39,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xC8,0x73,0xF5,0xA8,0xFF,0xF5,0x88,0xFF,0xF5,0xA8,0xFF,0xF5,0x88,0xFF,0xF5,0x88,0xFF,0xFD,0x87,0xFF,0x5A,0x87,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0x29,0xB4,0x06,0xF8,0xF5,0x67,0xFF,0xF5,0x87,0xFF,0x8B,0x26,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x86,0xDC,0xF5,0xA8,0xFF,0xAC,0x06,0xE9,0x29,0xA8,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0x2A,0xF5,0x68,0xFF,0xF5,0x88,0xFF,0xF5,0x88,0xFF,0xFD,0x88,0xFF,0xF5,0xA8,0xFF,0xED,0x47,0xFF,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x10,0xA3,0xA6,0xDC,0xF5,0x67,0xFF,0xB4,0x07,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0xE7,0xEB,0x93,0x87,0xAA,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xB4,0x08,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xF5,0xA8,0xFF,0xAB,0xC6,0xD8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x72,0xC6,0xAF,0xD4,0xA7,0xFF,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x27,0x1E,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x27,0x97,0xF5,0x88,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xF5,0x87,0xFF,0x4A,0x27,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0x67,0x77,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x25,0xE5,0x08,0xFF,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xDC,0xE7,0xFF,0x31,0xA6,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9B,0xA7,0xE7,0xFD,0xA8,0xFF,0xFD,0xA8,0xFF,0xA3,0xA7,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE7,0x4D,0xF5,0x68,0xFF,0xF5,0x68,0xFF,0x4A,0x06,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xCC,0x88,0xF2,0xCC,0x88,0xF6,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x27,0x32,0x83,0x27,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_sunny_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_sunny_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_sunny_png_data
-};
-
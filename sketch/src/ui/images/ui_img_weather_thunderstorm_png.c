@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/thunderstorm.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_thunderstorm_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x4A,0xCB,0x14,0x5B,0x0C,0x3E,0x6B,0x8E,0x76,0x73,0xCF,0xB1,0x7B,0xCF,0xE0,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFA,0x73,0xAF,0xDC,0x6B,0x8E,0xA4,0x5B,0x0D,0x69,0x4A,0x6B,0x31,0x31,0x89,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0x8B,0x1F,0x63,0x4E,0x82,0x7B,0xF0,0xF6,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x73,0xCF,0xFF,0x63,0x4D,0xCC,0x4A,0x6A,0x43,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x4A,0x6A,0x35,0x73,0xAF,0xDA,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7C,0x10,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x73,0x8F,0xF4,0x4A,0x8A,0x50,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0x1B,0x6B,0x8F,0xC4,0x7C,0x10,0xFF,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xCF,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7C,0x10,0xFF,0x73,0xAF,0xDA,0x3A,0x09,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x52,0xCC,0x72,0x73,0xF0,0xFF,0x7B,0xF0,0xFF,
-    0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x52,0xAB,0x6F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x5B,0x2D,0xB1,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xEF,0xFF,0x7B,0xF0,0xFF,0x7B,0xEF,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x84,0x10,0xFF,0x7C,0x10,0xFF,0x5B,0x0C,0xB3,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x63,0x4D,0xC0,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x7B,0xD0,0xFF,0x7B,0xF0,0xFF,
-    0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x7B,0xD0,0xFF,0x7B,0xCF,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xEF,0xFF,0x7B,0xD0,0xFF,0x7B,0xEF,0xFF,0x7B,0xCF,0xFF,0x73,0xD0,0xFF,0x7B,0xEF,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x7C,0x10,0xFF,0x5B,0x0D,0xD0,0x31,0x88,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x63,0x2D,0xA6,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xEF,0xFF,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x7B,0xD0,0xFF,0x7B,0xCF,0xFF,0x7B,0xD0,0xFF,0x7B,0xCF,0xFF,0x7B,0xD0,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xEF,0xFF,0x7B,0xEF,0xFF,0x7B,0xF0,0xFF,0x7B,0xEF,0xFF,0x7B,0xEF,0xFF,0x7B,0xD0,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xEF,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7C,0x10,0xFF,0x52,0xCB,0xFF,0x31,0xA7,0x7A,0x31,0x88,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xEC,0x63,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x73,0xCF,0xFF,0x73,0xEF,0xFF,0x73,0xCF,0xFF,
-    0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x7B,0xCF,0xFF,0x73,0xD0,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xEF,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x7B,0xEF,0xFF,0x7B,0xEF,0xFF,0x7B,0xF0,0xFF,0x7B,0xEF,0xFF,0x4A,0x6A,0xFF,0x39,0xC8,0xFF,0x42,0x49,0xEB,0x4A,0x8B,0x97,0x52,0xCB,0x65,0x52,0xCB,0x4C,0x52,0xAB,0x33,0x42,0x69,0x1D,0x42,0x28,0x0B,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x4A,0x1C,0x7B,0xCF,0xFF,0x7B,0xF0,0xFF,0x7B,0xEF,0xFF,0x7B,0xD0,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x7B,0xEF,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x7B,0xEF,0xFF,
-    0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x6B,0x6E,0xEF,0x5A,0xEC,0x85,0x42,0x49,0x1F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,0x6B,0x8E,0xDC,0x7B,0xF0,0xFF,0x7B,0xD0,0xFF,0x7B,0xEF,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,
-    0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x63,0x2D,0xDC,0x42,0x4A,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAB,0x5F,0x7B,0xEF,0xFF,0x7B,0xCF,0xFF,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,
-    0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x6B,0xAF,0xFF,0x6B,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x5B,0x0C,0x9F,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0x73,0xAF,0xFD,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,
-    0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x6B,0x8E,0xD6,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8B,0x7C,0x7B,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,
-    0x73,0xAE,0xFF,0x73,0x8F,0xFF,0x73,0xAF,0xFF,0x6B,0xAE,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0x8F,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xCF,0xFF,0x6B,0x8F,0xDC,0x4A,0x49,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x07,0x6B,0x6D,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,
-    0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x6B,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAE,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x6B,0xAE,0xFF,0x6B,0xAF,0xFF,0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0xAE,0xFF,0x73,0x8E,0xFF,0x73,0x8F,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x6B,0x8E,0xC4,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x09,0x49,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAE,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x6B,0xAE,0xFF,0x73,0xAF,0xFF,0x6B,0xAF,0xFF,0x6B,0xAF,0xFF,0x73,0xAF,0xFF,0x6B,0xAE,0xFF,0x6B,0xAE,0xFF,0x6B,0xAE,0xFF,0x73,0xAF,0xFF,0x6B,0xAE,0xFF,0x6B,0xAF,0xFF,0x6B,0xAE,0xFF,0x6B,0xAF,0xFF,0x6B,0xAE,0xFF,0x6B,0xAF,0xFF,0x6B,0x8E,0xFF,0x6B,0x8F,0xFF,0x73,0x8E,0xFF,0x6B,0x8E,0xFF,
-    0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x73,0x8E,0xFF,0x73,0xAE,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x63,0x2D,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8B,0xB8,0x73,0xCF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAE,0xFF,0x73,0xAF,0xFF,
-    0x73,0xAF,0xFF,0x6B,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAE,0xFF,0x73,0xAE,0xFF,0x6B,0xAF,0xFF,0x73,0xAE,0xFF,0x73,0x8E,0xFF,0x73,0xAF,0xFF,0x6B,0x8E,0xFF,0x6B,0xAF,0xFF,0x6B,0xAE,0xFF,0x6B,0xAF,0xFF,0x6B,0xAF,0xFF,0x6B,0xAF,0xFF,0x6B,0xAE,0xFF,0x6B,0x8E,0xFF,0x6B,0x8F,0xFF,0x6B,0xAE,0xFF,0x6B,0xAF,0xFF,0x6B,0xAE,0xFF,0x6B,0xAE,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0xAE,0xFF,0x6B,0x8E,0xFF,0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0xAE,0xFF,0x6B,0x8E,0xFF,0x6B,0xAE,0xFF,0x73,0xAE,0xFF,0x73,0x8E,0xFF,0x6B,0x8E,0xFF,0x73,0xAF,0xFF,0x52,0xAB,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x52,0xEC,0xFA,0x73,0xAF,0xFF,0x6B,0x8F,0xFF,0x73,0x8F,0xFF,0x73,0x8E,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x73,0xAE,0xFF,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x6B,0x8F,0xFF,0x73,0x8E,0xFF,0x6B,0xAE,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0xAE,0xFF,0x73,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,
-    0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xED,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xE7,0x11,0x31,0xC8,0xA3,0x5B,0x2D,0xFF,0x6B,0x8F,0xFF,0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0xAE,0xFF,0x6B,0x8F,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,
-    0x6B,0x8E,0xFF,0x6B,0xAE,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x52,0xEB,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x28,0x0F,0x4A,0x6A,0x39,0x52,0xCB,0x77,0x63,0x2D,0xDC,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0xAE,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,
-    0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFD,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x49,0x37,0x63,0x2D,0xD0,0x6B,0xAE,0xFF,0x73,0xAF,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,
-    0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x42,0x49,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0x18,0x63,0x4D,0xD2,0x73,0xAF,0xFF,0x73,0xAF,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,
-    0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x4E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,0x52,0xCB,0xAF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAB,0x50,0x6B,0x8E,0xFF,0x6B,0xAF,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x8E,0xFF,
-    0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x6B,0x4E,0xFF,0x63,0x4E,0xFF,0x6B,0x4E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x6E,0xFF,0x63,0x6D,0xFF,0x6B,0x4E,0xFF,0x63,0x4D,0xFF,0x6B,0x4E,0xFF,0x63,0x6D,0xFF,0x63,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x6D,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x5B,0x2D,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x5A,0xEC,0x77,0x6B,0xAE,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6D,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x4E,0xFF,0x63,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x4D,0xFF,0x63,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x4D,0xFF,0x63,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x6E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x6B,0x4E,0xFF,
-    0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x6D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6D,0xFF,0x39,0xE7,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xEC,0x73,0x6B,0x8E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x4E,0xFF,0x6B,0x4E,0xFF,0x6B,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6E,0xFF,0x6B,0x4E,0xFF,
-    0x63,0x6E,0xFF,0x6B,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x6E,0xFF,0x63,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x6D,0xFF,0x63,0x6D,0xFF,0x63,0x6D,0xFF,0x63,0x6E,0xFF,0x63,0x6D,0xFF,0x63,0x6D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x6D,0xFF,0x3A,0x08,0xCA,0x29,0x4A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xCC,0x46,0x6B,0x6E,0xFF,0x63,0x4E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x4E,0xFF,0x6B,0x4E,0xFF,0x6B,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x6D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x6D,0xFF,0x63,0x6D,0xFF,0x63,0x6D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,
-    0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x52,0xCC,0xE2,0x3A,0x08,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x8A,0x13,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x6B,0x4E,0xFF,0x6B,0x6E,0xFF,0x6B,0x4E,0xFF,0x6B,0x6E,0xFF,0x6B,0x6E,0xFF,0x6B,0x4E,0xFF,0x6B,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,
-    0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x52,0xCC,0xAF,0x3A,0x28,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x63,0x2D,0xC8,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4E,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,
-    0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x0D,0xFF,0x4A,0x6A,0x58,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAB,0x3F,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,
-    0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2C,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2C,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2C,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x4A,0xAB,0x8B,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x63,0x2D,0xE9,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x4D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2C,0xFF,0x5B,0x2C,0xFF,0x63,0x2D,0xFF,0x5B,0x2C,0xFF,0x5B,0x2C,0xFF,0x5B,0x2D,0xFF,0x5B,0x0C,0xFF,0x5B,0x2C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x2C,0xFF,0x5B,0x2C,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2C,0xFF,0x5B,0x2C,0xFF,0x63,0x2D,0xFF,
-    0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2C,0xFF,0x63,0x0D,0xFF,0x63,0x2D,0xFF,0x5B,0x2C,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2C,0xFF,0x5B,0x2D,0xFF,0x5B,0x2C,0xFF,0x5B,0x2C,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x63,0x2D,0xFF,0x52,0xAB,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8A,0x32,0x63,0x2D,0xFF,0x63,0x0D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,
-    0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2C,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x2D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x2C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x2C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x2C,0xFF,0x5B,0x2C,0xFF,0x5B,0x0D,0xFF,0x5B,0x2D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x42,0x29,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xEC,0xB5,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2C,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x2D,0xFF,0x5B,0x2D,0xFF,0x63,0x0C,0xFF,0x5B,0x2D,0xFF,0x5B,0x0C,0xFF,0x5B,0x2C,0xFF,0x5B,0x2D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,
-    0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x5B,0x0C,0xED,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x06,0x5B,0x0C,0xFF,0x63,0x2D,0xFF,0x5B,0x0D,0xFF,0x5B,0x2D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x2C,0xFF,0x5B,0x2C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x2C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,
-    0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x63,0x0C,0xFF,0x4A,0x8A,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x69,0x25,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0D,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x2C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,
-    0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xE5,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x6A,0x57,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,
-    0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x3A,0x49,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8A,0x80,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5B,0x0C,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,
-    0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEB,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x4A,0x8A,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8A,0x9C,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,
-    0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xCC,0xFF,0x5A,0xEC,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x52,0xEC,0xFF,0x52,0xCC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xCC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEB,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x52,0xEB,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x52,0xEB,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xEB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xEC,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x4A,0xAB,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x6A,0x98,0x52,0xEC,0xFF,0x52,0xCC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xCC,0xFF,0x52,0xEC,0xFF,0x5A,0xCC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEB,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEB,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEB,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xCB,0xFF,0x52,0xEB,0xFF,0x52,0xEC,0xFF,0x52,0xCB,0xFF,0x52,0xEB,0xFF,0x52,0xEB,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,
-    0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xEC,0xFF,0x5A,0xEC,0xFF,0x5A,0xCC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xEC,0xFF,0x52,0xCB,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x4A,0x73,0x52,0xEC,0xFF,0x52,0xCC,0xFF,0x52,0xEC,0xFF,0x52,0xEB,0xFF,0x52,0xCC,0xFF,0x5A,0xCC,0xFF,0x5A,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xEB,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,
-    0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xEC,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCC,0xFF,0x52,0xCB,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x29,0x42,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,
-    0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xD2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC8,0x12,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,
-    0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xCB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x4A,0x8A,0xE5,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAA,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAA,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAA,0xFF,0x4A,0x8B,0xFF,
-    0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAA,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0x8B,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0x8A,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x49,0x55,0x52,0xAB,0xFF,0x4A,0x8B,0xFF,0x4A,0xAB,0xFF,0x52,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0x8B,0xFF,0x52,0x8B,0xFF,0x4A,0xAA,0xFF,0x4A,0xAB,0xFF,0x4A,0x8B,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,
-    0x52,0xAB,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x52,0xAB,0xFF,0x52,0xAA,0xFF,0x52,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0xAB,0xFF,0x52,0x8B,0xFF,0x52,0xAB,0xFF,0x4A,0xAA,0xFF,0x4A,0x8A,0xFF,0x52,0x8B,0xFF,0x4A,0xAA,0xFF,0x52,0xAA,0xFF,0x4A,0xAB,0xFF,0x4A,0x8B,0xFF,0x52,0x8B,0xFF,0x52,0x8B,0xFF,0x4A,0xAA,0xFF,0x4A,0x8B,0xFF,0x52,0x8B,0xFF,0x52,0xAB,0xFF,0x4A,0xAA,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0xAA,0xFF,0x4A,0x8A,0xFF,0x4A,0xAA,0xFF,0x4A,0xAA,0xFF,0x4A,0x8B,0xFF,0x4A,0xAA,0xFF,0x4A,0xAA,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0xAA,0xFF,0x4A,0x8B,0xFF,0x4A,0xAB,0xFF,0x52,0x8B,0xFF,0x4A,0x8A,0xFF,0x52,0x8B,0xFF,0x52,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0xAB,0xFF,0x52,0x8B,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x4A,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x52,0x8B,0xFF,0x52,0xAB,0xFF,0x52,0xAB,0xFF,0x42,0x6A,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x4A,0x8A,0xFA,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x52,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,
-    0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x52,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0xAB,0xFF,0x52,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0xAB,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0xAB,0xFF,0x42,0x28,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x4A,0x5D,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,
-    0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,0x4A,0x8A,0xDA,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,
-    0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x4A,0x8A,0xFF,0x4A,0x8B,0xFF,0x3A,0x29,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0x18,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,
-    0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x69,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xB7,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x49,0x42,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x4A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,
-    0x42,0x4A,0xFF,0x4A,0x4A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x4A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x4A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x8A,0xF8,0x39,0xC7,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x29,0x56,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x69,0xFF,0x42,0x6A,0xFF,0x42,0x4A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x69,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x69,0xFF,0x42,0x6A,0xFF,0x42,0x4A,0xFF,0x42,0x6A,0xFF,0x42,0x69,0xFF,0x42,0x6A,0xFF,
-    0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x6A,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x6A,0xFF,0x42,0x69,0xFF,0x4A,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x42,0x6A,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x69,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x42,0x4A,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x4A,0x4A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x4A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x4A,0x6A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xFF,0x3A,0x08,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x29,0x40,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x4A,0x4A,0xFF,0x42,0x69,0xFF,0x4A,0x4A,0xFF,0x4A,0x4A,0xFF,0x4A,0x6A,0xFF,0x4A,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x42,0x69,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,
-    0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x69,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x69,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x6A,0xFF,0x42,0x6A,0xF6,0x3A,0x29,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0x14,0x42,0x49,0xC4,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,
-    0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x4A,0x4A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x2A,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x2A,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xAD,0x39,0xC7,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3A,0x29,0x2D,0x42,0x29,0xB3,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x3A,0x08,0xFF,0x3A,0x09,0xFF,0x3A,0x28,0xFF,0x42,0x09,0xFF,0x42,0x09,0xFF,0x42,0x09,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,
-    0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0x9F,0x42,0x29,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x3A,0x29,0x1D,0x42,0x29,0x3F,0x3A,0x29,0x65,0x42,0x29,0x86,0x42,0x29,0xA6,0x42,0x29,0xC0,0x42,0x29,0xD4,0x42,0x29,0xE2,0x42,0x29,0xED,0x42,0x29,0xF6,0x3A,0x29,0xFD,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,
-    0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x08,0xFF,0x3A,0x28,0xFF,0x3A,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x49,0xFF,0x42,0x49,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFD,0x42,0x29,0xF8,0x42,0x29,0xF2,0x42,0x29,0xE9,0x42,0x29,0xDE,0x42,0x29,0xD0,0x42,0x29,0xBE,0x42,0x49,0xA8,0x42,0x49,0x8E,0x42,0x49,0x73,0x42,0x49,0x51,0x42,0x29,0x32,0x42,0x69,0x14,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x04,0x10,0x02,0x42,0x08,0x04,0x4A,0x49,0x07,0x42,0x08,0x0C,0x39,0xC8,0x16,0x3A,0x08,0x28,0x31,0xE8,0x54,0x4A,0x69,0xFF,0x83,0xA8,0xFF,0x7B,0x88,0xFF,0x7B,0x68,0xFF,0x7B,0x48,0xFF,0x73,0x48,0xFF,0x73,0x28,0xFF,0x73,0x47,0xFF,0x73,0x48,0xFF,0x73,0x48,0xFF,0x73,0x48,0xFF,0x73,0x48,0xFF,0x7B,0x48,0xFF,0x7B,0x68,0xFF,0x6B,0x08,0xFF,0x2A,0x28,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x93,0xC6,0xFF,0xFE,0x25,0xFF,0xFE,0x25,0xFF,0xFE,0x25,0xFF,0xFE,0x25,0xFF,0xFE,0x05,0xFF,0xFE,0x05,0xFF,0xFE,0x04,0xFF,0xFE,0x24,0xFF,0xFE,0x05,0xFF,0xFE,0x04,0xFF,0xFE,0x04,0xFF,0xFE,0x04,0xFF,0xF6,0x04,0xFF,0x7B,0x46,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x25,0xCD,0x26,0xFF,0xFE,0x46,0xFF,0xFE,0x25,0xFF,0xFE,0x25,0xFF,0xFE,0x25,0xFF,0xFE,0x04,0xFF,0xFE,0x24,0xFF,0xFE,0x04,0xFF,0xFE,0x24,0xFF,0xFE,0x24,0xFF,0xFE,0x24,0xFF,0xFE,0x04,0xFF,0xFE,0x45,0xFF,0xC5,0x05,0xFA,0x21,0x29,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xA7,0x79,0xF6,0x27,0xFF,0xFE,0x46,0xFF,0xFE,0x46,0xFF,0xFE,0x46,0xFF,0xFE,0x46,0xFF,0xFE,0x45,0xFF,0xFE,0x25,0xFF,0xFE,0x45,0xFF,0xFE,0x25,0xFF,0xFE,0x45,0xFF,0xFE,0x45,0xFF,0xFE,0x25,0xFF,0xF6,0x25,0xFF,0x62,0xC7,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9C,0x06,0xEF,0xFE,0x87,0xFF,0xFE,0x66,0xFF,0xFE,0x66,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x66,0xFF,0xFE,0x66,0xFF,0xFE,0x66,0xFF,0xFE,0x66,0xFF,0xFE,0x66,0xFF,0xFE,0x46,0xFF,0xFE,0x66,0xFF,0xAC,0x67,0xF6,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA8,0x18,0xD5,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xF6,0x46,0xFF,0x4A,0x67,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x47,0x67,0xF6,0x27,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA7,0xFF,0xFE,0x87,0xFF,0xFE,0xA8,0xFF,0x93,0xE7,0xF8,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8B,0xA6,0xE7,0xFE,0x67,0xFF,0xFE,0x66,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xC8,0xFF,0xE6,0x07,0xFF,0x39,0xE8,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA6,0x17,0xD5,0x65,0xFF,0xFE,0x66,0xFF,0xFE,0x66,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0xA7,0xFF,0xFE,0xA8,0xFF,0xFE,0xC8,0xFF,0x73,0x47,0xFF,0x29,0x65,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x27,0x64,0xF6,0x46,0xFF,0xFE,0x66,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xC8,0xFF,0xC5,0x48,0xFF,0x42,0x28,0xFF,0x31,0xA8,0x33,0x31,0xA6,0x0E,0x31,0x86,0x05,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x83,0x86,0xE2,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xFE,0xA8,0xFF,0xC5,0x28,0xFF,0xA4,0x48,0xFF,0x9C,0x28,0xFF,0x94,0x08,0xFF,0x8B,0xE8,0xFF,0x8B,0xE7,0xFF,0x83,0xC7,0xFF,0x83,0xA8,0xFF,0x7B,0x88,0xFD,0x83,0xA8,0xEF,0x83,0x88,0xD8,0x83,0xA7,0xB3,0x83,0xC7,0x82,0x62,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xE7,0x11,0xCD,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0xA9,0xFF,0xFE,0xA9,0xFF,0xFE,0xAA,0xFF,0xFE,0xCA,0xFF,0xFE,0xCA,0xFF,0xFE,0xC9,0xFF,0xFE,0xC9,0xFF,0xFE,0xC8,0xFF,0xFE,0xA7,0xFF,0xFE,0xA7,0xFF,0xF6,0xA7,0xFF,0xF6,0x66,0xFF,0xEE,0x86,0xFF,0xDD,0xE7,0xFF,0x4A,0x47,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x47,0x4E,0xF6,0x46,0xFF,0xF6,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0xA9,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xF6,0x66,0xFF,0xF6,0x86,0xFF,0xEE,0x47,0xFF,0x5A,0xA8,0xAF,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x67,0xB5,0xFE,0x88,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xF6,0x87,0xFF,0xEE,0x47,0xFF,0x63,0x08,0xDE,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,0xC5,0x07,0xFF,0xF6,0x88,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xF6,0x47,0xFF,0xFE,0x67,0xFF,0xF6,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x87,0xFF,0xF6,0x47,0xFF,0x7B,0x88,0xF4,0x21,0xA6,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x68,0x14,0xF6,0x27,0xFF,0xF6,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x46,0xFF,0xFE,0x46,0xFF,0xFE,0x46,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x87,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0x94,0x08,0xFD,0x21,0x67,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x66,0x2C,0xF6,0x48,0xFF,0xF6,0x28,0xFF,0xF6,0x28,0xFF,0xEE,0x28,0xFF,0xEE,0x08,0xFF,0xEE,0x07,0xFF,0xEE,0x07,0xFF,0xF6,0x07,0xFF,0xF6,0x06,0xFF,0xF5,0xE6,0xFF,0xF6,0x06,0xFF,0xF6,0x26,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0x88,0xFF,0xFE,0xA8,0xFF,0xA4,0x68,0xFF,0x29,0xA7,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x4A,0x48,0x3E,0x4A,0x47,0x7D,0x42,0x48,0xB3,0x42,0x27,0xDA,0x42,0x27,0xED,0x42,0x27,0xFD,0x42,0x27,0xFF,0x42,0x27,0xFF,0x42,0x27,0xFF,0x42,0x27,0xFF,0x42,0x07,0xFF,0x5A,0x86,0xFF,0xF6,0x07,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x68,0xFF,0xFE,0x88,0xFF,0xBC,0xE8,0xFF,0x3A,0x08,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x52,0xAA,0x03,0x39,0xC7,0x12,0xAC,0x26,0xFF,0xF6,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x67,0xFF,0xFE,0x68,0xFF,0xD5,0x67,0xFF,0x3A,0x08,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE7,0x21,0xED,0xA6,0xFF,0xF6,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x27,0xFF,0xFE,0x47,0xFF,0xFE,0x47,0xFF,0xFE,0x68,0xFF,0xE5,0xC7,0xFF,0x3A,0x28,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xA7,0x95,0xF6,0x07,0xFF,0xF6,0x06,0xFF,0xF6,0x07,0xFF,0xFE,0x27,0xFF,0xFE,0x46,0xFF,0xFE,0x47,0xFF,0xF5,0xE7,0xFF,0x5A,0xA8,0xA8,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x07,0xC4,0xC6,0xFF,0xF6,0x07,0xFF,0xF6,0x06,0xFF,0xFE,0x07,0xFF,0xFE,0x27,0xFF,0xF6,0x27,0xFF,0xF6,0x06,0xFF,0x73,0x47,0xCA,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x47,0x4E,0xF5,0xC6,0xFF,0xF5,0xE7,0xFF,0xF6,0x07,0xFF,0xF6,0x06,0xFF,0xF6,0x06,0xFF,0xF6,0x06,0xFF,0x8B,0xA7,0xE5,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x93,0x86,0xE2,0xFE,0x07,0xFF,0xF5,0xE6,0xFF,0xF5,0xE6,0xFF,0xF5,0xE6,0xFF,0xF6,0x06,0xFF,0xAC,0x47,0xF8,0x29,0x67,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC8,0x23,0xE5,0x46,0xFF,0xF5,0xE7,0xFF,0xFD,0xE6,0xFF,0xF5,0xE6,0xFF,0xF6,0x06,0xFF,0xCC,0xC6,0xFF,0x21,0x87,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xC7,0xA1,0xFD,0xE7,0xFF,0xF5,0xE7,0xFF,0xF5,0xC6,0xFF,0xF5,0xC6,0xFF,0xD4,0xE6,0xFF,0x31,0xA7,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x68,0x0B,0xBC,0x66,0xFF,0xFE,0x08,0xFF,0xFD,0xC6,0xFF,0xF5,0xC6,0xFF,0xE5,0x26,0xFF,0x4A,0x67,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x07,0x5F,0xF5,0x87,0xFF,0xFE,0x08,0xFF,0xF5,0xC7,0xFF,0xF5,0x86,0xFF,0x62,0xC7,0x9A,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xA3,0xC6,0xF2,0xFE,0x07,0xFF,0xF5,0xC7,0xFF,0xFD,0xE7,0xFF,0x83,0x47,0xC4,0x04,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA8,0x2F,0xE5,0x26,0xFF,0xFD,0xE7,0xFF,0xFD,0xC7,0xFF,0xAC,0x27,0xE9,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x66,0xB8,0xF5,0xA7,0xFF,0xFD,0xC7,0xFF,0xC4,0x87,0xFD,0x29,0xC7,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x0F,0xD4,0x85,0xFF,0xF5,0xA7,0xFF,0xD4,0xE7,0xFF,0x3A,0x08,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x07,0x67,0xF5,0x86,0xFF,0xED,0x67,0xFF,0x4A,0x48,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x9B,0x85,0xF2,0xED,0x86,0xFF,0x5A,0xA8,0xC6,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE7,0x26,0xE5,0x06,0xFF,0x83,0x68,0xF8,0x21,0xC7,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x06,0x95,0xAC,0x47,0xFF,0x21,0x87,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0xA3,0xE7,0xFF,0x31,0xC7,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x88,0x19,0x4A,0x48,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_thunderstorm_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_thunderstorm_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_thunderstorm_png_data
-};
-
@@ -1,168 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.6.0
-// LVGL version: 8.3.11
-// Project name: tune_bar
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/weather/windy.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weather_windy_png_data[]  = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x49,0x47,0x6B,0x8E,0x70,0x5A,0xEC,0x31,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x2D,0x2A,0xBD,0xF7,0xF6,0xCE,0x9A,0xFF,0x8C,0x92,0xBE,0x4A,0x6A,0x3D,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x14,0x52,0xEC,0x50,0x9D,0x14,0xA3,0xCE,0x59,0xDA,0xB5,0xB6,0xC4,0x04,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x24,0x0D,0x84,0x51,0xD0,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,
-    0xD6,0xDA,0xFD,0x8C,0x72,0x7F,0x39,0xC8,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9D,0x13,0x63,0xA5,0x55,0x8B,0x63,0x4E,0x42,0x29,0x65,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x6B,0x6E,0x41,0xB5,0xD7,0xD6,0xDE,0xFB,0xFF,0xE7,0x3C,0xFF,0xD6,0xBA,0xFF,0x5B,0x0C,0x95,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x4A,0x6A,0x9C,0xD6,0xDB,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xDE,0xFC,0xFF,0xBD,0xF7,0xBE,0x63,0x2D,0x29,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x10,0x51,0xDE,0xFB,0xFF,0xCE,0x59,0xFF,0x94,0xD3,0x82,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x73,0xCF,0x3F,0xBE,0x18,0xED,0xE7,0x3C,0xFF,0xEF,0x7E,0xFF,0xE7,0x3D,0xFF,0x94,0x92,0xEB,0x31,0xE8,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xC8,0x67,
-    0xAD,0x75,0xFF,0xF7,0x9E,0xFF,0xFF,0xDF,0xFF,0xEF,0x7E,0xFF,0xEF,0x5D,0xFF,0xBE,0x18,0xDA,0x73,0x8E,0x2F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xEC,0x34,0xC6,0x59,0xFF,0xE7,0x1C,0xFF,0xCE,0x79,0xF4,0x73,0xB0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAC,0x12,0xBE,0x18,0xC8,0xE7,0x1C,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xD6,0xBA,0xFF,0x5B,0x0C,0xA1,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x42,0x69,0x17,0x63,0x2D,0x46,0x84,0x51,0x7A,0xA5,0x35,0xB8,0xBD,0xD7,0xE2,0xC6,0x38,0xFD,0xCE,0x59,0xFF,0xC6,0x59,0xFD,0xBD,0xF8,0xE5,0xAD,0x76,0xAD,0x94,0x92,0x7A,0x73,0x8F,0x40,0x4A,0x6B,0x17,0x00,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x87,0x40,0x8C,0x72,0xFF,0xEF,0x5D,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xEF,0x7D,0xFF,0xC6,0x38,0xC8,0x5A,0xCC,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x22,0xB5,0xB7,0xFA,0xDE,0xFC,0xFF,0xD6,0xBB,0xFF,0x94,0x92,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x72,0x4D,0xDE,0xFB,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x5D,0xFF,0xCE,0x79,0xFF,0x31,0xC8,0x4A,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x09,0x26,0x7C,0x10,0x8D,0xCE,0x79,0xFD,0xF7,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xE7,0x3C,0xFA,0xA5,0x35,0x90,0x52,0xAB,0x2C,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x29,0x66,0x26,0x6B,0x8E,0xFD,0xF7,0x9E,0xFF,0xFF,0xDE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xAD,0x55,0x8E,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x22,0xA5,0x55,0xFF,0xDE,0xFB,0xFF,0xCE,0x7A,0xFF,0x94,0xB3,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xB5,0xB7,0x88,0xE7,0x3C,0xFF,0xF7,0x9E,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xB5,0xB7,0xFD,0x29,0x87,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x42,0x4A,0x42,0xB5,0xB7,0xE0,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBF,0xFF,0xFF,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDE,0xFF,0xF7,0xBE,0xFF,0xDE,0xFB,0xEF,0x7C,0x10,0x5C,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x67,0x1B,0x63,0x2D,0xF8,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDF,0xFF,0xFF,0xDF,0xFF,0xE7,0x3C,0xED,0x63,0x4E,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC7,0x3D,0xA5,0x35,0xFF,0xDE,0xFB,0xFF,0xCE,0x79,0xFF,0x63,0x0D,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xBD,0xF8,0xA4,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xB5,0xB6,0xFF,0x39,0xC8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x29,0x21,0x9D,0x14,0xD6,0xEF,0x7D,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xD6,0xBA,0xF6,0x73,0xCF,0x51,0x04,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x86,0x1A,0x73,0xCF,0xFA,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xA5,0x34,0x65,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x6D,0xBD,0xF7,0xFF,0xDE,0xDB,0xFF,0xAD,0x96,0xE2,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xBD,0xF8,0x9C,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xC6,0x39,0xFF,0x3A,0x08,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0xEC,0x6C,0xCE,0x9A,0xFF,0xFF,0xDF,0xFF,
-    0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xAD,0xB6,0xDA,0x3A,0x2A,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x87,0x20,0x94,0xD3,0xFF,0xFF,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xD7,0x9D,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x4A,0x8A,0xC0,0xCE,0x59,0xFF,0xCE,0x9A,0xFF,0x63,0x2D,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0xB3,0x5F,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0xDE,0xFB,0xFF,0x42,0x4A,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x5B,0x0D,0xA4,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xDE,0xFF,0xEF,0x5D,0xFF,0x52,0xAB,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x39,0xBD,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xC6,0x38,0xB5,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x48,0x0C,0x84,0x71,0xFA,0xCE,0x79,0xFF,0x8C,0x72,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x4D,0x16,0xE7,0x1C,0xFF,0xEF,0x9D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xE7,0x3D,0xFF,0x6B,0x6E,0xDA,0x00,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x63,0x2D,0xB1,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,
-    0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0x63,0x2D,0x7F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x4A,0x73,0xF7,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xC6,0x59,0xAD,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x4F,0xB5,0xB6,0xFF,0xA5,0x55,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xB5,0xB7,0xC2,0xE7,0x3D,0xFF,0xE7,0x1C,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xB5,0xB6,0xFF,0x31,0x87,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x0D,0x85,0xE7,0x5D,0xFF,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xE7,0x3C,0xFF,0x63,0x4E,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x63,0x4D,0xCC,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xF7,0xBE,0xFF,0xFF,0xBF,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xB5,0xB7,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x7C,0x10,0xE7,0xAD,0x96,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x2C,0x25,0xD6,0xDB,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0xD6,0xDB,0xFF,0x52,0xAB,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x09,0x2E,0xCE,0x9A,0xFF,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x7E,0xFF,
-    0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xDE,0xFB,0xFF,0x4A,0x8A,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xC7,0x16,0xBD,0xF7,0xFF,0xFF,0xFF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0x84,0x31,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x6A,0x43,0xA5,0x55,0xE5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xF4,0xA8,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDF,0x1C,0xFF,0xA5,0x55,0xFF,0x29,0x87,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xA5,0x35,0xEB,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xE7,0x3C,0xFF,0xD6,0xDB,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0xBA,0xFF,0xDF,0x1C,0xFF,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0xD6,0xBA,0xFF,0x29,0x67,0x16,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x49,0x86,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0x5A,0xEB,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x7C,0x10,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0xBE,0x18,0xFF,0xD6,0xDB,0xFF,0xCE,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0x63,0x4E,0xF8,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x4A,0x45,0xEF,0x5D,0xFF,0xEF,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,
-    0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xA5,0x55,0xFF,0x52,0xCC,0xDA,0x31,0xA8,0x63,0x29,0x87,0x23,0x29,0x47,0x12,0x29,0x48,0x0C,0x29,0x67,0x16,0x31,0xC8,0x30,0x4A,0x6A,0x7F,0x8C,0x52,0xF6,0xDE,0xFB,0xFF,0xF7,0xBE,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xF7,0xBE,0xFF,0x94,0xB2,0xB8,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xC7,0x0D,0xAD,0x76,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9D,0xFF,0xF7,0x9E,0xFF,0xC6,0x38,0xBC,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x6A,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8A,0x26,0xCE,0x7A,0xFF,0xD6,0xBB,0xFF,0xCE,0x9A,0xFF,0xD6,0xFB,0xFF,0xC6,0x59,0xFF,0x3A,0x29,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xAD,0xB6,0xE2,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0x9C,0xF4,0xFF,0x3A,0x29,0xC8,0x29,0x87,0x23,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x39,0xE8,0x45,0x63,0x6E,0xF4,0xDE,0xFB,0xFF,0xF7,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x9D,0xFF,0xF7,0xBE,0xFF,0xF7,0xBE,0xFF,
-    0x4A,0x6A,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xCC,0xAB,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0x7B,0xEF,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x6E,0x55,0xCE,0x9A,0xFF,0xCE,0x9B,0xFF,0xCE,0x9A,0xFF,0xD6,0xBB,0xFF,0xA5,0x76,0xFF,0x29,0xA7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x0A,0x13,0xE7,0x5D,0xFF,0xEF,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,
-    0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xDF,0x1C,0xFF,0x6B,0x8E,0xFF,0x29,0xA6,0x61,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x29,0x07,0x3A,0x29,0x9F,0xA5,0x55,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xE7,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xF7,0xBE,0xFF,0x9C,0xF3,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x86,0x33,0xC6,0x59,0xFF,0xEF,0x9E,0xFF,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xCE,0x79,0xDC,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x31,0x7A,0xCE,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0xBA,0xFF,0x84,0x72,0xFF,0x29,0x67,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xEC,0x51,0xF7,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0x63,0x6E,0xFF,0x29,0x86,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xC7,0x72,0x9C,0xF4,0xFF,0xEF,0x7E,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xF7,0xBE,0xFF,
-    0xE7,0x3C,0xFF,0x4A,0x49,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x08,0x8C,0x92,0xFF,0xF7,0x9E,0xFF,0xEF,0x7D,0xFF,0xF7,0x9D,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0x52,0xEB,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x31,0x8D,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0x6B,0xCF,0xFF,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x92,0x9C,0xEF,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,
-    0xEF,0x7D,0xFF,0x9C,0xF4,0xFF,0x29,0x87,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC7,0x65,0xAD,0x75,0xFF,0xEF,0x7D,0xFF,0xE7,0x5C,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xF7,0xBE,0xFF,0x6B,0x8E,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x2D,0xE9,0xF7,0x9E,0xFF,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xAD,0x75,0x9D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x10,0x83,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0x6B,0x6E,0xFF,0x21,0x24,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xD7,0xEF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0x4A,0x6A,0xEF,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x0A,0x3A,0x29,0x72,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x29,0x8A,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,
-    0xF7,0x9E,0xFF,0x94,0xF3,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x4A,0x9D,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xE7,0x3C,0xFF,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8E,0x5F,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0x63,0x6E,0xFF,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xCE,0x79,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,
-    0xCE,0x9A,0xFF,0x31,0xC7,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xAF,0x2B,0xCE,0x9A,0xFF,0x73,0xF0,0xB8,0x04,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x7B,0xF0,0xE9,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xB5,0xD7,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE7,0x6D,0xD6,0xDB,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0xF7,0x9E,0xFF,0x42,0x69,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8A,0x30,0xC6,0x59,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0x6B,0xAF,0xFF,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0xCE,0x9A,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xEF,0x5D,0xFF,0xAD,0x96,0xFF,0x31,0xA8,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC8,0x27,0xCE,0x7A,0xFF,0xDF,0x1C,0xFF,0x8C,0x72,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x08,0x4C,0xE7,0x1C,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,
-    0xE7,0x3C,0xFF,0xC6,0x59,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA7,0x5C,0xC6,0x38,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9E,0xFF,0xF7,0x9E,0xFF,0xF7,0xBE,0xFF,0x63,0x4D,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x65,0x0B,0xB5,0xB7,0xFF,0xCE,0x7A,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0x7C,0x31,0xFF,0x21,0x86,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xCE,0x79,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xEF,0x5D,0xFF,
-    0x9D,0x34,0xFF,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA6,0x17,0x7C,0x31,0xFF,0xDF,0x3C,0xFF,0xE7,0x3D,0xFF,0x7B,0xF0,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x08,0x10,0xBD,0xD7,0xFF,0xEF,0x9E,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xD6,0x9A,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x86,0x4F,0xB5,0xF7,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x9E,0xFF,0xEF,0x9D,0xFF,0xEF,0x9D,0xFF,0xEF,0x9E,0xFF,0xF7,0xBE,0xFF,0x84,0x51,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0xB2,0xC8,0xC6,0x59,0xFF,0xBE,0x18,0xFF,0xC6,0x59,0xFF,0x94,0xF4,0xFF,0x29,0x86,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0xF7,0xFA,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x5C,0xFF,0xAD,0x76,0xFF,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xC7,0x0D,0x5A,0xCC,0xFF,0xDE,0xDB,0xFF,0xE7,0x1C,0xFF,0xD6,0xBA,0xF2,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x84,0x51,0xFF,0xEF,0x9E,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,
-    0xE7,0x3C,0xFF,0xD6,0xBA,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x86,0x45,0xB5,0xD7,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7E,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xF7,0x9E,0xFF,0x9D,0x14,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAB,0x35,0xBE,0x18,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xB5,0xB7,0xFF,0x39,0xE8,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x14,0xB3,0xDF,0x3C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,
-    0xCE,0x9A,0xFF,0x31,0xE7,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0x52,0xCC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xE7,0x3D,0xFF,0x73,0xD0,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x6B,0x6E,0xFF,0xEF,0x7E,0xFF,0xEF,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xDF,0x1C,0xFF,0xCE,0x9A,0xD8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA7,0x4E,0xBD,0xF8,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x9E,0xFF,0xAD,0x96,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x94,0xB3,0xD8,0xC6,0x39,0xFF,0xB5,0xD8,0xFF,0xBE,0x18,0xFF,0x5A,0xEC,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xAE,0x63,0xE7,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0x52,0xCB,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x10,0x84,0x51,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3D,0xFF,0xAD,0xB6,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x0C,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,
-    0xE7,0x1C,0xFF,0xC6,0x59,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x5B,0xCE,0x79,0xFF,0xE7,0x5D,0xFF,0xE7,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x7D,0xFF,0xAD,0x96,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x4A,0x22,0xB5,0xD7,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0x8C,0x92,0xFF,0x31,0x86,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x69,0x1B,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xD6,0xFB,0xFF,
-    0xDE,0xFB,0xFF,0xAD,0xB6,0xFF,0x32,0x08,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x3F,0xC6,0x79,0xFF,0xDF,0x1C,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0xC6,0x39,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x63,0x2D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xB5,0xD7,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x76,0xDE,0xFB,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x7D,0xFF,0xEF,0x7D,0xFF,0xEF,0x5D,0xFF,0xEF,0x7E,0xFF,0xA5,0x55,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x6E,0x6F,0xB5,0xD7,0xFF,0xBE,0x19,0xFF,0xBE,0x18,0xFF,0x3A,0x08,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xC6,0x39,0xE5,0xDE,0xFC,0xFF,0xD6,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xDF,0x1C,0xFF,0x84,0x51,0xEF,0x29,0x87,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x7C,0x10,0xE5,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xDE,0xFB,0xFF,0xC6,0x18,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x73,0xAF,0xFF,0xEF,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,
-    0xE7,0x5D,0xFF,0x9C,0xF3,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8B,0xAF,0xEF,0x7D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x5D,0xFF,0xE7,0x5D,0xFF,0xEF,0x7D,0xFF,0x8C,0x72,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x84,0x51,0x9D,0xB5,0xD7,0xFF,0xC6,0x59,0xFF,0x8C,0x92,0xF2,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8F,0x45,0xDE,0xFC,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,
-    0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0x9C,0xF4,0xFF,0x31,0xC8,0x9D,0x29,0xA6,0x2B,0x2A,0x08,0x0C,0x31,0x86,0x05,0x42,0x08,0x04,0x2A,0x08,0x0C,0x31,0xE8,0x3B,0x8C,0x92,0xE2,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFB,0xFF,0xA5,0x55,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x08,0x0C,0x94,0xB3,0xFF,0xEF,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xEF,0x5D,0xFF,0x7B,0xCF,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xAF,0xEF,0xEF,0x9E,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xEF,0x7D,0xFF,0x6B,0x8E,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x84,0x31,0x9A,0xBD,0xF8,0xFF,0xC6,0x39,0xFF,0x42,0x49,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,0xBE,0x18,0xDC,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xCE,0x59,0xFF,0x94,0xD4,0xFF,0x73,0xCF,0xFF,0x63,0x4E,0xFF,0x73,0xAF,0xFF,0x94,0xB3,0xFF,0xC6,0x39,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0x6B,0xAF,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA7,0x2C,0xBD,0xF8,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,
-    0xDF,0x1C,0xFF,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xC7,0x0D,0xA5,0x34,0xFF,0xEF,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x5D,0xFF,0x4A,0x8B,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x73,0xAF,0x70,0xBE,0x18,0xFF,0xAD,0x96,0xFF,0x31,0xA8,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x4D,0x20,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,
-    0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xC6,0x39,0xD6,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE8,0x82,0xD6,0xDB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x3D,0xFF,0xB5,0xB6,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x29,0x3C,0xD6,0xBA,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x5D,0xFF,0xDE,0xFB,0xFF,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xAB,0x36,0xAD,0xB7,0xF8,0x84,0x51,0xC6,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x51,0x54,0xDE,0xFC,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0x7C,0x10,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x73,0xF0,0xF8,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xEF,0x5D,0xFF,
-    0x6B,0x4D,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xCF,0xC4,0xEF,0x7D,0xFF,0xDF,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xDF,0x3C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x5D,0xFF,0xAD,0xB6,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC7,0x09,0x6B,0x8E,0x7C,0x42,0x0C,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB3,0x67,0xDF,0x1C,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,
-    0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xCE,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xA5,0x55,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE8,0x48,0xD6,0xBB,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFC,0xFF,0xD6,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xE7,0x1C,0xFF,0xD6,0x9A,0xED,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xC7,0x16,0xC6,0x38,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xE7,0x3C,0xFF,0x63,0x6E,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x71,0x45,0xD6,0xDB,0xFD,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0xBA,0xFF,0xCE,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xAD,0x76,0x90,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x7C,0x11,0xF4,0xDE,0xFC,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0x63,0x4D,0x51,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x4E,0xAF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xCE,0x79,0xFF,0x39,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x4D,0x11,0xB5,0xB7,0xB3,0xD6,0xBB,0xFF,
-    0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xCE,0x9A,0xFF,0x94,0xB3,0x7D,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xCB,0x92,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xB5,0x96,0xE0,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x09,0x2A,0xCE,0x9A,0xFF,0xE7,0x5D,0xFF,0xDF,0x3C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xE7,0x3C,0xFF,0x8C,0x72,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8E,0x1F,0xB5,0xB6,0x92,0xC6,0x59,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xCE,0x9A,0xFF,0xA5,0x76,0xC2,0x52,0xAB,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE8,0x47,0xB5,0xD7,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xCE,0x79,0xFF,0x42,0x29,0x2C,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0x84,0x51,0xEB,0xEF,0x7D,0xFF,0xE7,0x3C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xCE,0x9A,0xFF,0x42,0x09,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x52,0xAA,0x03,0x5A,0xED,0x1B,0x84,0x71,0x44,0xA5,0x34,0x64,0xAD,0x76,0x7D,0xAD,0x96,0x76,0xA5,0x75,0x68,0x94,0xB3,0x48,0x6B,0x4E,0x26,0x39,0xCA,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x66,0x2C,0xA5,0x76,0xFF,0xD6,0xDC,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0x6B,0x6E,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0xCC,0xA8,0xE7,0x7D,0xFF,0xE7,0x3C,0xFF,0xE7,0x3C,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xE7,0x3D,0xFF,0x7C,0x30,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC7,0x2D,0xA5,0x35,0xFF,0xD6,0xBB,0xFF,0xCE,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0x84,0x51,0xD0,0x00,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x09,0x67,0xC6,0x39,0xFF,0xE7,0x5D,0xFF,0xE7,0x3C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xC6,0x39,0xFA,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x29,0x49,0xA5,0x55,0xFF,0xDE,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xCE,0x9A,0xFF,0xD6,0xBA,0xFF,0x94,0xD3,0xE7,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA7,0x42,0x9D,0x34,0xFF,0xE7,0x5D,0xFF,0xE7,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0x52,0xCC,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,0x52,0xAB,0x85,0xBD,0xD8,0xFF,0xDE,0xFC,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0x9B,0xFF,0xD6,0xBB,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xA5,0x14,0xF2,0x21,0x86,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x86,0x2E,0x84,0x51,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDF,0x1C,0xFF,0x8C,0x92,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x42,0x29,0x2B,0x94,0xD3,0x6C,0xBD,0xF8,0x97,0xB5,0xD7,0x9D,0x9D,0x14,0x83,0x6B,0x8E,0x56,0x3A,0x09,0x26,0x29,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xA8,0x13,0x63,0x4E,0xD2,0xD6,0x9B,0xFF,0xDE,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0x94,0xD3,0xE5,0x21,0x86,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x66,0x26,0x63,0x6E,0xFF,0xDE,0xFB,0xFF,0xD6,0xFC,0xFF,0xD6,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0xDE,0xFC,0xFF,0xE7,0x1C,0xFF,0xAD,0x96,0xD8,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x20,0x6B,0x8E,0xE7,0xAD,0x76,0xFF,0xBD,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xBD,0xF8,0xFF,0xB5,0xD7,0xFF,0xA5,0x55,0xFF,0x7B,0xF0,0xC2,0x63,0x4D,0x4A,0x04,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x39,0xE8,0x60,0x9D,0x35,0xFF,0xD6,0xBB,0xFF,0xDE,0xDB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xCE,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0x7C,0x10,0xCA,0x22,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x21,0x66,0x27,0x6B,0x8E,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xFB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFC,0xFF,0xE7,0x1C,0xFF,0xBE,0x18,0xED,0x42,0x28,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x0C,0x2A,0x8C,0x92,0xFF,0xB5,0xB6,0xFF,0xB5,0xD7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF7,0xFF,0xB5,0xB6,0xFF,0xA5,0x34,0xFF,0x84,0x51,0xFF,0x6B,0x6E,0xCE,0x52,0xAB,0x3E,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC8,0x24,0x73,0x8F,0xDA,0xBE,0x18,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xCE,0x7A,0xFF,0x63,0x2D,0x88,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x66,0x33,0x73,0xD0,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xCE,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0xDF,0x1C,0xFF,0xC6,0x39,0xFA,0x42,0x8B,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x70,0x52,0xAB,0xD8,0x5A,0xEC,0xF8,0x63,0x4D,0xF4,0x6B,0x8E,0xE0,0x6B,0x6E,0xBA,0x63,0x4D,0x8D,0x52,0xAB,0x5B,0x42,0x08,0x2B,0x29,0x68,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x88,0x10,0x52,0xAB,0xA4,0xA5,0x55,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xAD,0x76,0xF8,0x42,0x69,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x87,0x50,
-    0x84,0x31,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xCE,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xDE,0xFC,0xFF,0xCE,0x79,0xFA,0x4A,0xAA,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0A,0x42,0x29,0x80,0x94,0xB3,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xCE,0x59,0xFF,0x7C,0x10,0x98,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x29,0xA7,0x82,0x9C,0xF4,0xFF,0xD6,0xBB,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xCE,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xC6,0x39,0xF4,0x3A,0x29,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0A,0x31,0xA7,0x76,0x94,0xB3,0xFF,0xC6,0x39,0xFF,0xCE,0x7A,0xFF,0xC6,0x59,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0x94,0xD3,0xDA,0x3A,0x09,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x48,0x0C,0x42,0x4A,0xC6,0xB5,0xF8,0xFF,0xCE,0x9A,0xFF,
-    0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0xBB,0xFF,0xCE,0xBA,0xFF,0xCE,0xBA,0xFF,0xCE,0x9A,0xFF,0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xD6,0xDB,0xFF,0xB5,0xD7,0xDE,0x32,0x49,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x65,0x16,0x42,0x4A,0x8B,0x8C,0x72,0xFF,0xBD,0xF8,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x5A,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0x9C,0xF4,0xE5,0x4A,0xAB,0x3A,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x87,0x3D,0x73,0xD0,0xF8,0xC6,0x59,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0xBB,0xFF,0x9C,0xF4,0xAF,0x29,0x4A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x31,0xA6,0x33,0x52,0xCB,0xC2,0x94,0xB3,0xFF,0xBE,0x18,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x7A,0xFF,0xC6,0x39,0xFF,0x94,0xD3,0xD8,0x5A,0xCC,0x3D,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0A,0x4A,0x8B,0xA4,0xA5,0x55,0xFF,0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,
-    0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0x7C,0x10,0x69,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xE7,0x11,0x3A,0x08,0x6B,0x63,0x4E,0xF6,
-    0xAD,0x76,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xB5,0xB7,0xFF,0x84,0x51,0xB1,0x42,0x29,0x25,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3A,0x08,0x50,0x7C,0x10,0xFD,0xD6,0xBA,0xFF,0xD6,0xDB,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xB5,0xF8,0xE7,0x52,0xEC,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x31,0xA7,0x3F,0x4A,0x8B,0xC6,0x9C,0xF4,0xFF,0xC6,0x39,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x19,0xFF,0xC6,0x18,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xAD,0x55,0xE5,0x5B,0x0C,0x58,0x29,0x48,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xA7,0x2B,0x63,0x2D,0xDA,0xC6,0x59,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,
-    0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0x94,0xD3,0x88,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x02,0x29,0xA7,0x2B,0x4A,0x6A,0x9A,0x8C,0x51,0xFF,0xB5,0xD7,0xFF,0xCE,0x59,0xFF,0xCE,0x7A,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,
-    0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xA5,0x55,0xED,0x6B,0x6E,0x6F,0x42,0x09,0x1C,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE7,0x1E,0x5B,0x0D,0xBA,0xB5,0xD7,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xBD,0xF8,0xDC,0x52,0xAB,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x39,0xC8,0x20,0x52,0xCB,0x80,0x7C,0x10,0xFA,0xA5,0x55,0xFF,0xC6,0x38,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xB5,0xD7,0xFF,0x94,0xD3,0xD4,0x6B,0x6E,0x61,0x42,0x49,0x18,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xC7,0x20,0x5B,0x0C,0xB7,0xA5,0x35,0xFF,0xCE,0x9A,0xFF,0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,
-    0xD6,0x9A,0xFF,0xC6,0x39,0xFA,0x7C,0x10,0x52,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3A,0x09,0x20,0x52,0xEB,0x79,0x84,0x51,0xF4,0xB5,0xB6,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xC6,0x59,0xFF,0xBD,0xD7,0xFF,0xA5,0x55,0xED,
-    0x84,0x72,0x85,0x5B,0x0D,0x31,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x31,0xA7,0x30,0x5A,0xEC,0xCA,0xA5,0x34,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0xBA,0xFF,0xCE,0x79,0xFF,0x9C,0xF4,0x7A,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x31,0xC7,0x2D,0x5B,0x0C,0x8A,0x8C,0xB3,0xFA,0xB5,0xF7,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xC6,0x39,0xFF,0xBD,0xF7,0xFF,0xA5,0x35,0xD2,0x7B,0xF0,0x6F,0x4A,0x6A,0x2D,0x31,0x86,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x08,0x29,0xA7,0x56,0x63,0x4D,0xEB,0xB5,0xB6,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xC6,0x59,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xC6,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xAD,0x75,0x8B,0x4A,0x49,0x0E,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x31,0xA8,0x1C,0x52,0xCC,0x55,0x84,0x51,0xBE,0xA5,0x55,0xFF,0xB5,0xB7,0xFF,0xB5,0xF8,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xB5,0xD7,0xFF,0xA5,0x76,0xFF,0x94,0xB2,0xC6,0x6B,0xAF,0x77,0x52,0xAB,0x3B,0x39,0xE9,0x15,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0x86,0x25,0x42,0x29,0x9C,0x84,0x52,0xFF,0xBD,0xF7,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x99,0xFF,0x94,0xD3,0x80,0x4A,0x69,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x08,0x4A,0x6A,0x58,0x63,0x4D,0xC4,0x7C,0x31,0xFA,0x94,0xD3,0xFF,0xA5,0x55,0xFF,0xAD,0x96,0xFF,0xA5,0x75,0xFF,0x9D,0x14,0xFF,0x8C,0x72,0xF8,0x73,0xD0,0xBC,0x63,0x4D,0x7C,0x52,0xAB,0x49,0x42,0x69,0x24,0x42,0x08,0x0C,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0x66,0x17,0x39,0xE8,0x6B,0x6B,0x6E,0xEF,0x9D,0x14,0xFF,0xBD,0xF8,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xB5,0xD7,0xE9,0x7C,0x10,0x51,0x52,0xAA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x5B,0x0C,0x67,0x63,0x6D,0x7C,0x63,0x6E,0x74,0x63,0x2D,0x61,0x52,0xCB,0x4A,0x42,0x8A,0x33,0x3A,0x28,0x1E,0x31,0x88,0x0F,0x42,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0xC7,0x16,0x42,0x29,0x60,0x63,0x4D,0xE0,0x94,0xB3,0xFF,0xBD,0xF7,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xBE,0x39,0xFF,0xBE,0x38,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xBE,0x18,0xFF,0x9C,0xF4,0xBC,0x63,0x6D,0x2D,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xAA,0x03,0x52,0xCB,0x43,0x63,0x4D,0xAB,0x6B,0x8E,0xEF,0x6B,0x8E,0xD4,0x5B,0x0C,0x82,0x42,0x29,0x28,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAA,0x03,0x31,0xC8,0x20,0x3A,0x29,0x6F,0x63,0x4D,0xE9,0x9D,0x14,0xFF,0xC6,0x18,0xFF,0xC6,0x59,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x18,0xFF,0xBE,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xBE,0x18,0xFF,0xA5,0x75,0xDC,0x73,0xCF,0x55,0x32,0x49,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xCB,0x20,0xB5,0xB6,0xEB,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,
-    0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xBB,0xFF,0xAD,0x75,0xE2,0x52,0xAB,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xA6,0x0E,0x31,0xA7,0x3E,
-    0x42,0x6A,0x9D,0x7C,0x10,0xFD,0xAD,0x96,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xC6,0x59,0xFF,0xC6,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xBE,0x18,0xFF,0x9D,0x34,0xED,0x63,0x2D,0x69,0x31,0xE7,0x15,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x2D,0x26,0xD6,0xBA,0xFF,0xDE,0xDB,0xFF,0xD6,0xBA,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0xDB,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0x8C,0x93,0x86,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x65,0x0B,0x29,0xA7,0x31,0x42,0x29,0x7C,0x63,0x6E,0xE9,0x94,0xB3,0xFF,0xB5,0x96,0xFF,0xC6,0x18,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xBE,0x18,0xFF,0xA5,0x55,0xFF,0x7C,0x10,0xB8,0x4A,0xCB,0x4D,0x32,0x08,0x13,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0x06,0xCE,0x79,0xF4,0xDE,0xDB,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xDB,0xFF,
-    0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0x94,0xB3,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x29,0x67,0x11,0x31,0xE8,0x3A,0x4A,0x8A,0x82,0x63,0x6E,0xE9,0x84,0x51,0xFF,0xA5,0x35,0xFF,0xB5,0xD7,0xFF,0xBD,0xF8,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,
-    0xC6,0x18,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xC6,0x59,0xFF,0xC6,0x38,0xFF,0xB5,0xD7,0xFF,0x9D,0x14,0xFF,0x84,0x10,0xD6,0x63,0x2D,0x72,0x42,0x49,0x27,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xEF,0x56,0xDE,0xFB,0xFF,0xD6,0xBA,0xFF,0xDE,0xDB,0xFF,0xB5,0x96,0xFF,0x4A,0x8A,0x6C,0x31,0x86,0x0A,0x4A,0x49,0x07,0x4A,0x8B,0x7A,0xA5,0x34,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xD6,0xDB,0xFF,0xD6,0xBA,0xFF,0x42,0x69,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x05,0x39,0xE8,0x1E,0x42,0x49,0x55,0x5A,0xEC,0xAA,0x73,0xF0,0xFD,0x94,0xF4,0xFF,0xB5,0xB6,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xBE,0x18,0xFF,0xB5,0xD7,0xFF,0xAD,0x96,0xFF,0x9D,0x14,0xFF,0x8C,0x72,0xE5,0x6B,0x8E,0x8D,0x4A,0x8A,0x4A,0x31,0xE7,0x1E,0x31,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0x14,0xB3,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xCE,0x59,0xFF,0x31,0xC7,0x29,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x86,0x64,0xAD,0x76,0xFF,0xD6,0xBB,0xFF,0xD6,0xBA,0xFF,0xD6,0xDB,0xFF,0x9C,0xF4,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x04,0x52,0xAA,0x23,0x6B,0x8E,0x64,0x8C,0x92,0xCC,0xA5,0x55,0xFF,0xB5,0xB6,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xD7,0xFF,0xBD,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xB7,0xFF,0xAD,0x96,0xFF,0xA5,0x55,0xFF,0x94,0xD3,0xD8,0x84,0x31,0xA8,0x6B,0x8E,0x7D,
-    0x52,0xCB,0x57,0x42,0x29,0x38,0x31,0xC7,0x1F,0x21,0xC7,0x0D,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x92,0xAB,0xE7,0x1C,0xFF,0xDE,0xDB,0xFF,0xBD,0xD7,0xFF,0x29,0x66,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x52,0xAB,0xC8,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xC6,0x59,0xE5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x0C,0x20,0x63,0x6D,0x93,0x6B,0xAF,0xDC,0x73,0xD0,0xD4,0x73,0xF0,0xC4,0x73,0xCF,0xB1,0x73,0xAF,0x9D,0x6B,0x6E,0x86,0x63,0x2D,0x72,0x5A,0xEC,0x5C,0x52,0xAB,0x49,0x42,0x6A,0x36,0x42,0x09,0x26,0x39,0xE8,0x19,0x32,0x08,0x10,0x42,0x08,0x08,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x08,0x32,0xD6,0xBB,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0x5A,0xEC,0xCA,0x00,0x00,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x5D,0xCE,0x7A,0xFF,0xDE,0xDB,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xCB,0x37,0x8C,0x72,0xE5,0xBD,0xF7,0xFF,0xBD,0xD7,0xFF,0x63,0x4D,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8A,0x8D,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xD6,0xDB,0xFF,0xC6,0x59,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x08,0x10,0x4A,0x4A,0x20,0x04,0x10,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE7,0x19,0xA5,0x35,0xFF,0xDF,0x1C,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xAD,0x75,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x39,0xE8,0x3F,0x84,0x31,0xF8,0xDE,0xFB,0xFF,0xE6,0xFC,0xFF,0xDE,0xFC,0xFF,0xDE,0xFB,0xFF,0x5A,0xEB,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x52,0xAA,0x03,0x42,0x08,0x04,0x29,0x45,0x06,0x22,0x08,0x08,0x31,0x86,0x0A,0x31,0xA6,0x0E,0x31,0xA6,0x13,0x31,0x87,0x1A,0x29,0x87,0x23,0x31,0xA7,0x30,0x31,0xA7,0x42,0x31,0xA7,0x5C,
-    0x42,0x09,0x8A,0x73,0x8F,0xE9,0xC6,0x39,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFC,0xFF,0xBD,0xF7,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x10,0x06,0xB5,0xB7,0x3D,0xAD,0x76,0x6C,0xA5,0x55,0x8E,0xA5,0x55,0xA8,0xA5,0x55,0xBC,0xA5,0x35,0xCC,0xA5,0x35,0xD8,0xA5,0x35,0xE2,
-    0xA5,0x34,0xE9,0xA5,0x35,0xEF,0xA5,0x35,0xF4,0xA5,0x35,0xF6,0xA5,0x55,0xFA,0xA5,0x55,0xFD,0xAD,0x75,0xFD,0xAD,0x96,0xFF,0xAD,0x96,0xFF,0xB5,0xB6,0xFF,0xB5,0xB6,0xFF,0xB5,0xB6,0xFF,0xB5,0xB6,0xFF,0xB5,0xB7,0xFF,0xB5,0xB7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xB5,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xD7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF7,0xFF,0xB5,0xD7,0xFF,0xB5,0xD7,0xFF,0xBD,0xD7,0xFF,0xBD,0xD7,0xFF,0xBD,0xF7,0xFF,0xBD,0xF8,0xFF,0xC6,0x38,0xFF,0xD6,0x9A,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xFB,0xFF,0xDE,0xFB,0xFF,0xBE,0x18,0xB1,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xAE,0x95,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,
-    0xD6,0xBB,0xFF,0xD6,0xBB,0xFF,0xD6,0xDB,0xFF,0xDE,0xDB,0xFF,0xDE,0xDB,0xFF,0xA5,0x34,0xA6,0x52,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xAE,0x16,0xC6,0x59,0xB7,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,
-    0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xCE,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xD6,0xBA,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x9A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xD6,0x9A,0xFF,0xCE,0x7A,0xFF,0xC6,0x39,0xFD,0xAD,0x75,0xAD,0x5A,0xCB,0x33,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x4A,0x49,0x07,0x4A,0x4B,0x0E,0x4A,0xAA,0x15,0x4A,0x6A,0x1B,0x4A,0x8B,0x20,0x4A,0x6A,0x25,0x4A,0x6A,0x28,0x4A,0x8A,0x2C,0x4A,0x6A,0x2D,0x4A,0x8A,0x30,0x42,0x6A,0x32,0x4A,0x8A,0x33,0x4A,0x8B,0x34,0x52,0xAB,0x35,0x52,0xAB,0x35,0x52,0xAB,0x36,0x52,0xCB,0x36,0x52,0xCB,0x36,0x52,0xCB,0x36,0x52,0xEB,0x36,0x52,0xEC,0x36,0x5A,0xEC,0x36,0x5A,0xEC,0x36,0x5A,0xEC,0x36,0x5B,0x0D,0x36,0x5B,0x0D,0x36,0x63,0x2D,0x35,0x63,0x2D,0x35,0x63,0x2D,0x34,0x63,0x4D,0x33,0x63,0x2D,0x32,0x63,0x4E,0x30,0x63,0x6E,0x2D,0x63,0x6D,0x2A,0x6B,0x6D,0x27,0x6B,0x8E,0x22,0x6B,0x4E,0x1D,0x6B,0x4D,0x16,
-    0x5A,0xCB,0x0E,0x52,0xAA,0x06,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x2A,0xAA,0x06,0x4A,0xCB,0x3A,0x52,0x8B,0x56,0x4A,0x8A,0x6C,0x4A,0xAA,0x82,0x4A,0xAB,0x93,0x52,0xAB,0xA4,0x52,0xAB,0xB5,0x52,0xCB,0xC2,0x52,0xCB,0xCE,0x52,0xEC,0xDA,0x52,0xEC,0xE5,0x5A,0xEC,0xEB,0x5A,0xEC,0xF2,0x5B,0x0C,0xF8,0x5B,0x0C,0xFA,0x5B,0x0D,0xFD,0x5B,0x0D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFF,0x63,0x2D,0xFA,0x63,0x2D,0xF8,0x63,0x2D,0xF4,0x5B,0x2D,0xEB,0x5B,0x0D,0xE2,0x5B,0x0D,0xDA,0x63,0x0C,0xCC,0x63,0x2D,0xBC,0x63,0x2D,0xAA,0x63,0x2D,0x95,0x6B,0x4D,0x7D,0x63,0x4D,0x63,0x63,0x4D,0x46,0x63,0x0C,0x2A,0x52,0x8A,0x10,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x4D,0x8E,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x5A,0xFF,0xC6,0x7A,0xFF,0xC6,0x5A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x7A,0xFF,0xCE,0x7A,0xFF,0xCE,0x79,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xCE,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,
-    0xC6,0x39,0xFF,0xCE,0x59,0xFF,0xCE,0x79,0xFF,0xCE,0x79,0xF8,0x84,0x51,0x77,0x42,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x63,0x4D,0xE9,0xC6,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xBE,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x18,0xFF,0xC6,0x39,0xFF,0xCE,0x59,0xFF,0xBE,0x18,0xF8,0x63,0x2D,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x0C,0x08,0x9D,0x35,0x35,0x9D,0x14,0x5D,0x9D,0x14,0x7F,0x9D,0x14,0x9A,0x9C,0xF4,0xB1,0x9C,0xF4,0xC2,0x9C,0xF4,0xD2,0x9C,0xF4,0xDC,0x94,0xF4,0xE7,0x94,0xF4,0xED,0x94,0xD3,0xF4,0x94,0xD3,0xF8,0x94,0xD3,0xFA,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0x94,0xB3,0xFF,0x94,0xB3,0xFF,0x94,0xB3,0xFF,0x94,0xB3,0xFF,0x94,0xB3,0xFF,0x94,0xB3,0xFF,0x94,0xB3,0xFF,0x94,0xB3,0xFF,0x94,0x93,0xFF,0x8C,0x92,0xFF,0x8C,0x92,0xFF,0x8C,0x92,0xFF,0x8C,0x72,0xFF,0x8C,0x51,0xFF,0x84,0x31,0xFF,0x84,0x31,0xFF,
-    0x94,0x92,0xFF,0xAD,0x76,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0xBE,0x18,0xFF,0x5A,0xEC,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x52,0xAA,0x03,0x31,0x86,0x05,0x22,0x08,0x08,0x31,0xA6,0x0E,0x31,0x87,0x19,0x31,0xA7,0x30,0x31,0xC7,0x65,0x5A,0xEC,0xE2,0xAD,0x76,0xFF,0xC6,0x59,0xFF,0xC6,0x38,0xFF,0xC6,0x39,0xFF,0xBD,0xD7,0xFF,0x29,0xE7,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x31,0xC7,0x68,0xAD,0x96,0xFF,0xC6,0x39,0xFF,0xC6,0x38,0xFF,0xBE,0x18,0xFF,0x5A,0xEC,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x17,0xA5,0x14,0x7F,0xBD,0xD7,0xC2,0xB5,0x96,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x0C,0x9A,0xC6,0x39,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0x8C,0x92,0xD8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x49,0x1C,0xB5,0x96,0xFF,0xC6,0x38,0xFF,0xBD,0xF8,0xFF,0x42,0x49,0xA3,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xE7,0x1D,0xB5,0xD7,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0x94,0xF3,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x31,0x88,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xB5,0xB7,0xFF,0x39,0xC8,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x3D,0xBD,0xD7,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0x7C,0x10,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x10,0x8B,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xBE,0x18,0xFF,0x42,0x49,0xFF,
-    0x39,0xE8,0x7C,0x31,0xE8,0x3C,0x31,0xC7,0x42,0x31,0xE8,0x88,0x84,0x51,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0xBD,0xF8,0xFF,0x42,0x2A,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x8B,0x2B,0xC6,0x18,0xFF,0xC6,0x59,0xFF,0xC6,0x39,0xFF,0xC6,0x59,0xFF,0x7C,0x10,0xFF,0x52,0xCB,0xFF,0x52,0xCB,0xFF,0x9D,0x14,0xFF,0xBD,0xF8,0xFF,0xBD,0xD7,0xFF,0xBE,0x18,0xFF,0xA5,0x55,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x51,0x8B,0xC6,0x18,0xFF,0xC6,0x38,0xFF,0xC6,0x38,0xFF,
-    0xC6,0x38,0xFF,0xC6,0x18,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0xBE,0x18,0xFF,0xBD,0xF8,0xFF,0xA5,0x55,0xBA,0x00,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x73,0xAF,0x50,0xB5,0xD7,0xFA,0xC6,0x38,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xBE,0x18,0xFF,0xB5,0xD7,0xFF,0x84,0x51,0x8B,0x84,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0xAA,0x06,0x73,0xAE,0x42,
-    0x8C,0x92,0x95,0x94,0xD3,0xC6,0x8C,0x92,0xB5,0x73,0xAF,0x69,0x4A,0x49,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_img_dsc_t ui_img_weather_windy_png = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = sizeof(ui_img_weather_windy_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_weather_windy_png_data
-};
-
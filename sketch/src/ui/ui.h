@@ -78,36 +78,9 @@ LV_IMG_DECLARE(ui_img_custom_cat_right2_png);    // assets/custom/cat_right2.png
 LV_IMG_DECLARE(ui_img_custom_dog_left2_png);    // assets/custom/dog_left2.png
 LV_IMG_DECLARE(ui_img_custom_dog_right1_png);    // assets/custom/dog_right1.png
 LV_IMG_DECLARE(ui_img_custom_dog_right2_png);    // assets/custom/dog_right2.png
-LV_IMG_DECLARE(ui_img_numbers_1_png);    // assets/numbers/1.png
-LV_IMG_DECLARE(ui_img_numbers_2_png);    // assets/numbers/2.png
-LV_IMG_DECLARE(ui_img_numbers_3_png);    // assets/numbers/3.png
-LV_IMG_DECLARE(ui_img_numbers_4_png);    // assets/numbers/4.png
-LV_IMG_DECLARE(ui_img_numbers_5_png);    // assets/numbers/5.png
-LV_IMG_DECLARE(ui_img_numbers_6_png);    // assets/numbers/6.png
-LV_IMG_DECLARE(ui_img_numbers_7_png);    // assets/numbers/7.png
-LV_IMG_DECLARE(ui_img_numbers_8_png);    // assets/numbers/8.png
-LV_IMG_DECLARE(ui_img_numbers_9_png);    // assets/numbers/9.png
 LV_IMG_DECLARE(ui_img_numbers_minus_png);    // assets/numbers/minus.png
 LV_IMG_DECLARE(ui_img_numbers_plus_png);    // assets/numbers/plus.png
 LV_IMG_DECLARE(ui_img_numbers_slash_png);    // assets/numbers/slash.png
-LV_IMG_DECLARE(ui_img_wallpaper_beach_png);    // assets/wallpaper/beach.png
-LV_IMG_DECLARE(ui_img_wallpaper_christmas1_png);    // assets/wallpaper/christmas1.png
-LV_IMG_DECLARE(ui_img_wallpaper_christmas2_png);    // assets/wallpaper/christmas2.png
-LV_IMG_DECLARE(ui_img_wallpaper_future_png);    // assets/wallpaper/future.png
-LV_IMG_DECLARE(ui_img_wallpaper_nature_png);    // assets/wallpaper/nature.png
-LV_IMG_DECLARE(ui_img_wallpaper_thailand_png);    // assets/wallpaper/thailand.png
-LV_IMG_DECLARE(ui_img_weather_clearnight_png);    // assets/weather/clearnight.png
-LV_IMG_DECLARE(ui_img_weather_cloudy_png);    // assets/weather/cloudy.png
-LV_IMG_DECLARE(ui_img_weather_cloudynight_png);    // assets/weather/cloudynight.png
-LV_IMG_DECLARE(ui_img_weather_home_fall_png);    // assets/weather/home_fall.png
-LV_IMG_DECLARE(ui_img_weather_home_rain_png);    // assets/weather/home_rain.png
-LV_IMG_DECLARE(ui_img_weather_home_snow_png);    // assets/weather/home_snow.png
-LV_IMG_DECLARE(ui_img_weather_partlycloud_png);    // assets/weather/partlycloud.png
-LV_IMG_DECLARE(ui_img_weather_rain_png);    // assets/weather/rain.png
-LV_IMG_DECLARE(ui_img_weather_snow_png);    // assets/weather/snow.png
-LV_IMG_DECLARE(ui_img_weather_sunny_png);    // assets/weather/sunny.png
-LV_IMG_DECLARE(ui_img_weather_thunderstorm_png);    // assets/weather/thunderstorm.png
-LV_IMG_DECLARE(ui_img_weather_windy_png);    // assets/weather/windy.png
 
 // FONTS
 LV_FONT_DECLARE(ui_font_NixieOne48);
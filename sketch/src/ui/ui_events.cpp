@@ -10,12 +10,16 @@ Preferences pref;
 #include "lcd_bl_bsp/lcd_bl_pwm_bsp.h"
 #include "pcf85063/pcf85063.h"
 #include "task_msg/task_msg.h"
+#include "resume/resume.h"
 #include "updater/updater.h"
 #include "weather/weather.h"
 #include <LittleFS.h>
 #include "lvgl_port/lvgl_port.h"
+#include "asset/asset.h"
+#include <SD.h>
 
 #include "ESP32-audioI2S-master/Audio.h"
+#include "user_config.h"
 #include "es7210/es7210.h"
 extern Audio audio;
 uint8_t audio_volume = 10;
@@ -29,14 +33,16 @@ uint8_t wallpaperIndex = 0;
 bool mute = false;
 
 #define WIFI_CHECK_INTERVAL 5000 //wifi connection checking interval 5 second.
-#define MAX_WALLPAPER 7 //number of wallpaper (including none)
+#define MAX_CUSTOM_WALLPAPER 16 // custom wallpapers listed from the SD card
 
-// set wallpaper dropdown menu
+// built-in wallpapers on LittleFS, dropdown index = position + 1 (0 = none), keep the order for saved settings
+const char *wallpaper_builtin[] = {"thailand", "christmas1", "christmas2", "future", "beach", "nature"};
 const char *wallpaper_menu = "None\nThailand\nChristmas1\nChristmas2\nFuture\nBeach\nNature";
-// all wallaper image in c
-const lv_img_dsc_t *wallpaper_list[MAX_WALLPAPER] = {
-    NULL, &ui_img_wallpaper_thailand_png, &ui_img_wallpaper_christmas1_png, &ui_img_wallpaper_christmas2_png, &ui_img_wallpaper_future_png, &ui_img_wallpaper_beach_png, &ui_img_wallpaper_nature_png,
-};
+static char wallpaper_custom[MAX_CUSTOM_WALLPAPER][ASSET_NAME_LEN]; // SD card /wallpapers/*.tbi, after the built-in ones
+static uint8_t wallpaper_custom_count = 0;
+static const lv_img_dsc_t *wallpaper_img = NULL; // pinned in the asset cache while shown
+static void initWallpaperMenu();
+
 //wifi monitor call back from timer
 void lvgl_wifi_check_cb(lv_timer_t *t) {
   if (wifiEnable) {//if enable
@@ -52,6 +58,30 @@ void lv_create_delayed_task(lv_timer_cb_t callback, uint32_t delay_ms, void *use
   lv_timer_t *timer = lv_timer_create(callback, delay_ms, user_data); // Create a timer
   lv_timer_set_repeat_count(timer, 1); // Set the timer to run only once
 }
+// continue what was playing at the last power off, a track from its saved position
+static void resumePlayback() {
+  ResumeState rs;
+  if (!resumeInit(rs)) return;
+  char status_buffer[50];
+  if (rs.mediaType == 1 && rs.index < trackListLength) {
+    char trackPath[512];
+    if (!getTrackPath(rs.index, trackPath, sizeof(trackPath)) || resumePathHash(trackPath) != rs.pathHash) {
+      log_d("resume: track %u changed since, not resumed", rs.index);
+      return;
+    }
+    trackIndex = rs.index;
+    musicPlayerMode(NULL);
+    lv_label_set_text(ui_Player_Label_Label5, LV_SYMBOL_PAUSE);
+    lv_obj_set_style_radius(ui_Player_Button_play, 10, LV_PART_MAIN);
+    log_d("resume: %s at %u s", trackPath, rs.position);
+    audioPlayFS(0, trackPath, rs.position); // the cached seek index makes this land on the saved frame
+  } else if (rs.mediaType == 0 && rs.index < stationListLength) {
+    stationIndex = rs.index; // WiFi is not up yet, the station starts with play
+    snprintf(status_buffer, sizeof(status_buffer), "%d of %d", stationIndex + 1, stationListLength);
+    lv_label_set_text(ui_Player_Label_trackNumber, status_buffer);
+  }
+}
+
 // initalize lvgl ui
 void init_main_menu_task(lv_timer_t *timer) {
   lv_timer_del(timer);
@@ -77,13 +107,14 @@ void init_main_menu_task(lv_timer_t *timer) {
   uint8_t vol = 255 - (audio_volume * 255 / 21);
   lv_obj_set_style_bg_main_stop(ui_Player_Container_VolumeControl, vol, LV_PART_MAIN);
   lv_obj_set_style_bg_grad_stop(ui_Player_Container_VolumeControl, vol, LV_PART_MAIN);
-  lv_dropdown_set_options(ui_MainMenu_Dropdown_Wallpaper, wallpaper_menu); // set custom wallppaer list
   lv_label_set_text(ui_Info_Label_Label19, LV_SYMBOL_LEFT);
   lv_label_set_text(ui_Info_Label_Label22, LV_SYMBOL_RIGHT);
   lv_label_set_text(ui_Info_Label_Label21, LV_SYMBOL_DOWN);
   lv_label_set_text(ui_Utility_Label_Label27, LV_SYMBOL_UP);
 
   initSDCard(); // init SD Card
+  if (sizeof(TUNEBAR_PLACEMENT_BENCH) > 1) audio.benchDecoderPlacement(SD, TUNEBAR_PLACEMENT_BENCH); // A/B decode speed, internal RAM vs PSRAM
+  initWallpaperMenu(); // built-in + custom wallpapers from SD card
   loadStationList(); // load stations.csv from LittleFS
   initSongList(); // load music library from LittleFS
 
@@ -107,6 +138,7 @@ void init_main_menu_task(lv_timer_t *timer) {
   case 2: lv_label_set_text(ui_Player_Label_Label16, "1"); break;
   }
   wallpaperIndex = pref.getUChar("wallpaper", 1); // wallpaper
+  if (wallpaperIndex >= lv_dropdown_get_option_cnt(ui_MainMenu_Dropdown_Wallpaper)) wallpaperIndex = 0; // custom wallpaper gone
   lv_dropdown_set_selected(ui_MainMenu_Dropdown_Wallpaper, wallpaperIndex); // backlight timeout
   setWallpaper(NULL);
 
@@ -148,6 +180,7 @@ void init_main_menu_task(lv_timer_t *timer) {
 
   pref.end();
   SCREEN_OFF_TIMER = millis(); // reset timer
+  resumePlayback();
 
   if (wifiEnable) {
     lv_obj_add_state(ui_MainMenu_Switch_Wifi, LV_STATE_CHECKED);
@@ -261,11 +294,7 @@ void previoustrack(lv_event_t *e) {
   case 1: { // music player mode
     int pos = audio.getAudioCurrentTime();
     if (pos > 5) { // rewind if pos > 5 sec
-      AudioCommandPayload msg = {
-          .cmd = CMD_AUDIO_SET_PLAY_TIME,
-          .value = 0,
-      };
-      xQueueSend(audio_cmd_queue, &msg, 0); // send message
+      audioSetPlayTime(0);
       return;
     }
     // playing mode
@@ -501,130 +530,47 @@ void turnonScreen(lv_event_t *e) {
       case 1: setUpduty(LCD_PWM_MODE_150); break;
       case 2: setUpduty(LCD_PWM_MODE_255); break;
       }
-      UIStatusPayload msg = {
-        .type = STATUS_SCREEN_UNLOCK,
-      };
-      xQueueSend(ui_status_queue, &msg, 100); // send message
+      updateScreenLock(false);
     resetScreenOffTimer(NULL);
   }
   last_click_time = current_time;  
 }
 
+// dropdown list: none, built-in wallpapers, then the .tbi files found on the SD card
+static void initWallpaperMenu() {
+  wallpaper_custom_count = assetList(SD, WALLPAPER_DIR, wallpaper_custom, MAX_CUSTOM_WALLPAPER);
+  String menu = wallpaper_menu;
+  for (uint8_t i = 0; i < wallpaper_custom_count; i++) {
+    menu += "\n";
+    menu += wallpaper_custom[i];
+  }
+  lv_dropdown_set_options(ui_MainMenu_Dropdown_Wallpaper, menu.c_str()); // set custom wallppaer list
+  log_d("Wallpaper: %d custom from SD card", wallpaper_custom_count);
+}
+
 // change wallpapaer with dropdown
 void setWallpaper(lv_event_t *e) {
   // lv_obj_t *widget = lv_event_get_target(e);
   lv_obj_t *widget = ui_MainMenu_Dropdown_Wallpaper;
   wallpaperIndex = lv_dropdown_get_selected(widget);
-  const void *img_src = NULL; // default no wallpaper
-  if (wallpaperIndex < MAX_WALLPAPER) // default wallper
-    img_src = wallpaper_list[wallpaperIndex];
-  else { // user custom wallapper load from littleFS
-  }
-  lv_obj_set_style_bg_img_src(ui_Screen_Player, img_src, LV_PART_MAIN);
+  const lv_img_dsc_t *img = NULL; // default no wallpaper
+  const uint8_t builtin = ARRAY_SIZE(wallpaper_builtin);
+  char path[ASSET_PATH_LEN] = "";
+  if (wallpaperIndex >= 1 && wallpaperIndex <= builtin) { // default wallpaper, LittleFS
+    snprintf(path, sizeof(path), WALLPAPER_DIR "/%s" ASSET_EXT, wallpaper_builtin[wallpaperIndex - 1]);
+    img = assetAcquire(LittleFS, path);
+  } else if (wallpaperIndex > builtin && wallpaperIndex - builtin <= wallpaper_custom_count) { // user custom wallpaper, SD card
+    snprintf(path, sizeof(path), WALLPAPER_DIR "/%s" ASSET_EXT, wallpaper_custom[wallpaperIndex - builtin - 1]);
+    img = assetAcquire(SD, path);
+  }
+  if (wallpaperIndex && !img)
+    log_w("Wallpaper %s not loaded, upload the data folder to LittleFS", path);
+  lv_obj_set_style_bg_img_src(ui_Screen_Player, img, LV_PART_MAIN);
+  assetRelease(wallpaper_img); // the previous one stays cached until evicted
+  wallpaper_img = img;
   SCREEN_OFF_TIMER = millis(); // reset timer
 }
 
-/*
-
-#include <esp_heap_caps.h> // Ensure you include this if using ps_malloc
-
-// Function to load entire file from LittleFS into PSRAM
-// The returned pointer MUST be freed when the image is no longer needed.
-const uint8_t *load_file_from_fs(const char *lvgl_path, size_t expected_size) {
-    if (lvgl_path == NULL) return NULL;
-
-    // Strip the "L:" prefix (assuming path is "L:/wallpapers/xmas4.bin")
-    const char *fs_path = lvgl_path + 2;
-
-    if (!LittleFS.exists(fs_path)) {
-        log_e("Load Fail: File not found at %s", fs_path);
-        return NULL;
-    }
-
-    File f = LittleFS.open(fs_path, "r");
-    if (!f) {
-        log_e("Load Fail: Failed to open file: %s", fs_path);
-        return NULL;
-    }
-
-    size_t size = f.size();
-    if (size < expected_size) {
-        log_w("Load Warning: File size mismatch. Expected %d, got %d", expected_size, size);
-        // We will continue loading, but log the warning.
-    }
-
-    // Allocate buffer in PSRAM
-    uint8_t *data = (uint8_t *)ps_malloc(size);
-
-    if (data == NULL) {
-        log_e("Load Fail: Failed to allocate %d bytes (PSRAM full?)", size);
-        f.close();
-        return NULL;
-    }
-
-    size_t bytesRead = f.read(data, size);
-    f.close();
-
-    if (bytesRead != size) {
-        log_e("Load Fail: Read incomplete. Expected %d, got %d.", size, bytesRead);
-        free(data);
-        return NULL;
-    }
-
-    log_d("Load Success: %s loaded into PSRAM (%d bytes).", fs_path, size);
-    return data;
-}
-
-lv_img_dsc_t  wallpaper_img_dsc = {
-   {
-     0,
-        640,
-        172,
-       LV_IMG_CF_RGB565A8, // Assuming 3 bytes/pixel (640*172*3 = 330240)
-    },
-    0,
-    NULL,
-};
-
-
-void setWallpaper(lv_event_t *e) {
-    lv_obj_t *widget = ui_MainMenu_Dropdown_Wallpaper;
-    int wallpaperIndex = lv_dropdown_get_selected(widget);
-
-    const char *path = NULL;
-
-    switch (wallpaperIndex) {
-        case 0: path = NULL; break;
-        case 1: path = "L:/wallpapers/wallpaper1.jpg"; break;
-        case 2: path = "S:/wallpapers/wallpaper2.jpg"; break;
-        case 3: path = "S:/wallpapers/wallpaper3.jpg"; break;
-    }
-
-    // CRITICAL: Free the previous memory allocation before loading new data
-    if (wallpaper_img_dsc.data != NULL) {
-        free((void *)wallpaper_img_dsc.data);
-        wallpaper_img_dsc.data = NULL;
-    }
-
-    // Check if we are setting an image (case 0 is NULL)
-    if (path != NULL) {
-        // CALL THE EXPLICIT LOADING FUNCTION
-        wallpaper_img_dsc.data = load_file_from_fs(path, 330240);
-        wallpaper_img_dsc.data_size = 330240;
-    } else {
-        // Clear the source if the path is NULL
-        wallpaper_img_dsc.data = NULL;
-        wallpaper_img_dsc.data_size = 0;
-    }
-
-    log_d("Set Wallpaper: %s", path ? path : "NULL (Default)");
-
-    lv_obj_set_style_bg_img_src(ui_Screen_Player, &wallpaper_img_dsc, LV_PART_MAIN);
-
-    SCREEN_OFF_TIMER = millis();
-}
-
-*/
 //----------------- Main Menu Selection events ---------------------
 // mode 0 = live streaming , 1 = music player, 2 = ai chat
 // Livestream mode event
@@ -936,7 +882,7 @@ void torch_OFF(lv_event_t *e) {
 void showSystemInfo(lv_event_t *e) {
   SCREEN_OFF_TIMER = millis(); // reset timer
   // system info
-  static char infoText[160];
+  static char infoText[224];
   systemInfo(infoText, sizeof(infoText));
   lv_label_set_text(ui_Utility_Label_Build, infoText);
 
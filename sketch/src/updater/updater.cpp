@@ -1,5 +1,7 @@
 #include "lcd_bl_bsp/lcd_bl_pwm_bsp.h"
+#include "lvgl_port/lvgl_port.h"
 #include "network/network.h"
+#include "task_msg/task_msg.h"
 #include "ui/ui.h"
 #include <Arduino.h>
 #include <ArduinoJson.h>
@@ -97,7 +99,7 @@ const char *newFirmwareAvailable() { // return the new firmware version string i
       log_w("-> New firmware version available");
       char buf[32] = {0};
       snprintf(buf, sizeof(buf), "Update %s", latestVersion);
-      lv_label_set_text(ui_Utility_Label_Label11, buf);
+      ui_async_call([](void *, const char *text) { lv_label_set_text(ui_Utility_Label_Label11, text); }, NULL, buf); // wifi task
       return latestVersion;
     } else {
       log_i("-> Firmware is up to date");
@@ -114,47 +116,32 @@ const char *newFirmwareAvailable() { // return the new firmware version string i
 // status message
 static void ota_set_message_async(const char *txt) {
   if (!txt) return;
-  char *copy = strdup(txt); // 👈 heap copy
-  if (!copy) return;
-  log_i("%s", copy);
-  lv_async_call(
-      [](void *p) {
-        if (ota_msg) lv_label_set_text(ota_msg, (const char *)p);
-        free(p); // 👈 free after use
+  log_i("%s", txt);
+  ui_async_call(
+      [](void *, const char *text) {
+        if (ota_msg) lv_label_set_text(ota_msg, text);
       },
-      copy);
+      NULL, txt);
 }
-typedef struct {
-  uint8_t pct;
-  char txt[32];
-} ota_ui_msg_t;
 
 static void ota_set_progress_async(uint8_t pct, const char *txt) {
   log_i("%s", txt);
-  ota_ui_msg_t *m = (ota_ui_msg_t *)lv_mem_alloc(sizeof(ota_ui_msg_t));
-  m->pct = pct;
-  snprintf(m->txt, sizeof(m->txt), "%s", txt);
-  lv_async_call(
-      [](void *p) {
-        ota_ui_msg_t *m = (ota_ui_msg_t *)p;
-        if (ota_bar) lv_bar_set_value(ota_bar, m->pct, LV_ANIM_OFF);
-        if (ota_msg) lv_label_set_text(ota_msg, m->txt);
-        lv_mem_free(m); // IMPORTANT: free heap copy
+  ui_async_call(
+      [](void *p, const char *text) {
+        if (ota_bar) lv_bar_set_value(ota_bar, (uint8_t)(uintptr_t)p, LV_ANIM_OFF);
+        if (ota_msg) lv_label_set_text(ota_msg, text);
       },
-      m);
+      (void *)(uintptr_t)pct, txt);
 }
 static void ota_set_btn_label_async(const char *txt) {
   if (!txt) return;
-  char *copy = strdup(txt); // 👈 heap copy
-  if (!copy) return;
-  log_i("%s", copy);
-  lv_async_call(
-      [](void *p) {
+  log_i("%s", txt);
+  ui_async_call(
+      [](void *, const char *text) {
         lv_obj_clear_flag(btn_close, LV_OBJ_FLAG_HIDDEN);
-        if (lbl_update) lv_label_set_text(lbl_update, (const char *)p);
-        free(p); // 👈 free after use
+        if (lbl_update) lv_label_set_text(lbl_update, text);
       },
-      copy);
+      NULL, txt);
 }
 
 /* ========== OTA TASK ========== */
@@ -416,7 +403,7 @@ struct NotifyUpdateCtx {
 };
 
 // create notify a new firmware version msgbox
-static void notifyUpdate_ui(void *p) {
+static void notifyUpdate_ui(void *p, const char *) {
     NotifyUpdateCtx *ctx = (NotifyUpdateCtx *)p;
     if (!ctx) return;
 
@@ -486,7 +473,10 @@ void notifyUpdate(const char *latestVer) {
         free(ctx);
         return;
     }
-    lv_async_call(notifyUpdate_ui, ctx);
+    if (!ui_async_call(notifyUpdate_ui, ctx)) { // wifi task
+        free(ctx->title);
+        free(ctx);
+    }
 }
 
 
@@ -512,11 +502,15 @@ void systemInfo(char *buf, size_t len) {
   size_t total = LittleFS.totalBytes();
   float pct_free = (float)(total - used) * 100.0f / (float)total;
   uint64_t mac = ESP.getEfuseMac();
+  lvgl_port_stats_t port = lvgl_port_get_stats();
   snprintf(buf, len,
            "[ TuneBar by Va&Cob ]\n"
            "BUILD  : %s - %s\n"
            "SERIAL : %012" PRIx64 "\n"
-           "STORAGE : %u / %u KB (%.1f %% free)",
-           current_version, compile_date, mac, (unsigned)(used / 1024), (unsigned)(total / 1024), pct_free);
+           "STORAGE : %u / %u KB (%.1f %% free)\n"
+           "LVGL : %u KB (%u KB int), int LFB %u (min %u)",
+           current_version, compile_date, mac, (unsigned)(used / 1024), (unsigned)(total / 1024), pct_free,
+           (unsigned)(port.mem_used / 1024), (unsigned)(port.mem_internal / 1024), (unsigned)port.mem_free_biggest,
+           (unsigned)port.mem_free_biggest_min);
   log_d("%s", buf);
 }
\ No newline at end of file
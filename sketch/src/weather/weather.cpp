@@ -2,6 +2,9 @@
 #include "network/network.h"
 #include "pcf85063/pcf85063.h"
 #include "ui/ui.h"
+#include "asset/asset.h"
+#include "task_msg/task_msg.h"
+#include <LittleFS.h>
 #include <Arduino.h>
 #include <ArduinoJson.h>
 
@@ -66,7 +69,7 @@ struct Weather_JSON { // all aqi data from json
 #define LAND_SNOW 0xf0f0f0
 
 //---------- set weather panel background sky and land color by weather code
-void setWeatherPanelBgColor(int code, bool isNight) {
+void setWeatherPanelBgColor(UIBatch &batch, int code, bool isNight) {
   int sky_color = 0;
   int land_color = 0;
 
@@ -118,18 +121,56 @@ void setWeatherPanelBgColor(int code, bool isNight) {
       land_color = LAND_DAY_CLEAR;
   }
   // set weather background
-  lv_obj_set_style_bg_color(ui_Info_Panel_Weather, lv_color_hex(sky_color), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_color(ui_Info_Panel_Weather, lv_color_hex(land_color), LV_PART_MAIN);
+  ui_batch_bg_color(batch, ui_Info_Panel_Weather, sky_color);
+  ui_batch_bg_grad_color(batch, ui_Info_Panel_Weather, land_color);
+}
+
+//----------  weather icon atlas, tile order as packed by tools/img2tbi.py --atlas
+#define WEATHER_ATLAS ATLAS_DIR "/weather.tbi"
+#define WEATHER_ICON_H 96
+enum WeatherIcon {
+  ICON_SUNNY,
+  ICON_CLEARNIGHT,
+  ICON_THUNDERSTORM,
+  ICON_SNOW,
+  ICON_RAIN,
+  ICON_WINDY,
+  ICON_PARTLYCLOUD,
+  ICON_CLOUDYNIGHT,
+  ICON_CLOUDY,
+  ICON_HOME_SUNNY,
+  ICON_HOME_FALL,
+  ICON_HOME_RAIN,
+  ICON_HOME_SNOW,
+  ICON_COUNT
+};
+static lv_img_dsc_t weather_icon[ICON_COUNT];
+
+// tile of the atlas, the atlas is loaded once and kept
+static const lv_img_dsc_t *weatherIcon(WeatherIcon icon) {
+  static int8_t ready = 0; // 0 = not tried, 1 = loaded, -1 = missing
+  if (ready == 0) {
+    const lv_img_dsc_t *atlas = assetAcquire(LittleFS, WEATHER_ATLAS);
+    ready = 1;
+    for (uint8_t i = 0; i < ICON_COUNT && ready > 0; i++)
+      if (!assetTile(atlas, WEATHER_ICON_H, i, &weather_icon[i])) ready = -1;
+    if (ready < 0) {
+      log_w("Weather: %s missing, upload the data folder to LittleFS", WEATHER_ATLAS);
+      assetRelease(atlas);
+    }
+  }
+  if (ready < 0) return icon == ICON_HOME_SUNNY ? &ui_img_weather_home_sunny_png : NULL;
+  return &weather_icon[icon];
 }
 
 //----------  get weather icon image from weather code
 const lv_img_dsc_t *getWeatherIconImage(int code, bool isNight) {
   // --- Clear / Sunny ---
-  if (code == 1000) return isNight ? &ui_img_weather_clearnight_png : &ui_img_weather_sunny_png;
+  if (code == 1000) return isNight ? weatherIcon(ICON_CLEARNIGHT) : weatherIcon(ICON_SUNNY);
 
   // --- Thunderstorm (ต้องตรวจสอบก่อน Rain) ---
   // 1087, 1273, 1276 (Patchy light/moderate/heavy rain with thunder)
-  if (code == 1087 || (code >= 1273 && code <= 1276)) return &ui_img_weather_thunderstorm_png;
+  if (code == 1087 || (code >= 1273 && code <= 1276)) return weatherIcon(ICON_THUNDERSTORM);
 
   // --- Snow / Sleet / Ice Pellets / Hail ---
   // โค้ดทั้งหมดที่เกี่ยวข้องกับหิมะ/น้ำแข็ง
@@ -141,24 +182,24 @@ const lv_img_dsc_t *getWeatherIconImage(int code, bool isNight) {
       code == 1237 || // Ice pellets
       (code >= 1249 && code <= 1264) || // Light/Moderate/Heavy Sleet/Snow/Hail showers
       code == 1279 || code == 1282) // Snow with Thunder
-    return &ui_img_weather_snow_png;
+    return weatherIcon(ICON_SNOW);
 
   // --- Rain ---
   // 1063, 1150, 1153, 1180-1195, 1240-1246 (Rain and Drizzle)
-  if (code == 1063 || (code >= 1150 && code <= 1153) || (code >= 1180 && code <= 1195) || (code >= 1240 && code <= 1246)) return &ui_img_weather_rain_png;
+  if (code == 1063 || (code >= 1150 && code <= 1153) || (code >= 1180 && code <= 1195) || (code >= 1240 && code <= 1246)) return weatherIcon(ICON_RAIN);
 
   // --- Fog / Mist / Freezing Fog ---
   // 1030, 1135, 1147
-  if (code == 1030 || code == 1135 || code == 1147) return &ui_img_weather_windy_png; // หรือใช้ &ui_img_weather_fog_png หากมี
+  if (code == 1030 || code == 1135 || code == 1147) return weatherIcon(ICON_WINDY); // หรือใช้ &ui_img_weather_fog_png หากมี
 
   // --- Mostly Cloudy / Partly Cloudy ---
-  if (code == 1003 || code == 1006) return isNight ? &ui_img_weather_cloudynight_png : &ui_img_weather_partlycloud_png;
+  if (code == 1003 || code == 1006) return isNight ? weatherIcon(ICON_CLOUDYNIGHT) : weatherIcon(ICON_PARTLYCLOUD);
 
   // --- Overcast (แยกออกมาจาก Mostly/Partly Cloudy) ---
-  if (code == 1009) return &ui_img_weather_cloudy_png; // Overcast มักไม่เปลี่ยนตามกลางวัน/กลางคืน
+  if (code == 1009) return weatherIcon(ICON_CLOUDY); // Overcast มักไม่เปลี่ยนตามกลางวัน/กลางคืน
 
   // Fallback — safe default (ใช้ Overcast)
-  return &ui_img_weather_cloudy_png;
+  return weatherIcon(ICON_CLOUDY);
 }
 //----------  get home icon image from weather code
 const lv_img_dsc_t *getHomeIconImage(int code, bool isNight, int current_month) {
@@ -167,13 +208,13 @@ const lv_img_dsc_t *getHomeIconImage(int code, bool isNight, int current_month)
   // 1. --- Snow / Sleet / Hail / Freezing Rain / Ice Pellets / Thunder-Snow ---
   // (โค้ดกลุ่ม Snow/Ice/Hail เหมือนเดิม เพราะสำคัญที่สุด)
   if (code == 1066 || code == 1069 || code == 1072 || (code >= 1114 && code <= 1117) || (code >= 1168 && code <= 1171) || (code >= 1198 && code <= 1201) || (code >= 1210 && code <= 1225) || code == 1237 || (code >= 1249 && code <= 1264) || code == 1279 || code == 1282) {
-    return &ui_img_weather_home_snow_png;
+    return weatherIcon(ICON_HOME_SNOW);
   }
 
   // 2. --- Thunderstorm / Rain / Drizzle ---
   // (โค้ดกลุ่ม Rain/Thunderstorm เหมือนเดิม)
   if (code == 1087 || (code >= 1273 && code <= 1276) || code == 1063 || (code >= 1150 && code <= 1153) || (code >= 1180 && code <= 1195) || (code >= 1240 && code <= 1246)) {
-    return &ui_img_weather_home_rain_png;
+    return weatherIcon(ICON_HOME_RAIN);
   }
 
   // 3. --- Fall / Spring Logic (สำหรับสภาพอากาศที่ไม่รุนแรง) ---
@@ -186,7 +227,7 @@ const lv_img_dsc_t *getHomeIconImage(int code, bool isNight, int current_month)
     // ตรวจสอบว่าเป็นฤดูใบไม้ร่วง (Fall) หรือไม่
     if (current_month == 9 || current_month == 10 || current_month == 11) {
       // หากเป็นฤดูใบไม้ร่วง และสภาพอากาศไม่รุนแรง ให้แสดงไอคอน Fall
-      return &ui_img_weather_home_fall_png;
+      return weatherIcon(ICON_HOME_FALL);
     }
 
     // ตรวจสอบว่าเป็นฤดูใบไม้ผลิ (Spring) หรือไม่ (ตัวอย่าง: เดือน 3, 4, 5)
@@ -198,7 +239,7 @@ const lv_img_dsc_t *getHomeIconImage(int code, bool isNight, int current_month)
 
   // 4. --- Clear / Sunny / Cloudy / Mist / Fog (Default) ---
   // หากไม่เข้าเงื่อนไข Fall/Spring หรือไม่รู้จักโค้ด ให้แสดง Sunny เป็นค่าตั้งต้น
-  return &ui_img_weather_home_sunny_png;
+  return weatherIcon(ICON_HOME_SUNNY);
 }
 //==================== Pollution ========================
 // 1. DATA STRUCTURES & CONSTANTS
@@ -377,6 +418,8 @@ void updateWeatherPanelTask(void *parameter) {
   static char jsonBuf[JSON_BUF_SIZE];
   static JsonDocument doc;
   doc.clear();
+  static UIBatch batch; // whole panel in one update, applied by the LVGL task
+  ui_batch_begin(batch, 100);
 
   // fetch weather condition data from weather API
   if (fetchUrlData(reqURL, false, jsonBuf, JSON_BUF_SIZE)) {
@@ -395,12 +438,12 @@ void updateWeatherPanelTask(void *parameter) {
     int errorCode = doc["error"]["code"].as<int>();
     if (errorCode != 0 || usepa_index == 0) { // error occure
       log_e("Error code: %d %s", errorCode, doc["error"]["message"].as<const char *>());
-      lv_label_set_text(ui_Info_Label_AQIlocation, "No data available");
-      lv_img_set_src(ui_Info_Image_AQIimage, ""); // icon
-      lv_obj_set_style_bg_color(ui_Info_Panel_AQI, lv_color_hex(0x777777), LV_PART_MAIN);
-      lv_label_set_text(ui_Info_Label_AQIrate, "Please try select another city");
-      lv_label_set_text(ui_Info_Label_AQIvalue, "-");
-      lv_label_set_text(ui_Info_Label_AQIdominant, "");
+      ui_batch_label(batch, ui_Info_Label_AQIlocation, "No data available");
+      ui_batch_img(batch, ui_Info_Image_AQIimage, NULL); // icon
+      ui_batch_bg_color(batch, ui_Info_Panel_AQI, 0x777777);
+      ui_batch_label(batch, ui_Info_Label_AQIrate, "Please try select another city");
+      ui_batch_label(batch, ui_Info_Label_AQIvalue, "-");
+      ui_batch_label(batch, ui_Info_Label_AQIdominant, "");
 
     } else { // dadta available
 
@@ -446,16 +489,16 @@ void updateWeatherPanelTask(void *parameter) {
 
       // 4. update weather panel
       // 4.1 udpate AQI pollution widget
-      lv_img_set_src(ui_Info_Image_AQIimage, &us_epa_index_icon[data.usepa_index - 1]); // icon
-      lv_obj_set_style_bg_color(ui_Info_Panel_AQI, lv_color_hex(us_epa_index_colors[data.usepa_index - 1]), LV_PART_MAIN); // widget color
+      ui_batch_img(batch, ui_Info_Image_AQIimage, &us_epa_index_icon[data.usepa_index - 1]); // icon
+      ui_batch_bg_color(batch, ui_Info_Panel_AQI, us_epa_index_colors[data.usepa_index - 1]); // widget color
       // lv_obj_set_style_bg_opa(ui_Info_Panel_AQI, 150, LV_PART_MAIN); // widget transprent
-      lv_label_set_text(ui_Info_Label_AQIlocation, data.state);
-      lv_label_set_text(ui_Info_Label_AQIvalue, USAQI);
-      lv_label_set_text(ui_Info_Label_AQIrate, data.name);
-      lv_label_set_text(ui_Info_Label_AQIdominant, dominantPollutant);
+      ui_batch_label(batch, ui_Info_Label_AQIlocation, data.state);
+      ui_batch_label(batch, ui_Info_Label_AQIvalue, USAQI);
+      ui_batch_label(batch, ui_Info_Label_AQIrate, data.name);
+      ui_batch_label(batch, ui_Info_Label_AQIdominant, dominantPollutant);
       char lastupdated[64];
       snprintf(lastupdated, sizeof(lastupdated), "Last Updated: %s", data.last_updated);
-      lv_label_set_text(ui_Info_Label_LastUpdated, lastupdated);
+      ui_batch_label(batch, ui_Info_Label_LastUpdated, lastupdated);
 
       // 4.2 udpate weather condition widget
       bool isNight = (data.is_day == 0);
@@ -468,10 +511,10 @@ void updateWeatherPanelTask(void *parameter) {
       } else {
         snprintf(temp, sizeof(temp), "%.1f°F", data.temp_f);
       }
-      lv_label_set_text(ui_Info_Label_Temp, temp);
+      ui_batch_label(batch, ui_Info_Label_Temp, temp);
 
-      lv_img_set_src(ui_Info_Image_WeatherIcon, iconImg); // icon
-      lv_img_set_src(ui_Info_Image_Home, homeImg); // icon
+      ui_batch_img(batch, ui_Info_Image_WeatherIcon, iconImg); // icon
+      ui_batch_img(batch, ui_Info_Image_Home, homeImg); // icon
 
       char details[256]; // adjust size if UI text grows
 
@@ -494,9 +537,10 @@ void updateWeatherPanelTask(void *parameter) {
                  "UV Index : %.0f",
                  data.feelslike_f, data.wind_kph, data.wind_dir, data.humidity, data.pressure_in, data.uv);
       }
-      lv_label_set_text(ui_Info_Label_Detail, details);
-      setWeatherPanelBgColor(data.code, isNight); // set wallpaper
+      ui_batch_label(batch, ui_Info_Label_Detail, details);
+      setWeatherPanelBgColor(batch, data.code, isNight); // set wallpaper
     }
+    ui_batch_commit(batch);
   } else {
     log_e("Failed to fetch weather data from URL");
   }
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+"""
+img2tbi.py - pack an image into a TuneBar image asset (.tbi) for LittleFS / SD card
+
+  python3 tools/img2tbi.py <input> <output.tbi> [--raw]
+  python3 tools/img2tbi.py --atlas <output.tbi> <tile0> <tile1> ...
+
+  input  : a SquareLine / LVGL image C file (ui_img_*.c), or a PNG / JPG (needs Pillow)
+  output : header + LZ4 block payload, decoded by src/asset/asset.cpp into PSRAM
+
+  custom wallpapers: 640 x 172, copy the .tbi to /wallpapers on the SD card
+  --atlas: same size tiles stacked top to bottom in one image, tile n starts at row n * tile height
+           (see assetTile() in src/asset/asset.h), the tile order is the index used by the firmware
+
+layout (little endian, 20 bytes, must match AssetHeader in src/asset/asset.h):
+  uint32 magic 'TBIM', uint16 version, uint8 lv_img_cf_t, uint8 compression (0 raw, 1 lz4)
+  uint16 w, uint16 h, uint32 raw size, uint32 payload size
+"""
+import re
+import struct
+import sys
+
+MAGIC = 0x4D494254  # "TBIM"
+VERSION = 1
+COMP_RAW = 0
+COMP_LZ4 = 1
+
+CF = {"LV_IMG_CF_TRUE_COLOR": 4, "LV_IMG_CF_TRUE_COLOR_ALPHA": 5, "LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED": 6}
+
+
+def lz4_compress(src):
+    """greedy LZ4 block compressor, output is readable by any LZ4 block decoder"""
+    n = len(src)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    mflimit = n - 12  # last match must start 12 bytes before the end
+    matchlimit = n - 5  # last 5 bytes are always literals
+
+    def put_len(v):
+        while v >= 255:
+            out.append(255)
+            v -= 255
+        out.append(v)
+
+    while i < mflimit:
+        key = src[i:i + 4]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > 65535:
+            i += 1
+            continue
+        # extend the match
+        m = 4
+        while i + m < matchlimit and src[ref + m] == src[i + m]:
+            m += 1
+        lit = i - anchor
+        token = (min(lit, 15) << 4) | min(m - 4, 15)
+        out.append(token)
+        if lit >= 15:
+            put_len(lit - 15)
+        out += src[anchor:i]
+        out += struct.pack("<H", i - ref)
+        if m - 4 >= 15:
+            put_len(m - 4 - 15)
+        i += m
+        anchor = i
+        if i < mflimit:  # keep the table warm inside long matches
+            table[src[i - 2:i + 2]] = i - 2
+    lit = n - anchor
+    out.append(min(lit, 15) << 4)
+    if lit >= 15:
+        put_len(lit - 15)
+    out += src[anchor:]
+    return bytes(out)
+
+
+def lz4_decompress(src, size):
+    """reference decoder, used to verify the packed file"""
+    dst = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = src[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        dst += src[i:i + lit]
+        i += lit
+        if i >= len(src):
+            break
+        off = src[i] | (src[i + 1] << 8)
+        i += 2
+        m = (token & 15) + 4
+        if m == 19:
+            while True:
+                b = src[i]
+                i += 1
+                m += b
+                if b != 255:
+                    break
+        for _ in range(m):
+            dst.append(dst[-off])
+    assert len(dst) == size, "decoded %d bytes, expected %d" % (len(dst), size)
+    return bytes(dst)
+
+
+def load_c(path):
+    text = open(path, "r", encoding="utf-8", errors="ignore").read()
+    body = text[text.index("{", text.index("_data[]")):text.index("};")]
+    data = bytes(int(h, 16) for h in re.findall(r"0x([0-9A-Fa-f]{2})", body))
+    w = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    h = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+    cf = CF[re.search(r"\.header\.cf\s*=\s*(\w+)", text).group(1)]
+    return w, h, cf, data
+
+
+def load_png(path):
+    from PIL import Image  # pip install pillow
+
+    img = Image.open(path).convert("RGBA")
+    w, h = img.size
+    alpha = any(a < 255 for (_, _, _, a) in img.getdata())
+    data = bytearray()
+    for r, g, b, a in img.getdata():
+        c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        data += struct.pack(">H", c)  # LV_COLOR_16_SWAP = 1
+        if alpha:
+            data.append(a)
+    return w, h, CF["LV_IMG_CF_TRUE_COLOR_ALPHA" if alpha else "LV_IMG_CF_TRUE_COLOR"], bytes(data)
+
+
+def load(path):
+    return load_c(path) if path.endswith(".c") else load_png(path)
+
+
+def load_atlas(paths):
+    tiles = [load(p) for p in paths]
+    w, h, cf, _ = tiles[0]
+    for p, t in zip(paths, tiles):
+        if t[:3] != (w, h, cf):
+            sys.exit("%s: %dx%d cf %d, atlas tiles must all be %dx%d cf %d" % (p, t[0], t[1], t[2], w, h, cf))
+    return w, h * len(tiles), cf, b"".join(t[3] for t in tiles)
+
+
+def main():
+    args = [a for a in sys.argv[1:] if not a.startswith("--")]
+    if "--atlas" in sys.argv and len(args) >= 2:
+        dst = args[0]
+        w, h, cf, data = load_atlas(args[1:])
+    elif len(args) == 2:
+        src, dst = args
+        w, h, cf, data = load(src)
+    else:
+        print(__doc__)
+        sys.exit(1)
+    if "--raw" in sys.argv:
+        comp, payload = COMP_RAW, data
+    else:
+        comp, payload = COMP_LZ4, lz4_compress(data)
+        lz4_decompress(payload, len(data))
+    with open(dst, "wb") as f:
+        f.write(struct.pack("<IHBBHHII", MAGIC, VERSION, cf, comp, w, h, len(data), len(payload)))
+        f.write(payload)
+    print("%s: %dx%d cf %d, %d -> %d bytes" % (dst, w, h, cf, len(data), len(payload) + 20))
+
+
+if __name__ == "__main__":
+    main()